@@ -0,0 +1,108 @@
+/******************************************************************************
+* djinterp [test]                                                       main.c
+*
+*   Test runner for array_sort module standalone tests.
+*   Tests the contiguous array sorts: introsort with a comparator across
+* element sizes and input patterns, the typed and radix sorts, keyed record
+* sorts, the stable and parallel merge sorts, parallel run merging, and a
+* timing comparison against qsort.
+*
+*
+* path:      /config/.msvs/testing/c/container/array/
+*                djinterp-c-container-array-sort-tests-sa/main.c
+* author(s): Samuel 'teer' Neal-Blim
+******************************************************************************/
+#include "../../../../../../../inc/c/test/test_standalone.h"
+#include "../../../../../../../tests/c/container/array/array_sort_tests_sa.h"
+
+
+/******************************************************************************
+ * IMPLEMENTATION NOTES
+ *****************************************************************************/
+
+static const struct d_test_sa_note_item g_array_sort_status_items[] =
+{
+    { "[INFO]", "d_array_sort validated for word-sized and odd element sizes" },
+    { "[INFO]", "Sorted, reversed, equal, organ-pipe and sawtooth inputs sort correctly" },
+    { "[INFO]", "Typed sorts (d_array_sort_S) match the comparator sort" },
+    { "[INFO]", "Radix sorts order floating-point keys by IEEE-754 total order" },
+    { "[INFO]", "Keyed record sorts keep equal keys in their original order" },
+    { "[INFO]", "Parallel sorts (stable and unstable) match the sequential results" },
+    { "[INFO]", "d_array_merge_runs_parallel merges pre-sorted runs" }
+};
+
+static const struct d_test_sa_note_item g_array_sort_issues_items[] =
+{
+    { "[NOTE]", "d_array_sort is not stable; use d_array_sort_stable or a keyed sort" },
+    { "[NOTE]", "Inputs below D_ARRAY_SORT_PARALLEL_THRESHOLD sort on the calling thread" },
+    { "[WARN]", "Performance timings depend on the machine and are reported, not asserted" }
+};
+
+static const struct d_test_sa_note_item g_array_sort_steps_items[] =
+{
+    { "[TODO]", "Add adversarial inputs that drive introsort into its heapsort fallback" },
+    { "[TODO]", "Add parallel sort tests with more workers than elements per chunk" },
+    { "[TODO]", "Track the qsort comparison across releases" }
+};
+
+static const struct d_test_sa_note_item g_array_sort_guidelines_items[] =
+{
+    { "[BEST]", "Use the typed sorts when the element type is known at compile time" },
+    { "[BEST]", "Use radix or keyed sorts for large arrays of integer or float keys" },
+    { "[BEST]", "Use the parallel sorts only for arrays well above the threshold" }
+};
+
+static const struct d_test_sa_note_section g_array_sort_notes[] =
+{
+    { "CURRENT STATUS",
+      sizeof(g_array_sort_status_items) / sizeof(g_array_sort_status_items[0]),
+      g_array_sort_status_items },
+    { "KNOWN ISSUES",
+      sizeof(g_array_sort_issues_items) / sizeof(g_array_sort_issues_items[0]),
+      g_array_sort_issues_items },
+    { "NEXT STEPS",
+      sizeof(g_array_sort_steps_items) / sizeof(g_array_sort_steps_items[0]),
+      g_array_sort_steps_items },
+    { "BEST PRACTICES",
+      sizeof(g_array_sort_guidelines_items) / sizeof(g_array_sort_guidelines_items[0]),
+      g_array_sort_guidelines_items }
+};
+
+
+/******************************************************************************
+ * MAIN ENTRY POINT
+ *****************************************************************************/
+
+int
+main
+(
+    int    _argc,
+    char** _argv
+)
+{
+    struct d_test_sa_runner runner;
+
+    /* Suppress unused parameter warnings */
+    (void)_argc;
+    (void)_argv;
+
+    /* Initialize the test runner */
+    d_test_sa_runner_init(&runner,
+                          "djinterp array_sort Module",
+                          "Comprehensive Testing of Comparator, Typed, Radix "
+                          "and Parallel Array Sorts");
+
+    /* Register the array_sort module */
+    d_test_sa_runner_add_module_counter(&runner,
+                                        "array_sort",
+                                        "d_array_sort introsort, typed and radix "
+                                        "sorts, keyed record sorts, stable and "
+                                        "parallel merge sorts, and performance",
+                                        d_tests_sa_array_sort_run_all,
+                                        (sizeof(g_array_sort_notes) /
+                                            sizeof(g_array_sort_notes[0])),
+                                        g_array_sort_notes);
+
+    /* Execute all tests and return result */
+    return d_test_sa_runner_execute(&runner);
+}
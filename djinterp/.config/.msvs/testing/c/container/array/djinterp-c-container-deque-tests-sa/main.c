@@ -0,0 +1,108 @@
+/******************************************************************************
+* djinterp [test]                                                       main.c
+*
+*   Test runner for deque module standalone tests.
+*   Tests the d_deque type: constructors, indexed access, pushes and pops at
+* both ends, address stability, queue churn across block boundaries, bulk
+* append, prepend and range pops, copy-out, and clear and shrink.
+*
+*
+* path:      /config/.msvs/testing/c/container/array/
+*                djinterp-c-container-deque-tests-sa/main.c
+* author(s): Samuel 'teer' Neal-Blim
+******************************************************************************/
+#include "../../../../../../../inc/c/test/test_standalone.h"
+#include "../../../../../../../tests/c/container/array/deque_tests_sa.h"
+
+
+/******************************************************************************
+ * IMPLEMENTATION NOTES
+ *****************************************************************************/
+
+static const struct d_test_sa_note_item g_deque_status_items[] =
+{
+    { "[INFO]", "Constructor functions (new, new_from_arr, new_copy) validated" },
+    { "[INFO]", "Indexed access (get, set, front, back) working across blocks" },
+    { "[INFO]", "push/pop at both ends tested, including block map growth" },
+    { "[INFO]", "Element addresses stay valid while the deque grows" },
+    { "[INFO]", "Queue churn around a block boundary reuses the spare block" },
+    { "[INFO]", "Bulk functions (append, prepend, pop_front_range_to) validated" },
+    { "[INFO]", "copy_to, clear and shrink_to_fit working" }
+};
+
+static const struct d_test_sa_note_item g_deque_issues_items[] =
+{
+    { "[NOTE]", "Block capacity is a power of two so indexing needs no division" },
+    { "[NOTE]", "Growing the block map copies block pointers, never elements" },
+    { "[WARN]", "A deque is not contiguous; use copy_to or to_linear_array for raw loops" }
+};
+
+static const struct d_test_sa_note_item g_deque_steps_items[] =
+{
+    { "[TODO]", "Add insert and erase in the middle of the deque" },
+    { "[TODO]", "Create queue benchmarks against d_circular_array" },
+    { "[TODO]", "Add stress tests for long runs of push_front" }
+};
+
+static const struct d_test_sa_note_item g_deque_guidelines_items[] =
+{
+    { "[BEST]", "Use d_deque instead of d_vector_push_front for front insertion" },
+    { "[BEST]", "Use d_deque when a queue's size is not known in advance" },
+    { "[BEST]", "Use the range functions to move many elements at once" }
+};
+
+static const struct d_test_sa_note_section g_deque_notes[] =
+{
+    { "CURRENT STATUS",
+      sizeof(g_deque_status_items) / sizeof(g_deque_status_items[0]),
+      g_deque_status_items },
+    { "KNOWN ISSUES",
+      sizeof(g_deque_issues_items) / sizeof(g_deque_issues_items[0]),
+      g_deque_issues_items },
+    { "NEXT STEPS",
+      sizeof(g_deque_steps_items) / sizeof(g_deque_steps_items[0]),
+      g_deque_steps_items },
+    { "BEST PRACTICES",
+      sizeof(g_deque_guidelines_items) / sizeof(g_deque_guidelines_items[0]),
+      g_deque_guidelines_items }
+};
+
+
+/******************************************************************************
+ * MAIN ENTRY POINT
+ *****************************************************************************/
+
+int
+main
+(
+    int    _argc,
+    char** _argv
+)
+{
+    struct d_test_sa_runner runner;
+
+    /* Suppress unused parameter warnings */
+    (void)_argc;
+    (void)_argv;
+
+    /* Initialize the test runner */
+    d_test_sa_runner_init(&runner,
+                          "djinterp deque Module",
+                          "Comprehensive Testing of d_deque Double-Ended Queue "
+                          "Functions and Operations");
+
+    /* Register the deque module */
+    d_test_sa_runner_add_module_counter(&runner,
+                                        "deque",
+                                        "d_deque functions for constructors, "
+                                        "access, push/pop at both ends, address "
+                                        "stability, bulk operations, and "
+                                        "capacity management",
+                                        d_tests_sa_deque_run_all,
+                                        (sizeof(g_deque_notes) /
+                                            sizeof(g_deque_notes[0])),
+                                        g_deque_notes);
+
+    /* Execute all tests and return result */
+    return d_test_sa_runner_execute(&runner);
+}
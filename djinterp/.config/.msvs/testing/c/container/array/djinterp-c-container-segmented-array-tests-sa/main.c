@@ -0,0 +1,108 @@
+/******************************************************************************
+* djinterp [test]                                                       main.c
+*
+*   Test runner for segmented_array module standalone tests.
+*   Tests the d_segmented_array type: constructors, indexed access, appends
+* and removals, address stability across growth, reserve and shrink, the
+* block accessors, copy-out, search, and the block-wise filter adaptors.
+*
+*
+* path:      /config/.msvs/testing/c/container/array/
+*                djinterp-c-container-segmented-array-tests-sa/main.c
+* author(s): Samuel 'teer' Neal-Blim
+******************************************************************************/
+#include "../../../../../../../inc/c/test/test_standalone.h"
+#include "../../../../../../../tests/c/container/array/segmented_array_tests_sa.h"
+
+
+/******************************************************************************
+ * IMPLEMENTATION NOTES
+ *****************************************************************************/
+
+static const struct d_test_sa_note_item g_segmented_array_status_items[] =
+{
+    { "[INFO]", "Constructor functions (new, new_from_arr, new_copy) validated" },
+    { "[INFO]", "Indexed access (get, set) maps indices to blocks in O(1)" },
+    { "[INFO]", "Modification (push_back, append, pop, truncate) tested" },
+    { "[INFO]", "Element addresses stay valid while the array grows" },
+    { "[INFO]", "Capacity management (reserve, shrink_to_fit) frees only empty blocks" },
+    { "[INFO]", "Block accessors, copy_to and find validated" },
+    { "[INFO]", "Block-wise filter adaptors match the contiguous filters" }
+};
+
+static const struct d_test_sa_note_item g_segmented_array_issues_items[] =
+{
+    { "[NOTE]", "Block capacities double (B, 2B, 4B, ...), so at most one block is partly empty" },
+    { "[NOTE]", "Elements are never moved by growth; removal invalidates only removed elements" },
+    { "[WARN]", "A segmented array is not contiguous; use the block accessors for raw loops" }
+};
+
+static const struct d_test_sa_note_item g_segmented_array_steps_items[] =
+{
+    { "[TODO]", "Add stress tests for arrays spanning every block index slot" },
+    { "[TODO]", "Add insert and erase in the middle of the array" },
+    { "[TODO]", "Create growth benchmarks against d_vector" }
+};
+
+static const struct d_test_sa_note_item g_segmented_array_guidelines_items[] =
+{
+    { "[BEST]", "Use d_segmented_array when pointers to elements must survive growth" },
+    { "[BEST]", "Process elements one block at a time for contiguous algorithms" },
+    { "[BEST]", "Call reserve before bulk appends to allocate blocks up front" }
+};
+
+static const struct d_test_sa_note_section g_segmented_array_notes[] =
+{
+    { "CURRENT STATUS",
+      sizeof(g_segmented_array_status_items) / sizeof(g_segmented_array_status_items[0]),
+      g_segmented_array_status_items },
+    { "KNOWN ISSUES",
+      sizeof(g_segmented_array_issues_items) / sizeof(g_segmented_array_issues_items[0]),
+      g_segmented_array_issues_items },
+    { "NEXT STEPS",
+      sizeof(g_segmented_array_steps_items) / sizeof(g_segmented_array_steps_items[0]),
+      g_segmented_array_steps_items },
+    { "BEST PRACTICES",
+      sizeof(g_segmented_array_guidelines_items) / sizeof(g_segmented_array_guidelines_items[0]),
+      g_segmented_array_guidelines_items }
+};
+
+
+/******************************************************************************
+ * MAIN ENTRY POINT
+ *****************************************************************************/
+
+int
+main
+(
+    int    _argc,
+    char** _argv
+)
+{
+    struct d_test_sa_runner runner;
+
+    /* Suppress unused parameter warnings */
+    (void)_argc;
+    (void)_argv;
+
+    /* Initialize the test runner */
+    d_test_sa_runner_init(&runner,
+                          "djinterp segmented_array Module",
+                          "Comprehensive Testing of d_segmented_array Block "
+                          "Storage Functions and Operations");
+
+    /* Register the segmented_array module */
+    d_test_sa_runner_add_module_counter(&runner,
+                                        "segmented_array",
+                                        "d_segmented_array functions for "
+                                        "constructors, access, modification, "
+                                        "address stability, capacity, block "
+                                        "access, search, and filtering",
+                                        d_tests_sa_segmented_array_run_all,
+                                        (sizeof(g_segmented_array_notes) /
+                                            sizeof(g_segmented_array_notes[0])),
+                                        g_segmented_array_notes);
+
+    /* Execute all tests and return result */
+    return d_test_sa_runner_execute(&runner);
+}
@@ -0,0 +1,108 @@
+/******************************************************************************
+* djinterp [test]                                                       main.c
+*
+*   Test runner for soa_table module standalone tests.
+*   Tests the d_soa_table columnar table: schema construction, scattering and
+* gathering rows, batched row pushes, cell access, ordered and swap removal,
+* the typed select, refine and count scans, their type checks, and
+* comparator-based selection.
+*
+*
+* path:      /config/.msvs/testing/c/container/array/
+*                djinterp-c-container-soa-table-tests-sa/main.c
+* author(s): Samuel 'teer' Neal-Blim
+******************************************************************************/
+#include "../../../../../../../inc/c/test/test_standalone.h"
+#include "../../../../../../../tests/c/container/array/soa_table_tests_sa.h"
+
+
+/******************************************************************************
+ * IMPLEMENTATION NOTES
+ *****************************************************************************/
+
+static const struct d_test_sa_note_item g_soa_table_status_items[] =
+{
+    { "[INFO]", "Schema validation in d_soa_table_new tested" },
+    { "[INFO]", "push_row and get_row round-trip structs through the columns" },
+    { "[INFO]", "push_rows, cell and set_cell validated" },
+    { "[INFO]", "Removal functions (remove, remove_swap, clear) keep columns aligned" },
+    { "[INFO]", "Typed scans (select_S, refine_S, count_S) match a row-by-row check" },
+    { "[INFO]", "Typed scans match nothing on a column of another type" },
+    { "[INFO]", "select_cmp covers column types without a typed scan" }
+};
+
+static const struct d_test_sa_note_item g_soa_table_issues_items[] =
+{
+    { "[NOTE]", "Each field records its offset in the row struct; the schema must match it" },
+    { "[NOTE]", "Selections hold row indices and are invalidated by removal" },
+    { "[WARN]", "remove_swap changes the index of the last row" }
+};
+
+static const struct d_test_sa_note_item g_soa_table_steps_items[] =
+{
+    { "[TODO]", "Add scan benchmarks against a row array of the same structs" },
+    { "[TODO]", "Add range predicates (between) to the typed scans" },
+    { "[TODO]", "Test tables with many columns of mixed widths" }
+};
+
+static const struct d_test_sa_note_item g_soa_table_guidelines_items[] =
+{
+    { "[BEST]", "Use d_soa_table when scans read a few fields of many rows" },
+    { "[BEST]", "Start with the most selective column, then refine" },
+    { "[BEST]", "Use count_S when only the number of matches is needed" }
+};
+
+static const struct d_test_sa_note_section g_soa_table_notes[] =
+{
+    { "CURRENT STATUS",
+      sizeof(g_soa_table_status_items) / sizeof(g_soa_table_status_items[0]),
+      g_soa_table_status_items },
+    { "KNOWN ISSUES",
+      sizeof(g_soa_table_issues_items) / sizeof(g_soa_table_issues_items[0]),
+      g_soa_table_issues_items },
+    { "NEXT STEPS",
+      sizeof(g_soa_table_steps_items) / sizeof(g_soa_table_steps_items[0]),
+      g_soa_table_steps_items },
+    { "BEST PRACTICES",
+      sizeof(g_soa_table_guidelines_items) / sizeof(g_soa_table_guidelines_items[0]),
+      g_soa_table_guidelines_items }
+};
+
+
+/******************************************************************************
+ * MAIN ENTRY POINT
+ *****************************************************************************/
+
+int
+main
+(
+    int    _argc,
+    char** _argv
+)
+{
+    struct d_test_sa_runner runner;
+
+    /* Suppress unused parameter warnings */
+    (void)_argc;
+    (void)_argv;
+
+    /* Initialize the test runner */
+    d_test_sa_runner_init(&runner,
+                          "djinterp soa_table Module",
+                          "Comprehensive Testing of d_soa_table Columnar "
+                          "Storage and Column Scans");
+
+    /* Register the soa_table module */
+    d_test_sa_runner_add_module_counter(&runner,
+                                        "soa_table",
+                                        "d_soa_table functions for schemas, "
+                                        "row scatter/gather, cells, removal, "
+                                        "typed scans, and comparator selection",
+                                        d_tests_sa_soa_table_run_all,
+                                        (sizeof(g_soa_table_notes) /
+                                            sizeof(g_soa_table_notes[0])),
+                                        g_soa_table_notes);
+
+    /* Execute all tests and return result */
+    return d_test_sa_runner_execute(&runner);
+}
@@ -0,0 +1,110 @@
+/******************************************************************************
+* djinterp [test]                                                       main.c
+*
+*   Test runner for sorted_array module standalone tests.
+*   Tests the d_sorted_array type: constructors, single and batched inserts,
+* stable merging, removal, lower and upper bounds, keyed integer searches,
+* Eytzinger snapshots, and in-place filtering.
+*
+*
+* path:      /config/.msvs/testing/c/container/array/
+*                djinterp-c-container-sorted-array-tests-sa/main.c
+* author(s): Samuel 'teer' Neal-Blim
+******************************************************************************/
+#include "../../../../../../../inc/c/test/test_standalone.h"
+#include "../../../../../../../tests/c/container/array/sorted_array_tests_sa.h"
+
+
+/******************************************************************************
+ * IMPLEMENTATION NOTES
+ *****************************************************************************/
+
+static const struct d_test_sa_note_item g_sorted_array_status_items[] =
+{
+    { "[INFO]", "Constructor functions (new, new_keyed, new_from_arr) validated" },
+    { "[INFO]", "Single inserts keep the array ordered" },
+    { "[INFO]", "insert_all merges a batch in one pass and keeps equal elements stable" },
+    { "[INFO]", "Removal functions (remove, remove_at) tested" },
+    { "[INFO]", "Search functions (lower_bound, upper_bound, find, contains, count_equal) validated" },
+    { "[INFO]", "Keyed int and uint lower bounds match comparator searches" },
+    { "[INFO]", "Snapshot searches agree with searches on the array itself" },
+    { "[INFO]", "Filter functions (count_where, filter_in_place) keep the order" }
+};
+
+static const struct d_test_sa_note_item g_sorted_array_issues_items[] =
+{
+    { "[NOTE]", "Single inserts cost O(n); batch writes with insert_all" },
+    { "[NOTE]", "Keyed arrays never call a comparator; ordering comes from the key field" },
+    { "[WARN]", "A snapshot is a copy and does not see later changes to the array" }
+};
+
+static const struct d_test_sa_note_item g_sorted_array_steps_items[] =
+{
+    { "[TODO]", "Add randomized tests comparing searches against a linear scan" },
+    { "[TODO]", "Create lookup benchmarks against bsearch" },
+    { "[TODO]", "Test keyed arrays with the key at a non-zero offset and large elements" }
+};
+
+static const struct d_test_sa_note_item g_sorted_array_guidelines_items[] =
+{
+    { "[BEST]", "Use d_sorted_array for read-mostly lookup tables" },
+    { "[BEST]", "Prefer new_keyed when elements carry an integer key" },
+    { "[BEST]", "Take a snapshot for long runs of searches with no writes" },
+    { "[BEST]", "Rebuild snapshots after every batch of writes" }
+};
+
+static const struct d_test_sa_note_section g_sorted_array_notes[] =
+{
+    { "CURRENT STATUS",
+      sizeof(g_sorted_array_status_items) / sizeof(g_sorted_array_status_items[0]),
+      g_sorted_array_status_items },
+    { "KNOWN ISSUES",
+      sizeof(g_sorted_array_issues_items) / sizeof(g_sorted_array_issues_items[0]),
+      g_sorted_array_issues_items },
+    { "NEXT STEPS",
+      sizeof(g_sorted_array_steps_items) / sizeof(g_sorted_array_steps_items[0]),
+      g_sorted_array_steps_items },
+    { "BEST PRACTICES",
+      sizeof(g_sorted_array_guidelines_items) / sizeof(g_sorted_array_guidelines_items[0]),
+      g_sorted_array_guidelines_items }
+};
+
+
+/******************************************************************************
+ * MAIN ENTRY POINT
+ *****************************************************************************/
+
+int
+main
+(
+    int    _argc,
+    char** _argv
+)
+{
+    struct d_test_sa_runner runner;
+
+    /* Suppress unused parameter warnings */
+    (void)_argc;
+    (void)_argv;
+
+    /* Initialize the test runner */
+    d_test_sa_runner_init(&runner,
+                          "djinterp sorted_array Module",
+                          "Comprehensive Testing of d_sorted_array Ordered "
+                          "Storage and Search Functions");
+
+    /* Register the sorted_array module */
+    d_test_sa_runner_add_module_counter(&runner,
+                                        "sorted_array",
+                                        "d_sorted_array functions for "
+                                        "constructors, inserts, batched merges, "
+                                        "removal, bounds, keyed search, "
+                                        "snapshots, and filtering",
+                                        d_tests_sa_sorted_array_run_all,
+                                        (sizeof(g_sorted_array_notes) /
+                                            sizeof(g_sorted_array_notes[0])),
+                                        g_sorted_array_notes);
+
+    /* Execute all tests and return result */
+    return d_test_sa_runner_execute(&runner);
+}
@@ -0,0 +1,105 @@
+/******************************************************************************
+* djinterp [test]                                                       main.c
+*
+*   Test runner for bitset module standalone tests.
+*   Tests the d_bitset type: construction, setting and resetting single bits
+* and ranges, resizing, counting, rank and select, set-bit iteration,
+* conversion to indices, in-place and/or/xor/andnot, mismatched sizes, and
+* the shared d_bitset_words_* kernels.
+*
+*
+* path:      /config/.msvs/testing/c/container/bitset/
+*                djinterp-c-container-bitset-tests-sa/main.c
+* author(s): Samuel 'teer' Neal-Blim
+******************************************************************************/
+#include "../../../../../../../inc/c/test/test_standalone.h"
+#include "../../../../../../../tests/c/container/bitset/bitset_tests_sa.h"
+
+
+/******************************************************************************
+ * IMPLEMENTATION NOTES
+ *****************************************************************************/
+
+static const struct d_test_sa_note_item g_bitset_status_items[] =
+{
+    { "[INFO]", "Constructor and resize functions validated" },
+    { "[INFO]", "Bit access (set, reset, set_range) working across word boundaries" },
+    { "[INFO]", "Queries (count, rank, select, next) match a bit-by-bit scan" },
+    { "[INFO]", "to_indices returns the set bits in ascending order" },
+    { "[INFO]", "In-place and, or, xor and andnot tested, including mismatched sizes" },
+    { "[INFO]", "d_bitset_words_* kernels handle vector-loop remainders and unaligned arrays" }
+};
+
+static const struct d_test_sa_note_item g_bitset_issues_items[] =
+{
+    { "[NOTE]", "Bits past `size` in the last word are kept zero" },
+    { "[NOTE]", "The word kernels use AVX2, SSE2 or NEON only when the build targets them" }
+};
+
+static const struct d_test_sa_note_item g_bitset_steps_items[] =
+{
+    { "[TODO]", "Run the kernel tests once per vector width on each platform" },
+    { "[TODO]", "Add rank/select benchmarks for large bitsets" }
+};
+
+static const struct d_test_sa_note_item g_bitset_guidelines_items[] =
+{
+    { "[BEST]", "Use a bitset for dense sets of row indices" },
+    { "[BEST]", "Combine bitsets in place instead of building new ones" },
+    { "[BEST]", "Use d_roaring when the set is sparse" }
+};
+
+static const struct d_test_sa_note_section g_bitset_notes[] =
+{
+    { "CURRENT STATUS",
+      sizeof(g_bitset_status_items) / sizeof(g_bitset_status_items[0]),
+      g_bitset_status_items },
+    { "KNOWN ISSUES",
+      sizeof(g_bitset_issues_items) / sizeof(g_bitset_issues_items[0]),
+      g_bitset_issues_items },
+    { "NEXT STEPS",
+      sizeof(g_bitset_steps_items) / sizeof(g_bitset_steps_items[0]),
+      g_bitset_steps_items },
+    { "BEST PRACTICES",
+      sizeof(g_bitset_guidelines_items) / sizeof(g_bitset_guidelines_items[0]),
+      g_bitset_guidelines_items }
+};
+
+
+/******************************************************************************
+ * MAIN ENTRY POINT
+ *****************************************************************************/
+
+int
+main
+(
+    int    _argc,
+    char** _argv
+)
+{
+    struct d_test_sa_runner runner;
+
+    /* Suppress unused parameter warnings */
+    (void)_argc;
+    (void)_argv;
+
+    /* Initialize the test runner */
+    d_test_sa_runner_init(&runner,
+                          "djinterp bitset Module",
+                          "Comprehensive Testing of d_bitset Bit Access, "
+                          "Queries and Set Algebra");
+
+    /* Register the bitset module */
+    d_test_sa_runner_add_module_counter(&runner,
+                                        "bitset",
+                                        "d_bitset functions for construction, "
+                                        "bit access, resizing, count, rank, "
+                                        "select, iteration, and set algebra",
+                                        d_tests_sa_bitset_run_all,
+                                        (sizeof(g_bitset_notes) /
+                                            sizeof(g_bitset_notes[0])),
+                                        g_bitset_notes);
+
+    /* Execute all tests and return result */
+    return d_test_sa_runner_execute(&runner);
+}
@@ -0,0 +1,106 @@
+/******************************************************************************
+* djinterp [test]                                                       main.c
+*
+*   Test runner for roaring module standalone tests.
+*   Tests the d_roaring compressed bitmap: adding and removing values,
+* conversion between array and bitmap containers, rank and select, copy and
+* equality, and/or/andnot across container kinds, and conversion to and from
+* d_bitset.
+*
+*
+* path:      /config/.msvs/testing/c/container/bitset/
+*                djinterp-c-container-roaring-tests-sa/main.c
+* author(s): Samuel 'teer' Neal-Blim
+******************************************************************************/
+#include "../../../../../../../inc/c/test/test_standalone.h"
+#include "../../../../../../../tests/c/container/bitset/roaring_tests_sa.h"
+
+
+/******************************************************************************
+ * IMPLEMENTATION NOTES
+ *****************************************************************************/
+
+static const struct d_test_sa_note_item g_roaring_status_items[] =
+{
+    { "[INFO]", "add and remove validated within and across 65536-value chunks" },
+    { "[INFO]", "Containers switch between array and bitmap at D_ROARING_ARRAY_MAX" },
+    { "[INFO]", "rank and select match a sorted list of the values" },
+    { "[INFO]", "copy and equals tested" },
+    { "[INFO]", "and, or and andnot tested for every pair of container kinds" },
+    { "[INFO]", "Round trips through d_bitset preserve the set" }
+};
+
+static const struct d_test_sa_note_item g_roaring_issues_items[] =
+{
+    { "[NOTE]", "Values are 32-bit; chunks are keyed by the high 16 bits" },
+    { "[NOTE]", "Run-length containers are not implemented" }
+};
+
+static const struct d_test_sa_note_item g_roaring_steps_items[] =
+{
+    { "[TODO]", "Add randomized tests against d_bitset for large value ranges" },
+    { "[TODO]", "Add xor" },
+    { "[TODO]", "Create memory and speed benchmarks against d_bitset" }
+};
+
+static const struct d_test_sa_note_item g_roaring_guidelines_items[] =
+{
+    { "[BEST]", "Use d_roaring for sparse or clustered sets" },
+    { "[BEST]", "Convert to d_bitset for repeated dense algebra" }
+};
+
+static const struct d_test_sa_note_section g_roaring_notes[] =
+{
+    { "CURRENT STATUS",
+      sizeof(g_roaring_status_items) / sizeof(g_roaring_status_items[0]),
+      g_roaring_status_items },
+    { "KNOWN ISSUES",
+      sizeof(g_roaring_issues_items) / sizeof(g_roaring_issues_items[0]),
+      g_roaring_issues_items },
+    { "NEXT STEPS",
+      sizeof(g_roaring_steps_items) / sizeof(g_roaring_steps_items[0]),
+      g_roaring_steps_items },
+    { "BEST PRACTICES",
+      sizeof(g_roaring_guidelines_items) / sizeof(g_roaring_guidelines_items[0]),
+      g_roaring_guidelines_items }
+};
+
+
+/******************************************************************************
+ * MAIN ENTRY POINT
+ *****************************************************************************/
+
+int
+main
+(
+    int    _argc,
+    char** _argv
+)
+{
+    struct d_test_sa_runner runner;
+
+    /* Suppress unused parameter warnings */
+    (void)_argc;
+    (void)_argv;
+
+    /* Initialize the test runner */
+    d_test_sa_runner_init(&runner,
+                          "djinterp roaring Module",
+                          "Comprehensive Testing of d_roaring Compressed "
+                          "Bitmaps and Set Algebra");
+
+    /* Register the roaring module */
+    d_test_sa_runner_add_module_counter(&runner,
+                                        "roaring",
+                                        "d_roaring functions for add/remove, "
+                                        "container conversion, rank, select, "
+                                        "copy, equality, set algebra, and "
+                                        "d_bitset conversion",
+                                        d_tests_sa_roaring_run_all,
+                                        (sizeof(g_roaring_notes) /
+                                            sizeof(g_roaring_notes[0])),
+                                        g_roaring_notes);
+
+    /* Execute all tests and return result */
+    return d_test_sa_runner_execute(&runner);
+}
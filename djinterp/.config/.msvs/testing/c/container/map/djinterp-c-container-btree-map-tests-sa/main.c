@@ -0,0 +1,110 @@
+/******************************************************************************
+* djinterp [test]                                                       main.c
+*
+*   Test runner for btree_map module standalone tests.
+*   Tests the d_btree_map B+tree: node sizing, puts and gets across splits,
+* append-friendly splitting for ascending keys, removal with borrows and
+* merges, randomized operations against a reference, bulk loading, range
+* cursors, range iterators, and comparator-ordered keys.
+*
+*
+* path:      /config/.msvs/testing/c/container/map/
+*                djinterp-c-container-btree-map-tests-sa/main.c
+* author(s): Samuel 'teer' Neal-Blim
+******************************************************************************/
+#include "../../../../../../../inc/c/test/test_standalone.h"
+#include "../../../../../../../tests/c/container/map/btree_map_tests_sa.h"
+
+
+/******************************************************************************
+ * IMPLEMENTATION NOTES
+ *****************************************************************************/
+
+static const struct d_test_sa_note_item g_btree_map_status_items[] =
+{
+    { "[INFO]", "Constructors (new, new_keyed) size nodes to whole cache lines" },
+    { "[INFO]", "put/get validated across many splits; existing keys are replaced" },
+    { "[INFO]", "Ascending inserts leave full leaves behind" },
+    { "[INFO]", "remove keeps every key reachable through borrows, merges and root changes" },
+    { "[INFO]", "Randomized operations match a reference after each phase" },
+    { "[INFO]", "bulk_load builds the tree bottom-up and rejects unsorted input" },
+    { "[INFO]", "Range cursors and D_ITER_FOREACH iterators yield ranges in order" },
+    { "[INFO]", "Comparator maps order odd-sized string keys" }
+};
+
+static const struct d_test_sa_note_item g_btree_map_issues_items[] =
+{
+    { "[NOTE]", "Keyed maps search nodes without calling a comparator" },
+    { "[NOTE]", "Keys are copied into nodes; values are stored as pointers" },
+    { "[WARN]", "Modifying the map invalidates all cursors and iterators on it" }
+};
+
+static const struct d_test_sa_note_item g_btree_map_steps_items[] =
+{
+    { "[TODO]", "Create lookup and range-scan benchmarks against d_sorted_array" },
+    { "[TODO]", "Add descending cursors" },
+    { "[TODO]", "Test node sizes other than the default D_BTREE_MAP_NODE_SIZE" }
+};
+
+static const struct d_test_sa_note_item g_btree_map_guidelines_items[] =
+{
+    { "[BEST]", "Use new_keyed for integer keys" },
+    { "[BEST]", "Load sorted data with bulk_load instead of repeated puts" },
+    { "[BEST]", "Read ranges through a cursor rather than repeated gets" }
+};
+
+static const struct d_test_sa_note_section g_btree_map_notes[] =
+{
+    { "CURRENT STATUS",
+      sizeof(g_btree_map_status_items) / sizeof(g_btree_map_status_items[0]),
+      g_btree_map_status_items },
+    { "KNOWN ISSUES",
+      sizeof(g_btree_map_issues_items) / sizeof(g_btree_map_issues_items[0]),
+      g_btree_map_issues_items },
+    { "NEXT STEPS",
+      sizeof(g_btree_map_steps_items) / sizeof(g_btree_map_steps_items[0]),
+      g_btree_map_steps_items },
+    { "BEST PRACTICES",
+      sizeof(g_btree_map_guidelines_items) / sizeof(g_btree_map_guidelines_items[0]),
+      g_btree_map_guidelines_items }
+};
+
+
+/******************************************************************************
+ * MAIN ENTRY POINT
+ *****************************************************************************/
+
+int
+main
+(
+    int    _argc,
+    char** _argv
+)
+{
+    struct d_test_sa_runner runner;
+
+    /* Suppress unused parameter warnings */
+    (void)_argc;
+    (void)_argv;
+
+    /* Initialize the test runner */
+    d_test_sa_runner_init(&runner,
+                          "djinterp btree_map Module",
+                          "Comprehensive Testing of d_btree_map Ordered Map "
+                          "Functions and Range Queries");
+
+    /* Register the btree_map module */
+    d_test_sa_runner_add_module_counter(&runner,
+                                        "btree_map",
+                                        "d_btree_map functions for "
+                                        "construction, put/get, removal, bulk "
+                                        "loading, range cursors, iterators, "
+                                        "and comparator ordering",
+                                        d_tests_sa_btree_map_run_all,
+                                        (sizeof(g_btree_map_notes) /
+                                            sizeof(g_btree_map_notes[0])),
+                                        g_btree_map_notes);
+
+    /* Execute all tests and return result */
+    return d_test_sa_runner_execute(&runner);
+}
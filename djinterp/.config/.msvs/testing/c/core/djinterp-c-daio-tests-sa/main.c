@@ -0,0 +1,111 @@
+/******************************************************************************
+* djinterp [test]                                                       main.c
+*
+*   Test runner for daio module standalone tests.
+*   Tests the asynchronous file I/O engine: engine lifetime, request
+* validation, open/close, write/read round trips, fsync, batched submission,
+* error completions, and delivery through an attached event handler.
+*
+*
+* path:      \.config\.msvs\testing\core\djinterp-c-daio-tests-sa\main.c
+* author(s): Samuel 'teer' Neal-Blim
+******************************************************************************/
+#include "..\..\..\..\..\..\inc\c\test\test_standalone.h"
+#include "..\..\..\..\..\..\tests\c\daio_tests_sa.h"
+
+
+/******************************************************************************
+ * IMPLEMENTATION NOTES
+ *****************************************************************************/
+
+static const struct d_test_sa_note_item g_daio_status_items[] =
+{
+    { "[INFO]", "Engine creation and teardown validated" },
+    { "[INFO]", "Read, write, fsync, open and close complete with the "
+                "expected results" },
+    { "[INFO]", "Batched submissions complete once each" },
+    { "[INFO]", "Failed requests report their errno in the request's "
+                "error field" },
+    { "[INFO]", "Completions without a callback reach an attached "
+                "d_event_handler queue" }
+};
+
+static const struct d_test_sa_note_item g_daio_issues_items[] =
+{
+    { "[WARN]", "io_uring may be unavailable (old kernel, seccomp); the "
+                "suite then exercises the thread-pool backend" },
+    { "[NOTE]", "Tests create and remove a scratch file in the working "
+                "directory" }
+};
+
+static const struct d_test_sa_note_item g_daio_steps_items[] =
+{
+    { "[TODO]", "Run the suite once per backend on Linux" },
+    { "[TODO]", "Add tests for submission queue overflow" },
+    { "[TODO]", "Add tests for cancellation of in-flight requests" }
+};
+
+static const struct d_test_sa_note_item g_daio_guidelines_items[] =
+{
+    { "[BEST]", "Keep request structs alive until their completion is "
+                "delivered" },
+    { "[BEST]", "Drain completions with d_aio_wait before freeing the "
+                "engine" },
+    { "[BEST]", "Submit related requests together to share one system "
+                "call" }
+};
+
+static const struct d_test_sa_note_section g_daio_notes[] =
+{
+    { "CURRENT STATUS",
+      sizeof(g_daio_status_items) / sizeof(g_daio_status_items[0]),
+      g_daio_status_items },
+    { "KNOWN ISSUES",
+      sizeof(g_daio_issues_items) / sizeof(g_daio_issues_items[0]),
+      g_daio_issues_items },
+    { "NEXT STEPS",
+      sizeof(g_daio_steps_items) / sizeof(g_daio_steps_items[0]),
+      g_daio_steps_items },
+    { "BEST PRACTICES",
+      sizeof(g_daio_guidelines_items) / sizeof(g_daio_guidelines_items[0]),
+      g_daio_guidelines_items }
+};
+
+
+/******************************************************************************
+ * MAIN ENTRY POINT
+ *****************************************************************************/
+
+int
+main
+(
+    int    _argc,
+    char** _argv
+)
+{
+    struct d_test_sa_runner runner;
+
+    // suppress unused parameter warnings
+    (void)_argc;
+    (void)_argv;
+
+    // initialize the test runner
+    d_test_sa_runner_init(&runner,
+                          "djinterp daio Module",
+                          "Comprehensive Testing of Asynchronous File I/O");
+
+    // register the daio module
+    d_test_sa_runner_add_module_counter(&runner,
+                                        "daio",
+                                        "Engine lifetime, request validation, "
+                                        "open/close, write/read, fsync, "
+                                        "batches, errors, and event handler "
+                                        "delivery",
+                                        d_tests_sa_daio_run_all,
+                                        sizeof(g_daio_notes) /
+                                            sizeof(g_daio_notes[0]),
+                                        g_daio_notes);
+
+    // execute all tests and return result
+    return d_test_sa_runner_execute(&runner);
+}
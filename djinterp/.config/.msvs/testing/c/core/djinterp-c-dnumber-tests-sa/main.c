@@ -0,0 +1,110 @@
+/******************************************************************************
+* djinterp [test]                                                       main.c
+*
+*   Test runner for dnumber module standalone tests.
+*   Tests the locale-independent number formatters and parsers: integer and
+* hexadecimal formatting, shortest round-trip double formatting, span-based
+* integer and double parsing, range errors, and correct rounding.
+*
+*
+* path:      \.config\.msvs\testing\core\djinterp-c-dnumber-tests-sa\main.c
+* author(s): Samuel 'teer' Neal-Blim
+******************************************************************************/
+#include "..\..\..\..\..\..\inc\c\test\test_standalone.h"
+#include "..\..\..\..\..\..\tests\c\dnumber_tests_sa.h"
+
+
+/******************************************************************************
+ * IMPLEMENTATION NOTES
+ *****************************************************************************/
+
+static const struct d_test_sa_note_item g_dnumber_status_items[] =
+{
+    { "[INFO]", "Integer and hex formatting validated at type "
+                "boundaries" },
+    { "[INFO]", "d_fmt_double writes the shortest text that reads back "
+                "exactly" },
+    { "[INFO]", "Integer parsers report consumed length and range "
+                "errors" },
+    { "[INFO]", "Double parsing rounds hard cases correctly" },
+    { "[INFO]", "Parsers read back everything the formatters write" }
+};
+
+static const struct d_test_sa_note_item g_dnumber_issues_items[] =
+{
+    { "[NOTE]", "Output never depends on the current C locale" },
+    { "[NOTE]", "Round-trip checks compare against strtod, so they "
+                "assume a correctly rounding C library" }
+};
+
+static const struct d_test_sa_note_item g_dnumber_steps_items[] =
+{
+    { "[TODO]", "Add randomized round-trip tests over all exponents" },
+    { "[TODO]", "Add float (32-bit) formatting and parsing" }
+};
+
+static const struct d_test_sa_note_item g_dnumber_guidelines_items[] =
+{
+    { "[BEST]", "Size output buffers with the D_FMT_*_BUFFER_SIZE "
+                "constants" },
+    { "[BEST]", "Use the d_fmt_* functions instead of snprintf for "
+                "machine-readable output" },
+    { "[BEST]", "Check the consumed length when parsing from a larger "
+                "span" }
+};
+
+static const struct d_test_sa_note_section g_dnumber_notes[] =
+{
+    { "CURRENT STATUS",
+      sizeof(g_dnumber_status_items) / sizeof(g_dnumber_status_items[0]),
+      g_dnumber_status_items },
+    { "KNOWN ISSUES",
+      sizeof(g_dnumber_issues_items) / sizeof(g_dnumber_issues_items[0]),
+      g_dnumber_issues_items },
+    { "NEXT STEPS",
+      sizeof(g_dnumber_steps_items) / sizeof(g_dnumber_steps_items[0]),
+      g_dnumber_steps_items },
+    { "BEST PRACTICES",
+      sizeof(g_dnumber_guidelines_items) /
+          sizeof(g_dnumber_guidelines_items[0]),
+      g_dnumber_guidelines_items }
+};
+
+
+/******************************************************************************
+ * MAIN ENTRY POINT
+ *****************************************************************************/
+
+int
+main
+(
+    int    _argc,
+    char** _argv
+)
+{
+    struct d_test_sa_runner runner;
+
+    // suppress unused parameter warnings
+    (void)_argc;
+    (void)_argv;
+
+    // initialize the test runner
+    d_test_sa_runner_init(&runner,
+                          "djinterp dnumber Module",
+                          "Comprehensive Testing of Locale-Independent "
+                          "Number Formatting and Parsing");
+
+    // register the dnumber module
+    d_test_sa_runner_add_module_counter(&runner,
+                                        "dnumber",
+                                        "Integer, hex and double formatting; "
+                                        "integer and double parsing; range "
+                                        "errors and rounding",
+                                        d_tests_sa_dnumber_run_all,
+                                        sizeof(g_dnumber_notes) /
+                                            sizeof(g_dnumber_notes[0]),
+                                        g_dnumber_notes);
+
+    // execute all tests and return result
+    return d_test_sa_runner_execute(&runner);
+}
@@ -0,0 +1,115 @@
+/******************************************************************************
+* djinterp [test]                                                       main.c
+*
+*   Test runner for dstatcache module standalone tests.
+*   Tests the cached file metadata queries: uncached passthrough, cache hits,
+* negative entries, normalized path aliases, the existence and type
+* predicates, explicit and generation invalidation, TTL expiry, the entry
+* limit, inotify watching, and batched stat and lstat lookups.
+*
+*
+* path:      \.config\.msvs\testing\core\djinterp-c-dstatcache-tests-sa\main.c
+* author(s): Samuel 'teer' Neal-Blim
+******************************************************************************/
+#include "..\..\..\..\..\..\inc\c\test\test_standalone.h"
+#include "..\..\..\..\..\..\tests\c\dstatcache_tests_sa.h"
+
+
+/******************************************************************************
+ * IMPLEMENTATION NOTES
+ *****************************************************************************/
+
+static const struct d_test_sa_note_item g_dstatcache_status_items[] =
+{
+    { "[INFO]", "A NULL cache behaves exactly like the uncached dfile.h "
+                "calls" },
+    { "[INFO]", "Repeated and aliased paths are answered from one cached "
+                "entry" },
+    { "[INFO]", "Missing paths are cached as negative entries" },
+    { "[INFO]", "Invalidation by path, generation, TTL and watch "
+                "validated" },
+    { "[INFO]", "Batched lookups match their one-at-a-time results" }
+};
+
+static const struct d_test_sa_note_item g_dstatcache_issues_items[] =
+{
+    { "[NOTE]", "Watch tests only check invalidation where the kernel "
+                "grants an inotify instance" },
+    { "[NOTE]", "Relative paths are cached as given; invalidate after "
+                "changing the working directory" }
+};
+
+static const struct d_test_sa_note_item g_dstatcache_steps_items[] =
+{
+    { "[TODO]", "Add watching on platforms other than Linux" },
+    { "[TODO]", "Add a concurrent query and invalidation stress test" }
+};
+
+static const struct d_test_sa_note_item g_dstatcache_guidelines_items[] =
+{
+    { "[BEST]", "Use d_stat_cache_stat_batch when many paths share "
+                "directories" },
+    { "[BEST]", "Call d_stat_cache_invalidate_all after a bulk change to "
+                "the tree" },
+    { "[BEST]", "Pick a TTL when no watch is available and files may "
+                "change" }
+};
+
+static const struct d_test_sa_note_section g_dstatcache_notes[] =
+{
+    { "CURRENT STATUS",
+      sizeof(g_dstatcache_status_items) /
+          sizeof(g_dstatcache_status_items[0]),
+      g_dstatcache_status_items },
+    { "KNOWN ISSUES",
+      sizeof(g_dstatcache_issues_items) /
+          sizeof(g_dstatcache_issues_items[0]),
+      g_dstatcache_issues_items },
+    { "NEXT STEPS",
+      sizeof(g_dstatcache_steps_items) /
+          sizeof(g_dstatcache_steps_items[0]),
+      g_dstatcache_steps_items },
+    { "BEST PRACTICES",
+      sizeof(g_dstatcache_guidelines_items) /
+          sizeof(g_dstatcache_guidelines_items[0]),
+      g_dstatcache_guidelines_items }
+};
+
+
+/******************************************************************************
+ * MAIN ENTRY POINT
+ *****************************************************************************/
+
+int
+main
+(
+    int    _argc,
+    char** _argv
+)
+{
+    struct d_test_sa_runner runner;
+
+    // suppress unused parameter warnings
+    (void)_argc;
+    (void)_argv;
+
+    // initialize the test runner
+    d_test_sa_runner_init(&runner,
+                          "djinterp dstatcache Module",
+                          "Comprehensive Testing of Cached File Metadata "
+                          "Queries");
+
+    // register the dstatcache module
+    d_test_sa_runner_add_module_counter(&runner,
+                                        "dstatcache",
+                                        "Cached stat queries, negative "
+                                        "entries, invalidation, watching and "
+                                        "batched lookups",
+                                        d_tests_sa_dstatcache_run_all,
+                                        sizeof(g_dstatcache_notes) /
+                                            sizeof(g_dstatcache_notes[0]),
+                                        g_dstatcache_notes);
+
+    // execute all tests and return result
+    return d_test_sa_runner_execute(&runner);
+}
@@ -0,0 +1,109 @@
+/******************************************************************************
+* djinterp [test]                                                       main.c
+*
+*   Test runner for dwalk module standalone tests.
+*   Tests the parallel recursive directory walker: glob pattern matching,
+* visitor and collecting walks, multi-threaded walks, include/exclude filters,
+* depth limits, visitor control codes, and error reporting.
+*
+*
+* path:      \.config\.msvs\testing\core\djinterp-c-dwalk-tests-sa\main.c
+* author(s): Samuel 'teer' Neal-Blim
+******************************************************************************/
+#include "..\..\..\..\..\..\inc\c\test\test_standalone.h"
+#include "..\..\..\..\..\..\tests\c\dwalk_tests_sa.h"
+
+
+/******************************************************************************
+ * IMPLEMENTATION NOTES
+ *****************************************************************************/
+
+static const struct d_test_sa_note_item g_dwalk_status_items[] =
+{
+    { "[INFO]", "d_dir_walk_glob_match handles literals, *, ?, ** and "
+                "character classes" },
+    { "[INFO]", "Visitor and collecting walks report every entry once" },
+    { "[INFO]", "Parallel walks match the single-threaded result" },
+    { "[INFO]", "Include/exclude filters and depth limits prune the walk" },
+    { "[INFO]", "Visitor return codes skip subtrees and stop the walk" }
+};
+
+static const struct d_test_sa_note_item g_dwalk_issues_items[] =
+{
+    { "[WARN]", "Entry order is not defined for parallel walks; tests "
+                "compare sorted results (D_DIR_WALK_SORT)" },
+    { "[NOTE]", "Tests build and remove a scratch tree in the working "
+                "directory" }
+};
+
+static const struct d_test_sa_note_item g_dwalk_steps_items[] =
+{
+    { "[TODO]", "Add tests for symlinked directories (reported, not "
+                "descended into)" },
+    { "[TODO]", "Add tests for filesystems that report DT_UNKNOWN" },
+    { "[TODO]", "Add a large-tree benchmark for worker scaling" }
+};
+
+static const struct d_test_sa_note_item g_dwalk_guidelines_items[] =
+{
+    { "[BEST]", "Make visitors thread-safe when walking with more than "
+                "one thread" },
+    { "[BEST]", "Use exclude patterns to prune large subtrees early" },
+    { "[BEST]", "Free collected results with d_dir_walk_result_free" }
+};
+
+static const struct d_test_sa_note_section g_dwalk_notes[] =
+{
+    { "CURRENT STATUS",
+      sizeof(g_dwalk_status_items) / sizeof(g_dwalk_status_items[0]),
+      g_dwalk_status_items },
+    { "KNOWN ISSUES",
+      sizeof(g_dwalk_issues_items) / sizeof(g_dwalk_issues_items[0]),
+      g_dwalk_issues_items },
+    { "NEXT STEPS",
+      sizeof(g_dwalk_steps_items) / sizeof(g_dwalk_steps_items[0]),
+      g_dwalk_steps_items },
+    { "BEST PRACTICES",
+      sizeof(g_dwalk_guidelines_items) / sizeof(g_dwalk_guidelines_items[0]),
+      g_dwalk_guidelines_items }
+};
+
+
+/******************************************************************************
+ * MAIN ENTRY POINT
+ *****************************************************************************/
+
+int
+main
+(
+    int    _argc,
+    char** _argv
+)
+{
+    struct d_test_sa_runner runner;
+
+    // suppress unused parameter warnings
+    (void)_argc;
+    (void)_argv;
+
+    // initialize the test runner
+    d_test_sa_runner_init(&runner,
+                          "djinterp dwalk Module",
+                          "Comprehensive Testing of the Parallel Directory "
+                          "Walker");
+
+    // register the dwalk module
+    d_test_sa_runner_add_module_counter(&runner,
+                                        "dwalk",
+                                        "Glob matching, visitor and collecting "
+                                        "walks, parallel walks, filters, "
+                                        "depth limits, visitor control, and "
+                                        "errors",
+                                        d_tests_sa_dwalk_run_all,
+                                        sizeof(g_dwalk_notes) /
+                                            sizeof(g_dwalk_notes[0]),
+                                        g_dwalk_notes);
+
+    // execute all tests and return result
+    return d_test_sa_runner_execute(&runner);
+}
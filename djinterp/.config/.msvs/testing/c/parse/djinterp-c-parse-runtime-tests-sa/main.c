@@ -0,0 +1,107 @@
+/******************************************************************************
+* djinterp [test]                                                       main.c
+*
+*   Test runner for `parse_runtime.h` module standalone tests.
+*   Tests the shared packed parse forest built by the Earley runtime parser
+* and the lazy enumeration of its trees.
+*
+*
+* path:      /.config/.msvs/testing/c/parse/
+*                djinterp-c-parse-runtime-tests-sa/main.c
+* author(s): Samuel 'teer' Neal-Blim
+******************************************************************************/
+#include "../../../../../../inc/c/test/test_standalone.h"
+#include "../../../../../../tests/parse/parse_runtime_tests_sa.h"
+
+
+/******************************************************************************
+ * IMPLEMENTATION NOTES
+ *****************************************************************************/
+
+static const struct d_test_sa_note_item g_parse_runtime_status_items[] =
+{
+    { "[INFO]", "Forest tree counts match the Catalan numbers for E -> E + E" },
+    { "[INFO]", "Cyclic grammars enumerate only complete, finite trees" },
+    { "[INFO]", "Forest and tree construction are iterative and handle deep "
+                "inputs" }
+};
+
+static const struct d_test_sa_note_item g_parse_runtime_issues_items[] =
+{
+    { "[NOTE]", "The iterator keeps one choice per forest node, so a cyclic "
+                "grammar yields only trees that never repeat a node" },
+    { "[NOTE]", "Trees deriving two occurrences of one empty-span node "
+                "differently are not enumerated" },
+    { "[NOTE]", "Materialized trees are destroyed recursively" },
+    { "[WARN]", "The forest references the runtime's token buffer" }
+};
+
+static const struct d_test_sa_note_item g_parse_runtime_steps_items[] =
+{
+    { "[TODO]", "Add tests for the legacy d_parse_runtime_parse tree list" },
+    { "[TODO]", "Add tests for epsilon productions in the forest" },
+    { "[TODO]", "Add lexer configuration and indentation tests" }
+};
+
+static const struct d_test_sa_note_item g_parse_runtime_guidelines_items[] =
+{
+    { "[BEST]", "Prefer the forest over the tree list for ambiguous grammars" },
+    { "[BEST]", "Walk the current tree with d_parse_forest_iter_choice "
+                "instead of materializing it" },
+    { "[BEST]", "Destroy the forest before the next parse on the runtime" }
+};
+
+static const struct d_test_sa_note_section g_parse_runtime_notes[] =
+{
+    { "CURRENT STATUS",
+      sizeof(g_parse_runtime_status_items) / sizeof(g_parse_runtime_status_items[0]),
+      g_parse_runtime_status_items },
+    { "KNOWN ISSUES",
+      sizeof(g_parse_runtime_issues_items) / sizeof(g_parse_runtime_issues_items[0]),
+      g_parse_runtime_issues_items },
+    { "NEXT STEPS",
+      sizeof(g_parse_runtime_steps_items) / sizeof(g_parse_runtime_steps_items[0]),
+      g_parse_runtime_steps_items },
+    { "BEST PRACTICES",
+      sizeof(g_parse_runtime_guidelines_items) / sizeof(g_parse_runtime_guidelines_items[0]),
+      g_parse_runtime_guidelines_items }
+};
+
+
+/******************************************************************************
+ * MAIN ENTRY POINT
+ *****************************************************************************/
+
+int
+main
+(
+    int    _argc,
+    char** _argv
+)
+{
+    struct d_test_sa_runner runner;
+
+    // suppress unused parameter warnings
+    (void)_argc;
+    (void)_argv;
+
+    // initialize the test runner
+    d_test_sa_runner_init(&runner,
+                          "djinterp parse_runtime Module",
+                          "Comprehensive Testing of the Runtime Parser's "
+                          "Shared Packed Parse Forest");
+
+    // register the parse_runtime module
+    d_test_sa_runner_add_module_counter(&runner,
+                                        "parse_runtime",
+                                        "Parse forest construction, tree "
+                                        "counts, cyclic grammars and deep "
+                                        "inputs",
+                                        d_tests_sa_parse_runtime_run_all,
+                                        (sizeof(g_parse_runtime_notes) /
+                                            sizeof(g_parse_runtime_notes[0])),
+                                        g_parse_runtime_notes);
+
+    // execute all tests and return result
+    return d_test_sa_runner_execute(&runner);
+}
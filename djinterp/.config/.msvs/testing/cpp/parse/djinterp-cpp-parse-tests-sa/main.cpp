@@ -0,0 +1,110 @@
+/******************************************************************************
+* djinterp [test]                                                     main.cpp
+*
+*   Test runner for `parse.h` module standalone tests.
+*   Tests the bulk character scans of the parser combinators: the d_char_set
+* lookup table (and its AVX2 kernel), source scans at the end of input, and
+* the bulk path of many(satisfy(p)); and packrat memoization.
+*
+*
+* path:      /.config/.msvs/testing/cpp/parse/
+*                djinterp-cpp-parse-tests-sa/main.cpp
+* author(s): Samuel 'teer' Neal-Blim
+******************************************************************************/
+#include "../../../../../../inc/c/test/test_standalone.h"
+#include "../../../../../../tests/parse/parse_tests_sa.h"
+
+
+/******************************************************************************
+ * IMPLEMENTATION NOTES
+ *****************************************************************************/
+
+static const struct d_test_sa_note_item g_parse_status_items[] =
+{
+    { "[INFO]", "d_char_set span()/find() match a per-byte scan for every "
+                "byte value" },
+    { "[INFO]", "Scans stop at the end of input on every source type" },
+    { "[INFO]", "many(satisfy(p)) gives the same result on the bulk and "
+                "element-by-element paths" },
+    { "[INFO]", "Memoization keeps a backtracking grammar linear in the input "
+                "length" }
+};
+
+static const struct d_test_sa_note_item g_parse_issues_items[] =
+{
+    { "[NOTE]", "The AVX2 kernel is only exercised when built with AVX2 "
+                "enabled; the section header names the kernel in use" },
+    { "[NOTE]", "Entries more than a window behind the furthest offset are "
+                "recomputed, so a small window can bring back exponential "
+                "work" },
+    { "[WARN]", "Timings are informational and vary by machine" }
+};
+
+static const struct d_test_sa_note_item g_parse_steps_items[] =
+{
+    { "[TODO]", "Add tests for the literal, any and eof parsers" },
+    { "[TODO]", "Add tests for source location tracking across lines" }
+};
+
+static const struct d_test_sa_note_item g_parse_guidelines_items[] =
+{
+    { "[BEST]", "Pass predicates that expose char_set() so scans run in bulk" },
+    { "[BEST]", "Prefer take_while over many when a slice of the input will "
+                "do" },
+    { "[BEST]", "Call reset() on the memo context before parsing a new input" }
+};
+
+static const struct d_test_sa_note_section g_parse_notes[] =
+{
+    { "CURRENT STATUS",
+      sizeof(g_parse_status_items) / sizeof(g_parse_status_items[0]),
+      g_parse_status_items },
+    { "KNOWN ISSUES",
+      sizeof(g_parse_issues_items) / sizeof(g_parse_issues_items[0]),
+      g_parse_issues_items },
+    { "NEXT STEPS",
+      sizeof(g_parse_steps_items) / sizeof(g_parse_steps_items[0]),
+      g_parse_steps_items },
+    { "BEST PRACTICES",
+      sizeof(g_parse_guidelines_items) / sizeof(g_parse_guidelines_items[0]),
+      g_parse_guidelines_items }
+};
+
+
+/******************************************************************************
+ * MAIN ENTRY POINT
+ *****************************************************************************/
+
+int
+main
+(
+    int    _argc,
+    char** _argv
+)
+{
+    struct d_test_sa_runner runner;
+
+    // suppress unused parameter warnings
+    (void)_argc;
+    (void)_argv;
+
+    // initialize the test runner
+    d_test_sa_runner_init(&runner,
+                          "djinterp parse Module",
+                          "Comprehensive Testing of the Parser Combinators' "
+                          "Bulk Character Scans and Memoization");
+
+    // register the parse module
+    d_test_sa_runner_add_module_counter(&runner,
+                                        "parse",
+                                        "Character set scans, source scans, "
+                                        "repetition, memoization and scan "
+                                        "performance",
+                                        d_tests_sa_parse_run_all,
+                                        (sizeof(g_parse_notes) /
+                                            sizeof(g_parse_notes[0])),
+                                        g_parse_notes);
+
+    // execute all tests and return result
+    return d_test_sa_runner_execute(&runner);
+}
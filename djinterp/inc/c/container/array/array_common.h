@@ -19,6 +19,7 @@
 #include "../../djinterp.h"
 #include "../../dmemory.h"
 #include "../container.h"
+#include "./array_sort.h"
 
 
 #ifndef D_ARRAY_DEFAULT_CAPACITY
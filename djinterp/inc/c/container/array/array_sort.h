@@ -0,0 +1,111 @@
+/******************************************************************************
+* djinterp [container]                                            array_sort.h
+*
+*   Sorting routines for contiguous arrays.
+*   d_array_sort is an introsort over opaque elements: median-of-three
+* quicksort that falls back to heapsort when recursion gets too deep and to
+* insertion sort for short ranges. It swaps whole machine words rather than
+* single bytes and never allocates.
+*   For element types known at compile time, typed variants are generated
+* from D_ARRAY_SORT_TYPES with D_FOR_EACH (one set per type `T` with suffix
+* `S`):
+*   d_array_sort_S(T*, count)        introsort with inline `<`, no callback
+*   d_array_radix_sort_S(T*, count)  LSD radix sort, 8 bits per pass
+*   d_array_sort_keyed_S(...)        stable LSD radix sort of records by a
+*                                    key of type T at a byte offset
+*   Floating-point keys are ordered by IEEE-754 total order in both the
+* comparison and radix sorts: -NaN < -inf < ... < -0.0 < +0.0 < ... < +inf
+* < +NaN.
+*
+*
+* path:      \inc\container\array\array_sort.h
+* link(s):   TBA
+* author(s): Samuel 'teer' Neal-Blim                          date: 2026.10.18
+******************************************************************************/
+
+#ifndef DJINTERP_C_CONTAINER_ARRAY_SORT_
+#define DJINTERP_C_CONTAINER_ARRAY_SORT_ 1
+
+#include <limits.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../../djinterp.h"
+#include "../../dmacro.h"
+#include "../container.h"
+
+
+#ifndef D_ARRAY_SORT_INSERTION_THRESHOLD
+    // D_ARRAY_SORT_INSERTION_THRESHOLD
+    //   constant: ranges of at most this many elements are finished with
+    // insertion sort.
+    #define D_ARRAY_SORT_INSERTION_THRESHOLD 24
+#endif  // D_ARRAY_SORT_INSERTION_THRESHOLD
+
+#ifndef D_ARRAY_SORT_RADIX_THRESHOLD
+    // D_ARRAY_SORT_RADIX_THRESHOLD
+    //   constant: below this many elements the radix sorts hand over to the
+    // comparison sort, whose constant factor wins on small inputs.
+    #define D_ARRAY_SORT_RADIX_THRESHOLD 256
+#endif  // D_ARRAY_SORT_RADIX_THRESHOLD
+
+// D_ARRAY_SORT_TYPES
+//   macro: (suffix, type, unsigned bits type, key kind) tuples for which
+// typed sorts are generated. The key kind selects how a value maps onto an
+// unsigned integer with the same order: SIGNED flips the sign bit, UNSIGNED
+// is the identity, FLOAT flips the sign bit of positives and every bit of
+// negatives.
+#define D_ARRAY_SORT_TYPES                                                    \
+    (int32,  int32_t,  uint32_t, SIGNED),                                     \
+    (uint32, uint32_t, uint32_t, UNSIGNED),                                   \
+    (int64,  int64_t,  uint64_t, SIGNED),                                     \
+    (uint64, uint64_t, uint64_t, UNSIGNED),                                   \
+    (float,  float,    uint32_t, FLOAT),                                      \
+    (double, double,   uint64_t, FLOAT)
+
+
+// d_array_sort_key
+//   enum: runtime selector for the key type of d_array_sort_keyed; one value
+// per entry of D_ARRAY_SORT_TYPES.
+enum d_array_sort_key
+{
+    D_ARRAY_SORT_KEY_INT32 = 0,
+    D_ARRAY_SORT_KEY_UINT32,
+    D_ARRAY_SORT_KEY_INT64,
+    D_ARRAY_SORT_KEY_UINT64,
+    D_ARRAY_SORT_KEY_FLOAT,
+    D_ARRAY_SORT_KEY_DOUBLE
+};
+
+
+// D_INTERNAL_ARRAY_SORT_DECLARE_TYPED
+//   macro (internal): declares the typed sorts for one D_ARRAY_SORT_TYPES
+// tuple.
+#define D_INTERNAL_ARRAY_SORT_DECLARE_TYPED(_suffix, _type, _bits, _kind)     \
+    void d_array_sort_##_suffix(_type* _elements, size_t _count);             \
+    void d_array_radix_sort_##_suffix(_type* _elements, size_t _count);       \
+    bool d_array_sort_keyed_##_suffix(void* _elements, size_t _count, size_t _element_size, size_t _key_offset);
+
+// D_INTERNAL_ARRAY_SORT_DECLARE
+//   macro (internal): unpacks a parenthesized tuple for D_FOR_EACH.
+#define D_INTERNAL_ARRAY_SORT_DECLARE(_tuple)                                 \
+    D_INTERNAL_ARRAY_SORT_DECLARE_TYPED _tuple
+
+
+// =============================================================================
+// comparator sort
+// =============================================================================
+void d_array_sort(void* _elements, size_t _count, size_t _element_size, fn_comparator _comparator);
+
+// =============================================================================
+// typed sorts
+// =============================================================================
+D_FOR_EACH(D_INTERNAL_ARRAY_SORT_DECLARE, D_ARRAY_SORT_TYPES)
+
+// =============================================================================
+// keyed sort dispatch
+// =============================================================================
+bool d_array_sort_keyed(void* _elements, size_t _count, size_t _element_size, enum d_array_sort_key _key, size_t _key_offset);
+
+
+#endif  // DJINTERP_C_CONTAINER_ARRAY_SORT_
@@ -0,0 +1,79 @@
+/******************************************************************************
+* djinterp [container]                                   array_sort_parallel.h
+*
+*   Merge-based and multithreaded array sorts.
+*   d_array_sort_stable is a sequential bottom-up merge sort: short runs are
+* finished with insertion sort, then merged pairwise through one scratch
+* buffer. Equal elements keep their original order.
+*   d_array_sort_parallel splits the array into one chunk per worker, sorts
+* the chunks concurrently (introsort when unstable, merge sort when stable)
+* and then merges them in log2(workers) rounds. Every round is divided by
+* output position rather than by run, so all workers stay busy even when
+* only one pair of runs is left: each worker finds where its output slice
+* begins in both inputs with a binary search ("merge path") and merges just
+* that slice.
+*   d_array_merge_runs_parallel exposes the merge rounds on their own for
+* data that already consists of sorted runs (e.g. several sorted vectors
+* laid end to end).
+*   Workers are threads from dmutex.h started for the duration of a call;
+* the calling thread acts as worker 0 and the others wait on a barrier
+* between rounds. Inputs below D_ARRAY_SORT_PARALLEL_THRESHOLD are sorted
+* on the calling thread without starting any.
+*
+*
+* path:      \inc\container\array\array_sort_parallel.h
+* link(s):   TBA
+* author(s): Samuel 'teer' Neal-Blim                          date: 2026.10.18
+******************************************************************************/
+
+#ifndef DJINTERP_C_CONTAINER_ARRAY_SORT_PARALLEL_
+#define DJINTERP_C_CONTAINER_ARRAY_SORT_PARALLEL_ 1
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../../djinterp.h"
+#include "../../dmutex.h"
+#include "../container.h"
+#include "./array_sort.h"
+
+
+#ifndef D_ARRAY_SORT_PARALLEL_THRESHOLD
+    // D_ARRAY_SORT_PARALLEL_THRESHOLD
+    //   constant: arrays with fewer elements than this are sorted on the
+    // calling thread; starting threads costs more than it saves.
+    #define D_ARRAY_SORT_PARALLEL_THRESHOLD 65536
+#endif  // D_ARRAY_SORT_PARALLEL_THRESHOLD
+
+#ifndef D_ARRAY_SORT_PARALLEL_GRAIN
+    // D_ARRAY_SORT_PARALLEL_GRAIN
+    //   constant: minimum number of elements given to each worker. The
+    // worker count is reduced until every worker has at least this many.
+    #define D_ARRAY_SORT_PARALLEL_GRAIN 16384
+#endif  // D_ARRAY_SORT_PARALLEL_GRAIN
+
+
+// d_array_sort_mode
+//   enum: whether a sort must preserve the relative order of equal
+// elements. UNSTABLE sorts in place without scratch memory when run
+// sequentially; STABLE always needs a scratch buffer of the array's size.
+enum d_array_sort_mode
+{
+    D_ARRAY_SORT_UNSTABLE = 0,
+    D_ARRAY_SORT_STABLE
+};
+
+
+// =============================================================================
+// sequential merge sort
+// =============================================================================
+bool d_array_sort_stable(void* _elements, size_t _count, size_t _element_size, fn_comparator _comparator);
+
+// =============================================================================
+// parallel sort
+// =============================================================================
+bool d_array_sort_parallel(void* _elements, size_t _count, size_t _element_size, fn_comparator _comparator, enum d_array_sort_mode _mode, size_t _threads);
+bool d_array_merge_runs_parallel(void* _elements, size_t _element_size, const size_t* _run_ends, size_t _run_count, fn_comparator _comparator, size_t _threads);
+
+
+#endif  // DJINTERP_C_CONTAINER_ARRAY_SORT_PARALLEL_
@@ -6,6 +6,10 @@
 * FIFO operations with O(1) push and pop at both ends.
 *   This structure is ideal for streaming data, queues, and bounded buffers
 * where the capacity is known ahead of time.
+*   Physical indices are never computed with a division: a power-of-two
+* capacity (see d_circular_array_new_pow2) wraps with a mask, any other
+* capacity with one conditional subtraction. Bulk pushes and pops copy the
+* wrapped range in at most two memcpy segments.
 *
 *
 * path:      \inc\container\array\circular_array.h
@@ -18,6 +22,7 @@
 
 #include <stdarg.h>
 #include <stdlib.h>
+#include <string.h>
 #include "../../djinterp.h"
 #include "../../dmemory.h"
 #include "../../container/container.h"
@@ -40,20 +45,29 @@
 #endif  // D_CIRCULAR_ARRAY_COUNT_T
 
 
+// D_CIRCULAR_ARRAY_MASK
+//   macro: index mask for a capacity; `capacity - 1` when the capacity is a
+// power of two, otherwise 0 (no mask, wrap by subtraction).
+#define D_CIRCULAR_ARRAY_MASK(capacity)                                       \
+    ( ( ((capacity) > 0) && (((capacity) & ((capacity) - 1)) == 0) )          \
+          ? (size_t)(capacity) - 1                                            \
+          : (size_t)0 )
+
 // D_CIRCULAR_ARRAY_INIT
 //   macro: macro-based initializer; assigns a `d_circular_array` with the
 // elements specified.
 // Example:
 //   struct d_circular_array arr = D_CIRCULAR_ARRAY_INIT(int, 8, 1, 2, 3, 4, 5);
 // Note: first parameter after type is capacity
-#define D_CIRCULAR_ARRAY_INIT(element_type, capacity, ...)                    \
+#define D_CIRCULAR_ARRAY_INIT(element_type, initial_capacity, ...)            \
     {                                                                         \
         .count        = D_CIRCULAR_ARRAY_COUNT_T(element_type, __VA_ARGS__),  \
         .elements     = (element_type[]){ __VA_ARGS__ },                      \
         .element_size = sizeof(element_type),                                 \
-        .capacity     = (capacity),                                           \
+        .capacity     = (initial_capacity),                                   \
         .head         = 0,                                                    \
-        .tail         = D_CIRCULAR_ARRAY_COUNT_T(element_type, __VA_ARGS__)   \
+        .tail         = D_CIRCULAR_ARRAY_COUNT_T(element_type, __VA_ARGS__),  \
+        .mask         = D_CIRCULAR_ARRAY_MASK(initial_capacity)               \
     }
 
 
@@ -68,6 +82,7 @@ struct d_circular_array
     size_t capacity;
     size_t head;
     size_t tail;
+    size_t mask;    // capacity - 1 if capacity is a power of two, else 0
 };
 
 
@@ -76,6 +91,7 @@ struct d_circular_array
 // =============================================================================
 struct d_circular_array* d_circular_array_new(size_t _capacity, size_t _element_size);
 struct d_circular_array* d_circular_array_new_default_capacity(size_t _element_size);
+struct d_circular_array* d_circular_array_new_pow2(size_t _min_capacity, size_t _element_size);
 struct d_circular_array* d_circular_array_new_from_arr(size_t _capacity, size_t _element_size, const void* _source, size_t _source_count);
 struct d_circular_array* d_circular_array_new_from_args(size_t _capacity, size_t _element_size, size_t _arg_count, ...);
 struct d_circular_array* d_circular_array_new_copy(const struct d_circular_array* _other);
@@ -106,6 +122,7 @@ void*  d_circular_array_pop_back(struct d_circular_array* _circular_array);
 bool   d_circular_array_pop_to(struct d_circular_array* _circular_array, void* _out_value);
 bool   d_circular_array_pop_front_to(struct d_circular_array* _circular_array, void* _out_value);
 bool   d_circular_array_pop_back_to(struct d_circular_array* _circular_array, void* _out_value);
+bool   d_circular_array_pop_all_to(struct d_circular_array* _circular_array, void* _out_values, size_t _count);
 
 // =============================================================================
 // modification functions - overwriting operations
@@ -158,6 +175,7 @@ void   d_circular_array_foreach_reverse(struct d_circular_array* _circular_array
 // utility functions
 // =============================================================================
 void   d_circular_array_sort(struct d_circular_array* _circular_array, fn_comparator _comparator);
+bool   d_circular_array_sort_keyed(struct d_circular_array* _circular_array, enum d_array_sort_key _key, size_t _key_offset);
 bool   d_circular_array_linearize(struct d_circular_array* _circular_array);
 
 // =============================================================================
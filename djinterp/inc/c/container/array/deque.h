@@ -0,0 +1,127 @@
+/******************************************************************************
+* djinterp [container]                                                 deque.h
+*
+*   A deque (double-ended queue) stores its elements in fixed-size blocks
+* referenced from a small array of block pointers, the block map. The used
+* blocks sit in the middle of the map, so a new block can be added at either
+* end without moving any element: pushing and popping at the front or the
+* back are O(1), and growing only ever copies block pointers (amortized O(1)
+* per block).
+*   This is the container to use instead of d_vector_push_front, which
+* shifts the whole array on every call, and instead of `d_circular_array`
+* when the number of elements is not known in advance.
+*   Element `i` lives in block (front + i) / B at offset (front + i) % B,
+* where B is the power-of-two block capacity and `front` is the offset of
+* the first element in the first block, so indexed access is a shift, a
+* mask and two loads. Ranges are copied in and out one block-sized run at a
+* time.
+*   One emptied block is kept as a spare, so a queue that hovers around a
+* block boundary does not allocate and free on every operation.
+*
+*
+* path:      \inc\container\array\deque.h
+* link(s):   TBA
+* author(s): Samuel 'teer' Neal-Blim                          date: 2026.10.18
+******************************************************************************/
+
+#ifndef DJINTERP_CONTAINER_ARRAY_DEQUE_
+#define DJINTERP_CONTAINER_ARRAY_DEQUE_ 1
+
+#include <limits.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../../djinterp.h"
+#include "../../dmemory.h"
+#include "../../container/container.h"
+
+
+#ifndef D_DEQUE_DEFAULT_BLOCK_CAPACITY
+    // D_DEQUE_DEFAULT_BLOCK_CAPACITY
+    //   constant: the default capacity, in number of elements, of each block
+    // of a new `d_deque`. Rounded up to a power of two.
+    #define D_DEQUE_DEFAULT_BLOCK_CAPACITY 64
+#endif  // D_DEQUE_DEFAULT_BLOCK_CAPACITY
+
+#ifndef D_DEQUE_MIN_MAP_CAPACITY
+    // D_DEQUE_MIN_MAP_CAPACITY
+    //   constant: the number of block pointer slots allocated for the map of
+    // a new `d_deque`.
+    #define D_DEQUE_MIN_MAP_CAPACITY 8
+#endif  // D_DEQUE_MIN_MAP_CAPACITY
+
+
+// d_deque
+//   struct: a growable double-ended queue. `map[map_begin]` through
+// `map[map_end - 1]` are the allocated blocks, in order; the first element
+// is at offset `front` of `map[map_begin]`.
+struct d_deque
+{
+    size_t count;
+    size_t element_size;
+    size_t block_shift;     // log2 of the block capacity
+    size_t front;           // offset of the first element in its block
+    size_t map_begin;       // first used slot of `map`
+    size_t map_end;         // one past the last used slot of `map`
+    size_t map_capacity;    // number of slots in `map`
+    void** map;
+    void*  spare;           // one emptied block kept for reuse, or NULL
+};
+
+
+// =============================================================================
+// constructor functions
+// =============================================================================
+struct d_deque* d_deque_new(size_t _element_size);
+struct d_deque* d_deque_new_block_capacity(size_t _block_capacity, size_t _element_size);
+struct d_deque* d_deque_new_from_arr(size_t _element_size, const void* _source, size_t _source_count);
+struct d_deque* d_deque_new_copy(const struct d_deque* _other);
+
+// =============================================================================
+// element access functions
+// =============================================================================
+void*  d_deque_get(const struct d_deque* _deque, d_index _index);
+bool   d_deque_set(struct d_deque* _deque, d_index _index, const void* _value);
+void*  d_deque_front(const struct d_deque* _deque);
+void*  d_deque_back(const struct d_deque* _deque);
+
+// =============================================================================
+// modification functions
+// =============================================================================
+bool   d_deque_push_back(struct d_deque* _deque, const void* _element);
+bool   d_deque_push_front(struct d_deque* _deque, const void* _element);
+bool   d_deque_pop_back_to(struct d_deque* _deque, void* _out_value);
+bool   d_deque_pop_front_to(struct d_deque* _deque, void* _out_value);
+bool   d_deque_append(struct d_deque* _deque, const void* _elements, size_t _count);
+bool   d_deque_prepend(struct d_deque* _deque, const void* _elements, size_t _count);
+bool   d_deque_pop_front_range_to(struct d_deque* _deque, void* _out_values, size_t _count);
+bool   d_deque_clear(struct d_deque* _deque);
+bool   d_deque_shrink_to_fit(struct d_deque* _deque);
+
+// =============================================================================
+// query functions
+// =============================================================================
+bool   d_deque_is_empty(const struct d_deque* _deque);
+size_t d_deque_count(const struct d_deque* _deque);
+size_t d_deque_element_size(const struct d_deque* _deque);
+size_t d_deque_block_capacity(const struct d_deque* _deque);
+
+// =============================================================================
+// conversion functions
+// =============================================================================
+void*  d_deque_to_linear_array(const struct d_deque* _deque);
+bool   d_deque_copy_to(const struct d_deque* _deque, size_t _start, size_t _count, void* _destination);
+
+// =============================================================================
+// iteration helpers
+// =============================================================================
+void   d_deque_foreach(struct d_deque* _deque, fn_apply _apply_fn);
+
+// =============================================================================
+// memory management
+// =============================================================================
+void   d_deque_free(struct d_deque* _deque);
+void   d_deque_free_deep(struct d_deque* _deque, fn_free _free_fn);
+
+
+#endif  // DJINTERP_CONTAINER_ARRAY_DEQUE_
@@ -0,0 +1,143 @@
+/******************************************************************************
+* djinterp [container]                                        segmented_array.h
+*
+*   A segmented array stores its elements in a sequence of separately
+* allocated blocks whose capacities grow geometrically (B, 2B, 4B, ...). A
+* small fixed block index maps a logical index to its block with one bit
+* scan, so indexed access stays O(1).
+*   Growing never moves existing elements: a pointer to an element remains
+* valid until that element is removed or the array is freed, and appending
+* costs only the allocation of the next block instead of a realloc-and-copy
+* of everything stored so far. Peak memory during growth is therefore the
+* live data plus one new block, not twice the array.
+*   Each block is a contiguous run of elements; the block accessors hand
+* them out directly so contiguous algorithms (including the contiguous filter
+* functions) can process the array one block at a time.
+*
+*
+* path:      \inc\container\array\segmented_array.h
+* link(s):   TBA
+* author(s): Samuel 'teer' Neal-Blim                          date: 2026.10.18
+******************************************************************************/
+
+#ifndef DJINTERP_CONTAINER_ARRAY_SEGMENTED_
+#define DJINTERP_CONTAINER_ARRAY_SEGMENTED_ 1
+
+#include <limits.h>
+#include <stdlib.h>
+#include "../../djinterp.h"
+#include "../../dmemory.h"
+#include "../../container/container.h"
+#include "../../core/config/container/array/array_config.h"
+
+#if D_CFG_CONTAINER_FILTER_SEGMENTED_ARRAY
+    #include "./array_filter.h"
+#endif  // D_CFG_CONTAINER_FILTER_SEGMENTED_ARRAY
+
+
+#ifndef D_SEGMENTED_ARRAY_DEFAULT_BLOCK_CAPACITY
+    // D_SEGMENTED_ARRAY_DEFAULT_BLOCK_CAPACITY
+    //   constant: the default capacity, in number of elements, of the first
+    // block of a new `d_segmented_array`. Rounded up to a power of two.
+    #define D_SEGMENTED_ARRAY_DEFAULT_BLOCK_CAPACITY 16
+#endif  // D_SEGMENTED_ARRAY_DEFAULT_BLOCK_CAPACITY
+
+// D_SEGMENTED_ARRAY_MAX_BLOCKS
+//   constant: size of the block index. Block `b` holds (first capacity << b)
+// elements, so one slot per bit of `size_t` covers every reachable index.
+#define D_SEGMENTED_ARRAY_MAX_BLOCKS (sizeof(size_t) * CHAR_BIT)
+
+
+// d_segmented_array
+//   struct: a growable array made of geometrically sized blocks. Elements
+// never move when the array grows; `blocks[b]` holds
+// (1 << (block_shift + b)) elements and is allocated on first use.
+struct d_segmented_array
+{
+    size_t count;
+    size_t element_size;
+    size_t block_shift;     // log2 of the first block's capacity
+    size_t block_count;     // number of allocated blocks
+    void*  blocks[D_SEGMENTED_ARRAY_MAX_BLOCKS];
+};
+
+
+// =============================================================================
+// constructor functions
+// =============================================================================
+struct d_segmented_array* d_segmented_array_new(size_t _element_size);
+struct d_segmented_array* d_segmented_array_new_block_capacity(size_t _block_capacity, size_t _element_size);
+struct d_segmented_array* d_segmented_array_new_from_arr(size_t _element_size, const void* _source, size_t _source_count);
+struct d_segmented_array* d_segmented_array_new_copy(const struct d_segmented_array* _other);
+
+// =============================================================================
+// element access functions
+// =============================================================================
+void*  d_segmented_array_get(const struct d_segmented_array* _segmented_array, d_index _index);
+bool   d_segmented_array_set(struct d_segmented_array* _segmented_array, d_index _index, const void* _value);
+void*  d_segmented_array_front(const struct d_segmented_array* _segmented_array);
+void*  d_segmented_array_back(const struct d_segmented_array* _segmented_array);
+
+// =============================================================================
+// modification functions
+// =============================================================================
+bool   d_segmented_array_push_back(struct d_segmented_array* _segmented_array, const void* _element);
+void*  d_segmented_array_emplace_back(struct d_segmented_array* _segmented_array);
+bool   d_segmented_array_append(struct d_segmented_array* _segmented_array, const void* _elements, size_t _count);
+bool   d_segmented_array_pop_back_to(struct d_segmented_array* _segmented_array, void* _out_value);
+bool   d_segmented_array_truncate(struct d_segmented_array* _segmented_array, size_t _count);
+bool   d_segmented_array_clear(struct d_segmented_array* _segmented_array);
+bool   d_segmented_array_reserve(struct d_segmented_array* _segmented_array, size_t _capacity);
+bool   d_segmented_array_shrink_to_fit(struct d_segmented_array* _segmented_array);
+
+// =============================================================================
+// query functions
+// =============================================================================
+bool   d_segmented_array_is_empty(const struct d_segmented_array* _segmented_array);
+size_t d_segmented_array_count(const struct d_segmented_array* _segmented_array);
+size_t d_segmented_array_capacity(const struct d_segmented_array* _segmented_array);
+size_t d_segmented_array_element_size(const struct d_segmented_array* _segmented_array);
+
+// =============================================================================
+// block access functions
+// =============================================================================
+size_t d_segmented_array_block_count(const struct d_segmented_array* _segmented_array);
+void*  d_segmented_array_block(const struct d_segmented_array* _segmented_array, size_t _block, size_t* _out_count);
+size_t d_segmented_array_block_capacity(const struct d_segmented_array* _segmented_array, size_t _block);
+
+// =============================================================================
+// search functions
+// =============================================================================
+bool    d_segmented_array_contains(const struct d_segmented_array* _segmented_array, const void* _value, fn_comparator _comparator);
+ssize_t d_segmented_array_find(const struct d_segmented_array* _segmented_array, const void* _value, fn_comparator _comparator);
+
+// =============================================================================
+// conversion functions
+// =============================================================================
+void*  d_segmented_array_to_linear_array(const struct d_segmented_array* _segmented_array);
+bool   d_segmented_array_copy_to(const struct d_segmented_array* _segmented_array, size_t _start, size_t _count, void* _destination);
+
+// =============================================================================
+// iteration helpers
+// =============================================================================
+void   d_segmented_array_foreach(struct d_segmented_array* _segmented_array, fn_apply _apply_fn);
+
+// =============================================================================
+// filter functions
+// =============================================================================
+#if D_CFG_CONTAINER_FILTER_SEGMENTED_ARRAY
+size_t d_segmented_array_count_where(const struct d_segmented_array* _segmented_array, fn_predicate _test, void* _context);
+void*  d_segmented_array_find_first(const struct d_segmented_array* _segmented_array, fn_predicate _test, void* _context);
+bool   d_segmented_array_any_match(const struct d_segmented_array* _segmented_array, fn_predicate _test, void* _context);
+bool   d_segmented_array_all_match(const struct d_segmented_array* _segmented_array, fn_predicate _test, void* _context);
+size_t d_segmented_array_filter_in_place(struct d_segmented_array* _segmented_array, fn_predicate _test, void* _context);
+#endif  // D_CFG_CONTAINER_FILTER_SEGMENTED_ARRAY
+
+// =============================================================================
+// memory management
+// =============================================================================
+void   d_segmented_array_free(struct d_segmented_array* _segmented_array);
+void   d_segmented_array_free_deep(struct d_segmented_array* _segmented_array, fn_free _free_fn);
+
+
+#endif  // DJINTERP_CONTAINER_ARRAY_SEGMENTED_
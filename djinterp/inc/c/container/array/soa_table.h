@@ -0,0 +1,180 @@
+/******************************************************************************
+* djinterp [container]                                             soa_table.h
+*
+*   A struct-of-arrays (columnar) table. The row layout is described once by
+* a schema of `d_soa_field`s, each carrying a `type_info.h` descriptor, and
+* every field is then stored in its own contiguous column. A scan that tests
+* one or two fields reads only those columns, instead of pulling whole rows
+* through the cache as a row array (e.g. `d_registry`) does.
+*   Rows can still be moved in and out as ordinary structs: each field
+* records its byte offset in the row struct, so d_soa_table_push_row
+* scatters a struct into the columns and d_soa_table_get_row gathers it
+* back.
+*   Scans work on selection vectors (arrays of row indices):
+*   d_soa_table_select_S   rows whose column compares true against a value
+*   d_soa_table_refine_S   narrows an existing selection by another column
+*   d_soa_table_count_S    number of matching rows, without a selection
+* They are generated from D_SOA_TABLE_TYPES with D_FOR_EACH (one set per
+* type `T` with suffix `S`) and run as plain loops over a `T` array with the
+* comparison chosen outside the loop and the index appended without a
+* branch, a form compilers vectorize. d_soa_table_select_cmp covers other
+* column types through a comparator.
+*
+*
+* path:      \inc\container\array\soa_table.h
+* link(s):   TBA
+* author(s): Samuel 'teer' Neal-Blim                          date: 2026.10.18
+******************************************************************************/
+
+#ifndef DJINTERP_CONTAINER_ARRAY_SOA_TABLE_
+#define DJINTERP_CONTAINER_ARRAY_SOA_TABLE_ 1
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../../djinterp.h"
+#include "../../dmacro.h"
+#include "../../dmemory.h"
+#include "../../type_info.h"
+#include "../container.h"
+
+
+#ifndef D_SOA_TABLE_DEFAULT_CAPACITY
+    // D_SOA_TABLE_DEFAULT_CAPACITY
+    //   constant: the number of rows a new table reserves when none is
+    // requested.
+    #define D_SOA_TABLE_DEFAULT_CAPACITY 16
+#endif  // D_SOA_TABLE_DEFAULT_CAPACITY
+
+// D_SOA_TABLE_TYPES
+//   macro: (suffix, type, key kind) tuples for which typed scans are
+// generated. The key kind is checked against a column's type descriptor
+// before scanning: SIGNED and UNSIGNED columns must be integral with the
+// same signedness, FLOAT columns floating point; sizes must match exactly.
+#define D_SOA_TABLE_TYPES                                                     \
+    (int32,  int32_t,  SIGNED),                                               \
+    (uint32, uint32_t, UNSIGNED),                                             \
+    (int64,  int64_t,  SIGNED),                                               \
+    (uint64, uint64_t, UNSIGNED),                                             \
+    (float,  float,    FLOAT),                                                \
+    (double, double,   FLOAT)
+
+// D_SOA_FIELD
+//   macro: builds a `d_soa_field` for member `_member` of row struct
+// `_row_type`, described by `_type_info` (a D_TYPE_INFO_* value).
+#define D_SOA_FIELD(_row_type, _member, _type_info)                           \
+    {                                                                         \
+        #_member,                                                             \
+        (d_type_info64)(_type_info),                                          \
+        sizeof(((_row_type*)0)->_member),                                     \
+        offsetof(_row_type, _member)                                          \
+    }
+
+
+// d_soa_compare
+//   enum: comparison applied between each column value and the operand of
+// a scan.
+enum d_soa_compare
+{
+    D_SOA_EQ = 0,
+    D_SOA_NE,
+    D_SOA_LT,
+    D_SOA_LE,
+    D_SOA_GT,
+    D_SOA_GE
+};
+
+// d_soa_field
+//   struct: schema entry for one field. `size` is the size in bytes of one
+// value; `offset` is the field's position in the row struct used by
+// d_soa_table_push_row / d_soa_table_get_row.
+struct d_soa_field
+{
+    const char*   name;
+    d_type_info64 type;
+    size_t        size;
+    size_t        offset;
+};
+
+// d_soa_column
+//   struct: one field's schema entry and its contiguous storage.
+struct d_soa_column
+{
+    struct d_soa_field field;
+    void*              data;
+};
+
+// d_soa_table
+//   struct: a columnar table of `count` rows with room for `capacity`.
+struct d_soa_table
+{
+    size_t               count;
+    size_t               capacity;
+    size_t               column_count;
+    struct d_soa_column* columns;
+};
+
+
+// D_INTERNAL_SOA_TABLE_DECLARE_TYPED
+//   macro (internal): declares the typed scans for one D_SOA_TABLE_TYPES
+// tuple.
+#define D_INTERNAL_SOA_TABLE_DECLARE_TYPED(_suffix, _type, _kind)             \
+    size_t d_soa_table_select_##_suffix(const struct d_soa_table* _table, size_t _column, enum d_soa_compare _compare, _type _value, size_t* _out_rows); \
+    size_t d_soa_table_refine_##_suffix(const struct d_soa_table* _table, size_t _column, enum d_soa_compare _compare, _type _value, size_t* _rows, size_t _row_count); \
+    size_t d_soa_table_count_##_suffix(const struct d_soa_table* _table, size_t _column, enum d_soa_compare _compare, _type _value);
+
+// D_INTERNAL_SOA_TABLE_DECLARE
+//   macro (internal): unpacks a parenthesized tuple for D_FOR_EACH.
+#define D_INTERNAL_SOA_TABLE_DECLARE(_tuple)                                  \
+    D_INTERNAL_SOA_TABLE_DECLARE_TYPED _tuple
+
+
+// =============================================================================
+// constructor functions
+// =============================================================================
+struct d_soa_table* d_soa_table_new(const struct d_soa_field* _fields, size_t _field_count, size_t _initial_capacity);
+
+// =============================================================================
+// schema functions
+// =============================================================================
+ssize_t d_soa_table_column_index(const struct d_soa_table* _table, const char* _name);
+const struct d_soa_field* d_soa_table_field(const struct d_soa_table* _table, size_t _column);
+
+// =============================================================================
+// column and cell access functions
+// =============================================================================
+void*  d_soa_table_column(const struct d_soa_table* _table, size_t _column);
+void*  d_soa_table_cell(const struct d_soa_table* _table, size_t _row, size_t _column);
+bool   d_soa_table_set_cell(struct d_soa_table* _table, size_t _row, size_t _column, const void* _value);
+
+// =============================================================================
+// row functions
+// =============================================================================
+bool   d_soa_table_push_row(struct d_soa_table* _table, const void* _row);
+bool   d_soa_table_push_rows(struct d_soa_table* _table, const void* _rows, size_t _row_size, size_t _count);
+bool   d_soa_table_get_row(const struct d_soa_table* _table, size_t _row, void* _out_row);
+bool   d_soa_table_remove(struct d_soa_table* _table, size_t _row);
+bool   d_soa_table_remove_swap(struct d_soa_table* _table, size_t _row);
+bool   d_soa_table_clear(struct d_soa_table* _table);
+bool   d_soa_table_reserve(struct d_soa_table* _table, size_t _capacity);
+
+// =============================================================================
+// query functions
+// =============================================================================
+size_t d_soa_table_count(const struct d_soa_table* _table);
+size_t d_soa_table_column_count(const struct d_soa_table* _table);
+
+// =============================================================================
+// scan functions
+// =============================================================================
+D_FOR_EACH(D_INTERNAL_SOA_TABLE_DECLARE, D_SOA_TABLE_TYPES)
+size_t d_soa_table_select_cmp(const struct d_soa_table* _table, size_t _column, enum d_soa_compare _compare, const void* _value, fn_comparator _comparator, size_t* _out_rows);
+
+// =============================================================================
+// memory management
+// =============================================================================
+void   d_soa_table_free(struct d_soa_table* _table);
+
+
+#endif  // DJINTERP_CONTAINER_ARRAY_SOA_TABLE_
@@ -0,0 +1,156 @@
+/******************************************************************************
+* djinterp [container]                                           sorted_array.h
+*
+*   A sorted array keeps its elements ordered at all times, trading O(n)
+* single inserts for cache-friendly O(log n) searches over one contiguous
+* buffer. It is meant for read-mostly lookup tables.
+*   Ordering comes either from an `fn_comparator` or from an integer key
+* stored at a fixed offset in each element. Keyed arrays never call back
+* through a function pointer: searches compile down to loads and conditional
+* moves.
+*   Writes are best done in batches: d_sorted_array_insert_all sorts the
+* batch and merges it in a single backward pass. Reads can be served from
+* the array itself (branchless lower bound) or from a snapshot laid out in
+* Eytzinger (BFS) order, whose probes walk down a heap so that the next few
+* levels share cache lines and can be prefetched.
+*
+*
+* path:      \inc\container\array\sorted_array.h
+* link(s):   TBA
+* author(s): Samuel 'teer' Neal-Blim                          date: 2026.10.18
+******************************************************************************/
+
+#ifndef DJINTERP_CONTAINER_ARRAY_SORTED_
+#define DJINTERP_CONTAINER_ARRAY_SORTED_ 1
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../../djinterp.h"
+#include "../../dmemory.h"
+#include "../../container/container.h"
+#include "../../core/config/container/array/array_config.h"
+
+#if D_CFG_CONTAINER_FILTER_ARRAY_SORTED
+    #include "./array_filter.h"
+#endif  // D_CFG_CONTAINER_FILTER_ARRAY_SORTED
+
+
+#ifndef D_SORTED_ARRAY_DEFAULT_CAPACITY
+    // D_SORTED_ARRAY_DEFAULT_CAPACITY
+    //   constant: the default capacity, in number of elements, that a new
+    // `d_sorted_array` has by default.
+    #define D_SORTED_ARRAY_DEFAULT_CAPACITY 32
+#endif  // D_SORTED_ARRAY_DEFAULT_CAPACITY
+
+
+// d_sorted_array_key
+//   enum: how elements are ordered. COMPARATOR uses the array's
+// `fn_comparator`; the integer kinds read a key of that type at
+// `key_offset` within each element and compare it directly.
+enum d_sorted_array_key
+{
+    D_SORTED_ARRAY_KEY_COMPARATOR = 0,
+    D_SORTED_ARRAY_KEY_INT32,
+    D_SORTED_ARRAY_KEY_UINT32,
+    D_SORTED_ARRAY_KEY_INT64,
+    D_SORTED_ARRAY_KEY_UINT64
+};
+
+
+// d_sorted_array
+//   struct: a growable array kept in ascending order. Equal elements keep
+// their insertion order.
+struct d_sorted_array
+{
+    size_t                  count;
+    void*                   elements;
+    size_t                  element_size;
+    size_t                  capacity;
+    fn_comparator           comparator;   // used when key == COMPARATOR
+    enum d_sorted_array_key key;
+    size_t                  key_offset;   // byte offset of an integer key
+};
+
+// d_sorted_array_snapshot
+//   struct: read-only copy of a sorted array in Eytzinger order. Slot 0 is
+// unused; the children of slot k are 2k and 2k + 1.
+struct d_sorted_array_snapshot
+{
+    size_t                  count;
+    void*                   elements;
+    size_t                  element_size;
+    fn_comparator           comparator;
+    enum d_sorted_array_key key;
+    size_t                  key_offset;
+};
+
+
+// =============================================================================
+// constructor functions
+// =============================================================================
+struct d_sorted_array* d_sorted_array_new(size_t _element_size, fn_comparator _comparator);
+struct d_sorted_array* d_sorted_array_new_keyed(size_t _element_size, enum d_sorted_array_key _key, size_t _key_offset);
+struct d_sorted_array* d_sorted_array_new_from_arr(size_t _element_size, fn_comparator _comparator, const void* _source, size_t _source_count);
+
+// =============================================================================
+// element access functions
+// =============================================================================
+void*  d_sorted_array_get(const struct d_sorted_array* _sorted_array, d_index _index);
+void*  d_sorted_array_front(const struct d_sorted_array* _sorted_array);
+void*  d_sorted_array_back(const struct d_sorted_array* _sorted_array);
+
+// =============================================================================
+// modification functions
+// =============================================================================
+bool   d_sorted_array_insert(struct d_sorted_array* _sorted_array, const void* _element);
+bool   d_sorted_array_insert_all(struct d_sorted_array* _sorted_array, const void* _elements, size_t _count);
+bool   d_sorted_array_remove(struct d_sorted_array* _sorted_array, const void* _probe);
+bool   d_sorted_array_remove_at(struct d_sorted_array* _sorted_array, d_index _index);
+bool   d_sorted_array_clear(struct d_sorted_array* _sorted_array);
+bool   d_sorted_array_reserve(struct d_sorted_array* _sorted_array, size_t _capacity);
+
+// =============================================================================
+// search functions
+// =============================================================================
+size_t  d_sorted_array_lower_bound(const struct d_sorted_array* _sorted_array, const void* _probe);
+size_t  d_sorted_array_upper_bound(const struct d_sorted_array* _sorted_array, const void* _probe);
+ssize_t d_sorted_array_find(const struct d_sorted_array* _sorted_array, const void* _probe);
+bool    d_sorted_array_contains(const struct d_sorted_array* _sorted_array, const void* _probe);
+size_t  d_sorted_array_count_equal(const struct d_sorted_array* _sorted_array, const void* _probe);
+size_t  d_sorted_array_lower_bound_int(const struct d_sorted_array* _sorted_array, int64_t _key);
+size_t  d_sorted_array_lower_bound_uint(const struct d_sorted_array* _sorted_array, uint64_t _key);
+
+// =============================================================================
+// query functions
+// =============================================================================
+bool   d_sorted_array_is_empty(const struct d_sorted_array* _sorted_array);
+size_t d_sorted_array_count(const struct d_sorted_array* _sorted_array);
+size_t d_sorted_array_capacity(const struct d_sorted_array* _sorted_array);
+bool   d_sorted_array_is_sorted(const struct d_sorted_array* _sorted_array);
+
+// =============================================================================
+// snapshot functions
+// =============================================================================
+struct d_sorted_array_snapshot* d_sorted_array_snapshot_new(const struct d_sorted_array* _sorted_array);
+const void* d_sorted_array_snapshot_lower_bound(const struct d_sorted_array_snapshot* _snapshot, const void* _probe);
+const void* d_sorted_array_snapshot_find(const struct d_sorted_array_snapshot* _snapshot, const void* _probe);
+const void* d_sorted_array_snapshot_lower_bound_int(const struct d_sorted_array_snapshot* _snapshot, int64_t _key);
+const void* d_sorted_array_snapshot_lower_bound_uint(const struct d_sorted_array_snapshot* _snapshot, uint64_t _key);
+void        d_sorted_array_snapshot_free(struct d_sorted_array_snapshot* _snapshot);
+
+// =============================================================================
+// filter functions
+// =============================================================================
+#if D_CFG_CONTAINER_FILTER_ARRAY_SORTED
+size_t d_sorted_array_count_where(const struct d_sorted_array* _sorted_array, fn_predicate _test, void* _context);
+size_t d_sorted_array_filter_in_place(struct d_sorted_array* _sorted_array, fn_predicate _test, void* _context);
+#endif  // D_CFG_CONTAINER_FILTER_ARRAY_SORTED
+
+// =============================================================================
+// memory management
+// =============================================================================
+void   d_sorted_array_free(struct d_sorted_array* _sorted_array);
+
+
+#endif  // DJINTERP_CONTAINER_ARRAY_SORTED_
@@ -0,0 +1,119 @@
+/******************************************************************************
+* djinterp [container]                                                bitset.h
+*
+*   A fixed-size set of bits packed into 64-bit words. Bit `i` is bit
+* i % 64 of word i / 64; bits past `size` in the last word are kept zero so
+* that counting and comparing can work on whole words.
+*   Besides single-bit access, the bitset answers the succinct-structure
+* queries:
+*   d_bitset_count    number of set bits (popcount)
+*   d_bitset_rank     number of set bits before a position
+*   d_bitset_select   position of the k-th set bit
+* and combines with other bitsets in place (and, or, xor, andnot). The
+* combining loops are the `d_bitset_words_*` functions, which work on raw
+* word arrays so other containers (e.g. `d_roaring`) can share them; they
+* use 256-bit AVX2, 128-bit SSE2 or NEON vectors when the build targets
+* them, and a word loop otherwise.
+*   A set of row indices kept as a bitset costs one bit per row instead of
+* one `size_t` per match, and intersecting or uniting two of them is a
+* single pass over the words.
+*
+*
+* path:      \inc\container\bitset\bitset.h
+* link(s):   TBA
+* author(s): Samuel 'teer' Neal-Blim                          date: 2026.10.18
+******************************************************************************/
+
+#ifndef DJINTERP_CONTAINER_BITSET_
+#define DJINTERP_CONTAINER_BITSET_ 1
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../../djinterp.h"
+#include "../../dmemory.h"
+#include "../container.h"
+
+
+// D_BITSET_WORD_BITS
+//   constant: number of bits in each word of a `d_bitset`.
+#define D_BITSET_WORD_BITS 64
+
+// D_BITSET_WORDS_FOR
+//   macro: number of words needed to hold `_bits` bits.
+#define D_BITSET_WORDS_FOR(_bits)                                             \
+    (((_bits) + (D_BITSET_WORD_BITS - 1)) / D_BITSET_WORD_BITS)
+
+
+// d_bitset
+//   struct: `size` bits stored in `word_count` words.
+struct d_bitset
+{
+    size_t    size;
+    size_t    word_count;
+    uint64_t* words;
+};
+
+
+// =============================================================================
+// constructor functions
+// =============================================================================
+struct d_bitset* d_bitset_new(size_t _size);
+struct d_bitset* d_bitset_new_copy(const struct d_bitset* _other);
+struct d_bitset* d_bitset_new_from_indices(size_t _size, const size_t* _indices, size_t _count);
+
+// =============================================================================
+// bit access functions
+// =============================================================================
+bool   d_bitset_test(const struct d_bitset* _bitset, size_t _bit);
+bool   d_bitset_set(struct d_bitset* _bitset, size_t _bit);
+bool   d_bitset_reset(struct d_bitset* _bitset, size_t _bit);
+bool   d_bitset_flip(struct d_bitset* _bitset, size_t _bit);
+bool   d_bitset_set_range(struct d_bitset* _bitset, size_t _start, size_t _count);
+bool   d_bitset_set_all(struct d_bitset* _bitset);
+bool   d_bitset_reset_all(struct d_bitset* _bitset);
+bool   d_bitset_resize(struct d_bitset* _bitset, size_t _size);
+
+// =============================================================================
+// query functions
+// =============================================================================
+size_t d_bitset_size(const struct d_bitset* _bitset);
+size_t d_bitset_count(const struct d_bitset* _bitset);
+size_t d_bitset_rank(const struct d_bitset* _bitset, size_t _bit);
+bool   d_bitset_select(const struct d_bitset* _bitset, size_t _k, size_t* _out_bit);
+bool   d_bitset_next(const struct d_bitset* _bitset, size_t _from, size_t* _out_bit);
+bool   d_bitset_any(const struct d_bitset* _bitset);
+bool   d_bitset_equals(const struct d_bitset* _a, const struct d_bitset* _b);
+
+// =============================================================================
+// set algebra functions
+// =============================================================================
+bool   d_bitset_and(struct d_bitset* _dest, const struct d_bitset* _source);
+bool   d_bitset_or(struct d_bitset* _dest, const struct d_bitset* _source);
+bool   d_bitset_xor(struct d_bitset* _dest, const struct d_bitset* _source);
+bool   d_bitset_andnot(struct d_bitset* _dest, const struct d_bitset* _source);
+size_t d_bitset_count_and(const struct d_bitset* _a, const struct d_bitset* _b);
+
+// =============================================================================
+// conversion functions
+// =============================================================================
+size_t d_bitset_to_indices(const struct d_bitset* _bitset, size_t* _out_indices);
+
+// =============================================================================
+// word functions
+// =============================================================================
+size_t d_bitset_popcount64(uint64_t _word);
+size_t d_bitset_words_count(const uint64_t* _words, size_t _word_count);
+void   d_bitset_words_and(uint64_t* _dest, const uint64_t* _source, size_t _word_count);
+void   d_bitset_words_or(uint64_t* _dest, const uint64_t* _source, size_t _word_count);
+void   d_bitset_words_xor(uint64_t* _dest, const uint64_t* _source, size_t _word_count);
+void   d_bitset_words_andnot(uint64_t* _dest, const uint64_t* _source, size_t _word_count);
+
+// =============================================================================
+// memory management
+// =============================================================================
+void   d_bitset_free(struct d_bitset* _bitset);
+
+
+#endif  // DJINTERP_CONTAINER_BITSET_
@@ -0,0 +1,118 @@
+/******************************************************************************
+* djinterp [container]                                               roaring.h
+*
+*   A compressed bitmap of 32-bit values in the style of Roaring bitmaps
+* (Chambi, Lemire et al., "Better bitmap performance with Roaring bitmaps",
+* 2016). Values are split by their high 16 bits into chunks of 65536, and
+* each non-empty chunk is stored in a container chosen by its cardinality:
+*   - up to D_ROARING_ARRAY_MAX values: a sorted array of the low 16 bits
+*     (2 bytes per value);
+*   - more than that: a 65536-bit bitmap (8 KiB).
+* The containers are kept sorted by key. A sparse set therefore costs about
+* 2 bytes per value, where a `d_bitset` would cost its full size, while a
+* dense chunk costs no more than a bitset does.
+*   Set operations (and, or, andnot) walk the two key lists in step and
+* combine matching containers: array with array by merging, array with
+* bitmap by probing, and bitmap with bitmap through the `d_bitset_words_*`
+* kernels. Each result container is converted back to the cheaper form for
+* its cardinality.
+*
+*
+* path:      \inc\container\bitset\roaring.h
+* link(s):   TBA
+* author(s): Samuel 'teer' Neal-Blim                          date: 2026.10.18
+******************************************************************************/
+
+#ifndef DJINTERP_CONTAINER_BITSET_ROARING_
+#define DJINTERP_CONTAINER_BITSET_ROARING_ 1
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../../djinterp.h"
+#include "../../dmemory.h"
+#include "../container.h"
+#include "./bitset.h"
+
+
+// D_ROARING_ARRAY_MAX
+//   constant: the largest number of values held by an array container; a
+// container with more values is stored as a bitmap. At 4096 values both
+// forms take 8 KiB.
+#define D_ROARING_ARRAY_MAX 4096
+
+// D_ROARING_BITMAP_WORDS
+//   constant: number of 64-bit words in a bitmap container (65536 bits).
+#define D_ROARING_BITMAP_WORDS 1024
+
+
+// d_roaring_container
+//   struct: the values of one 65536-value chunk. `data` points to `count`
+// sorted uint16_t values (array form, room for `capacity`) or to
+// D_ROARING_BITMAP_WORDS words (bitmap form).
+struct d_roaring_container
+{
+    uint16_t key;           // high 16 bits shared by every value
+    bool     is_bitmap;
+    uint32_t count;         // number of values in the chunk
+    uint32_t capacity;      // array form only
+    void*    data;
+};
+
+// d_roaring
+//   struct: a compressed bitmap; `containers` is sorted by key and holds
+// no empty container.
+struct d_roaring
+{
+    size_t                      container_count;
+    size_t                      container_capacity;
+    struct d_roaring_container* containers;
+};
+
+
+// =============================================================================
+// constructor functions
+// =============================================================================
+struct d_roaring* d_roaring_new(void);
+struct d_roaring* d_roaring_new_copy(const struct d_roaring* _other);
+struct d_roaring* d_roaring_new_from_array(const uint32_t* _values, size_t _count);
+struct d_roaring* d_roaring_new_from_bitset(const struct d_bitset* _bitset);
+
+// =============================================================================
+// element functions
+// =============================================================================
+bool   d_roaring_add(struct d_roaring* _roaring, uint32_t _value);
+bool   d_roaring_remove(struct d_roaring* _roaring, uint32_t _value);
+bool   d_roaring_contains(const struct d_roaring* _roaring, uint32_t _value);
+bool   d_roaring_clear(struct d_roaring* _roaring);
+
+// =============================================================================
+// query functions
+// =============================================================================
+size_t d_roaring_count(const struct d_roaring* _roaring);
+bool   d_roaring_is_empty(const struct d_roaring* _roaring);
+size_t d_roaring_rank(const struct d_roaring* _roaring, uint32_t _value);
+bool   d_roaring_select(const struct d_roaring* _roaring, size_t _k, uint32_t* _out_value);
+bool   d_roaring_equals(const struct d_roaring* _a, const struct d_roaring* _b);
+
+// =============================================================================
+// set algebra functions
+// =============================================================================
+struct d_roaring* d_roaring_and(const struct d_roaring* _a, const struct d_roaring* _b);
+struct d_roaring* d_roaring_or(const struct d_roaring* _a, const struct d_roaring* _b);
+struct d_roaring* d_roaring_andnot(const struct d_roaring* _a, const struct d_roaring* _b);
+
+// =============================================================================
+// conversion functions
+// =============================================================================
+size_t d_roaring_to_array(const struct d_roaring* _roaring, uint32_t* _out_values);
+struct d_bitset* d_roaring_to_bitset(const struct d_roaring* _roaring, size_t _size);
+
+// =============================================================================
+// memory management
+// =============================================================================
+void   d_roaring_free(struct d_roaring* _roaring);
+
+
+#endif  // DJINTERP_CONTAINER_BITSET_ROARING_
@@ -0,0 +1,168 @@
+/******************************************************************************
+* djinterp [container]                                             btree_map.h
+*
+*   An ordered map from fixed-size keys to pointer values, stored as a B+tree.
+* Every entry lives in a leaf; internal nodes hold only separator keys and
+* child pointers, and the leaves are chained left to right so that a range
+* scan descends once and then walks the chain.
+*   Nodes are fixed-size blocks of D_BTREE_MAP_NODE_SIZE bytes allocated on
+* cache-line boundaries. A node's keys are packed at the start of the block,
+* ahead of its values or children, so the binary search inside a node only
+* touches the cache lines that hold keys. With 8-byte keys and the default
+* 512-byte node a node holds 30 keys, and a few million keys fit in five
+* levels.
+*   Ordering comes either from an `fn_comparator` or from a typed integer key
+* (d_btree_map_new_keyed); keyed maps search nodes with a branchless loop
+* and never call through a function pointer.
+*   Inserts that land at the end of the rightmost leaf (ascending keys, as
+* with timestamps) split so that the left node stays full, rather than
+* leaving a trail of half-empty nodes behind. Sorted input can be loaded all
+* at once with d_btree_map_bulk_load, which builds the tree bottom-up in
+* O(n) without any splitting.
+*   Ranges are read through a `d_btree_map_cursor`, or through a
+* `struct d_iterator` (util/iterator.h) that yields `d_btree_map_entry`s.
+* Modifying the map invalidates all cursors and iterators on it.
+*
+*
+* path:      \inc\container\map\btree_map.h
+* link(s):   TBA
+* author(s): Samuel 'teer' Neal-Blim                          date: 2026.10.18
+******************************************************************************/
+
+#ifndef DJINTERP_CONTAINER_MAP_BTREE_MAP_
+#define DJINTERP_CONTAINER_MAP_BTREE_MAP_ 1
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../../djinterp.h"
+#include "../../dmemory.h"
+#include "../container.h"
+#include "../../util/iterator.h"
+
+
+#ifndef D_BTREE_MAP_NODE_SIZE
+    // D_BTREE_MAP_NODE_SIZE
+    //   constant: the size in bytes of one tree node. Should be a multiple
+    // of D_BTREE_MAP_CACHE_LINE. Nodes grow past it only when a key is so
+    // large that fewer than D_BTREE_MAP_MIN_FANOUT keys would fit.
+    #define D_BTREE_MAP_NODE_SIZE 512
+#endif  // D_BTREE_MAP_NODE_SIZE
+
+#ifndef D_BTREE_MAP_CACHE_LINE
+    // D_BTREE_MAP_CACHE_LINE
+    //   constant: alignment, in bytes, of every node.
+    #define D_BTREE_MAP_CACHE_LINE 64
+#endif  // D_BTREE_MAP_CACHE_LINE
+
+// D_BTREE_MAP_MIN_FANOUT
+//   constant: the smallest number of keys a node may hold.
+#define D_BTREE_MAP_MIN_FANOUT 4
+
+// D_BTREE_MAP_MAX_HEIGHT
+//   constant: the deepest tree supported. Nodes other than the root stay at
+// least half full, so this is never reached in practice.
+#define D_BTREE_MAP_MAX_HEIGHT 48
+
+
+// d_btree_map_key
+//   enum: how keys are ordered. COMPARATOR uses the map's `fn_comparator`;
+// the integer kinds compare keys of that type directly.
+enum d_btree_map_key
+{
+    D_BTREE_MAP_KEY_COMPARATOR = 0,
+    D_BTREE_MAP_KEY_INT32,
+    D_BTREE_MAP_KEY_UINT32,
+    D_BTREE_MAP_KEY_INT64,
+    D_BTREE_MAP_KEY_UINT64
+};
+
+// d_btree_map_node
+//   struct: header of a tree node. The header is followed, in the same
+// block, by `capacity` keys and then by `capacity` values (leaves) or
+// `capacity + 1` child pointers (internal nodes).
+struct d_btree_map_node
+{
+    struct d_btree_map_node* next;      // right sibling (leaves only)
+    uint32_t                 count;     // number of keys in use
+    bool                     is_leaf;
+};
+
+// d_btree_map
+//   struct: a B+tree mapping `key_size`-byte keys to `void*` values. The
+// layout fields are derived from `key_size` by the constructors.
+struct d_btree_map
+{
+    struct d_btree_map_node* root;
+    struct d_btree_map_node* first;     // leftmost leaf
+    size_t                   count;
+    size_t                   height;    // 0 when empty, 1 for a lone leaf
+    size_t                   key_size;
+    fn_comparator            comparator;   // used when key == COMPARATOR
+    enum d_btree_map_key     key;
+    size_t                   capacity;     // keys per node
+    size_t                   slot_offset;  // byte offset of values/children
+    size_t                   node_size;    // bytes per node
+    void*                    scratch;      // room for two keys (splits)
+};
+
+// d_btree_map_entry
+//   struct: one key/value pair, as yielded by d_btree_map_iterator. `key`
+// points into the tree.
+struct d_btree_map_entry
+{
+    const void* key;
+    void*       value;
+};
+
+// d_btree_map_cursor
+//   struct: a forward position in a map, bounded by an exclusive upper key.
+// `high` is not copied and must outlive the cursor.
+struct d_btree_map_cursor
+{
+    const struct d_btree_map*      map;
+    const struct d_btree_map_node* leaf;
+    size_t                         index;
+    const void*                    high;   // NULL for no upper bound
+};
+
+
+// =============================================================================
+// constructor functions
+// =============================================================================
+struct d_btree_map* d_btree_map_new(size_t _key_size, fn_comparator _comparator);
+struct d_btree_map* d_btree_map_new_keyed(enum d_btree_map_key _key);
+
+// =============================================================================
+// element functions
+// =============================================================================
+bool   d_btree_map_put(struct d_btree_map* _map, const void* _key, void* _value);
+void*  d_btree_map_get(const struct d_btree_map* _map, const void* _key);
+bool   d_btree_map_contains(const struct d_btree_map* _map, const void* _key);
+bool   d_btree_map_remove(struct d_btree_map* _map, const void* _key);
+bool   d_btree_map_bulk_load(struct d_btree_map* _map, const void* _keys, void* const* _values, size_t _count);
+bool   d_btree_map_clear(struct d_btree_map* _map);
+
+// =============================================================================
+// query functions
+// =============================================================================
+size_t d_btree_map_count(const struct d_btree_map* _map);
+bool   d_btree_map_is_empty(const struct d_btree_map* _map);
+size_t d_btree_map_height(const struct d_btree_map* _map);
+const void* d_btree_map_first(const struct d_btree_map* _map, void** _out_value);
+const void* d_btree_map_last(const struct d_btree_map* _map, void** _out_value);
+
+// =============================================================================
+// range functions
+// =============================================================================
+bool   d_btree_map_range(const struct d_btree_map* _map, const void* _low, const void* _high, struct d_btree_map_cursor* _cursor);
+bool   d_btree_map_cursor_next(struct d_btree_map_cursor* _cursor, const void** _out_key, void** _out_value);
+struct d_iterator d_btree_map_iterator(const struct d_btree_map* _map, const void* _low, const void* _high);
+
+// =============================================================================
+// memory management
+// =============================================================================
+void   d_btree_map_free(struct d_btree_map* _map);
+
+
+#endif  // DJINTERP_CONTAINER_MAP_BTREE_MAP_
@@ -3,6 +3,10 @@
 *
 *   A `d_vector` is a dynamically-resizable vector. This module provides a
 * struct-based wrapper around the vector_common functions for convenient use.
+*   Many positional edits are best applied as one sorted batch with
+* d_vector_apply_edits. For editor-style work clustered around a cursor, a
+* `d_vector_gap` session keeps the spare capacity at the cursor (a gap
+* buffer) so that local inserts and erases move no elements at all.
 *
 *
 * path:      \inc\container\vector\vector.h   
@@ -20,6 +24,7 @@
 #include "../../dmemory.h"
 #include "../container.h"
 #include "./vector_common.h"
+#include "../array/array_sort_parallel.h"
 
 
 // D_VECTOR_INIT
@@ -58,6 +63,20 @@ struct d_vector
 	size_t count;
 };
 
+// d_vector_gap
+//   struct: a gap-buffer editing session over a `d_vector`. While it is
+// open the vector's spare capacity sits at the cursor rather than after the
+// last element: inserting or erasing at the cursor moves nothing, and moving
+// the cursor moves only the elements it passes over. The vector's `count`
+// stays correct, but its elements are not contiguous, so the vector must
+// only be used through d_vector_gap_* functions until d_vector_gap_end.
+struct d_vector_gap
+{
+	struct d_vector* vector;
+	size_t           gap_start;    // cursor; first slot of the gap
+	size_t           gap_end;      // one past the last slot of the gap
+};
+
 
 // constructor functions
 struct d_vector* d_vector_new(size_t _element_size, size_t _initial_capacity);
@@ -86,6 +105,19 @@ bool   d_vector_erase(struct d_vector* _vector, d_index _index);
 bool   d_vector_erase_range(struct d_vector* _vector, d_index _start, d_index _end);
 void   d_vector_clear(struct d_vector* _vector);
 
+// batch edit functions
+bool   d_vector_apply_edits(struct d_vector* _vector, const struct d_vector_edit* _edits, size_t _edit_count);
+
+// gap buffer functions
+bool   d_vector_gap_begin(struct d_vector_gap* _gap, struct d_vector* _vector, size_t _cursor);
+bool   d_vector_gap_move(struct d_vector_gap* _gap, size_t _cursor);
+bool   d_vector_gap_insert(struct d_vector_gap* _gap, const void* _source, size_t _count);
+bool   d_vector_gap_erase_before(struct d_vector_gap* _gap, size_t _count);
+bool   d_vector_gap_erase_after(struct d_vector_gap* _gap, size_t _count);
+void*  d_vector_gap_at(const struct d_vector_gap* _gap, size_t _index);
+size_t d_vector_gap_cursor(const struct d_vector_gap* _gap);
+bool   d_vector_gap_end(struct d_vector_gap* _gap);
+
 // append/prepend functions
 bool   d_vector_append_element(struct d_vector* _vector, const void* _element);
 bool   d_vector_append_elements(struct d_vector* _vector, const void* _source, size_t _count);
@@ -123,6 +155,9 @@ size_t  d_vector_count_value(const struct d_vector* _vector, const void* _value,
 bool    d_vector_swap(struct d_vector* _vector, d_index _index_a, d_index _index_b);
 bool    d_vector_reverse(struct d_vector* _vector);
 void    d_vector_sort(struct d_vector* _vector, fn_comparator _comparator);
+bool    d_vector_sort_keyed(struct d_vector* _vector, enum d_array_sort_key _key, size_t _key_offset);
+bool    d_vector_sort_parallel(struct d_vector* _vector, fn_comparator _comparator, enum d_array_sort_mode _mode, size_t _threads);
+struct d_vector* d_vector_merge_sorted(const struct d_vector* const* _vectors, size_t _vector_count, fn_comparator _comparator, size_t _threads);
 bool    d_vector_copy_to(const struct d_vector* _vector, void* _destination, size_t _dest_capacity);
 
 // destructor functions
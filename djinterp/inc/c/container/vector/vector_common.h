@@ -57,6 +57,30 @@
 #endif	// D_VECTOR_MIN_CAPACITY
 
 
+// d_vector_edit_kind
+//   enum: the operation performed by one `d_vector_edit`.
+enum d_vector_edit_kind
+{
+	D_VECTOR_EDIT_INSERT = 0,
+	D_VECTOR_EDIT_ERASE
+};
+
+// d_vector_edit
+//   struct: one positional edit of a batch. `index` always refers to the
+// vector as it was before the batch, so a list sorted by `index` can be
+// applied in a single pass. An insert places `count` elements from
+// `elements` before original element `index` (or at the end when `index`
+// equals the count); an erase removes original elements
+// [index, index + count).
+struct d_vector_edit
+{
+	enum d_vector_edit_kind kind;
+	size_t                  index;
+	size_t                  count;
+	const void*             elements;    // source for inserts; unused by erases
+};
+
+
 // initialization functions
 bool   d_vector_common_init(void** _elements, size_t* _count, size_t* _capacity, size_t _element_size, size_t _initial_capacity);
 bool   d_vector_common_init_from_array(void** _elements, size_t* _count, size_t* _capacity, size_t _element_size, const void* _source, size_t _source_count);
@@ -81,6 +105,7 @@ bool   d_vector_common_insert_element(void** _destination, size_t* _count, size_
 bool   d_vector_common_insert_elements(void** _destination, size_t* _count, size_t* _capacity, size_t _element_size, d_index _index, const void* _source, size_t _source_count);
 bool   d_vector_common_erase(void* _destination, size_t* _count, size_t _element_size, d_index _index);
 bool   d_vector_common_erase_range(void* _destination, size_t* _count, size_t _element_size, d_index _start, d_index  _end);
+bool   d_vector_common_apply_edits(void** _elements, size_t* _count, size_t* _capacity, size_t _element_size, const struct d_vector_edit* _edits, size_t _edit_count);
 
 // append/prepend functions
 bool   d_vector_common_append_element(void** _destination, size_t* _count, size_t* _capacity, size_t _element_size, const void* _element);
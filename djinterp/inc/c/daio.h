@@ -0,0 +1,180 @@
+/******************************************************************************
+* djinterp [core]                                                       daio.h
+*
+* Asynchronous file I/O engine.
+*   Requests (read, write, fsync, open, close) are submitted to an engine and
+* complete in the background; completions are delivered on the caller's thread
+* from d_aio_poll / d_aio_wait, either through a per-request callback, as
+* events queued on an attached d_event_handler, or through d_aio_next.
+*   On Linux the engine drives io_uring directly (no liburing dependency), so a
+* batch of submissions and the wait for their completions cost a single system
+* call. Where io_uring is unavailable - other platforms, old kernels, or
+* sandboxes that forbid it - the same API is served by a dmutex.h thread pool
+* performing ordinary blocking calls.
+*
+* path:      \inc\daio.h
+* link:      TBA
+* author(s): Samuel 'teer' Neal-Blim                          date: 2026.10.18
+******************************************************************************/
+
+/*
+TABLE OF CONTENTS
+=================
+I.    PLATFORM DETECTION AND INCLUDES
+      --------------------------------
+      1.  Backend feature detection
+
+II.   TYPE DEFINITIONS
+      -----------------
+      1.  Operation codes and flags
+      2.  d_aio_request  (one asynchronous operation)
+      3.  fn_aio_complete (completion callback)
+      4.  d_aio_engine   (opaque engine handle)
+
+III.  ENGINE LIFETIME
+      ----------------
+      1.  d_aio_engine_new
+      2.  d_aio_engine_free
+      3.  d_aio_backend
+
+IV.   SUBMISSION
+      -----------
+      1.  d_aio_request_init
+      2.  d_aio_submit
+      3.  d_aio_flush
+
+V.    COMPLETION
+      -----------
+      1.  d_aio_poll
+      2.  d_aio_wait
+      3.  d_aio_next
+      4.  d_aio_pending
+      5.  d_aio_attach_event_handler
+*/
+
+#ifndef DJINTERP_AIO_
+#define DJINTERP_AIO_ 1
+
+#include <stddef.h>
+#include <stdint.h>
+#include "./djinterp.h"
+#include "./dfile.h"
+#include "./event/event.h"
+
+
+// I. Platform detection and includes
+
+// D_AIO_HAS_IO_URING
+//   feature: detect if the io_uring backend can be compiled. Whether the
+// running kernel actually permits io_uring is decided at d_aio_engine_new.
+#ifndef D_AIO_HAS_IO_URING
+    #if ( defined(D_ENV_PLATFORM_LINUX) &&  \
+          defined(__has_include) )
+        #if __has_include(<linux/io_uring.h>)
+            #define D_AIO_HAS_IO_URING 1
+        #else
+            #define D_AIO_HAS_IO_URING 0
+        #endif
+    #else
+        #define D_AIO_HAS_IO_URING 0
+    #endif
+#endif
+
+// D_AIO_DEFAULT_QUEUE_DEPTH
+//   constant: submission queue depth used when d_aio_engine_new is given 0.
+#ifndef D_AIO_DEFAULT_QUEUE_DEPTH
+    #define D_AIO_DEFAULT_QUEUE_DEPTH 256
+#endif
+
+
+// II. Type definitions
+
+// operation codes for d_aio_request.op
+#define D_AIO_OP_READ   0   // pread into `buffer`
+#define D_AIO_OP_WRITE  1   // pwrite from `buffer`
+#define D_AIO_OP_FSYNC  2   // fsync `fd` (fdatasync with D_AIO_FSYNC_DATA)
+#define D_AIO_OP_OPEN   3   // open `path` with `flags`/`mode`; result is fd
+#define D_AIO_OP_CLOSE  4   // close `fd`
+
+// flags for D_AIO_OP_FSYNC
+#define D_AIO_FSYNC_DATA 0x01  // data only (fdatasync), skip metadata
+
+// backend identifiers returned by d_aio_backend
+#define D_AIO_BACKEND_THREAD_POOL 0
+#define D_AIO_BACKEND_IO_URING    1
+
+struct d_aio_request;
+
+// fn_aio_complete
+//   type: completion callback; runs on the thread calling d_aio_poll or
+// d_aio_wait. The request may be resubmitted or freed from the callback.
+typedef void (*fn_aio_complete)(struct d_aio_request* _request,
+                                void*                 _user_data);
+
+// d_aio_request
+//   struct: one asynchronous operation. The caller owns the memory and must
+// keep it (and `buffer`/`path`) alive and untouched until the request has
+// been delivered. Fill it with d_aio_request_init or by hand; only the fields
+// relevant to `op` are read.
+struct d_aio_request
+{
+    // input
+    int                   op;         // D_AIO_OP_*
+    int                   fd;         // target descriptor (not OPEN)
+    void*                 buffer;     // READ destination / WRITE source
+    size_t                length;     // bytes to transfer
+    d_off_t               offset;     // absolute file offset for READ/WRITE
+    const char*           path;       // OPEN: path to open
+    int                   flags;      // OPEN: open flags; FSYNC: D_AIO_FSYNC_*
+    int                   mode;       // OPEN: creation mode
+    fn_aio_complete       callback;   // optional completion callback
+    void*                 user_data;  // passed to `callback`
+
+    // output
+    ssize_t               result;     // bytes transferred / new fd / 0
+    int                   error;      // 0 on success, errno value on failure
+
+    // internal
+    struct d_aio_request* next;
+};
+
+// d_aio_engine
+//   type: opaque asynchronous I/O engine.
+struct d_aio_engine;
+
+// d_event_handler
+//   type: forward declaration; see event/event_handler.h.
+struct d_event_handler;
+
+
+// III. Engine lifetime
+struct d_aio_engine*  d_aio_engine_new(size_t _queue_depth,
+                                       size_t _workers);
+void                  d_aio_engine_free(struct d_aio_engine* _engine);
+int                   d_aio_backend(const struct d_aio_engine* _engine);
+
+// IV. Submission
+void                  d_aio_request_init(struct d_aio_request* _request,
+                                         int                   _op,
+                                         int                   _fd,
+                                         void*                 _buffer,
+                                         size_t                _length,
+                                         d_off_t               _offset);
+int                   d_aio_submit(struct d_aio_engine*  _engine,
+                                   struct d_aio_request* _request);
+int                   d_aio_flush(struct d_aio_engine* _engine);
+
+// V. Completion
+size_t                d_aio_poll(struct d_aio_engine* _engine,
+                                 size_t               _max);
+size_t                d_aio_wait(struct d_aio_engine* _engine,
+                                 size_t               _min,
+                                 size_t               _max);
+struct d_aio_request* d_aio_next(struct d_aio_engine* _engine);
+size_t                d_aio_pending(const struct d_aio_engine* _engine);
+int                   d_aio_attach_event_handler(struct d_aio_engine*    _engine,
+                                                 struct d_event_handler* _handler,
+                                                 d_event_id              _event_id);
+
+
+#endif  // DJINTERP_AIO_
@@ -59,6 +59,7 @@ VI.   FILE SYNCHRONIZATION
       ----------------------
       1.  d_fsync       (POSIX fsync / Windows _commit equivalent)
       2.  d_fflush      (portable fflush wrapper)
+      3.  d_fsync_dir   (make directory entry changes durable)
 
 VII.  FILE LOCKING
       -------------
@@ -111,6 +112,9 @@ XII.  PATH UTILITIES
       5.  d_basename    (extract filename from path)
       6.  d_path_join   (join path components)
       7.  d_path_exists (check if path exists)
+      8.  d_path_*_slice  (dirname/basename/extension as slices, no copy)
+      9.  d_path_*_to     (length-aware join/normalize into caller buffers)
+      10. d_path_builder  (one growable buffer reused across a tree walk)
 
 XIII. SYMBOLIC LINKS (where supported)
       ---------------------------------
@@ -122,6 +126,27 @@ XIV.  PIPE OPERATIONS
       ----------------
       1.  d_popen       (POSIX popen equivalent)
       2.  d_pclose      (POSIX pclose equivalent)
+
+XV.   BINARY I/O HELPERS
+      -------------------
+      1.  d_fread_all   (read entire file into a heap buffer)
+      2.  d_fwrite_all  (write entire buffer to file)
+      3.  d_fappend_all (append buffer to file)
+      4.  d_fwrite_all_atomic (crash-safe replace via temp + fsync + rename)
+      5.  d_fwrite_group      (batched atomic writes sharing one sync pass)
+
+XVI.  MEMORY-MAPPED FILES
+      --------------------
+      1.  d_mmap            (map an entire file)
+      2.  d_mmap_range      (map a byte range of a file)
+      3.  d_mmap_fd         (map a byte range of an open descriptor)
+      4.  d_munmap          (release a mapping)
+      5.  d_madvise         (access-pattern hint for a mapped range)
+      6.  d_mmap_prefetch   (fault a mapped range in ahead of use)
+      7.  d_msync           (write dirty pages back to the file)
+      8.  d_mmap_page_size  (offset alignment required by d_mmap_range)
+      9.  d_fread_all_view  (zero-copy, null-terminated whole-file view)
+      10. d_file_view_release
 */
 
 #ifndef DJINTERP_FILE_
@@ -194,6 +219,7 @@ XIV.  PIPE OPERATIONS
     #include <sys/file.h>
     #include <dirent.h>
     #include <libgen.h>
+    #include <sys/mman.h>
 #endif
 
 
@@ -256,6 +282,17 @@ XIV.  PIPE OPERATIONS
     #endif
 #endif
 
+// D_FILE_HAS_MMAP
+//   feature: detect if memory-mapped file I/O is available.
+#ifndef D_FILE_HAS_MMAP
+    #if ( defined(D_FILE_PLATFORM_POSIX) ||  \
+          defined(D_FILE_PLATFORM_WINDOWS) )
+        #define D_FILE_HAS_MMAP 1
+    #else
+        #define D_FILE_HAS_MMAP 0
+    #endif
+#endif
+
 
 // II. Type definitions
 
@@ -300,6 +337,59 @@ struct d_dirent_t
 //   type: opaque directory handle.
 struct d_dir_t;
 
+// d_fwrite_group
+//   type: opaque batch of staged atomic file writes (see d_fwrite_group_new).
+struct d_fwrite_group;
+
+// d_mmap_t
+//   type: memory-mapped view of a byte range of a file. `data` and `size`
+// describe exactly the range that was requested; `base` and `length` describe
+// the underlying mapping, which starts on a d_mmap_page_size() boundary.
+struct d_mmap_t
+{
+    void*   data;           // first byte of the requested range
+    size_t  size;           // length of the requested range in bytes
+    d_off_t offset;         // file offset of the requested range
+    void*   base;           // start of the mapping (aligned)
+    size_t  length;         // length of the mapping in bytes
+    int     flags;          // D_MMAP_* flags the view was created with
+#if defined(D_FILE_PLATFORM_WINDOWS)
+    HANDLE  file;           // file handle kept for d_msync (writable views)
+#endif
+};
+
+// d_file_view_t
+//   type: read-only view of an entire file, as returned by d_fread_all_view.
+// `data[size]` is always a readable '\0'; `mapped` tells whether the bytes
+// live in a file mapping or in a heap copy.
+struct d_file_view_t
+{
+    const char*     data;   // file contents, null-terminated
+    size_t          size;   // file size in bytes (excluding terminator)
+    int             mapped; // nonzero if `map` backs `data`
+    struct d_mmap_t map;    // mapping (valid only if `mapped`)
+};
+
+
+// d_path_slice
+//   type: a piece of a path given as an offset and length into the caller's
+// string; nothing is copied and the piece is not null-terminated.
+struct d_path_slice
+{
+    size_t offset;          // index of the first byte within the path
+    size_t length;          // number of bytes
+};
+
+// d_path_builder
+//   type: growable, always null-terminated path buffer. Components are pushed
+// and popped in place, so walking a tree reuses one allocation throughout.
+struct d_path_builder
+{
+    char*  data;            // current path, null-terminated
+    size_t length;          // bytes in `data`, excluding the terminator
+    size_t capacity;        // bytes allocated for `data`
+};
+
 
 // file type constants for d_dirent_t.d_type
 #ifndef DT_UNKNOWN
@@ -416,6 +506,31 @@ struct d_dir_t;
 #define D_LOCK_NB   4   // non-blocking
 #define D_LOCK_UN   8   // unlock
 
+// mapping flags for d_mmap / d_mmap_range / d_mmap_fd
+#define D_MMAP_READ       0x01  // pages may be read
+#define D_MMAP_WRITE      0x02  // pages may be written (shared with file)
+#define D_MMAP_PRIVATE    0x04  // copy-on-write; writes never reach file
+#define D_MMAP_POPULATE   0x08  // pre-fault the whole range at map time
+
+// access-pattern hints for d_madvise
+#define D_MADV_NORMAL     0     // no special treatment
+#define D_MADV_SEQUENTIAL 1     // expect sequential access (aggressive readahead)
+#define D_MADV_RANDOM     2     // expect random access (no readahead)
+#define D_MADV_WILLNEED   3     // range will be needed soon (start readahead)
+#define D_MADV_DONTNEED   4     // range not needed soon (may drop pages)
+
+// synchronization modes for d_msync
+#define D_MSYNC_ASYNC     0     // schedule write-back and return
+#define D_MSYNC_SYNC      1     // wait for write-back to reach storage
+
+// D_FILE_VIEW_MMAP_THRESHOLD
+//   constant: files smaller than this many bytes are read into a heap buffer
+// by d_fread_all_view instead of being mapped; for small files a single read
+// is cheaper than setting up and tearing down a mapping.
+#ifndef D_FILE_VIEW_MMAP_THRESHOLD
+    #define D_FILE_VIEW_MMAP_THRESHOLD (64 * 1024)
+#endif
+
 // seek origins
 #ifndef SEEK_SET
     #define SEEK_SET 0
@@ -462,6 +577,17 @@ struct d_dir_t;
     #define D_FILE_PATH_SEP_ALT  '/'
 #endif
 
+// D_PATH_BUILDER_NPOS
+//   constant: mark returned by d_path_builder_push when the buffer could not
+// grow.
+#define D_PATH_BUILDER_NPOS ((size_t)-1)
+
+// D_PATH_BUILDER_DEFAULT_CAPACITY
+//   constant: initial buffer size used when d_path_builder_init is given 0.
+#ifndef D_PATH_BUILDER_DEFAULT_CAPACITY
+    #define D_PATH_BUILDER_DEFAULT_CAPACITY 256
+#endif
+
 // III. Secure file opening
 FILE*              d_fopen(const char* _filename,
                            const char* _mode);
@@ -508,6 +634,7 @@ int                d_open(const char* _path,
 int                d_fsync(int _fd);
 int                d_fsync_stream(FILE* _stream);
 int                d_fflush(FILE* _stream);
+int                d_fsync_dir(const char* _path);
 
 // VII. File locking
 int                d_flock(int _fd,
@@ -582,6 +709,39 @@ char*              d_path_normalize(const char* _path,
                                     size_t      _bufsize);
 int                d_path_is_absolute(const char* _path);
 const char*        d_get_extension(const char* _path);
+struct d_path_slice d_path_dirname_slice(const char* _path,
+                                         size_t      _length);
+struct d_path_slice d_path_basename_slice(const char* _path,
+                                          size_t      _length);
+struct d_path_slice d_path_extension_slice(const char* _path,
+                                           size_t      _length);
+int                d_path_next_component(const char*          _path,
+                                         size_t               _length,
+                                         size_t*              _cursor,
+                                         struct d_path_slice* _component);
+size_t             d_path_join_to(char*       _buf,
+                                  size_t      _bufsize,
+                                  const char* _path1,
+                                  size_t      _length1,
+                                  const char* _path2,
+                                  size_t      _length2);
+size_t             d_path_normalize_to(const char* _path,
+                                       size_t      _length,
+                                       char*       _buf,
+                                       size_t      _bufsize);
+int                d_path_builder_init(struct d_path_builder* _builder,
+                                       size_t                 _capacity);
+void               d_path_builder_free(struct d_path_builder* _builder);
+int                d_path_builder_set(struct d_path_builder* _builder,
+                                      const char*            _path,
+                                      size_t                 _length);
+size_t             d_path_builder_push(struct d_path_builder* _builder,
+                                       const char*            _component,
+                                       size_t                 _length);
+void               d_path_builder_truncate(struct d_path_builder* _builder,
+                                           size_t                 _mark);
+int                d_path_builder_pop(struct d_path_builder* _builder);
+int                d_path_builder_normalize(struct d_path_builder* _builder);
 
 // XIII. Symbolic links
 #if D_FILE_HAS_SYMLINKS
@@ -607,6 +767,52 @@ int                d_fwrite_all(const char* _path,
 int                d_fappend_all(const char* _path,
                                  const void* _data,
                                  size_t      _size);
+int                d_fwrite_all_atomic(const char* _path,
+                                       const void* _data,
+                                       size_t      _size);
+struct d_fwrite_group* d_fwrite_group_new(void);
+int                d_fwrite_group_add(struct d_fwrite_group* _group,
+                                      const char*            _path,
+                                      const void*            _data,
+                                      size_t                 _size);
+size_t             d_fwrite_group_count(const struct d_fwrite_group* _group);
+int                d_fwrite_group_commit(struct d_fwrite_group* _group);
+void               d_fwrite_group_abort(struct d_fwrite_group* _group);
+void               d_fwrite_group_free(struct d_fwrite_group* _group);
+
+// XVI. Memory-mapped files
+#if D_FILE_HAS_MMAP
+    int            d_mmap(const char*      _path,
+                          int              _flags,
+                          struct d_mmap_t* _map);
+    int            d_mmap_range(const char*      _path,
+                                d_off_t          _offset,
+                                size_t           _length,
+                                int              _flags,
+                                struct d_mmap_t* _map);
+    int            d_mmap_fd(int              _fd,
+                             d_off_t          _offset,
+                             size_t           _length,
+                             int              _flags,
+                             struct d_mmap_t* _map);
+    int            d_munmap(struct d_mmap_t* _map);
+    int            d_madvise(const struct d_mmap_t* _map,
+                             size_t                 _offset,
+                             size_t                 _length,
+                             int                    _advice);
+    int            d_mmap_prefetch(const struct d_mmap_t* _map,
+                                   size_t                 _offset,
+                                   size_t                 _length);
+    int            d_msync(const struct d_mmap_t* _map,
+                           size_t                 _offset,
+                           size_t                 _length,
+                           int                    _mode);
+    size_t         d_mmap_page_size(void);
+#endif  // D_FILE_HAS_MMAP
+
+int                d_fread_all_view(const char*           _path,
+                                    struct d_file_view_t* _view);
+void               d_file_view_release(struct d_file_view_t* _view);
 
 
 #endif	// DJINTERP_FILE_
\ No newline at end of file
@@ -7,6 +7,9 @@
 * support, and thread-safe operations. It ensures that secure variants like
 * `sscanf_s` are available even on platforms that do not natively support
 * C11 Annex K.
+*   It also provides `d_line_reader`, a high-throughput line (record) reader
+* that yields zero-copy (pointer, length) slices into a memory mapping or a
+* large block buffer instead of copying each line like `d_fgets`.
 * 
 *
 * path:      \inc\dio.h
@@ -54,5 +57,31 @@ int     d_feof(FILE* _stream);
 int     d_ferror(FILE* _stream);
 void    d_clearerr(FILE* _stream);
 
+// VI.  line reader
+// D_LINE_READER_BLOCK_SIZE
+//   constant: bytes requested per read() in block mode; the buffer grows past
+// this only for records longer than one block.
+#ifndef D_LINE_READER_BLOCK_SIZE
+    #define D_LINE_READER_BLOCK_SIZE (256 * 1024)
+#endif
+
+// flags for d_line_reader_open / _from_fd / _from_memory
+#define D_LINE_READER_KEEP_EOL 0x01  // keep the delimiter (and CR) in slices
+#define D_LINE_READER_NO_MMAP  0x02  // always use block reads
+#define D_LINE_READER_OWN_FD   0x04  // _from_fd: close the fd on free
+
+// d_line_reader
+//   type: opaque line reader; see d_line_reader_next.
+struct d_line_reader;
+
+struct d_line_reader* d_line_reader_open(const char* _path, int _flags);
+struct d_line_reader* d_line_reader_from_fd(int _fd, int _flags);
+struct d_line_reader* d_line_reader_from_memory(const char* _data, size_t _size, int _flags);
+void    d_line_reader_set_delimiter(struct d_line_reader* _reader, char _delimiter);
+int     d_line_reader_next(struct d_line_reader* _reader, const char** _line, size_t* _length);
+size_t  d_line_reader_line_number(const struct d_line_reader* _reader);
+bool    d_line_reader_is_mapped(const struct d_line_reader* _reader);
+void    d_line_reader_free(struct d_line_reader* _reader);
+
 
 #endif  // DJINTERP_IO_
\ No newline at end of file
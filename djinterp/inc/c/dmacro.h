@@ -1642,7 +1642,7 @@ XIII. COMPILE-TIME ASSERTIONS
 // Usage: D_FOR_EACH(fn, a, b, c) -> fn(a) fn(b) fn(c)
 #define D_FOR_EACH(_fn, ...)                                                \
     D_CONCAT(D_INTERNAL_FOR_EACH_SEPARATOR_,                                \
-             D_VARG_COUNT(__VA_ARGS__))(_fn, D_EMPTY, __VA_ARGS__)
+             D_VARG_COUNT(__VA_ARGS__))(_fn, D_EMPTY(), __VA_ARGS__)
 
 // D_FOR_EACH_SPACE
 //   macro: alias for D_FOR_EACH (space/no separator).
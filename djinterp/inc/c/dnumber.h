@@ -0,0 +1,117 @@
+/******************************************************************************
+* djinterp [core]                                                    dnumber.h
+*
+* Locale-independent conversion between numbers and text.
+*   The d_fmt_* functions write a number into a caller buffer without going
+* through the printf family. Integers are sized up front from their bit width
+* and emitted two digits at a time from a digit-pair table; doubles are written
+* in the shortest form that reads back to the same value, using the Ryu
+* algorithm. Output never depends on the current locale, so the decimal point
+* is always '.'.
+*   These are the building blocks behind the typed append functions of
+* `d_string` and `d_text_buffer`, and are meant for emitters that format very
+* large quantities of numbers.
+*   The d_parse_* functions go the other way. They read a number from a
+* (pointer, length) span that need not be null-terminated and report how many
+* characters they consumed. Digits are validated and converted eight at a
+* time in a 64-bit register (SWAR). Doubles are rounded correctly with the
+* Eisel-Lemire algorithm, falling back to an exact stack-allocated decimal in
+* the rare cases it cannot decide. Nothing is allocated and the locale is
+* never consulted.
+*
+* path:      \inc\dnumber.h
+* link:      TBA
+* author(s): Samuel 'teer' Neal-Blim                          date: 2026.10.18
+******************************************************************************/
+
+/*
+TABLE OF CONTENTS
+=================
+I.    CONFIGURATION
+      --------------
+      1.  D_NUMBER_HAS_INT128
+      2.  Buffer sizes
+
+II.   INTEGER FORMATTING
+      -------------------
+      1.  d_fmt_uint32
+      2.  d_fmt_int32
+      3.  d_fmt_uint64
+      4.  d_fmt_int64
+      5.  d_fmt_hex64
+
+III.  FLOATING-POINT FORMATTING
+      --------------------------
+      1.  d_fmt_double
+
+IV.   INTEGER PARSING
+      ----------------
+      1.  d_parse_uint64
+      2.  d_parse_int64
+
+V.    FLOATING-POINT PARSING
+      -----------------------
+      1.  d_parse_double
+*/
+
+#ifndef DJINTERP_NUMBER_
+#define DJINTERP_NUMBER_ 1
+
+#include <stddef.h>
+#include <stdint.h>
+#include "./djinterp.h"
+
+
+// I. Configuration
+
+// D_NUMBER_HAS_INT128
+//   feature: use the compiler's native 128-bit integer for the wide multiplies
+// in d_fmt_double instead of the portable 64x64 fallback.
+#ifndef D_NUMBER_HAS_INT128
+    #if defined(__SIZEOF_INT128__)
+        #define D_NUMBER_HAS_INT128 1
+    #else
+        #define D_NUMBER_HAS_INT128 0
+    #endif
+#endif
+
+// D_FMT_INT_BUFFER_SIZE
+//   constant: buffer size that holds any formatted 64-bit integer, including
+// the sign and the null terminator ("-9223372036854775808").
+#define D_FMT_INT_BUFFER_SIZE    21
+
+// D_FMT_HEX_BUFFER_SIZE
+//   constant: buffer size that holds any formatted 64-bit hex value plus the
+// null terminator.
+#define D_FMT_HEX_BUFFER_SIZE    17
+
+// D_FMT_DOUBLE_BUFFER_SIZE
+//   constant: buffer size that holds any output of d_fmt_double plus the null
+// terminator ("-2.2250738585072014e-308").
+#define D_FMT_DOUBLE_BUFFER_SIZE 25
+
+
+// II. Integer formatting
+//   Each function writes the value followed by a null terminator and returns
+// the number of characters written, not counting the terminator.
+size_t d_fmt_uint32(char* _buffer, uint32_t _value);
+size_t d_fmt_int32(char* _buffer, int32_t _value);
+size_t d_fmt_uint64(char* _buffer, uint64_t _value);
+size_t d_fmt_int64(char* _buffer, int64_t _value);
+size_t d_fmt_hex64(char* _buffer, uint64_t _value, bool _uppercase);
+
+// III. Floating-point formatting
+size_t d_fmt_double(char* _buffer, double _value);
+
+// IV. Integer parsing
+//   Each function returns the number of characters consumed, or 0 with errno
+// set (EINVAL: no number, ERANGE: out of range); the value is only written on
+// success.
+size_t d_parse_uint64(const char* _text, size_t _length, uint64_t* _value);
+size_t d_parse_int64(const char* _text, size_t _length, int64_t* _value);
+
+// V. Floating-point parsing
+size_t d_parse_double(const char* _text, size_t _length, double* _value);
+
+
+#endif  // DJINTERP_NUMBER_
@@ -0,0 +1,198 @@
+/******************************************************************************
+* djinterp [core]                                                  dstatcache.h
+*
+* Cached file metadata queries.
+*   A d_stat_cache answers the questions of `dfile.h` section IX (d_stat,
+* d_lstat, d_file_exists, d_is_file, d_is_dir, d_is_symlink) from memory
+* after the first time a path is asked about. Entries are keyed by the path
+* as d_path_normalize writes it, so "src/./a.c" and "src//a.c" share one
+* entry. Failed lookups are cached too: "does this header exist?" is the most
+* common question a dependency scanner asks, and the answer is usually no.
+*   Entries go stale in three ways, which may be combined:
+*   - by age, when the cache is created with a TTL;
+*   - by generation, when d_stat_cache_invalidate_all is called, which costs
+*     O(1) regardless of how many entries are cached;
+*   - by watching (Linux), where an inotify watch on each directory holding a
+*     cached path invalidates entries as the kernel reports changes.
+*   d_stat_cache_stat_batch resolves many paths at once. Its misses are
+* grouped by directory and stat'ed relative to one open descriptor per
+* directory, using statx where the kernel offers it, so each directory prefix
+* is walked once rather than once per path.
+*   Relative paths are cached as given, so a cache must be invalidated after
+* the working directory changes. Every function also accepts a NULL cache and
+* then behaves exactly like its uncached `dfile.h` counterpart.
+*
+* path:      \inc\dstatcache.h
+* link:      TBA
+* author(s): Samuel 'teer' Neal-Blim                          date: 2026.10.18
+******************************************************************************/
+
+/*
+TABLE OF CONTENTS
+=================
+I.    CONFIGURATION
+      --------------
+      1.  D_STAT_CACHE_HAS_STATX
+      2.  D_STAT_CACHE_HAS_INOTIFY
+      3.  D_STAT_CACHE_DEFAULT_MAX_ENTRIES
+      4.  Flags
+
+II.   TYPE DEFINITIONS
+      -----------------
+      1.  d_stat_cache          (opaque cache handle)
+      2.  d_stat_cache_options  (cache configuration)
+      3.  d_stat_cache_result   (one batch result)
+      4.  d_stat_cache_stats    (hit/miss counters)
+
+III.  CACHE LIFETIME
+      ---------------
+      1.  d_stat_cache_new
+      2.  d_stat_cache_free
+      3.  d_stat_cache_is_watching
+
+IV.   QUERIES
+      --------
+      1.  d_stat_cache_stat
+      2.  d_stat_cache_lstat
+      3.  d_stat_cache_file_exists
+      4.  d_stat_cache_is_file
+      5.  d_stat_cache_is_dir
+      6.  d_stat_cache_is_symlink
+      7.  d_stat_cache_stat_batch
+
+V.    INVALIDATION AND STATISTICS
+      ----------------------------
+      1.  d_stat_cache_invalidate
+      2.  d_stat_cache_invalidate_all
+      3.  d_stat_cache_get_stats
+*/
+
+#ifndef DJINTERP_STAT_CACHE_
+#define DJINTERP_STAT_CACHE_ 1
+
+#include <stddef.h>
+#include <stdint.h>
+#include "./djinterp.h"
+#include "./dfile.h"
+
+
+// I. Configuration
+
+// D_STAT_CACHE_HAS_STATX
+//   feature: resolve misses with the statx system call, which takes a
+// directory descriptor and asks only for the fields d_stat_t needs.
+#ifndef D_STAT_CACHE_HAS_STATX
+    #if defined(D_ENV_PLATFORM_LINUX)
+        #define D_STAT_CACHE_HAS_STATX 1
+    #else
+        #define D_STAT_CACHE_HAS_STATX 0
+    #endif
+#endif
+
+// D_STAT_CACHE_HAS_INOTIFY
+//   feature: detect if D_STAT_CACHE_WATCH can be honoured. Whether the
+// running kernel grants an inotify instance is decided at d_stat_cache_new.
+#ifndef D_STAT_CACHE_HAS_INOTIFY
+    #if ( defined(D_ENV_PLATFORM_LINUX) &&  \
+          defined(__has_include) )
+        #if __has_include(<sys/inotify.h>)
+            #define D_STAT_CACHE_HAS_INOTIFY 1
+        #else
+            #define D_STAT_CACHE_HAS_INOTIFY 0
+        #endif
+    #else
+        #define D_STAT_CACHE_HAS_INOTIFY 0
+    #endif
+#endif
+
+// D_STAT_CACHE_DEFAULT_MAX_ENTRIES
+//   constant: entry limit used when d_stat_cache_options.max_entries is 0.
+#ifndef D_STAT_CACHE_DEFAULT_MAX_ENTRIES
+    #define D_STAT_CACHE_DEFAULT_MAX_ENTRIES (1024 * 1024)
+#endif
+
+// flags for d_stat_cache_options.flags
+#define D_STAT_CACHE_WATCH        0x01  // invalidate through inotify (Linux)
+#define D_STAT_CACHE_NO_NEGATIVE  0x02  // do not cache failed lookups
+
+
+// II. Type definitions
+
+// d_stat_cache
+//   type: opaque metadata cache. All functions may be called concurrently;
+// hits only take a shared lock.
+struct d_stat_cache;
+
+// d_stat_cache_options
+//   struct: cache configuration; a zeroed struct (or NULL) keeps entries
+// until they are invalidated explicitly.
+//   With D_STAT_CACHE_WATCH and no TTL, an entry whose directory cannot be
+// watched (watch limit reached, directory missing) is not cached at all; with
+// a TTL it simply falls back to expiring by age. Watching covers changes made
+// inside the directories on a cached path; a change to a symlink target that
+// lives elsewhere is only seen through the TTL or explicit invalidation.
+struct d_stat_cache_options
+{
+    uint64_t ttl_ns;        // entry lifetime in nanoseconds; 0 = no expiry
+    size_t   max_entries;   // 0 = D_STAT_CACHE_DEFAULT_MAX_ENTRIES
+    int      flags;         // D_STAT_CACHE_* flags
+};
+
+// d_stat_cache_result
+//   struct: outcome of one path in d_stat_cache_stat_batch.
+struct d_stat_cache_result
+{
+    struct d_stat_t st;     // valid when error == 0
+    int             error;  // 0, or the errno of the failed stat
+};
+
+// d_stat_cache_stats
+//   struct: counters accumulated since d_stat_cache_new.
+struct d_stat_cache_stats
+{
+    uint64_t hits;          // queries answered from memory
+    uint64_t misses;        // queries that had to ask the filesystem
+    uint64_t syscalls;      // stat system calls issued for misses
+    uint64_t invalidations; // entries dropped by watch events or by path
+    size_t   entries;       // paths currently held
+    size_t   watches;       // directories currently watched
+};
+
+
+// III. Cache lifetime
+struct d_stat_cache* d_stat_cache_new(const struct d_stat_cache_options* _options);
+void                 d_stat_cache_free(struct d_stat_cache* _cache);
+bool                 d_stat_cache_is_watching(const struct d_stat_cache* _cache);
+
+// IV. Queries
+//   Each query mirrors the `dfile.h` function of the same name; a cached
+// failure is reported with the errno the original call produced.
+int    d_stat_cache_stat(struct d_stat_cache* _cache,
+                         const char*          _path,
+                         struct d_stat_t*     _buf);
+int    d_stat_cache_lstat(struct d_stat_cache* _cache,
+                          const char*          _path,
+                          struct d_stat_t*     _buf);
+int    d_stat_cache_file_exists(struct d_stat_cache* _cache,
+                                const char*          _path);
+int    d_stat_cache_is_file(struct d_stat_cache* _cache,
+                            const char*          _path);
+int    d_stat_cache_is_dir(struct d_stat_cache* _cache,
+                           const char*          _path);
+int    d_stat_cache_is_symlink(struct d_stat_cache* _cache,
+                               const char*          _path);
+size_t d_stat_cache_stat_batch(struct d_stat_cache*        _cache,
+                               const char* const*          _paths,
+                               size_t                      _count,
+                               bool                        _follow_links,
+                               struct d_stat_cache_result* _results);
+
+// V. Invalidation and statistics
+void   d_stat_cache_invalidate(struct d_stat_cache* _cache,
+                               const char*          _path);
+void   d_stat_cache_invalidate_all(struct d_stat_cache* _cache);
+void   d_stat_cache_get_stats(struct d_stat_cache*       _cache,
+                              struct d_stat_cache_stats* _stats);
+
+
+#endif  // DJINTERP_STAT_CACHE_
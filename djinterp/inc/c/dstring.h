@@ -7,6 +7,9 @@
 * modifications.
 *   Provides cross-platform string operations mirroring `string_fn.h` but
 * operating on d_string types.
+*   Numbers can be appended through the printf-style
+* `d_string_append_formatted` or through the typed `d_string_append_int`
+* family, which formats straight into the string's storage via `dnumber.h`.
 *
 *
 * path:      \inc\dstring.h
@@ -24,6 +27,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include "./djinterp.h"
+#include "./dnumber.h"
 #include "./string_fn.h"
 
 
@@ -148,6 +152,11 @@ bool             d_string_append_cstr(struct d_string* _string, const char* _cst
 bool             d_string_append_buffer(struct d_string* _string, const char* _buffer, size_t _length);
 bool             d_string_append_char(struct d_string* _string, char _c);
 bool             d_string_append_formatted(struct d_string* _string, const char* _format, ...);
+//   typed append (locale-independent, no format string parsing)
+bool             d_string_append_int(struct d_string* _string, int64_t _value);
+bool             d_string_append_uint(struct d_string* _string, uint64_t _value);
+bool             d_string_append_hex(struct d_string* _string, uint64_t _value);
+bool             d_string_append_double(struct d_string* _string, double _value);
 // prepend
 bool             d_string_prepend(struct d_string* _string, const struct d_string* _other);
 bool             d_string_prepend_cstr(struct d_string* _string, const char* _cstr);
@@ -0,0 +1,175 @@
+/******************************************************************************
+* djinterp [core]                                                      dwalk.h
+*
+* Parallel recursive directory walker.
+*   d_dir_walk visits every entry below a root directory, optionally on several
+* threads. Workers own a deque of pending directories and steal from each
+* other when they run dry, so wide and deep trees both keep every thread busy.
+* Entry types come from the directory listing itself (d_type from getdents64
+* on Linux, find data on Windows); a stat is issued only when the filesystem
+* reports DT_UNKNOWN, and then relative to the open directory. Directories
+* are opened with openat relative to the root descriptor, so the root prefix
+* is resolved once rather than once per directory.
+*   Results are delivered through a visitor callback or gathered into a
+* d_dir_walk_result. Include/exclude glob filters prune the walk before any
+* entry reaches the caller.
+*
+* path:      \inc\dwalk.h
+* link:      TBA
+* author(s): Samuel 'teer' Neal-Blim                          date: 2026.10.18
+******************************************************************************/
+
+/*
+TABLE OF CONTENTS
+=================
+I.    CONFIGURATION
+      --------------
+      1.  D_DIR_WALK_HAS_GETDENTS
+      2.  Flags and visitor return codes
+
+II.   TYPE DEFINITIONS
+      -----------------
+      1.  d_dir_walk_entry   (entry passed to the visitor)
+      2.  fn_dir_walk_visit  (visitor callback)
+      3.  fn_dir_walk_error  (error callback)
+      4.  d_dir_walk_options (walk configuration)
+      5.  d_dir_walk_item    (collected entry)
+      6.  d_dir_walk_result  (collected entries)
+
+III.  WALKING
+      --------
+      1.  d_dir_walk
+      2.  d_dir_walk_collect
+      3.  d_dir_walk_result_free
+
+IV.   PATTERN MATCHING
+      -----------------
+      1.  d_dir_walk_glob_match
+*/
+
+#ifndef DJINTERP_DIR_WALK_
+#define DJINTERP_DIR_WALK_ 1
+
+#include <stddef.h>
+#include <stdint.h>
+#include "./djinterp.h"
+#include "./dfile.h"
+
+
+// I. Configuration
+
+// D_DIR_WALK_HAS_GETDENTS
+//   feature: read directories with the raw getdents64 system call into a
+// per-worker buffer instead of going through readdir.
+#ifndef D_DIR_WALK_HAS_GETDENTS
+    #if defined(D_ENV_PLATFORM_LINUX)
+        #define D_DIR_WALK_HAS_GETDENTS 1
+    #else
+        #define D_DIR_WALK_HAS_GETDENTS 0
+    #endif
+#endif
+
+// D_DIR_WALK_BUFFER_SIZE
+//   constant: per-worker getdents64 buffer size in bytes.
+#ifndef D_DIR_WALK_BUFFER_SIZE
+    #define D_DIR_WALK_BUFFER_SIZE (64 * 1024)
+#endif
+
+// flags for d_dir_walk_options.flags
+#define D_DIR_WALK_NO_FILES     0x01  // do not report non-directory entries
+#define D_DIR_WALK_NO_DIRS      0x02  // do not report directories (still walked)
+#define D_DIR_WALK_SKIP_HIDDEN  0x04  // ignore names starting with '.'
+#define D_DIR_WALK_SORT         0x08  // d_dir_walk_collect: sort items by path
+
+// visitor return codes
+#define D_DIR_WALK_CONTINUE     0     // keep walking
+#define D_DIR_WALK_SKIP         1     // do not descend into this directory
+#define D_DIR_WALK_STOP         2     // abandon the whole walk
+
+
+// II. Type definitions
+
+// d_dir_walk_entry
+//   struct: one entry found by the walk. All strings point into a worker
+// buffer and are only valid for the duration of the visitor call.
+struct d_dir_walk_entry
+{
+    const char* path;       // root + '/' + relative
+    size_t      path_len;   // strlen(path)
+    const char* relative;   // path below the root (points into `path`)
+    const char* name;       // final component (points into `path`)
+    uint64_t    ino;        // inode number (0 where unavailable)
+    size_t      depth;      // 1 for direct children of the root
+    uint8_t     type;       // DT_* constant
+};
+
+// fn_dir_walk_visit
+//   type: visitor callback; returns D_DIR_WALK_CONTINUE, _SKIP or _STOP. With
+// more than one thread it is called concurrently from the worker threads.
+typedef int (*fn_dir_walk_visit)(const struct d_dir_walk_entry* _entry,
+                                 void*                          _user_data);
+
+// fn_dir_walk_error
+//   type: called when a directory below the root cannot be read; the walk
+// skips it and continues. Same threading rules as fn_dir_walk_visit.
+typedef void (*fn_dir_walk_error)(const char* _path,
+                                  int         _error,
+                                  void*       _user_data);
+
+// d_dir_walk_options
+//   struct: walk configuration; a zeroed struct (or NULL) walks everything on
+// as many threads as the hardware offers.
+//   Patterns containing '/' are matched against the relative path, others
+// against the entry name. A directory matching an exclude pattern is pruned;
+// include patterns, when present, select which non-directory entries are
+// reported (directories are always traversed).
+struct d_dir_walk_options
+{
+    size_t             threads;         // 0 = hardware concurrency, 1 = serial
+    size_t             max_depth;       // 0 = unlimited
+    int                flags;           // D_DIR_WALK_* flags
+    const char* const* include;         // glob patterns (may be NULL)
+    size_t             include_count;
+    const char* const* exclude;         // glob patterns (may be NULL)
+    size_t             exclude_count;
+    fn_dir_walk_error  on_error;        // optional
+};
+
+// d_dir_walk_item
+//   struct: one collected entry; `path` is owned by the result.
+struct d_dir_walk_item
+{
+    const char* path;
+    uint64_t    ino;
+    uint32_t    depth;
+    uint8_t     type;
+};
+
+// d_dir_walk_result
+//   struct: entries gathered by d_dir_walk_collect. Items are in no
+// particular order unless D_DIR_WALK_SORT was given.
+struct d_dir_walk_result
+{
+    struct d_dir_walk_item* items;
+    size_t                  count;
+    size_t                  errors;     // unreadable directories skipped
+    char*                   strings;    // storage for every item path
+};
+
+
+// III. Walking
+int  d_dir_walk(const char*                      _root,
+                const struct d_dir_walk_options* _options,
+                fn_dir_walk_visit                _visit,
+                void*                            _user_data);
+int  d_dir_walk_collect(const char*                      _root,
+                        const struct d_dir_walk_options* _options,
+                        struct d_dir_walk_result*        _result);
+void d_dir_walk_result_free(struct d_dir_walk_result* _result);
+
+// IV. Pattern matching
+bool d_dir_walk_glob_match(const char* _pattern,
+                           const char* _text);
+
+
+#endif  // DJINTERP_DIR_WALK_
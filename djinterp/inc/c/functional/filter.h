@@ -12,6 +12,13 @@
 * consumes fn_predicate function pointers and d_predicate_{and,or,not,xor}
 * combinators rather than reimplementing its own expression tree.
 *
+*   Chains made only of predicate operations (where / where_not) keep or
+* drop each element independently. They are evaluated straight into a
+* `d_bitset` of input positions (d_filter_get_bitset), and the union,
+* intersection and difference combinators then run as OR, AND and AND-NOT
+* on those bitsets instead of copying elements and matching them back to
+* the input by bytes.
+*
 * DESIGN PHILOSOPHY:
 *   - Operations are composable (can be chained sequentially)
 *   - Operations are combinable (via union/intersection/difference)
@@ -83,7 +90,7 @@ VI.   EXECUTION AND APPLICATION
       2.  Apply filter chain
       3.  Apply combinators
       4.  Counting and querying
-      5.  Index retrieval
+      5.  Index and bitset retrieval
       6.  In-place filtering
       7.  Result management
 
@@ -135,6 +142,7 @@ XI.   TYPED FILTER WRAPPERS (C11+)
 #include "../dmemory.h"
 #include "../dio.h"
 #include "./functional.h"
+#include "../container/bitset/bitset.h"
 
 // D_FILTER_MAX_CHAIN_LENGTH
 //   constant: maximum number of operations in a filter chain.
@@ -405,6 +413,9 @@ size_t* d_filter_get_indices(const struct d_filter_chain* _chain,
                               const void* _input, size_t _count,
                               size_t _element_size,
                               size_t* _out_count);
+struct d_bitset* d_filter_get_bitset(const struct d_filter_chain* _chain,
+                                     const void* _input, size_t _count,
+                                     size_t _element_size);
 
 // vi.   in-place filtering (modifies original array)
 size_t d_filter_apply_in_place(const struct d_filter_chain* _chain,
@@ -129,9 +129,9 @@ enum DTestSessionOption
     D_TEST_SESSION_OPT_SHUFFLE          = 0x05,  // randomize test order (bool)
     D_TEST_SESSION_OPT_SHUFFLE_SEED     = 0x06,  // random seed (unsigned int)
     
-    // parallelization (future)
-    D_TEST_SESSION_OPT_PARALLEL         = 0x07,  // run in parallel (bool)
-    D_TEST_SESSION_OPT_PARALLEL_WORKERS = 0x08,  // worker count (size_t)
+    // parallelization
+    D_TEST_SESSION_OPT_PARALLEL         = 0x07,  // run modules in parallel (bool)
+    D_TEST_SESSION_OPT_PARALLEL_WORKERS = 0x08,  // worker count, 0 = all cores (size_t)
     
     // output control
     D_TEST_SESSION_OPT_OUTPUT_FORMAT    = 0x10,  // DTestOutputFormat
@@ -191,6 +191,7 @@ enum DTestVerbosity
 #define D_TEST_SESSION_DEFAULT_OUTPUT_FORMAT D_TEST_OUTPUT_CONSOLE
 #define D_TEST_SESSION_DEFAULT_REPEAT_COUNT  1
 #define D_TEST_SESSION_DEFAULT_TIMEOUT_MS    0  // 0 = no timeout
+#define D_TEST_SESSION_DEFAULT_PARALLEL_WORKERS 0  // 0 = hardware concurrency
 
 
 /******************************************************************************
@@ -100,6 +100,20 @@
 // tracked for the end-of-run failure summary.
 #define D_TEST_SA_MAX_FAILURES 512
 
+// D_TEST_SA_HAS_ISOLATION
+//   feature: whether the runner can execute modules in isolated child
+// processes (requires fork/pipe/poll; POSIX only). When unavailable, a
+// non-zero `jobs` option falls back to in-process execution.
+#ifndef D_TEST_SA_HAS_ISOLATION
+    #if ( defined(__unix__)  ||                                              \
+          defined(__APPLE__) ) &&                                            \
+        !defined(_WIN32)
+        #define D_TEST_SA_HAS_ISOLATION 1
+    #else
+        #define D_TEST_SA_HAS_ISOLATION 0
+    #endif
+#endif
+
 
 /******************************************************************************
  * TEST OBJECT
@@ -137,6 +151,8 @@ struct d_test_sa_options
     bool        show_module_footer;  // display per-module result footer
     bool        list_failures;       // print failure summary at end
     const char* output_file;         // path to output file, NULL = none
+    size_t      jobs;                // isolated worker processes, 0 = in-process
+    size_t      timeout_ms;          // per-module limit when isolated, 0 = none
 };
 
 
@@ -151,6 +167,7 @@ struct d_test_sa_failure_entry
     const char* module_name;
     const char* test_name;
     const char* message;
+    bool        owned;        // test_name/message are heap copies
 };
 
 // d_test_sa_failure_list
@@ -435,6 +452,10 @@ void d_test_sa_failure_list_add(struct d_test_sa_failure_list* _list,
                                 const char*                    _module,
                                 const char*                    _name,
                                 const char*                    _message);
+void d_test_sa_failure_list_add_copy(struct d_test_sa_failure_list* _list,
+                                     const char*                    _module,
+                                     const char*                    _name,
+                                     const char*                    _message);
 void d_test_sa_failure_list_print(
          const struct d_test_sa_failure_list* _list);
 void d_test_sa_failure_list_print_file(
@@ -24,8 +24,8 @@
 #include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
-#include "../../djinterp.h"
-#include "../../string_fn.h"
+#include "../djinterp.h"
+#include "../string_fn.h"
 
 
 // D_DEFAULT_TEXT_BUFFER_SIZE
@@ -14,11 +14,6 @@
 
 #include <math.h>
 #include <stdarg.h>
-#include <stdlib.h>
-#include "..\..\djinterp.h"
-#include "..\..\dmemory.h"
-
-
 #include <stdlib.h>
 #include "..\djinterp.h"
 #include "..\dmemory.h"
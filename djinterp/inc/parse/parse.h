@@ -17,6 +17,8 @@
 *   - Composable parser combinators (when C++14+)
 *   - Lookahead and backtracking support
 *   - Memory-efficient parsing with minimal allocations
+*   - Bulk, table-driven character-class scanning (SIMD where available)
+*   - Opt-in packrat memoization with a bounded, position-windowed cache
 *
 * 
 * path:      \inc\parse\parse.h
@@ -29,6 +31,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <iterator>
 #include <limits>
 #include <type_traits>
@@ -42,6 +45,7 @@
 #if D_ENV_LANG_IS_CPP11_OR_HIGHER
     #include <tuple>
     #include <memory>
+    #include <vector>
 #endif
 
 #if D_ENV_LANG_IS_CPP17_OR_HIGHER
@@ -73,6 +77,23 @@
     #define D_CFG_PARSE_MAX_LOOKAHEAD 64
 #endif
 
+// D_CFG_PARSE_MEMO_WINDOW
+//   configuration: number of input positions, counted back from the furthest
+// position reached, for which packrat memo entries are retained. Memory per
+// memoized parser is bounded by this many entries regardless of input
+// length. Rounded up to a power of two.
+#ifndef D_CFG_PARSE_MEMO_WINDOW
+    #define D_CFG_PARSE_MEMO_WINDOW 256
+#endif
+
+// D_CFG_PARSE_ENABLE_MEMOIZATION
+//   configuration: enable packrat memoization for parsers wrapped with
+// memo(); when disabled, memo() parsers forward directly to the wrapped
+// parser.
+#ifndef D_CFG_PARSE_ENABLE_MEMOIZATION
+    #define D_CFG_PARSE_ENABLE_MEMOIZATION 1
+#endif
+
 // D_CFG_PARSE_ENABLE_SOURCE_TRACKING
 //   configuration: enable line/column tracking (slight performance cost).
 #ifndef D_CFG_PARSE_ENABLE_SOURCE_TRACKING
@@ -85,6 +106,24 @@
     #define D_CFG_PARSE_ENABLE_ERROR_RECOVERY 1
 #endif
 
+// D_CFG_PARSE_ENABLE_SIMD
+//   configuration: use SIMD kernels for bulk character-class scanning when
+// the target supports them (scalar lookup tables are used otherwise).
+#ifndef D_CFG_PARSE_ENABLE_SIMD
+    #define D_CFG_PARSE_ENABLE_SIMD 1
+#endif
+
+#if ( D_CFG_PARSE_ENABLE_SIMD && D_ENV_C_HAS_AVX2 )
+    #define D_PARSE_SIMD_AVX2 1
+    #include <immintrin.h>
+#else
+    #define D_PARSE_SIMD_AVX2 0
+#endif
+
+#if defined(_MSC_VER)
+    #include <intrin.h>
+#endif
+
 
 NS_DJINTERP
 NS_INTERNAL
@@ -274,6 +313,23 @@ template<typename _Source>
 using commit_expr = decltype(std::declval<_Source&>().commit(
                                  std::declval<typename _Source::mark_type>()));
 
+// scan_while_expr
+//   type trait (internal): expression for bulk-consuming matching elements.
+template<typename _Source,
+         typename _Predicate>
+using scan_while_expr = decltype(std::declval<_Source&>().scan_while(
+                                     std::declval<const _Predicate&>()));
+
+// data_expr
+//   type trait (internal): expression for direct access to contiguous input.
+template<typename _Source>
+using data_expr = decltype(std::declval<const _Source&>().data());
+
+// char_set_expr
+//   type trait (internal): expression for a predicate's 256-entry table.
+template<typename _Predicate>
+using char_set_expr = decltype(std::declval<const _Predicate&>().char_set());
+
 NS_END  // internal
 
 // has_read
@@ -306,6 +362,31 @@ template<typename _Source>
 struct has_position : internal::is_detected<internal::position_expr, _Source>
 {};
 
+// has_scan_while
+//   type trait: detects if _Source can consume a run of elements matching
+// _Predicate in a single call.
+template<typename _Source,
+         typename _Predicate>
+struct has_scan_while : internal::is_detected<internal::scan_while_expr,
+                                              _Source,
+                                              _Predicate>
+{};
+
+// has_contiguous_data
+//   type trait: detects if _Source exposes its remaining input as a pointer.
+template<typename _Source>
+struct has_contiguous_data : internal::is_detected<internal::data_expr,
+                                                   _Source>
+{};
+
+// has_char_set
+//   type trait: detects if _Predicate can be expressed as a precomputed
+// d_char_class::d_char_set lookup table.
+template<typename _Predicate>
+struct has_char_set : internal::is_detected<internal::char_set_expr,
+                                            _Predicate>
+{};
+
 // has_backtrack_support
 //   type trait: detects if _Source supports mark/restore for backtracking.
 template<typename _Source>
@@ -335,8 +416,54 @@ struct has_backtrack_support
 
     template<typename _Source>
     constexpr bool has_backtrack_support_v = has_backtrack_support<_Source>::value;
+
+    template<typename _Source,
+             typename _Predicate>
+    constexpr bool has_scan_while_v        = has_scan_while<_Source,
+                                                            _Predicate>::value;
+
+    template<typename _Source>
+    constexpr bool has_contiguous_data_v   = has_contiguous_data<_Source>::value;
+
+    template<typename _Predicate>
+    constexpr bool has_char_set_v          = has_char_set<_Predicate>::value;
 #endif
 
+NS_INTERNAL
+
+// is_bulk_char_scan
+//   type trait (internal): true when a source of _Element can hand runs of
+// its input to _Predicate's lookup table instead of testing one element at
+// a time.
+template<typename _Element,
+         typename _Predicate>
+struct is_bulk_char_scan
+    : std::integral_constant<bool,
+                             (sizeof(_Element) == 1) &&
+                             std::is_integral<_Element>::value &&
+                             has_char_set<_Predicate>::value>
+{};
+
+// scan_char_run
+//   function (internal): returns the length of the leading run of
+// [_first, _first + _count) that is in _predicate's set, or, when _until is
+// true, the index of the first element that is in the set.
+template<typename _Predicate>
+std::size_t
+scan_char_run
+(
+    const _Predicate& _predicate,
+    const char*       _first,
+    std::size_t       _count,
+    bool              _until
+)
+{
+    return (_until) ? _predicate.char_set().find(_first, _count)
+                    : _predicate.char_set().span(_first, _count);
+}
+
+NS_END  // internal
+
 // -----------------------------------------------------------------------------
 // II.2  Output sink detection traits
 // -----------------------------------------------------------------------------
@@ -620,6 +747,25 @@ struct d_source_location
         return;
     }
 
+    // advance_text
+    //   updates position after consuming a run of characters in one call.
+    void
+    advance_text
+    (
+        const char* _text,
+        size_type   _count
+    )
+    {
+        size_type i;
+
+        for (i = 0; i < _count; ++i)
+        {
+            advance_char(_text[i]);
+        }
+
+        return;
+    }
+
     // advance_bytes
     //   updates offset by byte count (for binary data).
     void
@@ -1193,12 +1339,14 @@ public:
     {
         iterator_type      iterator;
         d_source_location  location;
+        size_type          offset;
     };
 
 private:
     iterator_type     m_current;
     iterator_type     m_end;
     d_source_location m_location;
+    size_type         m_offset;
 
 public:
     // d_iterator_source
@@ -1208,6 +1356,7 @@ public:
         : m_current(_begin)
         , m_end(_end)
         , m_location()
+        , m_offset(0)
     {}
 
     // eof
@@ -1298,6 +1447,7 @@ public:
 #endif
 
         ++m_current;
+        ++m_offset;
 
         return;
     }
@@ -1328,6 +1478,15 @@ public:
         return m_location;
     }
 
+    // offset
+    //   returns the number of elements consumed so far (maintained even
+    // when source tracking is disabled).
+    size_type
+    offset() const
+    {
+        return m_offset;
+    }
+
     // current
     //   returns current iterator.
     iterator_type
@@ -1353,6 +1512,52 @@ public:
         return static_cast<size_type>(m_end - m_current);
     }
 
+    // data
+    //   returns pointer to current position (pointer iterators only).
+    template<typename _It = iterator_type>
+    typename std::enable_if<std::is_pointer<_It>::value, _It>::type
+    data() const
+    {
+        return m_current;
+    }
+
+    // scan_while
+    //   consumes elements while _predicate holds; returns the number
+    // consumed. Pointer ranges of single-byte elements are scanned in bulk
+    // through the predicate's lookup table when it provides one.
+    template<typename _Predicate>
+    size_type
+    scan_while
+    (
+        const _Predicate& _predicate
+    )
+    {
+        return scan_impl(_predicate,
+                         false,
+                         std::integral_constant<bool,
+                             std::is_pointer<iterator_type>::value &&
+                             internal::is_bulk_char_scan<value_type,
+                                                         _Predicate>::value>());
+    }
+
+    // skip_until
+    //   consumes elements until one satisfies _set; returns the number
+    // skipped. The matching element itself is not consumed.
+    template<typename _Predicate>
+    size_type
+    skip_until
+    (
+        const _Predicate& _set
+    )
+    {
+        return scan_impl(_set,
+                         true,
+                         std::integral_constant<bool,
+                             std::is_pointer<iterator_type>::value &&
+                             internal::is_bulk_char_scan<value_type,
+                                                         _Predicate>::value>());
+    }
+
     // mark
     //   creates a mark for later restoration.
     mark_type
@@ -1362,6 +1567,7 @@ public:
 
         result.iterator = m_current;
         result.location = m_location;
+        result.offset   = m_offset;
 
         return result;
     }
@@ -1376,6 +1582,7 @@ public:
     {
         m_current  = _mark.iterator;
         m_location = _mark.location;
+        m_offset   = _mark.offset;
 
         return;
     }
@@ -1393,6 +1600,62 @@ public:
 
         return;
     }
+
+private:
+    // scan_impl
+    //   bulk path: one table-driven scan over the remaining pointer range.
+    template<typename _Predicate>
+    size_type
+    scan_impl
+    (
+        const _Predicate& _predicate,
+        bool              _until,
+        std::true_type
+    )
+    {
+        const char* first;
+        size_type   count;
+
+        first = reinterpret_cast<const char*>(m_current);
+        count = internal::scan_char_run(_predicate,
+                                        first,
+                                        static_cast<size_type>(m_end - m_current),
+                                        _until);
+
+#if D_CFG_PARSE_ENABLE_SOURCE_TRACKING
+        m_location.advance_text(first, count);
+#endif
+
+        m_current += count;
+        m_offset  += count;
+
+        return count;
+    }
+
+    // scan_impl
+    //   generic path: tests one element at a time.
+    template<typename _Predicate>
+    size_type
+    scan_impl
+    (
+        const _Predicate& _predicate,
+        bool              _until,
+        std::false_type
+    )
+    {
+        size_type count;
+
+        count = 0;
+
+        while ( (!eof()) &&
+                (static_cast<bool>(_predicate(*m_current)) != _until) )
+        {
+            advance();
+            ++count;
+        }
+
+        return count;
+    }
 };
 
 // make_iterator_source
@@ -1432,6 +1695,7 @@ public:
     };
 
 private:
+    pointer           m_begin;
     pointer           m_current;
     pointer           m_end;
     d_source_location m_location;
@@ -1441,7 +1705,8 @@ public:
     //   constructor: creates source from pointer and size.
     d_memory_source(pointer   _data,
                     size_type _size)
-        : m_current(_data)
+        : m_begin(_data)
+        , m_current(_data)
         , m_end(_data + _size)
         , m_location()
     {}
@@ -1450,7 +1715,8 @@ public:
     //   constructor: creates source from pointer range.
     d_memory_source(pointer _begin,
                     pointer _end)
-        : m_current(_begin)
+        : m_begin(_begin)
+        , m_current(_begin)
         , m_end(_end)
         , m_location()
     {}
@@ -1571,6 +1837,15 @@ public:
         return m_location;
     }
 
+    // offset
+    //   returns the number of elements consumed so far (maintained even
+    // when source tracking is disabled).
+    size_type
+    offset() const
+    {
+        return static_cast<size_type>(m_current - m_begin);
+    }
+
     // data
     //   returns pointer to current position.
     pointer
@@ -1587,6 +1862,52 @@ public:
         return static_cast<size_type>(m_end - m_current);
     }
 
+    // scan_while
+    //   consumes elements while _predicate holds; returns the number
+    // consumed. Single-byte inputs are scanned in bulk through the
+    // predicate's lookup table (SIMD where available) when it provides one.
+    template<typename _Predicate>
+    size_type
+    scan_while
+    (
+        const _Predicate& _predicate
+    )
+    {
+        return scan_impl(_predicate,
+                         false,
+                         internal::is_bulk_char_scan<value_type, _Predicate>());
+    }
+
+    // skip_until
+    //   consumes elements until one satisfies _set; returns the number
+    // skipped. The matching element itself is not consumed.
+    template<typename _Predicate>
+    size_type
+    skip_until
+    (
+        const _Predicate& _set
+    )
+    {
+        return scan_impl(_set,
+                         true,
+                         internal::is_bulk_char_scan<value_type, _Predicate>());
+    }
+
+#if D_ENV_LANG_IS_CPP17_OR_HIGHER
+    // consumed_since
+    //   returns a zero-copy view of the input consumed since _mark.
+    std::basic_string_view<value_type>
+    consumed_since
+    (
+        const mark_type& _mark
+    ) const
+    {
+        return std::basic_string_view<value_type>(
+                   _mark.ptr,
+                   static_cast<size_type>(m_current - _mark.ptr));
+    }
+#endif
+
     // match_bytes
     //   attempts to match a sequence of bytes.
     bool
@@ -1659,6 +1980,61 @@ public:
 
         return;
     }
+
+private:
+    // scan_impl
+    //   bulk path: one table-driven scan over the remaining input.
+    template<typename _Predicate>
+    size_type
+    scan_impl
+    (
+        const _Predicate& _predicate,
+        bool              _until,
+        std::true_type
+    )
+    {
+        const char* first;
+        size_type   count;
+
+        first = reinterpret_cast<const char*>(m_current);
+        count = internal::scan_char_run(_predicate,
+                                        first,
+                                        remaining(),
+                                        _until);
+
+#if D_CFG_PARSE_ENABLE_SOURCE_TRACKING
+        m_location.advance_text(first, count);
+#endif
+
+        m_current += count;
+
+        return count;
+    }
+
+    // scan_impl
+    //   generic path: tests one element at a time.
+    template<typename _Predicate>
+    size_type
+    scan_impl
+    (
+        const _Predicate& _predicate,
+        bool              _until,
+        std::false_type
+    )
+    {
+        size_type count;
+
+        count = 0;
+
+        while ( (!eof()) &&
+                (static_cast<bool>(_predicate(*m_current)) != _until) )
+        {
+            advance();
+            ++count;
+        }
+
+        return count;
+    }
 };
 
 // make_memory_source
@@ -1707,6 +2083,22 @@ make_memory_source
 }
 #endif
 
+#if D_ENV_LANG_IS_CPP20_OR_HIGHER
+// make_memory_source (span overload)
+//   factory: creates a zero-copy memory source over a span.
+template<typename _T,
+         std::size_t _Extent>
+d_memory_source<typename std::remove_cv<_T>::type>
+make_memory_source
+(
+    std::span<_T, _Extent> _span
+)
+{
+    return d_memory_source<typename std::remove_cv<_T>::type>(_span.data(),
+                                                              _span.size());
+}
+#endif
+
 
 // =============================================================================
 // VI.  OUTPUT SINK ADAPTERS
@@ -2174,6 +2566,14 @@ public:
 
         return parse_result::make_success(current);
     }
+
+    // predicate
+    //   returns the predicate tested against each element.
+    const predicate_type&
+    predicate() const
+    {
+        return m_predicate;
+    }
 };
 
 // satisfy
@@ -2338,72 +2738,485 @@ failure
 // IX.  CHARACTER CLASS PARSERS
 // =============================================================================
 
+// -----------------------------------------------------------------------------
+// IX.1 Character set lookup table
+// -----------------------------------------------------------------------------
+
 // d_char_class
 //   namespace: contains character classification predicates.
 namespace d_char_class
 {
-    // is_digit
-    //   predicate: returns true for ASCII digits ('0'-'9').
-    struct is_digit
+    // d_char_set
+    //   class: precomputed 256-bit membership table for byte-sized
+    // characters. Testing a character is a single shift-and-mask, and runs of
+    // input can be scanned in bulk with span()/find(); with AVX2 the scan
+    // classifies 32 bytes per step through a nibble-indexed shuffle lookup.
+    // A d_char_set is itself a predicate, so it can be passed to satisfy().
+    class d_char_set
     {
-        bool
-        operator()
+    private:
+        std::uint64_t m_bits[4];        // one bit per byte value
+        std::uint8_t  m_nibble_lo[16];  // bit h: (h << 4 | i) in set, h < 8
+        std::uint8_t  m_nibble_hi[16];  // bit h: (h+8 << 4 | i) in set
+        std::size_t   m_size;
+        unsigned char m_single;         // sole member when m_size == 1
+
+    public:
+        // d_char_set
+        //   constructor: creates an empty set.
+        d_char_set()
+        {
+            clear();
+        }
+
+        // d_char_set
+        //   constructor: creates a set from an explicit list of characters.
+        d_char_set(const char* _chars,
+                   std::size_t _length)
+        {
+            std::size_t i;
+
+            clear();
+
+            for (i = 0; i < _length; ++i)
+            {
+                insert(_chars[i]);
+            }
+        }
+
+        // from_range
+        //   factory: creates the set of characters _ch with
+        // _low <= _ch <= _high (compared as char, like is_in_range).
+        static d_char_set
+        from_range
         (
-            char _ch
-        ) const
+            char _low,
+            char _high
+        )
         {
-            return (_ch >= '0') && (_ch <= '9');
+            d_char_set result;
+            int        value;
+
+            for (value = 0; value < 256; ++value)
+            {
+                char ch;
+
+                ch = static_cast<char>(value);
+
+                if ( (ch >= _low) &&
+                     (ch <= _high) )
+                {
+                    result.insert(ch);
+                }
+            }
+
+            return result;
         }
-    };
 
-    // is_alpha
-    //   predicate: returns true for ASCII letters.
-    struct is_alpha
-    {
-        bool
-        operator()
+        // from_predicate
+        //   factory: precomputes an arbitrary char predicate into a table by
+        // evaluating it once for every byte value.
+        template<typename _Predicate>
+        static d_char_set
+        from_predicate
+        (
+            const _Predicate& _predicate
+        )
+        {
+            d_char_set result;
+            int        value;
+
+            for (value = 0; value < 256; ++value)
+            {
+                if (_predicate(static_cast<char>(value)))
+                {
+                    result.insert(static_cast<char>(value));
+                }
+            }
+
+            return result;
+        }
+
+        // clear
+        //   removes every character from the set.
+        void
+        clear()
+        {
+            std::memset(m_bits, 0, sizeof(m_bits));
+            std::memset(m_nibble_lo, 0, sizeof(m_nibble_lo));
+            std::memset(m_nibble_hi, 0, sizeof(m_nibble_hi));
+
+            m_size   = 0;
+            m_single = 0;
+
+            return;
+        }
+
+        // insert
+        //   adds a character to the set.
+        void
+        insert
         (
             char _ch
-        ) const
+        )
         {
-            return ( ((_ch >= 'a') && (_ch <= 'z')) ||
-                     ((_ch >= 'A') && (_ch <= 'Z')) );
+            unsigned char value;
+            unsigned int  high;
+            unsigned int  low;
+
+            value = static_cast<unsigned char>(_ch);
+
+            if (contains(_ch))
+            {
+                return;
+            }
+
+            high = static_cast<unsigned int>(value >> 4);
+            low  = static_cast<unsigned int>(value & 0x0Fu);
+
+            m_bits[value >> 6] |= (std::uint64_t{1} << (value & 63u));
+
+            if (high < 8u)
+            {
+                m_nibble_lo[low] |= static_cast<std::uint8_t>(1u << high);
+            }
+            else
+            {
+                m_nibble_hi[low] |= static_cast<std::uint8_t>(1u << (high - 8u));
+            }
+
+            m_single = value;
+            ++m_size;
+
+            return;
         }
-    };
 
-    // is_alnum
-    //   predicate: returns true for ASCII alphanumeric.
-    struct is_alnum
-    {
+        // contains
+        //   returns true if the character is in the set.
         bool
-        operator()
+        contains
         (
             char _ch
         ) const
         {
-            return ( ((_ch >= '0') && (_ch <= '9')) ||
-                     ((_ch >= 'a') && (_ch <= 'z')) ||
-                     ((_ch >= 'A') && (_ch <= 'Z')) );
+            unsigned char value;
+
+            value = static_cast<unsigned char>(_ch);
+
+            return ((m_bits[value >> 6] >> (value & 63u)) & 1u) != 0;
         }
-    };
 
-    // is_space
-    //   predicate: returns true for whitespace characters.
-    struct is_space
-    {
+        // operator()
+        //   predicate: same as contains().
         bool
         operator()
         (
             char _ch
         ) const
         {
-            return ( (_ch == ' ')  ||
-                     (_ch == '\t') ||
+            return contains(_ch);
+        }
+
+        // char_set
+        //   returns the set itself (lets a set stand in for any predicate
+        // that exposes its lookup table).
+        const d_char_set&
+        char_set() const
+        {
+            return *this;
+        }
+
+        // complement
+        //   returns the set of characters not in this set.
+        d_char_set
+        complement() const
+        {
+            d_char_set result;
+            int        value;
+
+            for (value = 0; value < 256; ++value)
+            {
+                if (!contains(static_cast<char>(value)))
+                {
+                    result.insert(static_cast<char>(value));
+                }
+            }
+
+            return result;
+        }
+
+        // size
+        //   returns the number of characters in the set.
+        std::size_t
+        size() const
+        {
+            return m_size;
+        }
+
+        // span
+        //   returns the length of the leading run of [_first, _first+_count)
+        // whose characters are all in the set.
+        std::size_t
+        span
+        (
+            const char* _first,
+            std::size_t _count
+        ) const
+        {
+            return scan(_first, _count, false);
+        }
+
+        // find
+        //   returns the index of the first character of
+        // [_first, _first+_count) that is in the set, or _count if none is.
+        std::size_t
+        find
+        (
+            const char* _first,
+            std::size_t _count
+        ) const
+        {
+            return scan(_first, _count, true);
+        }
+
+    private:
+        // scan
+        //   returns the index of the first character whose membership
+        // equals _member, or _count.
+        std::size_t
+        scan
+        (
+            const char* _first,
+            std::size_t _count,
+            bool        _member
+        ) const
+        {
+            std::size_t i;
+
+            // degenerate sets need no per-character work
+            if (m_size == 0)
+            {
+                return (_member) ? _count : 0;
+            }
+
+            if (m_size == 256)
+            {
+                return (_member) ? 0 : _count;
+            }
+
+            // a single-character search is exactly memchr
+            if ( (_member) &&
+                 (m_size == 1) )
+            {
+                const void* hit;
+
+                hit = std::memchr(_first, m_single, _count);
+
+                return (hit)
+                    ? static_cast<std::size_t>(static_cast<const char*>(hit) -
+                                               _first)
+                    : _count;
+            }
+
+            i = 0;
+
+#if D_PARSE_SIMD_AVX2
+            if (_count >= 32)
+            {
+                __m256i table_lo;
+                __m256i table_hi;
+                __m256i bit_of;
+                __m256i nibble_mask;
+                __m256i seven;
+
+                table_lo    = _mm256_broadcastsi128_si256(
+                                  _mm_loadu_si128(
+                                      reinterpret_cast<const __m128i*>(
+                                          m_nibble_lo)));
+                table_hi    = _mm256_broadcastsi128_si256(
+                                  _mm_loadu_si128(
+                                      reinterpret_cast<const __m128i*>(
+                                          m_nibble_hi)));
+                bit_of      = _mm256_setr_epi8(
+                                  1, 2, 4, 8, 16, 32, 64, -128,
+                                  1, 2, 4, 8, 16, 32, 64, -128,
+                                  1, 2, 4, 8, 16, 32, 64, -128,
+                                  1, 2, 4, 8, 16, 32, 64, -128);
+                nibble_mask = _mm256_set1_epi8(0x0F);
+                seven       = _mm256_set1_epi8(7);
+
+                for (; i + 32 <= _count; i += 32)
+                {
+                    __m256i      chunk;
+                    __m256i      low;
+                    __m256i      high;
+                    __m256i      row;
+                    __m256i      bit;
+                    __m256i      hit;
+                    std::uint32_t mask;
+
+                    chunk = _mm256_loadu_si256(
+                                reinterpret_cast<const __m256i*>(_first + i));
+                    low   = _mm256_and_si256(chunk, nibble_mask);
+                    high  = _mm256_and_si256(_mm256_srli_epi16(chunk, 4),
+                                             nibble_mask);
+
+                    // row of the table selected by the high nibble's half
+                    row   = _mm256_blendv_epi8(
+                                _mm256_shuffle_epi8(table_lo, low),
+                                _mm256_shuffle_epi8(table_hi, low),
+                                _mm256_cmpgt_epi8(high, seven));
+                    bit   = _mm256_shuffle_epi8(bit_of, high);
+                    hit   = _mm256_cmpeq_epi8(_mm256_and_si256(row, bit), bit);
+                    mask  = static_cast<std::uint32_t>(_mm256_movemask_epi8(hit));
+
+                    if (!_member)
+                    {
+                        mask = ~mask;
+                    }
+
+                    if (mask != 0)
+                    {
+                        return i + count_trailing_zeros(mask);
+                    }
+                }
+            }
+#endif
+
+            for (; i < _count; ++i)
+            {
+                if (contains(_first[i]) == _member)
+                {
+                    return i;
+                }
+            }
+
+            return _count;
+        }
+
+#if D_PARSE_SIMD_AVX2
+        // count_trailing_zeros
+        //   returns the index of the lowest set bit of a non-zero mask.
+        static std::size_t
+        count_trailing_zeros
+        (
+            std::uint32_t _mask
+        )
+        {
+#if defined(_MSC_VER)
+            unsigned long index;
+
+            _BitScanForward(&index, _mask);
+
+            return static_cast<std::size_t>(index);
+#else
+            return static_cast<std::size_t>(__builtin_ctz(_mask));
+#endif
+        }
+#endif
+    };
+
+
+// -----------------------------------------------------------------------------
+// IX.2 Character class predicates
+// -----------------------------------------------------------------------------
+//   Every predicate exposes char_set(), its precomputed d_char_set, so source
+// adapters can scan runs of matching input in bulk.
+
+    // is_digit
+    //   predicate: returns true for ASCII digits ('0'-'9').
+    struct is_digit
+    {
+        bool
+        operator()
+        (
+            char _ch
+        ) const
+        {
+            return (_ch >= '0') && (_ch <= '9');
+        }
+
+        const d_char_set&
+        char_set() const
+        {
+            static const d_char_set table = d_char_set::from_predicate(*this);
+
+            return table;
+        }
+    };
+
+    // is_alpha
+    //   predicate: returns true for ASCII letters.
+    struct is_alpha
+    {
+        bool
+        operator()
+        (
+            char _ch
+        ) const
+        {
+            return ( ((_ch >= 'a') && (_ch <= 'z')) ||
+                     ((_ch >= 'A') && (_ch <= 'Z')) );
+        }
+
+        const d_char_set&
+        char_set() const
+        {
+            static const d_char_set table = d_char_set::from_predicate(*this);
+
+            return table;
+        }
+    };
+
+    // is_alnum
+    //   predicate: returns true for ASCII alphanumeric.
+    struct is_alnum
+    {
+        bool
+        operator()
+        (
+            char _ch
+        ) const
+        {
+            return ( ((_ch >= '0') && (_ch <= '9')) ||
+                     ((_ch >= 'a') && (_ch <= 'z')) ||
+                     ((_ch >= 'A') && (_ch <= 'Z')) );
+        }
+
+        const d_char_set&
+        char_set() const
+        {
+            static const d_char_set table = d_char_set::from_predicate(*this);
+
+            return table;
+        }
+    };
+
+    // is_space
+    //   predicate: returns true for whitespace characters.
+    struct is_space
+    {
+        bool
+        operator()
+        (
+            char _ch
+        ) const
+        {
+            return ( (_ch == ' ')  ||
+                     (_ch == '\t') ||
                      (_ch == '\n') ||
                      (_ch == '\r') ||
                      (_ch == '\f') ||
                      (_ch == '\v') );
         }
+
+        const d_char_set&
+        char_set() const
+        {
+            static const d_char_set table = d_char_set::from_predicate(*this);
+
+            return table;
+        }
     };
 
     // is_hex
@@ -2420,6 +3233,14 @@ namespace d_char_class
                      ((_ch >= 'a') && (_ch <= 'f')) ||
                      ((_ch >= 'A') && (_ch <= 'F')) );
         }
+
+        const d_char_set&
+        char_set() const
+        {
+            static const d_char_set table = d_char_set::from_predicate(*this);
+
+            return table;
+        }
     };
 
     // is_upper
@@ -2434,6 +3255,14 @@ namespace d_char_class
         {
             return (_ch >= 'A') && (_ch <= 'Z');
         }
+
+        const d_char_set&
+        char_set() const
+        {
+            static const d_char_set table = d_char_set::from_predicate(*this);
+
+            return table;
+        }
     };
 
     // is_lower
@@ -2448,6 +3277,14 @@ namespace d_char_class
         {
             return (_ch >= 'a') && (_ch <= 'z');
         }
+
+        const d_char_set&
+        char_set() const
+        {
+            static const d_char_set table = d_char_set::from_predicate(*this);
+
+            return table;
+        }
     };
 
     // is_print
@@ -2462,21 +3299,28 @@ namespace d_char_class
         {
             return (_ch >= 0x20) && (_ch <= 0x7E);
         }
+
+        const d_char_set&
+        char_set() const
+        {
+            static const d_char_set table = d_char_set::from_predicate(*this);
+
+            return table;
+        }
     };
 
     // is_one_of
-    //   predicate: returns true if character is in the set.
+    //   predicate: returns true if character is in the set. The set is
+    // compiled into a lookup table once, at construction.
     class is_one_of
     {
     private:
-        const char* m_chars;
-        std::size_t m_length;
+        d_char_set m_set;
 
     public:
         is_one_of(const char* _chars,
                   std::size_t _length)
-            : m_chars(_chars)
-            , m_length(_length)
+            : m_set(_chars, _length)
         {}
 
         bool
@@ -2485,17 +3329,13 @@ namespace d_char_class
             char _ch
         ) const
         {
-            std::size_t i;
-
-            for (i = 0; i < m_length; ++i)
-            {
-                if (m_chars[i] == _ch)
-                {
-                    return true;
-                }
-            }
+            return m_set.contains(_ch);
+        }
 
-            return false;
+        const d_char_set&
+        char_set() const
+        {
+            return m_set;
         }
     };
 
@@ -2504,14 +3344,12 @@ namespace d_char_class
     class is_none_of
     {
     private:
-        const char* m_chars;
-        std::size_t m_length;
+        d_char_set m_set;   // complement of the excluded characters
 
     public:
         is_none_of(const char* _chars,
                    std::size_t _length)
-            : m_chars(_chars)
-            , m_length(_length)
+            : m_set(d_char_set(_chars, _length).complement())
         {}
 
         bool
@@ -2520,17 +3358,13 @@ namespace d_char_class
             char _ch
         ) const
         {
-            std::size_t i;
-
-            for (i = 0; i < m_length; ++i)
-            {
-                if (m_chars[i] == _ch)
-                {
-                    return false;
-                }
-            }
+            return m_set.contains(_ch);
+        }
 
-            return true;
+        const d_char_set&
+        char_set() const
+        {
+            return m_set;
         }
     };
 
@@ -2539,14 +3373,16 @@ namespace d_char_class
     class is_in_range
     {
     private:
-        char m_low;
-        char m_high;
+        char       m_low;
+        char       m_high;
+        d_char_set m_set;
 
     public:
         is_in_range(char _low,
                     char _high)
             : m_low(_low)
             , m_high(_high)
+            , m_set(d_char_set::from_range(_low, _high))
         {}
 
         bool
@@ -2557,10 +3393,21 @@ namespace d_char_class
         {
             return (_ch >= m_low) && (_ch <= m_high);
         }
+
+        const d_char_set&
+        char_set() const
+        {
+            return m_set;
+        }
     };
 
 }  // namespace d_char_class
 
+
+// -----------------------------------------------------------------------------
+// IX.3 Character class factories
+// -----------------------------------------------------------------------------
+
 // digit
 //   factory: creates a parser that matches ASCII digits.
 inline d_predicate_parser<d_char_class::is_digit, char>
@@ -2640,6 +3487,641 @@ char_range
                d_char_class::is_in_range(_low, _high));
 }
 
+// char_set
+//   factory: creates a parser that matches any character of a precomputed
+// d_char_class::d_char_set.
+inline d_predicate_parser<d_char_class::d_char_set, char>
+char_set
+(
+    const d_char_class::d_char_set& _set
+)
+{
+    return satisfy<const d_char_class::d_char_set&, char>(_set);
+}
+
+
+// =============================================================================
+// X.   REPETITION PARSERS
+// =============================================================================
+
+// -----------------------------------------------------------------------------
+// X.1  Many parser
+// -----------------------------------------------------------------------------
+
+// d_many_parser
+//   class: applies a parser repeatedly and collects its results. Succeeds
+// once at least `min_count` repetitions matched; input consumed by a failed
+// attempt is restored.
+template<typename _Parser>
+class d_many_parser
+    : public d_parser_base<d_many_parser<_Parser>,
+                           std::vector<parser_result_t<_Parser>>,
+                           typename _Parser::input_type>
+{
+public:
+    using base_type    = d_parser_base<d_many_parser<_Parser>,
+                                       std::vector<parser_result_t<_Parser>>,
+                                       typename _Parser::input_type>;
+    using parser_type  = _Parser;
+    using result_type  = std::vector<parser_result_t<_Parser>>;
+    using input_type   = typename _Parser::input_type;
+    using parse_result = typename base_type::parse_result;
+
+private:
+    parser_type m_parser;
+    std::size_t m_min_count;
+
+public:
+    // d_many_parser
+    //   constructor: creates a repetition of _parser.
+    d_many_parser(parser_type _parser,
+                  std::size_t _min_count)
+        : m_parser(std::move(_parser))
+        , m_min_count(_min_count)
+    {}
+
+    // parse_impl
+    //   implementation: applies the inner parser until it fails or stops
+    // consuming input.
+    template<typename _Source>
+    parse_result
+    parse_impl
+    (
+        _Source& _source
+    )
+    {
+        typename _Source::mark_type             start;
+        typename _Source::mark_type             mark;
+        typename parser_type::parse_result      item;
+        result_type                             values;
+        std::size_t                             offset;
+
+        start = _source.mark();
+
+        for (;;)
+        {
+            mark   = _source.mark();
+            offset = _source.offset();
+            item   = m_parser.parse(_source);
+
+            if (item.failed())
+            {
+                _source.restore(mark);
+
+                break;
+            }
+
+            values.push_back(std::move(item.value()));
+
+            // a match that consumed nothing would repeat forever
+            if (_source.offset() == offset)
+            {
+                break;
+            }
+        }
+
+        if (values.size() < m_min_count)
+        {
+            _source.restore(start);
+
+            return parse_result::make_failure("too few repetitions",
+                                              _source.position());
+        }
+
+        return parse_result::make_success(std::move(values));
+    }
+};
+
+// d_many_parser (predicate specialization)
+//   class: repetition of a single-character predicate. When the source can
+// scan in bulk (scan_while) and exposes contiguous data, the whole run is
+// consumed by one table-driven scan and copied out in one step instead of
+// testing and appending one element at a time.
+template<typename _Predicate,
+         typename _Input>
+class d_many_parser<d_predicate_parser<_Predicate, _Input>>
+    : public d_parser_base<d_many_parser<d_predicate_parser<_Predicate, _Input>>,
+                           std::vector<_Input>,
+                           _Input>
+{
+public:
+    using base_type    = d_parser_base<
+                             d_many_parser<d_predicate_parser<_Predicate,
+                                                              _Input>>,
+                             std::vector<_Input>,
+                             _Input>;
+    using parser_type  = d_predicate_parser<_Predicate, _Input>;
+    using result_type  = std::vector<_Input>;
+    using input_type   = _Input;
+    using parse_result = typename base_type::parse_result;
+
+private:
+    parser_type m_parser;
+    std::size_t m_min_count;
+
+public:
+    // d_many_parser
+    //   constructor: creates a repetition of _parser.
+    d_many_parser(parser_type _parser,
+                  std::size_t _min_count)
+        : m_parser(std::move(_parser))
+        , m_min_count(_min_count)
+    {}
+
+    // parse_impl
+    //   implementation: lowers to the source's bulk scan when possible.
+    template<typename _Source>
+    parse_result
+    parse_impl
+    (
+        _Source& _source
+    )
+    {
+        return parse_dispatch(
+                   _source,
+                   std::integral_constant<bool,
+                       has_scan_while<_Source, _Predicate>::value &&
+                       has_contiguous_data<_Source>::value>());
+    }
+
+private:
+    // parse_dispatch
+    //   bulk path: scan_while + a single range copy.
+    template<typename _Source>
+    parse_result
+    parse_dispatch
+    (
+        _Source& _source,
+        std::true_type
+    )
+    {
+        typename _Source::mark_type start;
+        const input_type*           first;
+        std::size_t                 count;
+
+        start = _source.mark();
+        first = _source.data();
+        count = _source.scan_while(m_parser.predicate());
+
+        if (count < m_min_count)
+        {
+            _source.restore(start);
+
+            return parse_result::make_failure("too few repetitions",
+                                              _source.position());
+        }
+
+        return parse_result::make_success(result_type(first, first + count));
+    }
+
+    // parse_dispatch
+    //   generic path: one predicate test per element.
+    template<typename _Source>
+    parse_result
+    parse_dispatch
+    (
+        _Source& _source,
+        std::false_type
+    )
+    {
+        typename _Source::mark_type start;
+        result_type                 values;
+
+        start = _source.mark();
+
+        while ( (!_source.eof()) &&
+                (m_parser.predicate()(_source.peek())) )
+        {
+            values.push_back(_source.read());
+        }
+
+        if (values.size() < m_min_count)
+        {
+            _source.restore(start);
+
+            return parse_result::make_failure("too few repetitions",
+                                              _source.position());
+        }
+
+        return parse_result::make_success(std::move(values));
+    }
+};
+
+// many
+//   factory: zero or more repetitions of _parser.
+template<typename _Parser>
+d_many_parser<_Parser>
+many
+(
+    _Parser _parser
+)
+{
+    return d_many_parser<_Parser>(std::move(_parser), 0);
+}
+
+// many1
+//   factory: one or more repetitions of _parser.
+template<typename _Parser>
+d_many_parser<_Parser>
+many1
+(
+    _Parser _parser
+)
+{
+    return d_many_parser<_Parser>(std::move(_parser), 1);
+}
+
+// -----------------------------------------------------------------------------
+// X.2  Take-while parser (zero-copy)
+// -----------------------------------------------------------------------------
+
+// d_text_span
+//   struct: zero-copy slice of the input (pointer into the source + length).
+struct d_text_span
+{
+    const char* data;
+    std::size_t size;
+
+#if D_ENV_LANG_IS_CPP17_OR_HIGHER
+    // view
+    //   returns the slice as a string_view.
+    std::string_view
+    view() const
+    {
+        return std::string_view(data, size);
+    }
+#endif
+};
+
+// d_take_while_parser
+//   class: consumes the longest run of characters satisfying a predicate and
+// returns it as a d_text_span pointing into the input; nothing is copied.
+// Requires a contiguous source (one exposing data()).
+template<typename _Predicate>
+class d_take_while_parser
+    : public d_parser_base<d_take_while_parser<_Predicate>, d_text_span, char>
+{
+public:
+    using base_type      = d_parser_base<d_take_while_parser<_Predicate>,
+                                         d_text_span,
+                                         char>;
+    using predicate_type = _Predicate;
+    using result_type    = d_text_span;
+    using input_type     = char;
+    using parse_result   = typename base_type::parse_result;
+
+private:
+    predicate_type m_predicate;
+    std::size_t    m_min_count;
+
+public:
+    // d_take_while_parser
+    //   constructor: creates a take-while parser.
+    d_take_while_parser(predicate_type _predicate,
+                        std::size_t    _min_count)
+        : m_predicate(std::move(_predicate))
+        , m_min_count(_min_count)
+    {}
+
+    // parse_impl
+    //   implementation: one bulk scan, then a slice of the input.
+    template<typename _Source>
+    parse_result
+    parse_impl
+    (
+        _Source& _source
+    )
+    {
+        typename _Source::mark_type start;
+        d_text_span                 span;
+
+        static_assert(has_contiguous_data<_Source>::value,
+                      "take_while requires a contiguous input source");
+
+        start     = _source.mark();
+        span.data = reinterpret_cast<const char*>(_source.data());
+        span.size = _source.scan_while(m_predicate);
+
+        if (span.size < m_min_count)
+        {
+            _source.restore(start);
+
+            return parse_result::make_failure("too few repetitions",
+                                              _source.position());
+        }
+
+        return parse_result::make_success(span);
+    }
+};
+
+// take_while
+//   factory: zero-copy run of zero or more characters satisfying _predicate.
+template<typename _Predicate>
+d_take_while_parser<typename std::decay<_Predicate>::type>
+take_while
+(
+    _Predicate&& _predicate
+)
+{
+    return d_take_while_parser<typename std::decay<_Predicate>::type>(
+               std::forward<_Predicate>(_predicate), 0);
+}
+
+// take_while1
+//   factory: zero-copy run of one or more characters satisfying _predicate.
+template<typename _Predicate>
+d_take_while_parser<typename std::decay<_Predicate>::type>
+take_while1
+(
+    _Predicate&& _predicate
+)
+{
+    return d_take_while_parser<typename std::decay<_Predicate>::type>(
+               std::forward<_Predicate>(_predicate), 1);
+}
+
+
+// =============================================================================
+// XI.  MEMOIZATION (PACKRAT)
+// =============================================================================
+
+// -----------------------------------------------------------------------------
+// XI.1 Memo context
+// -----------------------------------------------------------------------------
+
+// d_memo_context
+//   class: state shared by every memoized parser taking part in one parse.
+// Tracks the furthest offset at which a memoized parser was started (which
+// defines the retention window), a generation counter used to invalidate
+// all entries at once when a new input is parsed, and hit/miss counters.
+class d_memo_context
+{
+public:
+    using size_type = std::size_t;
+
+private:
+    size_type     m_window;
+    size_type     m_furthest;
+    std::uint32_t m_generation;
+    size_type     m_hits;
+    size_type     m_misses;
+
+public:
+    // d_memo_context
+    //   constructor: creates a context retaining `_window` positions behind
+    // the furthest offset reached (rounded up to a power of two).
+    explicit d_memo_context(size_type _window = D_CFG_PARSE_MEMO_WINDOW)
+        : m_window(1)
+        , m_furthest(0)
+        , m_generation(1)
+        , m_hits(0)
+        , m_misses(0)
+    {
+        while (m_window < _window)
+        {
+            m_window <<= 1;
+        }
+    }
+
+    // reset
+    //   invalidates every memo entry recorded under this context; call before
+    // parsing a new input with the same parsers.
+    void
+    reset()
+    {
+        ++m_generation;
+
+        // generation 0 is reserved for empty slots
+        if (m_generation == 0)
+        {
+            m_generation = 1;
+        }
+
+        m_furthest = 0;
+        m_hits     = 0;
+        m_misses   = 0;
+
+        return;
+    }
+
+    // window
+    //   returns the number of retained positions (a power of two).
+    size_type
+    window() const
+    {
+        return m_window;
+    }
+
+    // generation
+    //   returns the current generation.
+    std::uint32_t
+    generation() const
+    {
+        return m_generation;
+    }
+
+    // furthest
+    //   returns the furthest offset at which a memoized parse started.
+    size_type
+    furthest() const
+    {
+        return m_furthest;
+    }
+
+    // hits
+    //   returns the number of results served from the memo tables.
+    size_type
+    hits() const
+    {
+        return m_hits;
+    }
+
+    // misses
+    //   returns the number of results that had to be computed.
+    size_type
+    misses() const
+    {
+        return m_misses;
+    }
+
+    // in_window
+    //   returns true if entries at `_offset` are still retained.
+    bool
+    in_window
+    (
+        size_type _offset
+    ) const
+    {
+        return (_offset + m_window) > m_furthest;
+    }
+
+    // note_offset
+    //   advances the furthest memoized start offset.
+    void
+    note_offset
+    (
+        size_type _offset
+    )
+    {
+        if (_offset > m_furthest)
+        {
+            m_furthest = _offset;
+        }
+
+        return;
+    }
+
+    // note_hit
+    //   records a memo hit.
+    void
+    note_hit()
+    {
+        ++m_hits;
+
+        return;
+    }
+
+    // note_miss
+    //   records a memo miss.
+    void
+    note_miss()
+    {
+        ++m_misses;
+
+        return;
+    }
+};
+
+// -----------------------------------------------------------------------------
+// XI.2 Memoizing parser
+// -----------------------------------------------------------------------------
+
+// d_memo_parser
+//   class: wraps a parser so that its result at each input offset is computed
+// at most once per generation. Entries live in a ring of `window` slots
+// indexed by offset, so memory stays bounded however long the input is, and
+// entries that fall behind the context's furthest offset by more than the
+// window are treated as evicted. Copies of a d_memo_parser share one table.
+// The source must support backtracking (mark/restore) and is fixed by
+// `_Source` because the end-of-match mark is stored in the table.
+template<typename _Parser,
+         typename _Source>
+class d_memo_parser
+    : public d_parser_base<d_memo_parser<_Parser, _Source>,
+                           parser_result_t<_Parser>,
+                           typename _Parser::input_type>
+{
+public:
+    using base_type    = d_parser_base<d_memo_parser<_Parser, _Source>,
+                                       parser_result_t<_Parser>,
+                                       typename _Parser::input_type>;
+    using parser_type  = _Parser;
+    using source_type  = _Source;
+    using result_type  = parser_result_t<_Parser>;
+    using input_type   = typename _Parser::input_type;
+    using parse_result = typename base_type::parse_result;
+    using mark_type    = typename _Source::mark_type;
+
+    // entry
+    //   struct: one memo slot; `generation` 0 marks an empty slot.
+    struct entry
+    {
+        std::uint32_t generation;
+        std::size_t   offset;
+        parse_result  result;
+        mark_type     end;
+    };
+
+private:
+    parser_type                         m_parser;
+    d_memo_context*                     m_context;
+    std::shared_ptr<std::vector<entry>> m_table;
+
+public:
+    // d_memo_parser
+    //   constructor: memoizes _parser under _context, which must outlive
+    // this parser and every copy of it.
+    d_memo_parser(parser_type     _parser,
+                  d_memo_context& _context)
+        : m_parser(std::move(_parser))
+        , m_context(&_context)
+        , m_table(std::make_shared<std::vector<entry>>(_context.window()))
+    {}
+
+    // context
+    //   returns the memo context this parser records into.
+    d_memo_context&
+    context() const
+    {
+        return *m_context;
+    }
+
+    // parse_impl
+    //   implementation: replays a stored result for this offset if one is
+    // retained; otherwise runs the wrapped parser and stores the outcome.
+    template<typename _Src>
+    parse_result
+    parse_impl
+    (
+        _Src& _source
+    )
+    {
+        static_assert(std::is_same<_Src, source_type>::value,
+                      "memo parser used with a different source type");
+
+#if D_CFG_PARSE_ENABLE_MEMOIZATION
+        std::size_t  offset;
+        entry*       slot;
+        parse_result result;
+
+        offset = _source.offset();
+        slot   = &(*m_table)[offset & (m_table->size() - 1)];
+
+        if ( (slot->generation == m_context->generation()) &&
+             (slot->offset == offset)                       &&
+             (m_context->in_window(offset)) )
+        {
+            m_context->note_hit();
+            _source.restore(slot->end);
+
+            return slot->result;
+        }
+
+        m_context->note_miss();
+        m_context->note_offset(offset);
+
+        // computed before storing: the inner parse may overwrite this slot
+        // through recursion at a congruent offset
+        result = m_parser.parse(_source);
+
+        slot->generation = m_context->generation();
+        slot->offset     = offset;
+        slot->result     = result;
+        slot->end        = _source.mark();
+
+        return result;
+#else
+        return m_parser.parse(_source);
+#endif
+    }
+};
+
+// memo
+//   factory: memoizes _parser for sources of type _Source, recording into
+// _context. Usage: `auto expr = memo<d_memory_source<char>>(p, ctx);`
+template<typename _Source,
+         typename _Parser>
+d_memo_parser<typename std::decay<_Parser>::type, _Source>
+memo
+(
+    _Parser&&       _parser,
+    d_memo_context& _context
+)
+{
+    return d_memo_parser<typename std::decay<_Parser>::type, _Source>(
+               std::forward<_Parser>(_parser), _context);
+}
+
 
 NS_END  // djinterp
 
@@ -257,6 +257,105 @@ struct d_parse_result
     size_t                       tree_capacity;
 };
 
+/* ============================================================================
+ * Shared packed parse forest (SPPF) structures
+ *
+ *   A compact alternative to materializing every tree of an ambiguous parse.
+ * Nodes are shared between derivations and live in contiguous arrays owned by
+ * the forest; every link is a 32-bit index into those arrays. Productions are
+ * binarized (Scott-style intermediate nodes), so the number of nodes stays
+ * polynomial in the input length no matter how many trees the forest holds.
+ * ========================================================================== */
+
+// D_PARSE_FOREST_NONE
+//   constant: null value for forest node and packed-node indices.
+#define D_PARSE_FOREST_NONE UINT32_MAX
+
+// DParseForestNodeKind
+//   enum: kind of a node stored in a parse forest.
+enum DParseForestNodeKind
+{
+    D_PARSE_FOREST_NODE_TERMINAL = 0,   // single token, label = symbol index
+    D_PARSE_FOREST_NODE_SYMBOL,         // (A, i, j), label = symbol index
+    D_PARSE_FOREST_NODE_INTERMEDIATE    // (A -> α • β, i, j), label = prod
+};
+
+// d_parse_forest_node
+//   struct: a shared forest node spanning tokens [start, end). Derivations of
+// the node are stored as a singly linked list of packed nodes.
+struct d_parse_forest_node
+{
+    uint8_t  kind;            // enum DParseForestNodeKind
+    int32_t  label;           // symbol index, or production for intermediates
+    uint32_t dot;             // dot position (intermediate nodes only)
+    uint32_t start;           // first token index covered
+    uint32_t end;             // one past the last token index covered
+    uint32_t first_packed;    // head of packed-node list, or NONE
+    uint32_t packed_count;    // number of alternative derivations
+};
+
+// d_parse_forest_packed
+//   struct: one derivation of a forest node. `left` covers the prefix of the
+// production (an intermediate node, or NONE for the first symbol) and `right`
+// covers the last symbol of that prefix (NONE for an epsilon production).
+struct d_parse_forest_packed
+{
+    uint32_t left;
+    uint32_t right;
+    int32_t  production_index;
+    uint32_t next;            // next packed node of the same parent, or NONE
+};
+
+// d_parse_forest
+//   struct: arena-backed parse forest. Destroying it releases every node.
+struct d_parse_forest
+{
+    struct d_parse_forest_node*   nodes;
+    uint32_t                      node_count;
+    uint32_t                      node_capacity;
+
+    struct d_parse_forest_packed* packed;
+    uint32_t                      packed_count;
+    uint32_t                      packed_capacity;
+
+    // open-addressed node index keyed by (kind, label, dot, start, end)
+    uint32_t*                     lookup;
+    uint32_t                      lookup_capacity;
+
+    uint32_t                      root;
+
+    // token array the terminal nodes refer to (owned by the runtime)
+    const struct d_parse_rt_token* tokens;
+    size_t                        token_count;
+};
+
+// d_parse_forest_iter
+//   struct: lazy enumerator over the trees held by a forest. Only one packed
+// choice per forest node is stored, so advancing to the next tree never
+// materializes anything. Choices that would make a node its own descendant
+// are skipped, so every tree yielded is finite.
+struct d_parse_forest_iter
+{
+    const struct d_parse_forest* forest;
+    uint32_t*                    choice;      // per node: selected alternative
+    uint32_t*                    order;       // nodes of current tree, DFS
+    uint32_t                     order_count;
+    uint32_t                     cut;         // order position closing a cycle
+    uint8_t*                     visited;     // per node: DFS state
+    uint32_t*                    stack;       // DFS work stack
+    int                          started;
+    int                          exhausted;
+};
+
+// d_parse_forest_iter_pending
+//   struct: a tree node waiting for its children while
+// d_parse_forest_iter_build_tree materializes the current tree.
+struct d_parse_forest_iter_pending
+{
+    uint32_t                  node;    // forest node it was made from
+    struct d_parse_tree_node* tree;
+};
+
 /* ============================================================================
  * Runtime parser state
  * ========================================================================== */
@@ -2207,309 +2306,1455 @@ d_parse_build_tree_from_item
 }
 
 /* ============================================================================
- * Main parsing interface
+ * Shared packed parse forest
  * ========================================================================== */
 
 /*
-d_parse_runtime_init
-  Initialize the runtime parser.
-
-Parameter(s):
-  _runtime: the runtime parser state to initialize.
-  _grammar: the grammar to parse against (must remain valid during parsing).
-  _config:  optional lexer configuration (NULL for defaults).
+d_parse_forest_init
+  Initialize an empty parse forest.
 */
 static void
-d_parse_runtime_init
+d_parse_forest_init
 (
-    struct d_parse_runtime*               _runtime,
-    const struct d_parse_grammar*         _grammar,
-    const struct d_parse_rt_lexer_config* _config
+    struct d_parse_forest* _forest
 )
 {
-    if ( (!_runtime) || 
-         (!_grammar) )
+    if (!_forest)
     {
         return;
     }
 
-    memset(_runtime, 0, sizeof(*_runtime));
-
-    _runtime->grammar = _grammar;
-
-    if (_config)
-    {
-        _runtime->config = *_config;
-    }
-    else
-    {
-        d_parse_rt_lexer_config_init_default(&_runtime->config);
-    }
+    memset(_forest, 0, sizeof(*_forest));
 
-    d_parse_earley_chart_init(&_runtime->chart);
+    _forest->root = D_PARSE_FOREST_NONE;
 
     return;
 }
 
 /*
-d_parse_runtime_destroy
-  Clean up runtime parser resources.
+d_parse_forest_destroy
+  Release the node arena, the packed-node arena and the lookup index in one
+step; no per-node frees are needed.
 */
 static void
-d_parse_runtime_destroy
+d_parse_forest_destroy
 (
-    struct d_parse_runtime* _runtime
+    struct d_parse_forest* _forest
 )
 {
-    if (!_runtime)
+    if (!_forest)
     {
         return;
     }
 
-    d_parse_rt_lexer_destroy(&_runtime->lexer);
-    d_parse_earley_chart_destroy(&_runtime->chart);
-
-    if (_runtime->tokens)
-    {
-        free(_runtime->tokens);
-    }
+    free(_forest->nodes);
+    free(_forest->packed);
+    free(_forest->lookup);
 
-    memset(_runtime, 0, sizeof(*_runtime));
+    d_parse_forest_init(_forest);
 
     return;
 }
 
 /*
-d_parse_runtime_tokenize
-  Tokenize the input and store tokens.
+d_parse_forest_hash
+  Hash a forest node key for the lookup index.
 */
-static void
-d_parse_runtime_tokenize
+static uint32_t
+d_parse_forest_hash
 (
-    struct d_parse_runtime* _runtime,
-    const char*             _input
+    uint8_t  _kind,
+    int32_t  _label,
+    uint32_t _dot,
+    uint32_t _start,
+    uint32_t _end
 )
 {
-    struct d_parse_rt_token token;
-    size_t                  new_capacity;
+    uint64_t h;
 
-    if ( (!_runtime) || 
-         (!_input) )
-    {
-        return;
-    }
+    h  = 0x9E3779B97F4A7C15ull;
+    h ^= (uint64_t)_kind;
+    h *= 0xBF58476D1CE4E5B9ull;
+    h ^= (uint64_t)(uint32_t)_label;
+    h *= 0x94D049BB133111EBull;
+    h ^= ((uint64_t)_dot << 32) | (uint64_t)_start;
+    h *= 0xBF58476D1CE4E5B9ull;
+    h ^= (uint64_t)_end;
+    h ^= (h >> 31);
 
-    d_parse_rt_lexer_init(&_runtime->lexer,
-                          _input,
-                          _runtime->grammar,
-                          &_runtime->config);
+    return (uint32_t)h;
+}
 
-    // clear existing tokens
-    _runtime->token_count = 0u;
+/*
+d_parse_forest_lookup_grow
+  Double the lookup index and rehash every node into it.
+*/
+static void
+d_parse_forest_lookup_grow
+(
+    struct d_parse_forest* _forest
+)
+{
+    uint32_t new_capacity;
+    uint32_t mask;
+    uint32_t i;
 
-    for (;;)
-    {
-        token = d_parse_rt_lexer_next(&_runtime->lexer);
+    new_capacity = (_forest->lookup_capacity != 0u)
+        ? (_forest->lookup_capacity * 2u)
+        : 64u;
+    mask         = new_capacity - 1u;
 
-        // skip whitespace/indent tokens for basic mode
-        if ( (!_runtime->config.track_indentation) && 
-             ( (token.type == D_PARSE_RT_TOKEN_WHITESPACE) ||
-               (token.type == D_PARSE_RT_TOKEN_NEWLINE) ) )
-        {
-            continue;
-        }
+    free(_forest->lookup);
 
-        // add token to buffer
-        if (_runtime->token_count == _runtime->token_capacity)
-        {
-            new_capacity = (_runtime->token_capacity != 0u)
-                ? (_runtime->token_capacity * 2u)
-                : 64u;
+    _forest->lookup = d_parse_rt_realloc(NULL,
+                                         new_capacity * sizeof(uint32_t));
+    memset(_forest->lookup, 0xFF, new_capacity * sizeof(uint32_t));
 
-            _runtime->tokens = d_parse_rt_realloc(
-                _runtime->tokens,
-                new_capacity * sizeof(struct d_parse_rt_token));
+    _forest->lookup_capacity = new_capacity;
 
-            _runtime->token_capacity = new_capacity;
-        }
+    for (i = 0u; i < _forest->node_count; ++i)
+    {
+        const struct d_parse_forest_node* node;
+        uint32_t                          slot;
 
-        _runtime->tokens[_runtime->token_count] = token;
-        _runtime->token_count += 1u;
+        node = &_forest->nodes[i];
+        slot = d_parse_forest_hash(node->kind,
+                                   node->label,
+                                   node->dot,
+                                   node->start,
+                                   node->end) & mask;
 
-        if (token.type == D_PARSE_RT_TOKEN_EOF)
+        while (_forest->lookup[slot] != D_PARSE_FOREST_NONE)
         {
-            break;
+            slot = (slot + 1u) & mask;
         }
+
+        _forest->lookup[slot] = i;
     }
 
     return;
 }
 
 /*
-d_parse_runtime_parse
-  Parse input text against the loaded grammar.
-
-Parameter(s):
-  _runtime: initialized runtime parser.
-  _input:   the input text to parse.
-  _result:  output parse result (caller must call d_parse_result_destroy).
-
-Return:
-  1 if parsing succeeded, 0 if failed.
+d_parse_forest_node_find_or_add
+  Return the index of the node with the given key, creating it if it does not
+exist yet. `_created` is set to 1 when a new node was appended.
 */
-static int
-d_parse_runtime_parse
+static uint32_t
+d_parse_forest_node_find_or_add
 (
-    struct d_parse_runtime* _runtime,
-    const char*             _input,
-    struct d_parse_result*  _result
+    struct d_parse_forest* _forest,
+    uint8_t                _kind,
+    int32_t                _label,
+    uint32_t               _dot,
+    uint32_t               _start,
+    uint32_t               _end,
+    int*                   _created
 )
 {
-    const struct d_parse_grammar* grammar;
-    struct d_parse_earley_set*    initial_set;
-    size_t                        i;
-    size_t                        k;
+    struct d_parse_forest_node* node;
+    uint32_t                    mask;
+    uint32_t                    slot;
+    uint32_t                    index;
+    uint32_t                    new_capacity;
 
-    if ( (!_runtime) || 
-         (!_input)   || 
-         (!_result) )
+    *_created = 0;
+
+    // keep the lookup index at most half full
+    if ((_forest->node_count + 1u) * 2u > _forest->lookup_capacity)
     {
-        return 0;
+        d_parse_forest_lookup_grow(_forest);
     }
 
-    d_parse_result_init(_result);
+    mask = _forest->lookup_capacity - 1u;
+    slot = d_parse_forest_hash(_kind, _label, _dot, _start, _end) & mask;
 
-    grammar = _runtime->grammar;
+    while (_forest->lookup[slot] != D_PARSE_FOREST_NONE)
+    {
+        node = &_forest->nodes[_forest->lookup[slot]];
 
-    if ( (!grammar) || 
-         (grammar->start_symbol_index < 0) )
+        if ( (node->kind == _kind)   &&
+             (node->label == _label) &&
+             (node->dot == _dot)     &&
+             (node->start == _start) &&
+             (node->end == _end) )
+        {
+            return _forest->lookup[slot];
+        }
+
+        slot = (slot + 1u) & mask;
+    }
+
+    if (_forest->node_count == _forest->node_capacity)
     {
-        _result->error_message = "Invalid grammar or no start symbol";
+        new_capacity = (_forest->node_capacity != 0u)
+            ? (_forest->node_capacity * 2u)
+            : 64u;
 
-        return 0;
+        _forest->nodes = d_parse_rt_realloc(
+            _forest->nodes,
+            new_capacity * sizeof(struct d_parse_forest_node));
+
+        _forest->node_capacity = new_capacity;
     }
 
-    // tokenize input
-    d_parse_runtime_tokenize(_runtime, _input);
+    index = _forest->node_count;
+    node  = &_forest->nodes[index];
 
-    // reset chart
-    d_parse_earley_chart_destroy(&_runtime->chart);
-    d_parse_earley_chart_init(&_runtime->chart);
+    node->kind         = _kind;
+    node->label        = _label;
+    node->dot          = _dot;
+    node->start        = _start;
+    node->end          = _end;
+    node->first_packed = D_PARSE_FOREST_NONE;
+    node->packed_count = 0u;
 
-    // initialize S[0] with start symbol productions
-    initial_set = d_parse_earley_chart_get_set(&_runtime->chart, 0u);
+    _forest->node_count   += 1u;
+    _forest->lookup[slot]  = index;
+    *_created              = 1;
 
-    for (i = 0u; i < grammar->production_count; ++i)
+    return index;
+}
+
+/*
+d_parse_forest_add_packed
+  Add a derivation to a node unless an identical one is already present.
+*/
+static void
+d_parse_forest_add_packed
+(
+    struct d_parse_forest* _forest,
+    uint32_t               _node,
+    uint32_t               _left,
+    uint32_t               _right,
+    int32_t                _production_index
+)
+{
+    struct d_parse_forest_packed* packed;
+    uint32_t                      index;
+    uint32_t                      new_capacity;
+
+    for (index = _forest->nodes[_node].first_packed;
+         index != D_PARSE_FOREST_NONE;
+         index = _forest->packed[index].next)
     {
-        if (grammar->productions[i].lhs_index == grammar->start_symbol_index)
+        packed = &_forest->packed[index];
+
+        if ( (packed->left == _left)   &&
+             (packed->right == _right) &&
+             (packed->production_index == _production_index) )
         {
-            d_parse_earley_set_add(initial_set, (int)i, 0u, 0u);
+            return;
         }
     }
 
-    // main Earley parsing loop
-    for (k = 0u; k < _runtime->token_count; ++k)
+    if (_forest->packed_count == _forest->packed_capacity)
     {
-        struct d_parse_earley_set* current_set;
-        struct d_parse_rt_token*   token;
+        new_capacity = (_forest->packed_capacity != 0u)
+            ? (_forest->packed_capacity * 2u)
+            : 64u;
 
-        // process current set (predictor, completer)
-        d_parse_earley_process_set(grammar, &_runtime->chart, k);
+        _forest->packed = d_parse_rt_realloc(
+            _forest->packed,
+            new_capacity * sizeof(struct d_parse_forest_packed));
 
-        current_set = d_parse_earley_chart_get_set(&_runtime->chart, k);
-        token       = &_runtime->tokens[k];
+        _forest->packed_capacity = new_capacity;
+    }
 
-        // skip EOF for scanning
-        if (token->type == D_PARSE_RT_TOKEN_EOF)
-        {
-            break;
-        }
+    index  = _forest->packed_count;
+    packed = &_forest->packed[index];
+
+    packed->left             = _left;
+    packed->right            = _right;
+    packed->production_index = _production_index;
+    packed->next             = _forest->nodes[_node].first_packed;
+
+    _forest->nodes[_node].first_packed  = index;
+    _forest->nodes[_node].packed_count += 1u;
+    _forest->packed_count              += 1u;
+
+    return;
+}
+
+/*
+d_parse_forest_prefix_exists
+  Check that the first `_dot` symbols of a production can span tokens
+[_origin, _end), i.e. that the item [p, _dot, _origin] was recognized in
+S[_end].
+*/
+static int
+d_parse_forest_prefix_exists
+(
+    const struct d_parse_earley_chart* _chart,
+    int                                _production_index,
+    size_t                             _dot,
+    size_t                             _origin,
+    size_t                             _end
+)
+{
+    if (_dot == 0u)
+    {
+        return (_origin == _end);
+    }
+
+    if (_end >= _chart->count)
+    {
+        return 0;
+    }
+
+    return (d_parse_earley_set_contains(
+                (struct d_parse_earley_set*)&_chart->sets[_end],
+                _production_index,
+                _dot,
+                _origin) != NULL);
+}
+
+/*
+d_parse_forest_expand
+  Add to `_node` every derivation of the first `_dot` symbols of a production
+over tokens [_start, _end). The last of those symbols becomes the packed
+node's right child; the remaining prefix becomes a shared intermediate node.
+Child nodes are only looked up or appended to the arena here; newly appended
+ones are expanded later by d_parse_forest_build.
+*/
+static void
+d_parse_forest_expand
+(
+    struct d_parse_forest*             _forest,
+    const struct d_parse_grammar*      _grammar,
+    const struct d_parse_earley_chart* _chart,
+    uint32_t                           _node,
+    int                                _production_index,
+    size_t                             _dot,
+    size_t                             _start,
+    size_t                             _end
+)
+{
+    const struct d_parse_production* production;
+    const struct d_parse_symbol*     symbol;
+    const struct d_parse_earley_set* end_set;
+    int                              symbol_index;
+    uint32_t                         left;
+    uint32_t                         right;
+    size_t                           split;
+    size_t                           i;
+    int                              created;
 
-        // scanner: process terminals
-        for (i = 0u; i < current_set->count; ++i)
+    // epsilon production
+    if (_dot == 0u)
+    {
+        if (_start == _end)
         {
-            d_parse_earley_scanner(grammar,
-                                   &_runtime->chart,
-                                   current_set->items[i],
-                                   k,
-                                   token);
+            d_parse_forest_add_packed(_forest,
+                                      _node,
+                                      D_PARSE_FOREST_NONE,
+                                      D_PARSE_FOREST_NONE,
+                                      (int32_t)_production_index);
         }
+
+        return;
     }
 
-    // final processing of last set
-    d_parse_earley_process_set(grammar,
-                               &_runtime->chart,
-                               _runtime->token_count - 1u);
+    production   = &_grammar->productions[_production_index];
+    symbol_index = production->rhs_indices[_dot - 1u];
+    symbol       = &_grammar->symbols[symbol_index];
 
-    // check for successful parse: look for completed start symbol items
+    if (symbol->kind == D_PARSE_SYMBOL_KIND_TERM)
     {
-        struct d_parse_earley_set* final_set;
-        size_t                     final_pos;
-        int                        found_complete;
+        // a terminal always covers exactly the token before `_end`
+        if ( (_end == 0u)                 ||
+             (_end - 1u < _start)         ||
+             (_end - 1u >= _forest->token_count) )
+        {
+            return;
+        }
 
-        final_pos      = _runtime->token_count - 1u;
-        final_set      = d_parse_earley_chart_get_set(&_runtime->chart,
-                                                      final_pos);
-        found_complete = 0;
+        split = _end - 1u;
 
-        for (i = 0u; i < final_set->count; ++i)
+        if ( (!d_parse_earley_token_matches_terminal(&_forest->tokens[split],
+                                                     symbol)) ||
+             (!d_parse_forest_prefix_exists(_chart,
+                                            _production_index,
+                                            _dot - 1u,
+                                            _start,
+                                            split)) )
         {
-            struct d_parse_earley_item* item;
-            const struct d_parse_production* prod;
+            return;
+        }
 
-            item = final_set->items[i];
-            prod = &grammar->productions[item->production_index];
+        right = d_parse_forest_node_find_or_add(_forest,
+                                                D_PARSE_FOREST_NODE_TERMINAL,
+                                                (int32_t)symbol_index,
+                                                0u,
+                                                (uint32_t)split,
+                                                (uint32_t)_end,
+                                                &created);
+        left  = (_dot > 1u)
+            ? d_parse_forest_node_find_or_add(_forest,
+                                              D_PARSE_FOREST_NODE_INTERMEDIATE,
+                                              (int32_t)_production_index,
+                                              (uint32_t)(_dot - 1u),
+                                              (uint32_t)_start,
+                                              (uint32_t)split,
+                                              &created)
+            : D_PARSE_FOREST_NONE;
+
+        d_parse_forest_add_packed(_forest,
+                                  _node,
+                                  left,
+                                  right,
+                                  (int32_t)_production_index);
 
-            // check if this is a completed start symbol production from origin 0
-            if ( (prod->lhs_index == grammar->start_symbol_index) && 
-                 (item->origin == 0u)                             && 
-                 d_parse_earley_is_complete(grammar, item) )
-            {
-                struct d_parse_tree_node* tree;
+        return;
+    }
 
-                found_complete = 1;
+    if (_end >= _chart->count)
+    {
+        return;
+    }
 
-                // build parse tree
-                tree = d_parse_build_tree_from_item(grammar,
-                                                    item,
-                                                    _runtime->tokens,
-                                                    _runtime->token_count,
-                                                    final_pos);
+    // a nonterminal may end at `_end` from any origin completed in S[_end]
+    end_set = &_chart->sets[_end];
 
-                if (tree)
-                {
-                    d_parse_result_add_tree(_result, tree);
-                }
-            }
-        }
+    for (i = 0u; i < end_set->count; ++i)
+    {
+        const struct d_parse_earley_item* item;
 
-        if (!found_complete)
+        item = end_set->items[i];
+
+        if ( (item->origin < _start) ||
+             (_grammar->productions[item->production_index].lhs_index
+                  != symbol_index) ||
+             (!d_parse_earley_is_complete(_grammar, item)) )
         {
-            // find the furthest position reached for error reporting
-            size_t furthest;
+            continue;
+        }
 
-            furthest = 0u;
+        split = item->origin;
 
-            for (k = 0u; k < _runtime->chart.count; ++k)
-            {
-                if (_runtime->chart.sets[k].count > 0u)
-                {
-                    furthest = k;
-                }
-            }
+        if (!d_parse_forest_prefix_exists(_chart,
+                                          _production_index,
+                                          _dot - 1u,
+                                          _start,
+                                          split))
+        {
+            continue;
+        }
 
-            if (furthest < _runtime->token_count)
-            {
-                _result->error_line   = _runtime->tokens[furthest].line;
-                _result->error_column = _runtime->tokens[furthest].column;
-            }
+        right = d_parse_forest_node_find_or_add(_forest,
+                                                D_PARSE_FOREST_NODE_SYMBOL,
+                                                (int32_t)symbol_index,
+                                                0u,
+                                                (uint32_t)split,
+                                                (uint32_t)_end,
+                                                &created);
+        left  = (_dot > 1u)
+            ? d_parse_forest_node_find_or_add(_forest,
+                                              D_PARSE_FOREST_NODE_INTERMEDIATE,
+                                              (int32_t)_production_index,
+                                              (uint32_t)(_dot - 1u),
+                                              (uint32_t)_start,
+                                              (uint32_t)split,
+                                              &created)
+            : D_PARSE_FOREST_NONE;
+
+        d_parse_forest_add_packed(_forest,
+                                  _node,
+                                  left,
+                                  right,
+                                  (int32_t)_production_index);
+    }
 
-            _result->error_message = "Parse failed: unexpected token";
+    return;
+}
 
-            return 0;
-        }
+/*
+d_parse_forest_expand_node
+  Add every derivation of arena node `_node`: an intermediate node expands its
+own production prefix, and a symbol node expands each production of its symbol
+completed over its span. Terminal nodes have no derivations.
+*/
+static void
+d_parse_forest_expand_node
+(
+    struct d_parse_forest*             _forest,
+    const struct d_parse_grammar*      _grammar,
+    const struct d_parse_earley_chart* _chart,
+    uint32_t                           _node
+)
+{
+    const struct d_parse_earley_set* end_set;
+    struct d_parse_forest_node       key;
+    size_t                           i;
+
+    // copy the key out: expanding may grow (and move) the node arena
+    key = _forest->nodes[_node];
+
+    if (key.kind == D_PARSE_FOREST_NODE_INTERMEDIATE)
+    {
+        d_parse_forest_expand(_forest,
+                              _grammar,
+                              _chart,
+                              _node,
+                              key.label,
+                              key.dot,
+                              key.start,
+                              key.end);
+
+        return;
+    }
+
+    if ( (key.kind != D_PARSE_FOREST_NODE_SYMBOL) ||
+         (key.end >= _chart->count) )
+    {
+        return;
+    }
+
+    end_set = &_chart->sets[key.end];
+
+    for (i = 0u; i < end_set->count; ++i)
+    {
+        const struct d_parse_earley_item* item;
+        const struct d_parse_production*  production;
+
+        item       = end_set->items[i];
+        production = &_grammar->productions[item->production_index];
+
+        if ( (production->lhs_index != key.label) ||
+             (item->origin != key.start)          ||
+             (!d_parse_earley_is_complete(_grammar, item)) )
+        {
+            continue;
+        }
+
+        d_parse_forest_expand(_forest,
+                              _grammar,
+                              _chart,
+                              _node,
+                              item->production_index,
+                              production->rhs_length,
+                              key.start,
+                              key.end);
+    }
+
+    return;
+}
+
+/*
+d_parse_forest_build
+  Build the forest rooted at the node for `_symbol_index` spanning tokens
+[_start, _end). Like the Earley sets, the node arena doubles as the work
+list: each node is appended once, when first reached, and expanded when the
+loop gets to it, so the build needs no recursion however deep the trees are.
+A node that is reached again is shared, which turns cyclic grammars into a
+cyclic forest instead of unbounded work.
+
+Return:
+  The index of the root node.
+*/
+static uint32_t
+d_parse_forest_build
+(
+    struct d_parse_forest*             _forest,
+    const struct d_parse_grammar*      _grammar,
+    const struct d_parse_earley_chart* _chart,
+    int                                _symbol_index,
+    size_t                             _start,
+    size_t                             _end
+)
+{
+    uint32_t root;
+    uint32_t next;
+    int      created;
+
+    root = d_parse_forest_node_find_or_add(_forest,
+                                           D_PARSE_FOREST_NODE_SYMBOL,
+                                           (int32_t)_symbol_index,
+                                           0u,
+                                           (uint32_t)_start,
+                                           (uint32_t)_end,
+                                           &created);
+
+    if (!created)
+    {
+        return root;
+    }
+
+    for (next = root; next < _forest->node_count; ++next)
+    {
+        d_parse_forest_expand_node(_forest, _grammar, _chart, next);
+    }
+
+    return root;
+}
+
+/*
+d_parse_forest_is_ambiguous
+  Check whether any node reachable from the root has more than one
+derivation.
+*/
+static int
+d_parse_forest_is_ambiguous
+(
+    const struct d_parse_forest* _forest
+)
+{
+    uint32_t i;
+
+    if ( (!_forest) ||
+         (_forest->root == D_PARSE_FOREST_NONE) )
+    {
+        return 0;
+    }
+
+    // every node in the arena was reached while building from the root
+    for (i = 0u; i < _forest->node_count; ++i)
+    {
+        if (_forest->nodes[i].packed_count > 1u)
+        {
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+/*
+d_parse_forest_iter_init
+  Prepare a lazy enumeration of the trees in a forest. The forest must not be
+modified while the iterator is in use.
+  The iterator keeps one packed choice per forest node, so within one tree
+every occurrence of a shared node uses the same derivation. Only a node with
+an empty span, such as (A, i, i), can occur more than once in a tree; when
+it has several derivations, trees that derive its occurrences differently
+are not produced, so the enumeration under-counts them.
+
+Return:
+  1 on success, 0 if the forest is empty.
+*/
+static int
+d_parse_forest_iter_init
+(
+    struct d_parse_forest_iter*  _iter,
+    const struct d_parse_forest* _forest
+)
+{
+    uint32_t count;
+    uint32_t i;
+
+    if (!_iter)
+    {
+        return 0;
+    }
+
+    memset(_iter, 0, sizeof(*_iter));
+
+    if ( (!_forest) ||
+         (_forest->root == D_PARSE_FOREST_NONE) )
+    {
+        _iter->exhausted = 1;
+
+        return 0;
+    }
+
+    count = _forest->node_count;
+
+    _iter->forest  = _forest;
+    _iter->choice  = d_parse_rt_calloc(count, sizeof(uint32_t));
+    _iter->order   = d_parse_rt_calloc(count, sizeof(uint32_t));
+    _iter->visited = d_parse_rt_calloc(count, sizeof(uint8_t));
+    _iter->stack   = d_parse_rt_calloc((size_t)count * 2u + 1u,
+                                       sizeof(uint32_t));
+
+    for (i = 0u; i < count; ++i)
+    {
+        _iter->choice[i] = _forest->nodes[i].first_packed;
+    }
+
+    return 1;
+}
+
+// D_PARSE_FOREST_ITER_*
+//   constants: depth-first states of a node in d_parse_forest_iter.visited.
+// A node is on the current path from ENTERED until it is popped as DONE.
+#define D_PARSE_FOREST_ITER_UNSEEN   0u
+#define D_PARSE_FOREST_ITER_ENTERED  1u   // left child next
+#define D_PARSE_FOREST_ITER_LEFT     2u   // right child next
+#define D_PARSE_FOREST_ITER_RIGHT    3u   // children done
+#define D_PARSE_FOREST_ITER_DONE     4u
+
+/*
+d_parse_forest_iter_collect
+  Recompute the depth-first order of the nodes used by the current choices.
+If a choice leads back to a node on the current path, the choices do not form
+a finite tree: collection stops and `cut` is set to the position in `order` of
+the node whose choice closed the cycle.
+*/
+static void
+d_parse_forest_iter_collect
+(
+    struct d_parse_forest_iter* _iter
+)
+{
+    const struct d_parse_forest* forest;
+    uint32_t                     top;
+    uint32_t                     i;
+
+    forest = _iter->forest;
+
+    for (i = 0u; i < _iter->order_count; ++i)
+    {
+        _iter->visited[_iter->order[i]] = D_PARSE_FOREST_ITER_UNSEEN;
+    }
+
+    _iter->order_count = 0u;
+    _iter->cut         = D_PARSE_FOREST_NONE;
+    top                = 0u;
+
+    _iter->visited[forest->root]       = D_PARSE_FOREST_ITER_ENTERED;
+    _iter->order[_iter->order_count++] = forest->root;
+    _iter->stack[top++]                = forest->root;
+
+    while (top > 0u)
+    {
+        uint32_t                            node;
+        uint32_t                            child;
+        const struct d_parse_forest_packed* packed;
+
+        node = _iter->stack[top - 1u];
+
+        if ( (_iter->visited[node] == D_PARSE_FOREST_ITER_RIGHT) ||
+             (_iter->choice[node] == D_PARSE_FOREST_NONE) )
+        {
+            _iter->visited[node] = D_PARSE_FOREST_ITER_DONE;
+            --top;
+
+            continue;
+        }
+
+        // the prefix (left) is visited before the last symbol (right)
+        packed = &forest->packed[_iter->choice[node]];
+        child  = (_iter->visited[node] == D_PARSE_FOREST_ITER_ENTERED)
+            ? packed->left
+            : packed->right;
+
+        _iter->visited[node] += 1u;
+
+        if ( (child == D_PARSE_FOREST_NONE) ||
+             (_iter->visited[child] == D_PARSE_FOREST_ITER_DONE) )
+        {
+            continue;
+        }
+
+        if (_iter->visited[child] != D_PARSE_FOREST_ITER_UNSEEN)
+        {
+            // `child` is on the path to `node`
+            for (i = _iter->order_count; i > 0u; --i)
+            {
+                if (_iter->order[i - 1u] == node)
+                {
+                    _iter->cut = i - 1u;
+
+                    break;
+                }
+            }
+
+            return;
+        }
+
+        _iter->visited[child]              = D_PARSE_FOREST_ITER_ENTERED;
+        _iter->order[_iter->order_count++] = child;
+        _iter->stack[top++]                = child;
+    }
+
+    return;
+}
+
+/*
+d_parse_forest_iter_next
+  Advance to the next tree. The first call selects the first tree. Trees are
+produced in lexicographic order of the packed choices along a depth-first
+walk, and each distinct tree is produced once. Choices that close a cycle in
+the forest (possible with grammars such as `S -> S | a`) are skipped together
+with every choice below them, so only complete, finite trees are selected.
+
+Return:
+  1 if a tree is selected, 0 when every tree has been enumerated.
+*/
+static int
+d_parse_forest_iter_next
+(
+    struct d_parse_forest_iter* _iter
+)
+{
+    const struct d_parse_forest* forest;
+    uint32_t                     position;
+    uint32_t                     i;
+
+    if ( (!_iter) ||
+         (_iter->exhausted) )
+    {
+        return 0;
+    }
+
+    forest   = _iter->forest;
+    position = _iter->order_count;
+
+    if (!_iter->started)
+    {
+        _iter->started = 1;
+        d_parse_forest_iter_collect(_iter);
+
+        if (_iter->cut == D_PARSE_FOREST_NONE)
+        {
+            return 1;
+        }
+
+        position = _iter->cut + 1u;
+    }
+
+    // odometer step: bump the last node in DFS order that has another choice
+    while (position > 0u)
+    {
+        uint32_t node;
+        uint32_t current;
+
+        node    = _iter->order[position - 1u];
+        current = _iter->choice[node];
+
+        if ( (current == D_PARSE_FOREST_NONE) ||
+             (forest->packed[current].next == D_PARSE_FOREST_NONE) )
+        {
+            --position;
+
+            continue;
+        }
+
+        _iter->choice[node] = forest->packed[current].next;
+
+        // everything after it restarts from its first alternative
+        for (i = position; i < _iter->order_count; ++i)
+        {
+            node                = _iter->order[i];
+            _iter->choice[node] = forest->nodes[node].first_packed;
+        }
+
+        d_parse_forest_iter_collect(_iter);
+
+        if (_iter->cut == D_PARSE_FOREST_NONE)
+        {
+            return 1;
+        }
+
+        // no choice below the cycle can complete it; move on from there
+        position = _iter->cut + 1u;
+    }
+
+    _iter->exhausted = 1;
+
+    return 0;
+}
+
+/*
+d_parse_forest_iter_choice
+  Get the packed node selected for `_node` in the current tree, or
+D_PARSE_FOREST_NONE for terminals. Lets callers walk the current tree in place
+without materializing it.
+*/
+static uint32_t
+d_parse_forest_iter_choice
+(
+    const struct d_parse_forest_iter* _iter,
+    uint32_t                          _node
+)
+{
+    if ( (!_iter)         ||
+         (!_iter->forest) ||
+         (_node >= _iter->forest->node_count) )
+    {
+        return D_PARSE_FOREST_NONE;
+    }
+
+    return _iter->choice[_node];
+}
+
+/*
+d_parse_forest_iter_make_node
+  Create the tree node for forest node `_node` without its children: a
+terminal carries its token, a nonterminal the production of its current
+choice.
+*/
+static struct d_parse_tree_node*
+d_parse_forest_iter_make_node
+(
+    const struct d_parse_forest_iter* _iter,
+    uint32_t                          _node
+)
+{
+    const struct d_parse_forest_node* fnode;
+    struct d_parse_tree_node*         node;
+    const struct d_parse_rt_token*    token;
+
+    fnode = &_iter->forest->nodes[_node];
+
+    if (fnode->kind == D_PARSE_FOREST_NODE_TERMINAL)
+    {
+        node  = d_parse_tree_node_create(D_PARSE_TREE_NODE_TERMINAL,
+                                         fnode->label);
+        token = &_iter->forest->tokens[fnode->start];
+
+        node->lexeme        = token->lexeme;
+        node->lexeme_length = token->length;
+        node->line          = token->line;
+        node->column        = token->column;
+
+        return node;
+    }
+
+    node = d_parse_tree_node_create(D_PARSE_TREE_NODE_NONTERMINAL,
+                                    fnode->label);
+
+    if (_iter->choice[_node] != D_PARSE_FOREST_NONE)
+    {
+        node->production_index =
+            _iter->forest->packed[_iter->choice[_node]].production_index;
+    }
+
+    return node;
+}
+
+/*
+d_parse_forest_iter_build_tree
+  Materialize the currently selected tree as a d_parse_tree_node (caller must
+free it with d_parse_tree_node_destroy). As in d_parse_forest_build, the
+array of created nodes doubles as the work list: a nonterminal is appended
+when it is created and receives its children when the loop gets to it, so
+no recursion is needed however deep the tree is. A node's children are the
+last symbols of its binarized derivation, read back along the chain of
+intermediate nodes.
+*/
+static struct d_parse_tree_node*
+d_parse_forest_iter_build_tree
+(
+    const struct d_parse_forest_iter* _iter
+)
+{
+    const struct d_parse_forest*        forest;
+    struct d_parse_forest_iter_pending* pending;
+    uint32_t*                           rights;
+    struct d_parse_tree_node*           root;
+    struct d_parse_tree_node*           child;
+    size_t                              pending_count;
+    size_t                              pending_capacity;
+    size_t                              next;
+    uint32_t                            right_count;
+    uint32_t                            packed;
+    uint32_t                            left;
+    uint32_t                            i;
+
+    if ( (!_iter)           ||
+         (!_iter->forest)   ||
+         (!_iter->started)  ||
+         (_iter->exhausted) )
+    {
+        return NULL;
+    }
+
+    forest           = _iter->forest;
+    pending_capacity = (size_t)forest->node_count + 1u;
+    pending          = d_parse_rt_calloc(pending_capacity,
+                                         sizeof(*pending));
+    // a chain of intermediate nodes never repeats a node in an acyclic tree
+    rights           = d_parse_rt_calloc((size_t)forest->node_count + 1u,
+                                         sizeof(uint32_t));
+
+    root            = d_parse_forest_iter_make_node(_iter, forest->root);
+    pending[0].node = forest->root;
+    pending[0].tree = root;
+    pending_count   = 1u;
+
+    for (next = 0u; next < pending_count; ++next)
+    {
+        struct d_parse_tree_node* parent;
+
+        parent = pending[next].tree;
+        packed = _iter->choice[pending[next].node];
+
+        if ( (forest->nodes[pending[next].node].kind ==
+                  D_PARSE_FOREST_NODE_TERMINAL) ||
+             (packed == D_PARSE_FOREST_NONE) )
+        {
+            continue;
+        }
+
+        // intermediate nodes contribute their children, not themselves; the
+        // chain yields the children last to first
+        right_count = 0u;
+
+        while (packed != D_PARSE_FOREST_NONE)
+        {
+            if (forest->packed[packed].right != D_PARSE_FOREST_NONE)
+            {
+                rights[right_count++] = forest->packed[packed].right;
+            }
+
+            left   = forest->packed[packed].left;
+            packed = (left != D_PARSE_FOREST_NONE)
+                ? _iter->choice[left]
+                : D_PARSE_FOREST_NONE;
+        }
+
+        for (i = right_count; i > 0u; --i)
+        {
+            child = d_parse_forest_iter_make_node(_iter, rights[i - 1u]);
+
+            d_parse_tree_node_add_child(parent, child);
+
+            if (child->type != D_PARSE_TREE_NODE_NONTERMINAL)
+            {
+                continue;
+            }
+
+            if (pending_count == pending_capacity)
+            {
+                pending_capacity *= 2u;
+                pending           = d_parse_rt_realloc(
+                    pending,
+                    pending_capacity * sizeof(*pending));
+            }
+
+            pending[pending_count].node = rights[i - 1u];
+            pending[pending_count].tree = child;
+            pending_count++;
+        }
+    }
+
+    free(rights);
+    free(pending);
+
+    return root;
+}
+
+/*
+d_parse_forest_iter_destroy
+  Free the enumeration state of an iterator.
+*/
+static void
+d_parse_forest_iter_destroy
+(
+    struct d_parse_forest_iter* _iter
+)
+{
+    if (!_iter)
+    {
+        return;
+    }
+
+    free(_iter->choice);
+    free(_iter->order);
+    free(_iter->visited);
+    free(_iter->stack);
+
+    memset(_iter, 0, sizeof(*_iter));
+
+    return;
+}
+
+/* ============================================================================
+ * Main parsing interface
+ * ========================================================================== */
+
+/*
+d_parse_runtime_init
+  Initialize the runtime parser.
+
+Parameter(s):
+  _runtime: the runtime parser state to initialize.
+  _grammar: the grammar to parse against (must remain valid during parsing).
+  _config:  optional lexer configuration (NULL for defaults).
+*/
+static void
+d_parse_runtime_init
+(
+    struct d_parse_runtime*               _runtime,
+    const struct d_parse_grammar*         _grammar,
+    const struct d_parse_rt_lexer_config* _config
+)
+{
+    if ( (!_runtime) || 
+         (!_grammar) )
+    {
+        return;
+    }
+
+    memset(_runtime, 0, sizeof(*_runtime));
+
+    _runtime->grammar = _grammar;
+
+    if (_config)
+    {
+        _runtime->config = *_config;
+    }
+    else
+    {
+        d_parse_rt_lexer_config_init_default(&_runtime->config);
+    }
+
+    d_parse_earley_chart_init(&_runtime->chart);
+
+    return;
+}
+
+/*
+d_parse_runtime_destroy
+  Clean up runtime parser resources.
+*/
+static void
+d_parse_runtime_destroy
+(
+    struct d_parse_runtime* _runtime
+)
+{
+    if (!_runtime)
+    {
+        return;
+    }
+
+    d_parse_rt_lexer_destroy(&_runtime->lexer);
+    d_parse_earley_chart_destroy(&_runtime->chart);
+
+    if (_runtime->tokens)
+    {
+        free(_runtime->tokens);
+    }
+
+    memset(_runtime, 0, sizeof(*_runtime));
+
+    return;
+}
+
+/*
+d_parse_runtime_tokenize
+  Tokenize the input and store tokens.
+*/
+static void
+d_parse_runtime_tokenize
+(
+    struct d_parse_runtime* _runtime,
+    const char*             _input
+)
+{
+    struct d_parse_rt_token token;
+    size_t                  new_capacity;
+
+    if ( (!_runtime) || 
+         (!_input) )
+    {
+        return;
+    }
+
+    d_parse_rt_lexer_init(&_runtime->lexer,
+                          _input,
+                          _runtime->grammar,
+                          &_runtime->config);
+
+    // clear existing tokens
+    _runtime->token_count = 0u;
+
+    for (;;)
+    {
+        token = d_parse_rt_lexer_next(&_runtime->lexer);
+
+        // skip whitespace/indent tokens for basic mode
+        if ( (!_runtime->config.track_indentation) && 
+             ( (token.type == D_PARSE_RT_TOKEN_WHITESPACE) ||
+               (token.type == D_PARSE_RT_TOKEN_NEWLINE) ) )
+        {
+            continue;
+        }
+
+        // add token to buffer
+        if (_runtime->token_count == _runtime->token_capacity)
+        {
+            new_capacity = (_runtime->token_capacity != 0u)
+                ? (_runtime->token_capacity * 2u)
+                : 64u;
+
+            _runtime->tokens = d_parse_rt_realloc(
+                _runtime->tokens,
+                new_capacity * sizeof(struct d_parse_rt_token));
+
+            _runtime->token_capacity = new_capacity;
+        }
+
+        _runtime->tokens[_runtime->token_count] = token;
+        _runtime->token_count += 1u;
+
+        if (token.type == D_PARSE_RT_TOKEN_EOF)
+        {
+            break;
+        }
+    }
+
+    return;
+}
+
+/*
+d_parse_runtime_recognize
+  Tokenize the input and fill the Earley chart. On failure the error fields of
+`_result` are set.
+
+Return:
+  1 if the input is in the language of the grammar, 0 otherwise.
+*/
+static int
+d_parse_runtime_recognize
+(
+    struct d_parse_runtime* _runtime,
+    const char*             _input,
+    struct d_parse_result*  _result
+)
+{
+    const struct d_parse_grammar* grammar;
+    struct d_parse_earley_set*    initial_set;
+    struct d_parse_earley_set*    final_set;
+    size_t                        final_pos;
+    size_t                        furthest;
+    size_t                        i;
+    size_t                        k;
+
+    grammar = _runtime->grammar;
+
+    if ( (!grammar) || 
+         (grammar->start_symbol_index < 0) )
+    {
+        _result->error_message = "Invalid grammar or no start symbol";
+
+        return 0;
+    }
+
+    // tokenize input
+    d_parse_runtime_tokenize(_runtime, _input);
+
+    // reset chart
+    d_parse_earley_chart_destroy(&_runtime->chart);
+    d_parse_earley_chart_init(&_runtime->chart);
+
+    // initialize S[0] with start symbol productions
+    initial_set = d_parse_earley_chart_get_set(&_runtime->chart, 0u);
+
+    for (i = 0u; i < grammar->production_count; ++i)
+    {
+        if (grammar->productions[i].lhs_index == grammar->start_symbol_index)
+        {
+            d_parse_earley_set_add(initial_set, (int)i, 0u, 0u);
+        }
+    }
+
+    // main Earley parsing loop
+    for (k = 0u; k < _runtime->token_count; ++k)
+    {
+        struct d_parse_rt_token* token;
+
+        // process current set (predictor, completer)
+        d_parse_earley_process_set(grammar, &_runtime->chart, k);
+
+        token = &_runtime->tokens[k];
+
+        // skip EOF for scanning
+        if (token->type == D_PARSE_RT_TOKEN_EOF)
+        {
+            break;
+        }
+
+        // scanner: process terminals. Scanning may grow (and move) the
+        // chart's set array, so S[k] is re-read on every step.
+        for (i = 0u; i < _runtime->chart.sets[k].count; ++i)
+        {
+            d_parse_earley_scanner(grammar,
+                                   &_runtime->chart,
+                                   _runtime->chart.sets[k].items[i],
+                                   k,
+                                   token);
+        }
+    }
+
+    // final processing of last set
+    d_parse_earley_process_set(grammar,
+                               &_runtime->chart,
+                               _runtime->token_count - 1u);
+
+    // check for successful parse: look for completed start symbol items
+    final_pos = _runtime->token_count - 1u;
+    final_set = d_parse_earley_chart_get_set(&_runtime->chart, final_pos);
+
+    for (i = 0u; i < final_set->count; ++i)
+    {
+        struct d_parse_earley_item*      item;
+        const struct d_parse_production* prod;
+
+        item = final_set->items[i];
+        prod = &grammar->productions[item->production_index];
+
+        // a completed start symbol production from origin 0
+        if ( (prod->lhs_index == grammar->start_symbol_index) && 
+             (item->origin == 0u)                             && 
+             d_parse_earley_is_complete(grammar, item) )
+        {
+            return 1;
+        }
+    }
+
+    // find the furthest position reached for error reporting
+    furthest = 0u;
+
+    for (k = 0u; k < _runtime->chart.count; ++k)
+    {
+        if (_runtime->chart.sets[k].count > 0u)
+        {
+            furthest = k;
+        }
+    }
+
+    if (furthest < _runtime->token_count)
+    {
+        _result->error_line   = _runtime->tokens[furthest].line;
+        _result->error_column = _runtime->tokens[furthest].column;
+    }
+
+    _result->error_message = "Parse failed: unexpected token";
+
+    return 0;
+}
+
+/*
+d_parse_runtime_parse
+  Parse input text against the loaded grammar.
+
+Parameter(s):
+  _runtime: initialized runtime parser.
+  _input:   the input text to parse.
+  _result:  output parse result (caller must call d_parse_result_destroy).
+
+Return:
+  1 if parsing succeeded, 0 if failed.
+*/
+static int
+d_parse_runtime_parse
+(
+    struct d_parse_runtime* _runtime,
+    const char*             _input,
+    struct d_parse_result*  _result
+)
+{
+    const struct d_parse_grammar* grammar;
+    struct d_parse_earley_set*    final_set;
+    size_t                        final_pos;
+    size_t                        i;
+
+    if ( (!_runtime) || 
+         (!_input)   || 
+         (!_result) )
+    {
+        return 0;
+    }
+
+    d_parse_result_init(_result);
+
+    if (!d_parse_runtime_recognize(_runtime, _input, _result))
+    {
+        return 0;
+    }
+
+    grammar   = _runtime->grammar;
+    final_pos = _runtime->token_count - 1u;
+    final_set = d_parse_earley_chart_get_set(&_runtime->chart, final_pos);
+
+    for (i = 0u; i < final_set->count; ++i)
+    {
+        struct d_parse_earley_item*      item;
+        const struct d_parse_production* prod;
+        struct d_parse_tree_node*        tree;
+
+        item = final_set->items[i];
+        prod = &grammar->productions[item->production_index];
+
+        if ( (prod->lhs_index != grammar->start_symbol_index) ||
+             (item->origin != 0u)                             ||
+             (!d_parse_earley_is_complete(grammar, item)) )
+        {
+            continue;
+        }
+
+        // build parse tree
+        tree = d_parse_build_tree_from_item(grammar,
+                                            item,
+                                            _runtime->tokens,
+                                            _runtime->token_count,
+                                            final_pos);
+
+        if (tree)
+        {
+            d_parse_result_add_tree(_result, tree);
+        }
+    }
+
+    _result->success = 1;
+
+    return 1;
+}
+
+/*
+d_parse_runtime_parse_forest
+  Parse input text and return every derivation as a single shared packed
+parse forest instead of a list of independently allocated trees. Use
+d_parse_forest_iter_* to enumerate the trees lazily.
+
+Parameter(s):
+  _runtime: initialized runtime parser; its token buffer is referenced by the
+            forest and must outlive it (or the next parse).
+  _input:   the input text to parse.
+  _result:  output status and error location; `trees` is left empty.
+  _forest:  output forest (caller must call d_parse_forest_destroy).
+
+Return:
+  1 if parsing succeeded, 0 if failed.
+*/
+static int
+d_parse_runtime_parse_forest
+(
+    struct d_parse_runtime* _runtime,
+    const char*             _input,
+    struct d_parse_result*  _result,
+    struct d_parse_forest*  _forest
+)
+{
+    if ( (!_runtime) || 
+         (!_input)   || 
+         (!_result)  ||
+         (!_forest) )
+    {
+        return 0;
+    }
+
+    d_parse_result_init(_result);
+    d_parse_forest_init(_forest);
+
+    if (!d_parse_runtime_recognize(_runtime, _input, _result))
+    {
+        return 0;
     }
 
+    _forest->tokens      = _runtime->tokens;
+    _forest->token_count = _runtime->token_count;
+    _forest->root        = d_parse_forest_build(
+                               _forest,
+                               _runtime->grammar,
+                               &_runtime->chart,
+                               _runtime->grammar->start_symbol_index,
+                               0u,
+                               _runtime->token_count - 1u);
+
     _result->success = 1;
 
     return 1;
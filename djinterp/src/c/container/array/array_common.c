@@ -1730,7 +1730,7 @@ d_array_common_shift_right_circular
 
 /*
 d_array_common_sort
-  Sort elements in the array using provided comparator.
+  Sort elements in the array using provided comparator (see d_array_sort).
 
 Parameter(s):
   _elements:    pointer to elements array
@@ -1757,7 +1757,7 @@ d_array_common_sort
         return;
     }
 
-    qsort(_elements, _count, _element_size, _comparator);
+    d_array_sort(_elements, _count, _element_size, _comparator);
 
     return;
 }
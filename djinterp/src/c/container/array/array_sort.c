@@ -0,0 +1,817 @@
+/******************************************************************************
+* djinterp [container]                                            array_sort.c
+*
+*   Implementation of the comparator, typed and radix array sorts.
+*
+*
+* path:      \src\container\array\array_sort.c
+* link:      TBA
+* author(s): Samuel 'teer' Neal-Blim                          date: 2026.10.18
+******************************************************************************/
+#include "../../../../inc/c/container/array/array_sort.h"
+
+
+// =============================================================================
+// internal helper functions
+// =============================================================================
+
+// D_INTERNAL_ARRAY_SORT_TOP_BIT
+//   macro: the most significant bit of unsigned type `_bits`.
+#define D_INTERNAL_ARRAY_SORT_TOP_BIT(_bits)                                  \
+    ((_bits)1 << ((sizeof(_bits) * CHAR_BIT) - 1))
+
+// D_INTERNAL_ARRAY_SORT_TRANSFORM_<kind>
+//   macro: maps the raw bits `_u` of a value onto an unsigned integer that
+// orders like the value.
+#define D_INTERNAL_ARRAY_SORT_TRANSFORM_SIGNED(_bits, _u)                     \
+    ((_bits)((_u) ^ D_INTERNAL_ARRAY_SORT_TOP_BIT(_bits)))
+#define D_INTERNAL_ARRAY_SORT_TRANSFORM_UNSIGNED(_bits, _u)                   \
+    ((_bits)(_u))
+#define D_INTERNAL_ARRAY_SORT_TRANSFORM_FLOAT(_bits, _u)                      \
+    ((_bits)((_u) ^ ( (_bits)((_bits)0 - ((_u) >> ((sizeof(_bits) * CHAR_BIT) - 1))) | \
+                      D_INTERNAL_ARRAY_SORT_TOP_BIT(_bits) )))
+
+// D_INTERNAL_ARRAY_SORT_LESS_<kind>
+//   macro: strict ordering of two values. Integers compare directly; floats
+// compare their transformed bits so NaNs have a place in the order.
+#define D_INTERNAL_ARRAY_SORT_LESS_SIGNED(_suffix, _a, _b)                    \
+    ((_a) < (_b))
+#define D_INTERNAL_ARRAY_SORT_LESS_UNSIGNED(_suffix, _a, _b)                  \
+    ((_a) < (_b))
+#define D_INTERNAL_ARRAY_SORT_LESS_FLOAT(_suffix, _a, _b)                     \
+    ( d_array_sort_internal_key_##_suffix(_a) <                               \
+      d_array_sort_internal_key_##_suffix(_b) )
+
+/*
+d_array_sort_internal_depth_limit
+  Recursion budget for introsort: twice the floor of log2(count).
+*/
+D_STATIC_INLINE size_t
+d_array_sort_internal_depth_limit
+(
+    size_t _count
+)
+{
+    size_t depth;
+
+    depth = 0;
+
+    while (_count > 1)
+    {
+        _count >>= 1;
+        depth++;
+    }
+
+    return 2 * depth;
+}
+
+/*
+d_array_sort_internal_swap
+  Swaps two elements eight bytes at a time. memcpy through a local keeps
+the accesses alignment-safe and compiles down to plain moves.
+*/
+D_STATIC_INLINE void
+d_array_sort_internal_swap
+(
+    char*  _a,
+    char*  _b,
+    size_t _size
+)
+{
+    uint64_t word;
+    char     byte;
+
+    while (_size >= sizeof(word))
+    {
+        memcpy(&word, _a, sizeof(word));
+        memcpy(_a, _b, sizeof(word));
+        memcpy(_b, &word, sizeof(word));
+
+        _a    += sizeof(word);
+        _b    += sizeof(word);
+        _size -= sizeof(word);
+    }
+
+    while (_size > 0)
+    {
+        byte = *_a;
+        *_a  = *_b;
+        *_b  = byte;
+
+        _a++;
+        _b++;
+        _size--;
+    }
+
+    return;
+}
+
+/*
+d_array_sort_internal_insertion
+  Insertion sort of a short range of opaque elements.
+*/
+static void
+d_array_sort_internal_insertion
+(
+    char*         _elements,
+    size_t        _count,
+    size_t        _size,
+    fn_comparator _comparator
+)
+{
+    size_t i;
+    size_t j;
+
+    for (i = 1; i < _count; i++)
+    {
+        for (j = i;
+             (j > 0) &&
+             (_comparator(_elements + ((j - 1) * _size),
+                          _elements + (j * _size)) > 0);
+             j--)
+        {
+            d_array_sort_internal_swap(_elements + ((j - 1) * _size),
+                                       _elements + (j * _size),
+                                       _size);
+        }
+    }
+
+    return;
+}
+
+/*
+d_array_sort_internal_heapsort
+  Heapsort of opaque elements; the introsort fallback that bounds the worst
+case at O(n log n).
+*/
+static void
+d_array_sort_internal_heapsort
+(
+    char*         _elements,
+    size_t        _count,
+    size_t        _size,
+    fn_comparator _comparator
+)
+{
+    size_t start;
+    size_t end;
+    size_t root;
+    size_t child;
+
+    for (start = _count / 2; start-- > 0; )
+    {
+        for (root = start; (child = (2 * root) + 1) < _count; root = child)
+        {
+            if ( (child + 1 < _count) &&
+                 (_comparator(_elements + (child * _size),
+                              _elements + ((child + 1) * _size)) < 0) )
+            {
+                child++;
+            }
+
+            if (_comparator(_elements + (root * _size),
+                            _elements + (child * _size)) >= 0)
+            {
+                break;
+            }
+
+            d_array_sort_internal_swap(_elements + (root * _size),
+                                       _elements + (child * _size),
+                                       _size);
+        }
+    }
+
+    for (end = _count - 1; end > 0; end--)
+    {
+        d_array_sort_internal_swap(_elements, _elements + (end * _size), _size);
+
+        for (root = 0; (child = (2 * root) + 1) < end; root = child)
+        {
+            if ( (child + 1 < end) &&
+                 (_comparator(_elements + (child * _size),
+                              _elements + ((child + 1) * _size)) < 0) )
+            {
+                child++;
+            }
+
+            if (_comparator(_elements + (root * _size),
+                            _elements + (child * _size)) >= 0)
+            {
+                break;
+            }
+
+            d_array_sort_internal_swap(_elements + (root * _size),
+                                       _elements + (child * _size),
+                                       _size);
+        }
+    }
+
+    return;
+}
+
+/*
+d_array_sort_internal_introsort
+  Introsort of opaque elements. The pivot is the median of the first,
+middle and last elements; those three are ordered first so that they act as
+sentinels for the Hoare scans. The pivot pointer follows its element
+through swaps, so no copy of it is needed. The smaller side is sorted
+recursively and the larger one iteratively, keeping the stack O(log n).
+*/
+static void
+d_array_sort_internal_introsort
+(
+    char*         _elements,
+    size_t        _count,
+    size_t        _size,
+    fn_comparator _comparator,
+    size_t        _depth
+)
+{
+    char*  first;
+    char*  middle;
+    char*  last;
+    char*  pivot;
+    char*  lo;
+    char*  hi;
+    size_t left;
+
+    while (_count > D_ARRAY_SORT_INSERTION_THRESHOLD)
+    {
+        if (_depth == 0)
+        {
+            d_array_sort_internal_heapsort(_elements, _count, _size, _comparator);
+
+            return;
+        }
+
+        _depth--;
+
+        first  = _elements;
+        middle = _elements + (((_count - 1) / 2) * _size);
+        last   = _elements + ((_count - 1) * _size);
+
+        if (_comparator(middle, first) < 0)
+        {
+            d_array_sort_internal_swap(middle, first, _size);
+        }
+
+        if (_comparator(last, middle) < 0)
+        {
+            d_array_sort_internal_swap(last, middle, _size);
+
+            if (_comparator(middle, first) < 0)
+            {
+                d_array_sort_internal_swap(middle, first, _size);
+            }
+        }
+
+        pivot = middle;
+        lo    = first;
+        hi    = last;
+
+        // Hoare partition: [first, hi] <= pivot <= [hi + size, last]
+        for (;;)
+        {
+            while (_comparator(lo, pivot) < 0)
+            {
+                lo += _size;
+            }
+
+            while (_comparator(pivot, hi) < 0)
+            {
+                hi -= _size;
+            }
+
+            if (lo >= hi)
+            {
+                break;
+            }
+
+            d_array_sort_internal_swap(lo, hi, _size);
+
+            if (pivot == lo)
+            {
+                pivot = hi;
+            }
+            else if (pivot == hi)
+            {
+                pivot = lo;
+            }
+
+            lo += _size;
+            hi -= _size;
+        }
+
+        left = ((size_t)(hi - _elements) / _size) + 1;
+
+        if (left < _count - left)
+        {
+            d_array_sort_internal_introsort(_elements, left, _size, _comparator, _depth);
+
+            _elements += left * _size;
+            _count    -= left;
+        }
+        else
+        {
+            d_array_sort_internal_introsort(_elements + (left * _size),
+                                            _count - left,
+                                            _size,
+                                            _comparator,
+                                            _depth);
+
+            _count = left;
+        }
+    }
+
+    d_array_sort_internal_insertion(_elements, _count, _size, _comparator);
+
+    return;
+}
+
+// D_INTERNAL_ARRAY_SORT_DEFINE_TYPED
+//   macro: defines the typed sorts for one D_ARRAY_SORT_TYPES tuple. The
+// comparison sort mirrors d_array_sort_internal_introsort with values in
+// place of pointers; the radix sort builds every digit histogram in one read
+// pass and skips digits on which all keys agree.
+#define D_INTERNAL_ARRAY_SORT_DEFINE_TYPED(_suffix, _type, _bits, _kind)      \
+                                                                              \
+    D_STATIC_INLINE _bits                                                     \
+    d_array_sort_internal_key_##_suffix                                       \
+    (                                                                         \
+        _type _value                                                          \
+    )                                                                         \
+    {                                                                         \
+        _bits raw;                                                            \
+                                                                              \
+        memcpy(&raw, &_value, sizeof(raw));                                   \
+                                                                              \
+        return D_INTERNAL_ARRAY_SORT_TRANSFORM_##_kind(_bits, raw);           \
+    }                                                                         \
+                                                                              \
+    D_STATIC_INLINE bool                                                      \
+    d_array_sort_internal_less_##_suffix                                      \
+    (                                                                         \
+        _type _a,                                                             \
+        _type _b                                                              \
+    )                                                                         \
+    {                                                                         \
+        return D_INTERNAL_ARRAY_SORT_LESS_##_kind(_suffix, _a, _b);           \
+    }                                                                         \
+                                                                              \
+    static void                                                               \
+    d_array_sort_internal_insertion_##_suffix                                 \
+    (                                                                         \
+        _type* _elements,                                                     \
+        size_t _count                                                         \
+    )                                                                         \
+    {                                                                         \
+        _type  value;                                                         \
+        size_t i;                                                             \
+        size_t j;                                                             \
+                                                                              \
+        for (i = 1; i < _count; i++)                                          \
+        {                                                                     \
+            value = _elements[i];                                             \
+                                                                              \
+            for (j = i;                                                       \
+                 (j > 0) &&                                                   \
+                 (d_array_sort_internal_less_##_suffix(value,                 \
+                                                       _elements[j - 1]));    \
+                 j--)                                                         \
+            {                                                                 \
+                _elements[j] = _elements[j - 1];                              \
+            }                                                                 \
+                                                                              \
+            _elements[j] = value;                                             \
+        }                                                                     \
+                                                                              \
+        return;                                                               \
+    }                                                                         \
+                                                                              \
+    static void                                                               \
+    d_array_sort_internal_sift_##_suffix                                      \
+    (                                                                         \
+        _type* _elements,                                                     \
+        size_t _root,                                                         \
+        size_t _count                                                         \
+    )                                                                         \
+    {                                                                         \
+        _type  value;                                                         \
+        size_t child;                                                         \
+                                                                              \
+        value = _elements[_root];                                             \
+                                                                              \
+        while ((child = (2 * _root) + 1) < _count)                            \
+        {                                                                     \
+            if ( (child + 1 < _count) &&                                      \
+                 (d_array_sort_internal_less_##_suffix(_elements[child],      \
+                                                       _elements[child + 1])) ) \
+            {                                                                 \
+                child++;                                                      \
+            }                                                                 \
+                                                                              \
+            if (!d_array_sort_internal_less_##_suffix(value, _elements[child])) \
+            {                                                                 \
+                break;                                                        \
+            }                                                                 \
+                                                                              \
+            _elements[_root] = _elements[child];                              \
+            _root            = child;                                         \
+        }                                                                     \
+                                                                              \
+        _elements[_root] = value;                                             \
+                                                                              \
+        return;                                                               \
+    }                                                                         \
+                                                                              \
+    static void                                                               \
+    d_array_sort_internal_introsort_##_suffix                                 \
+    (                                                                         \
+        _type* _elements,                                                     \
+        size_t _count,                                                        \
+        size_t _depth                                                         \
+    )                                                                         \
+    {                                                                         \
+        _type  pivot;                                                         \
+        _type  swap;                                                          \
+        size_t middle;                                                        \
+        size_t lo;                                                            \
+        size_t hi;                                                            \
+        size_t i;                                                             \
+                                                                              \
+        while (_count > D_ARRAY_SORT_INSERTION_THRESHOLD)                     \
+        {                                                                     \
+            if (_depth == 0)                                                  \
+            {                                                                 \
+                for (i = _count / 2; i-- > 0; )                               \
+                {                                                             \
+                    d_array_sort_internal_sift_##_suffix(_elements, i, _count); \
+                }                                                             \
+                                                                              \
+                for (i = _count - 1; i > 0; i--)                              \
+                {                                                             \
+                    swap          = _elements[0];                             \
+                    _elements[0]  = _elements[i];                             \
+                    _elements[i]  = swap;                                     \
+                    d_array_sort_internal_sift_##_suffix(_elements, 0, i);    \
+                }                                                             \
+                                                                              \
+                return;                                                       \
+            }                                                                 \
+                                                                              \
+            _depth--;                                                         \
+            middle = (_count - 1) / 2;                                        \
+                                                                              \
+            if (d_array_sort_internal_less_##_suffix(_elements[middle],       \
+                                                     _elements[0]))           \
+            {                                                                 \
+                swap              = _elements[middle];                        \
+                _elements[middle] = _elements[0];                             \
+                _elements[0]      = swap;                                     \
+            }                                                                 \
+                                                                              \
+            if (d_array_sort_internal_less_##_suffix(_elements[_count - 1],   \
+                                                     _elements[middle]))      \
+            {                                                                 \
+                swap                  = _elements[_count - 1];                \
+                _elements[_count - 1] = _elements[middle];                    \
+                _elements[middle]     = swap;                                 \
+                                                                              \
+                if (d_array_sort_internal_less_##_suffix(_elements[middle],   \
+                                                         _elements[0]))       \
+                {                                                             \
+                    swap              = _elements[middle];                    \
+                    _elements[middle] = _elements[0];                         \
+                    _elements[0]      = swap;                                 \
+                }                                                             \
+            }                                                                 \
+                                                                              \
+            pivot = _elements[middle];                                        \
+            lo    = 0;                                                        \
+            hi    = _count - 1;                                               \
+                                                                              \
+            for (;;)                                                          \
+            {                                                                 \
+                while (d_array_sort_internal_less_##_suffix(_elements[lo], pivot)) \
+                {                                                             \
+                    lo++;                                                     \
+                }                                                             \
+                                                                              \
+                while (d_array_sort_internal_less_##_suffix(pivot, _elements[hi])) \
+                {                                                             \
+                    hi--;                                                     \
+                }                                                             \
+                                                                              \
+                if (lo >= hi)                                                 \
+                {                                                             \
+                    break;                                                    \
+                }                                                             \
+                                                                              \
+                swap          = _elements[lo];                                \
+                _elements[lo] = _elements[hi];                                \
+                _elements[hi] = swap;                                         \
+                lo++;                                                         \
+                hi--;                                                         \
+            }                                                                 \
+                                                                              \
+            hi++;                                                             \
+                                                                              \
+            if (hi < _count - hi)                                             \
+            {                                                                 \
+                d_array_sort_internal_introsort_##_suffix(_elements, hi, _depth); \
+                _elements += hi;                                              \
+                _count    -= hi;                                              \
+            }                                                                 \
+            else                                                              \
+            {                                                                 \
+                d_array_sort_internal_introsort_##_suffix(_elements + hi,     \
+                                                          _count - hi,        \
+                                                          _depth);            \
+                _count = hi;                                                  \
+            }                                                                 \
+        }                                                                     \
+                                                                              \
+        d_array_sort_internal_insertion_##_suffix(_elements, _count);         \
+                                                                              \
+        return;                                                               \
+    }                                                                         \
+                                                                              \
+    void                                                                      \
+    d_array_sort_##_suffix                                                    \
+    (                                                                         \
+        _type* _elements,                                                     \
+        size_t _count                                                         \
+    )                                                                         \
+    {                                                                         \
+        if ( (!_elements) ||                                                  \
+             (_count < 2) )                                                   \
+        {                                                                     \
+            return;                                                           \
+        }                                                                     \
+                                                                              \
+        d_array_sort_internal_introsort_##_suffix(                            \
+            _elements,                                                        \
+            _count,                                                           \
+            d_array_sort_internal_depth_limit(_count));                       \
+                                                                              \
+        return;                                                               \
+    }                                                                         \
+                                                                              \
+    D_STATIC_INLINE bool                                                      \
+    d_array_sort_internal_radix_##_suffix                                     \
+    (                                                                         \
+        char*  _elements,                                                     \
+        size_t _count,                                                        \
+        size_t _element_size,                                                 \
+        size_t _key_offset                                                    \
+    )                                                                         \
+    {                                                                         \
+        size_t histogram[sizeof(_bits)][256];                                 \
+        size_t offset;                                                        \
+        size_t next;                                                          \
+        size_t digit;                                                         \
+        size_t i;                                                             \
+        _type  value;                                                         \
+        _bits  key;                                                           \
+        char*  buffer;                                                        \
+        char*  from;                                                          \
+        char*  to;                                                            \
+        char*  swap;                                                          \
+                                                                              \
+        buffer = malloc(_count * _element_size);                              \
+                                                                              \
+        if (!buffer)                                                          \
+        {                                                                     \
+            return false;                                                     \
+        }                                                                     \
+                                                                              \
+        memset(histogram, 0, sizeof(histogram));                              \
+                                                                              \
+        for (i = 0; i < _count; i++)                                          \
+        {                                                                     \
+            memcpy(&value,                                                    \
+                   _elements + (i * _element_size) + _key_offset,             \
+                   sizeof(value));                                            \
+            key = d_array_sort_internal_key_##_suffix(value);                 \
+                                                                              \
+            for (digit = 0; digit < sizeof(_bits); digit++)                   \
+            {                                                                 \
+                histogram[digit][(key >> (digit * 8)) & 0xFF]++;              \
+            }                                                                 \
+        }                                                                     \
+                                                                              \
+        from = _elements;                                                     \
+        to   = buffer;                                                        \
+                                                                              \
+        for (digit = 0; digit < sizeof(_bits); digit++)                       \
+        {                                                                     \
+            memcpy(&value, from + _key_offset, sizeof(value));                \
+            key = d_array_sort_internal_key_##_suffix(value);                 \
+                                                                              \
+            /* every key shares this digit: the pass would be a copy */       \
+            if (histogram[digit][(key >> (digit * 8)) & 0xFF] == _count)      \
+            {                                                                 \
+                continue;                                                     \
+            }                                                                 \
+                                                                              \
+            for (i = 0, offset = 0; i < 256; i++)                             \
+            {                                                                 \
+                next                 = offset + histogram[digit][i];          \
+                histogram[digit][i]  = offset;                                \
+                offset               = next;                                  \
+            }                                                                 \
+                                                                              \
+            for (i = 0; i < _count; i++)                                      \
+            {                                                                 \
+                memcpy(&value,                                                \
+                       from + (i * _element_size) + _key_offset,              \
+                       sizeof(value));                                        \
+                key = d_array_sort_internal_key_##_suffix(value);             \
+                                                                              \
+                memcpy(to + (histogram[digit][(key >> (digit * 8)) & 0xFF]++ * \
+                             _element_size),                                  \
+                       from + (i * _element_size),                            \
+                       _element_size);                                        \
+            }                                                                 \
+                                                                              \
+            swap = from;                                                      \
+            from = to;                                                        \
+            to   = swap;                                                      \
+        }                                                                     \
+                                                                              \
+        if (from != _elements)                                                \
+        {                                                                     \
+            memcpy(_elements, from, _count * _element_size);                  \
+        }                                                                     \
+                                                                              \
+        free(buffer);                                                         \
+                                                                              \
+        return true;                                                          \
+    }                                                                         \
+                                                                              \
+    void                                                                      \
+    d_array_radix_sort_##_suffix                                              \
+    (                                                                         \
+        _type* _elements,                                                     \
+        size_t _count                                                         \
+    )                                                                         \
+    {                                                                         \
+        if ( (!_elements) ||                                                  \
+             (_count < 2) )                                                   \
+        {                                                                     \
+            return;                                                           \
+        }                                                                     \
+                                                                              \
+        /* small inputs, or no memory for the buffer: sort in place */        \
+        if ( (_count < D_ARRAY_SORT_RADIX_THRESHOLD) ||                       \
+             (_count > (SIZE_MAX / sizeof(_type))) ||                         \
+             (!d_array_sort_internal_radix_##_suffix((char*)_elements,        \
+                                                     _count,                  \
+                                                     sizeof(_type),           \
+                                                     0)) )                    \
+        {                                                                     \
+            d_array_sort_##_suffix(_elements, _count);                        \
+        }                                                                     \
+                                                                              \
+        return;                                                               \
+    }                                                                         \
+                                                                              \
+    bool                                                                      \
+    d_array_sort_keyed_##_suffix                                              \
+    (                                                                         \
+        void*  _elements,                                                     \
+        size_t _count,                                                        \
+        size_t _element_size,                                                 \
+        size_t _key_offset                                                    \
+    )                                                                         \
+    {                                                                         \
+        if ( (!_elements)                                    ||               \
+             (_element_size < sizeof(_type))                 ||               \
+             (_key_offset > (_element_size - sizeof(_type))) ||               \
+             (_count > (SIZE_MAX / _element_size)) )                          \
+        {                                                                     \
+            return false;                                                     \
+        }                                                                     \
+                                                                              \
+        if (_count < 2)                                                       \
+        {                                                                     \
+            return true;                                                      \
+        }                                                                     \
+                                                                              \
+        return d_array_sort_internal_radix_##_suffix((char*)_elements,        \
+                                                     _count,                  \
+                                                     _element_size,           \
+                                                     _key_offset);            \
+    }
+
+// D_INTERNAL_ARRAY_SORT_DEFINE
+//   macro: unpacks a parenthesized tuple for D_FOR_EACH.
+#define D_INTERNAL_ARRAY_SORT_DEFINE(_tuple)                                  \
+    D_INTERNAL_ARRAY_SORT_DEFINE_TYPED _tuple
+
+
+// =============================================================================
+// comparator sort
+// =============================================================================
+
+/*
+d_array_sort
+  Sorts an array of opaque elements with a comparator. Unstable; does not
+allocate; O(n log n) worst case.
+
+Parameter(s):
+  _elements:     pointer to the first element
+  _count:        number of elements
+  _element_size: size in bytes of each element
+  _comparator:   ordering of elements
+Return:
+  none
+*/
+void
+d_array_sort
+(
+    void*         _elements,
+    size_t        _count,
+    size_t        _element_size,
+    fn_comparator _comparator
+)
+{
+    if ( (!_elements)          ||
+         (_element_size == 0)  ||
+         (!_comparator)        ||
+         (_count < 2) )
+    {
+        return;
+    }
+
+    d_array_sort_internal_introsort((char*)_elements,
+                                    _count,
+                                    _element_size,
+                                    _comparator,
+                                    d_array_sort_internal_depth_limit(_count));
+
+    return;
+}
+
+
+// =============================================================================
+// typed sorts
+// =============================================================================
+D_FOR_EACH(D_INTERNAL_ARRAY_SORT_DEFINE, D_ARRAY_SORT_TYPES)
+
+
+// =============================================================================
+// keyed sort dispatch
+// =============================================================================
+
+/*
+d_array_sort_keyed
+  Stable sort of records by a numeric key stored inside each record, chosen
+at run time. Records are moved whole, so the array stays an array of
+records.
+
+Parameter(s):
+  _elements:     pointer to the first record
+  _count:        number of records
+  _element_size: size in bytes of each record
+  _key:          type of the key
+  _key_offset:   byte offset of the key within a record (e.g. offsetof)
+Return:
+  - true if the records are sorted
+  - false if parameters are invalid or the scratch buffer could not be
+    allocated (the array is unchanged)
+*/
+bool
+d_array_sort_keyed
+(
+    void*                 _elements,
+    size_t                _count,
+    size_t                _element_size,
+    enum d_array_sort_key _key,
+    size_t                _key_offset
+)
+{
+    switch (_key)
+    {
+        case D_ARRAY_SORT_KEY_INT32:
+            return d_array_sort_keyed_int32(_elements, _count, _element_size, _key_offset);
+
+        case D_ARRAY_SORT_KEY_UINT32:
+            return d_array_sort_keyed_uint32(_elements, _count, _element_size, _key_offset);
+
+        case D_ARRAY_SORT_KEY_INT64:
+            return d_array_sort_keyed_int64(_elements, _count, _element_size, _key_offset);
+
+        case D_ARRAY_SORT_KEY_UINT64:
+            return d_array_sort_keyed_uint64(_elements, _count, _element_size, _key_offset);
+
+        case D_ARRAY_SORT_KEY_FLOAT:
+            return d_array_sort_keyed_float(_elements, _count, _element_size, _key_offset);
+
+        case D_ARRAY_SORT_KEY_DOUBLE:
+            return d_array_sort_keyed_double(_elements, _count, _element_size, _key_offset);
+
+        default:
+            return false;
+    }
+}
@@ -0,0 +1,866 @@
+/******************************************************************************
+* djinterp [container]                                   array_sort_parallel.c
+*
+*   Implementation of the sequential merge sort and the multithreaded sort
+* and run merge.
+*
+*
+* path:      \src\container\array\array_sort_parallel.c
+* link:      TBA
+* author(s): Samuel 'teer' Neal-Blim                          date: 2026.10.18
+******************************************************************************/
+#include "../../../../inc/c/container/array/array_sort_parallel.h"
+
+
+// =============================================================================
+// internal types
+// =============================================================================
+
+// d_array_sort_parallel_internal_job
+//   struct: state shared by every worker of one parallel sort or merge.
+struct d_array_sort_parallel_internal_job
+{
+    char*                  elements;
+    char*                  scratch;       // same size as `elements`
+    size_t                 element_size;
+    fn_comparator          comparator;
+    enum d_array_sort_mode mode;
+    bool                   sort_runs;     // sort each run before merging
+    size_t*                bounds;        // run i is [bounds[i], bounds[i + 1])
+    size_t                 run_count;
+    size_t                 worker_count;
+    d_mutex_t              lock;
+    d_cond_t               wake;
+    bool                   ready;         // set once worker_count is final
+    size_t                 waiting;       // workers parked at the barrier
+    size_t                 generation;    // barrier rounds completed
+};
+
+// d_array_sort_parallel_internal_worker
+//   struct: argument handed to each started thread.
+struct d_array_sort_parallel_internal_worker
+{
+    struct d_array_sort_parallel_internal_job* job;
+    size_t                                     index;
+};
+
+
+// =============================================================================
+// internal helper functions
+// =============================================================================
+
+/*
+d_array_sort_parallel_internal_split
+  Returns the start of part `_index` when `_count` elements are divided into
+`_parts` nearly equal parts.
+*/
+D_STATIC_INLINE size_t
+d_array_sort_parallel_internal_split
+(
+    size_t _count,
+    size_t _index,
+    size_t _parts
+)
+{
+    return (size_t)(((uint64_t)_count * (uint64_t)_index) / (uint64_t)_parts);
+}
+
+/*
+d_array_sort_parallel_internal_worker_count
+  Number of workers to use for `_count` elements: the requested thread
+count (0 meaning one per hardware thread), reduced so that each worker gets
+at least D_ARRAY_SORT_PARALLEL_GRAIN elements.
+*/
+static size_t
+d_array_sort_parallel_internal_worker_count
+(
+    size_t _count,
+    size_t _threads
+)
+{
+    size_t limit;
+
+    if (_threads == 0)
+    {
+        _threads = (d_thread_hardware_concurrency() > 0)
+                       ? (size_t)d_thread_hardware_concurrency()
+                       : 1;
+    }
+
+    limit = _count / D_ARRAY_SORT_PARALLEL_GRAIN;
+
+    if (limit < 1)
+    {
+        limit = 1;
+    }
+
+    return (_threads < limit) ? _threads : limit;
+}
+
+/*
+d_array_sort_parallel_internal_insertion
+  Stable insertion sort of a short range. `_temp` holds one element while it
+is being placed.
+*/
+static void
+d_array_sort_parallel_internal_insertion
+(
+    char*         _elements,
+    size_t        _count,
+    size_t        _size,
+    fn_comparator _comparator,
+    char*         _temp
+)
+{
+    size_t i;
+    size_t j;
+
+    for (i = 1; i < _count; i++)
+    {
+        if (_comparator(_elements + ((i - 1) * _size),
+                        _elements + (i * _size)) <= 0)
+        {
+            continue;
+        }
+
+        memcpy(_temp, _elements + (i * _size), _size);
+        j = i - 1;
+
+        while ( (j > 0) &&
+                (_comparator(_elements + ((j - 1) * _size), _temp) > 0) )
+        {
+            j--;
+        }
+
+        memmove(_elements + ((j + 1) * _size),
+                _elements + (j * _size),
+                (i - j) * _size);
+        memcpy(_elements + (j * _size), _temp, _size);
+    }
+
+    return;
+}
+
+/*
+d_array_sort_parallel_internal_merge
+  Stable merge of two sorted ranges into `_out`. On ties the element from
+`_a` goes first.
+*/
+static void
+d_array_sort_parallel_internal_merge
+(
+    const char*   _a,
+    size_t        _a_count,
+    const char*   _b,
+    size_t        _b_count,
+    char*         _out,
+    size_t        _size,
+    fn_comparator _comparator
+)
+{
+    while ( (_a_count > 0) &&
+            (_b_count > 0) )
+    {
+        if (_comparator(_b, _a) < 0)
+        {
+            memcpy(_out, _b, _size);
+            _b += _size;
+            _b_count--;
+        }
+        else
+        {
+            memcpy(_out, _a, _size);
+            _a += _size;
+            _a_count--;
+        }
+
+        _out += _size;
+    }
+
+    memcpy(_out, _a, _a_count * _size);
+    _out += _a_count * _size;
+    memcpy(_out, _b, _b_count * _size);
+
+    return;
+}
+
+/*
+d_array_sort_parallel_internal_co_rank
+  Merge path search: returns how many of the first `_k` elements of the
+stable merge of `_a` and `_b` come from `_a`. O(log min(a, b)).
+*/
+static size_t
+d_array_sort_parallel_internal_co_rank
+(
+    size_t        _k,
+    const char*   _a,
+    size_t        _a_count,
+    const char*   _b,
+    size_t        _b_count,
+    size_t        _size,
+    fn_comparator _comparator
+)
+{
+    size_t low;
+    size_t high;
+    size_t i;
+
+    low  = (_k > _b_count) ? (_k - _b_count) : 0;
+    high = (_k < _a_count) ? _k : _a_count;
+
+    while (low < high)
+    {
+        i = low + ((high - low) / 2);
+
+        // a[i] precedes b[k - i - 1], which is among the first k, so a[i]
+        // must be among them too
+        if (_comparator(_a + (i * _size),
+                        _b + ((_k - i - 1) * _size)) <= 0)
+        {
+            low = i + 1;
+        }
+        else
+        {
+            high = i;
+        }
+    }
+
+    return low;
+}
+
+/*
+d_array_sort_parallel_internal_merge_sort
+  Bottom-up stable merge sort of `_count` elements using `_scratch` (same
+size) for the merge passes. The result ends up in `_elements`.
+*/
+static void
+d_array_sort_parallel_internal_merge_sort
+(
+    char*         _elements,
+    char*         _scratch,
+    size_t        _count,
+    size_t        _size,
+    fn_comparator _comparator
+)
+{
+    char*  source;
+    char*  target;
+    char*  swap;
+    size_t width;
+    size_t start;
+    size_t middle;
+    size_t end;
+
+    for (start = 0; start < _count; start += D_ARRAY_SORT_INSERTION_THRESHOLD)
+    {
+        end = start + D_ARRAY_SORT_INSERTION_THRESHOLD;
+
+        if (end > _count)
+        {
+            end = _count;
+        }
+
+        d_array_sort_parallel_internal_insertion(_elements + (start * _size),
+                                                 end - start,
+                                                 _size,
+                                                 _comparator,
+                                                 _scratch);
+    }
+
+    source = _elements;
+    target = _scratch;
+
+    for (width = D_ARRAY_SORT_INSERTION_THRESHOLD; width < _count; width *= 2)
+    {
+        for (start = 0; start < _count; start += 2 * width)
+        {
+            middle = (start + width < _count) ? (start + width) : _count;
+            end    = (middle + width < _count) ? (middle + width) : _count;
+
+            // already in order across the seam: copy instead of merging
+            if ( (middle == end) ||
+                 (_comparator(source + ((middle - 1) * _size),
+                              source + (middle * _size)) <= 0) )
+            {
+                memcpy(target + (start * _size),
+                       source + (start * _size),
+                       (end - start) * _size);
+
+                continue;
+            }
+
+            d_array_sort_parallel_internal_merge(source + (start * _size),
+                                                 middle - start,
+                                                 source + (middle * _size),
+                                                 end - middle,
+                                                 target + (start * _size),
+                                                 _size,
+                                                 _comparator);
+        }
+
+        swap   = source;
+        source = target;
+        target = swap;
+    }
+
+    if (source != _elements)
+    {
+        memcpy(_elements, source, _count * _size);
+    }
+
+    return;
+}
+
+/*
+d_array_sort_parallel_internal_barrier
+  Blocks until every worker of the job has reached the barrier.
+*/
+static void
+d_array_sort_parallel_internal_barrier
+(
+    struct d_array_sort_parallel_internal_job* _job
+)
+{
+    size_t generation;
+
+    if (_job->worker_count < 2)
+    {
+        return;
+    }
+
+    d_mutex_lock(&_job->lock);
+
+    generation = _job->generation;
+    _job->waiting++;
+
+    if (_job->waiting == _job->worker_count)
+    {
+        _job->waiting = 0;
+        _job->generation++;
+        d_cond_broadcast(&_job->wake);
+    }
+    else
+    {
+        while (generation == _job->generation)
+        {
+            d_cond_wait(&_job->wake, &_job->lock);
+        }
+    }
+
+    d_mutex_unlock(&_job->lock);
+
+    return;
+}
+
+/*
+d_array_sort_parallel_internal_run
+  Work done by worker `_index`: sort its own run (when the job sorts runs),
+then take part in every merge round by producing output slice `_index` of
+each round.
+*/
+static void
+d_array_sort_parallel_internal_run
+(
+    struct d_array_sort_parallel_internal_job* _job,
+    size_t                                     _index
+)
+{
+    size_t size;
+    size_t total;
+    size_t slice_low;
+    size_t slice_high;
+    size_t width;
+    size_t first;
+    size_t start;
+    size_t middle;
+    size_t end;
+    size_t low;
+    size_t high;
+    size_t a_low;
+    size_t a_high;
+    char*  source;
+    char*  target;
+    char*  swap;
+
+    size  = _job->element_size;
+    total = _job->bounds[_job->run_count];
+
+    if (_job->sort_runs)
+    {
+        start = _job->bounds[_index];
+        end   = _job->bounds[_index + 1];
+
+        if (_job->mode == D_ARRAY_SORT_STABLE)
+        {
+            d_array_sort_parallel_internal_merge_sort(_job->elements + (start * size),
+                                                      _job->scratch + (start * size),
+                                                      end - start,
+                                                      size,
+                                                      _job->comparator);
+        }
+        else
+        {
+            d_array_sort(_job->elements + (start * size),
+                         end - start,
+                         size,
+                         _job->comparator);
+        }
+
+        d_array_sort_parallel_internal_barrier(_job);
+    }
+
+    slice_low  = d_array_sort_parallel_internal_split(total, _index, _job->worker_count);
+    slice_high = d_array_sort_parallel_internal_split(total, _index + 1, _job->worker_count);
+    source     = _job->elements;
+    target     = _job->scratch;
+
+    for (width = 1; width < _job->run_count; width *= 2)
+    {
+        for (first = 0; first < _job->run_count; first += 2 * width)
+        {
+            start  = _job->bounds[first];
+            middle = _job->bounds[(first + width < _job->run_count)
+                                      ? (first + width)
+                                      : _job->run_count];
+            end    = _job->bounds[(first + (2 * width) < _job->run_count)
+                                      ? (first + (2 * width))
+                                      : _job->run_count];
+
+            if (end <= slice_low)
+            {
+                continue;
+            }
+
+            if (start >= slice_high)
+            {
+                break;
+            }
+
+            // part of this pair's output that falls in our slice
+            low  = ((slice_low > start) ? slice_low : start) - start;
+            high = ((slice_high < end) ? slice_high : end) - start;
+
+            a_low  = d_array_sort_parallel_internal_co_rank(low,
+                                                            source + (start * size),
+                                                            middle - start,
+                                                            source + (middle * size),
+                                                            end - middle,
+                                                            size,
+                                                            _job->comparator);
+            a_high = d_array_sort_parallel_internal_co_rank(high,
+                                                            source + (start * size),
+                                                            middle - start,
+                                                            source + (middle * size),
+                                                            end - middle,
+                                                            size,
+                                                            _job->comparator);
+
+            d_array_sort_parallel_internal_merge(source + ((start + a_low) * size),
+                                                 a_high - a_low,
+                                                 source + ((middle + (low - a_low)) * size),
+                                                 (high - a_high) - (low - a_low),
+                                                 target + ((start + low) * size),
+                                                 size,
+                                                 _job->comparator);
+        }
+
+        d_array_sort_parallel_internal_barrier(_job);
+
+        swap   = source;
+        source = target;
+        target = swap;
+    }
+
+    // an odd number of rounds leaves the result in scratch
+    if (source != _job->elements)
+    {
+        memcpy(_job->elements + (slice_low * size),
+               source + (slice_low * size),
+               (slice_high - slice_low) * size);
+    }
+
+    return;
+}
+
+/*
+d_array_sort_parallel_internal_thread_main
+  Entry point of a started worker: waits until the job's worker count is
+final, then runs its share.
+*/
+static d_thread_result_t
+d_array_sort_parallel_internal_thread_main
+(
+    void* _arg
+)
+{
+    struct d_array_sort_parallel_internal_worker* worker;
+    struct d_array_sort_parallel_internal_job*    job;
+
+    worker = (struct d_array_sort_parallel_internal_worker*)_arg;
+    job    = worker->job;
+
+    d_mutex_lock(&job->lock);
+
+    while (!job->ready)
+    {
+        d_cond_wait(&job->wake, &job->lock);
+    }
+
+    d_mutex_unlock(&job->lock);
+
+    d_array_sort_parallel_internal_run(job, worker->index);
+
+    return D_THREAD_SUCCESS;
+}
+
+/*
+d_array_sort_parallel_internal_execute
+  Starts up to `_max_workers - 1` threads, fixes the worker count to the
+number actually started plus the caller, splits the array into one run per
+worker when the job sorts runs, and runs worker 0 on the calling thread.
+Falls back to fewer workers (down to just the caller) if threads cannot be
+started.
+*/
+static void
+d_array_sort_parallel_internal_execute
+(
+    struct d_array_sort_parallel_internal_job* _job,
+    size_t                                     _max_workers
+)
+{
+    struct d_array_sort_parallel_internal_worker* workers;
+    d_thread_t*                                   threads;
+    size_t                                        started;
+    size_t                                        total;
+    size_t                                        i;
+
+    workers = NULL;
+    threads = NULL;
+    started = 0;
+    total   = _job->bounds[_job->run_count];
+
+    if (_max_workers > 1)
+    {
+        workers = malloc(_max_workers * sizeof(struct d_array_sort_parallel_internal_worker));
+        threads = malloc(_max_workers * sizeof(d_thread_t));
+    }
+
+    _job->ready      = false;
+    _job->waiting    = 0;
+    _job->generation = 0;
+
+    d_mutex_init(&_job->lock);
+    d_cond_init(&_job->wake);
+
+    if ( (workers) &&
+         (threads) )
+    {
+        for (i = 1; i < _max_workers; i++)
+        {
+            workers[i].job   = _job;
+            workers[i].index = i;
+
+            if (d_thread_create(&threads[started],
+                                d_array_sort_parallel_internal_thread_main,
+                                &workers[i]) != D_MUTEX_SUCCESS)
+            {
+                break;
+            }
+
+            started++;
+        }
+    }
+
+    d_mutex_lock(&_job->lock);
+
+    _job->worker_count = started + 1;
+
+    if (_job->sort_runs)
+    {
+        _job->run_count = _job->worker_count;
+
+        for (i = 0; i <= _job->run_count; i++)
+        {
+            _job->bounds[i] = d_array_sort_parallel_internal_split(total,
+                                                                   i,
+                                                                   _job->run_count);
+        }
+    }
+
+    _job->ready = true;
+    d_cond_broadcast(&_job->wake);
+    d_mutex_unlock(&_job->lock);
+
+    d_array_sort_parallel_internal_run(_job, 0);
+
+    for (i = 0; i < started; i++)
+    {
+        d_thread_join(threads[i], NULL);
+    }
+
+    d_cond_destroy(&_job->wake);
+    d_mutex_destroy(&_job->lock);
+
+    free(threads);
+    free(workers);
+
+    return;
+}
+
+
+// =============================================================================
+// sequential merge sort
+// =============================================================================
+
+/*
+d_array_sort_stable
+  Stable sort of an array of opaque elements with a comparator. Allocates a
+scratch buffer the size of the array; O(n log n) comparisons, fewer on
+input that is already partly ordered.
+
+Parameter(s):
+  _elements:     pointer to the first element
+  _count:        number of elements
+  _element_size: size in bytes of each element
+  _comparator:   ordering of elements
+Return:
+  - true if the elements are sorted
+  - false if parameters are invalid or the scratch buffer could not be
+    allocated (the array is unchanged)
+*/
+bool
+d_array_sort_stable
+(
+    void*         _elements,
+    size_t        _count,
+    size_t        _element_size,
+    fn_comparator _comparator
+)
+{
+    char* scratch;
+
+    if ( (!_elements)         ||
+         (_element_size == 0) ||
+         (!_comparator) )
+    {
+        return false;
+    }
+
+    if (_count < 2)
+    {
+        return true;
+    }
+
+    scratch = malloc(_count * _element_size);
+
+    if (!scratch)
+    {
+        return false;
+    }
+
+    d_array_sort_parallel_internal_merge_sort((char*)_elements,
+                                              scratch,
+                                              _count,
+                                              _element_size,
+                                              _comparator);
+
+    free(scratch);
+
+    return true;
+}
+
+
+// =============================================================================
+// parallel sort
+// =============================================================================
+
+/*
+d_array_sort_parallel
+  Sorts an array of opaque elements on several threads. Inputs shorter than
+D_ARRAY_SORT_PARALLEL_THRESHOLD, or too short to give two workers
+D_ARRAY_SORT_PARALLEL_GRAIN elements each, are sorted on the calling
+thread. Otherwise a scratch buffer the size of the array is allocated.
+
+Parameter(s):
+  _elements:     pointer to the first element
+  _count:        number of elements
+  _element_size: size in bytes of each element
+  _comparator:   ordering of elements; called concurrently, so it must not
+                 modify shared state
+  _mode:         D_ARRAY_SORT_STABLE to keep equal elements in their
+                 original order, D_ARRAY_SORT_UNSTABLE otherwise
+  _threads:      maximum number of threads including the caller, or 0 for
+                 one per hardware thread
+Return:
+  - true if the elements are sorted
+  - false if parameters are invalid, or if a stable sort could not allocate
+    its scratch buffer (the array is unchanged). An unstable sort that
+    cannot allocate falls back to sorting on the calling thread.
+*/
+bool
+d_array_sort_parallel
+(
+    void*                  _elements,
+    size_t                 _count,
+    size_t                 _element_size,
+    fn_comparator          _comparator,
+    enum d_array_sort_mode _mode,
+    size_t                 _threads
+)
+{
+    struct d_array_sort_parallel_internal_job job;
+    size_t                                    workers;
+
+    if ( (!_elements)         ||
+         (_element_size == 0) ||
+         (!_comparator) )
+    {
+        return false;
+    }
+
+    if (_count < 2)
+    {
+        return true;
+    }
+
+    workers = d_array_sort_parallel_internal_worker_count(_count, _threads);
+
+    if ( (_count >= D_ARRAY_SORT_PARALLEL_THRESHOLD) &&
+         (workers > 1) )
+    {
+        job.scratch = malloc(_count * _element_size);
+        job.bounds  = malloc((workers + 1) * sizeof(size_t));
+
+        if ( (job.scratch) &&
+             (job.bounds) )
+        {
+            job.elements     = (char*)_elements;
+            job.element_size = _element_size;
+            job.comparator   = _comparator;
+            job.mode         = _mode;
+            job.sort_runs    = true;
+            job.run_count    = 1;
+            job.bounds[0]    = 0;
+            job.bounds[1]    = _count;
+
+            d_array_sort_parallel_internal_execute(&job, workers);
+
+            free(job.bounds);
+            free(job.scratch);
+
+            return true;
+        }
+
+        free(job.bounds);
+        free(job.scratch);
+    }
+
+    if (_mode == D_ARRAY_SORT_STABLE)
+    {
+        return d_array_sort_stable(_elements, _count, _element_size, _comparator);
+    }
+
+    d_array_sort(_elements, _count, _element_size, _comparator);
+
+    return true;
+}
+
+/*
+d_array_merge_runs_parallel
+  Merges consecutive sorted runs of an array into one sorted array, on
+several threads. Run i occupies [_run_ends[i - 1], _run_ends[i]) (run 0
+starts at 0). The merge is stable: equal elements keep their order, and
+ties between runs go to the earlier run.
+
+Parameter(s):
+  _elements:     pointer to the first element
+  _element_size: size in bytes of each element
+  _run_ends:     end index of each run; non-decreasing, the last entry is
+                 the total element count
+  _run_count:    number of runs
+  _comparator:   ordering of elements; each run must already be sorted by it
+  _threads:      maximum number of threads including the caller, or 0 for
+                 one per hardware thread
+Return:
+  - true if the runs were merged
+  - false if parameters are invalid or scratch memory could not be
+    allocated (the array is unchanged)
+*/
+bool
+d_array_merge_runs_parallel
+(
+    void*         _elements,
+    size_t        _element_size,
+    const size_t* _run_ends,
+    size_t        _run_count,
+    fn_comparator _comparator,
+    size_t        _threads
+)
+{
+    struct d_array_sort_parallel_internal_job job;
+    size_t                                    count;
+    size_t                                    workers;
+    size_t                                    i;
+
+    if ( (_element_size == 0) ||
+         (!_comparator)       ||
+         ( (_run_count > 0) && (!_run_ends) ) )
+    {
+        return false;
+    }
+
+    for (i = 1; i < _run_count; i++)
+    {
+        if (_run_ends[i] < _run_ends[i - 1])
+        {
+            return false;
+        }
+    }
+
+    count = (_run_count > 0) ? _run_ends[_run_count - 1] : 0;
+
+    if ( (count > 0) &&
+         (!_elements) )
+    {
+        return false;
+    }
+
+    if ( (_run_count < 2) ||
+         (count < 2) )
+    {
+        return true;
+    }
+
+    workers = (count >= D_ARRAY_SORT_PARALLEL_THRESHOLD)
+                  ? d_array_sort_parallel_internal_worker_count(count, _threads)
+                  : 1;
+
+    job.scratch = malloc(count * _element_size);
+    job.bounds  = malloc((_run_count + 1) * sizeof(size_t));
+
+    if ( (!job.scratch) ||
+         (!job.bounds) )
+    {
+        free(job.bounds);
+        free(job.scratch);
+
+        return false;
+    }
+
+    job.elements     = (char*)_elements;
+    job.element_size = _element_size;
+    job.comparator   = _comparator;
+    job.mode         = D_ARRAY_SORT_STABLE;
+    job.sort_runs    = false;
+    job.run_count    = _run_count;
+    job.bounds[0]    = 0;
+
+    memcpy(job.bounds + 1, _run_ends, _run_count * sizeof(size_t));
+
+    d_array_sort_parallel_internal_execute(&job, workers);
+
+    free(job.bounds);
+    free(job.scratch);
+
+    return true;
+}
@@ -15,6 +15,35 @@
 // internal helper functions
 // =============================================================================
 
+/*
+d_circular_array_internal_wrap
+  Folds a position in [0, 2 * capacity) back into [0, capacity). A power-of-
+two capacity is masked; any other capacity is reduced by one conditional
+subtraction. Neither path divides.
+
+Parameter(s):
+  _circular_array: pointer to circular array
+  _position:       position to fold; less than twice the capacity
+Return:
+  Physical index in the elements buffer
+*/
+D_STATIC_INLINE size_t
+d_circular_array_internal_wrap
+(
+    const struct d_circular_array* _circular_array,
+    size_t                         _position
+)
+{
+    if (_circular_array->mask)
+    {
+        return _position & _circular_array->mask;
+    }
+
+    return (_position >= _circular_array->capacity)
+           ? _position - _circular_array->capacity
+           : _position;
+}
+
 /*
 d_circular_array_internal_get_physical_index
   Converts a logical index (0 = oldest element) to physical index in buffer.
@@ -32,7 +61,93 @@ d_circular_array_internal_get_physical_index
     size_t                         _logical_index
 )
 {
-    return (_circular_array->head + _logical_index) % _circular_array->capacity;
+    return d_circular_array_internal_wrap(_circular_array,
+                                          _circular_array->head + _logical_index);
+}
+
+/*
+d_circular_array_internal_copy_in
+  Copies `_count` elements from a linear buffer into the ring starting at
+physical slot `_position`, in at most two memcpy calls (up to the end of the
+buffer, then from slot 0).
+
+Parameter(s):
+  _circular_array: pointer to circular array
+  _position:       physical slot receiving the first element
+  _source:         elements to copy
+  _count:          number of elements; at most the capacity
+Return:
+  none
+*/
+D_STATIC_INLINE void
+d_circular_array_internal_copy_in
+(
+    struct d_circular_array* _circular_array,
+    size_t                   _position,
+    const void*              _source,
+    size_t                   _count
+)
+{
+    size_t first;
+
+    first = _circular_array->capacity - _position;
+
+    if (first > _count)
+    {
+        first = _count;
+    }
+
+    memcpy((char*)_circular_array->elements +
+               (_position * _circular_array->element_size),
+           _source,
+           first * _circular_array->element_size);
+    memcpy(_circular_array->elements,
+           (const char*)_source + (first * _circular_array->element_size),
+           (_count - first) * _circular_array->element_size);
+
+    return;
+}
+
+/*
+d_circular_array_internal_copy_out
+  Copies `_count` elements of the ring, starting at physical slot
+`_position`, into a linear buffer in at most two memcpy calls.
+
+Parameter(s):
+  _circular_array: pointer to circular array
+  _position:       physical slot of the first element
+  _destination:    buffer receiving the elements
+  _count:          number of elements; at most the capacity
+Return:
+  none
+*/
+D_STATIC_INLINE void
+d_circular_array_internal_copy_out
+(
+    const struct d_circular_array* _circular_array,
+    size_t                         _position,
+    void*                          _destination,
+    size_t                         _count
+)
+{
+    size_t first;
+
+    first = _circular_array->capacity - _position;
+
+    if (first > _count)
+    {
+        first = _count;
+    }
+
+    memcpy(_destination,
+           (const char*)_circular_array->elements +
+               (_position * _circular_array->element_size),
+           first * _circular_array->element_size);
+    memcpy((char*)_destination + (first * _circular_array->element_size),
+           _circular_array->elements,
+           (_count - first) * _circular_array->element_size);
+
+    return;
 }
 
 
@@ -55,6 +170,8 @@ Return:
 Notes:
   - Caller is responsible for calling d_circular_array_free() to release memory
   - Circular array is initialized to empty state (count = 0, head = tail = 0)
+  - A power-of-two capacity wraps indices with a mask; see
+    d_circular_array_new_pow2
   - Uses calloc() to zero-initialize the internal buffer
 */
 struct d_circular_array*
@@ -104,6 +221,9 @@ d_circular_array_new
     result->head         = 0;
     result->tail         = 0;
     result->count        = 0;
+    result->mask         = ((_capacity & (_capacity - 1)) == 0)
+                           ? _capacity - 1
+                           : 0;
 
     return result;
 }
@@ -128,6 +248,50 @@ d_circular_array_new_default_capacity
                                 _element_size);
 }
 
+/*
+d_circular_array_new_pow2
+  Creates a new empty circular array whose capacity is `_min_capacity`
+rounded up to the next power of two. Index wrapping in such an array is a
+single AND with `capacity - 1`.
+
+Parameter(s):
+  _min_capacity: minimum number of elements the circular array must hold.
+                 Must be greater than 0.
+  _element_size: size in bytes of each element. Must be > 0.
+Return:
+  - Pointer to new `d_circular_array` on success
+  - NULL if either parameter is 0, the rounded capacity overflows, or
+    memory allocation fails
+*/
+struct d_circular_array*
+d_circular_array_new_pow2
+(
+    size_t _min_capacity,
+    size_t _element_size
+)
+{
+    size_t capacity;
+
+    if (_min_capacity == 0)
+    {
+        return NULL;
+    }
+
+    capacity = 1;
+
+    while (capacity < _min_capacity)
+    {
+        if (capacity > (SIZE_MAX / 2))
+        {
+            return NULL;
+        }
+
+        capacity <<= 1;
+    }
+
+    return d_circular_array_new(capacity, _element_size);
+}
+
 /*
 d_circular_array_new_from_arr
   Creates and initializes a new circular array from an existing array.
@@ -293,9 +457,6 @@ d_circular_array_new_copy
 )
 {
     struct d_circular_array* result;
-    size_t                   i;
-    size_t                   src_index;
-    const char*              src_data;
     char*                    dest_data;
 
     if (!_other)
@@ -317,17 +478,12 @@ d_circular_array_new_copy
     }
 
     // copy elements maintaining logical order
-    src_data  = (const char*)_other->elements;
     dest_data = (char*)result->elements;
 
-    for (i = 0; i < _other->count; i++)
-    {
-        src_index = d_circular_array_internal_get_physical_index(_other, i);
-
-        d_memcpy(dest_data + (i * _other->element_size),
-                 src_data + (src_index * _other->element_size),
-                 _other->element_size);
-    }
+    d_circular_array_internal_copy_out(_other,
+                                       _other->head,
+                                       dest_data,
+                                       _other->count);
 
     // update new buffer state (linearized layout)
     result->count = _other->count;
@@ -356,9 +512,6 @@ d_circular_array_new_copy_resized
 )
 {
     struct d_circular_array* result;
-    size_t                   i;
-    size_t                   src_index;
-    const char*              src_data;
     char*                    dest_data;
 
     if ( (!_other)                       ||
@@ -379,17 +532,12 @@ d_circular_array_new_copy_resized
         return result;
     }
 
-    src_data  = (const char*)_other->elements;
     dest_data = (char*)result->elements;
 
-    for (i = 0; i < _other->count; i++)
-    {
-        src_index = d_circular_array_internal_get_physical_index(_other, i);
-
-        d_memcpy(dest_data + (i * _other->element_size),
-                 src_data + (src_index * _other->element_size),
-                 _other->element_size);
-    }
+    d_circular_array_internal_copy_out(_other,
+                                       _other->head,
+                                       dest_data,
+                                       _other->count);
 
     result->count = _other->count;
     result->head  = 0;
@@ -749,8 +897,8 @@ d_circular_array_push_back
 
     d_memcpy(dest, _element, _circular_array->element_size);
 
-    _circular_array->tail = (_circular_array->tail + 1) %
-                            _circular_array->capacity;
+    _circular_array->tail = d_circular_array_internal_wrap(_circular_array,
+                                                           _circular_array->tail + 1);
     _circular_array->count++;
 
     return D_SUCCESS;
@@ -759,7 +907,8 @@ d_circular_array_push_back
 /*
 d_circular_array_push_all
   Pushes multiple elements to the back of the circular array.
-Atomic operation - either all elements are pushed or none.
+Atomic operation - either all elements are pushed or none. The elements are
+copied in at most two contiguous segments.
 
 Parameter(s):
   _circular_array: pointer to circular array
@@ -777,12 +926,7 @@ d_circular_array_push_all
     size_t                   _count
 )
 {
-    size_t       available;
-    size_t       current_tail;
-    size_t       dest_pos;
-    size_t       i;
-    const char*  src;
-    char*        dest;
+    size_t available;
 
     if ( (!_circular_array) ||
          (!_elements)       ||
@@ -798,20 +942,13 @@ d_circular_array_push_all
         return D_FAILURE;
     }
 
-    src          = (const char*)_elements;
-    dest         = (char*)_circular_array->elements;
-    current_tail = _circular_array->tail;
-
-    for (i = 0; i < _count; i++)
-    {
-        dest_pos = (current_tail + i) % _circular_array->capacity;
-
-        d_memcpy(dest + (dest_pos * _circular_array->element_size),
-                 src + (i * _circular_array->element_size),
-                 _circular_array->element_size);
-    }
+    d_circular_array_internal_copy_in(_circular_array,
+                                      _circular_array->tail,
+                                      _elements,
+                                      _count);
 
-    _circular_array->tail = (current_tail + _count) % _circular_array->capacity;
+    _circular_array->tail = d_circular_array_internal_wrap(_circular_array,
+                                                           _circular_array->tail + _count);
     _circular_array->count += _count;
 
     return D_SUCCESS;
@@ -839,12 +976,8 @@ d_circular_array_push_all_front
     size_t                   _count
 )
 {
-    size_t       available;
-    size_t       new_head;
-    size_t       dest_pos;
-    size_t       i;
-    const char*  src;
-    char*        dest;
+    size_t available;
+    size_t new_head;
 
     if ( (!_circular_array) ||
          (!_elements)       ||
@@ -860,23 +993,15 @@ d_circular_array_push_all_front
         return D_FAILURE;
     }
 
-    src  = (const char*)_elements;
-    dest = (char*)_circular_array->elements;
-
     // calculate new head position
     new_head = (_circular_array->head >= _count)
                ? _circular_array->head - _count
                : _circular_array->capacity - (_count - _circular_array->head);
 
-    // copy elements
-    for (i = 0; i < _count; i++)
-    {
-        dest_pos = (new_head + i) % _circular_array->capacity;
-
-        d_memcpy(dest + (dest_pos * _circular_array->element_size),
-                 src + (i * _circular_array->element_size),
-                 _circular_array->element_size);
-    }
+    d_circular_array_internal_copy_in(_circular_array,
+                                      new_head,
+                                      _elements,
+                                      _count);
 
     _circular_array->head = new_head;
     _circular_array->count += _count;
@@ -931,8 +1056,8 @@ d_circular_array_pop_front
     item = (char*)_circular_array->elements +
            (_circular_array->head * _circular_array->element_size);
 
-    _circular_array->head = (_circular_array->head + 1) %
-                            _circular_array->capacity;
+    _circular_array->head = d_circular_array_internal_wrap(_circular_array,
+                                                           _circular_array->head + 1);
     _circular_array->count--;
 
     return item;
@@ -1026,8 +1151,8 @@ d_circular_array_pop_front_to
 
     d_memcpy(_out_value, item, _circular_array->element_size);
 
-    _circular_array->head = (_circular_array->head + 1) %
-                            _circular_array->capacity;
+    _circular_array->head = d_circular_array_internal_wrap(_circular_array,
+                                                           _circular_array->head + 1);
     _circular_array->count--;
 
     return D_SUCCESS;
@@ -1077,6 +1202,49 @@ d_circular_array_pop_back_to
 }
 
 
+/*
+d_circular_array_pop_all_to
+  Removes `_count` elements from the front and copies them, oldest first,
+to the output buffer in at most two contiguous segments.
+Atomic operation - either all elements are popped or none.
+
+Parameter(s):
+  _circular_array: pointer to circular array
+  _out_values:     buffer with room for `_count` elements
+  _count:          number of elements to remove
+Return:
+  - true if all elements were removed and copied
+  - false if fewer than `_count` elements are stored or parameters are
+    invalid
+*/
+bool
+d_circular_array_pop_all_to
+(
+    struct d_circular_array* _circular_array,
+    void*                    _out_values,
+    size_t                   _count
+)
+{
+    if ( (!_circular_array)                 ||
+         (!_out_values)                     ||
+         (_count == 0)                      ||
+         (_count > _circular_array->count) )
+    {
+        return D_FAILURE;
+    }
+
+    d_circular_array_internal_copy_out(_circular_array,
+                                       _circular_array->head,
+                                       _out_values,
+                                       _count);
+
+    _circular_array->head = d_circular_array_internal_wrap(_circular_array,
+                                                           _circular_array->head + _count);
+    _circular_array->count -= _count;
+
+    return D_SUCCESS;
+}
+
 // =============================================================================
 // modification functions - overwriting operations
 // =============================================================================
@@ -1112,8 +1280,8 @@ d_circular_array_push_overwrite
 
     d_memcpy(dest, _element, _circular_array->element_size);
 
-    _circular_array->tail = (_circular_array->tail + 1) %
-                            _circular_array->capacity;
+    _circular_array->tail = d_circular_array_internal_wrap(_circular_array,
+                                                           _circular_array->tail + 1);
 
     if (_circular_array->count < _circular_array->capacity)
     {
@@ -1200,7 +1368,6 @@ d_circular_array_push_all_overwrite
 )
 {
     const char* src;
-    size_t      i;
 
     if ( (!_circular_array) ||
          (!_elements)       ||
@@ -1227,11 +1394,23 @@ d_circular_array_push_all_overwrite
         return D_SUCCESS;
     }
 
-    // push each element with overwrite
-    for (i = 0; i < _count; i++)
+    d_circular_array_internal_copy_in(_circular_array,
+                                      _circular_array->tail,
+                                      src,
+                                      _count);
+
+    _circular_array->tail = d_circular_array_internal_wrap(_circular_array,
+                                                           _circular_array->tail + _count);
+
+    // anything pushed past a full buffer displaced the oldest elements
+    if (_circular_array->count + _count > _circular_array->capacity)
     {
-        d_circular_array_push_overwrite(_circular_array,
-                                        src + (i * _circular_array->element_size));
+        _circular_array->count = _circular_array->capacity;
+        _circular_array->head  = _circular_array->tail;
+    }
+    else
+    {
+        _circular_array->count += _count;
     }
 
     return D_SUCCESS;
@@ -1352,10 +1531,10 @@ d_circular_array_rotate_left
     }
 
     // rotating left just moves the head forward
-    _circular_array->head = (_circular_array->head + effective_amount) %
-                            _circular_array->capacity;
-    _circular_array->tail = (_circular_array->tail + effective_amount) %
-                            _circular_array->capacity;
+    _circular_array->head = d_circular_array_internal_wrap(_circular_array,
+                                                           _circular_array->head + effective_amount);
+    _circular_array->tail = d_circular_array_internal_wrap(_circular_array,
+                                                           _circular_array->tail + effective_amount);
 
     return D_SUCCESS;
 }
@@ -1888,11 +2067,7 @@ d_circular_array_to_linear_array
     const struct d_circular_array* _circular_array
 )
 {
-    void*       result;
-    size_t      i;
-    size_t      physical_idx;
-    const char* src;
-    char*       dest;
+    void* result;
 
     if ( (!_circular_array) ||
          (_circular_array->count == 0) )
@@ -1908,18 +2083,10 @@ d_circular_array_to_linear_array
         return NULL;
     }
 
-    dest = (char*)result;
-    src  = (const char*)_circular_array->elements;
-
-    for (i = 0; i < _circular_array->count; i++)
-    {
-        physical_idx = d_circular_array_internal_get_physical_index(
-                           _circular_array, i);
-
-        d_memcpy(dest + (i * _circular_array->element_size),
-                 src + (physical_idx * _circular_array->element_size),
-                 _circular_array->element_size);
-    }
+    d_circular_array_internal_copy_out(_circular_array,
+                                       _circular_array->head,
+                                       result,
+                                       _circular_array->count);
 
     return result;
 }
@@ -1944,11 +2111,6 @@ d_circular_array_copy_to
     size_t                         _dest_capacity
 )
 {
-    size_t      i;
-    size_t      physical_idx;
-    const char* src;
-    char*       dest;
-
     if ( (!_circular_array) ||
          (!_destination) )
     {
@@ -1965,18 +2127,10 @@ d_circular_array_copy_to
         return D_SUCCESS;
     }
 
-    dest = (char*)_destination;
-    src  = (const char*)_circular_array->elements;
-
-    for (i = 0; i < _circular_array->count; i++)
-    {
-        physical_idx = d_circular_array_internal_get_physical_index(
-                           _circular_array, i);
-
-        d_memcpy(dest + (i * _circular_array->element_size),
-                 src + (physical_idx * _circular_array->element_size),
-                 _circular_array->element_size);
-    }
+    d_circular_array_internal_copy_out(_circular_array,
+                                       _circular_array->head,
+                                       _destination,
+                                       _circular_array->count);
 
     return D_SUCCESS;
 }
@@ -2101,14 +2255,57 @@ d_circular_array_sort
         return;
     }
 
-    qsort(_circular_array->elements,
-          _circular_array->count,
-          _circular_array->element_size,
-          _comparator);
+    d_array_sort(_circular_array->elements,
+                 _circular_array->count,
+                 _circular_array->element_size,
+                 _comparator);
 
     return;
 }
 
+/*
+d_circular_array_sort_keyed
+  Stably sorts the elements by a numeric key stored inside each element.
+Note: This linearizes the buffer as a side effect.
+
+Parameter(s):
+  _circular_array: pointer to circular array
+  _key:            type of the key
+  _key_offset:     byte offset of the key within an element
+Return:
+  - true if the array is sorted
+  - false if parameters are invalid or memory allocation fails
+*/
+bool
+d_circular_array_sort_keyed
+(
+    struct d_circular_array* _circular_array,
+    enum d_array_sort_key    _key,
+    size_t                   _key_offset
+)
+{
+    if (!_circular_array)
+    {
+        return false;
+    }
+
+    if (_circular_array->count <= 1)
+    {
+        return true;
+    }
+
+    if (!d_circular_array_linearize(_circular_array))
+    {
+        return false;
+    }
+
+    return d_array_sort_keyed(_circular_array->elements,
+                              _circular_array->count,
+                              _circular_array->element_size,
+                              _key,
+                              _key_offset);
+}
+
 /*
 d_circular_array_linearize
   Rearranges internal storage so head is at index 0.
@@ -2127,11 +2324,7 @@ d_circular_array_linearize
     struct d_circular_array* _circular_array
 )
 {
-    void*       temp;
-    size_t      i;
-    size_t      physical_idx;
-    const char* src;
-    char*       dest;
+    void* temp;
 
     if (!_circular_array)
     {
@@ -2154,19 +2347,11 @@ d_circular_array_linearize
         return D_FAILURE;
     }
 
-    src  = (const char*)_circular_array->elements;
-    dest = (char*)temp;
-
     // copy elements in logical order to temp
-    for (i = 0; i < _circular_array->count; i++)
-    {
-        physical_idx = d_circular_array_internal_get_physical_index(
-                           _circular_array, i);
-
-        d_memcpy(dest + (i * _circular_array->element_size),
-                 src + (physical_idx * _circular_array->element_size),
-                 _circular_array->element_size);
-    }
+    d_circular_array_internal_copy_out(_circular_array,
+                                       _circular_array->head,
+                                       temp,
+                                       _circular_array->count);
 
     // copy back to elements
     d_memcpy(_circular_array->elements,
@@ -0,0 +1,1412 @@
+/******************************************************************************
+* djinterp [container]                                                 deque.c
+*
+*   Implementation of the deque (block map) data structure.
+*
+*
+* path:      \src\container\array\deque.c
+* link:      TBA
+* author(s): Samuel 'teer' Neal-Blim                          date: 2026.10.18
+******************************************************************************/
+#include "../../../../inc/c/container/array/deque.h"
+
+
+// =============================================================================
+// internal helper functions
+// =============================================================================
+
+/*
+d_deque_internal_block_capacity
+  Returns the capacity, in elements, of every block.
+*/
+D_STATIC_INLINE size_t
+d_deque_internal_block_capacity
+(
+    const struct d_deque* _deque
+)
+{
+    return (size_t)1 << _deque->block_shift;
+}
+
+/*
+d_deque_internal_used_blocks
+  Returns the number of blocks currently referenced from the map.
+*/
+D_STATIC_INLINE size_t
+d_deque_internal_used_blocks
+(
+    const struct d_deque* _deque
+)
+{
+    return _deque->map_end - _deque->map_begin;
+}
+
+/*
+d_deque_internal_element
+  Returns a pointer to the element at a logical index known to be in range.
+*/
+D_STATIC_INLINE void*
+d_deque_internal_element
+(
+    const struct d_deque* _deque,
+    size_t                _index
+)
+{
+    size_t position;
+
+    position = _deque->front + _index;
+
+    return (char*)_deque->map[_deque->map_begin +
+                              (position >> _deque->block_shift)] +
+           ((position & (d_deque_internal_block_capacity(_deque) - 1)) *
+            _deque->element_size);
+}
+
+/*
+d_deque_internal_run
+  Returns the number of consecutive elements, starting at logical index
+`_index`, that share a block with it, capped at `_limit`.
+*/
+D_STATIC_INLINE size_t
+d_deque_internal_run
+(
+    const struct d_deque* _deque,
+    size_t                _index,
+    size_t                _limit
+)
+{
+    size_t run;
+
+    run = d_deque_internal_block_capacity(_deque) -
+          ((_deque->front + _index) &
+           (d_deque_internal_block_capacity(_deque) - 1));
+
+    return (run < _limit) ? run : _limit;
+}
+
+/*
+d_deque_internal_block_new
+  Returns the spare block if there is one, otherwise allocates a block.
+*/
+static void*
+d_deque_internal_block_new
+(
+    struct d_deque* _deque
+)
+{
+    void* block;
+
+    if (_deque->spare)
+    {
+        block         = _deque->spare;
+        _deque->spare = NULL;
+
+        return block;
+    }
+
+    return malloc(d_deque_internal_block_capacity(_deque) *
+                  _deque->element_size);
+}
+
+/*
+d_deque_internal_block_release
+  Keeps an emptied block as the spare, or frees it if there already is one.
+*/
+static void
+d_deque_internal_block_release
+(
+    struct d_deque* _deque,
+    void*           _block
+)
+{
+    if (!_deque->spare)
+    {
+        _deque->spare = _block;
+    }
+    else
+    {
+        free(_block);
+    }
+
+    return;
+}
+
+/*
+d_deque_internal_reserve_map
+  Makes sure the map has at least `_front_slots` free slots before the used
+blocks and `_back_slots` free slots after them. The used slots are
+recentred in place when the map is at most half full, otherwise the map is
+reallocated at (at least) twice the required size. Only block pointers are
+moved.
+
+Parameter(s):
+  _deque:       pointer to deque
+  _front_slots: free slots required before map_begin
+  _back_slots:  free slots required at and after map_end
+Return:
+  - true if the slots are available
+  - false if the size overflows or memory allocation fails (the deque is
+    unchanged)
+*/
+static bool
+d_deque_internal_reserve_map
+(
+    struct d_deque* _deque,
+    size_t          _front_slots,
+    size_t          _back_slots
+)
+{
+    void** map;
+    size_t used;
+    size_t needed;
+    size_t capacity;
+    size_t begin;
+
+    if ( (_deque->map)                                               &&
+         (_deque->map_begin >= _front_slots)                         &&
+         ((_deque->map_capacity - _deque->map_end) >= _back_slots) )
+    {
+        return true;
+    }
+
+    used = d_deque_internal_used_blocks(_deque);
+
+    if ( (_front_slots > (SIZE_MAX / 4) - used) ||
+         (_back_slots > (SIZE_MAX / 4) - used - _front_slots) )
+    {
+        return false;
+    }
+
+    needed = used + _front_slots + _back_slots;
+
+    // enough room overall: slide the used slots to the middle
+    if ( (_deque->map) &&
+         (needed <= (_deque->map_capacity / 2)) )
+    {
+        begin = _front_slots + ((_deque->map_capacity - needed) / 2);
+
+        memmove(_deque->map + begin,
+                _deque->map + _deque->map_begin,
+                used * sizeof(void*));
+
+        _deque->map_begin = begin;
+        _deque->map_end   = begin + used;
+
+        return true;
+    }
+
+    capacity = (_deque->map_capacity > D_DEQUE_MIN_MAP_CAPACITY)
+                   ? _deque->map_capacity
+                   : D_DEQUE_MIN_MAP_CAPACITY;
+
+    while (capacity < (needed * 2))
+    {
+        capacity *= 2;
+    }
+
+    if (capacity > (SIZE_MAX / sizeof(void*)))
+    {
+        return false;
+    }
+
+    map = malloc(capacity * sizeof(void*));
+
+    if (!map)
+    {
+        return false;
+    }
+
+    begin = _front_slots + ((capacity - needed) / 2);
+
+    if (used > 0)
+    {
+        d_memcpy(map + begin,
+                 _deque->map + _deque->map_begin,
+                 used * sizeof(void*));
+    }
+
+    free(_deque->map);
+
+    _deque->map          = map;
+    _deque->map_capacity = capacity;
+    _deque->map_begin    = begin;
+    _deque->map_end      = begin + used;
+
+    return true;
+}
+
+/*
+d_deque_internal_add_blocks
+  Allocates `_blocks` new blocks and links them in at the front or the back
+of the map. Either all of them are added or none.
+
+Parameter(s):
+  _deque:    pointer to deque
+  _blocks:   number of blocks to add
+  _at_front: true to add before the first block, false to add after the last
+Return:
+  - true if the blocks were added
+  - false if memory allocation fails (the deque is unchanged apart from a
+    possibly larger map)
+*/
+static bool
+d_deque_internal_add_blocks
+(
+    struct d_deque* _deque,
+    size_t          _blocks,
+    bool            _at_front
+)
+{
+    size_t slot;
+    size_t i;
+
+    if (_blocks == 0)
+    {
+        return true;
+    }
+
+    if (!d_deque_internal_reserve_map(_deque,
+                                      _at_front ? _blocks : 0,
+                                      _at_front ? 0 : _blocks))
+    {
+        return false;
+    }
+
+    slot = _at_front ? (_deque->map_begin - _blocks) : _deque->map_end;
+
+    for (i = 0; i < _blocks; i++)
+    {
+        _deque->map[slot + i] = d_deque_internal_block_new(_deque);
+
+        if (!_deque->map[slot + i])
+        {
+            while (i-- > 0)
+            {
+                d_deque_internal_block_release(_deque, _deque->map[slot + i]);
+            }
+
+            return false;
+        }
+    }
+
+    if (_at_front)
+    {
+        _deque->map_begin -= _blocks;
+    }
+    else
+    {
+        _deque->map_end += _blocks;
+    }
+
+    return true;
+}
+
+/*
+d_deque_internal_trim
+  Releases blocks that no longer hold any element after removals, restoring
+the invariant that the used blocks exactly cover the elements (and that an
+empty deque holds no block and has `front` at 0).
+*/
+static void
+d_deque_internal_trim
+(
+    struct d_deque* _deque
+)
+{
+    size_t needed;
+
+    if (_deque->count == 0)
+    {
+        while (_deque->map_end > _deque->map_begin)
+        {
+            d_deque_internal_block_release(_deque,
+                                           _deque->map[--_deque->map_end]);
+        }
+
+        _deque->front = 0;
+
+        return;
+    }
+
+    while (_deque->front >= d_deque_internal_block_capacity(_deque))
+    {
+        d_deque_internal_block_release(_deque,
+                                       _deque->map[_deque->map_begin++]);
+
+        _deque->front -= d_deque_internal_block_capacity(_deque);
+    }
+
+    needed = ((_deque->front + _deque->count - 1) >> _deque->block_shift) + 1;
+
+    while (d_deque_internal_used_blocks(_deque) > needed)
+    {
+        d_deque_internal_block_release(_deque,
+                                       _deque->map[--_deque->map_end]);
+    }
+
+    return;
+}
+
+/*
+d_deque_internal_write
+  Copies `_count` elements from a linear buffer into consecutive logical
+positions starting at `_index`, one block-sized run at a time. The positions
+must already be covered by blocks.
+*/
+static void
+d_deque_internal_write
+(
+    struct d_deque* _deque,
+    size_t          _index,
+    const void*     _source,
+    size_t          _count
+)
+{
+    const char* source;
+    size_t      run;
+
+    source = (const char*)_source;
+
+    while (_count > 0)
+    {
+        run = d_deque_internal_run(_deque, _index, _count);
+
+        d_memcpy(d_deque_internal_element(_deque, _index),
+                 source,
+                 run * _deque->element_size);
+
+        source += run * _deque->element_size;
+        _index += run;
+        _count -= run;
+    }
+
+    return;
+}
+
+
+// =============================================================================
+// constructor functions
+// =============================================================================
+
+/*
+d_deque_new
+  Creates a new empty deque whose blocks hold D_DEQUE_DEFAULT_BLOCK_CAPACITY
+elements.
+
+Parameter(s):
+  _element_size: size in bytes of each element. Must be > 0.
+Return:
+  - Pointer to new `d_deque` on success
+  - NULL if _element_size is 0 or memory allocation fails
+*/
+struct d_deque*
+d_deque_new
+(
+    size_t _element_size
+)
+{
+    return d_deque_new_block_capacity(D_DEQUE_DEFAULT_BLOCK_CAPACITY,
+                                      _element_size);
+}
+
+/*
+d_deque_new_block_capacity
+  Creates a new empty deque with a chosen block capacity. Neither the map
+nor any block is allocated until the first element is added.
+
+Parameter(s):
+  _block_capacity: elements per block; rounded up to a power of two (0
+                   selects 1)
+  _element_size:   size in bytes of each element. Must be > 0.
+Return:
+  - Pointer to new `d_deque` on success
+  - NULL if _element_size is 0, the block size is too large, or memory
+    allocation fails
+Notes:
+  - Caller is responsible for calling d_deque_free()
+*/
+struct d_deque*
+d_deque_new_block_capacity
+(
+    size_t _block_capacity,
+    size_t _element_size
+)
+{
+    struct d_deque* result;
+    size_t          shift;
+
+    if (_element_size == 0)
+    {
+        return NULL;
+    }
+
+    shift = 0;
+
+    while ( (((size_t)1 << shift) < _block_capacity) &&
+            (shift < ((sizeof(size_t) * CHAR_BIT) / 2)) )
+    {
+        shift++;
+    }
+
+    if ( (((size_t)1 << shift) < _block_capacity) ||
+         (((size_t)1 << shift) > (SIZE_MAX / _element_size)) )
+    {
+        return NULL;
+    }
+
+    result = calloc(1, sizeof(struct d_deque));
+
+    if (!result)
+    {
+        return NULL;
+    }
+
+    result->element_size = _element_size;
+    result->block_shift  = shift;
+
+    return result;
+}
+
+/*
+d_deque_new_from_arr
+  Creates a new deque holding a copy of a linear array.
+
+Parameter(s):
+  _element_size: size in bytes of each element. Must be > 0.
+  _source:       elements to copy; may be NULL only if _source_count is 0
+  _source_count: number of elements in _source
+Return:
+  - Pointer to new `d_deque` on success
+  - NULL if parameters are invalid or memory allocation fails
+*/
+struct d_deque*
+d_deque_new_from_arr
+(
+    size_t      _element_size,
+    const void* _source,
+    size_t      _source_count
+)
+{
+    struct d_deque* result;
+
+    if ( (!_source) &&
+         (_source_count > 0) )
+    {
+        return NULL;
+    }
+
+    result = d_deque_new(_element_size);
+
+    if (!result)
+    {
+        return NULL;
+    }
+
+    if (!d_deque_append(result, _source, _source_count))
+    {
+        d_deque_free(result);
+
+        return NULL;
+    }
+
+    return result;
+}
+
+/*
+d_deque_new_copy
+  Creates a complete copy of an existing deque with the same block
+capacity.
+
+Parameter(s):
+  _other: pointer to the deque to copy. Must not be NULL.
+Return:
+  - Pointer to new d_deque that is a copy of the source
+  - NULL if _other is NULL or memory allocation fails
+*/
+struct d_deque*
+d_deque_new_copy
+(
+    const struct d_deque* _other
+)
+{
+    struct d_deque* result;
+    size_t          index;
+    size_t          run;
+
+    if (!_other)
+    {
+        return NULL;
+    }
+
+    result = d_deque_new_block_capacity(
+                 d_deque_internal_block_capacity(_other),
+                 _other->element_size);
+
+    if (!result)
+    {
+        return NULL;
+    }
+
+    for (index = 0; index < _other->count; index += run)
+    {
+        run = d_deque_internal_run(_other, index, _other->count - index);
+
+        if (!d_deque_append(result,
+                            d_deque_internal_element(_other, index),
+                            run))
+        {
+            d_deque_free(result);
+
+            return NULL;
+        }
+    }
+
+    return result;
+}
+
+
+// =============================================================================
+// element access functions
+// =============================================================================
+
+/*
+d_deque_get
+  Returns a pointer to the element at the specified index. The pointer is
+valid until the element is removed or the deque is freed; pushing at either
+end does not move existing elements.
+
+Parameter(s):
+  _deque: pointer to deque
+  _index: index (supports negative indexing)
+Return:
+  - Pointer to element at the specified index
+  - NULL if the deque is NULL, empty, or index is out of bounds
+*/
+void*
+d_deque_get
+(
+    const struct d_deque* _deque,
+    d_index               _index
+)
+{
+    size_t index;
+
+    if ( (!_deque)            ||
+         (_deque->count == 0) )
+    {
+        return NULL;
+    }
+
+    if (!d_index_convert_safe(_index, _deque->count, &index))
+    {
+        return NULL;
+    }
+
+    return d_deque_internal_element(_deque, index);
+}
+
+/*
+d_deque_set
+  Sets the value at the specified index.
+
+Parameter(s):
+  _deque: pointer to deque
+  _index: index (supports negative indexing)
+  _value: pointer to value to set
+Return:
+  - true if value was successfully set
+  - false if parameters are invalid or index is out of bounds
+*/
+bool
+d_deque_set
+(
+    struct d_deque* _deque,
+    d_index         _index,
+    const void*     _value
+)
+{
+    void* element;
+
+    if (!_value)
+    {
+        return false;
+    }
+
+    element = d_deque_get(_deque, _index);
+
+    if (!element)
+    {
+        return false;
+    }
+
+    d_memcpy(element, _value, _deque->element_size);
+
+    return true;
+}
+
+/*
+d_deque_front
+  Returns a pointer to the first element.
+
+Parameter(s):
+  _deque: pointer to deque
+Return:
+  - Pointer to the first element
+  - NULL if the deque is NULL or empty
+*/
+void*
+d_deque_front
+(
+    const struct d_deque* _deque
+)
+{
+    if ( (!_deque)            ||
+         (_deque->count == 0) )
+    {
+        return NULL;
+    }
+
+    return d_deque_internal_element(_deque, 0);
+}
+
+/*
+d_deque_back
+  Returns a pointer to the last element.
+
+Parameter(s):
+  _deque: pointer to deque
+Return:
+  - Pointer to the last element
+  - NULL if the deque is NULL or empty
+*/
+void*
+d_deque_back
+(
+    const struct d_deque* _deque
+)
+{
+    if ( (!_deque)            ||
+         (_deque->count == 0) )
+    {
+        return NULL;
+    }
+
+    return d_deque_internal_element(_deque, _deque->count - 1);
+}
+
+
+// =============================================================================
+// modification functions
+// =============================================================================
+
+/*
+d_deque_push_back
+  Adds an element to the back of the deque. Amortized O(1); no existing
+element is moved.
+
+Parameter(s):
+  _deque:   pointer to deque
+  _element: pointer to the element to copy in
+Return:
+  - true if the element was added
+  - false if parameters are invalid or memory allocation fails
+*/
+bool
+d_deque_push_back
+(
+    struct d_deque* _deque,
+    const void*     _element
+)
+{
+    if ( (!_deque)   ||
+         (!_element) )
+    {
+        return false;
+    }
+
+    // the slot after the last element is in a block not yet allocated
+    if ( (((_deque->front + _deque->count) >> _deque->block_shift) ==
+          d_deque_internal_used_blocks(_deque)) &&
+         (!d_deque_internal_add_blocks(_deque, 1, false)) )
+    {
+        return false;
+    }
+
+    d_memcpy(d_deque_internal_element(_deque, _deque->count),
+             _element,
+             _deque->element_size);
+
+    _deque->count++;
+
+    return true;
+}
+
+/*
+d_deque_push_front
+  Adds an element to the front of the deque. Amortized O(1); no existing
+element is moved.
+
+Parameter(s):
+  _deque:   pointer to deque
+  _element: pointer to the element to copy in
+Return:
+  - true if the element was added
+  - false if parameters are invalid or memory allocation fails
+*/
+bool
+d_deque_push_front
+(
+    struct d_deque* _deque,
+    const void*     _element
+)
+{
+    if ( (!_deque)   ||
+         (!_element) )
+    {
+        return false;
+    }
+
+    if (_deque->front == 0)
+    {
+        if (!d_deque_internal_add_blocks(_deque, 1, true))
+        {
+            return false;
+        }
+
+        _deque->front = d_deque_internal_block_capacity(_deque);
+    }
+
+    _deque->front--;
+    _deque->count++;
+
+    d_memcpy(d_deque_internal_element(_deque, 0),
+             _element,
+             _deque->element_size);
+
+    return true;
+}
+
+/*
+d_deque_pop_back_to
+  Removes the last element, copying it out first.
+
+Parameter(s):
+  _deque:     pointer to deque
+  _out_value: receives the removed element; may be NULL to discard
+Return:
+  - true if an element was removed
+  - false if the deque is NULL or empty
+*/
+bool
+d_deque_pop_back_to
+(
+    struct d_deque* _deque,
+    void*           _out_value
+)
+{
+    if ( (!_deque)            ||
+         (_deque->count == 0) )
+    {
+        return false;
+    }
+
+    if (_out_value)
+    {
+        d_memcpy(_out_value,
+                 d_deque_internal_element(_deque, _deque->count - 1),
+                 _deque->element_size);
+    }
+
+    _deque->count--;
+
+    d_deque_internal_trim(_deque);
+
+    return true;
+}
+
+/*
+d_deque_pop_front_to
+  Removes the first element, copying it out first.
+
+Parameter(s):
+  _deque:     pointer to deque
+  _out_value: receives the removed element; may be NULL to discard
+Return:
+  - true if an element was removed
+  - false if the deque is NULL or empty
+*/
+bool
+d_deque_pop_front_to
+(
+    struct d_deque* _deque,
+    void*           _out_value
+)
+{
+    if ( (!_deque)            ||
+         (_deque->count == 0) )
+    {
+        return false;
+    }
+
+    if (_out_value)
+    {
+        d_memcpy(_out_value,
+                 d_deque_internal_element(_deque, 0),
+                 _deque->element_size);
+    }
+
+    _deque->front++;
+    _deque->count--;
+
+    d_deque_internal_trim(_deque);
+
+    return true;
+}
+
+/*
+d_deque_append
+  Adds several elements to the back of the deque, in order. All blocks
+needed are allocated first, then the elements are copied in block-sized
+runs.
+
+Parameter(s):
+  _deque:    pointer to deque
+  _elements: elements to copy; may be NULL only if _count is 0
+  _count:    number of elements
+Return:
+  - true if the elements were added
+  - false if parameters are invalid or memory allocation fails (the deque
+    is unchanged)
+*/
+bool
+d_deque_append
+(
+    struct d_deque* _deque,
+    const void*     _elements,
+    size_t          _count
+)
+{
+    size_t end;
+    size_t blocks;
+
+    if ( (!_deque) ||
+         ( (!_elements) && (_count > 0) ) )
+    {
+        return false;
+    }
+
+    if (_count == 0)
+    {
+        return true;
+    }
+
+    end = _deque->front + _deque->count;
+
+    if (_count > SIZE_MAX - end - d_deque_internal_block_capacity(_deque))
+    {
+        return false;
+    }
+
+    end    += _count;
+    blocks  = ((end - 1) >> _deque->block_shift) + 1;
+
+    if (!d_deque_internal_add_blocks(_deque,
+                                     blocks - d_deque_internal_used_blocks(_deque),
+                                     false))
+    {
+        return false;
+    }
+
+    d_deque_internal_write(_deque, _deque->count, _elements, _count);
+
+    _deque->count += _count;
+
+    return true;
+}
+
+/*
+d_deque_prepend
+  Adds several elements to the front of the deque so that `_elements[0]`
+becomes the first element and the existing elements follow the last one.
+
+Parameter(s):
+  _deque:    pointer to deque
+  _elements: elements to copy; may be NULL only if _count is 0
+  _count:    number of elements
+Return:
+  - true if the elements were added
+  - false if parameters are invalid or memory allocation fails (the deque
+    is unchanged)
+*/
+bool
+d_deque_prepend
+(
+    struct d_deque* _deque,
+    const void*     _elements,
+    size_t          _count
+)
+{
+    size_t blocks;
+
+    if ( (!_deque) ||
+         ( (!_elements) && (_count > 0) ) )
+    {
+        return false;
+    }
+
+    if (_count == 0)
+    {
+        return true;
+    }
+
+    if (_count > _deque->front)
+    {
+        blocks = ((_count - _deque->front - 1) >> _deque->block_shift) + 1;
+
+        if ( (blocks > (SIZE_MAX >> _deque->block_shift) - 1) ||
+             (!d_deque_internal_add_blocks(_deque, blocks, true)) )
+        {
+            return false;
+        }
+
+        _deque->front += blocks << _deque->block_shift;
+    }
+
+    _deque->front -= _count;
+    _deque->count += _count;
+
+    d_deque_internal_write(_deque, 0, _elements, _count);
+
+    return true;
+}
+
+/*
+d_deque_pop_front_range_to
+  Removes the first `_count` elements, copying them out in order first.
+This is the bulk form of d_deque_pop_front_to for draining a work queue.
+
+Parameter(s):
+  _deque:      pointer to deque
+  _out_values: buffer of at least _count elements; may be NULL to discard
+  _count:      number of elements to remove
+Return:
+  - true if the elements were removed
+  - false if the deque is NULL or holds fewer than _count elements
+*/
+bool
+d_deque_pop_front_range_to
+(
+    struct d_deque* _deque,
+    void*           _out_values,
+    size_t          _count
+)
+{
+    if ( (!_deque)                ||
+         (_count > _deque->count) )
+    {
+        return false;
+    }
+
+    if (_out_values)
+    {
+        d_deque_copy_to(_deque, 0, _count, _out_values);
+    }
+
+    _deque->front += _count;
+    _deque->count -= _count;
+
+    d_deque_internal_trim(_deque);
+
+    return true;
+}
+
+/*
+d_deque_clear
+  Removes all elements. One block is kept as the spare; see
+d_deque_shrink_to_fit.
+
+Parameter(s):
+  _deque: pointer to deque
+Return:
+  - true on success
+  - false if the deque is NULL
+*/
+bool
+d_deque_clear
+(
+    struct d_deque* _deque
+)
+{
+    if (!_deque)
+    {
+        return false;
+    }
+
+    _deque->count = 0;
+
+    d_deque_internal_trim(_deque);
+
+    return true;
+}
+
+/*
+d_deque_shrink_to_fit
+  Frees the spare block and reduces the block map to the blocks in use.
+
+Parameter(s):
+  _deque: pointer to deque
+Return:
+  - true on success
+  - false if the deque is NULL or memory allocation fails (the deque is
+    still valid)
+*/
+bool
+d_deque_shrink_to_fit
+(
+    struct d_deque* _deque
+)
+{
+    void** map;
+    size_t used;
+    size_t capacity;
+    size_t begin;
+
+    if (!_deque)
+    {
+        return false;
+    }
+
+    free(_deque->spare);
+
+    _deque->spare = NULL;
+    used          = d_deque_internal_used_blocks(_deque);
+
+    if (used == 0)
+    {
+        free(_deque->map);
+
+        _deque->map          = NULL;
+        _deque->map_capacity = 0;
+        _deque->map_begin    = 0;
+        _deque->map_end      = 0;
+
+        return true;
+    }
+
+    capacity = (used > D_DEQUE_MIN_MAP_CAPACITY) ? used
+                                                 : D_DEQUE_MIN_MAP_CAPACITY;
+
+    if (capacity >= _deque->map_capacity)
+    {
+        return true;
+    }
+
+    map = malloc(capacity * sizeof(void*));
+
+    if (!map)
+    {
+        return false;
+    }
+
+    begin = (capacity - used) / 2;
+
+    d_memcpy(map + begin,
+             _deque->map + _deque->map_begin,
+             used * sizeof(void*));
+
+    free(_deque->map);
+
+    _deque->map          = map;
+    _deque->map_capacity = capacity;
+    _deque->map_begin    = begin;
+    _deque->map_end      = begin + used;
+
+    return true;
+}
+
+
+// =============================================================================
+// query functions
+// =============================================================================
+
+/*
+d_deque_is_empty
+  Checks whether the deque holds no elements.
+
+Parameter(s):
+  _deque: pointer to deque
+Return:
+  - true if the deque is NULL or empty
+  - false otherwise
+*/
+bool
+d_deque_is_empty
+(
+    const struct d_deque* _deque
+)
+{
+    return ( (!_deque) ||
+             (_deque->count == 0) );
+}
+
+/*
+d_deque_count
+  Returns the number of elements in the deque.
+
+Parameter(s):
+  _deque: pointer to deque
+Return:
+  Number of elements (0 if _deque is NULL)
+*/
+size_t
+d_deque_count
+(
+    const struct d_deque* _deque
+)
+{
+    return (_deque) ? _deque->count : 0;
+}
+
+/*
+d_deque_element_size
+  Returns the size in bytes of each element.
+
+Parameter(s):
+  _deque: pointer to deque
+Return:
+  Element size (0 if _deque is NULL)
+*/
+size_t
+d_deque_element_size
+(
+    const struct d_deque* _deque
+)
+{
+    return (_deque) ? _deque->element_size : 0;
+}
+
+/*
+d_deque_block_capacity
+  Returns the number of elements each block holds.
+
+Parameter(s):
+  _deque: pointer to deque
+Return:
+  Block capacity (0 if _deque is NULL)
+*/
+size_t
+d_deque_block_capacity
+(
+    const struct d_deque* _deque
+)
+{
+    return (_deque) ? d_deque_internal_block_capacity(_deque) : 0;
+}
+
+
+// =============================================================================
+// conversion functions
+// =============================================================================
+
+/*
+d_deque_to_linear_array
+  Creates a newly allocated linear array holding a copy of all elements.
+
+Parameter(s):
+  _deque: pointer to deque
+Return:
+  - Pointer to the new array (caller must free)
+  - NULL if the deque is NULL, empty, or memory allocation fails
+*/
+void*
+d_deque_to_linear_array
+(
+    const struct d_deque* _deque
+)
+{
+    void* result;
+
+    if ( (!_deque)            ||
+         (_deque->count == 0) )
+    {
+        return NULL;
+    }
+
+    result = malloc(_deque->count * _deque->element_size);
+
+    if (!result)
+    {
+        return NULL;
+    }
+
+    d_deque_copy_to(_deque, 0, _deque->count, result);
+
+    return result;
+}
+
+/*
+d_deque_copy_to
+  Copies a range of elements into a linear buffer, one block-sized run at a
+time.
+
+Parameter(s):
+  _deque:       pointer to deque
+  _start:       index of the first element to copy
+  _count:       number of elements to copy
+  _destination: buffer of at least _count elements
+Return:
+  - true on success
+  - false if parameters are invalid or the range is out of bounds
+*/
+bool
+d_deque_copy_to
+(
+    const struct d_deque* _deque,
+    size_t                _start,
+    size_t                _count,
+    void*                 _destination
+)
+{
+    char*  destination;
+    size_t run;
+
+    if ( (!_deque)                             ||
+         (!_destination)                       ||
+         (_start > _deque->count)              ||
+         (_count > (_deque->count - _start)) )
+    {
+        return false;
+    }
+
+    destination = (char*)_destination;
+
+    while (_count > 0)
+    {
+        run = d_deque_internal_run(_deque, _start, _count);
+
+        d_memcpy(destination,
+                 d_deque_internal_element(_deque, _start),
+                 run * _deque->element_size);
+
+        destination += run * _deque->element_size;
+        _start      += run;
+        _count      -= run;
+    }
+
+    return true;
+}
+
+
+// =============================================================================
+// iteration helpers
+// =============================================================================
+
+/*
+d_deque_foreach
+  Applies a function to each element from front to back.
+
+Parameter(s):
+  _deque:    pointer to deque
+  _apply_fn: function to apply to each element
+Return:
+  none.
+*/
+void
+d_deque_foreach
+(
+    struct d_deque* _deque,
+    fn_apply        _apply_fn
+)
+{
+    char*  element;
+    size_t index;
+    size_t run;
+    size_t i;
+
+    if ( (!_deque)    ||
+         (!_apply_fn) )
+    {
+        return;
+    }
+
+    for (index = 0; index < _deque->count; index += run)
+    {
+        run     = d_deque_internal_run(_deque, index, _deque->count - index);
+        element = (char*)d_deque_internal_element(_deque, index);
+
+        for (i = 0; i < run; i++)
+        {
+            _apply_fn(element);
+
+            element += _deque->element_size;
+        }
+    }
+
+    return;
+}
+
+
+// =============================================================================
+// memory management
+// =============================================================================
+
+/*
+d_deque_free
+  Frees the deque, its blocks and its block map.
+
+Parameter(s):
+  _deque: pointer to deque; may be NULL
+Return:
+  none.
+*/
+void
+d_deque_free
+(
+    struct d_deque* _deque
+)
+{
+    size_t b;
+
+    if (_deque)
+    {
+        for (b = _deque->map_begin; b < _deque->map_end; b++)
+        {
+            free(_deque->map[b]);
+        }
+
+        free(_deque->spare);
+        free(_deque->map);
+        free(_deque);
+    }
+
+    return;
+}
+
+/*
+d_deque_free_deep
+  Calls a free function on each element, then frees the deque.
+
+Parameter(s):
+  _deque:   pointer to deque; may be NULL
+  _free_fn: function called with a pointer to each element; may be NULL to
+            skip
+Return:
+  none.
+*/
+void
+d_deque_free_deep
+(
+    struct d_deque* _deque,
+    fn_free         _free_fn
+)
+{
+    if ( (_deque) &&
+         (_free_fn) )
+    {
+        d_deque_foreach(_deque, (fn_apply)_free_fn);
+    }
+
+    d_deque_free(_deque);
+
+    return;
+}
@@ -0,0 +1,1575 @@
+/******************************************************************************
+* djinterp [container]                                        segmented_array.c
+*
+*   Implementation of the segmented array (geometric block list) data
+* structure.
+*
+*
+* path:      \src\container\array\segmented_array.c
+* link:      TBA
+* author(s): Samuel 'teer' Neal-Blim                          date: 2026.10.18
+******************************************************************************/
+#include "../../../../inc/c/container/array/segmented_array.h"
+
+
+// =============================================================================
+// internal helper functions
+// =============================================================================
+
+/*
+d_segmented_array_internal_msb
+  Returns the index of the highest set bit of a non-zero value.
+
+Parameter(s):
+  _value: value to scan; must not be 0
+Return:
+  Bit index in [0, bits of size_t)
+*/
+D_STATIC_INLINE size_t
+d_segmented_array_internal_msb
+(
+    size_t _value
+)
+{
+#if ( defined(D_ENV_COMPILER_GCC) ||  \
+      defined(D_ENV_COMPILER_CLANG) )
+    return ((sizeof(unsigned long long) * CHAR_BIT) - 1) -
+           (size_t)__builtin_clzll((unsigned long long)_value);
+#else
+    size_t index;
+
+    index = 0;
+
+    while (_value >>= 1)
+    {
+        index++;
+    }
+
+    return index;
+#endif
+}
+
+/*
+d_segmented_array_internal_locate
+  Converts a logical index to a block number and an offset within that block.
+Block `b` starts at logical index B * (2^b - 1), where B is the first block's
+capacity, so (index + B) has its top bit at position (block_shift + b).
+
+Parameter(s):
+  _segmented_array: pointer to segmented array
+  _index:           logical index (0-based)
+  _block:           receives the block number
+  _offset:          receives the element offset within the block
+Return:
+  none.
+*/
+D_STATIC_INLINE void
+d_segmented_array_internal_locate
+(
+    const struct d_segmented_array* _segmented_array,
+    size_t                          _index,
+    size_t*                         _block,
+    size_t*                         _offset
+)
+{
+    size_t biased;
+    size_t top;
+
+    biased   = _index + ((size_t)1 << _segmented_array->block_shift);
+    top      = d_segmented_array_internal_msb(biased);
+    *_block  = top - _segmented_array->block_shift;
+    *_offset = biased - ((size_t)1 << top);
+
+    return;
+}
+
+/*
+d_segmented_array_internal_block_capacity
+  Returns the capacity, in elements, of block `_block`.
+*/
+D_STATIC_INLINE size_t
+d_segmented_array_internal_block_capacity
+(
+    const struct d_segmented_array* _segmented_array,
+    size_t                          _block
+)
+{
+    return (size_t)1 << (_segmented_array->block_shift + _block);
+}
+
+/*
+d_segmented_array_internal_capacity_of
+  Returns the total capacity of the first `_blocks` blocks.
+*/
+D_STATIC_INLINE size_t
+d_segmented_array_internal_capacity_of
+(
+    const struct d_segmented_array* _segmented_array,
+    size_t                          _blocks
+)
+{
+    return ((size_t)1 << _segmented_array->block_shift) *
+           (((size_t)1 << _blocks) - 1);
+}
+
+/*
+d_segmented_array_internal_element
+  Returns a pointer to the element at a logical index known to be in range.
+*/
+D_STATIC_INLINE void*
+d_segmented_array_internal_element
+(
+    const struct d_segmented_array* _segmented_array,
+    size_t                          _index
+)
+{
+    size_t block;
+    size_t offset;
+
+    d_segmented_array_internal_locate(_segmented_array,
+                                      _index,
+                                      &block,
+                                      &offset);
+
+    return (char*)_segmented_array->blocks[block] +
+           (offset * _segmented_array->element_size);
+}
+
+/*
+d_segmented_array_internal_grow
+  Allocates blocks until the array can hold `_capacity` elements. Existing
+blocks are never touched, which is what keeps element addresses stable.
+
+Parameter(s):
+  _segmented_array: pointer to segmented array
+  _capacity:        required capacity in elements
+Return:
+  - true if the capacity is available
+  - false if it cannot be represented or an allocation failed; blocks
+    allocated before the failure are kept
+*/
+static bool
+d_segmented_array_internal_grow
+(
+    struct d_segmented_array* _segmented_array,
+    size_t                    _capacity
+)
+{
+    size_t block_capacity;
+    void*  block;
+
+    while (d_segmented_array_internal_capacity_of(
+               _segmented_array,
+               _segmented_array->block_count) < _capacity)
+    {
+        // the next block must be addressable and its byte size representable
+        if ( (_segmented_array->block_shift +
+              _segmented_array->block_count) >= (D_SEGMENTED_ARRAY_MAX_BLOCKS - 1) )
+        {
+            return false;
+        }
+
+        block_capacity = d_segmented_array_internal_block_capacity(
+                             _segmented_array,
+                             _segmented_array->block_count);
+
+        if (block_capacity > (SIZE_MAX / _segmented_array->element_size))
+        {
+            return false;
+        }
+
+        block = malloc(block_capacity * _segmented_array->element_size);
+
+        if (!block)
+        {
+            return false;
+        }
+
+        _segmented_array->blocks[_segmented_array->block_count] = block;
+        _segmented_array->block_count++;
+    }
+
+    return true;
+}
+
+/*
+d_segmented_array_internal_write
+  Copies `_count` elements from a linear buffer into consecutive logical
+positions starting at `_index`, one block-sized run at a time. Runs are
+copied in increasing order with memmove, so the source may be a later part of
+the same array.
+*/
+static void
+d_segmented_array_internal_write
+(
+    struct d_segmented_array* _segmented_array,
+    size_t                    _index,
+    const void*               _source,
+    size_t                    _count
+)
+{
+    const char* source;
+    size_t      block;
+    size_t      offset;
+    size_t      run;
+
+    source = (const char*)_source;
+
+    while (_count > 0)
+    {
+        d_segmented_array_internal_locate(_segmented_array,
+                                          _index,
+                                          &block,
+                                          &offset);
+
+        run = d_segmented_array_internal_block_capacity(_segmented_array,
+                                                        block) - offset;
+
+        if (run > _count)
+        {
+            run = _count;
+        }
+
+        memmove((char*)_segmented_array->blocks[block] +
+                    (offset * _segmented_array->element_size),
+                source,
+                run * _segmented_array->element_size);
+
+        source += run * _segmented_array->element_size;
+        _index += run;
+        _count -= run;
+    }
+
+    return;
+}
+
+
+// =============================================================================
+// constructor functions
+// =============================================================================
+
+/*
+d_segmented_array_new
+  Creates a new empty segmented array whose first block holds
+D_SEGMENTED_ARRAY_DEFAULT_BLOCK_CAPACITY elements.
+
+Parameter(s):
+  _element_size: size in bytes of each element. Must be > 0.
+Return:
+  - Pointer to new `d_segmented_array` on success
+  - NULL if _element_size is 0 or memory allocation fails
+*/
+struct d_segmented_array*
+d_segmented_array_new
+(
+    size_t _element_size
+)
+{
+    return d_segmented_array_new_block_capacity(
+               D_SEGMENTED_ARRAY_DEFAULT_BLOCK_CAPACITY,
+               _element_size);
+}
+
+/*
+d_segmented_array_new_block_capacity
+  Creates a new empty segmented array with a chosen first block capacity.
+No block is allocated until the first element is added.
+
+Parameter(s):
+  _block_capacity: capacity of the first block; rounded up to a power of two
+                   (0 selects 1).
+  _element_size:   size in bytes of each element. Must be > 0.
+Return:
+  - Pointer to new `d_segmented_array` on success
+  - NULL if _element_size is 0, the block capacity is too large, or memory
+    allocation fails
+Notes:
+  - Caller is responsible for calling d_segmented_array_free()
+*/
+struct d_segmented_array*
+d_segmented_array_new_block_capacity
+(
+    size_t _block_capacity,
+    size_t _element_size
+)
+{
+    struct d_segmented_array* result;
+    size_t                    shift;
+
+    if (_element_size == 0)
+    {
+        return NULL;
+    }
+
+    shift = 0;
+
+    while ( (((size_t)1 << shift) < _block_capacity) &&
+            (shift < (D_SEGMENTED_ARRAY_MAX_BLOCKS / 2)) )
+    {
+        shift++;
+    }
+
+    if (((size_t)1 << shift) < _block_capacity)
+    {
+        return NULL;
+    }
+
+    result = calloc(1, sizeof(struct d_segmented_array));
+
+    if (!result)
+    {
+        return NULL;
+    }
+
+    result->element_size = _element_size;
+    result->block_shift  = shift;
+
+    return result;
+}
+
+/*
+d_segmented_array_new_from_arr
+  Creates a new segmented array holding a copy of a linear array.
+
+Parameter(s):
+  _element_size: size in bytes of each element. Must be > 0.
+  _source:       elements to copy; may be NULL only if _source_count is 0
+  _source_count: number of elements in _source
+Return:
+  - Pointer to new `d_segmented_array` on success
+  - NULL if parameters are invalid or memory allocation fails
+*/
+struct d_segmented_array*
+d_segmented_array_new_from_arr
+(
+    size_t      _element_size,
+    const void* _source,
+    size_t      _source_count
+)
+{
+    struct d_segmented_array* result;
+
+    if ( (!_source) &&
+         (_source_count > 0) )
+    {
+        return NULL;
+    }
+
+    result = d_segmented_array_new(_element_size);
+
+    if (!result)
+    {
+        return NULL;
+    }
+
+    if (!d_segmented_array_append(result, _source, _source_count))
+    {
+        d_segmented_array_free(result);
+
+        return NULL;
+    }
+
+    return result;
+}
+
+/*
+d_segmented_array_new_copy
+  Creates a complete copy of an existing segmented array, with the same
+block layout.
+
+Parameter(s):
+  _other: pointer to the segmented array to copy. Must not be NULL.
+Return:
+  - Pointer to new d_segmented_array that is a copy of the source
+  - NULL if _other is NULL or memory allocation fails
+*/
+struct d_segmented_array*
+d_segmented_array_new_copy
+(
+    const struct d_segmented_array* _other
+)
+{
+    struct d_segmented_array* result;
+    const void*               block;
+    size_t                    block_count;
+    size_t                    i;
+
+    if (!_other)
+    {
+        return NULL;
+    }
+
+    result = d_segmented_array_new_block_capacity(
+                 (size_t)1 << _other->block_shift,
+                 _other->element_size);
+
+    if (!result)
+    {
+        return NULL;
+    }
+
+    if (!d_segmented_array_internal_grow(result, _other->count))
+    {
+        d_segmented_array_free(result);
+
+        return NULL;
+    }
+
+    for (i = 0; i < d_segmented_array_block_count(_other); i++)
+    {
+        block = d_segmented_array_block(_other, i, &block_count);
+
+        d_memcpy(result->blocks[i],
+                 block,
+                 block_count * _other->element_size);
+    }
+
+    result->count = _other->count;
+
+    return result;
+}
+
+
+// =============================================================================
+// element access functions
+// =============================================================================
+
+/*
+d_segmented_array_get
+  Returns a pointer to the element at the specified index. The pointer stays
+valid until the element is removed or the array is freed.
+
+Parameter(s):
+  _segmented_array: pointer to segmented array
+  _index:           index (supports negative indexing)
+Return:
+  - Pointer to element at the specified index
+  - NULL if the array is NULL, empty, or index is out of bounds
+*/
+void*
+d_segmented_array_get
+(
+    const struct d_segmented_array* _segmented_array,
+    d_index                         _index
+)
+{
+    size_t index;
+
+    if ( (!_segmented_array)            ||
+         (_segmented_array->count == 0) )
+    {
+        return NULL;
+    }
+
+    if (!d_index_convert_safe(_index, _segmented_array->count, &index))
+    {
+        return NULL;
+    }
+
+    return d_segmented_array_internal_element(_segmented_array, index);
+}
+
+/*
+d_segmented_array_set
+  Sets the value at the specified index.
+
+Parameter(s):
+  _segmented_array: pointer to segmented array
+  _index:           index (supports negative indexing)
+  _value:           pointer to value to set
+Return:
+  - true if value was successfully set
+  - false if parameters are invalid or index is out of bounds
+*/
+bool
+d_segmented_array_set
+(
+    struct d_segmented_array* _segmented_array,
+    d_index                   _index,
+    const void*               _value
+)
+{
+    void* element;
+
+    if (!_value)
+    {
+        return false;
+    }
+
+    element = d_segmented_array_get(_segmented_array, _index);
+
+    if (!element)
+    {
+        return false;
+    }
+
+    d_memcpy(element, _value, _segmented_array->element_size);
+
+    return true;
+}
+
+/*
+d_segmented_array_front
+  Returns a pointer to the first element.
+
+Parameter(s):
+  _segmented_array: pointer to segmented array
+Return:
+  - Pointer to the first element
+  - NULL if the array is NULL or empty
+*/
+void*
+d_segmented_array_front
+(
+    const struct d_segmented_array* _segmented_array
+)
+{
+    return d_segmented_array_get(_segmented_array, 0);
+}
+
+/*
+d_segmented_array_back
+  Returns a pointer to the last element.
+
+Parameter(s):
+  _segmented_array: pointer to segmented array
+Return:
+  - Pointer to the last element
+  - NULL if the array is NULL or empty
+*/
+void*
+d_segmented_array_back
+(
+    const struct d_segmented_array* _segmented_array
+)
+{
+    return d_segmented_array_get(_segmented_array, -1);
+}
+
+
+// =============================================================================
+// modification functions
+// =============================================================================
+
+/*
+d_segmented_array_push_back
+  Appends a copy of an element.
+
+Parameter(s):
+  _segmented_array: pointer to segmented array
+  _element:         pointer to the element to copy
+Return:
+  - true if the element was appended
+  - false if parameters are invalid or memory allocation fails
+*/
+bool
+d_segmented_array_push_back
+(
+    struct d_segmented_array* _segmented_array,
+    const void*               _element
+)
+{
+    void* slot;
+
+    if (!_element)
+    {
+        return false;
+    }
+
+    slot = d_segmented_array_emplace_back(_segmented_array);
+
+    if (!slot)
+    {
+        return false;
+    }
+
+    d_memcpy(slot, _element, _segmented_array->element_size);
+
+    return true;
+}
+
+/*
+d_segmented_array_emplace_back
+  Appends an uninitialized element and returns its address, so the caller
+can construct it in place.
+
+Parameter(s):
+  _segmented_array: pointer to segmented array
+Return:
+  - Pointer to the new element; it stays valid until the element is removed
+  - NULL if the array is NULL or memory allocation fails
+*/
+void*
+d_segmented_array_emplace_back
+(
+    struct d_segmented_array* _segmented_array
+)
+{
+    if (!_segmented_array)
+    {
+        return NULL;
+    }
+
+    if ( (_segmented_array->count == SIZE_MAX) ||
+         (!d_segmented_array_internal_grow(_segmented_array,
+                                           _segmented_array->count + 1)) )
+    {
+        return NULL;
+    }
+
+    _segmented_array->count++;
+
+    return d_segmented_array_internal_element(_segmented_array,
+                                              _segmented_array->count - 1);
+}
+
+/*
+d_segmented_array_append
+  Appends copies of `_count` elements from a linear array, copying one
+block-sized run at a time.
+
+Parameter(s):
+  _segmented_array: pointer to segmented array
+  _elements:        elements to copy; may be NULL only if _count is 0
+  _count:           number of elements to append
+Return:
+  - true if all elements were appended
+  - false if parameters are invalid or memory allocation fails (the array
+    is unchanged)
+*/
+bool
+d_segmented_array_append
+(
+    struct d_segmented_array* _segmented_array,
+    const void*               _elements,
+    size_t                    _count
+)
+{
+    if ( (!_segmented_array) ||
+         ( (!_elements) && (_count > 0) ) )
+    {
+        return false;
+    }
+
+    if (_count == 0)
+    {
+        return true;
+    }
+
+    if ( (_count > (SIZE_MAX - _segmented_array->count)) ||
+         (!d_segmented_array_internal_grow(_segmented_array,
+                                           _segmented_array->count + _count)) )
+    {
+        return false;
+    }
+
+    d_segmented_array_internal_write(_segmented_array,
+                                     _segmented_array->count,
+                                     _elements,
+                                     _count);
+
+    _segmented_array->count += _count;
+
+    return true;
+}
+
+/*
+d_segmented_array_pop_back_to
+  Removes the last element, copying it out first.
+
+Parameter(s):
+  _segmented_array: pointer to segmented array
+  _out_value:       receives the removed element; may be NULL to discard
+Return:
+  - true if an element was removed
+  - false if the array is NULL or empty
+*/
+bool
+d_segmented_array_pop_back_to
+(
+    struct d_segmented_array* _segmented_array,
+    void*                     _out_value
+)
+{
+    if ( (!_segmented_array)            ||
+         (_segmented_array->count == 0) )
+    {
+        return false;
+    }
+
+    if (_out_value)
+    {
+        d_memcpy(_out_value,
+                 d_segmented_array_internal_element(_segmented_array,
+                                                    _segmented_array->count - 1),
+                 _segmented_array->element_size);
+    }
+
+    _segmented_array->count--;
+
+    return true;
+}
+
+/*
+d_segmented_array_truncate
+  Shrinks the array to `_count` elements. Blocks are kept for reuse; see
+d_segmented_array_shrink_to_fit.
+
+Parameter(s):
+  _segmented_array: pointer to segmented array
+  _count:           new element count; must not exceed the current count
+Return:
+  - true on success
+  - false if the array is NULL or _count is larger than the current count
+*/
+bool
+d_segmented_array_truncate
+(
+    struct d_segmented_array* _segmented_array,
+    size_t                    _count
+)
+{
+    if ( (!_segmented_array) ||
+         (_count > _segmented_array->count) )
+    {
+        return false;
+    }
+
+    _segmented_array->count = _count;
+
+    return true;
+}
+
+/*
+d_segmented_array_clear
+  Removes all elements, keeping the allocated blocks.
+
+Parameter(s):
+  _segmented_array: pointer to segmented array
+Return:
+  - true on success
+  - false if the array is NULL
+*/
+bool
+d_segmented_array_clear
+(
+    struct d_segmented_array* _segmented_array
+)
+{
+    return d_segmented_array_truncate(_segmented_array, 0);
+}
+
+/*
+d_segmented_array_reserve
+  Allocates blocks ahead of time so that `_capacity` elements fit.
+
+Parameter(s):
+  _segmented_array: pointer to segmented array
+  _capacity:        required capacity in elements
+Return:
+  - true if the capacity is available
+  - false if the array is NULL or memory allocation fails
+*/
+bool
+d_segmented_array_reserve
+(
+    struct d_segmented_array* _segmented_array,
+    size_t                    _capacity
+)
+{
+    if (!_segmented_array)
+    {
+        return false;
+    }
+
+    return d_segmented_array_internal_grow(_segmented_array, _capacity);
+}
+
+/*
+d_segmented_array_shrink_to_fit
+  Frees every block that holds no elements.
+
+Parameter(s):
+  _segmented_array: pointer to segmented array
+Return:
+  - true on success
+  - false if the array is NULL
+*/
+bool
+d_segmented_array_shrink_to_fit
+(
+    struct d_segmented_array* _segmented_array
+)
+{
+    size_t used;
+
+    if (!_segmented_array)
+    {
+        return false;
+    }
+
+    used = d_segmented_array_block_count(_segmented_array);
+
+    while (_segmented_array->block_count > used)
+    {
+        _segmented_array->block_count--;
+
+        free(_segmented_array->blocks[_segmented_array->block_count]);
+        _segmented_array->blocks[_segmented_array->block_count] = NULL;
+    }
+
+    return true;
+}
+
+
+// =============================================================================
+// query functions
+// =============================================================================
+
+/*
+d_segmented_array_is_empty
+  Checks if the segmented array contains no elements.
+
+Parameter(s):
+  _segmented_array: pointer to segmented array
+Return:
+  - true if empty or NULL
+  - false otherwise
+*/
+bool
+d_segmented_array_is_empty
+(
+    const struct d_segmented_array* _segmented_array
+)
+{
+    return ( (!_segmented_array) ||
+             (_segmented_array->count == 0) );
+}
+
+/*
+d_segmented_array_count
+  Returns the number of elements in the segmented array.
+
+Parameter(s):
+  _segmented_array: pointer to segmented array
+Return:
+  Number of elements, or 0 if NULL
+*/
+size_t
+d_segmented_array_count
+(
+    const struct d_segmented_array* _segmented_array
+)
+{
+    return (_segmented_array) ? _segmented_array->count : 0;
+}
+
+/*
+d_segmented_array_capacity
+  Returns the number of elements the allocated blocks can hold.
+
+Parameter(s):
+  _segmented_array: pointer to segmented array
+Return:
+  Capacity in elements, or 0 if NULL
+*/
+size_t
+d_segmented_array_capacity
+(
+    const struct d_segmented_array* _segmented_array
+)
+{
+    if (!_segmented_array)
+    {
+        return 0;
+    }
+
+    return d_segmented_array_internal_capacity_of(_segmented_array,
+                                                  _segmented_array->block_count);
+}
+
+/*
+d_segmented_array_element_size
+  Returns the size of each element in bytes.
+
+Parameter(s):
+  _segmented_array: pointer to segmented array
+Return:
+  Element size in bytes, or 0 if NULL
+*/
+size_t
+d_segmented_array_element_size
+(
+    const struct d_segmented_array* _segmented_array
+)
+{
+    return (_segmented_array) ? _segmented_array->element_size : 0;
+}
+
+
+// =============================================================================
+// block access functions
+// =============================================================================
+
+/*
+d_segmented_array_block_count
+  Returns the number of blocks that currently hold elements. Blocks
+[0, block_count) cover indices [0, count) in order.
+
+Parameter(s):
+  _segmented_array: pointer to segmented array
+Return:
+  Number of non-empty blocks, or 0 if NULL or empty
+*/
+size_t
+d_segmented_array_block_count
+(
+    const struct d_segmented_array* _segmented_array
+)
+{
+    size_t block;
+    size_t offset;
+
+    if ( (!_segmented_array)            ||
+         (_segmented_array->count == 0) )
+    {
+        return 0;
+    }
+
+    d_segmented_array_internal_locate(_segmented_array,
+                                      _segmented_array->count - 1,
+                                      &block,
+                                      &offset);
+
+    return block + 1;
+}
+
+/*
+d_segmented_array_block
+  Returns a block as a contiguous run of elements, for use with functions
+that operate on linear arrays.
+Example:
+  for (b = 0; b < d_segmented_array_block_count(arr); b++)
+  {
+      data   = d_segmented_array_block(arr, b, &n);
+      total += d_contiguous_filter_count_where(data, n, size, test, NULL);
+  }
+
+Parameter(s):
+  _segmented_array: pointer to segmented array
+  _block:           block number, less than d_segmented_array_block_count
+  _out_count:       receives the number of elements in the block
+Return:
+  - Pointer to the block's first element
+  - NULL if parameters are invalid or the block holds no elements
+*/
+void*
+d_segmented_array_block
+(
+    const struct d_segmented_array* _segmented_array,
+    size_t                          _block,
+    size_t*                         _out_count
+)
+{
+    size_t start;
+    size_t count;
+
+    if (_out_count)
+    {
+        *_out_count = 0;
+    }
+
+    if ( (!_segmented_array) ||
+         (!_out_count)       ||
+         (_block >= d_segmented_array_block_count(_segmented_array)) )
+    {
+        return NULL;
+    }
+
+    start = d_segmented_array_internal_capacity_of(_segmented_array, _block);
+    count = d_segmented_array_internal_block_capacity(_segmented_array, _block);
+
+    if (count > (_segmented_array->count - start))
+    {
+        count = _segmented_array->count - start;
+    }
+
+    *_out_count = count;
+
+    return _segmented_array->blocks[_block];
+}
+
+/*
+d_segmented_array_block_capacity
+  Returns the capacity, in elements, of a block (allocated or not).
+
+Parameter(s):
+  _segmented_array: pointer to segmented array
+  _block:           block number
+Return:
+  Capacity of the block, or 0 if the array is NULL or the block number is
+outside the block index
+*/
+size_t
+d_segmented_array_block_capacity
+(
+    const struct d_segmented_array* _segmented_array,
+    size_t                          _block
+)
+{
+    if ( (!_segmented_array) ||
+         ( (_segmented_array->block_shift + _block) >=
+           D_SEGMENTED_ARRAY_MAX_BLOCKS ) )
+    {
+        return 0;
+    }
+
+    return d_segmented_array_internal_block_capacity(_segmented_array, _block);
+}
+
+
+// =============================================================================
+// search functions
+// =============================================================================
+
+/*
+d_segmented_array_contains
+  Checks if the segmented array contains the specified value.
+
+Parameter(s):
+  _segmented_array: pointer to segmented array
+  _value:           pointer to value to search for
+  _comparator:      comparison function
+Return:
+  - true if value is found
+  - false if not found or parameters are invalid
+*/
+bool
+d_segmented_array_contains
+(
+    const struct d_segmented_array* _segmented_array,
+    const void*                     _value,
+    fn_comparator                   _comparator
+)
+{
+    return (d_segmented_array_find(_segmented_array, _value, _comparator) >= 0);
+}
+
+/*
+d_segmented_array_find
+  Finds the first occurrence of the specified value, scanning block by block.
+
+Parameter(s):
+  _segmented_array: pointer to segmented array
+  _value:           pointer to value to search for
+  _comparator:      comparison function
+Return:
+  - Index of first occurrence (>= 0)
+  - -1 if not found or parameters are invalid
+*/
+ssize_t
+d_segmented_array_find
+(
+    const struct d_segmented_array* _segmented_array,
+    const void*                     _value,
+    fn_comparator                   _comparator
+)
+{
+    const char* block;
+    size_t      block_count;
+    size_t      base;
+    size_t      b;
+    size_t      i;
+
+    if ( (!_segmented_array) ||
+         (!_value)           ||
+         (!_comparator) )
+    {
+        return -1;
+    }
+
+    base = 0;
+
+    for (b = 0; b < d_segmented_array_block_count(_segmented_array); b++)
+    {
+        block = d_segmented_array_block(_segmented_array, b, &block_count);
+
+        for (i = 0; i < block_count; i++)
+        {
+            if (_comparator(block + (i * _segmented_array->element_size),
+                            _value) == 0)
+            {
+                return (ssize_t)(base + i);
+            }
+        }
+
+        base += block_count;
+    }
+
+    return -1;
+}
+
+
+// =============================================================================
+// conversion functions
+// =============================================================================
+
+/*
+d_segmented_array_to_linear_array
+  Creates a newly allocated linear array holding a copy of all elements.
+
+Parameter(s):
+  _segmented_array: pointer to segmented array
+Return:
+  - Pointer to the new array (caller must free)
+  - NULL if the array is NULL, empty, or memory allocation fails
+*/
+void*
+d_segmented_array_to_linear_array
+(
+    const struct d_segmented_array* _segmented_array
+)
+{
+    void* result;
+
+    if ( (!_segmented_array)            ||
+         (_segmented_array->count == 0) )
+    {
+        return NULL;
+    }
+
+    result = malloc(_segmented_array->count * _segmented_array->element_size);
+
+    if (!result)
+    {
+        return NULL;
+    }
+
+    d_segmented_array_copy_to(_segmented_array,
+                              0,
+                              _segmented_array->count,
+                              result);
+
+    return result;
+}
+
+/*
+d_segmented_array_copy_to
+  Copies a range of elements into a linear buffer, one block-sized run at a
+time.
+
+Parameter(s):
+  _segmented_array: pointer to segmented array
+  _start:           index of the first element to copy
+  _count:           number of elements to copy
+  _destination:     buffer of at least _count elements
+Return:
+  - true on success
+  - false if parameters are invalid or the range is out of bounds
+*/
+bool
+d_segmented_array_copy_to
+(
+    const struct d_segmented_array* _segmented_array,
+    size_t                          _start,
+    size_t                          _count,
+    void*                           _destination
+)
+{
+    char*  destination;
+    size_t block;
+    size_t offset;
+    size_t run;
+
+    if ( (!_segmented_array) ||
+         (!_destination)     ||
+         (_start > _segmented_array->count) ||
+         (_count > (_segmented_array->count - _start)) )
+    {
+        return false;
+    }
+
+    destination = (char*)_destination;
+
+    while (_count > 0)
+    {
+        d_segmented_array_internal_locate(_segmented_array,
+                                          _start,
+                                          &block,
+                                          &offset);
+
+        run = d_segmented_array_internal_block_capacity(_segmented_array,
+                                                        block) - offset;
+
+        if (run > _count)
+        {
+            run = _count;
+        }
+
+        d_memcpy(destination,
+                 (const char*)_segmented_array->blocks[block] +
+                     (offset * _segmented_array->element_size),
+                 run * _segmented_array->element_size);
+
+        destination += run * _segmented_array->element_size;
+        _start      += run;
+        _count      -= run;
+    }
+
+    return true;
+}
+
+
+// =============================================================================
+// iteration helpers
+// =============================================================================
+
+/*
+d_segmented_array_foreach
+  Applies a function to each element in order.
+
+Parameter(s):
+  _segmented_array: pointer to segmented array
+  _apply_fn:        function to apply to each element
+Return:
+  none.
+*/
+void
+d_segmented_array_foreach
+(
+    struct d_segmented_array* _segmented_array,
+    fn_apply                  _apply_fn
+)
+{
+    char*  block;
+    size_t block_count;
+    size_t b;
+    size_t i;
+
+    if ( (!_segmented_array) ||
+         (!_apply_fn) )
+    {
+        return;
+    }
+
+    for (b = 0; b < d_segmented_array_block_count(_segmented_array); b++)
+    {
+        block = d_segmented_array_block(_segmented_array, b, &block_count);
+
+        for (i = 0; i < block_count; i++)
+        {
+            _apply_fn(block + (i * _segmented_array->element_size));
+        }
+    }
+
+    return;
+}
+
+
+// =============================================================================
+// filter functions
+// =============================================================================
+#if D_CFG_CONTAINER_FILTER_SEGMENTED_ARRAY
+
+/*
+d_segmented_array_count_where
+  Counts the elements satisfying a predicate, handing each block to
+d_contiguous_filter_count_where.
+
+Parameter(s):
+  _segmented_array: pointer to segmented array
+  _test:            predicate function
+  _context:         opaque context passed to _test
+Return:
+  Number of matching elements, or 0 if parameters are invalid
+*/
+size_t
+d_segmented_array_count_where
+(
+    const struct d_segmented_array* _segmented_array,
+    fn_predicate                    _test,
+    void*                           _context
+)
+{
+    const void* block;
+    size_t      block_count;
+    size_t      matches;
+    size_t      b;
+
+    if ( (!_segmented_array) ||
+         (!_test) )
+    {
+        return 0;
+    }
+
+    matches = 0;
+
+    for (b = 0; b < d_segmented_array_block_count(_segmented_array); b++)
+    {
+        block    = d_segmented_array_block(_segmented_array, b, &block_count);
+        matches += d_contiguous_filter_count_where(block,
+                                                   block_count,
+                                                   _segmented_array->element_size,
+                                                   _test,
+                                                   _context);
+    }
+
+    return matches;
+}
+
+/*
+d_segmented_array_find_first
+  Returns the first element satisfying a predicate, searching block by block
+with d_contiguous_filter_find_first.
+
+Parameter(s):
+  _segmented_array: pointer to segmented array
+  _test:            predicate function
+  _context:         opaque context passed to _test
+Return:
+  - Pointer to the first matching element
+  - NULL if none matches or parameters are invalid
+*/
+void*
+d_segmented_array_find_first
+(
+    const struct d_segmented_array* _segmented_array,
+    fn_predicate                    _test,
+    void*                           _context
+)
+{
+    const void* block;
+    void*       match;
+    size_t      block_count;
+    size_t      b;
+
+    if ( (!_segmented_array) ||
+         (!_test) )
+    {
+        return NULL;
+    }
+
+    for (b = 0; b < d_segmented_array_block_count(_segmented_array); b++)
+    {
+        block = d_segmented_array_block(_segmented_array, b, &block_count);
+        match = d_contiguous_filter_find_first(block,
+                                               block_count,
+                                               _segmented_array->element_size,
+                                               _test,
+                                               _context);
+
+        if (match)
+        {
+            return match;
+        }
+    }
+
+    return NULL;
+}
+
+/*
+d_segmented_array_any_match
+  Returns true if at least one element satisfies the predicate.
+
+Parameter(s):
+  _segmented_array: pointer to segmented array
+  _test:            predicate function
+  _context:         opaque context passed to _test
+Return:
+  - true if any element matches
+  - false otherwise or if parameters are invalid
+*/
+bool
+d_segmented_array_any_match
+(
+    const struct d_segmented_array* _segmented_array,
+    fn_predicate                    _test,
+    void*                           _context
+)
+{
+    return (d_segmented_array_find_first(_segmented_array,
+                                         _test,
+                                         _context) != NULL);
+}
+
+/*
+d_segmented_array_all_match
+  Returns true if every element satisfies the predicate (vacuously true for
+an empty array).
+
+Parameter(s):
+  _segmented_array: pointer to segmented array
+  _test:            predicate function
+  _context:         opaque context passed to _test
+Return:
+  - true if all elements match
+  - false otherwise or if parameters are invalid
+*/
+bool
+d_segmented_array_all_match
+(
+    const struct d_segmented_array* _segmented_array,
+    fn_predicate                    _test,
+    void*                           _context
+)
+{
+    const void* block;
+    size_t      block_count;
+    size_t      b;
+
+    if ( (!_segmented_array) ||
+         (!_test) )
+    {
+        return false;
+    }
+
+    for (b = 0; b < d_segmented_array_block_count(_segmented_array); b++)
+    {
+        block = d_segmented_array_block(_segmented_array, b, &block_count);
+
+        if (!d_contiguous_filter_all_match(block,
+                                           block_count,
+                                           _segmented_array->element_size,
+                                           _test,
+                                           _context))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/*
+d_segmented_array_filter_in_place
+  Keeps only the elements satisfying a predicate, preserving their order.
+Each block is compacted with d_contiguous_filter_in_place and the survivors
+are then moved down to close the gaps left in earlier blocks. Kept elements
+may therefore change address; blocks are not freed.
+
+Parameter(s):
+  _segmented_array: pointer to segmented array
+  _test:            predicate function
+  _context:         opaque context passed to _test
+Return:
+  New element count (unchanged if parameters are invalid)
+*/
+size_t
+d_segmented_array_filter_in_place
+(
+    struct d_segmented_array* _segmented_array,
+    fn_predicate              _test,
+    void*                     _context
+)
+{
+    void*  block;
+    size_t block_count;
+    size_t blocks;
+    size_t kept;
+    size_t write;
+    size_t b;
+
+    if (!_segmented_array)
+    {
+        return 0;
+    }
+
+    if (!_test)
+    {
+        return _segmented_array->count;
+    }
+
+    blocks = d_segmented_array_block_count(_segmented_array);
+    write  = 0;
+
+    for (b = 0; b < blocks; b++)
+    {
+        block = d_segmented_array_block(_segmented_array, b, &block_count);
+        kept  = d_contiguous_filter_in_place(block,
+                                             block_count,
+                                             _segmented_array->element_size,
+                                             _test,
+                                             _context);
+
+        // survivors land at or before their block's start
+        if (write != d_segmented_array_internal_capacity_of(_segmented_array, b))
+        {
+            d_segmented_array_internal_write(_segmented_array,
+                                             write,
+                                             block,
+                                             kept);
+        }
+
+        write += kept;
+    }
+
+    _segmented_array->count = write;
+
+    return write;
+}
+
+#endif  // D_CFG_CONTAINER_FILTER_SEGMENTED_ARRAY
+
+
+// =============================================================================
+// memory management
+// =============================================================================
+
+/*
+d_segmented_array_free
+  Frees the segmented array and all of its blocks.
+
+Parameter(s):
+  _segmented_array: pointer to segmented array; may be NULL
+Return:
+  none.
+*/
+void
+d_segmented_array_free
+(
+    struct d_segmented_array* _segmented_array
+)
+{
+    size_t b;
+
+    if (_segmented_array)
+    {
+        for (b = 0; b < _segmented_array->block_count; b++)
+        {
+            free(_segmented_array->blocks[b]);
+        }
+
+        free(_segmented_array);
+    }
+
+    return;
+}
+
+/*
+d_segmented_array_free_deep
+  Calls a free function on each element, then frees the segmented array.
+
+Parameter(s):
+  _segmented_array: pointer to segmented array; may be NULL
+  _free_fn:         function called with a pointer to each element; may be
+                    NULL to skip
+Return:
+  none.
+*/
+void
+d_segmented_array_free_deep
+(
+    struct d_segmented_array* _segmented_array,
+    fn_free                   _free_fn
+)
+{
+    if ( (_segmented_array) &&
+         (_free_fn) )
+    {
+        d_segmented_array_foreach(_segmented_array, (fn_apply)_free_fn);
+    }
+
+    d_segmented_array_free(_segmented_array);
+
+    return;
+}
@@ -0,0 +1,994 @@
+/******************************************************************************
+* djinterp [container]                                             soa_table.c
+*
+*   Implementation of the struct-of-arrays (columnar) table.
+*
+*
+* path:      \src\container\array\soa_table.c
+* link:      TBA
+* author(s): Samuel 'teer' Neal-Blim                          date: 2026.10.18
+******************************************************************************/
+#include "../../../../inc/c/container/array/soa_table.h"
+
+
+// =============================================================================
+// internal helper functions
+// =============================================================================
+
+// D_INTERNAL_SOA_TABLE_KIND_<kind>
+//   macro: tests whether a column type descriptor `_type` can be scanned as
+// a D_SOA_TABLE_TYPES key kind. Enumerations count as integers of either
+// signedness; pointers never match.
+#define D_INTERNAL_SOA_TABLE_KIND_SIGNED(_type)                               \
+    ( (!D_TYPE_IS_POINTER(_type)) &&                                          \
+      ( ( (D_TYPE_IS_INTEGRAL(_type)) && (D_TYPE_IS_SIGNED(_type)) ) ||       \
+        (D_TYPE_IS_ENUM(_type)) ) )
+#define D_INTERNAL_SOA_TABLE_KIND_UNSIGNED(_type)                             \
+    ( (!D_TYPE_IS_POINTER(_type)) &&                                          \
+      ( ( (D_TYPE_IS_INTEGRAL(_type)) && (!D_TYPE_IS_SIGNED(_type)) ) ||      \
+        (D_TYPE_IS_ENUM(_type)) ) )
+#define D_INTERNAL_SOA_TABLE_KIND_FLOAT(_type)                                \
+    ( (!D_TYPE_IS_POINTER(_type)) &&                                          \
+      (D_TYPE_IS_FLOATING(_type)) )
+
+// D_INTERNAL_SOA_TABLE_DISPATCH
+//   macro: expands `_loop` once per comparison with the matching C operator,
+// so the comparison is chosen once per scan rather than once per row.
+#define D_INTERNAL_SOA_TABLE_DISPATCH(_compare, _loop)                        \
+    switch (_compare)                                                         \
+    {                                                                         \
+        case D_SOA_EQ: _loop(==); break;                                      \
+        case D_SOA_NE: _loop(!=); break;                                      \
+        case D_SOA_LT: _loop(<);  break;                                      \
+        case D_SOA_LE: _loop(<=); break;                                      \
+        case D_SOA_GT: _loop(>);  break;                                      \
+        case D_SOA_GE: _loop(>=); break;                                      \
+        default:                  break;                                      \
+    }
+
+/*
+d_soa_table_internal_grow
+  Makes room for `_required` rows, doubling the capacity when it has to
+grow.
+
+Parameter(s):
+  _table:    pointer to table
+  _required: number of rows that must fit
+Return:
+  - true if the capacity is available
+  - false if the size overflows or memory allocation fails
+*/
+static bool
+d_soa_table_internal_grow
+(
+    struct d_soa_table* _table,
+    size_t              _required
+)
+{
+    size_t capacity;
+
+    if (_required <= _table->capacity)
+    {
+        return true;
+    }
+
+    capacity = (_table->capacity > 0) ? _table->capacity
+                                      : D_SOA_TABLE_DEFAULT_CAPACITY;
+
+    while (capacity < _required)
+    {
+        if (capacity > (SIZE_MAX / 2))
+        {
+            capacity = _required;
+
+            break;
+        }
+
+        capacity *= 2;
+    }
+
+    return d_soa_table_reserve(_table, capacity);
+}
+
+/*
+d_soa_table_internal_compare
+  Applies a comparison to the result of a three-way comparator.
+*/
+D_STATIC_INLINE bool
+d_soa_table_internal_compare
+(
+    int                _order,
+    enum d_soa_compare _compare
+)
+{
+    switch (_compare)
+    {
+        case D_SOA_EQ:
+            return (_order == 0);
+
+        case D_SOA_NE:
+            return (_order != 0);
+
+        case D_SOA_LT:
+            return (_order < 0);
+
+        case D_SOA_LE:
+            return (_order <= 0);
+
+        case D_SOA_GT:
+            return (_order > 0);
+
+        case D_SOA_GE:
+            return (_order >= 0);
+
+        default:
+            return false;
+    }
+}
+
+
+// =============================================================================
+// constructor functions
+// =============================================================================
+
+/*
+d_soa_table_new
+  Creates an empty table with one column per schema field. A field whose
+`size` is 0 takes the size implied by its type descriptor.
+
+Parameter(s):
+  _fields:           schema; copied, but field names are not
+  _field_count:      number of fields. Must be > 0.
+  _initial_capacity: rows to reserve; 0 selects
+                     D_SOA_TABLE_DEFAULT_CAPACITY
+Return:
+  - Pointer to new `d_soa_table` on success
+  - NULL if the schema is invalid (no fields, or a field of unknown size)
+    or memory allocation fails
+Notes:
+  - Caller is responsible for calling d_soa_table_free()
+*/
+struct d_soa_table*
+d_soa_table_new
+(
+    const struct d_soa_field* _fields,
+    size_t                    _field_count,
+    size_t                    _initial_capacity
+)
+{
+    struct d_soa_table* result;
+    size_t              i;
+
+    if ( (!_fields) ||
+         (_field_count == 0) )
+    {
+        return NULL;
+    }
+
+    result = calloc(1, sizeof(struct d_soa_table));
+
+    if (!result)
+    {
+        return NULL;
+    }
+
+    result->columns = calloc(_field_count, sizeof(struct d_soa_column));
+
+    if (!result->columns)
+    {
+        free(result);
+
+        return NULL;
+    }
+
+    result->column_count = _field_count;
+
+    for (i = 0; i < _field_count; i++)
+    {
+        result->columns[i].field = _fields[i];
+
+        if (result->columns[i].field.size == 0)
+        {
+            result->columns[i].field.size = D_TYPE_GET_SIZE(_fields[i].type);
+        }
+
+        if (result->columns[i].field.size == 0)
+        {
+            d_soa_table_free(result);
+
+            return NULL;
+        }
+    }
+
+    if (!d_soa_table_reserve(result,
+                             (_initial_capacity > 0)
+                                 ? _initial_capacity
+                                 : D_SOA_TABLE_DEFAULT_CAPACITY))
+    {
+        d_soa_table_free(result);
+
+        return NULL;
+    }
+
+    return result;
+}
+
+
+// =============================================================================
+// schema functions
+// =============================================================================
+
+/*
+d_soa_table_column_index
+  Looks up a column by field name.
+
+Parameter(s):
+  _table: pointer to table
+  _name:  field name
+Return:
+  - Index of the first column with that name
+  - -1 if there is none or parameters are invalid
+*/
+ssize_t
+d_soa_table_column_index
+(
+    const struct d_soa_table* _table,
+    const char*               _name
+)
+{
+    size_t i;
+
+    if ( (!_table) ||
+         (!_name) )
+    {
+        return -1;
+    }
+
+    for (i = 0; i < _table->column_count; i++)
+    {
+        if ( (_table->columns[i].field.name) &&
+             (strcmp(_table->columns[i].field.name, _name) == 0) )
+        {
+            return (ssize_t)i;
+        }
+    }
+
+    return -1;
+}
+
+/*
+d_soa_table_field
+  Returns the schema entry of a column.
+
+Parameter(s):
+  _table:  pointer to table
+  _column: column index
+Return:
+  - Pointer to the column's field
+  - NULL if parameters are invalid
+*/
+const struct d_soa_field*
+d_soa_table_field
+(
+    const struct d_soa_table* _table,
+    size_t                    _column
+)
+{
+    if ( (!_table) ||
+         (_column >= _table->column_count) )
+    {
+        return NULL;
+    }
+
+    return &_table->columns[_column].field;
+}
+
+
+// =============================================================================
+// column and cell access functions
+// =============================================================================
+
+/*
+d_soa_table_column
+  Returns the contiguous storage of a column, holding `count` values. The
+pointer is invalidated when the table grows.
+
+Parameter(s):
+  _table:  pointer to table
+  _column: column index
+Return:
+  - Pointer to the first value of the column
+  - NULL if parameters are invalid
+*/
+void*
+d_soa_table_column
+(
+    const struct d_soa_table* _table,
+    size_t                    _column
+)
+{
+    if ( (!_table) ||
+         (_column >= _table->column_count) )
+    {
+        return NULL;
+    }
+
+    return _table->columns[_column].data;
+}
+
+/*
+d_soa_table_cell
+  Returns a pointer to one value.
+
+Parameter(s):
+  _table:  pointer to table
+  _row:    row index
+  _column: column index
+Return:
+  - Pointer to the value
+  - NULL if parameters are invalid or out of range
+*/
+void*
+d_soa_table_cell
+(
+    const struct d_soa_table* _table,
+    size_t                    _row,
+    size_t                    _column
+)
+{
+    if ( (!_table)                          ||
+         (_row >= _table->count)            ||
+         (_column >= _table->column_count) )
+    {
+        return NULL;
+    }
+
+    return (char*)_table->columns[_column].data +
+           (_row * _table->columns[_column].field.size);
+}
+
+/*
+d_soa_table_set_cell
+  Overwrites one value.
+
+Parameter(s):
+  _table:  pointer to table
+  _row:    row index
+  _column: column index
+  _value:  pointer to the new value (the column's field size in bytes)
+Return:
+  - true if the value was set
+  - false if parameters are invalid or out of range
+*/
+bool
+d_soa_table_set_cell
+(
+    struct d_soa_table* _table,
+    size_t              _row,
+    size_t              _column,
+    const void*         _value
+)
+{
+    void* cell;
+
+    cell = d_soa_table_cell(_table, _row, _column);
+
+    if ( (!cell) ||
+         (!_value) )
+    {
+        return false;
+    }
+
+    d_memcpy(cell, _value, _table->columns[_column].field.size);
+
+    return true;
+}
+
+
+// =============================================================================
+// row functions
+// =============================================================================
+
+/*
+d_soa_table_push_row
+  Appends one row, scattering the fields of a row struct into the columns.
+
+Parameter(s):
+  _table: pointer to table
+  _row:   pointer to a row struct laid out as described by the schema
+Return:
+  - true if the row was added
+  - false if parameters are invalid or memory allocation fails
+*/
+bool
+d_soa_table_push_row
+(
+    struct d_soa_table* _table,
+    const void*         _row
+)
+{
+    const struct d_soa_field* field;
+    size_t                    i;
+
+    if ( (!_table) ||
+         (!_row) ||
+         (_table->count == SIZE_MAX) ||
+         (!d_soa_table_internal_grow(_table, _table->count + 1)) )
+    {
+        return false;
+    }
+
+    for (i = 0; i < _table->column_count; i++)
+    {
+        field = &_table->columns[i].field;
+
+        d_memcpy((char*)_table->columns[i].data + (_table->count * field->size),
+                 (const char*)_row + field->offset,
+                 field->size);
+    }
+
+    _table->count++;
+
+    return true;
+}
+
+/*
+d_soa_table_push_rows
+  Appends an array of row structs. The copy runs one column at a time, so
+each column is written sequentially.
+
+Parameter(s):
+  _table:    pointer to table
+  _rows:     array of row structs; may be NULL only if _count is 0
+  _row_size: stride in bytes between rows (normally sizeof the row struct)
+  _count:    number of rows
+Return:
+  - true if the rows were added
+  - false if parameters are invalid or memory allocation fails (the table
+    is unchanged)
+*/
+bool
+d_soa_table_push_rows
+(
+    struct d_soa_table* _table,
+    const void*         _rows,
+    size_t              _row_size,
+    size_t              _count
+)
+{
+    const struct d_soa_field* field;
+    const char*               source;
+    char*                     destination;
+    size_t                    i;
+    size_t                    r;
+
+    if ( (!_table) ||
+         ( (!_rows) && (_count > 0) ) ||
+         (_count > SIZE_MAX - _table->count) )
+    {
+        return false;
+    }
+
+    if (!d_soa_table_internal_grow(_table, _table->count + _count))
+    {
+        return false;
+    }
+
+    for (i = 0; i < _table->column_count; i++)
+    {
+        field       = &_table->columns[i].field;
+        source      = (const char*)_rows + field->offset;
+        destination = (char*)_table->columns[i].data +
+                      (_table->count * field->size);
+
+        for (r = 0; r < _count; r++)
+        {
+            d_memcpy(destination, source, field->size);
+
+            source      += _row_size;
+            destination += field->size;
+        }
+    }
+
+    _table->count += _count;
+
+    return true;
+}
+
+/*
+d_soa_table_get_row
+  Gathers one row back into a row struct. Bytes of the struct not covered
+by a field are left untouched.
+
+Parameter(s):
+  _table:   pointer to table
+  _row:     row index
+  _out_row: row struct to fill
+Return:
+  - true if the row was copied
+  - false if parameters are invalid or out of range
+*/
+bool
+d_soa_table_get_row
+(
+    const struct d_soa_table* _table,
+    size_t                    _row,
+    void*                     _out_row
+)
+{
+    const struct d_soa_field* field;
+    size_t                    i;
+
+    if ( (!_table)               ||
+         (!_out_row)             ||
+         (_row >= _table->count) )
+    {
+        return false;
+    }
+
+    for (i = 0; i < _table->column_count; i++)
+    {
+        field = &_table->columns[i].field;
+
+        d_memcpy((char*)_out_row + field->offset,
+                 (const char*)_table->columns[i].data + (_row * field->size),
+                 field->size);
+    }
+
+    return true;
+}
+
+/*
+d_soa_table_remove
+  Removes a row, keeping the order of the remaining rows.
+
+Parameter(s):
+  _table: pointer to table
+  _row:   row index
+Return:
+  - true if the row was removed
+  - false if parameters are invalid or out of range
+*/
+bool
+d_soa_table_remove
+(
+    struct d_soa_table* _table,
+    size_t              _row
+)
+{
+    char*  data;
+    size_t size;
+    size_t i;
+
+    if ( (!_table) ||
+         (_row >= _table->count) )
+    {
+        return false;
+    }
+
+    for (i = 0; i < _table->column_count; i++)
+    {
+        data = (char*)_table->columns[i].data;
+        size = _table->columns[i].field.size;
+
+        memmove(data + (_row * size),
+                data + ((_row + 1) * size),
+                (_table->count - _row - 1) * size);
+    }
+
+    _table->count--;
+
+    return true;
+}
+
+/*
+d_soa_table_remove_swap
+  Removes a row in O(1) by moving the last row into its place.
+
+Parameter(s):
+  _table: pointer to table
+  _row:   row index
+Return:
+  - true if the row was removed
+  - false if parameters are invalid or out of range
+*/
+bool
+d_soa_table_remove_swap
+(
+    struct d_soa_table* _table,
+    size_t              _row
+)
+{
+    char*  data;
+    size_t size;
+    size_t i;
+
+    if ( (!_table) ||
+         (_row >= _table->count) )
+    {
+        return false;
+    }
+
+    _table->count--;
+
+    if (_row != _table->count)
+    {
+        for (i = 0; i < _table->column_count; i++)
+        {
+            data = (char*)_table->columns[i].data;
+            size = _table->columns[i].field.size;
+
+            d_memcpy(data + (_row * size),
+                     data + (_table->count * size),
+                     size);
+        }
+    }
+
+    return true;
+}
+
+/*
+d_soa_table_clear
+  Removes all rows, keeping the column storage.
+
+Parameter(s):
+  _table: pointer to table
+Return:
+  - true on success
+  - false if the table is NULL
+*/
+bool
+d_soa_table_clear
+(
+    struct d_soa_table* _table
+)
+{
+    if (!_table)
+    {
+        return false;
+    }
+
+    _table->count = 0;
+
+    return true;
+}
+
+/*
+d_soa_table_reserve
+  Makes sure every column has room for `_capacity` rows.
+
+Parameter(s):
+  _table:    pointer to table
+  _capacity: rows that must fit
+Return:
+  - true if the capacity is available
+  - false if the size overflows or memory allocation fails; columns that
+    were already resized keep their larger storage and the table remains
+    valid
+*/
+bool
+d_soa_table_reserve
+(
+    struct d_soa_table* _table,
+    size_t              _capacity
+)
+{
+    void*  data;
+    size_t i;
+
+    if (!_table)
+    {
+        return false;
+    }
+
+    if (_capacity <= _table->capacity)
+    {
+        return true;
+    }
+
+    for (i = 0; i < _table->column_count; i++)
+    {
+        if (_capacity > (SIZE_MAX / _table->columns[i].field.size))
+        {
+            return false;
+        }
+
+        data = realloc(_table->columns[i].data,
+                       _capacity * _table->columns[i].field.size);
+
+        if (!data)
+        {
+            return false;
+        }
+
+        _table->columns[i].data = data;
+    }
+
+    _table->capacity = _capacity;
+
+    return true;
+}
+
+
+// =============================================================================
+// query functions
+// =============================================================================
+
+/*
+d_soa_table_count
+  Returns the number of rows.
+
+Parameter(s):
+  _table: pointer to table
+Return:
+  Number of rows (0 if _table is NULL)
+*/
+size_t
+d_soa_table_count
+(
+    const struct d_soa_table* _table
+)
+{
+    return (_table) ? _table->count : 0;
+}
+
+/*
+d_soa_table_column_count
+  Returns the number of columns.
+
+Parameter(s):
+  _table: pointer to table
+Return:
+  Number of columns (0 if _table is NULL)
+*/
+size_t
+d_soa_table_column_count
+(
+    const struct d_soa_table* _table
+)
+{
+    return (_table) ? _table->column_count : 0;
+}
+
+
+// =============================================================================
+// scan functions
+// =============================================================================
+
+// D_INTERNAL_SOA_TABLE_DEFINE_TYPED
+//   macro: defines the typed scans for one D_SOA_TABLE_TYPES tuple. Each
+// loop writes the candidate index unconditionally and advances the output
+// by the comparison result, so there is no data-dependent branch.
+//   select writes matching row indices, ascending, to `_out_rows`, which
+// must hold d_soa_table_count(_table) entries. refine keeps, in place and
+// in order, the entries of `_rows` (valid row indices, e.g. from an earlier
+// select) whose row also matches. All three return the number of matching
+// rows, or 0 when the column does not exist or its descriptor does not
+// match the scan type. Floating-point comparisons follow C, so NaN only
+// matches D_SOA_NE.
+#define D_INTERNAL_SOA_TABLE_DEFINE_TYPED(_suffix, _type, _kind)              \
+                                                                              \
+    D_STATIC_INLINE const _type*                                              \
+    d_soa_table_internal_column_##_suffix                                     \
+    (                                                                         \
+        const struct d_soa_table* _table,                                     \
+        size_t                    _column                                     \
+    )                                                                         \
+    {                                                                         \
+        if ( (!_table)                                              ||        \
+             (_column >= _table->column_count)                      ||        \
+             (_table->columns[_column].field.size != sizeof(_type)) ||        \
+             (!D_INTERNAL_SOA_TABLE_KIND_##_kind(                             \
+                  _table->columns[_column].field.type)) )                     \
+        {                                                                     \
+            return NULL;                                                      \
+        }                                                                     \
+                                                                              \
+        return (const _type*)_table->columns[_column].data;                   \
+    }                                                                         \
+                                                                              \
+    size_t                                                                    \
+    d_soa_table_select_##_suffix                                              \
+    (                                                                         \
+        const struct d_soa_table* _table,                                     \
+        size_t                    _column,                                    \
+        enum d_soa_compare        _compare,                                   \
+        _type                     _value,                                     \
+        size_t*                   _out_rows                                   \
+    )                                                                         \
+    {                                                                         \
+        const _type* values;                                                  \
+        size_t       matched;                                                 \
+        size_t       i;                                                       \
+                                                                              \
+        values  = d_soa_table_internal_column_##_suffix(_table, _column);     \
+        matched = 0;                                                          \
+                                                                              \
+        if ( (!values) ||                                                     \
+             (!_out_rows) )                                                   \
+        {                                                                     \
+            return 0;                                                         \
+        }                                                                     \
+                                                                              \
+        D_INTERNAL_SOA_TABLE_DISPATCH(_compare, D_INTERNAL_SOA_TABLE_SELECT)  \
+                                                                              \
+        return matched;                                                       \
+    }                                                                         \
+                                                                              \
+    size_t                                                                    \
+    d_soa_table_refine_##_suffix                                              \
+    (                                                                         \
+        const struct d_soa_table* _table,                                     \
+        size_t                    _column,                                    \
+        enum d_soa_compare        _compare,                                   \
+        _type                     _value,                                     \
+        size_t*                   _rows,                                      \
+        size_t                    _row_count                                  \
+    )                                                                         \
+    {                                                                         \
+        const _type* values;                                                  \
+        size_t       matched;                                                 \
+        size_t       row;                                                     \
+        size_t       i;                                                       \
+                                                                              \
+        values  = d_soa_table_internal_column_##_suffix(_table, _column);     \
+        matched = 0;                                                          \
+                                                                              \
+        if ( (!values) ||                                                     \
+             ( (!_rows) && (_row_count > 0) ) )                               \
+        {                                                                     \
+            return 0;                                                         \
+        }                                                                     \
+                                                                              \
+        D_INTERNAL_SOA_TABLE_DISPATCH(_compare, D_INTERNAL_SOA_TABLE_REFINE)  \
+                                                                              \
+        return matched;                                                       \
+    }                                                                         \
+                                                                              \
+    size_t                                                                    \
+    d_soa_table_count_##_suffix                                               \
+    (                                                                         \
+        const struct d_soa_table* _table,                                     \
+        size_t                    _column,                                    \
+        enum d_soa_compare        _compare,                                   \
+        _type                     _value                                      \
+    )                                                                         \
+    {                                                                         \
+        const _type* values;                                                  \
+        size_t       matched;                                                 \
+        size_t       i;                                                       \
+                                                                              \
+        values  = d_soa_table_internal_column_##_suffix(_table, _column);     \
+        matched = 0;                                                          \
+                                                                              \
+        if (!values)                                                          \
+        {                                                                     \
+            return 0;                                                         \
+        }                                                                     \
+                                                                              \
+        D_INTERNAL_SOA_TABLE_DISPATCH(_compare, D_INTERNAL_SOA_TABLE_COUNT)   \
+                                                                              \
+        return matched;                                                       \
+    }
+
+// D_INTERNAL_SOA_TABLE_SELECT / _REFINE / _COUNT
+//   macro: the loop bodies expanded by D_INTERNAL_SOA_TABLE_DISPATCH; they
+// use the locals of the typed scan they are expanded in.
+#define D_INTERNAL_SOA_TABLE_SELECT(_op)                                      \
+    for (i = 0; i < _table->count; i++)                                       \
+    {                                                                         \
+        _out_rows[matched]  = i;                                              \
+        matched            += (size_t)(values[i] _op _value);                 \
+    }
+#define D_INTERNAL_SOA_TABLE_REFINE(_op)                                      \
+    for (i = 0; i < _row_count; i++)                                          \
+    {                                                                         \
+        row             = _rows[i];                                           \
+        _rows[matched]  = row;                                                \
+        matched        += (size_t)(values[row] _op _value);                   \
+    }
+#define D_INTERNAL_SOA_TABLE_COUNT(_op)                                       \
+    for (i = 0; i < _table->count; i++)                                       \
+    {                                                                         \
+        matched += (size_t)(values[i] _op _value);                            \
+    }
+
+// D_INTERNAL_SOA_TABLE_DEFINE
+//   macro: unpacks a parenthesized tuple for D_FOR_EACH.
+#define D_INTERNAL_SOA_TABLE_DEFINE(_tuple)                                   \
+    D_INTERNAL_SOA_TABLE_DEFINE_TYPED _tuple
+
+D_FOR_EACH(D_INTERNAL_SOA_TABLE_DEFINE, D_SOA_TABLE_TYPES)
+
+/*
+d_soa_table_select_cmp
+  Selects the rows of any column type whose value compares true against
+`_value` under a three-way comparator.
+
+Parameter(s):
+  _table:      pointer to table
+  _column:     column index
+  _compare:    comparison applied to comparator(cell, _value)
+  _value:      operand passed as the second comparator argument
+  _comparator: three-way comparator for the column's values
+  _out_rows:   receives matching row indices in ascending order; must hold
+               d_soa_table_count(_table) entries
+Return:
+  Number of matching rows (0 if parameters are invalid)
+*/
+size_t
+d_soa_table_select_cmp
+(
+    const struct d_soa_table* _table,
+    size_t                    _column,
+    enum d_soa_compare        _compare,
+    const void*               _value,
+    fn_comparator             _comparator,
+    size_t*                   _out_rows
+)
+{
+    const char* cell;
+    size_t      size;
+    size_t      matched;
+    size_t      i;
+
+    if ( (!_table)                          ||
+         (_column >= _table->column_count)  ||
+         (!_comparator)                     ||
+         (!_out_rows) )
+    {
+        return 0;
+    }
+
+    cell    = (const char*)_table->columns[_column].data;
+    size    = _table->columns[_column].field.size;
+    matched = 0;
+
+    for (i = 0; i < _table->count; i++)
+    {
+        if (d_soa_table_internal_compare(_comparator(cell, _value), _compare))
+        {
+            _out_rows[matched++] = i;
+        }
+
+        cell += size;
+    }
+
+    return matched;
+}
+
+
+// =============================================================================
+// memory management
+// =============================================================================
+
+/*
+d_soa_table_free
+  Frees the table and all of its columns.
+
+Parameter(s):
+  _table: pointer to table; may be NULL
+Return:
+  none.
+*/
+void
+d_soa_table_free
+(
+    struct d_soa_table* _table
+)
+{
+    size_t i;
+
+    if (_table)
+    {
+        for (i = 0; i < _table->column_count; i++)
+        {
+            free(_table->columns[i].data);
+        }
+
+        free(_table->columns);
+        free(_table);
+    }
+
+    return;
+}
@@ -0,0 +1,1908 @@
+/******************************************************************************
+* djinterp [container]                                           sorted_array.c
+*
+*   Implementation of the sorted array data structure and its Eytzinger
+* snapshot.
+*
+*
+* path:      \src\container\array\sorted_array.c
+* link:      TBA
+* author(s): Samuel 'teer' Neal-Blim                          date: 2026.10.18
+******************************************************************************/
+#include "../../../../inc/c/container/array/sorted_array.h"
+
+
+// =============================================================================
+// internal helper functions
+// =============================================================================
+
+// D_INTERNAL_SORTED_ARRAY_PREFETCH
+//   macro: hints that the byte at `address` will be read soon. Addresses past
+// the end of the buffer are harmless: a prefetch never faults.
+#if ( defined(D_ENV_COMPILER_GCC) ||                                          \
+      defined(D_ENV_COMPILER_CLANG) )
+    #define D_INTERNAL_SORTED_ARRAY_PREFETCH(address)                         \
+        __builtin_prefetch((const void*)(address))
+#else
+    #define D_INTERNAL_SORTED_ARRAY_PREFETCH(address)                         \
+        ((void)0)
+#endif
+
+// D_INTERNAL_SORTED_ARRAY_INSERTION_RUN
+//   constant: run length sorted by insertion before merging in
+// d_sorted_array_internal_sort.
+#define D_INTERNAL_SORTED_ARRAY_INSERTION_RUN 16
+
+/*
+d_sorted_array_internal_compare
+  Three-way comparison of two elements under an ordering: an integer key at
+`_key_offset`, or `_comparator` when `_key` is D_SORTED_ARRAY_KEY_COMPARATOR.
+Keys are read with memcpy, so elements need not be aligned for them.
+*/
+D_STATIC_INLINE int
+d_sorted_array_internal_compare
+(
+    enum d_sorted_array_key _key,
+    size_t                  _key_offset,
+    fn_comparator           _comparator,
+    const void*             _a,
+    const void*             _b
+)
+{
+    const char* a;
+    const char* b;
+
+    a = (const char*)_a + _key_offset;
+    b = (const char*)_b + _key_offset;
+
+    switch (_key)
+    {
+        case D_SORTED_ARRAY_KEY_INT32:
+        {
+            int32_t x;
+            int32_t y;
+
+            memcpy(&x, a, sizeof(x));
+            memcpy(&y, b, sizeof(y));
+
+            return (x > y) - (x < y);
+        }
+
+        case D_SORTED_ARRAY_KEY_UINT32:
+        {
+            uint32_t x;
+            uint32_t y;
+
+            memcpy(&x, a, sizeof(x));
+            memcpy(&y, b, sizeof(y));
+
+            return (x > y) - (x < y);
+        }
+
+        case D_SORTED_ARRAY_KEY_INT64:
+        {
+            int64_t x;
+            int64_t y;
+
+            memcpy(&x, a, sizeof(x));
+            memcpy(&y, b, sizeof(y));
+
+            return (x > y) - (x < y);
+        }
+
+        case D_SORTED_ARRAY_KEY_UINT64:
+        {
+            uint64_t x;
+            uint64_t y;
+
+            memcpy(&x, a, sizeof(x));
+            memcpy(&y, b, sizeof(y));
+
+            return (x > y) - (x < y);
+        }
+
+        case D_SORTED_ARRAY_KEY_COMPARATOR:
+        default:
+            return _comparator(_a, _b);
+    }
+}
+
+/*
+d_sorted_array_internal_cmp
+  Compares two elements of `_sorted_array`.
+*/
+D_STATIC_INLINE int
+d_sorted_array_internal_cmp
+(
+    const struct d_sorted_array* _sorted_array,
+    const void*                  _a,
+    const void*                  _b
+)
+{
+    return d_sorted_array_internal_compare(_sorted_array->key,
+                                           _sorted_array->key_offset,
+                                           _sorted_array->comparator,
+                                           _a,
+                                           _b);
+}
+
+/*
+d_sorted_array_internal_bound_comparator
+  Branchless lower (`_upper` false) or upper (`_upper` true) bound through a
+comparator. The search range halves each step and the new base is picked
+with a select rather than a branch, so every search runs the same number of
+probes and the loop body has nothing to mispredict.
+*/
+static size_t
+d_sorted_array_internal_bound_comparator
+(
+    const char*   _elements,
+    size_t        _count,
+    size_t        _element_size,
+    fn_comparator _comparator,
+    const void*   _probe,
+    bool          _upper
+)
+{
+    const char* base;
+    size_t      half;
+    int         limit;
+
+    if (_count == 0)
+    {
+        return 0;
+    }
+
+    // lower bound skips elements < probe, upper bound elements <= probe
+    limit = (_upper) ? 1 : 0;
+    base  = _elements;
+
+    while (_count > 1)
+    {
+        half   = _count / 2;
+        base   = (_comparator(base + (half * _element_size), _probe) < limit)
+                     ? base + (half * _element_size)
+                     : base;
+        _count -= half;
+    }
+
+    return ((size_t)(base - _elements) / _element_size) +
+           ((_comparator(base, _probe) < limit) ? 1 : 0);
+}
+
+// D_INTERNAL_SORTED_ARRAY_BOUND
+//   macro: defines d_sorted_array_internal_bound_<suffix>, the branchless
+// lower/upper bound for elements whose key at `_key_offset` has type
+// `key_type`. The probe is widened to `probe_type` so that callers may pass
+// any 64-bit key.
+#define D_INTERNAL_SORTED_ARRAY_BOUND(suffix, key_type, probe_type)           \
+    static size_t                                                             \
+    d_sorted_array_internal_bound_##suffix                                    \
+    (                                                                         \
+        const char* _elements,                                                \
+        size_t      _count,                                                   \
+        size_t      _element_size,                                            \
+        size_t      _key_offset,                                              \
+        probe_type  _probe,                                                   \
+        bool        _upper                                                    \
+    )                                                                         \
+    {                                                                         \
+        const char* base;                                                     \
+        size_t      half;                                                     \
+        key_type    key;                                                      \
+                                                                              \
+        if (_count == 0)                                                      \
+        {                                                                     \
+            return 0;                                                         \
+        }                                                                     \
+                                                                              \
+        base = _elements;                                                     \
+                                                                              \
+        while (_count > 1)                                                    \
+        {                                                                     \
+            half = _count / 2;                                                \
+            memcpy(&key,                                                      \
+                   base + (half * _element_size) + _key_offset,               \
+                   sizeof(key));                                              \
+            base = ( ((probe_type)key < _probe) |                             \
+                     ((_upper) & ((probe_type)key == _probe)) )               \
+                       ? base + (half * _element_size)                        \
+                       : base;                                                \
+            _count -= half;                                                   \
+        }                                                                     \
+                                                                              \
+        memcpy(&key, base + _key_offset, sizeof(key));                        \
+                                                                              \
+        return ((size_t)(base - _elements) / _element_size) +                 \
+               ( ( ((probe_type)key < _probe) |                               \
+                   ((_upper) & ((probe_type)key == _probe)) ) ? 1 : 0 );      \
+    }
+
+D_INTERNAL_SORTED_ARRAY_BOUND(int32,  int32_t,  int64_t)
+D_INTERNAL_SORTED_ARRAY_BOUND(uint32, uint32_t, uint64_t)
+D_INTERNAL_SORTED_ARRAY_BOUND(int64,  int64_t,  int64_t)
+D_INTERNAL_SORTED_ARRAY_BOUND(uint64, uint64_t, uint64_t)
+
+/*
+d_sorted_array_internal_bound_int
+  Dispatches a signed-key bound to the loop for the array's key type.
+Unsigned arrays treat a negative key as smaller than every element.
+*/
+static size_t
+d_sorted_array_internal_bound_int
+(
+    const struct d_sorted_array* _sorted_array,
+    int64_t                      _key,
+    bool                         _upper
+)
+{
+    const char* elements;
+
+    elements = (const char*)_sorted_array->elements;
+
+    switch (_sorted_array->key)
+    {
+        case D_SORTED_ARRAY_KEY_INT32:
+            return d_sorted_array_internal_bound_int32(elements,
+                                                       _sorted_array->count,
+                                                       _sorted_array->element_size,
+                                                       _sorted_array->key_offset,
+                                                       _key,
+                                                       _upper);
+
+        case D_SORTED_ARRAY_KEY_INT64:
+            return d_sorted_array_internal_bound_int64(elements,
+                                                       _sorted_array->count,
+                                                       _sorted_array->element_size,
+                                                       _sorted_array->key_offset,
+                                                       _key,
+                                                       _upper);
+
+        case D_SORTED_ARRAY_KEY_UINT32:
+        case D_SORTED_ARRAY_KEY_UINT64:
+            if (_key < 0)
+            {
+                return 0;
+            }
+
+            return (_sorted_array->key == D_SORTED_ARRAY_KEY_UINT32)
+                ? d_sorted_array_internal_bound_uint32(elements,
+                                                       _sorted_array->count,
+                                                       _sorted_array->element_size,
+                                                       _sorted_array->key_offset,
+                                                       (uint64_t)_key,
+                                                       _upper)
+                : d_sorted_array_internal_bound_uint64(elements,
+                                                       _sorted_array->count,
+                                                       _sorted_array->element_size,
+                                                       _sorted_array->key_offset,
+                                                       (uint64_t)_key,
+                                                       _upper);
+
+        case D_SORTED_ARRAY_KEY_COMPARATOR:
+        default:
+            return 0;
+    }
+}
+
+/*
+d_sorted_array_internal_bound_uint
+  Dispatches an unsigned-key bound to the loop for the array's key type.
+Signed arrays treat a key above INT64_MAX as larger than every element.
+*/
+static size_t
+d_sorted_array_internal_bound_uint
+(
+    const struct d_sorted_array* _sorted_array,
+    uint64_t                     _key,
+    bool                         _upper
+)
+{
+    const char* elements;
+
+    elements = (const char*)_sorted_array->elements;
+
+    switch (_sorted_array->key)
+    {
+        case D_SORTED_ARRAY_KEY_UINT32:
+            return d_sorted_array_internal_bound_uint32(elements,
+                                                        _sorted_array->count,
+                                                        _sorted_array->element_size,
+                                                        _sorted_array->key_offset,
+                                                        _key,
+                                                        _upper);
+
+        case D_SORTED_ARRAY_KEY_UINT64:
+            return d_sorted_array_internal_bound_uint64(elements,
+                                                        _sorted_array->count,
+                                                        _sorted_array->element_size,
+                                                        _sorted_array->key_offset,
+                                                        _key,
+                                                        _upper);
+
+        case D_SORTED_ARRAY_KEY_INT32:
+        case D_SORTED_ARRAY_KEY_INT64:
+            if (_key > (uint64_t)INT64_MAX)
+            {
+                return _sorted_array->count;
+            }
+
+            return d_sorted_array_internal_bound_int(_sorted_array,
+                                                     (int64_t)_key,
+                                                     _upper);
+
+        case D_SORTED_ARRAY_KEY_COMPARATOR:
+        default:
+            return 0;
+    }
+}
+
+/*
+d_sorted_array_internal_bound
+  Lower or upper bound of an element-shaped probe, using the typed loop when
+the array is keyed.
+*/
+static size_t
+d_sorted_array_internal_bound
+(
+    const struct d_sorted_array* _sorted_array,
+    const void*                  _probe,
+    bool                         _upper
+)
+{
+    const char* key;
+
+    key = (const char*)_probe + _sorted_array->key_offset;
+
+    switch (_sorted_array->key)
+    {
+        case D_SORTED_ARRAY_KEY_INT32:
+        {
+            int32_t value;
+
+            memcpy(&value, key, sizeof(value));
+
+            return d_sorted_array_internal_bound_int(_sorted_array,
+                                                     value,
+                                                     _upper);
+        }
+
+        case D_SORTED_ARRAY_KEY_INT64:
+        {
+            int64_t value;
+
+            memcpy(&value, key, sizeof(value));
+
+            return d_sorted_array_internal_bound_int(_sorted_array,
+                                                     value,
+                                                     _upper);
+        }
+
+        case D_SORTED_ARRAY_KEY_UINT32:
+        {
+            uint32_t value;
+
+            memcpy(&value, key, sizeof(value));
+
+            return d_sorted_array_internal_bound_uint(_sorted_array,
+                                                      value,
+                                                      _upper);
+        }
+
+        case D_SORTED_ARRAY_KEY_UINT64:
+        {
+            uint64_t value;
+
+            memcpy(&value, key, sizeof(value));
+
+            return d_sorted_array_internal_bound_uint(_sorted_array,
+                                                      value,
+                                                      _upper);
+        }
+
+        case D_SORTED_ARRAY_KEY_COMPARATOR:
+        default:
+            return d_sorted_array_internal_bound_comparator(
+                       (const char*)_sorted_array->elements,
+                       _sorted_array->count,
+                       _sorted_array->element_size,
+                       _sorted_array->comparator,
+                       _probe,
+                       _upper);
+    }
+}
+
+/*
+d_sorted_array_internal_reserve
+  Grows the buffer to hold at least `_capacity` elements, doubling the
+current capacity at a minimum.
+*/
+static bool
+d_sorted_array_internal_reserve
+(
+    struct d_sorted_array* _sorted_array,
+    size_t                 _capacity
+)
+{
+    void*  elements;
+    size_t capacity;
+
+    if (_capacity <= _sorted_array->capacity)
+    {
+        return true;
+    }
+
+    capacity = (_sorted_array->capacity > 0)
+                   ? _sorted_array->capacity
+                   : D_SORTED_ARRAY_DEFAULT_CAPACITY;
+
+    while (capacity < _capacity)
+    {
+        if (capacity > (SIZE_MAX / 2))
+        {
+            capacity = _capacity;
+
+            break;
+        }
+
+        capacity *= 2;
+    }
+
+    if (capacity > (SIZE_MAX / _sorted_array->element_size))
+    {
+        return false;
+    }
+
+    elements = realloc(_sorted_array->elements,
+                       capacity * _sorted_array->element_size);
+
+    if (!elements)
+    {
+        return false;
+    }
+
+    _sorted_array->elements = elements;
+    _sorted_array->capacity = capacity;
+
+    return true;
+}
+
+/*
+d_sorted_array_internal_sort
+  Stable sort of `_count` elements in `_data` using `_scratch` (same size)
+as the merge buffer: insertion-sorted runs, then bottom-up merges that
+ping-pong between the two buffers. The result is left in `_data`.
+*/
+static void
+d_sorted_array_internal_sort
+(
+    const struct d_sorted_array* _sorted_array,
+    char*                        _data,
+    char*                        _scratch,
+    size_t                       _count
+)
+{
+    size_t size;
+    size_t run;
+    size_t start;
+    size_t i;
+    size_t j;
+    size_t mid;
+    size_t end;
+    size_t l;
+    size_t r;
+    size_t w;
+    char*  from;
+    char*  to;
+    char*  swap;
+
+    size = _sorted_array->element_size;
+
+    // insertion-sort fixed runs, using the scratch start as a temporary
+    for (start = 0; start < _count; start += D_INTERNAL_SORTED_ARRAY_INSERTION_RUN)
+    {
+        end = start + D_INTERNAL_SORTED_ARRAY_INSERTION_RUN;
+
+        if (end > _count)
+        {
+            end = _count;
+        }
+
+        for (i = start + 1; i < end; i++)
+        {
+            if (d_sorted_array_internal_cmp(_sorted_array,
+                                            _data + ((i - 1) * size),
+                                            _data + (i * size)) <= 0)
+            {
+                continue;
+            }
+
+            memcpy(_scratch, _data + (i * size), size);
+
+            j = i;
+
+            while ( (j > start) &&
+                    (d_sorted_array_internal_cmp(_sorted_array,
+                                                 _data + ((j - 1) * size),
+                                                 _scratch) > 0) )
+            {
+                j--;
+            }
+
+            memmove(_data + ((j + 1) * size),
+                    _data + (j * size),
+                    (i - j) * size);
+            memcpy(_data + (j * size), _scratch, size);
+        }
+    }
+
+    from = _data;
+    to   = _scratch;
+
+    for (run = D_INTERNAL_SORTED_ARRAY_INSERTION_RUN; run < _count; run *= 2)
+    {
+        for (start = 0; start < _count; start += 2 * run)
+        {
+            mid = (start + run < _count) ? start + run : _count;
+            end = (mid + run < _count) ? mid + run : _count;
+            l   = start;
+            r   = mid;
+            w   = start;
+
+            // take from the left run on ties to stay stable
+            while ( (l < mid) &&
+                    (r < end) )
+            {
+                if (d_sorted_array_internal_cmp(_sorted_array,
+                                                from + (r * size),
+                                                from + (l * size)) < 0)
+                {
+                    memcpy(to + (w++ * size), from + (r++ * size), size);
+                }
+                else
+                {
+                    memcpy(to + (w++ * size), from + (l++ * size), size);
+                }
+            }
+
+            memcpy(to + (w * size), from + (l * size), (mid - l) * size);
+            w += mid - l;
+            memcpy(to + (w * size), from + (r * size), (end - r) * size);
+        }
+
+        swap = from;
+        from = to;
+        to   = swap;
+    }
+
+    if (from != _data)
+    {
+        memcpy(_data, from, _count * size);
+    }
+
+    return;
+}
+
+
+// =============================================================================
+// constructor functions
+// =============================================================================
+
+/*
+d_sorted_array_new
+  Creates a new empty sorted array ordered by a comparator.
+
+Parameter(s):
+  _element_size: size in bytes of each element. Must be > 0.
+  _comparator:   ordering of elements. Must not be NULL.
+Return:
+  - Pointer to new `d_sorted_array` on success
+  - NULL if parameters are invalid or memory allocation fails
+Notes:
+  - Caller is responsible for calling d_sorted_array_free()
+*/
+struct d_sorted_array*
+d_sorted_array_new
+(
+    size_t        _element_size,
+    fn_comparator _comparator
+)
+{
+    struct d_sorted_array* result;
+
+    if ( (_element_size == 0) ||
+         (!_comparator) )
+    {
+        return NULL;
+    }
+
+    result = calloc(1, sizeof(struct d_sorted_array));
+
+    if (!result)
+    {
+        return NULL;
+    }
+
+    result->element_size = _element_size;
+    result->comparator   = _comparator;
+    result->key          = D_SORTED_ARRAY_KEY_COMPARATOR;
+
+    return result;
+}
+
+/*
+d_sorted_array_new_keyed
+  Creates a new empty sorted array ordered by an integer key stored inside
+each element. No comparator is ever called.
+
+Parameter(s):
+  _element_size: size in bytes of each element. Must be > 0.
+  _key:          integer type of the key (not D_SORTED_ARRAY_KEY_COMPARATOR)
+  _key_offset:   byte offset of the key within an element (e.g. offsetof)
+Return:
+  - Pointer to new `d_sorted_array` on success
+  - NULL if the key does not fit in the element or memory allocation fails
+*/
+struct d_sorted_array*
+d_sorted_array_new_keyed
+(
+    size_t                  _element_size,
+    enum d_sorted_array_key _key,
+    size_t                  _key_offset
+)
+{
+    struct d_sorted_array* result;
+    size_t                 key_size;
+
+    switch (_key)
+    {
+        case D_SORTED_ARRAY_KEY_INT32:
+        case D_SORTED_ARRAY_KEY_UINT32:
+            key_size = 4;
+            break;
+
+        case D_SORTED_ARRAY_KEY_INT64:
+        case D_SORTED_ARRAY_KEY_UINT64:
+            key_size = 8;
+            break;
+
+        case D_SORTED_ARRAY_KEY_COMPARATOR:
+        default:
+            return NULL;
+    }
+
+    if ( (_element_size < key_size) ||
+         (_key_offset > (_element_size - key_size)) )
+    {
+        return NULL;
+    }
+
+    result = calloc(1, sizeof(struct d_sorted_array));
+
+    if (!result)
+    {
+        return NULL;
+    }
+
+    result->element_size = _element_size;
+    result->key          = _key;
+    result->key_offset   = _key_offset;
+
+    return result;
+}
+
+/*
+d_sorted_array_new_from_arr
+  Creates a comparator-ordered sorted array holding a sorted copy of a
+linear array.
+
+Parameter(s):
+  _element_size: size in bytes of each element. Must be > 0.
+  _comparator:   ordering of elements. Must not be NULL.
+  _source:       elements to copy, in any order
+  _source_count: number of elements in _source
+Return:
+  - Pointer to new `d_sorted_array` on success
+  - NULL if parameters are invalid or memory allocation fails
+*/
+struct d_sorted_array*
+d_sorted_array_new_from_arr
+(
+    size_t        _element_size,
+    fn_comparator _comparator,
+    const void*   _source,
+    size_t        _source_count
+)
+{
+    struct d_sorted_array* result;
+
+    if ( (!_source) &&
+         (_source_count > 0) )
+    {
+        return NULL;
+    }
+
+    result = d_sorted_array_new(_element_size, _comparator);
+
+    if (!result)
+    {
+        return NULL;
+    }
+
+    if (!d_sorted_array_insert_all(result, _source, _source_count))
+    {
+        d_sorted_array_free(result);
+
+        return NULL;
+    }
+
+    return result;
+}
+
+
+// =============================================================================
+// element access functions
+// =============================================================================
+
+/*
+d_sorted_array_get
+  Returns a pointer to the element at the specified sorted position. The
+element must not be modified in a way that changes its order.
+
+Parameter(s):
+  _sorted_array: pointer to sorted array
+  _index:        index (supports negative indexing)
+Return:
+  - Pointer to element at the specified index
+  - NULL if the array is NULL, empty, or index is out of bounds
+*/
+void*
+d_sorted_array_get
+(
+    const struct d_sorted_array* _sorted_array,
+    d_index                      _index
+)
+{
+    size_t index;
+
+    if ( (!_sorted_array)            ||
+         (_sorted_array->count == 0) )
+    {
+        return NULL;
+    }
+
+    if (!d_index_convert_safe(_index, _sorted_array->count, &index))
+    {
+        return NULL;
+    }
+
+    return (char*)_sorted_array->elements + (index * _sorted_array->element_size);
+}
+
+/*
+d_sorted_array_front
+  Returns a pointer to the smallest element.
+
+Parameter(s):
+  _sorted_array: pointer to sorted array
+Return:
+  - Pointer to the first element
+  - NULL if the array is NULL or empty
+*/
+void*
+d_sorted_array_front
+(
+    const struct d_sorted_array* _sorted_array
+)
+{
+    return d_sorted_array_get(_sorted_array, 0);
+}
+
+/*
+d_sorted_array_back
+  Returns a pointer to the largest element.
+
+Parameter(s):
+  _sorted_array: pointer to sorted array
+Return:
+  - Pointer to the last element
+  - NULL if the array is NULL or empty
+*/
+void*
+d_sorted_array_back
+(
+    const struct d_sorted_array* _sorted_array
+)
+{
+    return d_sorted_array_get(_sorted_array, -1);
+}
+
+
+// =============================================================================
+// modification functions
+// =============================================================================
+
+/*
+d_sorted_array_insert
+  Inserts a copy of an element at its sorted position, after any equal
+elements. Costs O(log n) to locate plus O(n) to shift; prefer
+d_sorted_array_insert_all for many elements.
+
+Parameter(s):
+  _sorted_array: pointer to sorted array
+  _element:      pointer to the element to copy
+Return:
+  - true if the element was inserted
+  - false if parameters are invalid or memory allocation fails
+*/
+bool
+d_sorted_array_insert
+(
+    struct d_sorted_array* _sorted_array,
+    const void*            _element
+)
+{
+    char*  slot;
+    size_t index;
+    size_t size;
+
+    if ( (!_sorted_array) ||
+         (!_element) )
+    {
+        return false;
+    }
+
+    if (!d_sorted_array_internal_reserve(_sorted_array,
+                                         _sorted_array->count + 1))
+    {
+        return false;
+    }
+
+    size  = _sorted_array->element_size;
+    index = d_sorted_array_internal_bound(_sorted_array, _element, true);
+    slot  = (char*)_sorted_array->elements + (index * size);
+
+    memmove(slot + size, slot, (_sorted_array->count - index) * size);
+    memcpy(slot, _element, size);
+
+    _sorted_array->count++;
+
+    return true;
+}
+
+/*
+d_sorted_array_insert_all
+  Inserts copies of `_count` elements given in any order. The batch is
+stable-sorted on its own and then merged with the existing elements in one
+backward pass, so the whole operation costs O(k log k + n + k) element
+moves instead of k separate O(n) shifts. Equal elements keep their order,
+with existing elements before new ones.
+
+Parameter(s):
+  _sorted_array: pointer to sorted array
+  _elements:     elements to insert; may be NULL only if _count is 0
+  _count:        number of elements
+Return:
+  - true if all elements were inserted
+  - false if parameters are invalid or memory allocation fails (the array
+    is unchanged)
+*/
+bool
+d_sorted_array_insert_all
+(
+    struct d_sorted_array* _sorted_array,
+    const void*            _elements,
+    size_t                 _count
+)
+{
+    char*  batch;
+    char*  data;
+    size_t size;
+    size_t i;
+    size_t j;
+    size_t w;
+
+    if ( (!_sorted_array) ||
+         ( (!_elements) && (_count > 0) ) )
+    {
+        return false;
+    }
+
+    if (_count == 0)
+    {
+        return true;
+    }
+
+    size = _sorted_array->element_size;
+
+    if ( (_count > (SIZE_MAX - _sorted_array->count)) ||
+         (_count > (SIZE_MAX / size / 2)) )
+    {
+        return false;
+    }
+
+    // batch and its merge scratch, allocated before touching the array
+    batch = malloc(2 * _count * size);
+
+    if (!batch)
+    {
+        return false;
+    }
+
+    if (!d_sorted_array_internal_reserve(_sorted_array,
+                                         _sorted_array->count + _count))
+    {
+        free(batch);
+
+        return false;
+    }
+
+    memcpy(batch, _elements, _count * size);
+    d_sorted_array_internal_sort(_sorted_array, batch, batch + (_count * size), _count);
+
+    // merge from the back; on ties the new element goes last
+    data = (char*)_sorted_array->elements;
+    i    = _sorted_array->count;
+    j    = _count;
+    w    = _sorted_array->count + _count;
+
+    while (j > 0)
+    {
+        if ( (i > 0) &&
+             (d_sorted_array_internal_cmp(_sorted_array,
+                                          data + ((i - 1) * size),
+                                          batch + ((j - 1) * size)) > 0) )
+        {
+            memcpy(data + (--w * size), data + (--i * size), size);
+        }
+        else
+        {
+            memcpy(data + (--w * size), batch + (--j * size), size);
+        }
+    }
+
+    _sorted_array->count += _count;
+
+    free(batch);
+
+    return true;
+}
+
+/*
+d_sorted_array_remove
+  Removes the first element equal to a probe.
+
+Parameter(s):
+  _sorted_array: pointer to sorted array
+  _probe:        element-shaped value to match (for keyed arrays only the
+                 key is read)
+Return:
+  - true if an element was removed
+  - false if none matched or parameters are invalid
+*/
+bool
+d_sorted_array_remove
+(
+    struct d_sorted_array* _sorted_array,
+    const void*            _probe
+)
+{
+    ssize_t index;
+
+    index = d_sorted_array_find(_sorted_array, _probe);
+
+    if (index < 0)
+    {
+        return false;
+    }
+
+    return d_sorted_array_remove_at(_sorted_array, index);
+}
+
+/*
+d_sorted_array_remove_at
+  Removes the element at a sorted position.
+
+Parameter(s):
+  _sorted_array: pointer to sorted array
+  _index:        index (supports negative indexing)
+Return:
+  - true if an element was removed
+  - false if parameters are invalid or index is out of bounds
+*/
+bool
+d_sorted_array_remove_at
+(
+    struct d_sorted_array* _sorted_array,
+    d_index                _index
+)
+{
+    char*  slot;
+    size_t index;
+    size_t size;
+
+    if ( (!_sorted_array)            ||
+         (_sorted_array->count == 0) ||
+         (!d_index_convert_safe(_index, _sorted_array->count, &index)) )
+    {
+        return false;
+    }
+
+    size = _sorted_array->element_size;
+    slot = (char*)_sorted_array->elements + (index * size);
+
+    memmove(slot, slot + size, (_sorted_array->count - index - 1) * size);
+
+    _sorted_array->count--;
+
+    return true;
+}
+
+/*
+d_sorted_array_clear
+  Removes all elements, keeping the buffer.
+
+Parameter(s):
+  _sorted_array: pointer to sorted array
+Return:
+  - true on success
+  - false if the array is NULL
+*/
+bool
+d_sorted_array_clear
+(
+    struct d_sorted_array* _sorted_array
+)
+{
+    if (!_sorted_array)
+    {
+        return false;
+    }
+
+    _sorted_array->count = 0;
+
+    return true;
+}
+
+/*
+d_sorted_array_reserve
+  Grows the buffer ahead of time so that `_capacity` elements fit.
+
+Parameter(s):
+  _sorted_array: pointer to sorted array
+  _capacity:     required capacity in elements
+Return:
+  - true if the capacity is available
+  - false if the array is NULL or memory allocation fails
+*/
+bool
+d_sorted_array_reserve
+(
+    struct d_sorted_array* _sorted_array,
+    size_t                 _capacity
+)
+{
+    if (!_sorted_array)
+    {
+        return false;
+    }
+
+    return d_sorted_array_internal_reserve(_sorted_array, _capacity);
+}
+
+
+// =============================================================================
+// search functions
+// =============================================================================
+
+/*
+d_sorted_array_lower_bound
+  Returns the position of the first element not less than a probe.
+
+Parameter(s):
+  _sorted_array: pointer to sorted array
+  _probe:        element-shaped value to search for (for keyed arrays only
+                 the key is read)
+Return:
+  Index in [0, count]; 0 if parameters are invalid
+*/
+size_t
+d_sorted_array_lower_bound
+(
+    const struct d_sorted_array* _sorted_array,
+    const void*                  _probe
+)
+{
+    if ( (!_sorted_array) ||
+         (!_probe) )
+    {
+        return 0;
+    }
+
+    return d_sorted_array_internal_bound(_sorted_array, _probe, false);
+}
+
+/*
+d_sorted_array_upper_bound
+  Returns the position of the first element greater than a probe.
+
+Parameter(s):
+  _sorted_array: pointer to sorted array
+  _probe:        element-shaped value to search for
+Return:
+  Index in [0, count]; 0 if parameters are invalid
+*/
+size_t
+d_sorted_array_upper_bound
+(
+    const struct d_sorted_array* _sorted_array,
+    const void*                  _probe
+)
+{
+    if ( (!_sorted_array) ||
+         (!_probe) )
+    {
+        return 0;
+    }
+
+    return d_sorted_array_internal_bound(_sorted_array, _probe, true);
+}
+
+/*
+d_sorted_array_find
+  Finds the first element equal to a probe.
+
+Parameter(s):
+  _sorted_array: pointer to sorted array
+  _probe:        element-shaped value to search for
+Return:
+  - Index of the first equal element (>= 0)
+  - -1 if not found or parameters are invalid
+*/
+ssize_t
+d_sorted_array_find
+(
+    const struct d_sorted_array* _sorted_array,
+    const void*                  _probe
+)
+{
+    size_t index;
+
+    if ( (!_sorted_array) ||
+         (!_probe) )
+    {
+        return -1;
+    }
+
+    index = d_sorted_array_internal_bound(_sorted_array, _probe, false);
+
+    if ( (index < _sorted_array->count) &&
+         (d_sorted_array_internal_cmp(_sorted_array,
+                                      (const char*)_sorted_array->elements +
+                                          (index * _sorted_array->element_size),
+                                      _probe) == 0) )
+    {
+        return (ssize_t)index;
+    }
+
+    return -1;
+}
+
+/*
+d_sorted_array_contains
+  Checks whether an element equal to a probe is present.
+
+Parameter(s):
+  _sorted_array: pointer to sorted array
+  _probe:        element-shaped value to search for
+Return:
+  - true if found
+  - false if not found or parameters are invalid
+*/
+bool
+d_sorted_array_contains
+(
+    const struct d_sorted_array* _sorted_array,
+    const void*                  _probe
+)
+{
+    return (d_sorted_array_find(_sorted_array, _probe) >= 0);
+}
+
+/*
+d_sorted_array_count_equal
+  Counts the elements equal to a probe.
+
+Parameter(s):
+  _sorted_array: pointer to sorted array
+  _probe:        element-shaped value to search for
+Return:
+  Number of equal elements; 0 if parameters are invalid
+*/
+size_t
+d_sorted_array_count_equal
+(
+    const struct d_sorted_array* _sorted_array,
+    const void*                  _probe
+)
+{
+    return d_sorted_array_upper_bound(_sorted_array, _probe) -
+           d_sorted_array_lower_bound(_sorted_array, _probe);
+}
+
+/*
+d_sorted_array_lower_bound_int
+  Lower bound of a signed key in an integer-keyed array, without building
+an element-shaped probe.
+
+Parameter(s):
+  _sorted_array: pointer to an integer-keyed sorted array
+  _key:          key to search for
+Return:
+  Index in [0, count]; 0 if the array is NULL or comparator-ordered
+*/
+size_t
+d_sorted_array_lower_bound_int
+(
+    const struct d_sorted_array* _sorted_array,
+    int64_t                      _key
+)
+{
+    if (!_sorted_array)
+    {
+        return 0;
+    }
+
+    return d_sorted_array_internal_bound_int(_sorted_array, _key, false);
+}
+
+/*
+d_sorted_array_lower_bound_uint
+  Lower bound of an unsigned key in an integer-keyed array.
+
+Parameter(s):
+  _sorted_array: pointer to an integer-keyed sorted array
+  _key:          key to search for
+Return:
+  Index in [0, count]; 0 if the array is NULL or comparator-ordered
+*/
+size_t
+d_sorted_array_lower_bound_uint
+(
+    const struct d_sorted_array* _sorted_array,
+    uint64_t                     _key
+)
+{
+    if (!_sorted_array)
+    {
+        return 0;
+    }
+
+    return d_sorted_array_internal_bound_uint(_sorted_array, _key, false);
+}
+
+
+// =============================================================================
+// query functions
+// =============================================================================
+
+/*
+d_sorted_array_is_empty
+  Checks if the sorted array contains no elements.
+
+Parameter(s):
+  _sorted_array: pointer to sorted array
+Return:
+  - true if empty or NULL
+  - false otherwise
+*/
+bool
+d_sorted_array_is_empty
+(
+    const struct d_sorted_array* _sorted_array
+)
+{
+    return ( (!_sorted_array) ||
+             (_sorted_array->count == 0) );
+}
+
+/*
+d_sorted_array_count
+  Returns the number of elements in the sorted array.
+
+Parameter(s):
+  _sorted_array: pointer to sorted array
+Return:
+  Number of elements, or 0 if NULL
+*/
+size_t
+d_sorted_array_count
+(
+    const struct d_sorted_array* _sorted_array
+)
+{
+    return (_sorted_array) ? _sorted_array->count : 0;
+}
+
+/*
+d_sorted_array_capacity
+  Returns the number of elements the buffer can hold without growing.
+
+Parameter(s):
+  _sorted_array: pointer to sorted array
+Return:
+  Capacity in elements, or 0 if NULL
+*/
+size_t
+d_sorted_array_capacity
+(
+    const struct d_sorted_array* _sorted_array
+)
+{
+    return (_sorted_array) ? _sorted_array->capacity : 0;
+}
+
+/*
+d_sorted_array_is_sorted
+  Verifies the ordering invariant, e.g. after elements were modified through
+d_sorted_array_get.
+
+Parameter(s):
+  _sorted_array: pointer to sorted array
+Return:
+  - true if every element is not less than its predecessor
+  - false otherwise or if the array is NULL
+*/
+bool
+d_sorted_array_is_sorted
+(
+    const struct d_sorted_array* _sorted_array
+)
+{
+    const char* data;
+    size_t      i;
+
+    if (!_sorted_array)
+    {
+        return false;
+    }
+
+    data = (const char*)_sorted_array->elements;
+
+    for (i = 1; i < _sorted_array->count; i++)
+    {
+        if (d_sorted_array_internal_cmp(_sorted_array,
+                                        data + ((i - 1) * _sorted_array->element_size),
+                                        data + (i * _sorted_array->element_size)) > 0)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+
+// =============================================================================
+// snapshot functions
+// =============================================================================
+
+/*
+d_sorted_array_internal_eytzinger_fill
+  Copies sorted elements into Eytzinger order by an in-order walk of the
+implicit tree rooted at slot `_k`. Returns the next sorted index to place.
+*/
+static size_t
+d_sorted_array_internal_eytzinger_fill
+(
+    const char* _sorted,
+    char*       _layout,
+    size_t      _count,
+    size_t      _element_size,
+    size_t      _next,
+    size_t      _k
+)
+{
+    if (_k <= _count)
+    {
+        _next = d_sorted_array_internal_eytzinger_fill(_sorted,
+                                                       _layout,
+                                                       _count,
+                                                       _element_size,
+                                                       _next,
+                                                       2 * _k);
+
+        memcpy(_layout + (_k * _element_size),
+               _sorted + (_next * _element_size),
+               _element_size);
+        _next++;
+
+        _next = d_sorted_array_internal_eytzinger_fill(_sorted,
+                                                       _layout,
+                                                       _count,
+                                                       _element_size,
+                                                       _next,
+                                                       (2 * _k) + 1);
+    }
+
+    return _next;
+}
+
+/*
+d_sorted_array_internal_eytzinger_result
+  Turns the slot where an Eytzinger descent fell off the tree into the
+lower bound: drop the trailing right turns and the final step. Slot 0 means
+every element is less than the probe.
+*/
+D_STATIC_INLINE const void*
+d_sorted_array_internal_eytzinger_result
+(
+    const struct d_sorted_array_snapshot* _snapshot,
+    size_t                                _k
+)
+{
+    while (_k & 1)
+    {
+        _k >>= 1;
+    }
+
+    _k >>= 1;
+
+    return (_k == 0)
+        ? NULL
+        : (const char*)_snapshot->elements + (_k * _snapshot->element_size);
+}
+
+// D_INTERNAL_SORTED_ARRAY_EYTZINGER
+//   macro: defines d_sorted_array_internal_eytzinger_<suffix>, the Eytzinger
+// descent for keys of type `key_type` compared as `probe_type`. Slot 16k
+// (four levels down) is prefetched on each step.
+#define D_INTERNAL_SORTED_ARRAY_EYTZINGER(suffix, key_type, probe_type)       \
+    static size_t                                                             \
+    d_sorted_array_internal_eytzinger_##suffix                                \
+    (                                                                         \
+        const struct d_sorted_array_snapshot* _snapshot,                      \
+        probe_type                            _probe                          \
+    )                                                                         \
+    {                                                                         \
+        const char* data;                                                     \
+        size_t      k;                                                        \
+        key_type    key;                                                      \
+                                                                              \
+        data = (const char*)_snapshot->elements + _snapshot->key_offset;      \
+        k    = 1;                                                             \
+                                                                              \
+        while (k <= _snapshot->count)                                         \
+        {                                                                     \
+            D_INTERNAL_SORTED_ARRAY_PREFETCH(                                 \
+                (uintptr_t)data + (16 * k * _snapshot->element_size));        \
+            memcpy(&key, data + (k * _snapshot->element_size), sizeof(key));  \
+            k = (2 * k) + (((probe_type)key < _probe) ? 1 : 0);               \
+        }                                                                     \
+                                                                              \
+        return k;                                                             \
+    }
+
+D_INTERNAL_SORTED_ARRAY_EYTZINGER(int32,  int32_t,  int64_t)
+D_INTERNAL_SORTED_ARRAY_EYTZINGER(uint32, uint32_t, uint64_t)
+D_INTERNAL_SORTED_ARRAY_EYTZINGER(int64,  int64_t,  int64_t)
+D_INTERNAL_SORTED_ARRAY_EYTZINGER(uint64, uint64_t, uint64_t)
+
+/*
+d_sorted_array_snapshot_new
+  Builds a read-only Eytzinger-ordered copy of a sorted array. The snapshot
+is independent of the array and must be rebuilt to see later changes.
+
+Parameter(s):
+  _sorted_array: pointer to sorted array
+Return:
+  - Pointer to the new snapshot (free with d_sorted_array_snapshot_free)
+  - NULL if the array is NULL or memory allocation fails
+*/
+struct d_sorted_array_snapshot*
+d_sorted_array_snapshot_new
+(
+    const struct d_sorted_array* _sorted_array
+)
+{
+    struct d_sorted_array_snapshot* result;
+
+    if ( (!_sorted_array) ||
+         (_sorted_array->count >= (SIZE_MAX / _sorted_array->element_size)) )
+    {
+        return NULL;
+    }
+
+    result = calloc(1, sizeof(struct d_sorted_array_snapshot));
+
+    if (!result)
+    {
+        return NULL;
+    }
+
+    // slot 0 is never used; the tree occupies slots 1..count
+    result->elements = malloc((_sorted_array->count + 1) *
+                              _sorted_array->element_size);
+
+    if (!result->elements)
+    {
+        free(result);
+
+        return NULL;
+    }
+
+    result->count        = _sorted_array->count;
+    result->element_size = _sorted_array->element_size;
+    result->comparator   = _sorted_array->comparator;
+    result->key          = _sorted_array->key;
+    result->key_offset   = _sorted_array->key_offset;
+
+    d_sorted_array_internal_eytzinger_fill((const char*)_sorted_array->elements,
+                                           (char*)result->elements,
+                                           result->count,
+                                           result->element_size,
+                                           0,
+                                           1);
+
+    return result;
+}
+
+/*
+d_sorted_array_snapshot_lower_bound_int
+  Returns the first element whose key is not less than a signed key.
+
+Parameter(s):
+  _snapshot: pointer to a snapshot of an integer-keyed array
+  _key:      key to search for
+Return:
+  - Pointer to the element
+  - NULL if every key is smaller, or the snapshot is NULL or
+    comparator-ordered
+*/
+const void*
+d_sorted_array_snapshot_lower_bound_int
+(
+    const struct d_sorted_array_snapshot* _snapshot,
+    int64_t                               _key
+)
+{
+    size_t k;
+
+    if (!_snapshot)
+    {
+        return NULL;
+    }
+
+    switch (_snapshot->key)
+    {
+        case D_SORTED_ARRAY_KEY_INT32:
+            k = d_sorted_array_internal_eytzinger_int32(_snapshot, _key);
+            break;
+
+        case D_SORTED_ARRAY_KEY_INT64:
+            k = d_sorted_array_internal_eytzinger_int64(_snapshot, _key);
+            break;
+
+        case D_SORTED_ARRAY_KEY_UINT32:
+        case D_SORTED_ARRAY_KEY_UINT64:
+            return d_sorted_array_snapshot_lower_bound_uint(
+                       _snapshot,
+                       (_key < 0) ? 0 : (uint64_t)_key);
+
+        case D_SORTED_ARRAY_KEY_COMPARATOR:
+        default:
+            return NULL;
+    }
+
+    return d_sorted_array_internal_eytzinger_result(_snapshot, k);
+}
+
+/*
+d_sorted_array_snapshot_lower_bound_uint
+  Returns the first element whose key is not less than an unsigned key.
+
+Parameter(s):
+  _snapshot: pointer to a snapshot of an integer-keyed array
+  _key:      key to search for
+Return:
+  - Pointer to the element
+  - NULL if every key is smaller, or the snapshot is NULL or
+    comparator-ordered
+*/
+const void*
+d_sorted_array_snapshot_lower_bound_uint
+(
+    const struct d_sorted_array_snapshot* _snapshot,
+    uint64_t                              _key
+)
+{
+    size_t k;
+
+    if (!_snapshot)
+    {
+        return NULL;
+    }
+
+    switch (_snapshot->key)
+    {
+        case D_SORTED_ARRAY_KEY_UINT32:
+            k = d_sorted_array_internal_eytzinger_uint32(_snapshot, _key);
+            break;
+
+        case D_SORTED_ARRAY_KEY_UINT64:
+            k = d_sorted_array_internal_eytzinger_uint64(_snapshot, _key);
+            break;
+
+        case D_SORTED_ARRAY_KEY_INT32:
+        case D_SORTED_ARRAY_KEY_INT64:
+            if (_key > (uint64_t)INT64_MAX)
+            {
+                return NULL;
+            }
+
+            return d_sorted_array_snapshot_lower_bound_int(_snapshot,
+                                                           (int64_t)_key);
+
+        case D_SORTED_ARRAY_KEY_COMPARATOR:
+        default:
+            return NULL;
+    }
+
+    return d_sorted_array_internal_eytzinger_result(_snapshot, k);
+}
+
+/*
+d_sorted_array_snapshot_lower_bound
+  Returns the first element not less than an element-shaped probe.
+
+Parameter(s):
+  _snapshot: pointer to snapshot
+  _probe:    element-shaped value to search for (for keyed snapshots only
+             the key is read)
+Return:
+  - Pointer to the element
+  - NULL if every element is smaller or parameters are invalid
+*/
+const void*
+d_sorted_array_snapshot_lower_bound
+(
+    const struct d_sorted_array_snapshot* _snapshot,
+    const void*                           _probe
+)
+{
+    const char* data;
+    const char* key;
+    size_t      k;
+
+    if ( (!_snapshot) ||
+         (!_probe) )
+    {
+        return NULL;
+    }
+
+    key = (const char*)_probe + _snapshot->key_offset;
+
+    switch (_snapshot->key)
+    {
+        case D_SORTED_ARRAY_KEY_INT32:
+        {
+            int32_t value;
+
+            memcpy(&value, key, sizeof(value));
+
+            return d_sorted_array_snapshot_lower_bound_int(_snapshot, value);
+        }
+
+        case D_SORTED_ARRAY_KEY_INT64:
+        {
+            int64_t value;
+
+            memcpy(&value, key, sizeof(value));
+
+            return d_sorted_array_snapshot_lower_bound_int(_snapshot, value);
+        }
+
+        case D_SORTED_ARRAY_KEY_UINT32:
+        {
+            uint32_t value;
+
+            memcpy(&value, key, sizeof(value));
+
+            return d_sorted_array_snapshot_lower_bound_uint(_snapshot, value);
+        }
+
+        case D_SORTED_ARRAY_KEY_UINT64:
+        {
+            uint64_t value;
+
+            memcpy(&value, key, sizeof(value));
+
+            return d_sorted_array_snapshot_lower_bound_uint(_snapshot, value);
+        }
+
+        case D_SORTED_ARRAY_KEY_COMPARATOR:
+        default:
+            break;
+    }
+
+    data = (const char*)_snapshot->elements;
+    k    = 1;
+
+    while (k <= _snapshot->count)
+    {
+        D_INTERNAL_SORTED_ARRAY_PREFETCH(
+            (uintptr_t)data + (16 * k * _snapshot->element_size));
+
+        k = (2 * k) +
+            ((_snapshot->comparator(data + (k * _snapshot->element_size),
+                                    _probe) < 0) ? 1 : 0);
+    }
+
+    return d_sorted_array_internal_eytzinger_result(_snapshot, k);
+}
+
+/*
+d_sorted_array_snapshot_find
+  Returns an element equal to a probe.
+
+Parameter(s):
+  _snapshot: pointer to snapshot
+  _probe:    element-shaped value to search for
+Return:
+  - Pointer to the first equal element in sorted order
+  - NULL if none is equal or parameters are invalid
+*/
+const void*
+d_sorted_array_snapshot_find
+(
+    const struct d_sorted_array_snapshot* _snapshot,
+    const void*                           _probe
+)
+{
+    const void* match;
+
+    match = d_sorted_array_snapshot_lower_bound(_snapshot, _probe);
+
+    if ( (match) &&
+         (d_sorted_array_internal_compare(_snapshot->key,
+                                          _snapshot->key_offset,
+                                          _snapshot->comparator,
+                                          match,
+                                          _probe) == 0) )
+    {
+        return match;
+    }
+
+    return NULL;
+}
+
+/*
+d_sorted_array_snapshot_free
+  Frees a snapshot.
+
+Parameter(s):
+  _snapshot: pointer to snapshot; may be NULL
+Return:
+  none.
+*/
+void
+d_sorted_array_snapshot_free
+(
+    struct d_sorted_array_snapshot* _snapshot
+)
+{
+    if (_snapshot)
+    {
+        free(_snapshot->elements);
+        free(_snapshot);
+    }
+
+    return;
+}
+
+
+// =============================================================================
+// filter functions
+// =============================================================================
+#if D_CFG_CONTAINER_FILTER_ARRAY_SORTED
+
+/*
+d_sorted_array_count_where
+  Counts the elements satisfying a predicate.
+
+Parameter(s):
+  _sorted_array: pointer to sorted array
+  _test:         predicate function
+  _context:      opaque context passed to _test
+Return:
+  Number of matching elements, or 0 if parameters are invalid
+*/
+size_t
+d_sorted_array_count_where
+(
+    const struct d_sorted_array* _sorted_array,
+    fn_predicate                 _test,
+    void*                        _context
+)
+{
+    if (!_sorted_array)
+    {
+        return 0;
+    }
+
+    return d_contiguous_filter_count_where(_sorted_array->elements,
+                                           _sorted_array->count,
+                                           _sorted_array->element_size,
+                                           _test,
+                                           _context);
+}
+
+/*
+d_sorted_array_filter_in_place
+  Keeps only the elements satisfying a predicate. A subsequence of a sorted
+sequence is sorted, so no reordering is needed.
+
+Parameter(s):
+  _sorted_array: pointer to sorted array
+  _test:         predicate function
+  _context:      opaque context passed to _test
+Return:
+  New element count (unchanged if _test is NULL; 0 if the array is NULL)
+*/
+size_t
+d_sorted_array_filter_in_place
+(
+    struct d_sorted_array* _sorted_array,
+    fn_predicate           _test,
+    void*                  _context
+)
+{
+    if (!_sorted_array)
+    {
+        return 0;
+    }
+
+    if ( (_test) &&
+         (_sorted_array->count > 0) )
+    {
+        _sorted_array->count = d_contiguous_filter_in_place(
+                                   _sorted_array->elements,
+                                   _sorted_array->count,
+                                   _sorted_array->element_size,
+                                   _test,
+                                   _context);
+    }
+
+    return _sorted_array->count;
+}
+
+#endif  // D_CFG_CONTAINER_FILTER_ARRAY_SORTED
+
+
+// =============================================================================
+// memory management
+// =============================================================================
+
+/*
+d_sorted_array_free
+  Frees the sorted array and its buffer.
+
+Parameter(s):
+  _sorted_array: pointer to sorted array; may be NULL
+Return:
+  none.
+*/
+void
+d_sorted_array_free
+(
+    struct d_sorted_array* _sorted_array
+)
+{
+    if (_sorted_array)
+    {
+        free(_sorted_array->elements);
+        free(_sorted_array);
+    }
+
+    return;
+}
@@ -0,0 +1,1262 @@
+/******************************************************************************
+* djinterp [container]                                                bitset.c
+*
+*   Implementation of the word-packed bitset.
+*
+*
+* path:      \src\container\bitset\bitset.c
+* link:      TBA
+* author(s): Samuel 'teer' Neal-Blim                          date: 2026.10.18
+******************************************************************************/
+#include "../../../../inc/c/container/bitset/bitset.h"
+
+#if D_ENV_C_HAS_AVX2
+    #include <immintrin.h>
+#elif D_ENV_C_HAS_SSE2
+    #include <emmintrin.h>
+#elif ( D_ENV_C_HAS_NEON &&  \
+        (D_ENV_ARCH_TYPE == D_ENV_ARCH_TYPE_ARM64) )
+    #include <arm_neon.h>
+#endif
+
+#if defined(D_ENV_COMPILER_MSVC)
+    #include <intrin.h>
+#endif
+
+
+// =============================================================================
+// internal helper functions
+// =============================================================================
+
+/*
+d_bitset_internal_ctz64
+  Index of the lowest set bit of a non-zero word.
+*/
+D_STATIC_INLINE unsigned
+d_bitset_internal_ctz64
+(
+    uint64_t _word
+)
+{
+#if ( defined(D_ENV_COMPILER_GCC) ||  \
+      defined(D_ENV_COMPILER_CLANG) )
+    return (unsigned)__builtin_ctzll(_word);
+#elif ( defined(D_ENV_COMPILER_MSVC) &&  \
+        (defined(_M_X64) || defined(_M_ARM64)) )
+    unsigned long index;
+
+    _BitScanForward64(&index, _word);
+
+    return (unsigned)index;
+#else
+    unsigned index;
+
+    index = 0;
+
+    while ( (_word & 1) == 0 )
+    {
+        _word >>= 1;
+        index++;
+    }
+
+    return index;
+#endif
+}
+
+/*
+d_bitset_internal_select64
+  Index of the `_k`-th (0-based) set bit of a word known to have more than
+`_k` set bits.
+*/
+D_STATIC_INLINE unsigned
+d_bitset_internal_select64
+(
+    uint64_t _word,
+    size_t   _k
+)
+{
+    while (_k > 0)
+    {
+        _word &= (_word - 1);
+        _k--;
+    }
+
+    return d_bitset_internal_ctz64(_word);
+}
+
+/*
+d_bitset_internal_low_mask
+  Mask of the lowest `_bits` bits of a word; `_bits` is below 64.
+*/
+D_STATIC_INLINE uint64_t
+d_bitset_internal_low_mask
+(
+    size_t _bits
+)
+{
+    return (((uint64_t)1) << _bits) - 1;
+}
+
+/*
+d_bitset_internal_trim
+  Clears the bits of the last word that lie past `size`, restoring the
+invariant the whole-word functions depend on.
+*/
+D_STATIC_INLINE void
+d_bitset_internal_trim
+(
+    struct d_bitset* _bitset
+)
+{
+    size_t tail;
+
+    tail = _bitset->size % D_BITSET_WORD_BITS;
+
+    if ( (tail != 0) &&
+         (_bitset->word_count != 0) )
+    {
+        _bitset->words[_bitset->word_count - 1] &=
+            d_bitset_internal_low_mask(tail);
+    }
+
+    return;
+}
+
+
+// =============================================================================
+// word functions
+// =============================================================================
+
+/*
+d_bitset_popcount64
+  Counts the set bits of one word.
+
+Parameter(s):
+  _word: the word to count
+Return:
+  The number of set bits, 0 through 64.
+*/
+size_t
+d_bitset_popcount64
+(
+    uint64_t _word
+)
+{
+#if ( defined(D_ENV_COMPILER_GCC) ||  \
+      defined(D_ENV_COMPILER_CLANG) )
+    return (size_t)__builtin_popcountll(_word);
+#else
+    _word = _word - ((_word >> 1) & 0x5555555555555555ULL);
+    _word = (_word & 0x3333333333333333ULL) +
+            ((_word >> 2) & 0x3333333333333333ULL);
+    _word = (_word + (_word >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+
+    return (size_t)((_word * 0x0101010101010101ULL) >> 56);
+#endif
+}
+
+/*
+d_bitset_words_count
+  Counts the set bits of a word array.
+
+Parameter(s):
+  _words:      the words to count
+  _word_count: number of words
+Return:
+  The total number of set bits.
+*/
+size_t
+d_bitset_words_count
+(
+    const uint64_t* _words,
+    size_t          _word_count
+)
+{
+    size_t count;
+    size_t i;
+
+    count = 0;
+
+    for (i = 0; i < _word_count; i++)
+    {
+        count += d_bitset_popcount64(_words[i]);
+    }
+
+    return count;
+}
+
+// scalar forms of the combining operations, `_d` being the destination word
+#define D_INTERNAL_BITSET_OP_AND(_d, _s)    ((_d) & (_s))
+#define D_INTERNAL_BITSET_OP_OR(_d, _s)     ((_d) | (_s))
+#define D_INTERNAL_BITSET_OP_XOR(_d, _s)    ((_d) ^ (_s))
+#define D_INTERNAL_BITSET_OP_ANDNOT(_d, _s) ((_d) & ~(_s))
+
+#if D_ENV_C_HAS_AVX2
+    #define D_INTERNAL_BITSET_VEC_AND(_d, _s)    _mm256_and_si256((_d), (_s))
+    #define D_INTERNAL_BITSET_VEC_OR(_d, _s)     _mm256_or_si256((_d), (_s))
+    #define D_INTERNAL_BITSET_VEC_XOR(_d, _s)    _mm256_xor_si256((_d), (_s))
+    #define D_INTERNAL_BITSET_VEC_ANDNOT(_d, _s) _mm256_andnot_si256((_s), (_d))
+#elif D_ENV_C_HAS_SSE2
+    #define D_INTERNAL_BITSET_VEC_AND(_d, _s)    _mm_and_si128((_d), (_s))
+    #define D_INTERNAL_BITSET_VEC_OR(_d, _s)     _mm_or_si128((_d), (_s))
+    #define D_INTERNAL_BITSET_VEC_XOR(_d, _s)    _mm_xor_si128((_d), (_s))
+    #define D_INTERNAL_BITSET_VEC_ANDNOT(_d, _s) _mm_andnot_si128((_s), (_d))
+#elif ( D_ENV_C_HAS_NEON &&  \
+        (D_ENV_ARCH_TYPE == D_ENV_ARCH_TYPE_ARM64) )
+    #define D_INTERNAL_BITSET_VEC_AND(_d, _s)    vandq_u64((_d), (_s))
+    #define D_INTERNAL_BITSET_VEC_OR(_d, _s)     vorrq_u64((_d), (_s))
+    #define D_INTERNAL_BITSET_VEC_XOR(_d, _s)    veorq_u64((_d), (_s))
+    #define D_INTERNAL_BITSET_VEC_ANDNOT(_d, _s) vbicq_u64((_d), (_s))
+#endif
+
+// D_INTERNAL_BITSET_VECTOR_LOOP
+//   macro (internal): combines as many whole vectors of words as the target
+// supports, advancing `i`; the caller finishes the remainder word by word.
+#if D_ENV_C_HAS_AVX2
+    #define D_INTERNAL_BITSET_VECTOR_LOOP(_OP)                                \
+        for (; i + 4 <= _word_count; i += 4)                                  \
+        {                                                                     \
+            _mm256_storeu_si256((__m256i*)(_dest + i),                        \
+                D_INTERNAL_BITSET_VEC_##_OP(                                  \
+                    _mm256_loadu_si256((const __m256i*)(_dest + i)),          \
+                    _mm256_loadu_si256((const __m256i*)(_source + i))));      \
+        }
+#elif D_ENV_C_HAS_SSE2
+    #define D_INTERNAL_BITSET_VECTOR_LOOP(_OP)                                \
+        for (; i + 2 <= _word_count; i += 2)                                  \
+        {                                                                     \
+            _mm_storeu_si128((__m128i*)(_dest + i),                           \
+                D_INTERNAL_BITSET_VEC_##_OP(                                  \
+                    _mm_loadu_si128((const __m128i*)(_dest + i)),             \
+                    _mm_loadu_si128((const __m128i*)(_source + i))));         \
+        }
+#elif ( D_ENV_C_HAS_NEON &&  \
+        (D_ENV_ARCH_TYPE == D_ENV_ARCH_TYPE_ARM64) )
+    #define D_INTERNAL_BITSET_VECTOR_LOOP(_OP)                                \
+        for (; i + 2 <= _word_count; i += 2)                                  \
+        {                                                                     \
+            vst1q_u64(_dest + i,                                              \
+                D_INTERNAL_BITSET_VEC_##_OP(vld1q_u64(_dest + i),             \
+                                            vld1q_u64(_source + i)));         \
+        }
+#else
+    #define D_INTERNAL_BITSET_VECTOR_LOOP(_OP)
+#endif
+
+// D_INTERNAL_BITSET_DEFINE_WORDS
+//   macro (internal): defines d_bitset_words_<_name>, which combines
+// `_source` into `_dest` word by word: `_dest[i] = _dest[i] OP _source[i]`.
+#define D_INTERNAL_BITSET_DEFINE_WORDS(_name, _OP)                            \
+    void                                                                      \
+    d_bitset_words_##_name                                                    \
+    (                                                                         \
+        uint64_t*       _dest,                                                \
+        const uint64_t* _source,                                              \
+        size_t          _word_count                                           \
+    )                                                                         \
+    {                                                                         \
+        size_t i;                                                             \
+                                                                              \
+        i = 0;                                                                \
+                                                                              \
+        D_INTERNAL_BITSET_VECTOR_LOOP(_OP)                                    \
+                                                                              \
+        for (; i < _word_count; i++)                                          \
+        {                                                                     \
+            _dest[i] = D_INTERNAL_BITSET_OP_##_OP(_dest[i], _source[i]);      \
+        }                                                                     \
+                                                                              \
+        return;                                                               \
+    }
+
+/*
+d_bitset_words_and, d_bitset_words_or, d_bitset_words_xor,
+d_bitset_words_andnot
+  Combine `_word_count` words of `_source` into `_dest` in place with the
+named operation (andnot keeps the bits of `_dest` that are clear in
+`_source`). The arrays may be unaligned but must not partially overlap.
+
+Parameter(s):
+  _dest:       words to update
+  _source:     words to combine in
+  _word_count: number of words
+Return:
+  none.
+*/
+D_INTERNAL_BITSET_DEFINE_WORDS(and,    AND)
+D_INTERNAL_BITSET_DEFINE_WORDS(or,     OR)
+D_INTERNAL_BITSET_DEFINE_WORDS(xor,    XOR)
+D_INTERNAL_BITSET_DEFINE_WORDS(andnot, ANDNOT)
+
+
+// =============================================================================
+// constructor functions
+// =============================================================================
+
+/*
+d_bitset_new
+  Creates a bitset of `_size` bits, all clear.
+
+Parameter(s):
+  _size: number of bits; may be 0
+Return:
+  - Pointer to the new bitset
+  - NULL if allocation fails
+*/
+struct d_bitset*
+d_bitset_new
+(
+    size_t _size
+)
+{
+    struct d_bitset* bitset;
+
+    bitset = malloc(sizeof(struct d_bitset));
+
+    if (!bitset)
+    {
+        return NULL;
+    }
+
+    bitset->size       = _size;
+    bitset->word_count = D_BITSET_WORDS_FOR(_size);
+    bitset->words      = NULL;
+
+    if (bitset->word_count != 0)
+    {
+        bitset->words = calloc(bitset->word_count, sizeof(uint64_t));
+
+        if (!bitset->words)
+        {
+            free(bitset);
+
+            return NULL;
+        }
+    }
+
+    return bitset;
+}
+
+/*
+d_bitset_new_copy
+  Creates a copy of another bitset.
+
+Parameter(s):
+  _other: the bitset to copy
+Return:
+  - Pointer to the new bitset
+  - NULL if `_other` is NULL or allocation fails
+*/
+struct d_bitset*
+d_bitset_new_copy
+(
+    const struct d_bitset* _other
+)
+{
+    struct d_bitset* bitset;
+
+    if (!_other)
+    {
+        return NULL;
+    }
+
+    bitset = d_bitset_new(_other->size);
+
+    if ( (bitset) &&
+         (bitset->word_count != 0) )
+    {
+        d_memcpy(bitset->words,
+                 _other->words,
+                 _other->word_count * sizeof(uint64_t));
+    }
+
+    return bitset;
+}
+
+/*
+d_bitset_new_from_indices
+  Creates a bitset of `_size` bits with the bits listed in `_indices` set.
+
+Parameter(s):
+  _size:    number of bits
+  _indices: bit positions to set, in any order; may be NULL if `_count` is 0
+  _count:   number of positions
+Return:
+  - Pointer to the new bitset
+  - NULL if a position is not below `_size`, or allocation fails
+*/
+struct d_bitset*
+d_bitset_new_from_indices
+(
+    size_t        _size,
+    const size_t* _indices,
+    size_t        _count
+)
+{
+    struct d_bitset* bitset;
+    size_t           i;
+
+    if ( (!_indices) &&
+         (_count != 0) )
+    {
+        return NULL;
+    }
+
+    bitset = d_bitset_new(_size);
+
+    if (!bitset)
+    {
+        return NULL;
+    }
+
+    for (i = 0; i < _count; i++)
+    {
+        if (_indices[i] >= _size)
+        {
+            d_bitset_free(bitset);
+
+            return NULL;
+        }
+
+        bitset->words[_indices[i] / D_BITSET_WORD_BITS] |=
+            ((uint64_t)1) << (_indices[i] % D_BITSET_WORD_BITS);
+    }
+
+    return bitset;
+}
+
+
+// =============================================================================
+// bit access functions
+// =============================================================================
+
+/*
+d_bitset_test
+  Tests one bit.
+
+Parameter(s):
+  _bitset: the bitset
+  _bit:    bit position
+Return:
+  - true if the bit is set
+  - false if it is clear, out of range, or `_bitset` is NULL
+*/
+bool
+d_bitset_test
+(
+    const struct d_bitset* _bitset,
+    size_t                 _bit
+)
+{
+    if ( (!_bitset) ||
+         (_bit >= _bitset->size) )
+    {
+        return false;
+    }
+
+    return ( (_bitset->words[_bit / D_BITSET_WORD_BITS] >>
+              (_bit % D_BITSET_WORD_BITS)) & 1 ) != 0;
+}
+
+/*
+d_bitset_set
+  Sets one bit.
+
+Parameter(s):
+  _bitset: the bitset
+  _bit:    bit position
+Return:
+  - true if the bit is in range
+  - false if it is out of range or `_bitset` is NULL
+*/
+bool
+d_bitset_set
+(
+    struct d_bitset* _bitset,
+    size_t           _bit
+)
+{
+    if ( (!_bitset) ||
+         (_bit >= _bitset->size) )
+    {
+        return false;
+    }
+
+    _bitset->words[_bit / D_BITSET_WORD_BITS] |=
+        ((uint64_t)1) << (_bit % D_BITSET_WORD_BITS);
+
+    return true;
+}
+
+/*
+d_bitset_reset
+  Clears one bit.
+
+Parameter(s):
+  _bitset: the bitset
+  _bit:    bit position
+Return:
+  - true if the bit is in range
+  - false if it is out of range or `_bitset` is NULL
+*/
+bool
+d_bitset_reset
+(
+    struct d_bitset* _bitset,
+    size_t           _bit
+)
+{
+    if ( (!_bitset) ||
+         (_bit >= _bitset->size) )
+    {
+        return false;
+    }
+
+    _bitset->words[_bit / D_BITSET_WORD_BITS] &=
+        ~(((uint64_t)1) << (_bit % D_BITSET_WORD_BITS));
+
+    return true;
+}
+
+/*
+d_bitset_flip
+  Toggles one bit.
+
+Parameter(s):
+  _bitset: the bitset
+  _bit:    bit position
+Return:
+  - true if the bit is in range
+  - false if it is out of range or `_bitset` is NULL
+*/
+bool
+d_bitset_flip
+(
+    struct d_bitset* _bitset,
+    size_t           _bit
+)
+{
+    if ( (!_bitset) ||
+         (_bit >= _bitset->size) )
+    {
+        return false;
+    }
+
+    _bitset->words[_bit / D_BITSET_WORD_BITS] ^=
+        ((uint64_t)1) << (_bit % D_BITSET_WORD_BITS);
+
+    return true;
+}
+
+/*
+d_bitset_set_range
+  Sets `_count` consecutive bits starting at `_start`. Whole words inside
+the range are filled directly.
+
+Parameter(s):
+  _bitset: the bitset
+  _start:  first bit to set
+  _count:  number of bits
+Return:
+  - true if the range lies within the bitset
+  - false otherwise, or if `_bitset` is NULL
+*/
+bool
+d_bitset_set_range
+(
+    struct d_bitset* _bitset,
+    size_t           _start,
+    size_t           _count
+)
+{
+    size_t first;
+    size_t last;
+    size_t end;
+
+    if ( (!_bitset)                        ||
+         (_start > _bitset->size)          ||
+         (_count > _bitset->size - _start) )
+    {
+        return false;
+    }
+
+    if (_count == 0)
+    {
+        return true;
+    }
+
+    end   = _start + _count;
+    first = _start / D_BITSET_WORD_BITS;
+    last  = (end - 1) / D_BITSET_WORD_BITS;
+
+    if (first == last)
+    {
+        _bitset->words[first] |=
+            ( (_count == D_BITSET_WORD_BITS)
+                  ? ~(uint64_t)0
+                  : d_bitset_internal_low_mask(_count) )
+            << (_start % D_BITSET_WORD_BITS);
+
+        return true;
+    }
+
+    _bitset->words[first] |= ~(uint64_t)0 << (_start % D_BITSET_WORD_BITS);
+
+    if (last > first + 1)
+    {
+        memset(_bitset->words + first + 1,
+               0xFF,
+               (last - first - 1) * sizeof(uint64_t));
+    }
+
+    _bitset->words[last] |= (end % D_BITSET_WORD_BITS == 0)
+                                ? ~(uint64_t)0
+                                : d_bitset_internal_low_mask(
+                                      end % D_BITSET_WORD_BITS);
+
+    return true;
+}
+
+/*
+d_bitset_set_all
+  Sets every bit.
+
+Parameter(s):
+  _bitset: the bitset
+Return:
+  - true on success
+  - false if `_bitset` is NULL
+*/
+bool
+d_bitset_set_all
+(
+    struct d_bitset* _bitset
+)
+{
+    if (!_bitset)
+    {
+        return false;
+    }
+
+    if (_bitset->word_count != 0)
+    {
+        memset(_bitset->words, 0xFF, _bitset->word_count * sizeof(uint64_t));
+        d_bitset_internal_trim(_bitset);
+    }
+
+    return true;
+}
+
+/*
+d_bitset_reset_all
+  Clears every bit.
+
+Parameter(s):
+  _bitset: the bitset
+Return:
+  - true on success
+  - false if `_bitset` is NULL
+*/
+bool
+d_bitset_reset_all
+(
+    struct d_bitset* _bitset
+)
+{
+    if (!_bitset)
+    {
+        return false;
+    }
+
+    if (_bitset->word_count != 0)
+    {
+        memset(_bitset->words, 0, _bitset->word_count * sizeof(uint64_t));
+    }
+
+    return true;
+}
+
+/*
+d_bitset_resize
+  Changes the number of bits. Bits below both sizes keep their values; new
+bits are clear.
+
+Parameter(s):
+  _bitset: the bitset
+  _size:   new number of bits
+Return:
+  - true on success
+  - false if `_bitset` is NULL or reallocation fails (the bitset is then
+    unchanged)
+*/
+bool
+d_bitset_resize
+(
+    struct d_bitset* _bitset,
+    size_t           _size
+)
+{
+    uint64_t* words;
+    size_t    word_count;
+
+    if (!_bitset)
+    {
+        return false;
+    }
+
+    word_count = D_BITSET_WORDS_FOR(_size);
+
+    if (word_count == 0)
+    {
+        free(_bitset->words);
+        _bitset->words = NULL;
+    }
+    else if (word_count != _bitset->word_count)
+    {
+        words = realloc(_bitset->words, word_count * sizeof(uint64_t));
+
+        if (!words)
+        {
+            return false;
+        }
+
+        if (word_count > _bitset->word_count)
+        {
+            memset(words + _bitset->word_count,
+                   0,
+                   (word_count - _bitset->word_count) * sizeof(uint64_t));
+        }
+
+        _bitset->words = words;
+    }
+
+    _bitset->size       = _size;
+    _bitset->word_count = word_count;
+    d_bitset_internal_trim(_bitset);
+
+    return true;
+}
+
+
+// =============================================================================
+// query functions
+// =============================================================================
+
+/*
+d_bitset_size
+  Returns the number of bits.
+
+Parameter(s):
+  _bitset: the bitset
+Return:
+  The number of bits, or 0 if `_bitset` is NULL.
+*/
+size_t
+d_bitset_size
+(
+    const struct d_bitset* _bitset
+)
+{
+    return (_bitset) ? _bitset->size : 0;
+}
+
+/*
+d_bitset_count
+  Returns the number of set bits.
+
+Parameter(s):
+  _bitset: the bitset
+Return:
+  The population count, or 0 if `_bitset` is NULL.
+*/
+size_t
+d_bitset_count
+(
+    const struct d_bitset* _bitset
+)
+{
+    if (!_bitset)
+    {
+        return 0;
+    }
+
+    return d_bitset_words_count(_bitset->words, _bitset->word_count);
+}
+
+/*
+d_bitset_rank
+  Returns the number of set bits at positions below `_bit`. Positions past
+the end count the whole bitset.
+
+Parameter(s):
+  _bitset: the bitset
+  _bit:    exclusive upper bound
+Return:
+  The rank of `_bit`, or 0 if `_bitset` is NULL.
+*/
+size_t
+d_bitset_rank
+(
+    const struct d_bitset* _bitset,
+    size_t                 _bit
+)
+{
+    size_t word;
+    size_t rank;
+
+    if (!_bitset)
+    {
+        return 0;
+    }
+
+    if (_bit >= _bitset->size)
+    {
+        return d_bitset_count(_bitset);
+    }
+
+    word = _bit / D_BITSET_WORD_BITS;
+    rank = d_bitset_words_count(_bitset->words, word);
+
+    if (_bit % D_BITSET_WORD_BITS != 0)
+    {
+        rank += d_bitset_popcount64(
+                    _bitset->words[word] &
+                    d_bitset_internal_low_mask(_bit % D_BITSET_WORD_BITS));
+    }
+
+    return rank;
+}
+
+/*
+d_bitset_select
+  Finds the position of the `_k`-th set bit, counting from 0, so that
+d_bitset_rank(bitset, position) == `_k`.
+
+Parameter(s):
+  _bitset:  the bitset
+  _k:       0-based ordinal of the set bit
+  _out_bit: receives the position
+Return:
+  - true if the bitset has more than `_k` set bits
+  - false otherwise, or if an argument is NULL
+*/
+bool
+d_bitset_select
+(
+    const struct d_bitset* _bitset,
+    size_t                 _k,
+    size_t*                _out_bit
+)
+{
+    size_t count;
+    size_t i;
+
+    if ( (!_bitset) ||
+         (!_out_bit) )
+    {
+        return false;
+    }
+
+    for (i = 0; i < _bitset->word_count; i++)
+    {
+        count = d_bitset_popcount64(_bitset->words[i]);
+
+        if (_k < count)
+        {
+            *_out_bit = (i * D_BITSET_WORD_BITS) +
+                        d_bitset_internal_select64(_bitset->words[i], _k);
+
+            return true;
+        }
+
+        _k -= count;
+    }
+
+    return false;
+}
+
+/*
+d_bitset_next
+  Finds the first set bit at or after `_from`; iterating with
+`_from = found + 1` visits every set bit in order.
+
+Parameter(s):
+  _bitset:  the bitset
+  _from:    first position to consider
+  _out_bit: receives the position
+Return:
+  - true if a set bit was found
+  - false otherwise, or if an argument is NULL
+*/
+bool
+d_bitset_next
+(
+    const struct d_bitset* _bitset,
+    size_t                 _from,
+    size_t*                _out_bit
+)
+{
+    size_t   i;
+    uint64_t word;
+
+    if ( (!_bitset)                ||
+         (!_out_bit)               ||
+         (_from >= _bitset->size) )
+    {
+        return false;
+    }
+
+    i    = _from / D_BITSET_WORD_BITS;
+    word = _bitset->words[i] & (~(uint64_t)0 << (_from % D_BITSET_WORD_BITS));
+
+    for (;;)
+    {
+        if (word != 0)
+        {
+            *_out_bit = (i * D_BITSET_WORD_BITS) + d_bitset_internal_ctz64(word);
+
+            return true;
+        }
+
+        if (++i >= _bitset->word_count)
+        {
+            return false;
+        }
+
+        word = _bitset->words[i];
+    }
+}
+
+/*
+d_bitset_any
+  Tests whether any bit is set.
+
+Parameter(s):
+  _bitset: the bitset
+Return:
+  - true if at least one bit is set
+  - false if none is, or `_bitset` is NULL
+*/
+bool
+d_bitset_any
+(
+    const struct d_bitset* _bitset
+)
+{
+    size_t i;
+
+    if (!_bitset)
+    {
+        return false;
+    }
+
+    for (i = 0; i < _bitset->word_count; i++)
+    {
+        if (_bitset->words[i] != 0)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/*
+d_bitset_equals
+  Tests whether two bitsets have the same size and the same bits set.
+
+Parameter(s):
+  _a: first bitset
+  _b: second bitset
+Return:
+  - true if they are equal
+  - false otherwise, or if either is NULL
+*/
+bool
+d_bitset_equals
+(
+    const struct d_bitset* _a,
+    const struct d_bitset* _b
+)
+{
+    if ( (!_a) ||
+         (!_b) ||
+         (_a->size != _b->size) )
+    {
+        return false;
+    }
+
+    return (_a->word_count == 0) ||
+           (memcmp(_a->words,
+                   _b->words,
+                   _a->word_count * sizeof(uint64_t)) == 0);
+}
+
+
+// =============================================================================
+// set algebra functions
+// =============================================================================
+
+/*
+d_bitset_and
+  Keeps only the bits of `_dest` that are also set in `_source`. Bits of
+`_dest` past the end of `_source` are cleared.
+
+Parameter(s):
+  _dest:   bitset to update
+  _source: bitset to intersect with
+Return:
+  - true on success
+  - false if either argument is NULL
+*/
+bool
+d_bitset_and
+(
+    struct d_bitset*       _dest,
+    const struct d_bitset* _source
+)
+{
+    size_t shared;
+
+    if ( (!_dest) ||
+         (!_source) )
+    {
+        return false;
+    }
+
+    shared = (_dest->word_count < _source->word_count) ? _dest->word_count
+                                                       : _source->word_count;
+
+    d_bitset_words_and(_dest->words, _source->words, shared);
+
+    if (_dest->word_count > shared)
+    {
+        memset(_dest->words + shared,
+               0,
+               (_dest->word_count - shared) * sizeof(uint64_t));
+    }
+
+    return true;
+}
+
+/*
+d_bitset_or
+  Sets the bits of `_dest` that are set in `_source`. Bits of `_source` past
+the end of `_dest` are ignored.
+
+Parameter(s):
+  _dest:   bitset to update
+  _source: bitset to unite with
+Return:
+  - true on success
+  - false if either argument is NULL
+*/
+bool
+d_bitset_or
+(
+    struct d_bitset*       _dest,
+    const struct d_bitset* _source
+)
+{
+    if ( (!_dest) ||
+         (!_source) )
+    {
+        return false;
+    }
+
+    d_bitset_words_or(_dest->words,
+                      _source->words,
+                      (_dest->word_count < _source->word_count)
+                          ? _dest->word_count
+                          : _source->word_count);
+    d_bitset_internal_trim(_dest);
+
+    return true;
+}
+
+/*
+d_bitset_xor
+  Toggles the bits of `_dest` that are set in `_source`. Bits of `_source`
+past the end of `_dest` are ignored.
+
+Parameter(s):
+  _dest:   bitset to update
+  _source: bitset to combine with
+Return:
+  - true on success
+  - false if either argument is NULL
+*/
+bool
+d_bitset_xor
+(
+    struct d_bitset*       _dest,
+    const struct d_bitset* _source
+)
+{
+    if ( (!_dest) ||
+         (!_source) )
+    {
+        return false;
+    }
+
+    d_bitset_words_xor(_dest->words,
+                       _source->words,
+                       (_dest->word_count < _source->word_count)
+                           ? _dest->word_count
+                           : _source->word_count);
+    d_bitset_internal_trim(_dest);
+
+    return true;
+}
+
+/*
+d_bitset_andnot
+  Clears the bits of `_dest` that are set in `_source` (set difference).
+
+Parameter(s):
+  _dest:   bitset to update
+  _source: bitset to subtract
+Return:
+  - true on success
+  - false if either argument is NULL
+*/
+bool
+d_bitset_andnot
+(
+    struct d_bitset*       _dest,
+    const struct d_bitset* _source
+)
+{
+    if ( (!_dest) ||
+         (!_source) )
+    {
+        return false;
+    }
+
+    d_bitset_words_andnot(_dest->words,
+                          _source->words,
+                          (_dest->word_count < _source->word_count)
+                              ? _dest->word_count
+                              : _source->word_count);
+
+    return true;
+}
+
+/*
+d_bitset_count_and
+  Counts the bits set in both bitsets without building the intersection.
+
+Parameter(s):
+  _a: first bitset
+  _b: second bitset
+Return:
+  The size of the intersection, or 0 if either argument is NULL.
+*/
+size_t
+d_bitset_count_and
+(
+    const struct d_bitset* _a,
+    const struct d_bitset* _b
+)
+{
+    size_t shared;
+    size_t count;
+    size_t i;
+
+    if ( (!_a) ||
+         (!_b) )
+    {
+        return 0;
+    }
+
+    shared = (_a->word_count < _b->word_count) ? _a->word_count
+                                               : _b->word_count;
+    count  = 0;
+
+    for (i = 0; i < shared; i++)
+    {
+        count += d_bitset_popcount64(_a->words[i] & _b->words[i]);
+    }
+
+    return count;
+}
+
+
+// =============================================================================
+// conversion functions
+// =============================================================================
+
+/*
+d_bitset_to_indices
+  Writes the positions of all set bits, in ascending order.
+
+Parameter(s):
+  _bitset:      the bitset
+  _out_indices: receives the positions; must hold d_bitset_count entries
+Return:
+  The number of positions written, or 0 if an argument is NULL.
+*/
+size_t
+d_bitset_to_indices
+(
+    const struct d_bitset* _bitset,
+    size_t*                _out_indices
+)
+{
+    uint64_t word;
+    size_t   count;
+    size_t   i;
+
+    if ( (!_bitset) ||
+         (!_out_indices) )
+    {
+        return 0;
+    }
+
+    count = 0;
+
+    for (i = 0; i < _bitset->word_count; i++)
+    {
+        word = _bitset->words[i];
+
+        while (word != 0)
+        {
+            _out_indices[count++] = (i * D_BITSET_WORD_BITS) +
+                                    d_bitset_internal_ctz64(word);
+            word &= (word - 1);
+        }
+    }
+
+    return count;
+}
+
+
+// =============================================================================
+// memory management
+// =============================================================================
+
+/*
+d_bitset_free
+  Frees a bitset and its words.
+
+Parameter(s):
+  _bitset: the bitset; may be NULL
+Return:
+  none.
+*/
+void
+d_bitset_free
+(
+    struct d_bitset* _bitset
+)
+{
+    if (!_bitset)
+    {
+        return;
+    }
+
+    free(_bitset->words);
+    free(_bitset);
+
+    return;
+}
@@ -0,0 +1,1783 @@
+/******************************************************************************
+* djinterp [container]                                               roaring.c
+*
+*   Implementation of the Roaring-style compressed bitmap.
+*
+*
+* path:      \src\container\bitset\roaring.c
+* link:      TBA
+* author(s): Samuel 'teer' Neal-Blim                          date: 2026.10.18
+******************************************************************************/
+#include "../../../../inc/c/container/bitset/roaring.h"
+
+
+// d_roaring_internal_op
+//   enum (internal): set operation applied by d_roaring_internal_apply.
+enum d_roaring_internal_op
+{
+    D_ROARING_INTERNAL_AND,
+    D_ROARING_INTERNAL_OR,
+    D_ROARING_INTERNAL_ANDNOT
+};
+
+
+// =============================================================================
+// internal helper functions
+// =============================================================================
+
+/*
+d_roaring_internal_view
+  Returns a `d_bitset` that aliases the words of a bitmap container, so the
+bitset queries can be used on it.
+*/
+D_STATIC_INLINE struct d_bitset
+d_roaring_internal_view
+(
+    const struct d_roaring_container* _container
+)
+{
+    struct d_bitset view;
+
+    view.size       = (size_t)D_ROARING_BITMAP_WORDS * D_BITSET_WORD_BITS;
+    view.word_count = D_ROARING_BITMAP_WORDS;
+    view.words      = (uint64_t*)_container->data;
+
+    return view;
+}
+
+/*
+d_roaring_internal_bit
+  Tests the bit for `_low` in a bitmap container's words.
+*/
+D_STATIC_INLINE bool
+d_roaring_internal_bit
+(
+    const uint64_t* _words,
+    uint16_t        _low
+)
+{
+    return ((_words[_low >> 6] >> (_low & 63)) & 1) != 0;
+}
+
+/*
+d_roaring_internal_find_key
+  Binary-searches the containers for `_key`. `_out_pos` receives its
+position, or the position it would be inserted at.
+*/
+static bool
+d_roaring_internal_find_key
+(
+    const struct d_roaring* _roaring,
+    uint16_t                _key,
+    size_t*                 _out_pos
+)
+{
+    size_t low;
+    size_t high;
+    size_t middle;
+
+    low  = 0;
+    high = _roaring->container_count;
+
+    while (low < high)
+    {
+        middle = low + ((high - low) / 2);
+
+        if (_roaring->containers[middle].key < _key)
+        {
+            low = middle + 1;
+        }
+        else
+        {
+            high = middle;
+        }
+    }
+
+    *_out_pos = low;
+
+    return (low < _roaring->container_count) &&
+           (_roaring->containers[low].key == _key);
+}
+
+/*
+d_roaring_internal_find_low
+  Binary-searches the values of an array container for `_low`.
+`_out_pos` receives its position, or the position it would be inserted at.
+*/
+static bool
+d_roaring_internal_find_low
+(
+    const uint16_t* _values,
+    uint32_t        _count,
+    uint16_t        _low,
+    uint32_t*       _out_pos
+)
+{
+    uint32_t low;
+    uint32_t high;
+    uint32_t middle;
+
+    low  = 0;
+    high = _count;
+
+    while (low < high)
+    {
+        middle = low + ((high - low) / 2);
+
+        if (_values[middle] < _low)
+        {
+            low = middle + 1;
+        }
+        else
+        {
+            high = middle;
+        }
+    }
+
+    *_out_pos = low;
+
+    return (low < _count) &&
+           (_values[low] == _low);
+}
+
+/*
+d_roaring_internal_to_bitmap
+  Converts an array container to bitmap form.
+*/
+static bool
+d_roaring_internal_to_bitmap
+(
+    struct d_roaring_container* _container
+)
+{
+    const uint16_t* values;
+    uint64_t*       words;
+    uint32_t        i;
+
+    words = calloc(D_ROARING_BITMAP_WORDS, sizeof(uint64_t));
+
+    if (!words)
+    {
+        return false;
+    }
+
+    values = (const uint16_t*)_container->data;
+
+    for (i = 0; i < _container->count; i++)
+    {
+        words[values[i] >> 6] |= ((uint64_t)1) << (values[i] & 63);
+    }
+
+    free(_container->data);
+
+    _container->data      = words;
+    _container->is_bitmap = true;
+    _container->capacity  = 0;
+
+    return true;
+}
+
+/*
+d_roaring_internal_to_array
+  Converts a bitmap container to array form.
+*/
+static bool
+d_roaring_internal_to_array
+(
+    struct d_roaring_container* _container
+)
+{
+    struct d_bitset view;
+    uint16_t*       values;
+    uint32_t        count;
+    size_t          bit;
+
+    values = malloc(((_container->count != 0) ? _container->count : 1) *
+                    sizeof(uint16_t));
+
+    if (!values)
+    {
+        return false;
+    }
+
+    view  = d_roaring_internal_view(_container);
+    count = 0;
+    bit   = 0;
+
+    while (d_bitset_next(&view, bit, &bit))
+    {
+        values[count++] = (uint16_t)bit;
+        bit++;
+    }
+
+    free(_container->data);
+
+    _container->data      = values;
+    _container->is_bitmap = false;
+    _container->capacity  = (_container->count != 0) ? _container->count : 1;
+
+    return true;
+}
+
+/*
+d_roaring_internal_normalize
+  Converts a container to the form its cardinality calls for: an array for
+at most D_ROARING_ARRAY_MAX values, a bitmap above that.
+*/
+static bool
+d_roaring_internal_normalize
+(
+    struct d_roaring_container* _container
+)
+{
+    if ( (_container->is_bitmap) &&
+         (_container->count <= D_ROARING_ARRAY_MAX) )
+    {
+        return d_roaring_internal_to_array(_container);
+    }
+
+    if ( (!_container->is_bitmap) &&
+         (_container->count > D_ROARING_ARRAY_MAX) )
+    {
+        return d_roaring_internal_to_bitmap(_container);
+    }
+
+    return true;
+}
+
+/*
+d_roaring_internal_container_copy
+  Deep-copies a container into `_out`.
+*/
+static bool
+d_roaring_internal_container_copy
+(
+    const struct d_roaring_container* _source,
+    struct d_roaring_container*       _out
+)
+{
+    size_t bytes;
+
+    *_out = *_source;
+    bytes = (_source->is_bitmap)
+                ? (size_t)D_ROARING_BITMAP_WORDS * sizeof(uint64_t)
+                : (size_t)_source->count * sizeof(uint16_t);
+
+    _out->data = malloc((bytes != 0) ? bytes : 1);
+
+    if (!_out->data)
+    {
+        return false;
+    }
+
+    if (bytes != 0)
+    {
+        d_memcpy(_out->data, _source->data, bytes);
+    }
+
+    if (!_source->is_bitmap)
+    {
+        _out->capacity = (_source->count != 0) ? _source->count : 1;
+    }
+
+    return true;
+}
+
+/*
+d_roaring_internal_reserve
+  Makes room for at least one more container.
+*/
+static bool
+d_roaring_internal_reserve
+(
+    struct d_roaring* _roaring
+)
+{
+    struct d_roaring_container* containers;
+    size_t                      capacity;
+
+    if (_roaring->container_count < _roaring->container_capacity)
+    {
+        return true;
+    }
+
+    capacity   = (_roaring->container_capacity != 0)
+                     ? _roaring->container_capacity * 2
+                     : 4;
+    containers = realloc(_roaring->containers,
+                         capacity * sizeof(struct d_roaring_container));
+
+    if (!containers)
+    {
+        return false;
+    }
+
+    _roaring->containers         = containers;
+    _roaring->container_capacity = capacity;
+
+    return true;
+}
+
+/*
+d_roaring_internal_insert_container
+  Inserts an empty array container for `_key` at position `_pos`.
+*/
+static bool
+d_roaring_internal_insert_container
+(
+    struct d_roaring* _roaring,
+    size_t            _pos,
+    uint16_t          _key
+)
+{
+    struct d_roaring_container* container;
+
+    if (!d_roaring_internal_reserve(_roaring))
+    {
+        return false;
+    }
+
+    memmove(_roaring->containers + _pos + 1,
+            _roaring->containers + _pos,
+            (_roaring->container_count - _pos) *
+                sizeof(struct d_roaring_container));
+
+    container = &_roaring->containers[_pos];
+
+    container->key       = _key;
+    container->is_bitmap = false;
+    container->count     = 0;
+    container->capacity  = 0;
+    container->data      = NULL;
+
+    _roaring->container_count++;
+
+    return true;
+}
+
+/*
+d_roaring_internal_remove_container
+  Frees and removes the container at position `_pos`.
+*/
+static void
+d_roaring_internal_remove_container
+(
+    struct d_roaring* _roaring,
+    size_t            _pos
+)
+{
+    free(_roaring->containers[_pos].data);
+
+    memmove(_roaring->containers + _pos,
+            _roaring->containers + _pos + 1,
+            (_roaring->container_count - _pos - 1) *
+                sizeof(struct d_roaring_container));
+
+    _roaring->container_count--;
+
+    return;
+}
+
+/*
+d_roaring_internal_container_add
+  Adds `_low` to a container, converting a full array to a bitmap.
+*/
+static bool
+d_roaring_internal_container_add
+(
+    struct d_roaring_container* _container,
+    uint16_t                    _low
+)
+{
+    uint64_t* words;
+    uint16_t* values;
+    uint32_t  capacity;
+    uint32_t  pos;
+
+    if (_container->is_bitmap)
+    {
+        words = (uint64_t*)_container->data;
+
+        if (!d_roaring_internal_bit(words, _low))
+        {
+            words[_low >> 6] |= ((uint64_t)1) << (_low & 63);
+            _container->count++;
+        }
+
+        return true;
+    }
+
+    if (d_roaring_internal_find_low((const uint16_t*)_container->data,
+                                    _container->count,
+                                    _low,
+                                    &pos))
+    {
+        return true;
+    }
+
+    if (_container->count == D_ROARING_ARRAY_MAX)
+    {
+        return (d_roaring_internal_to_bitmap(_container)) &&
+               (d_roaring_internal_container_add(_container, _low));
+    }
+
+    if (_container->count == _container->capacity)
+    {
+        capacity = (_container->capacity != 0) ? _container->capacity * 2
+                                               : 4;
+
+        if (capacity > D_ROARING_ARRAY_MAX)
+        {
+            capacity = D_ROARING_ARRAY_MAX;
+        }
+
+        values = realloc(_container->data, capacity * sizeof(uint16_t));
+
+        if (!values)
+        {
+            return false;
+        }
+
+        _container->data     = values;
+        _container->capacity = capacity;
+    }
+
+    values = (uint16_t*)_container->data;
+
+    memmove(values + pos + 1,
+            values + pos,
+            (_container->count - pos) * sizeof(uint16_t));
+
+    values[pos] = _low;
+    _container->count++;
+
+    return true;
+}
+
+/*
+d_roaring_internal_merge
+  Combines two array containers with a single merge pass.
+*/
+static bool
+d_roaring_internal_merge
+(
+    const struct d_roaring_container* _a,
+    const struct d_roaring_container* _b,
+    enum d_roaring_internal_op        _op,
+    struct d_roaring_container*       _out
+)
+{
+    const uint16_t* a;
+    const uint16_t* b;
+    uint16_t*       values;
+    uint32_t        capacity;
+    uint32_t        i;
+    uint32_t        j;
+    uint32_t        n;
+
+    a = (const uint16_t*)_a->data;
+    b = (const uint16_t*)_b->data;
+
+    switch (_op)
+    {
+        case D_ROARING_INTERNAL_AND:
+            capacity = (_a->count < _b->count) ? _a->count : _b->count;
+            break;
+
+        case D_ROARING_INTERNAL_OR:
+            capacity = _a->count + _b->count;
+            break;
+
+        default:
+            capacity = _a->count;
+            break;
+    }
+
+    values = malloc(((capacity != 0) ? capacity : 1) * sizeof(uint16_t));
+
+    if (!values)
+    {
+        return false;
+    }
+
+    i = 0;
+    j = 0;
+    n = 0;
+
+    while ( (i < _a->count) &&
+            (j < _b->count) )
+    {
+        if (a[i] < b[j])
+        {
+            if (_op != D_ROARING_INTERNAL_AND)
+            {
+                values[n++] = a[i];
+            }
+
+            i++;
+        }
+        else if (a[i] > b[j])
+        {
+            if (_op == D_ROARING_INTERNAL_OR)
+            {
+                values[n++] = b[j];
+            }
+
+            j++;
+        }
+        else
+        {
+            if (_op != D_ROARING_INTERNAL_ANDNOT)
+            {
+                values[n++] = a[i];
+            }
+
+            i++;
+            j++;
+        }
+    }
+
+    if (_op != D_ROARING_INTERNAL_AND)
+    {
+        d_memcpy(values + n, a + i, (_a->count - i) * sizeof(uint16_t));
+        n += _a->count - i;
+    }
+
+    if (_op == D_ROARING_INTERNAL_OR)
+    {
+        d_memcpy(values + n, b + j, (_b->count - j) * sizeof(uint16_t));
+        n += _b->count - j;
+    }
+
+    _out->is_bitmap = false;
+    _out->count     = n;
+    _out->capacity  = (capacity != 0) ? capacity : 1;
+    _out->data      = values;
+
+    return d_roaring_internal_normalize(_out);
+}
+
+/*
+d_roaring_internal_probe
+  Keeps the values of an array container whose bit in `_words` is set
+(`_keep_set` true) or clear (`_keep_set` false).
+*/
+static bool
+d_roaring_internal_probe
+(
+    const struct d_roaring_container* _array,
+    const uint64_t*                   _words,
+    bool                              _keep_set,
+    struct d_roaring_container*       _out
+)
+{
+    const uint16_t* source;
+    uint16_t*       values;
+    uint32_t        i;
+    uint32_t        n;
+
+    source = (const uint16_t*)_array->data;
+    values = malloc(((_array->count != 0) ? _array->count : 1) *
+                    sizeof(uint16_t));
+
+    if (!values)
+    {
+        return false;
+    }
+
+    n = 0;
+
+    for (i = 0; i < _array->count; i++)
+    {
+        values[n] = source[i];
+        n        += (d_roaring_internal_bit(_words, source[i]) == _keep_set);
+    }
+
+    _out->is_bitmap = false;
+    _out->count     = n;
+    _out->capacity  = (_array->count != 0) ? _array->count : 1;
+    _out->data      = values;
+
+    return true;
+}
+
+/*
+d_roaring_internal_combine
+  Combines two containers with the same key into `_out`. Pairs that can
+only shrink an array are merged or probed; everything else is computed on
+a bitmap and normalized afterwards.
+*/
+static bool
+d_roaring_internal_combine
+(
+    const struct d_roaring_container* _a,
+    const struct d_roaring_container* _b,
+    enum d_roaring_internal_op        _op,
+    struct d_roaring_container*       _out
+)
+{
+    const uint16_t* values;
+    uint64_t*       words;
+    uint32_t        i;
+
+    _out->key      = _a->key;
+    _out->capacity = 0;
+
+    if ( (!_a->is_bitmap) &&
+         (!_b->is_bitmap) )
+    {
+        return d_roaring_internal_merge(_a, _b, _op, _out);
+    }
+
+    if (_op == D_ROARING_INTERNAL_AND)
+    {
+        if (!_a->is_bitmap)
+        {
+            return d_roaring_internal_probe(_a, _b->data, true, _out);
+        }
+
+        if (!_b->is_bitmap)
+        {
+            return d_roaring_internal_probe(_b, _a->data, true, _out);
+        }
+    }
+
+    if ( (_op == D_ROARING_INTERNAL_ANDNOT) &&
+         (!_a->is_bitmap) )
+    {
+        return d_roaring_internal_probe(_a, _b->data, false, _out);
+    }
+
+    // the result is computed as a bitmap, starting from `_a`
+    words = calloc(D_ROARING_BITMAP_WORDS, sizeof(uint64_t));
+
+    if (!words)
+    {
+        return false;
+    }
+
+    if (_a->is_bitmap)
+    {
+        d_memcpy(words, _a->data, D_ROARING_BITMAP_WORDS * sizeof(uint64_t));
+    }
+    else
+    {
+        values = (const uint16_t*)_a->data;
+
+        for (i = 0; i < _a->count; i++)
+        {
+            words[values[i] >> 6] |= ((uint64_t)1) << (values[i] & 63);
+        }
+    }
+
+    if (_b->is_bitmap)
+    {
+        switch (_op)
+        {
+            case D_ROARING_INTERNAL_AND:
+                d_bitset_words_and(words, _b->data, D_ROARING_BITMAP_WORDS);
+                break;
+
+            case D_ROARING_INTERNAL_OR:
+                d_bitset_words_or(words, _b->data, D_ROARING_BITMAP_WORDS);
+                break;
+
+            default:
+                d_bitset_words_andnot(words, _b->data, D_ROARING_BITMAP_WORDS);
+                break;
+        }
+    }
+    else
+    {
+        // OR or ANDNOT of a bitmap and an array
+        values = (const uint16_t*)_b->data;
+
+        for (i = 0; i < _b->count; i++)
+        {
+            if (_op == D_ROARING_INTERNAL_OR)
+            {
+                words[values[i] >> 6] |= ((uint64_t)1) << (values[i] & 63);
+            }
+            else
+            {
+                words[values[i] >> 6] &= ~(((uint64_t)1) << (values[i] & 63));
+            }
+        }
+    }
+
+    _out->is_bitmap = true;
+    _out->data      = words;
+    _out->count     = (uint32_t)d_bitset_words_count(words,
+                                                     D_ROARING_BITMAP_WORDS);
+
+    return d_roaring_internal_normalize(_out);
+}
+
+/*
+d_roaring_internal_append
+  Appends a container, taking ownership of its data, to a result being
+built in key order. Empty containers are freed instead.
+*/
+static bool
+d_roaring_internal_append
+(
+    struct d_roaring*           _roaring,
+    struct d_roaring_container* _container
+)
+{
+    if (_container->count == 0)
+    {
+        free(_container->data);
+        _container->data = NULL;
+
+        return true;
+    }
+
+    if (!d_roaring_internal_reserve(_roaring))
+    {
+        free(_container->data);
+        _container->data = NULL;
+
+        return false;
+    }
+
+    _roaring->containers[_roaring->container_count++] = *_container;
+
+    return true;
+}
+
+/*
+d_roaring_internal_apply
+  Builds the result of a set operation by walking both key lists in step.
+*/
+static struct d_roaring*
+d_roaring_internal_apply
+(
+    const struct d_roaring*    _a,
+    const struct d_roaring*    _b,
+    enum d_roaring_internal_op _op
+)
+{
+    struct d_roaring*          result;
+    struct d_roaring_container container;
+    size_t                     i;
+    size_t                     j;
+    bool                       has_a;
+    bool                       has_b;
+    bool                       ok;
+
+    if ( (!_a) ||
+         (!_b) )
+    {
+        return NULL;
+    }
+
+    result = d_roaring_new();
+
+    if (!result)
+    {
+        return NULL;
+    }
+
+    i = 0;
+    j = 0;
+
+    for (;;)
+    {
+        has_a = (i < _a->container_count);
+        has_b = (j < _b->container_count);
+
+        // nothing left that can contribute to the result
+        if ( ( (!has_a) && (!has_b) )                              ||
+             ( (_op == D_ROARING_INTERNAL_AND) && (!(has_a && has_b)) ) ||
+             ( (_op == D_ROARING_INTERNAL_ANDNOT) && (!has_a) ) )
+        {
+            break;
+        }
+
+        memset(&container, 0, sizeof(container));
+
+        if ( (has_a) &&
+             ( (!has_b) ||
+               (_a->containers[i].key < _b->containers[j].key) ) )
+        {
+            ok = (_op == D_ROARING_INTERNAL_AND) ||
+                 ( (d_roaring_internal_container_copy(&_a->containers[i],
+                                                      &container)) &&
+                   (d_roaring_internal_append(result, &container)) );
+            i++;
+        }
+        else if ( (!has_a) ||
+                  (_b->containers[j].key < _a->containers[i].key) )
+        {
+            ok = (_op != D_ROARING_INTERNAL_OR) ||
+                 ( (d_roaring_internal_container_copy(&_b->containers[j],
+                                                      &container)) &&
+                   (d_roaring_internal_append(result, &container)) );
+            j++;
+        }
+        else
+        {
+            ok = (d_roaring_internal_combine(&_a->containers[i],
+                                             &_b->containers[j],
+                                             _op,
+                                             &container)) &&
+                 (d_roaring_internal_append(result, &container));
+            i++;
+            j++;
+        }
+
+        if (!ok)
+        {
+            free(container.data);
+            d_roaring_free(result);
+
+            return NULL;
+        }
+    }
+
+    return result;
+}
+
+
+// =============================================================================
+// constructor functions
+// =============================================================================
+
+/*
+d_roaring_new
+  Creates an empty compressed bitmap.
+
+Parameter(s):
+  none.
+Return:
+  - Pointer to the new bitmap
+  - NULL if allocation fails
+*/
+struct d_roaring*
+d_roaring_new
+(
+    void
+)
+{
+    struct d_roaring* roaring;
+
+    roaring = malloc(sizeof(struct d_roaring));
+
+    if (!roaring)
+    {
+        return NULL;
+    }
+
+    roaring->container_count    = 0;
+    roaring->container_capacity = 0;
+    roaring->containers         = NULL;
+
+    return roaring;
+}
+
+/*
+d_roaring_new_copy
+  Creates a deep copy of another compressed bitmap.
+
+Parameter(s):
+  _other: the bitmap to copy
+Return:
+  - Pointer to the new bitmap
+  - NULL if `_other` is NULL or allocation fails
+*/
+struct d_roaring*
+d_roaring_new_copy
+(
+    const struct d_roaring* _other
+)
+{
+    struct d_roaring*          roaring;
+    struct d_roaring_container container;
+    size_t                     i;
+
+    if (!_other)
+    {
+        return NULL;
+    }
+
+    roaring = d_roaring_new();
+
+    for (i = 0; (roaring) && (i < _other->container_count); i++)
+    {
+        if ( (!d_roaring_internal_container_copy(&_other->containers[i],
+                                                 &container)) ||
+             (!d_roaring_internal_append(roaring, &container)) )
+        {
+            d_roaring_free(roaring);
+
+            return NULL;
+        }
+    }
+
+    return roaring;
+}
+
+/*
+d_roaring_new_from_array
+  Creates a compressed bitmap holding the given values.
+
+Parameter(s):
+  _values: values to add, in any order, duplicates allowed; may be NULL if
+           `_count` is 0
+  _count:  number of values
+Return:
+  - Pointer to the new bitmap
+  - NULL if `_values` is NULL with a non-zero count, or allocation fails
+*/
+struct d_roaring*
+d_roaring_new_from_array
+(
+    const uint32_t* _values,
+    size_t          _count
+)
+{
+    struct d_roaring* roaring;
+    size_t            i;
+
+    if ( (!_values) &&
+         (_count != 0) )
+    {
+        return NULL;
+    }
+
+    roaring = d_roaring_new();
+
+    for (i = 0; (roaring) && (i < _count); i++)
+    {
+        if (!d_roaring_add(roaring, _values[i]))
+        {
+            d_roaring_free(roaring);
+
+            return NULL;
+        }
+    }
+
+    return roaring;
+}
+
+/*
+d_roaring_new_from_bitset
+  Creates a compressed bitmap holding the set bits of a bitset. Each
+65536-bit chunk of the bitset becomes one container; dense chunks are
+copied word for word.
+
+Parameter(s):
+  _bitset: the bitset; at most 2^32 bits
+Return:
+  - Pointer to the new bitmap
+  - NULL if `_bitset` is NULL or too large, or allocation fails
+*/
+struct d_roaring*
+d_roaring_new_from_bitset
+(
+    const struct d_bitset* _bitset
+)
+{
+    struct d_roaring*          roaring;
+    struct d_roaring_container container;
+    uint16_t*                  values;
+    size_t                     start;
+    size_t                     words;
+    size_t                     bit;
+    uint32_t                   count;
+    uint32_t                   n;
+
+    if ( (!_bitset) ||
+         ((uint64_t)_bitset->size > ((uint64_t)1 << 32)) )
+    {
+        return NULL;
+    }
+
+    roaring = d_roaring_new();
+
+    if (!roaring)
+    {
+        return NULL;
+    }
+
+    for (start = 0; start < _bitset->word_count; start += D_ROARING_BITMAP_WORDS)
+    {
+        words = _bitset->word_count - start;
+
+        if (words > D_ROARING_BITMAP_WORDS)
+        {
+            words = D_ROARING_BITMAP_WORDS;
+        }
+
+        count = (uint32_t)d_bitset_words_count(_bitset->words + start, words);
+
+        if (count == 0)
+        {
+            continue;
+        }
+
+        container.key      = (uint16_t)(start / D_ROARING_BITMAP_WORDS);
+        container.count    = count;
+        container.capacity = 0;
+
+        if (count > D_ROARING_ARRAY_MAX)
+        {
+            container.is_bitmap = true;
+            container.data      = calloc(D_ROARING_BITMAP_WORDS,
+                                         sizeof(uint64_t));
+
+            if (container.data)
+            {
+                d_memcpy(container.data,
+                         _bitset->words + start,
+                         words * sizeof(uint64_t));
+            }
+        }
+        else
+        {
+            container.is_bitmap = false;
+            container.capacity  = count;
+            container.data      = values = malloc(count * sizeof(uint16_t));
+
+            bit = start * D_BITSET_WORD_BITS;
+
+            for (n = 0;
+                 (values) &&
+                 (n < count) &&
+                 (d_bitset_next(_bitset, bit, &bit));
+                 n++)
+            {
+                values[n] = (uint16_t)(bit & 0xFFFF);
+                bit++;
+            }
+        }
+
+        if ( (!container.data) ||
+             (!d_roaring_internal_append(roaring, &container)) )
+        {
+            d_roaring_free(roaring);
+
+            return NULL;
+        }
+    }
+
+    return roaring;
+}
+
+
+// =============================================================================
+// element functions
+// =============================================================================
+
+/*
+d_roaring_add
+  Adds a value.
+
+Parameter(s):
+  _roaring: the bitmap
+  _value:   value to add
+Return:
+  - true if the value is in the bitmap afterwards
+  - false if `_roaring` is NULL or allocation fails
+*/
+bool
+d_roaring_add
+(
+    struct d_roaring* _roaring,
+    uint32_t          _value
+)
+{
+    size_t pos;
+
+    if (!_roaring)
+    {
+        return false;
+    }
+
+    if ( (!d_roaring_internal_find_key(_roaring,
+                                       (uint16_t)(_value >> 16),
+                                       &pos)) &&
+         (!d_roaring_internal_insert_container(_roaring,
+                                               pos,
+                                               (uint16_t)(_value >> 16))) )
+    {
+        return false;
+    }
+
+    if (!d_roaring_internal_container_add(&_roaring->containers[pos],
+                                          (uint16_t)(_value & 0xFFFF)))
+    {
+        if (_roaring->containers[pos].count == 0)
+        {
+            d_roaring_internal_remove_container(_roaring, pos);
+        }
+
+        return false;
+    }
+
+    return true;
+}
+
+/*
+d_roaring_remove
+  Removes a value. A bitmap container that drops to D_ROARING_ARRAY_MAX
+values goes back to array form; an emptied container is released.
+
+Parameter(s):
+  _roaring: the bitmap
+  _value:   value to remove
+Return:
+  - true if the value was present
+  - false if it was not, or `_roaring` is NULL
+*/
+bool
+d_roaring_remove
+(
+    struct d_roaring* _roaring,
+    uint32_t          _value
+)
+{
+    struct d_roaring_container* container;
+    uint16_t*                   values;
+    uint64_t*                   words;
+    uint16_t                    low;
+    size_t                      pos;
+    uint32_t                    index;
+
+    if ( (!_roaring) ||
+         (!d_roaring_internal_find_key(_roaring,
+                                       (uint16_t)(_value >> 16),
+                                       &pos)) )
+    {
+        return false;
+    }
+
+    container = &_roaring->containers[pos];
+    low       = (uint16_t)(_value & 0xFFFF);
+
+    if (container->is_bitmap)
+    {
+        words = (uint64_t*)container->data;
+
+        if (!d_roaring_internal_bit(words, low))
+        {
+            return false;
+        }
+
+        words[low >> 6] &= ~(((uint64_t)1) << (low & 63));
+        container->count--;
+
+        // a failed conversion leaves a valid, if larger, bitmap
+        d_roaring_internal_normalize(container);
+    }
+    else
+    {
+        values = (uint16_t*)container->data;
+
+        if (!d_roaring_internal_find_low(values, container->count, low, &index))
+        {
+            return false;
+        }
+
+        memmove(values + index,
+                values + index + 1,
+                (container->count - index - 1) * sizeof(uint16_t));
+        container->count--;
+    }
+
+    if (container->count == 0)
+    {
+        d_roaring_internal_remove_container(_roaring, pos);
+    }
+
+    return true;
+}
+
+/*
+d_roaring_contains
+  Tests whether a value is present.
+
+Parameter(s):
+  _roaring: the bitmap
+  _value:   value to look up
+Return:
+  - true if the value is present
+  - false otherwise, or if `_roaring` is NULL
+*/
+bool
+d_roaring_contains
+(
+    const struct d_roaring* _roaring,
+    uint32_t                _value
+)
+{
+    const struct d_roaring_container* container;
+    size_t                            pos;
+    uint32_t                          index;
+
+    if ( (!_roaring) ||
+         (!d_roaring_internal_find_key(_roaring,
+                                       (uint16_t)(_value >> 16),
+                                       &pos)) )
+    {
+        return false;
+    }
+
+    container = &_roaring->containers[pos];
+
+    if (container->is_bitmap)
+    {
+        return d_roaring_internal_bit((const uint64_t*)container->data,
+                                      (uint16_t)(_value & 0xFFFF));
+    }
+
+    return d_roaring_internal_find_low((const uint16_t*)container->data,
+                                       container->count,
+                                       (uint16_t)(_value & 0xFFFF),
+                                       &index);
+}
+
+/*
+d_roaring_clear
+  Removes every value and releases the containers.
+
+Parameter(s):
+  _roaring: the bitmap
+Return:
+  - true on success
+  - false if `_roaring` is NULL
+*/
+bool
+d_roaring_clear
+(
+    struct d_roaring* _roaring
+)
+{
+    size_t i;
+
+    if (!_roaring)
+    {
+        return false;
+    }
+
+    for (i = 0; i < _roaring->container_count; i++)
+    {
+        free(_roaring->containers[i].data);
+    }
+
+    _roaring->container_count = 0;
+
+    return true;
+}
+
+
+// =============================================================================
+// query functions
+// =============================================================================
+
+/*
+d_roaring_count
+  Returns the number of values.
+
+Parameter(s):
+  _roaring: the bitmap
+Return:
+  The cardinality, or 0 if `_roaring` is NULL.
+*/
+size_t
+d_roaring_count
+(
+    const struct d_roaring* _roaring
+)
+{
+    size_t count;
+    size_t i;
+
+    if (!_roaring)
+    {
+        return 0;
+    }
+
+    count = 0;
+
+    for (i = 0; i < _roaring->container_count; i++)
+    {
+        count += _roaring->containers[i].count;
+    }
+
+    return count;
+}
+
+/*
+d_roaring_is_empty
+  Tests whether the bitmap holds no value.
+
+Parameter(s):
+  _roaring: the bitmap
+Return:
+  - true if it is empty or NULL
+  - false otherwise
+*/
+bool
+d_roaring_is_empty
+(
+    const struct d_roaring* _roaring
+)
+{
+    return (!_roaring) ||
+           (_roaring->container_count == 0);
+}
+
+/*
+d_roaring_rank
+  Returns the number of values strictly below `_value`.
+
+Parameter(s):
+  _roaring: the bitmap
+  _value:   exclusive upper bound
+Return:
+  The rank of `_value`, or 0 if `_roaring` is NULL.
+*/
+size_t
+d_roaring_rank
+(
+    const struct d_roaring* _roaring,
+    uint32_t                _value
+)
+{
+    const struct d_roaring_container* container;
+    struct d_bitset                   view;
+    size_t                            rank;
+    size_t                            pos;
+    size_t                            i;
+    uint32_t                          index;
+    bool                              found;
+
+    if (!_roaring)
+    {
+        return 0;
+    }
+
+    rank  = 0;
+    found = d_roaring_internal_find_key(_roaring,
+                                        (uint16_t)(_value >> 16),
+                                        &pos);
+
+    // every container before `pos` lies wholly below `_value`
+    for (i = 0; i < pos; i++)
+    {
+        rank += _roaring->containers[i].count;
+    }
+
+    if (!found)
+    {
+        return rank;
+    }
+
+    container = &_roaring->containers[pos];
+
+    if (container->is_bitmap)
+    {
+        view = d_roaring_internal_view(container);
+
+        return rank + d_bitset_rank(&view, _value & 0xFFFF);
+    }
+
+    d_roaring_internal_find_low((const uint16_t*)container->data,
+                                container->count,
+                                (uint16_t)(_value & 0xFFFF),
+                                &index);
+
+    return rank + index;
+}
+
+/*
+d_roaring_select
+  Finds the `_k`-th smallest value, counting from 0.
+
+Parameter(s):
+  _roaring:   the bitmap
+  _k:         0-based ordinal
+  _out_value: receives the value
+Return:
+  - true if the bitmap holds more than `_k` values
+  - false otherwise, or if an argument is NULL
+*/
+bool
+d_roaring_select
+(
+    const struct d_roaring* _roaring,
+    size_t                  _k,
+    uint32_t*               _out_value
+)
+{
+    const struct d_roaring_container* container;
+    struct d_bitset                   view;
+    size_t                            bit;
+    size_t                            i;
+
+    if ( (!_roaring) ||
+         (!_out_value) )
+    {
+        return false;
+    }
+
+    for (i = 0; i < _roaring->container_count; i++)
+    {
+        container = &_roaring->containers[i];
+
+        if (_k >= container->count)
+        {
+            _k -= container->count;
+
+            continue;
+        }
+
+        if (container->is_bitmap)
+        {
+            view = d_roaring_internal_view(container);
+            d_bitset_select(&view, _k, &bit);
+        }
+        else
+        {
+            bit = ((const uint16_t*)container->data)[_k];
+        }
+
+        *_out_value = ((uint32_t)container->key << 16) | (uint32_t)bit;
+
+        return true;
+    }
+
+    return false;
+}
+
+/*
+d_roaring_equals
+  Tests whether two bitmaps hold the same values.
+
+Parameter(s):
+  _a: first bitmap
+  _b: second bitmap
+Return:
+  - true if they hold the same values
+  - false otherwise, or if either is NULL
+*/
+bool
+d_roaring_equals
+(
+    const struct d_roaring* _a,
+    const struct d_roaring* _b
+)
+{
+    const struct d_roaring_container* a;
+    const struct d_roaring_container* b;
+    const struct d_roaring_container* array;
+    const struct d_roaring_container* bitmap;
+    size_t                            i;
+    uint32_t                          j;
+
+    if ( (!_a) ||
+         (!_b) ||
+         (_a->container_count != _b->container_count) )
+    {
+        return false;
+    }
+
+    for (i = 0; i < _a->container_count; i++)
+    {
+        a = &_a->containers[i];
+        b = &_b->containers[i];
+
+        if ( (a->key != b->key) ||
+             (a->count != b->count) )
+        {
+            return false;
+        }
+
+        if (a->is_bitmap == b->is_bitmap)
+        {
+            if (memcmp(a->data,
+                       b->data,
+                       (a->is_bitmap)
+                           ? (size_t)D_ROARING_BITMAP_WORDS * sizeof(uint64_t)
+                           : (size_t)a->count * sizeof(uint16_t)) != 0)
+            {
+                return false;
+            }
+
+            continue;
+        }
+
+        // same cardinality, so the array being a subset suffices
+        array  = (a->is_bitmap) ? b : a;
+        bitmap = (a->is_bitmap) ? a : b;
+
+        for (j = 0; j < array->count; j++)
+        {
+            if (!d_roaring_internal_bit((const uint64_t*)bitmap->data,
+                                        ((const uint16_t*)array->data)[j]))
+            {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+
+// =============================================================================
+// set algebra functions
+// =============================================================================
+
+/*
+d_roaring_and
+  Creates the intersection of two bitmaps.
+
+Parameter(s):
+  _a: first bitmap
+  _b: second bitmap
+Return:
+  - Pointer to a new bitmap holding the values present in both
+  - NULL if either argument is NULL or allocation fails
+*/
+struct d_roaring*
+d_roaring_and
+(
+    const struct d_roaring* _a,
+    const struct d_roaring* _b
+)
+{
+    return d_roaring_internal_apply(_a, _b, D_ROARING_INTERNAL_AND);
+}
+
+/*
+d_roaring_or
+  Creates the union of two bitmaps.
+
+Parameter(s):
+  _a: first bitmap
+  _b: second bitmap
+Return:
+  - Pointer to a new bitmap holding the values present in either
+  - NULL if either argument is NULL or allocation fails
+*/
+struct d_roaring*
+d_roaring_or
+(
+    const struct d_roaring* _a,
+    const struct d_roaring* _b
+)
+{
+    return d_roaring_internal_apply(_a, _b, D_ROARING_INTERNAL_OR);
+}
+
+/*
+d_roaring_andnot
+  Creates the difference of two bitmaps.
+
+Parameter(s):
+  _a: bitmap to take values from
+  _b: bitmap of values to leave out
+Return:
+  - Pointer to a new bitmap holding the values of `_a` absent from `_b`
+  - NULL if either argument is NULL or allocation fails
+*/
+struct d_roaring*
+d_roaring_andnot
+(
+    const struct d_roaring* _a,
+    const struct d_roaring* _b
+)
+{
+    return d_roaring_internal_apply(_a, _b, D_ROARING_INTERNAL_ANDNOT);
+}
+
+
+// =============================================================================
+// conversion functions
+// =============================================================================
+
+/*
+d_roaring_to_array
+  Writes every value in ascending order.
+
+Parameter(s):
+  _roaring:    the bitmap
+  _out_values: receives the values; must hold d_roaring_count entries
+Return:
+  The number of values written, or 0 if an argument is NULL.
+*/
+size_t
+d_roaring_to_array
+(
+    const struct d_roaring* _roaring,
+    uint32_t*               _out_values
+)
+{
+    const struct d_roaring_container* container;
+    struct d_bitset                   view;
+    uint32_t                          high;
+    size_t                            count;
+    size_t                            bit;
+    size_t                            i;
+    uint32_t                          j;
+
+    if ( (!_roaring) ||
+         (!_out_values) )
+    {
+        return 0;
+    }
+
+    count = 0;
+
+    for (i = 0; i < _roaring->container_count; i++)
+    {
+        container = &_roaring->containers[i];
+        high      = (uint32_t)container->key << 16;
+
+        if (!container->is_bitmap)
+        {
+            for (j = 0; j < container->count; j++)
+            {
+                _out_values[count++] =
+                    high | ((const uint16_t*)container->data)[j];
+            }
+
+            continue;
+        }
+
+        view = d_roaring_internal_view(container);
+        bit  = 0;
+
+        while (d_bitset_next(&view, bit, &bit))
+        {
+            _out_values[count++] = high | (uint32_t)bit;
+            bit++;
+        }
+    }
+
+    return count;
+}
+
+/*
+d_roaring_to_bitset
+  Creates a bitset of `_size` bits with the bits of the bitmap's values set.
+Dense containers are copied word for word.
+
+Parameter(s):
+  _roaring: the bitmap
+  _size:    number of bits of the bitset; must exceed the largest value
+Return:
+  - Pointer to the new bitset
+  - NULL if `_roaring` is NULL, a value is not below `_size`, or
+    allocation fails
+*/
+struct d_bitset*
+d_roaring_to_bitset
+(
+    const struct d_roaring* _roaring,
+    size_t                  _size
+)
+{
+    const struct d_roaring_container* container;
+    struct d_bitset*                  bitset;
+    struct d_bitset                   view;
+    size_t                            start;
+    size_t                            words;
+    size_t                            bit;
+    size_t                            i;
+    uint32_t                          j;
+
+    if (!_roaring)
+    {
+        return NULL;
+    }
+
+    // the largest value is the last one of the last container
+    if (_roaring->container_count != 0)
+    {
+        container = &_roaring->containers[_roaring->container_count - 1];
+
+        if (container->is_bitmap)
+        {
+            view = d_roaring_internal_view(container);
+            d_bitset_select(&view, container->count - 1, &bit);
+        }
+        else
+        {
+            bit = ((const uint16_t*)container->data)[container->count - 1];
+        }
+
+        if ((((size_t)container->key << 16) | bit) >= _size)
+        {
+            return NULL;
+        }
+    }
+
+    bitset = d_bitset_new(_size);
+
+    for (i = 0; (bitset) && (i < _roaring->container_count); i++)
+    {
+        container = &_roaring->containers[i];
+        start     = (size_t)container->key * D_ROARING_BITMAP_WORDS;
+
+        if (container->is_bitmap)
+        {
+            words = bitset->word_count - start;
+
+            if (words > D_ROARING_BITMAP_WORDS)
+            {
+                words = D_ROARING_BITMAP_WORDS;
+            }
+
+            d_memcpy(bitset->words + start,
+                     container->data,
+                     words * sizeof(uint64_t));
+
+            continue;
+        }
+
+        for (j = 0; j < container->count; j++)
+        {
+            d_bitset_set(bitset,
+                         ((size_t)container->key << 16) |
+                         ((const uint16_t*)container->data)[j]);
+        }
+    }
+
+    return bitset;
+}
+
+
+// =============================================================================
+// memory management
+// =============================================================================
+
+/*
+d_roaring_free
+  Frees a compressed bitmap and all of its containers.
+
+Parameter(s):
+  _roaring: the bitmap; may be NULL
+Return:
+  none.
+*/
+void
+d_roaring_free
+(
+    struct d_roaring* _roaring
+)
+{
+    if (!_roaring)
+    {
+        return;
+    }
+
+    d_roaring_clear(_roaring);
+    free(_roaring->containers);
+    free(_roaring);
+
+    return;
+}
@@ -0,0 +1,2094 @@
+/******************************************************************************
+* djinterp [container]                                             btree_map.c
+*
+*   Implementation of the B+tree ordered map.
+*
+*
+* path:      \src\container\map\btree_map.c
+* link:      TBA
+* author(s): Samuel 'teer' Neal-Blim                          date: 2026.10.18
+******************************************************************************/
+#include "../../../../inc/c/container/map/btree_map.h"
+
+
+// =============================================================================
+// internal helper functions
+// =============================================================================
+
+// D_INTERNAL_BTREE_MAP_KEYS_OFFSET
+//   constant: byte offset of the first key in a node, past the header.
+#define D_INTERNAL_BTREE_MAP_KEYS_OFFSET                                      \
+    ((sizeof(struct d_btree_map_node) + 15) & ~(size_t)15)
+
+// D_INTERNAL_BTREE_MAP_ALIGN_UP
+//   macro: rounds `value` up to a multiple of the power of two `alignment`.
+#define D_INTERNAL_BTREE_MAP_ALIGN_UP(value, alignment)                       \
+    (((value) + ((alignment) - 1)) & ~((size_t)(alignment) - 1))
+
+// d_btree_map_internal_step
+//   struct: one level of a root-to-leaf path: the internal node and the
+// index of the child that was followed.
+struct d_btree_map_internal_step
+{
+    struct d_btree_map_node* node;
+    size_t                   index;
+};
+
+// d_btree_map_internal_iterator_state
+//   struct: state of a d_btree_map_iterator. Copies of the low and high
+// keys, `key_size` bytes each, follow the struct in the same block.
+struct d_btree_map_internal_iterator_state
+{
+    struct d_btree_map_cursor cursor;
+    struct d_btree_map_entry  entry;
+    bool                      has_low;
+    bool                      has_high;
+};
+
+/*
+d_btree_map_internal_key
+  Returns the address of key `_index` of `_node`.
+*/
+D_STATIC_INLINE char*
+d_btree_map_internal_key
+(
+    const struct d_btree_map*      _map,
+    const struct d_btree_map_node* _node,
+    size_t                         _index
+)
+{
+    return (char*)_node + D_INTERNAL_BTREE_MAP_KEYS_OFFSET +
+           (_index * _map->key_size);
+}
+
+/*
+d_btree_map_internal_values
+  Returns the value array of a leaf.
+*/
+D_STATIC_INLINE void**
+d_btree_map_internal_values
+(
+    const struct d_btree_map*      _map,
+    const struct d_btree_map_node* _node
+)
+{
+    return (void**)((char*)_node + _map->slot_offset);
+}
+
+/*
+d_btree_map_internal_children
+  Returns the child array of an internal node.
+*/
+D_STATIC_INLINE struct d_btree_map_node**
+d_btree_map_internal_children
+(
+    const struct d_btree_map*      _map,
+    const struct d_btree_map_node* _node
+)
+{
+    return (struct d_btree_map_node**)((char*)_node + _map->slot_offset);
+}
+
+/*
+d_btree_map_internal_compare
+  Three-way comparison of two keys under the map's ordering. Integer keys
+are read with memcpy, so probes need not be aligned.
+*/
+D_STATIC_INLINE int
+d_btree_map_internal_compare
+(
+    const struct d_btree_map* _map,
+    const void*               _a,
+    const void*               _b
+)
+{
+    switch (_map->key)
+    {
+        case D_BTREE_MAP_KEY_INT32:
+        {
+            int32_t x;
+            int32_t y;
+
+            memcpy(&x, _a, sizeof(x));
+            memcpy(&y, _b, sizeof(y));
+
+            return (x > y) - (x < y);
+        }
+
+        case D_BTREE_MAP_KEY_UINT32:
+        {
+            uint32_t x;
+            uint32_t y;
+
+            memcpy(&x, _a, sizeof(x));
+            memcpy(&y, _b, sizeof(y));
+
+            return (x > y) - (x < y);
+        }
+
+        case D_BTREE_MAP_KEY_INT64:
+        {
+            int64_t x;
+            int64_t y;
+
+            memcpy(&x, _a, sizeof(x));
+            memcpy(&y, _b, sizeof(y));
+
+            return (x > y) - (x < y);
+        }
+
+        case D_BTREE_MAP_KEY_UINT64:
+        {
+            uint64_t x;
+            uint64_t y;
+
+            memcpy(&x, _a, sizeof(x));
+            memcpy(&y, _b, sizeof(y));
+
+            return (x > y) - (x < y);
+        }
+
+        case D_BTREE_MAP_KEY_COMPARATOR:
+        default:
+            return _map->comparator(_a, _b);
+    }
+}
+
+/*
+d_btree_map_internal_bound_comparator
+  Lower (`_upper` false) or upper (`_upper` true) bound of `_probe` among
+the `_count` keys at `_keys`, through a comparator.
+*/
+static size_t
+d_btree_map_internal_bound_comparator
+(
+    const char*   _keys,
+    size_t        _count,
+    size_t        _key_size,
+    fn_comparator _comparator,
+    const void*   _probe,
+    bool          _upper
+)
+{
+    size_t base;
+    size_t half;
+    int    limit;
+
+    if (_count == 0)
+    {
+        return 0;
+    }
+
+    // lower bound skips keys < probe, upper bound keys <= probe
+    limit = (_upper) ? 1 : 0;
+    base  = 0;
+
+    while (_count > 1)
+    {
+        half   = _count / 2;
+        base   = (_comparator(_keys + ((base + half) * _key_size), _probe) < limit)
+                     ? base + half
+                     : base;
+        _count -= half;
+    }
+
+    return base + ((_comparator(_keys + (base * _key_size), _probe) < limit) ? 1 : 0);
+}
+
+// D_INTERNAL_BTREE_MAP_BOUND
+//   macro: defines d_btree_map_internal_bound_<suffix>, the branchless
+// lower/upper bound over a node's packed keys of type `key_type`. Node keys
+// start on a 16-byte boundary of a cache-line-aligned block, so they can be
+// read in place.
+#define D_INTERNAL_BTREE_MAP_BOUND(suffix, key_type)                          \
+    static size_t                                                             \
+    d_btree_map_internal_bound_##suffix                                       \
+    (                                                                         \
+        const key_type* _keys,                                                \
+        size_t          _count,                                               \
+        key_type        _probe,                                               \
+        bool            _upper                                                \
+    )                                                                         \
+    {                                                                         \
+        size_t base;                                                          \
+        size_t half;                                                          \
+                                                                              \
+        if (_count == 0)                                                      \
+        {                                                                     \
+            return 0;                                                         \
+        }                                                                     \
+                                                                              \
+        base = 0;                                                             \
+                                                                              \
+        while (_count > 1)                                                    \
+        {                                                                     \
+            half = _count / 2;                                                \
+            base = ( (_keys[base + half] < _probe) |                          \
+                     ((_upper) & (_keys[base + half] == _probe)) )            \
+                       ? base + half                                          \
+                       : base;                                                \
+            _count -= half;                                                   \
+        }                                                                     \
+                                                                              \
+        return base + ( ( (_keys[base] < _probe) |                            \
+                          ((_upper) & (_keys[base] == _probe)) ) ? 1 : 0 );   \
+    }
+
+D_INTERNAL_BTREE_MAP_BOUND(int32,  int32_t)
+D_INTERNAL_BTREE_MAP_BOUND(uint32, uint32_t)
+D_INTERNAL_BTREE_MAP_BOUND(int64,  int64_t)
+D_INTERNAL_BTREE_MAP_BOUND(uint64, uint64_t)
+
+/*
+d_btree_map_internal_bound
+  Lower or upper bound of `_probe` among the keys of `_node`, using the
+typed loop when the map is keyed. In an internal node the upper bound is
+the index of the child to descend into; in a leaf the lower bound is the
+position of the key or of its insertion point.
+*/
+static size_t
+d_btree_map_internal_bound
+(
+    const struct d_btree_map*      _map,
+    const struct d_btree_map_node* _node,
+    const void*                    _probe,
+    bool                           _upper
+)
+{
+    const char* keys;
+
+    keys = d_btree_map_internal_key(_map, _node, 0);
+
+    switch (_map->key)
+    {
+        case D_BTREE_MAP_KEY_INT32:
+        {
+            int32_t value;
+
+            memcpy(&value, _probe, sizeof(value));
+
+            return d_btree_map_internal_bound_int32((const int32_t*)keys,
+                                                    _node->count,
+                                                    value,
+                                                    _upper);
+        }
+
+        case D_BTREE_MAP_KEY_UINT32:
+        {
+            uint32_t value;
+
+            memcpy(&value, _probe, sizeof(value));
+
+            return d_btree_map_internal_bound_uint32((const uint32_t*)keys,
+                                                     _node->count,
+                                                     value,
+                                                     _upper);
+        }
+
+        case D_BTREE_MAP_KEY_INT64:
+        {
+            int64_t value;
+
+            memcpy(&value, _probe, sizeof(value));
+
+            return d_btree_map_internal_bound_int64((const int64_t*)keys,
+                                                    _node->count,
+                                                    value,
+                                                    _upper);
+        }
+
+        case D_BTREE_MAP_KEY_UINT64:
+        {
+            uint64_t value;
+
+            memcpy(&value, _probe, sizeof(value));
+
+            return d_btree_map_internal_bound_uint64((const uint64_t*)keys,
+                                                     _node->count,
+                                                     value,
+                                                     _upper);
+        }
+
+        case D_BTREE_MAP_KEY_COMPARATOR:
+        default:
+            return d_btree_map_internal_bound_comparator(keys,
+                                                         _node->count,
+                                                         _map->key_size,
+                                                         _map->comparator,
+                                                         _probe,
+                                                         _upper);
+    }
+}
+
+/*
+d_btree_map_internal_find_leaf
+  Descends from the root to the leaf whose range covers `_key`.
+*/
+static struct d_btree_map_node*
+d_btree_map_internal_find_leaf
+(
+    const struct d_btree_map* _map,
+    const void*               _key
+)
+{
+    struct d_btree_map_node* node;
+
+    node = _map->root;
+
+    while (!node->is_leaf)
+    {
+        node = d_btree_map_internal_children(_map, node)
+                   [d_btree_map_internal_bound(_map, node, _key, true)];
+    }
+
+    return node;
+}
+
+/*
+d_btree_map_internal_find
+  Returns the value slot of `_key`, or NULL if the key is absent.
+*/
+static void**
+d_btree_map_internal_find
+(
+    const struct d_btree_map* _map,
+    const void*               _key
+)
+{
+    struct d_btree_map_node* leaf;
+    size_t                   position;
+
+    if ( (!_map)       ||
+         (!_key)       ||
+         (!_map->root) )
+    {
+        return NULL;
+    }
+
+    leaf     = d_btree_map_internal_find_leaf(_map, _key);
+    position = d_btree_map_internal_bound(_map, leaf, _key, false);
+
+    if ( (position < leaf->count) &&
+         (d_btree_map_internal_compare(
+              _map,
+              d_btree_map_internal_key(_map, leaf, position),
+              _key) == 0) )
+    {
+        return &d_btree_map_internal_values(_map, leaf)[position];
+    }
+
+    return NULL;
+}
+
+/*
+d_btree_map_internal_layout
+  Derives the node capacity, the offset of the value/child slots and the
+node size from the key size. The capacity is the largest that fits
+D_BTREE_MAP_NODE_SIZE with room for one extra child pointer, and at least
+D_BTREE_MAP_MIN_FANOUT.
+*/
+static void
+d_btree_map_internal_layout
+(
+    struct d_btree_map* _map
+)
+{
+    size_t capacity;
+    size_t slot_offset;
+    size_t bytes;
+
+    bytes    = D_BTREE_MAP_NODE_SIZE - D_INTERNAL_BTREE_MAP_KEYS_OFFSET -
+               sizeof(void*);
+    capacity = ( (D_BTREE_MAP_NODE_SIZE >
+                  D_INTERNAL_BTREE_MAP_KEYS_OFFSET + sizeof(void*)) )
+                   ? bytes / (_map->key_size + sizeof(void*))
+                   : 0;
+
+    for (;;)
+    {
+        if (capacity < D_BTREE_MAP_MIN_FANOUT)
+        {
+            capacity = D_BTREE_MAP_MIN_FANOUT;
+        }
+
+        slot_offset = D_INTERNAL_BTREE_MAP_ALIGN_UP(
+                          D_INTERNAL_BTREE_MAP_KEYS_OFFSET +
+                              (capacity * _map->key_size),
+                          sizeof(void*));
+        bytes       = slot_offset + ((capacity + 1) * sizeof(void*));
+
+        // padding after the keys may push the last slot past the node
+        if ( (bytes <= D_BTREE_MAP_NODE_SIZE) ||
+             (capacity == D_BTREE_MAP_MIN_FANOUT) )
+        {
+            break;
+        }
+
+        capacity--;
+    }
+
+    _map->capacity    = capacity;
+    _map->slot_offset = slot_offset;
+    _map->node_size   = D_INTERNAL_BTREE_MAP_ALIGN_UP(bytes,
+                                                      D_BTREE_MAP_CACHE_LINE);
+
+    return;
+}
+
+/*
+d_btree_map_internal_node_new
+  Allocates an empty node on a cache-line boundary.
+*/
+static struct d_btree_map_node*
+d_btree_map_internal_node_new
+(
+    const struct d_btree_map* _map,
+    bool                      _is_leaf
+)
+{
+    struct d_btree_map_node* node;
+    void*                    memory;
+
+#if defined(D_ENV_COMPILER_MSVC)
+    memory = _aligned_malloc(_map->node_size, D_BTREE_MAP_CACHE_LINE);
+#elif D_ENV_C_HAS_POSIX_MEMALIGN
+    if (posix_memalign(&memory, D_BTREE_MAP_CACHE_LINE, _map->node_size) != 0)
+    {
+        memory = NULL;
+    }
+#elif D_ENV_C_HAS_ALIGNED_ALLOC
+    memory = aligned_alloc(D_BTREE_MAP_CACHE_LINE, _map->node_size);
+#else
+    memory = malloc(_map->node_size);
+#endif
+
+    if (!memory)
+    {
+        return NULL;
+    }
+
+    node          = (struct d_btree_map_node*)memory;
+    node->next    = NULL;
+    node->count   = 0;
+    node->is_leaf = _is_leaf;
+
+    return node;
+}
+
+/*
+d_btree_map_internal_node_free
+  Frees a node from d_btree_map_internal_node_new.
+*/
+static void
+d_btree_map_internal_node_free
+(
+    struct d_btree_map_node* _node
+)
+{
+#if defined(D_ENV_COMPILER_MSVC)
+    _aligned_free(_node);
+#else
+    free(_node);
+#endif
+
+    return;
+}
+
+/*
+d_btree_map_internal_free_subtree
+  Frees `_node` and every node below it.
+*/
+static void
+d_btree_map_internal_free_subtree
+(
+    const struct d_btree_map* _map,
+    struct d_btree_map_node*  _node
+)
+{
+    struct d_btree_map_node** children;
+    size_t                    i;
+
+    if (!_node)
+    {
+        return;
+    }
+
+    if (!_node->is_leaf)
+    {
+        children = d_btree_map_internal_children(_map, _node);
+
+        for (i = 0; i <= _node->count; i++)
+        {
+            d_btree_map_internal_free_subtree(_map, children[i]);
+        }
+    }
+
+    d_btree_map_internal_node_free(_node);
+
+    return;
+}
+
+/*
+d_btree_map_internal_new
+  Creates an empty map for `_key_size`-byte keys under the given ordering.
+*/
+static struct d_btree_map*
+d_btree_map_internal_new
+(
+    size_t               _key_size,
+    enum d_btree_map_key _key,
+    fn_comparator        _comparator
+)
+{
+    struct d_btree_map* map;
+
+    map = malloc(sizeof(struct d_btree_map));
+
+    if (!map)
+    {
+        return NULL;
+    }
+
+    map->scratch = malloc(2 * _key_size);
+
+    if (!map->scratch)
+    {
+        free(map);
+
+        return NULL;
+    }
+
+    map->root       = NULL;
+    map->first      = NULL;
+    map->count      = 0;
+    map->height     = 0;
+    map->key_size   = _key_size;
+    map->comparator = _comparator;
+    map->key        = _key;
+
+    d_btree_map_internal_layout(map);
+
+    return map;
+}
+
+/*
+d_btree_map_internal_leaf_insert
+  Inserts a key/value pair at `_position` of a leaf with room for it.
+*/
+static void
+d_btree_map_internal_leaf_insert
+(
+    const struct d_btree_map* _map,
+    struct d_btree_map_node*  _leaf,
+    size_t                    _position,
+    const void*               _key,
+    void*                     _value
+)
+{
+    void** values;
+
+    values = d_btree_map_internal_values(_map, _leaf);
+
+    memmove(d_btree_map_internal_key(_map, _leaf, _position + 1),
+            d_btree_map_internal_key(_map, _leaf, _position),
+            (_leaf->count - _position) * _map->key_size);
+    memmove(&values[_position + 1],
+            &values[_position],
+            (_leaf->count - _position) * sizeof(void*));
+
+    memcpy(d_btree_map_internal_key(_map, _leaf, _position),
+           _key,
+           _map->key_size);
+    values[_position] = _value;
+    _leaf->count++;
+
+    return;
+}
+
+/*
+d_btree_map_internal_node_insert
+  Inserts separator `_key` at `_position` and `_child` at `_position + 1`
+of an internal node with room for them.
+*/
+static void
+d_btree_map_internal_node_insert
+(
+    const struct d_btree_map* _map,
+    struct d_btree_map_node*  _node,
+    size_t                    _position,
+    const void*               _key,
+    struct d_btree_map_node*  _child
+)
+{
+    struct d_btree_map_node** children;
+
+    children = d_btree_map_internal_children(_map, _node);
+
+    memmove(d_btree_map_internal_key(_map, _node, _position + 1),
+            d_btree_map_internal_key(_map, _node, _position),
+            (_node->count - _position) * _map->key_size);
+    memmove(&children[_position + 2],
+            &children[_position + 1],
+            (_node->count - _position) * sizeof(struct d_btree_map_node*));
+
+    memcpy(d_btree_map_internal_key(_map, _node, _position),
+           _key,
+           _map->key_size);
+    children[_position + 1] = _child;
+    _node->count++;
+
+    return;
+}
+
+/*
+d_btree_map_internal_leaf_erase
+  Removes the key/value pair at `_position` of a leaf.
+*/
+static void
+d_btree_map_internal_leaf_erase
+(
+    const struct d_btree_map* _map,
+    struct d_btree_map_node*  _leaf,
+    size_t                    _position
+)
+{
+    void** values;
+
+    values = d_btree_map_internal_values(_map, _leaf);
+
+    memmove(d_btree_map_internal_key(_map, _leaf, _position),
+            d_btree_map_internal_key(_map, _leaf, _position + 1),
+            (_leaf->count - _position - 1) * _map->key_size);
+    memmove(&values[_position],
+            &values[_position + 1],
+            (_leaf->count - _position - 1) * sizeof(void*));
+    _leaf->count--;
+
+    return;
+}
+
+/*
+d_btree_map_internal_node_erase
+  Removes separator `_position` and child `_position + 1` of an internal
+node.
+*/
+static void
+d_btree_map_internal_node_erase
+(
+    const struct d_btree_map* _map,
+    struct d_btree_map_node*  _node,
+    size_t                    _position
+)
+{
+    struct d_btree_map_node** children;
+
+    children = d_btree_map_internal_children(_map, _node);
+
+    memmove(d_btree_map_internal_key(_map, _node, _position),
+            d_btree_map_internal_key(_map, _node, _position + 1),
+            (_node->count - _position - 1) * _map->key_size);
+    memmove(&children[_position + 1],
+            &children[_position + 2],
+            (_node->count - _position - 1) * sizeof(struct d_btree_map_node*));
+    _node->count--;
+
+    return;
+}
+
+/*
+d_btree_map_internal_split_leaf
+  Splits a full leaf around the insertion of `_key` at `_position`, moving
+the upper part into the empty leaf `_right`. A leaf that is rightmost in
+the tree and receives its key at the end keeps all its entries, so that
+ascending inserts leave full leaves behind.
+*/
+static void
+d_btree_map_internal_split_leaf
+(
+    const struct d_btree_map* _map,
+    struct d_btree_map_node*  _leaf,
+    struct d_btree_map_node*  _right,
+    size_t                    _position,
+    const void*               _key,
+    void*                     _value,
+    bool                      _rightmost
+)
+{
+    size_t split;
+    size_t moved;
+    void** values;
+    bool   to_left;
+
+    values  = d_btree_map_internal_values(_map, _leaf);
+    split   = ( (_rightmost) &&
+                (_position == _leaf->count) )
+                  ? _leaf->count
+                  : (_map->capacity + 1) / 2;
+    to_left = (_position < split);
+
+    // `split` entries of the combined capacity + 1 stay on the left, one of
+    // which is the new entry when it lands there
+    if (to_left)
+    {
+        split--;
+    }
+
+    moved = _leaf->count - split;
+
+    memcpy(d_btree_map_internal_key(_map, _right, 0),
+           d_btree_map_internal_key(_map, _leaf, split),
+           moved * _map->key_size);
+    memcpy(d_btree_map_internal_values(_map, _right),
+           &values[split],
+           moved * sizeof(void*));
+
+    _right->count = (uint32_t)moved;
+    _leaf->count  = (uint32_t)split;
+    _right->next  = _leaf->next;
+    _leaf->next   = _right;
+
+    if (to_left)
+    {
+        d_btree_map_internal_leaf_insert(_map, _leaf, _position, _key, _value);
+    }
+    else
+    {
+        d_btree_map_internal_leaf_insert(_map,
+                                         _right,
+                                         _position - split,
+                                         _key,
+                                         _value);
+    }
+
+    return;
+}
+
+/*
+d_btree_map_internal_split_node
+  Splits a full internal node around the insertion of separator `_key` at
+`_position` (with `_child` to its right), moving the upper part into the
+empty node `_right`. The separator that moves up to the parent is copied
+to `_out_up`, which must not overlap `_key`. A rightmost node receiving its
+separator at the end keeps all but one key, so the new node starts with
+one key and two children.
+*/
+static void
+d_btree_map_internal_split_node
+(
+    const struct d_btree_map* _map,
+    struct d_btree_map_node*  _node,
+    struct d_btree_map_node*  _right,
+    size_t                    _position,
+    const void*               _key,
+    struct d_btree_map_node*  _child,
+    bool                      _rightmost,
+    void*                     _out_up
+)
+{
+    struct d_btree_map_node** children;
+    struct d_btree_map_node** right_children;
+    size_t                    capacity;
+    size_t                    middle;
+
+    capacity       = _map->capacity;
+    children       = d_btree_map_internal_children(_map, _node);
+    right_children = d_btree_map_internal_children(_map, _right);
+    middle         = ( (_rightmost) &&
+                       (_position == _node->count) )
+                         ? capacity - 1
+                         : capacity / 2;
+
+    // of the capacity + 1 separators, [0, middle) stay, `middle` moves up
+    if (_position < middle)
+    {
+        memcpy(_out_up,
+               d_btree_map_internal_key(_map, _node, middle - 1),
+               _map->key_size);
+        memcpy(d_btree_map_internal_key(_map, _right, 0),
+               d_btree_map_internal_key(_map, _node, middle),
+               (capacity - middle) * _map->key_size);
+        memcpy(right_children,
+               &children[middle],
+               (capacity - middle + 1) * sizeof(struct d_btree_map_node*));
+
+        _right->count = (uint32_t)(capacity - middle);
+        _node->count  = (uint32_t)(middle - 1);
+
+        d_btree_map_internal_node_insert(_map, _node, _position, _key, _child);
+    }
+    else if (_position == middle)
+    {
+        memcpy(_out_up, _key, _map->key_size);
+        memcpy(d_btree_map_internal_key(_map, _right, 0),
+               d_btree_map_internal_key(_map, _node, middle),
+               (capacity - middle) * _map->key_size);
+        right_children[0] = _child;
+        memcpy(&right_children[1],
+               &children[middle + 1],
+               (capacity - middle) * sizeof(struct d_btree_map_node*));
+
+        _right->count = (uint32_t)(capacity - middle);
+        _node->count  = (uint32_t)middle;
+    }
+    else
+    {
+        memcpy(_out_up,
+               d_btree_map_internal_key(_map, _node, middle),
+               _map->key_size);
+        memcpy(d_btree_map_internal_key(_map, _right, 0),
+               d_btree_map_internal_key(_map, _node, middle + 1),
+               (capacity - middle - 1) * _map->key_size);
+        memcpy(right_children,
+               &children[middle + 1],
+               (capacity - middle) * sizeof(struct d_btree_map_node*));
+
+        _right->count = (uint32_t)(capacity - middle - 1);
+        _node->count  = (uint32_t)middle;
+
+        d_btree_map_internal_node_insert(_map,
+                                         _right,
+                                         _position - middle - 1,
+                                         _key,
+                                         _child);
+    }
+
+    return;
+}
+
+/*
+d_btree_map_internal_rebalance
+  Restores a node that fell below half capacity after a removal, by
+borrowing one entry from a sibling or, when both fit in one node, merging
+it with the sibling. Merging removes a separator from the parent, so the
+fix is repeated up the path. `_path[0.._depth)` are the ancestors of
+`_node`.
+*/
+static void
+d_btree_map_internal_rebalance
+(
+    struct d_btree_map*               _map,
+    struct d_btree_map_internal_step* _path,
+    size_t                            _depth,
+    struct d_btree_map_node*          _node
+)
+{
+    struct d_btree_map_node*  parent;
+    struct d_btree_map_node*  left;
+    struct d_btree_map_node*  right;
+    struct d_btree_map_node** children;
+    size_t                    capacity;
+    size_t                    index;
+    size_t                    separator;
+
+    capacity = _map->capacity;
+
+    while ( (_depth > 0) &&
+            (_node->count < capacity / 2) )
+    {
+        _depth--;
+        parent   = _path[_depth].node;
+        index    = _path[_depth].index;
+        children = d_btree_map_internal_children(_map, parent);
+
+        // work on the pair (left, right) = (node's left sibling, node) when
+        // there is one, otherwise (node, node's right sibling)
+        if (index > 0)
+        {
+            separator = index - 1;
+            left      = children[index - 1];
+            right     = _node;
+        }
+        else
+        {
+            separator = 0;
+            left      = _node;
+            right     = children[1];
+        }
+
+        if (_node->is_leaf)
+        {
+            void** left_values;
+            void** right_values;
+
+            left_values  = d_btree_map_internal_values(_map, left);
+            right_values = d_btree_map_internal_values(_map, right);
+
+            if (left->count + right->count <= capacity)
+            {
+                memcpy(d_btree_map_internal_key(_map, left, left->count),
+                       d_btree_map_internal_key(_map, right, 0),
+                       right->count * _map->key_size);
+                memcpy(&left_values[left->count],
+                       right_values,
+                       right->count * sizeof(void*));
+
+                left->count += right->count;
+                left->next   = right->next;
+
+                d_btree_map_internal_node_erase(_map, parent, separator);
+                d_btree_map_internal_node_free(right);
+            }
+            else if (right == _node)
+            {
+                // borrow the last entry of the left sibling
+                d_btree_map_internal_leaf_insert(
+                    _map,
+                    right,
+                    0,
+                    d_btree_map_internal_key(_map, left, left->count - 1),
+                    left_values[left->count - 1]);
+                left->count--;
+
+                memcpy(d_btree_map_internal_key(_map, parent, separator),
+                       d_btree_map_internal_key(_map, right, 0),
+                       _map->key_size);
+            }
+            else
+            {
+                // borrow the first entry of the right sibling
+                d_btree_map_internal_leaf_insert(
+                    _map,
+                    left,
+                    left->count,
+                    d_btree_map_internal_key(_map, right, 0),
+                    right_values[0]);
+                d_btree_map_internal_leaf_erase(_map, right, 0);
+
+                memcpy(d_btree_map_internal_key(_map, parent, separator),
+                       d_btree_map_internal_key(_map, right, 0),
+                       _map->key_size);
+            }
+        }
+        else
+        {
+            struct d_btree_map_node** left_children;
+            struct d_btree_map_node** right_children;
+
+            left_children  = d_btree_map_internal_children(_map, left);
+            right_children = d_btree_map_internal_children(_map, right);
+
+            if (left->count + right->count + 1 <= capacity)
+            {
+                // the parent's separator comes down between the two halves
+                memcpy(d_btree_map_internal_key(_map, left, left->count),
+                       d_btree_map_internal_key(_map, parent, separator),
+                       _map->key_size);
+                memcpy(d_btree_map_internal_key(_map, left, left->count + 1),
+                       d_btree_map_internal_key(_map, right, 0),
+                       right->count * _map->key_size);
+                memcpy(&left_children[left->count + 1],
+                       right_children,
+                       (right->count + 1) * sizeof(struct d_btree_map_node*));
+
+                left->count += right->count + 1;
+
+                d_btree_map_internal_node_erase(_map, parent, separator);
+                d_btree_map_internal_node_free(right);
+            }
+            else if (right == _node)
+            {
+                // rotate right: the separator moves down, left's last key up
+                memmove(d_btree_map_internal_key(_map, right, 1),
+                        d_btree_map_internal_key(_map, right, 0),
+                        right->count * _map->key_size);
+                memmove(&right_children[1],
+                        &right_children[0],
+                        (right->count + 1) * sizeof(struct d_btree_map_node*));
+
+                memcpy(d_btree_map_internal_key(_map, right, 0),
+                       d_btree_map_internal_key(_map, parent, separator),
+                       _map->key_size);
+                right_children[0] = left_children[left->count];
+                right->count++;
+
+                memcpy(d_btree_map_internal_key(_map, parent, separator),
+                       d_btree_map_internal_key(_map, left, left->count - 1),
+                       _map->key_size);
+                left->count--;
+            }
+            else
+            {
+                // rotate left: the separator moves down, right's first key up
+                memcpy(d_btree_map_internal_key(_map, left, left->count),
+                       d_btree_map_internal_key(_map, parent, separator),
+                       _map->key_size);
+                left_children[left->count + 1] = right_children[0];
+                left->count++;
+
+                memcpy(d_btree_map_internal_key(_map, parent, separator),
+                       d_btree_map_internal_key(_map, right, 0),
+                       _map->key_size);
+
+                memmove(d_btree_map_internal_key(_map, right, 0),
+                        d_btree_map_internal_key(_map, right, 1),
+                        (right->count - 1) * _map->key_size);
+                memmove(&right_children[0],
+                        &right_children[1],
+                        right->count * sizeof(struct d_btree_map_node*));
+                right->count--;
+            }
+        }
+
+        _node = parent;
+    }
+
+    // a root left without separators is replaced by its only child
+    while ( (!_map->root->is_leaf) &&
+            (_map->root->count == 0) )
+    {
+        parent     = _map->root;
+        _map->root = d_btree_map_internal_children(_map, parent)[0];
+        _map->height--;
+
+        d_btree_map_internal_node_free(parent);
+    }
+
+    return;
+}
+
+/*
+d_btree_map_internal_iterator_next
+  `next` callback of d_btree_map_iterator.
+*/
+static void*
+d_btree_map_internal_iterator_next
+(
+    struct d_iterator* _iterator
+)
+{
+    struct d_btree_map_internal_iterator_state* state;
+
+    state = (struct d_btree_map_internal_iterator_state*)_iterator->state;
+
+    if ( (!state) ||
+         (!d_btree_map_cursor_next(&state->cursor,
+                                   &state->entry.key,
+                                   &state->entry.value)) )
+    {
+        return NULL;
+    }
+
+    return &state->entry;
+}
+
+/*
+d_btree_map_internal_iterator_reset
+  `reset` callback of d_btree_map_iterator.
+*/
+static bool
+d_btree_map_internal_iterator_reset
+(
+    struct d_iterator* _iterator
+)
+{
+    struct d_btree_map_internal_iterator_state* state;
+    const char*                                 keys;
+
+    state = (struct d_btree_map_internal_iterator_state*)_iterator->state;
+
+    if (!state)
+    {
+        return false;
+    }
+
+    keys = (const char*)(state + 1);
+
+    return d_btree_map_range(state->cursor.map,
+                             (state->has_low) ? keys : NULL,
+                             (state->has_high)
+                                 ? keys + state->cursor.map->key_size
+                                 : NULL,
+                             &state->cursor);
+}
+
+/*
+d_btree_map_internal_iterator_destroy
+  `destroy` callback of d_btree_map_iterator.
+*/
+static void
+d_btree_map_internal_iterator_destroy
+(
+    struct d_iterator* _iterator
+)
+{
+    free(_iterator->state);
+    _iterator->state = NULL;
+
+    return;
+}
+
+
+// =============================================================================
+// constructor functions
+// =============================================================================
+
+/*
+d_btree_map_new
+  Creates an empty map whose keys are `_key_size`-byte values ordered by
+`_comparator`. The comparator receives pointers to two keys.
+
+Parameter(s):
+  _key_size:   size, in bytes, of one key
+  _comparator: ordering of keys
+Return:
+  - Pointer to the new map
+  - NULL if `_key_size` is 0, `_comparator` is NULL, or allocation fails
+*/
+struct d_btree_map*
+d_btree_map_new
+(
+    size_t        _key_size,
+    fn_comparator _comparator
+)
+{
+    if ( (_key_size == 0) ||
+         (!_comparator) )
+    {
+        return NULL;
+    }
+
+    return d_btree_map_internal_new(_key_size,
+                                    D_BTREE_MAP_KEY_COMPARATOR,
+                                    _comparator);
+}
+
+/*
+d_btree_map_new_keyed
+  Creates an empty map whose keys are integers of the type given by `_key`,
+compared directly.
+
+Parameter(s):
+  _key: integer key type; not D_BTREE_MAP_KEY_COMPARATOR
+Return:
+  - Pointer to the new map
+  - NULL if `_key` is not an integer kind, or allocation fails
+*/
+struct d_btree_map*
+d_btree_map_new_keyed
+(
+    enum d_btree_map_key _key
+)
+{
+    switch (_key)
+    {
+        case D_BTREE_MAP_KEY_INT32:
+        case D_BTREE_MAP_KEY_UINT32:
+            return d_btree_map_internal_new(sizeof(uint32_t), _key, NULL);
+
+        case D_BTREE_MAP_KEY_INT64:
+        case D_BTREE_MAP_KEY_UINT64:
+            return d_btree_map_internal_new(sizeof(uint64_t), _key, NULL);
+
+        case D_BTREE_MAP_KEY_COMPARATOR:
+        default:
+            return NULL;
+    }
+}
+
+
+// =============================================================================
+// element functions
+// =============================================================================
+
+/*
+d_btree_map_put
+  Maps `_key` to `_value`, replacing the value of an existing key. The key
+is copied into the tree. All nodes a split will need are allocated before
+the tree is changed, so a failed allocation leaves the map untouched.
+
+Parameter(s):
+  _map:   the map
+  _key:   pointer to the key
+  _value: value to store; may be NULL
+Return:
+  - true on success
+  - false if an argument is NULL, or allocation fails
+*/
+bool
+d_btree_map_put
+(
+    struct d_btree_map* _map,
+    const void*         _key,
+    void*               _value
+)
+{
+    struct d_btree_map_internal_step path[D_BTREE_MAP_MAX_HEIGHT];
+    struct d_btree_map_node*         spares[D_BTREE_MAP_MAX_HEIGHT + 1];
+    struct d_btree_map_node*         node;
+    struct d_btree_map_node*         right;
+    struct d_btree_map_node*         parent;
+    char*                            up;
+    char*                            carry;
+    char*                            swap;
+    size_t                           depth;
+    size_t                           needed;
+    size_t                           position;
+    size_t                           i;
+    bool                             rightmost;
+
+    if ( (!_map) ||
+         (!_key) )
+    {
+        return false;
+    }
+
+    // first key: a lone leaf
+    if (!_map->root)
+    {
+        node = d_btree_map_internal_node_new(_map, true);
+
+        if (!node)
+        {
+            return false;
+        }
+
+        d_btree_map_internal_leaf_insert(_map, node, 0, _key, _value);
+
+        _map->root   = node;
+        _map->first  = node;
+        _map->height = 1;
+        _map->count  = 1;
+
+        return true;
+    }
+
+    // descend, recording the path and whether it hugs the right edge
+    node      = _map->root;
+    depth     = 0;
+    rightmost = true;
+
+    while (!node->is_leaf)
+    {
+        i                  = d_btree_map_internal_bound(_map, node, _key, true);
+        path[depth].node   = node;
+        path[depth].index  = i;
+        depth++;
+        rightmost          = (rightmost) && (i == node->count);
+        node               = d_btree_map_internal_children(_map, node)[i];
+    }
+
+    position = d_btree_map_internal_bound(_map, node, _key, false);
+
+    if ( (position < node->count) &&
+         (d_btree_map_internal_compare(
+              _map,
+              d_btree_map_internal_key(_map, node, position),
+              _key) == 0) )
+    {
+        d_btree_map_internal_values(_map, node)[position] = _value;
+
+        return true;
+    }
+
+    if (node->count < _map->capacity)
+    {
+        d_btree_map_internal_leaf_insert(_map, node, position, _key, _value);
+        _map->count++;
+
+        return true;
+    }
+
+    // one new node per full level on the path, plus a root if all are full
+    needed = 1;
+
+    while ( (needed <= depth) &&
+            (path[depth - needed].node->count == _map->capacity) )
+    {
+        needed++;
+    }
+
+    if (needed > depth)
+    {
+        if (_map->height >= D_BTREE_MAP_MAX_HEIGHT)
+        {
+            return false;
+        }
+
+        needed++;
+    }
+
+    for (i = 0; i < needed; i++)
+    {
+        // the leaf's sibling is a leaf, every other new node internal
+        spares[i] = d_btree_map_internal_node_new(_map, (i == 0));
+
+        if (!spares[i])
+        {
+            while (i > 0)
+            {
+                d_btree_map_internal_node_free(spares[--i]);
+            }
+
+            return false;
+        }
+    }
+
+    right = spares[0];
+    d_btree_map_internal_split_leaf(_map,
+                                    node,
+                                    right,
+                                    position,
+                                    _key,
+                                    _value,
+                                    rightmost);
+    _map->count++;
+
+    // carry (separator, right node) up until a parent has room
+    carry = (char*)_map->scratch;
+    up    = carry + _map->key_size;
+    memcpy(carry, d_btree_map_internal_key(_map, right, 0), _map->key_size);
+    i = 1;
+
+    while (depth > 0)
+    {
+        depth--;
+        parent   = path[depth].node;
+        position = path[depth].index;
+
+        if (parent->count < _map->capacity)
+        {
+            d_btree_map_internal_node_insert(_map, parent, position, carry, right);
+
+            return true;
+        }
+
+        d_btree_map_internal_split_node(_map,
+                                        parent,
+                                        spares[i],
+                                        position,
+                                        carry,
+                                        right,
+                                        rightmost,
+                                        up);
+        right = spares[i++];
+        swap  = carry;
+        carry = up;
+        up    = swap;
+    }
+
+    // the root split: grow the tree by one level
+    node = spares[i];
+    memcpy(d_btree_map_internal_key(_map, node, 0), carry, _map->key_size);
+    d_btree_map_internal_children(_map, node)[0] = _map->root;
+    d_btree_map_internal_children(_map, node)[1] = right;
+    node->count = 1;
+
+    _map->root = node;
+    _map->height++;
+
+    return true;
+}
+
+/*
+d_btree_map_get
+  Looks up the value mapped to `_key`.
+
+Parameter(s):
+  _map: the map
+  _key: pointer to the key
+Return:
+  The value, or NULL if the key is absent or an argument is NULL. Use
+d_btree_map_contains to tell an absent key from a NULL value.
+*/
+void*
+d_btree_map_get
+(
+    const struct d_btree_map* _map,
+    const void*               _key
+)
+{
+    void** slot;
+
+    slot = d_btree_map_internal_find(_map, _key);
+
+    return (slot) ? *slot : NULL;
+}
+
+/*
+d_btree_map_contains
+  Tests whether `_key` is in the map.
+
+Parameter(s):
+  _map: the map
+  _key: pointer to the key
+Return:
+  - true if the key is present
+  - false otherwise, or if an argument is NULL
+*/
+bool
+d_btree_map_contains
+(
+    const struct d_btree_map* _map,
+    const void*               _key
+)
+{
+    return (d_btree_map_internal_find(_map, _key) != NULL);
+}
+
+/*
+d_btree_map_remove
+  Removes `_key` and its value. Nodes that fall below half full borrow from
+or merge with a sibling, and the tree loses a level when the root is left
+with a single child.
+
+Parameter(s):
+  _map: the map
+  _key: pointer to the key
+Return:
+  - true if the key was present
+  - false otherwise, or if an argument is NULL
+*/
+bool
+d_btree_map_remove
+(
+    struct d_btree_map* _map,
+    const void*         _key
+)
+{
+    struct d_btree_map_internal_step path[D_BTREE_MAP_MAX_HEIGHT];
+    struct d_btree_map_node*         node;
+    size_t                           depth;
+    size_t                           position;
+
+    if ( (!_map)       ||
+         (!_key)       ||
+         (!_map->root) )
+    {
+        return false;
+    }
+
+    node  = _map->root;
+    depth = 0;
+
+    while (!node->is_leaf)
+    {
+        path[depth].node  = node;
+        path[depth].index = d_btree_map_internal_bound(_map, node, _key, true);
+        node              = d_btree_map_internal_children(_map, node)
+                                [path[depth].index];
+        depth++;
+    }
+
+    position = d_btree_map_internal_bound(_map, node, _key, false);
+
+    if ( (position >= node->count) ||
+         (d_btree_map_internal_compare(
+              _map,
+              d_btree_map_internal_key(_map, node, position),
+              _key) != 0) )
+    {
+        return false;
+    }
+
+    d_btree_map_internal_leaf_erase(_map, node, position);
+    _map->count--;
+
+    if (_map->count == 0)
+    {
+        d_btree_map_internal_node_free(node);
+
+        _map->root   = NULL;
+        _map->first  = NULL;
+        _map->height = 0;
+
+        return true;
+    }
+
+    d_btree_map_internal_rebalance(_map, path, depth, node);
+
+    return true;
+}
+
+/*
+d_btree_map_bulk_load
+  Fills an empty map from keys in strictly ascending order, building the
+tree bottom-up: the entries are spread evenly over the fewest leaves that
+hold them, then each level of internal nodes is built the same way over
+the one below. No node is split, and every leaf ends up nearly full.
+
+Parameter(s):
+  _map:    the map; must be empty
+  _keys:   `_count` packed keys of the map's key size, strictly ascending
+  _values: `_count` values, or NULL to map every key to NULL
+  _count:  number of entries
+Return:
+  - true on success
+  - false if `_map` is NULL or not empty, `_keys` is NULL with a non-zero
+    count, the keys are not strictly ascending, or allocation fails; the
+    map is left empty
+*/
+bool
+d_btree_map_bulk_load
+(
+    struct d_btree_map* _map,
+    const void*         _keys,
+    void* const*        _values,
+    size_t              _count
+)
+{
+    struct d_btree_map_node** nodes;
+    const void**              lows;
+    struct d_btree_map_node*  node;
+    const char*               keys;
+    size_t                    level_count;
+    size_t                    parent_count;
+    size_t                    per_node;
+    size_t                    extra;
+    size_t                    start;
+    size_t                    take;
+    size_t                    height;
+    size_t                    i;
+    size_t                    j;
+
+    if ( (!_map)                   ||
+         (_map->count != 0)        ||
+         ( (!_keys) && (_count != 0) ) )
+    {
+        return false;
+    }
+
+    if (_count == 0)
+    {
+        return true;
+    }
+
+    keys = (const char*)_keys;
+
+    for (i = 1; i < _count; i++)
+    {
+        if (d_btree_map_internal_compare(_map,
+                                         keys + ((i - 1) * _map->key_size),
+                                         keys + (i * _map->key_size)) >= 0)
+        {
+            return false;
+        }
+    }
+
+    // level 0: leaves; `lows[k]` points to the smallest key under nodes[k]
+    level_count = (_count + _map->capacity - 1) / _map->capacity;
+    nodes       = malloc(level_count * sizeof(struct d_btree_map_node*));
+    lows        = malloc(level_count * sizeof(const void*));
+
+    if ( (!nodes) ||
+         (!lows) )
+    {
+        free(nodes);
+        free(lows);
+
+        return false;
+    }
+
+    per_node = _count / level_count;
+    extra    = _count % level_count;
+    start    = 0;
+
+    for (i = 0; i < level_count; i++)
+    {
+        node = d_btree_map_internal_node_new(_map, true);
+
+        if (!node)
+        {
+            while (i > 0)
+            {
+                d_btree_map_internal_node_free(nodes[--i]);
+            }
+
+            free(nodes);
+            free(lows);
+
+            return false;
+        }
+
+        take = per_node + ((i < extra) ? 1 : 0);
+
+        memcpy(d_btree_map_internal_key(_map, node, 0),
+               keys + (start * _map->key_size),
+               take * _map->key_size);
+
+        if (_values)
+        {
+            memcpy(d_btree_map_internal_values(_map, node),
+                   &_values[start],
+                   take * sizeof(void*));
+        }
+        else
+        {
+            for (j = 0; j < take; j++)
+            {
+                d_btree_map_internal_values(_map, node)[j] = NULL;
+            }
+        }
+
+        node->count = (uint32_t)take;
+
+        if (i > 0)
+        {
+            nodes[i - 1]->next = node;
+        }
+
+        nodes[i] = node;
+        lows[i]  = d_btree_map_internal_key(_map, node, 0);
+        start   += take;
+    }
+
+    _map->first = nodes[0];
+    height      = 1;
+
+    // internal levels, written in place over the level below
+    while (level_count > 1)
+    {
+        parent_count = (level_count + _map->capacity) / (_map->capacity + 1);
+        per_node     = level_count / parent_count;
+        extra        = level_count % parent_count;
+        start        = 0;
+
+        for (i = 0; i < parent_count; i++)
+        {
+            take = per_node + ((i < extra) ? 1 : 0);
+            node = d_btree_map_internal_node_new(_map, false);
+
+            if (!node)
+            {
+                // built parents own [0, i); unclaimed nodes are [start, end)
+                for (j = 0; j < i; j++)
+                {
+                    d_btree_map_internal_free_subtree(_map, nodes[j]);
+                }
+
+                for (j = start; j < level_count; j++)
+                {
+                    d_btree_map_internal_free_subtree(_map, nodes[j]);
+                }
+
+                free(nodes);
+                free(lows);
+
+                _map->first = NULL;
+
+                return false;
+            }
+
+            for (j = 0; j < take; j++)
+            {
+                d_btree_map_internal_children(_map, node)[j] = nodes[start + j];
+
+                if (j > 0)
+                {
+                    memcpy(d_btree_map_internal_key(_map, node, j - 1),
+                           lows[start + j],
+                           _map->key_size);
+                }
+            }
+
+            node->count = (uint32_t)(take - 1);
+            nodes[i]    = node;
+            lows[i]     = lows[start];
+            start      += take;
+        }
+
+        level_count = parent_count;
+        height++;
+    }
+
+    _map->root   = nodes[0];
+    _map->height = height;
+    _map->count  = _count;
+
+    free(nodes);
+    free(lows);
+
+    return true;
+}
+
+/*
+d_btree_map_clear
+  Removes every entry and frees every node.
+
+Parameter(s):
+  _map: the map
+Return:
+  - true on success
+  - false if `_map` is NULL
+*/
+bool
+d_btree_map_clear
+(
+    struct d_btree_map* _map
+)
+{
+    if (!_map)
+    {
+        return false;
+    }
+
+    d_btree_map_internal_free_subtree(_map, _map->root);
+
+    _map->root   = NULL;
+    _map->first  = NULL;
+    _map->count  = 0;
+    _map->height = 0;
+
+    return true;
+}
+
+
+// =============================================================================
+// query functions
+// =============================================================================
+
+/*
+d_btree_map_count
+  Returns the number of entries.
+
+Parameter(s):
+  _map: the map
+Return:
+  The number of entries, or 0 if `_map` is NULL.
+*/
+size_t
+d_btree_map_count
+(
+    const struct d_btree_map* _map
+)
+{
+    return (_map) ? _map->count : 0;
+}
+
+/*
+d_btree_map_is_empty
+  Tests whether the map holds no entry.
+
+Parameter(s):
+  _map: the map
+Return:
+  - true if the map is empty or NULL
+  - false otherwise
+*/
+bool
+d_btree_map_is_empty
+(
+    const struct d_btree_map* _map
+)
+{
+    return ( (!_map) ||
+             (_map->count == 0) );
+}
+
+/*
+d_btree_map_height
+  Returns the number of levels in the tree.
+
+Parameter(s):
+  _map: the map
+Return:
+  The height: 0 for an empty or NULL map, 1 when the root is a leaf.
+*/
+size_t
+d_btree_map_height
+(
+    const struct d_btree_map* _map
+)
+{
+    return (_map) ? _map->height : 0;
+}
+
+/*
+d_btree_map_first
+  Returns the smallest key.
+
+Parameter(s):
+  _map:       the map
+  _out_value: receives the key's value; may be NULL
+Return:
+  A pointer to the key inside the tree, or NULL if the map is empty or
+NULL.
+*/
+const void*
+d_btree_map_first
+(
+    const struct d_btree_map* _map,
+    void**                    _out_value
+)
+{
+    if ( (!_map) ||
+         (!_map->first) )
+    {
+        return NULL;
+    }
+
+    if (_out_value)
+    {
+        *_out_value = d_btree_map_internal_values(_map, _map->first)[0];
+    }
+
+    return d_btree_map_internal_key(_map, _map->first, 0);
+}
+
+/*
+d_btree_map_last
+  Returns the largest key.
+
+Parameter(s):
+  _map:       the map
+  _out_value: receives the key's value; may be NULL
+Return:
+  A pointer to the key inside the tree, or NULL if the map is empty or
+NULL.
+*/
+const void*
+d_btree_map_last
+(
+    const struct d_btree_map* _map,
+    void**                    _out_value
+)
+{
+    struct d_btree_map_node* node;
+
+    if ( (!_map) ||
+         (!_map->root) )
+    {
+        return NULL;
+    }
+
+    node = _map->root;
+
+    while (!node->is_leaf)
+    {
+        node = d_btree_map_internal_children(_map, node)[node->count];
+    }
+
+    if (_out_value)
+    {
+        *_out_value = d_btree_map_internal_values(_map, node)[node->count - 1];
+    }
+
+    return d_btree_map_internal_key(_map, node, node->count - 1);
+}
+
+
+// =============================================================================
+// range functions
+// =============================================================================
+
+/*
+d_btree_map_range
+  Positions a cursor on the first key >= `_low`, to yield keys up to but
+not including `_high`.
+
+Parameter(s):
+  _map:    the map
+  _low:    inclusive lower bound, or NULL to start at the smallest key
+  _high:   exclusive upper bound, or NULL for none; not copied
+  _cursor: cursor to position
+Return:
+  - true on success (the range may be empty)
+  - false if `_map` or `_cursor` is NULL
+*/
+bool
+d_btree_map_range
+(
+    const struct d_btree_map*  _map,
+    const void*                _low,
+    const void*                _high,
+    struct d_btree_map_cursor* _cursor
+)
+{
+    const struct d_btree_map_node* leaf;
+
+    if ( (!_map) ||
+         (!_cursor) )
+    {
+        return false;
+    }
+
+    _cursor->map   = _map;
+    _cursor->high  = _high;
+    _cursor->leaf  = NULL;
+    _cursor->index = 0;
+
+    if (!_map->root)
+    {
+        return true;
+    }
+
+    if (!_low)
+    {
+        _cursor->leaf = _map->first;
+
+        return true;
+    }
+
+    leaf           = d_btree_map_internal_find_leaf(_map, _low);
+    _cursor->leaf  = leaf;
+    _cursor->index = d_btree_map_internal_bound(_map, leaf, _low, false);
+
+    return true;
+}
+
+/*
+d_btree_map_cursor_next
+  Yields the entry under the cursor and advances it, following the leaf
+chain.
+
+Parameter(s):
+  _cursor:    a cursor from d_btree_map_range
+  _out_key:   receives a pointer to the key inside the tree; may be NULL
+  _out_value: receives the value; may be NULL
+Return:
+  - true if an entry was yielded
+  - false once the range is exhausted, or if `_cursor` is NULL
+*/
+bool
+d_btree_map_cursor_next
+(
+    struct d_btree_map_cursor* _cursor,
+    const void**               _out_key,
+    void**                     _out_value
+)
+{
+    const char* key;
+
+    if ( (!_cursor) ||
+         (!_cursor->leaf) )
+    {
+        return false;
+    }
+
+    while (_cursor->index >= _cursor->leaf->count)
+    {
+        _cursor->leaf  = _cursor->leaf->next;
+        _cursor->index = 0;
+
+        if (!_cursor->leaf)
+        {
+            return false;
+        }
+    }
+
+    key = d_btree_map_internal_key(_cursor->map, _cursor->leaf, _cursor->index);
+
+    if ( (_cursor->high) &&
+         (d_btree_map_internal_compare(_cursor->map, key, _cursor->high) >= 0) )
+    {
+        _cursor->leaf = NULL;
+
+        return false;
+    }
+
+    if (_out_key)
+    {
+        *_out_key = key;
+    }
+
+    if (_out_value)
+    {
+        *_out_value = d_btree_map_internal_values(_cursor->map,
+                                                  _cursor->leaf)[_cursor->index];
+    }
+
+    _cursor->index++;
+
+    return true;
+}
+
+/*
+d_btree_map_iterator
+  Creates an iterator over the keys in [`_low`, `_high`) that yields
+`struct d_btree_map_entry` pointers. The bounds are copied, and `reset`
+rewinds to `_low`. The entry pointer stays the same across calls and is
+overwritten by each `next`.
+
+Parameter(s):
+  _map:  the map
+  _low:  inclusive lower bound, or NULL to start at the smallest key
+  _high: exclusive upper bound, or NULL for none
+Return:
+  The iterator; release it with its `destroy` callback. If `_map` is NULL
+or allocation fails, its state is NULL and it yields nothing.
+*/
+struct d_iterator
+d_btree_map_iterator
+(
+    const struct d_btree_map* _map,
+    const void*               _low,
+    const void*               _high
+)
+{
+    struct d_iterator                           iterator;
+    struct d_btree_map_internal_iterator_state* state;
+    char*                                       keys;
+
+    iterator.state        = NULL;
+    iterator.element_size = sizeof(struct d_btree_map_entry);
+    iterator.next         = d_btree_map_internal_iterator_next;
+    iterator.reset        = d_btree_map_internal_iterator_reset;
+    iterator.destroy      = d_btree_map_internal_iterator_destroy;
+
+    if (!_map)
+    {
+        return iterator;
+    }
+
+    state = malloc(sizeof(struct d_btree_map_internal_iterator_state) +
+                   (2 * _map->key_size));
+
+    if (!state)
+    {
+        return iterator;
+    }
+
+    keys            = (char*)(state + 1);
+    state->has_low  = (_low != NULL);
+    state->has_high = (_high != NULL);
+
+    if (_low)
+    {
+        memcpy(keys, _low, _map->key_size);
+    }
+
+    if (_high)
+    {
+        memcpy(keys + _map->key_size, _high, _map->key_size);
+    }
+
+    d_btree_map_range(_map,
+                      (_low) ? keys : NULL,
+                      (_high) ? keys + _map->key_size : NULL,
+                      &state->cursor);
+
+    iterator.state = state;
+
+    return iterator;
+}
+
+
+// =============================================================================
+// memory management
+// =============================================================================
+
+/*
+d_btree_map_free
+  Frees a map and all its nodes. Values are not freed.
+
+Parameter(s):
+  _map: the map; may be NULL
+Return:
+  none
+*/
+void
+d_btree_map_free
+(
+    struct d_btree_map* _map
+)
+{
+    if (!_map)
+    {
+        return;
+    }
+
+    d_btree_map_clear(_map);
+    free(_map->scratch);
+    free(_map);
+
+    return;
+}
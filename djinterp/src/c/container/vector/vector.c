@@ -791,6 +791,428 @@ d_vector_clear
 }
 
 
+// =============================================================================
+// batch edit functions
+// =============================================================================
+
+/*
+d_vector_apply_edits
+  Applies a batch of inserts and erases, sorted by their index in the
+vector as it was before the batch, in a single pass. See
+d_vector_common_apply_edits for the ordering rules.
+
+Parameter(s):
+  _vector:     pointer to the `d_vector` to modify
+  _edits:      edits sorted by original index
+  _edit_count: number of edits
+Return:
+  A boolean value corresponding to either:
+  - true, if every edit was applied, or
+  - false, if the edits are invalid, memory allocation failed, or _vector
+    is NULL (the vector is unchanged).
+*/
+bool
+d_vector_apply_edits
+(
+    struct d_vector*            _vector,
+    const struct d_vector_edit* _edits,
+    size_t                      _edit_count
+)
+{
+    if (!_vector)
+    {
+        return D_FAILURE;
+    }
+
+    return d_vector_common_apply_edits(&_vector->elements,
+                                       &_vector->count,
+                                       &_vector->capacity,
+                                       _vector->element_size,
+                                       _edits,
+                                       _edit_count);
+}
+
+
+// =============================================================================
+// gap buffer functions
+// =============================================================================
+
+/*
+d_vector_gap_internal_slot
+  Address of physical slot `_slot` of the vector under a gap session.
+*/
+D_STATIC_INLINE char*
+d_vector_gap_internal_slot
+(
+    const struct d_vector_gap* _gap,
+    size_t                     _slot
+)
+{
+    return (char*)_gap->vector->elements +
+           (_slot * _gap->vector->element_size);
+}
+
+/*
+d_vector_gap_internal_widen
+  Grows the vector's capacity so the gap holds at least `_required`
+elements, moving the part after the gap to the new end of the buffer.
+*/
+static bool
+d_vector_gap_internal_widen
+(
+    struct d_vector_gap* _gap,
+    size_t               _required
+)
+{
+    struct d_vector* vector;
+    size_t           after;
+
+    vector = _gap->vector;
+    after  = vector->capacity - _gap->gap_end;
+
+    if (_required > SIZE_MAX - vector->count)
+    {
+        return D_FAILURE;
+    }
+
+    if (!d_vector_common_ensure_capacity(&vector->elements,
+                                         vector->count,
+                                         &vector->capacity,
+                                         vector->element_size,
+                                         vector->count + _required))
+    {
+        return D_FAILURE;
+    }
+
+    if (after > 0)
+    {
+        memmove(d_vector_gap_internal_slot(_gap, vector->capacity - after),
+                d_vector_gap_internal_slot(_gap, _gap->gap_end),
+                after * vector->element_size);
+    }
+
+    _gap->gap_end = vector->capacity - after;
+
+    return D_SUCCESS;
+}
+
+/*
+d_vector_gap_begin
+  Opens a gap-buffer session on a vector with the cursor at `_cursor`. The
+elements from the cursor onward are moved once to the end of the buffer.
+
+Parameter(s):
+  _gap:    session to initialize
+  _vector: pointer to the `d_vector` to edit
+  _cursor: initial cursor position, from 0 to the vector's count
+Return:
+  A boolean value corresponding to either:
+  - true, if the session was opened, or
+  - false, if _cursor is past the end or parameters are invalid.
+*/
+bool
+d_vector_gap_begin
+(
+    struct d_vector_gap* _gap,
+    struct d_vector*     _vector,
+    size_t               _cursor
+)
+{
+    size_t after;
+
+    if ( (!_gap)                       ||
+         (!_vector)                    ||
+         (_cursor > _vector->count) )
+    {
+        return D_FAILURE;
+    }
+
+    _gap->vector    = _vector;
+    _gap->gap_start = _cursor;
+    _gap->gap_end   = _vector->capacity - (_vector->count - _cursor);
+    after           = _vector->count - _cursor;
+
+    if ( (after > 0) &&
+         (_gap->gap_end != _cursor) )
+    {
+        memmove(d_vector_gap_internal_slot(_gap, _gap->gap_end),
+                d_vector_gap_internal_slot(_gap, _cursor),
+                after * _vector->element_size);
+    }
+
+    return D_SUCCESS;
+}
+
+/*
+d_vector_gap_move
+  Moves the cursor. Only the elements between the old and new cursor are
+moved.
+
+Parameter(s):
+  _gap:    open session
+  _cursor: new cursor position, from 0 to the vector's count
+Return:
+  A boolean value corresponding to either:
+  - true, if the cursor was moved, or
+  - false, if _cursor is past the end or the session is not open.
+*/
+bool
+d_vector_gap_move
+(
+    struct d_vector_gap* _gap,
+    size_t               _cursor
+)
+{
+    size_t distance;
+
+    if ( (!_gap)                           ||
+         (!_gap->vector)                   ||
+         (_cursor > _gap->vector->count) )
+    {
+        return D_FAILURE;
+    }
+
+    if (_cursor < _gap->gap_start)
+    {
+        // elements [cursor, gap_start) move to just before gap_end
+        distance = _gap->gap_start - _cursor;
+
+        memmove(d_vector_gap_internal_slot(_gap, _gap->gap_end - distance),
+                d_vector_gap_internal_slot(_gap, _cursor),
+                distance * _gap->vector->element_size);
+
+        _gap->gap_start  = _cursor;
+        _gap->gap_end   -= distance;
+    }
+    else if (_cursor > _gap->gap_start)
+    {
+        // elements just after the gap move to its start
+        distance = _cursor - _gap->gap_start;
+
+        memmove(d_vector_gap_internal_slot(_gap, _gap->gap_start),
+                d_vector_gap_internal_slot(_gap, _gap->gap_end),
+                distance * _gap->vector->element_size);
+
+        _gap->gap_start  = _cursor;
+        _gap->gap_end   += distance;
+    }
+
+    return D_SUCCESS;
+}
+
+/*
+d_vector_gap_insert
+  Inserts elements at the cursor and advances the cursor past them. Grows
+the vector when the gap is too small.
+
+Parameter(s):
+  _gap:    open session
+  _source: elements to insert; must not point into the vector
+  _count:  number of elements
+Return:
+  A boolean value corresponding to either:
+  - true, if the elements were inserted, or
+  - false, if reallocation failed or parameters are invalid.
+*/
+bool
+d_vector_gap_insert
+(
+    struct d_vector_gap* _gap,
+    const void*          _source,
+    size_t               _count
+)
+{
+    if ( (!_gap)         ||
+         (!_gap->vector) ||
+         ( (_count > 0) && (!_source) ) )
+    {
+        return D_FAILURE;
+    }
+
+    if (_count == 0)
+    {
+        return D_SUCCESS;
+    }
+
+    if ( (_gap->gap_end - _gap->gap_start < _count) &&
+         (!d_vector_gap_internal_widen(_gap, _count)) )
+    {
+        return D_FAILURE;
+    }
+
+    memcpy(d_vector_gap_internal_slot(_gap, _gap->gap_start),
+           _source,
+           _count * _gap->vector->element_size);
+
+    _gap->gap_start     += _count;
+    _gap->vector->count += _count;
+
+    return D_SUCCESS;
+}
+
+/*
+d_vector_gap_erase_before
+  Erases elements immediately before the cursor (like backspace).
+
+Parameter(s):
+  _gap:   open session
+  _count: number of elements to erase
+Return:
+  A boolean value corresponding to either:
+  - true, if the elements were erased, or
+  - false, if fewer than `_count` elements precede the cursor or the
+    session is not open.
+*/
+bool
+d_vector_gap_erase_before
+(
+    struct d_vector_gap* _gap,
+    size_t               _count
+)
+{
+    if ( (!_gap)                      ||
+         (!_gap->vector)              ||
+         (_count > _gap->gap_start) )
+    {
+        return D_FAILURE;
+    }
+
+    _gap->gap_start     -= _count;
+    _gap->vector->count -= _count;
+
+    return D_SUCCESS;
+}
+
+/*
+d_vector_gap_erase_after
+  Erases elements immediately after the cursor (like delete).
+
+Parameter(s):
+  _gap:   open session
+  _count: number of elements to erase
+Return:
+  A boolean value corresponding to either:
+  - true, if the elements were erased, or
+  - false, if fewer than `_count` elements follow the cursor or the
+    session is not open.
+*/
+bool
+d_vector_gap_erase_after
+(
+    struct d_vector_gap* _gap,
+    size_t               _count
+)
+{
+    if ( (!_gap)                                                ||
+         (!_gap->vector)                                        ||
+         (_count > _gap->vector->capacity - _gap->gap_end) )
+    {
+        return D_FAILURE;
+    }
+
+    _gap->gap_end       += _count;
+    _gap->vector->count -= _count;
+
+    return D_SUCCESS;
+}
+
+/*
+d_vector_gap_at
+  Returns a pointer to the element at logical index `_index`, skipping the
+gap.
+
+Parameter(s):
+  _gap:   open session
+  _index: logical index, less than the vector's count
+Return:
+  A pointer to either:
+  - the element, or
+  - NULL, if _index is out of range or the session is not open.
+*/
+void*
+d_vector_gap_at
+(
+    const struct d_vector_gap* _gap,
+    size_t                     _index
+)
+{
+    if ( (!_gap)                          ||
+         (!_gap->vector)                  ||
+         (_index >= _gap->vector->count) )
+    {
+        return NULL;
+    }
+
+    if (_index >= _gap->gap_start)
+    {
+        _index += _gap->gap_end - _gap->gap_start;
+    }
+
+    return d_vector_gap_internal_slot(_gap, _index);
+}
+
+/*
+d_vector_gap_cursor
+  Returns the cursor position.
+
+Parameter(s):
+  _gap: open session
+Return:
+  The number of elements before the cursor, or 0 if _gap is NULL.
+*/
+size_t
+d_vector_gap_cursor
+(
+    const struct d_vector_gap* _gap
+)
+{
+    return (_gap) ? _gap->gap_start : 0;
+}
+
+/*
+d_vector_gap_end
+  Closes the session: the elements after the gap are moved back so the
+vector is contiguous again and can be used normally.
+
+Parameter(s):
+  _gap: open session
+Return:
+  A boolean value corresponding to either:
+  - true, if the session was closed, or
+  - false, if the session is not open.
+*/
+bool
+d_vector_gap_end
+(
+    struct d_vector_gap* _gap
+)
+{
+    size_t after;
+
+    if ( (!_gap) ||
+         (!_gap->vector) )
+    {
+        return D_FAILURE;
+    }
+
+    after = _gap->vector->capacity - _gap->gap_end;
+
+    if ( (after > 0) &&
+         (_gap->gap_end != _gap->gap_start) )
+    {
+        memmove(d_vector_gap_internal_slot(_gap, _gap->gap_start),
+                d_vector_gap_internal_slot(_gap, _gap->gap_end),
+                after * _gap->vector->element_size);
+    }
+
+    _gap->vector    = NULL;
+    _gap->gap_start = 0;
+    _gap->gap_end   = 0;
+
+    return D_SUCCESS;
+}
+
+
 // =============================================================================
 // append/prepend functions
 // =============================================================================
@@ -1618,6 +2040,203 @@ d_vector_sort
     return;
 }
 
+/*
+d_vector_sort_keyed
+  Stably sorts the elements by a numeric key stored inside each element,
+using a radix sort instead of comparator calls.
+
+Parameter(s):
+  _vector:     pointer to the `d_vector` to sort
+  _key:        type of the key
+  _key_offset: byte offset of the key within an element
+Return:
+  - true if the vector is sorted
+  - false if parameters are invalid or scratch memory could not be
+    allocated (the vector is unchanged)
+*/
+bool
+d_vector_sort_keyed
+(
+    struct d_vector*      _vector,
+    enum d_array_sort_key _key,
+    size_t                _key_offset
+)
+{
+    if (!_vector)
+    {
+        return false;
+    }
+
+    if (_vector->count <= 1)
+    {
+        return true;
+    }
+
+    return d_array_sort_keyed(_vector->elements,
+                              _vector->count,
+                              _vector->element_size,
+                              _key,
+                              _key_offset);
+}
+
+/*
+d_vector_sort_parallel
+  Sorts the elements on several threads. Small vectors are sorted on the
+calling thread.
+
+Parameter(s):
+  _vector:     pointer to the `d_vector` to sort
+  _comparator: function to compare elements; called concurrently
+  _mode:       D_ARRAY_SORT_STABLE or D_ARRAY_SORT_UNSTABLE
+  _threads:    maximum number of threads, or 0 for one per hardware thread
+Return:
+  - true if the vector is sorted
+  - false if parameters are invalid or a stable sort could not allocate
+    scratch memory (the vector is unchanged)
+*/
+bool
+d_vector_sort_parallel
+(
+    struct d_vector*       _vector,
+    fn_comparator          _comparator,
+    enum d_array_sort_mode _mode,
+    size_t                 _threads
+)
+{
+    if ( (!_vector) ||
+         (!_comparator) )
+    {
+        return false;
+    }
+
+    if (_vector->count <= 1)
+    {
+        return true;
+    }
+
+    return d_array_sort_parallel(_vector->elements,
+                                 _vector->count,
+                                 _vector->element_size,
+                                 _comparator,
+                                 _mode,
+                                 _threads);
+}
+
+/*
+d_vector_merge_sorted
+  Merges k vectors, each already sorted by `_comparator`, into a new sorted
+vector. The inputs are copied end to end and merged pairwise in parallel
+rounds; equal elements keep their order, with ties going to the vector that
+comes first in `_vectors`. The inputs are not modified.
+
+Parameter(s):
+  _vectors:      array of pointers to the sorted vectors; NULL entries are
+                 skipped
+  _vector_count: number of entries in `_vectors`
+  _comparator:   ordering the vectors are sorted by; called concurrently
+  _threads:      maximum number of threads, or 0 for one per hardware thread
+Return:
+  A pointer to either:
+  - a newly allocated `d_vector` holding every element in sorted order, or
+  - NULL, if parameters are invalid, the element sizes differ, or memory
+    allocation failed.
+*/
+struct d_vector*
+d_vector_merge_sorted
+(
+    const struct d_vector* const* _vectors,
+    size_t                        _vector_count,
+    fn_comparator                 _comparator,
+    size_t                        _threads
+)
+{
+    struct d_vector* result;
+    size_t*          run_ends;
+    size_t           element_size;
+    size_t           total;
+    size_t           runs;
+    size_t           i;
+
+    if ( (!_vectors)           ||
+         (_vector_count == 0)  ||
+         (!_comparator) )
+    {
+        return NULL;
+    }
+
+    element_size = 0;
+    total        = 0;
+
+    for (i = 0; i < _vector_count; i++)
+    {
+        if (!_vectors[i])
+        {
+            continue;
+        }
+
+        if ( (element_size != 0) &&
+             (_vectors[i]->element_size != element_size) )
+        {
+            return NULL;
+        }
+
+        element_size  = _vectors[i]->element_size;
+        total        += _vectors[i]->count;
+    }
+
+    if (element_size == 0)
+    {
+        return NULL;
+    }
+
+    result   = d_vector_new(element_size, total);
+    run_ends = malloc(_vector_count * sizeof(size_t));
+
+    if ( (!result) ||
+         (!run_ends) )
+    {
+        d_vector_free(result);
+        free(run_ends);
+
+        return NULL;
+    }
+
+    runs = 0;
+
+    for (i = 0; i < _vector_count; i++)
+    {
+        if ( (!_vectors[i]) ||
+             (_vectors[i]->count == 0) )
+        {
+            continue;
+        }
+
+        memcpy((char*)result->elements + (result->count * element_size),
+               _vectors[i]->elements,
+               _vectors[i]->count * element_size);
+
+        result->count  += _vectors[i]->count;
+        run_ends[runs++] = result->count;
+    }
+
+    if (!d_array_merge_runs_parallel(result->elements,
+                                     element_size,
+                                     run_ends,
+                                     runs,
+                                     _comparator,
+                                     _threads))
+    {
+        d_vector_free(result);
+        free(run_ends);
+
+        return NULL;
+    }
+
+    free(run_ends);
+
+    return result;
+}
+
 /*
 d_vector_copy_to
   Copies the vector's elements to a destination buffer.
@@ -1238,6 +1238,284 @@ d_vector_common_erase_range
 }
 
 
+/*
+d_vector_common_apply_edits
+  Applies a batch of positional inserts and erases in one pass over the
+elements, so each surviving element moves at most once no matter how many
+edits there are (O(n + k) instead of O(n * k) for k separate calls).
+  Edits must be sorted by `index`, which refers to the vector before the
+batch; erased ranges must not overlap each other or any later edit.
+Several edits may share an index and are applied in list order.
+  The pass runs in place front to back when the element count never rises
+above its original value part-way through the batch, and back to front
+(after growing the capacity once) when it never drops below it. Otherwise
+the result is assembled in a new buffer.
+
+Parameter(s):
+  _elements:     pointer to elements pointer (may be reallocated)
+  _count:        pointer to count variable (updated on success)
+  _capacity:     pointer to capacity variable (may be updated)
+  _element_size: size in bytes of each element
+  _edits:        edits sorted by index; insert sources must not point into
+                 the vector
+  _edit_count:   number of edits
+Return:
+  A boolean value corresponding to either:
+  - true, if every edit was applied, or
+  - false, if the edits are unsorted, overlap or out of range, memory
+    allocation failed, or parameters are invalid (nothing is changed).
+*/
+bool
+d_vector_common_apply_edits
+(
+    void**                      _elements,
+    size_t*                     _count,
+    size_t*                     _capacity,
+    size_t                      _element_size,
+    const struct d_vector_edit* _edits,
+    size_t                      _edit_count
+)
+{
+    char*  base;
+    char*  target;
+    size_t new_count;
+    size_t minimum;
+    size_t read;
+    size_t write;
+    size_t start;
+    size_t length;
+    size_t i;
+    bool   grows;
+    bool   shrinks;
+
+    if ( (!_elements)     ||
+         (!_count)        ||
+         (!_capacity)     ||
+         (!_element_size) ||
+         ( (_edit_count > 0) && (!_edits) ) )
+    {
+        return D_FAILURE;
+    }
+
+    // validate, and track the running count to choose a direction: the
+    // count after each edit is compared with the original
+    new_count = *(_count);
+    minimum   = 0;
+    grows     = false;
+    shrinks   = false;
+
+    for (i = 0; i < _edit_count; i++)
+    {
+        if (_edits[i].index < minimum)
+        {
+            return D_FAILURE;
+        }
+
+        switch (_edits[i].kind)
+        {
+            case D_VECTOR_EDIT_INSERT:
+                if ( (_edits[i].index > *(_count)) ||
+                     ( (_edits[i].count > 0) && (!_edits[i].elements) ) ||
+                     (_edits[i].count > SIZE_MAX - new_count) )
+                {
+                    return D_FAILURE;
+                }
+
+                new_count += _edits[i].count;
+                minimum    = _edits[i].index;
+
+                break;
+
+            case D_VECTOR_EDIT_ERASE:
+                if ( (_edits[i].index > *(_count)) ||
+                     (_edits[i].count > *(_count) - _edits[i].index) )
+                {
+                    return D_FAILURE;
+                }
+
+                new_count -= _edits[i].count;
+                minimum    = _edits[i].index + _edits[i].count;
+
+                break;
+
+            default:
+                return D_FAILURE;
+        }
+
+        grows   = grows   || (new_count > *(_count));
+        shrinks = shrinks || (new_count < *(_count));
+    }
+
+    if (_edit_count == 0)
+    {
+        return D_SUCCESS;
+    }
+
+    // never longer than the original at any point: compact front to back
+    if (!grows)
+    {
+        base  = (char*)*(_elements);
+        read  = 0;
+        write = 0;
+
+        for (i = 0; i < _edit_count; i++)
+        {
+            length = _edits[i].index - read;
+
+            if ( (length > 0) &&
+                 (write != read) )
+            {
+                memmove(base + (write * _element_size),
+                        base + (read * _element_size),
+                        length * _element_size);
+            }
+
+            write += length;
+            read   = _edits[i].index;
+
+            if (_edits[i].kind == D_VECTOR_EDIT_INSERT)
+            {
+                if (_edits[i].count > 0)
+                {
+                    memcpy(base + (write * _element_size),
+                           _edits[i].elements,
+                           _edits[i].count * _element_size);
+                }
+
+                write += _edits[i].count;
+            }
+            else
+            {
+                read += _edits[i].count;
+            }
+        }
+
+        if ( (read < *(_count)) &&
+             (write != read) )
+        {
+            memmove(base + (write * _element_size),
+                    base + (read * _element_size),
+                    (*(_count) - read) * _element_size);
+        }
+
+        *(_count) = new_count;
+
+        return D_SUCCESS;
+    }
+
+    // never shorter than the original at any point: grow once, then fill
+    // from the back so nothing is overwritten before it has been moved
+    if (!shrinks)
+    {
+        if (!d_vector_common_ensure_capacity(_elements,
+                                             *(_count),
+                                             _capacity,
+                                             _element_size,
+                                             new_count))
+        {
+            return D_FAILURE;
+        }
+
+        base  = (char*)*(_elements);
+        read  = *(_count);
+        write = new_count;
+
+        for (i = _edit_count; i-- > 0; )
+        {
+            start = (_edits[i].kind == D_VECTOR_EDIT_ERASE)
+                        ? _edits[i].index + _edits[i].count
+                        : _edits[i].index;
+
+            length  = read - start;
+            write  -= length;
+
+            if ( (length > 0) &&
+                 (write != start) )
+            {
+                memmove(base + (write * _element_size),
+                        base + (start * _element_size),
+                        length * _element_size);
+            }
+
+            read = _edits[i].index;
+
+            if (_edits[i].kind == D_VECTOR_EDIT_INSERT)
+            {
+                write -= _edits[i].count;
+
+                if (_edits[i].count > 0)
+                {
+                    memcpy(base + (write * _element_size),
+                           _edits[i].elements,
+                           _edits[i].count * _element_size);
+                }
+            }
+        }
+
+        *(_count) = new_count;
+
+        return D_SUCCESS;
+    }
+
+    // mixed: assemble into a fresh buffer front to back
+    target = malloc(((new_count > *(_capacity)) ? new_count : *(_capacity)) *
+                    _element_size);
+
+    if (!target)
+    {
+        return D_FAILURE;
+    }
+
+    base  = (char*)*(_elements);
+    read  = 0;
+    write = 0;
+
+    for (i = 0; i < _edit_count; i++)
+    {
+        length = _edits[i].index - read;
+
+        memcpy(target + (write * _element_size),
+               base + (read * _element_size),
+               length * _element_size);
+
+        write += length;
+        read   = _edits[i].index;
+
+        if (_edits[i].kind == D_VECTOR_EDIT_INSERT)
+        {
+            if (_edits[i].count > 0)
+            {
+                memcpy(target + (write * _element_size),
+                       _edits[i].elements,
+                       _edits[i].count * _element_size);
+            }
+
+            write += _edits[i].count;
+        }
+        else
+        {
+            read += _edits[i].count;
+        }
+    }
+
+    memcpy(target + (write * _element_size),
+           base + (read * _element_size),
+           (*(_count) - read) * _element_size);
+
+    if (new_count > *(_capacity))
+    {
+        *(_capacity) = new_count;
+    }
+
+    free(*(_elements));
+
+    *(_elements) = target;
+    *(_count)    = new_count;
+
+    return D_SUCCESS;
+}
+
+
 // =============================================================================
 // append/extend functions
 // =============================================================================
@@ -0,0 +1,1448 @@
+/******************************************************************************
+* djinterp [core]                                                       daio.c
+*
+* Implementation of the asynchronous file I/O engine: an io_uring backend
+* (Linux, raw system calls) and a dmutex.h thread-pool backend.
+*
+* path:      \src\daio.c
+* link:      TBA
+* author(s): Samuel 'teer' Neal-Blim                          date: 2026.10.18
+******************************************************************************/
+#include "..\..\inc\c\daio.h"
+#include "..\..\inc\c\dmutex.h"
+#include "..\..\inc\c\event\event_handler.h"
+
+#if D_AIO_HAS_IO_URING
+    #include <sys/mman.h>
+    #include <sys/syscall.h>
+    #include <linux/io_uring.h>
+#endif
+
+
+///////////////////////////////////////////////////////////////////////////////
+///             INTERNAL DEFINITIONS                                        ///
+///////////////////////////////////////////////////////////////////////////////
+
+// d_internal_aio_list
+//   type: intrusive FIFO of requests, linked through d_aio_request.next.
+struct d_internal_aio_list
+{
+    struct d_aio_request* head;
+    struct d_aio_request* tail;
+    size_t                count;
+};
+
+#if D_AIO_HAS_IO_URING
+
+// d_internal_aio_ring
+//   type: the three shared-memory regions of an io_uring instance and the
+// pointers into them. The kernel advances sq_head and cq_tail; this side
+// advances sq_tail and cq_head.
+struct d_internal_aio_ring
+{
+    int                  fd;
+    unsigned             sq_entries;
+    unsigned             cq_entries;
+    unsigned*            sq_head;
+    unsigned*            sq_tail;
+    unsigned*            sq_mask;
+    unsigned*            sq_array;
+    unsigned*            cq_head;
+    unsigned*            cq_tail;
+    unsigned*            cq_mask;
+    struct io_uring_sqe* sqes;
+    struct io_uring_cqe* cqes;
+    void*                sq_ptr;
+    size_t               sq_size;
+    void*                cq_ptr;
+    size_t               cq_size;
+    size_t               sqes_size;
+    unsigned             to_submit;     // SQEs written, not yet entered
+};
+
+#endif  // D_AIO_HAS_IO_URING
+
+// internal engine structure
+struct d_aio_engine
+{
+    int                        backend;
+    size_t                     in_flight;   // submitted, not yet completed
+    struct d_internal_aio_list done;        // completed, not yet delivered
+    struct d_internal_aio_list unclaimed;   // delivered, awaiting d_aio_next
+    struct d_event_handler*    handler;
+    d_event_id                 event_id;
+
+#if D_AIO_HAS_IO_URING
+    struct d_internal_aio_ring ring;
+#endif
+
+    // thread-pool backend; `in_flight`, `done` and `work` are guarded by
+    // `lock` in this mode
+    d_mutex_t                  lock;
+    d_cond_t                   work_ready;
+    d_cond_t                   done_ready;
+    struct d_internal_aio_list work;
+    d_thread_t*                threads;
+    size_t                     thread_count;
+    bool                       stopping;
+};
+
+
+/*
+d_internal_aio_list_push
+  Appends a request to the tail of a list.
+*/
+static void
+d_internal_aio_list_push
+(
+    struct d_internal_aio_list* _list,
+    struct d_aio_request*       _request
+)
+{
+    _request->next = NULL;
+
+    if (_list->tail)
+    {
+        _list->tail->next = _request;
+    }
+    else
+    {
+        _list->head = _request;
+    }
+
+    _list->tail = _request;
+    _list->count++;
+
+    return;
+}
+
+
+/*
+d_internal_aio_list_pop
+  Removes and returns the head of a list, or NULL if it is empty.
+*/
+static struct d_aio_request*
+d_internal_aio_list_pop
+(
+    struct d_internal_aio_list* _list
+)
+{
+    struct d_aio_request* request;
+
+    request = _list->head;
+
+    if (request)
+    {
+        _list->head = request->next;
+
+        if (!_list->head)
+        {
+            _list->tail = NULL;
+        }
+
+        request->next = NULL;
+        _list->count--;
+    }
+
+    return request;
+}
+
+
+/*
+d_internal_aio_deliver
+  Hands one completed request to its consumer: the request's callback if it
+has one, otherwise the attached event handler's queue (as an event whose
+`args` is the request), otherwise the d_aio_next list.
+*/
+static void
+d_internal_aio_deliver
+(
+    struct d_aio_engine*  _engine,
+    struct d_aio_request* _request
+)
+{
+    struct d_event event;
+
+    if (_request->callback)
+    {
+        _request->callback(_request, _request->user_data);
+
+        return;
+    }
+
+    if (_engine->handler)
+    {
+        event.id       = _engine->event_id;
+        event.args     = _request;
+        event.num_args = 1;
+
+        // queued for d_event_handler_process_events
+        if (d_event_handler_queue_event(_engine->handler, &event))
+        {
+            return;
+        }
+    }
+
+    d_internal_aio_list_push(&_engine->unclaimed, _request);
+
+    return;
+}
+
+
+///////////////////////////////////////////////////////////////////////////////
+///             SYNCHRONOUS EXECUTION (THREAD-POOL BACKEND)                 ///
+///////////////////////////////////////////////////////////////////////////////
+
+/*
+d_internal_aio_transfer
+  Performs a positional read or write of up to `_length` bytes, retrying on
+short transfers until done, end of file, or error.
+
+Parameter(s):
+  _fd:     file descriptor.
+  _buffer: data buffer.
+  _length: bytes to transfer.
+  _offset: absolute file offset.
+  _write:  nonzero to write, zero to read.
+Return:
+  Bytes transferred, or -1 on error with errno set (if some bytes were already
+  transferred, the count is returned instead and the error is dropped).
+*/
+static ssize_t
+d_internal_aio_transfer
+(
+    int     _fd,
+    void*   _buffer,
+    size_t  _length,
+    d_off_t _offset,
+    int     _write
+)
+{
+    size_t  done;
+    ssize_t n;
+
+    done = 0;
+
+    while (done < _length)
+    {
+#if defined(D_FILE_PLATFORM_WINDOWS)
+        {
+            HANDLE     handle;
+            OVERLAPPED overlapped;
+            DWORD      chunk;
+            DWORD      moved;
+            uint64_t   position;
+            BOOL       ok;
+
+            handle = (HANDLE)_get_osfhandle(_fd);
+            if (handle == INVALID_HANDLE_VALUE)
+            {
+                errno = EBADF;
+                n     = -1;
+            }
+            else
+            {
+                // an OVERLAPPED offset makes ReadFile/WriteFile positional
+                // (and so safe to share one handle across pool threads)
+                position = (uint64_t)_offset + done;
+                chunk    = (_length - done > 0x40000000u) ? 0x40000000u
+                                                          : (DWORD)(_length - done);
+
+                d_memset(&overlapped, 0, sizeof(overlapped));
+                overlapped.Offset     = (DWORD)(position & 0xFFFFFFFFu);
+                overlapped.OffsetHigh = (DWORD)(position >> 32);
+
+                ok = (_write)
+                         ? WriteFile(handle, (const char*)_buffer + done, chunk, &moved, &overlapped)
+                         : ReadFile(handle, (char*)_buffer + done, chunk, &moved, &overlapped);
+
+                if (ok)
+                {
+                    n = (ssize_t)moved;
+                }
+                else if (GetLastError() == ERROR_HANDLE_EOF)
+                {
+                    n = 0;
+                }
+                else
+                {
+                    errno = EIO;
+                    n     = -1;
+                }
+            }
+        }
+#else
+        n = (_write)
+                ? pwrite(_fd, (const char*)_buffer + done, _length - done, (off_t)(_offset + (d_off_t)done))
+                : pread(_fd, (char*)_buffer + done, _length - done, (off_t)(_offset + (d_off_t)done));
+
+        if ( (n < 0) &&
+             (errno == EINTR) )
+        {
+            continue;
+        }
+#endif
+
+        if (n < 0)
+        {
+            return (done > 0) ? (ssize_t)done : -1;
+        }
+
+        if (n == 0)
+        {
+            break;
+        }
+
+        done += (size_t)n;
+    }
+
+    return (ssize_t)done;
+}
+
+
+/*
+d_internal_aio_execute
+  Performs a request synchronously on the calling thread and records its
+result and error fields.
+*/
+static void
+d_internal_aio_execute
+(
+    struct d_aio_request* _request
+)
+{
+    ssize_t result;
+
+    errno = 0;
+
+    switch (_request->op)
+    {
+        case D_AIO_OP_READ:
+        case D_AIO_OP_WRITE:
+            result = d_internal_aio_transfer(_request->fd,
+                                             _request->buffer,
+                                             _request->length,
+                                             _request->offset,
+                                             _request->op == D_AIO_OP_WRITE);
+            break;
+
+        case D_AIO_OP_FSYNC:
+#if ( defined(D_FILE_PLATFORM_POSIX) &&  \
+      defined(_POSIX_SYNCHRONIZED_IO) && (_POSIX_SYNCHRONIZED_IO > 0) )
+            result = (_request->flags & D_AIO_FSYNC_DATA)
+                         ? fdatasync(_request->fd)
+                         : d_fsync(_request->fd);
+#else
+            result = d_fsync(_request->fd);
+#endif
+            break;
+
+        case D_AIO_OP_OPEN:
+            result = d_open(_request->path, _request->flags, _request->mode);
+            break;
+
+        case D_AIO_OP_CLOSE:
+            result = d_close(_request->fd);
+            break;
+
+        default:
+            errno  = EINVAL;
+            result = -1;
+            break;
+    }
+
+    _request->result = result;
+    _request->error  = (result < 0) ? ((errno) ? errno : EIO) : 0;
+
+    return;
+}
+
+
+/*
+d_internal_aio_worker_main
+  Thread-pool worker: executes queued requests until the engine stops and the
+queue has drained.
+*/
+static d_thread_result_t
+d_internal_aio_worker_main
+(
+    void* _arg
+)
+{
+    struct d_aio_engine*  engine;
+    struct d_aio_request* request;
+
+    engine = (struct d_aio_engine*)_arg;
+
+    for (;;)
+    {
+        d_mutex_lock(&engine->lock);
+
+        while ( (!engine->stopping) &&
+                (engine->work.count == 0) )
+        {
+            d_cond_wait(&engine->work_ready, &engine->lock);
+        }
+
+        request = d_internal_aio_list_pop(&engine->work);
+        d_mutex_unlock(&engine->lock);
+
+        // stopping and drained
+        if (!request)
+        {
+            break;
+        }
+
+        d_internal_aio_execute(request);
+
+        d_mutex_lock(&engine->lock);
+        d_internal_aio_list_push(&engine->done, request);
+        engine->in_flight--;
+        d_cond_signal(&engine->done_ready);
+        d_mutex_unlock(&engine->lock);
+    }
+
+    return D_THREAD_SUCCESS;
+}
+
+
+///////////////////////////////////////////////////////////////////////////////
+///             IO_URING BACKEND                                            ///
+///////////////////////////////////////////////////////////////////////////////
+
+#if D_AIO_HAS_IO_URING
+
+/*
+d_internal_aio_ring_enter
+  Thin io_uring_enter wrapper: hands `_submit` SQEs to the kernel and, if
+`_wait` is nonzero, blocks until that many completions are available.
+
+Return:
+  Number of SQEs consumed, or -1 on error (errno set).
+*/
+static int
+d_internal_aio_ring_enter
+(
+    struct d_internal_aio_ring* _ring,
+    unsigned                    _submit,
+    unsigned                    _wait
+)
+{
+    return (int)syscall(__NR_io_uring_enter,
+                        _ring->fd,
+                        _submit,
+                        _wait,
+                        (_wait) ? IORING_ENTER_GETEVENTS : 0u,
+                        NULL,
+                        0);
+}
+
+
+/*
+d_internal_aio_ring_free
+  Unmaps the rings and closes the io_uring descriptor.
+*/
+static void
+d_internal_aio_ring_free
+(
+    struct d_internal_aio_ring* _ring
+)
+{
+    if (_ring->sqes)
+    {
+        munmap(_ring->sqes, _ring->sqes_size);
+    }
+
+    if ( (_ring->cq_ptr) &&
+         (_ring->cq_ptr != _ring->sq_ptr) )
+    {
+        munmap(_ring->cq_ptr, _ring->cq_size);
+    }
+
+    if (_ring->sq_ptr)
+    {
+        munmap(_ring->sq_ptr, _ring->sq_size);
+    }
+
+    if (_ring->fd >= 0)
+    {
+        close(_ring->fd);
+    }
+
+    d_memset(_ring, 0, sizeof(struct d_internal_aio_ring));
+    _ring->fd = -1;
+
+    return;
+}
+
+
+/*
+d_internal_aio_ring_supports
+  Asks the kernel whether every opcode the engine issues is implemented. Any
+kernel without IORING_REGISTER_PROBE (pre-5.6) also lacks IORING_OP_READ,
+IORING_OP_OPENAT and IORING_OP_CLOSE, so a failed probe means "no".
+*/
+static bool
+d_internal_aio_ring_supports
+(
+    int _fd
+)
+{
+    static const int      needed[] = { IORING_OP_READ,
+                                       IORING_OP_WRITE,
+                                       IORING_OP_FSYNC,
+                                       IORING_OP_OPENAT,
+                                       IORING_OP_CLOSE };
+    struct io_uring_probe* probe;
+    size_t                 size;
+    size_t                 i;
+    bool                   supported;
+
+    size  = sizeof(struct io_uring_probe) + (256 * sizeof(struct io_uring_probe_op));
+    probe = calloc(1, size);
+
+    if (!probe)
+    {
+        return false;
+    }
+
+    supported = (syscall(__NR_io_uring_register,
+                         _fd,
+                         IORING_REGISTER_PROBE,
+                         probe,
+                         256) == 0);
+
+    for (i = 0; ( (supported) && (i < (sizeof(needed) / sizeof(needed[0]))) ); i++)
+    {
+        supported = (needed[i] <= probe->last_op) &&
+                    (probe->ops[needed[i]].flags & IO_URING_OP_SUPPORTED);
+    }
+
+    free(probe);
+
+    return supported;
+}
+
+
+/*
+d_internal_aio_ring_init
+  Creates an io_uring instance with at least `_entries` submission slots and
+maps its rings.
+
+Return:
+  0 on success, -1 if io_uring is unavailable or lacks a required opcode.
+*/
+static int
+d_internal_aio_ring_init
+(
+    struct d_internal_aio_ring* _ring,
+    unsigned                    _entries
+)
+{
+    struct io_uring_params params;
+    char*                  sq;
+    char*                  cq;
+
+    d_memset(_ring, 0, sizeof(struct d_internal_aio_ring));
+    d_memset(&params, 0, sizeof(params));
+
+    _ring->fd = (int)syscall(__NR_io_uring_setup, _entries, &params);
+    if (_ring->fd < 0)
+    {
+        _ring->fd = -1;
+
+        return -1;
+    }
+
+    if (!d_internal_aio_ring_supports(_ring->fd))
+    {
+        d_internal_aio_ring_free(_ring);
+
+        return -1;
+    }
+
+    _ring->sq_entries = params.sq_entries;
+    _ring->cq_entries = params.cq_entries;
+    _ring->sq_size    = params.sq_off.array + (params.sq_entries * sizeof(unsigned));
+    _ring->cq_size    = params.cq_off.cqes + (params.cq_entries * sizeof(struct io_uring_cqe));
+    _ring->sqes_size  = params.sq_entries * sizeof(struct io_uring_sqe);
+
+    // since 5.4 both rings live in one mapping
+    if (params.features & IORING_FEAT_SINGLE_MMAP)
+    {
+        if (_ring->cq_size > _ring->sq_size)
+        {
+            _ring->sq_size = _ring->cq_size;
+        }
+
+        _ring->cq_size = _ring->sq_size;
+    }
+
+    _ring->sq_ptr = mmap(NULL,
+                         _ring->sq_size,
+                         PROT_READ | PROT_WRITE,
+                         MAP_SHARED | MAP_POPULATE,
+                         _ring->fd,
+                         IORING_OFF_SQ_RING);
+
+    if (_ring->sq_ptr == MAP_FAILED)
+    {
+        _ring->sq_ptr = NULL;
+        d_internal_aio_ring_free(_ring);
+
+        return -1;
+    }
+
+    if (params.features & IORING_FEAT_SINGLE_MMAP)
+    {
+        _ring->cq_ptr = _ring->sq_ptr;
+    }
+    else
+    {
+        _ring->cq_ptr = mmap(NULL,
+                             _ring->cq_size,
+                             PROT_READ | PROT_WRITE,
+                             MAP_SHARED | MAP_POPULATE,
+                             _ring->fd,
+                             IORING_OFF_CQ_RING);
+
+        if (_ring->cq_ptr == MAP_FAILED)
+        {
+            _ring->cq_ptr = NULL;
+            d_internal_aio_ring_free(_ring);
+
+            return -1;
+        }
+    }
+
+    _ring->sqes = mmap(NULL,
+                       _ring->sqes_size,
+                       PROT_READ | PROT_WRITE,
+                       MAP_SHARED | MAP_POPULATE,
+                       _ring->fd,
+                       IORING_OFF_SQES);
+
+    if (_ring->sqes == MAP_FAILED)
+    {
+        _ring->sqes = NULL;
+        d_internal_aio_ring_free(_ring);
+
+        return -1;
+    }
+
+    sq = (char*)_ring->sq_ptr;
+    cq = (char*)_ring->cq_ptr;
+
+    _ring->sq_head  = (unsigned*)(sq + params.sq_off.head);
+    _ring->sq_tail  = (unsigned*)(sq + params.sq_off.tail);
+    _ring->sq_mask  = (unsigned*)(sq + params.sq_off.ring_mask);
+    _ring->sq_array = (unsigned*)(sq + params.sq_off.array);
+    _ring->cq_head  = (unsigned*)(cq + params.cq_off.head);
+    _ring->cq_tail  = (unsigned*)(cq + params.cq_off.tail);
+    _ring->cq_mask  = (unsigned*)(cq + params.cq_off.ring_mask);
+    _ring->cqes     = (struct io_uring_cqe*)(cq + params.cq_off.cqes);
+
+    return 0;
+}
+
+
+/*
+d_internal_aio_ring_flush
+  Hands every written-but-unsubmitted SQE to the kernel.
+
+Return:
+  0 on success, -1 on failure.
+*/
+static int
+d_internal_aio_ring_flush
+(
+    struct d_internal_aio_ring* _ring
+)
+{
+    int consumed;
+
+    while (_ring->to_submit > 0)
+    {
+        consumed = d_internal_aio_ring_enter(_ring, _ring->to_submit, 0);
+
+        if (consumed < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+
+            return -1;
+        }
+
+        _ring->to_submit -= (unsigned)consumed;
+    }
+
+    return 0;
+}
+
+
+/*
+d_internal_aio_ring_reap
+  Moves every available CQE's request onto the engine's done list.
+
+Return:
+  Number of completions reaped.
+*/
+static size_t
+d_internal_aio_ring_reap
+(
+    struct d_aio_engine* _engine
+)
+{
+    struct d_internal_aio_ring* ring;
+    struct io_uring_cqe*        cqe;
+    struct d_aio_request*       request;
+    unsigned                    head;
+    unsigned                    tail;
+    size_t                      reaped;
+
+    ring   = &_engine->ring;
+    reaped = 0;
+    head   = *ring->cq_head;
+    tail   = __atomic_load_n(ring->cq_tail, __ATOMIC_ACQUIRE);
+
+    while (head != tail)
+    {
+        cqe     = &ring->cqes[head & *ring->cq_mask];
+        request = (struct d_aio_request*)(uintptr_t)cqe->user_data;
+
+        if (cqe->res < 0)
+        {
+            request->result = -1;
+            request->error  = -cqe->res;
+        }
+        else
+        {
+            request->result = (ssize_t)cqe->res;
+            request->error  = 0;
+        }
+
+        d_internal_aio_list_push(&_engine->done, request);
+        _engine->in_flight--;
+        reaped++;
+        head++;
+    }
+
+    __atomic_store_n(ring->cq_head, head, __ATOMIC_RELEASE);
+
+    return reaped;
+}
+
+
+/*
+d_internal_aio_ring_submit
+  Writes one request into the next free SQE. The kernel does not see it until
+the next flush (d_aio_flush, d_aio_poll, d_aio_wait, or a full queue).
+
+Return:
+  0 on success, -1 on failure.
+*/
+static int
+d_internal_aio_ring_submit
+(
+    struct d_aio_engine*  _engine,
+    struct d_aio_request* _request
+)
+{
+    struct d_internal_aio_ring* ring;
+    struct io_uring_sqe*        sqe;
+    unsigned                    head;
+    unsigned                    tail;
+    unsigned                    index;
+
+    ring = &_engine->ring;
+
+    // never have more operations outstanding than the CQ can hold
+    while (_engine->in_flight >= ring->cq_entries)
+    {
+        if (d_internal_aio_ring_flush(ring) != 0)
+        {
+            return -1;
+        }
+
+        if ( (d_internal_aio_ring_reap(_engine) == 0) &&
+             (d_internal_aio_ring_enter(ring, 0, 1) < 0) &&
+             (errno != EINTR) )
+        {
+            return -1;
+        }
+    }
+
+    tail = *ring->sq_tail;
+    head = __atomic_load_n(ring->sq_head, __ATOMIC_ACQUIRE);
+
+    if (tail - head >= ring->sq_entries)
+    {
+        if (d_internal_aio_ring_flush(ring) != 0)
+        {
+            return -1;
+        }
+    }
+
+    index = tail & *ring->sq_mask;
+    sqe   = &ring->sqes[index];
+
+    d_memset(sqe, 0, sizeof(struct io_uring_sqe));
+    sqe->user_data = (uint64_t)(uintptr_t)_request;
+
+    switch (_request->op)
+    {
+        case D_AIO_OP_READ:
+        case D_AIO_OP_WRITE:
+            sqe->opcode = (_request->op == D_AIO_OP_READ) ? IORING_OP_READ
+                                                          : IORING_OP_WRITE;
+            sqe->fd     = _request->fd;
+            sqe->addr   = (uint64_t)(uintptr_t)_request->buffer;
+            sqe->len    = (_request->length > 0x7FFFF000u) ? 0x7FFFF000u
+                                                           : (uint32_t)_request->length;
+            sqe->off    = (uint64_t)_request->offset;
+            break;
+
+        case D_AIO_OP_FSYNC:
+            sqe->opcode      = IORING_OP_FSYNC;
+            sqe->fd          = _request->fd;
+            sqe->fsync_flags = (_request->flags & D_AIO_FSYNC_DATA)
+                                   ? IORING_FSYNC_DATASYNC
+                                   : 0u;
+            break;
+
+        case D_AIO_OP_OPEN:
+            sqe->opcode     = IORING_OP_OPENAT;
+            sqe->fd         = AT_FDCWD;
+            sqe->addr       = (uint64_t)(uintptr_t)_request->path;
+            sqe->len        = (uint32_t)_request->mode;
+            sqe->open_flags = (uint32_t)_request->flags;
+            break;
+
+        case D_AIO_OP_CLOSE:
+            sqe->opcode = IORING_OP_CLOSE;
+            sqe->fd     = _request->fd;
+            break;
+
+        default:
+            errno = EINVAL;
+
+            return -1;
+    }
+
+    ring->sq_array[index] = index;
+    __atomic_store_n(ring->sq_tail, tail + 1, __ATOMIC_RELEASE);
+
+    ring->to_submit++;
+    _engine->in_flight++;
+
+    return 0;
+}
+
+#endif  // D_AIO_HAS_IO_URING
+
+
+///////////////////////////////////////////////////////////////////////////////
+///             III.  ENGINE LIFETIME                                       ///
+///////////////////////////////////////////////////////////////////////////////
+
+/*
+d_aio_engine_new
+  Create an asynchronous I/O engine. io_uring is used when the platform and
+the running kernel support it; otherwise a pool of `_workers` threads serves
+the requests.
+
+Parameter(s):
+  _queue_depth: number of submission slots (io_uring) - requests beyond this
+                are still accepted but force an early flush. 0 selects
+                D_AIO_DEFAULT_QUEUE_DEPTH.
+  _workers:     thread count for the thread-pool backend; 0 selects the
+                hardware concurrency. Ignored by the io_uring backend.
+Return:
+  A new engine, or NULL on failure.
+*/
+struct d_aio_engine*
+d_aio_engine_new
+(
+    size_t _queue_depth,
+    size_t _workers
+)
+{
+    struct d_aio_engine* engine;
+    size_t               i;
+
+    if (_queue_depth == 0)
+    {
+        _queue_depth = D_AIO_DEFAULT_QUEUE_DEPTH;
+    }
+
+    engine = calloc(1, sizeof(struct d_aio_engine));
+    if (!engine)
+    {
+        return NULL;
+    }
+
+#if D_AIO_HAS_IO_URING
+    if (d_internal_aio_ring_init(&engine->ring,
+                                 (_queue_depth > 4096) ? 4096u
+                                                       : (unsigned)_queue_depth) == 0)
+    {
+        engine->backend = D_AIO_BACKEND_IO_URING;
+
+        return engine;
+    }
+#endif
+
+    engine->backend = D_AIO_BACKEND_THREAD_POOL;
+
+    if (_workers == 0)
+    {
+        _workers = (d_thread_hardware_concurrency() > 0)
+                       ? (size_t)d_thread_hardware_concurrency()
+                       : 1;
+    }
+
+    engine->threads = calloc(_workers, sizeof(d_thread_t));
+    if (!engine->threads)
+    {
+        free(engine);
+
+        return NULL;
+    }
+
+    if ( (d_mutex_init(&engine->lock) != D_MUTEX_SUCCESS)     ||
+         (d_cond_init(&engine->work_ready) != D_MUTEX_SUCCESS) ||
+         (d_cond_init(&engine->done_ready) != D_MUTEX_SUCCESS) )
+    {
+        free(engine->threads);
+        free(engine);
+
+        return NULL;
+    }
+
+    for (i = 0; i < _workers; i++)
+    {
+        if (d_thread_create(&engine->threads[i],
+                            d_internal_aio_worker_main,
+                            engine) != D_MUTEX_SUCCESS)
+        {
+            break;
+        }
+
+        engine->thread_count++;
+    }
+
+    if (engine->thread_count == 0)
+    {
+        d_aio_engine_free(engine);
+
+        return NULL;
+    }
+
+    return engine;
+}
+
+
+/*
+d_aio_engine_free
+  Destroy an engine. Blocks until every submitted request has finished (the
+kernel or a worker may still be writing into caller buffers until then);
+completions that were never delivered are dropped without callbacks.
+
+Parameter(s):
+  _engine: engine to destroy (may be NULL).
+Return:
+  none.
+*/
+void
+d_aio_engine_free
+(
+    struct d_aio_engine* _engine
+)
+{
+    size_t i;
+
+    if (!_engine)
+    {
+        return;
+    }
+
+#if D_AIO_HAS_IO_URING
+    if (_engine->backend == D_AIO_BACKEND_IO_URING)
+    {
+        d_internal_aio_ring_flush(&_engine->ring);
+
+        while (_engine->in_flight > 0)
+        {
+            if ( (d_internal_aio_ring_reap(_engine) == 0) &&
+                 (d_internal_aio_ring_enter(&_engine->ring, 0, 1) < 0) &&
+                 (errno != EINTR) )
+            {
+                break;
+            }
+        }
+
+        d_internal_aio_ring_free(&_engine->ring);
+        free(_engine);
+
+        return;
+    }
+#endif
+
+    d_mutex_lock(&_engine->lock);
+    _engine->stopping = true;
+    d_cond_broadcast(&_engine->work_ready);
+    d_mutex_unlock(&_engine->lock);
+
+    for (i = 0; i < _engine->thread_count; i++)
+    {
+        d_thread_join(_engine->threads[i], NULL);
+    }
+
+    d_cond_destroy(&_engine->done_ready);
+    d_cond_destroy(&_engine->work_ready);
+    d_mutex_destroy(&_engine->lock);
+
+    free(_engine->threads);
+    free(_engine);
+
+    return;
+}
+
+
+/*
+d_aio_backend
+  Report which backend an engine runs on.
+
+Parameter(s):
+  _engine: engine.
+Return:
+  D_AIO_BACKEND_IO_URING or D_AIO_BACKEND_THREAD_POOL (also for NULL).
+*/
+int
+d_aio_backend
+(
+    const struct d_aio_engine* _engine
+)
+{
+    return (_engine) ? _engine->backend
+                     : D_AIO_BACKEND_THREAD_POOL;
+}
+
+
+///////////////////////////////////////////////////////////////////////////////
+///             IV.   SUBMISSION                                            ///
+///////////////////////////////////////////////////////////////////////////////
+
+/*
+d_aio_request_init
+  Reset a request and fill the fields common to READ, WRITE, FSYNC and CLOSE.
+For OPEN, set `path`, `flags` and `mode` afterwards.
+
+Parameter(s):
+  _request: request to initialize.
+  _op:      D_AIO_OP_* operation.
+  _fd:      target descriptor.
+  _buffer:  data buffer (READ/WRITE).
+  _length:  bytes to transfer (READ/WRITE).
+  _offset:  absolute file offset (READ/WRITE).
+Return:
+  none.
+*/
+void
+d_aio_request_init
+(
+    struct d_aio_request* _request,
+    int                   _op,
+    int                   _fd,
+    void*                 _buffer,
+    size_t                _length,
+    d_off_t               _offset
+)
+{
+    if (!_request)
+    {
+        return;
+    }
+
+    d_memset(_request, 0, sizeof(struct d_aio_request));
+
+    _request->op     = _op;
+    _request->fd     = _fd;
+    _request->buffer = _buffer;
+    _request->length = _length;
+    _request->offset = _offset;
+
+    return;
+}
+
+
+/*
+d_aio_submit
+  Queue a request. With io_uring the request is written into the submission
+ring and reaches the kernel at the next d_aio_flush, d_aio_poll or d_aio_wait
+(so a burst of submissions costs one system call); the thread pool starts on
+it immediately. READ and WRITE may complete short, exactly like pread/pwrite;
+check `result` against `length`.
+
+Parameter(s):
+  _engine:  engine.
+  _request: request; must stay valid until delivered.
+Return:
+  0 on success, -1 on failure (the request was not queued).
+*/
+int
+d_aio_submit
+(
+    struct d_aio_engine*  _engine,
+    struct d_aio_request* _request
+)
+{
+    // parameter validation
+    if ( (!_engine)  ||
+         (!_request) ||
+         (_request->op < D_AIO_OP_READ) ||
+         (_request->op > D_AIO_OP_CLOSE) ||
+         ( (_request->op == D_AIO_OP_OPEN) && (!_request->path) ) ||
+         ( ( (_request->op == D_AIO_OP_READ) ||
+             (_request->op == D_AIO_OP_WRITE) ) &&
+           ( (!_request->buffer) && (_request->length > 0) ) ) )
+    {
+        errno = EINVAL;
+
+        return -1;
+    }
+
+    _request->result = 0;
+    _request->error  = 0;
+    _request->next   = NULL;
+
+#if D_AIO_HAS_IO_URING
+    if (_engine->backend == D_AIO_BACKEND_IO_URING)
+    {
+        return d_internal_aio_ring_submit(_engine, _request);
+    }
+#endif
+
+    d_mutex_lock(&_engine->lock);
+    d_internal_aio_list_push(&_engine->work, _request);
+    _engine->in_flight++;
+    d_cond_signal(&_engine->work_ready);
+    d_mutex_unlock(&_engine->lock);
+
+    return 0;
+}
+
+
+/*
+d_aio_flush
+  Hand all queued submissions to the kernel without waiting for completions.
+A no-op for the thread-pool backend.
+
+Parameter(s):
+  _engine: engine.
+Return:
+  0 on success, -1 on failure.
+*/
+int
+d_aio_flush
+(
+    struct d_aio_engine* _engine
+)
+{
+    if (!_engine)
+    {
+        errno = EINVAL;
+
+        return -1;
+    }
+
+#if D_AIO_HAS_IO_URING
+    if (_engine->backend == D_AIO_BACKEND_IO_URING)
+    {
+        return d_internal_aio_ring_flush(&_engine->ring);
+    }
+#endif
+
+    return 0;
+}
+
+
+///////////////////////////////////////////////////////////////////////////////
+///             V.    COMPLETION                                            ///
+///////////////////////////////////////////////////////////////////////////////
+
+/*
+d_internal_aio_take
+  Detaches up to `_max` completed requests (0 = all) from the done list.
+*/
+static struct d_internal_aio_list
+d_internal_aio_take
+(
+    struct d_aio_engine* _engine,
+    size_t               _max
+)
+{
+    struct d_internal_aio_list taken;
+    struct d_aio_request*      request;
+
+    d_memset(&taken, 0, sizeof(taken));
+
+#if D_AIO_HAS_IO_URING
+    if (_engine->backend == D_AIO_BACKEND_IO_URING)
+    {
+        d_internal_aio_ring_flush(&_engine->ring);
+        d_internal_aio_ring_reap(_engine);
+    }
+    else
+#endif
+    {
+        d_mutex_lock(&_engine->lock);
+    }
+
+    while ( ( (_max == 0) || (taken.count < _max) ) &&
+            ((request = d_internal_aio_list_pop(&_engine->done)) != NULL) )
+    {
+        d_internal_aio_list_push(&taken, request);
+    }
+
+    if (_engine->backend == D_AIO_BACKEND_THREAD_POOL)
+    {
+        d_mutex_unlock(&_engine->lock);
+    }
+
+    return taken;
+}
+
+
+/*
+d_aio_poll
+  Deliver completions that are already available, without blocking.
+
+Parameter(s):
+  _engine: engine.
+  _max:    maximum number of completions to deliver (0 = no limit).
+Return:
+  Number of completions delivered.
+*/
+size_t
+d_aio_poll
+(
+    struct d_aio_engine* _engine,
+    size_t               _max
+)
+{
+    struct d_internal_aio_list taken;
+    struct d_aio_request*      request;
+    size_t                     delivered;
+
+    if (!_engine)
+    {
+        return 0;
+    }
+
+    // detach first, so callbacks may freely submit or poll again
+    taken     = d_internal_aio_take(_engine, _max);
+    delivered = 0;
+
+    while ((request = d_internal_aio_list_pop(&taken)) != NULL)
+    {
+        d_internal_aio_deliver(_engine, request);
+        delivered++;
+    }
+
+    return delivered;
+}
+
+
+/*
+d_aio_wait
+  Deliver completions, blocking until at least `_min` have been delivered or
+nothing is left in flight.
+
+Parameter(s):
+  _engine: engine.
+  _min:    minimum number of completions to deliver before returning.
+  _max:    maximum number of completions to deliver (0 = no limit).
+Return:
+  Number of completions delivered.
+*/
+size_t
+d_aio_wait
+(
+    struct d_aio_engine* _engine,
+    size_t               _min,
+    size_t               _max
+)
+{
+    size_t delivered;
+    bool   idle;
+
+    if (!_engine)
+    {
+        return 0;
+    }
+
+    if ( (_max != 0) &&
+         (_min > _max) )
+    {
+        _min = _max;
+    }
+
+    delivered = 0;
+
+    for (;;)
+    {
+        delivered += d_aio_poll(_engine, (_max) ? (_max - delivered) : 0);
+
+        if ( (delivered >= _min) ||
+             ( (_max != 0) && (delivered >= _max) ) )
+        {
+            break;
+        }
+
+#if D_AIO_HAS_IO_URING
+        if (_engine->backend == D_AIO_BACKEND_IO_URING)
+        {
+            if ( (_engine->in_flight == 0) &&
+                 (_engine->done.count == 0) )
+            {
+                break;
+            }
+
+            // submit anything pending and sleep for one completion
+            if ( (d_internal_aio_ring_enter(&_engine->ring,
+                                            _engine->ring.to_submit,
+                                            1) < 0) &&
+                 (errno != EINTR) )
+            {
+                break;
+            }
+
+            _engine->ring.to_submit = 0;
+
+            continue;
+        }
+#endif
+
+        d_mutex_lock(&_engine->lock);
+
+        while ( (_engine->done.count == 0) &&
+                (_engine->in_flight > 0) )
+        {
+            d_cond_wait(&_engine->done_ready, &_engine->lock);
+        }
+
+        idle = (_engine->done.count == 0);
+        d_mutex_unlock(&_engine->lock);
+
+        if (idle)
+        {
+            break;
+        }
+    }
+
+    return delivered;
+}
+
+
+/*
+d_aio_next
+  Take the next delivered completion that had neither a callback nor an event
+handler to go to. Completions land here in the order they were delivered.
+
+Parameter(s):
+  _engine: engine.
+Return:
+  A completed request, or NULL if none is waiting.
+*/
+struct d_aio_request*
+d_aio_next
+(
+    struct d_aio_engine* _engine
+)
+{
+    if (!_engine)
+    {
+        return NULL;
+    }
+
+    return d_internal_aio_list_pop(&_engine->unclaimed);
+}
+
+
+/*
+d_aio_pending
+  Number of requests submitted but not yet delivered.
+
+Parameter(s):
+  _engine: engine.
+Return:
+  The pending count (0 for NULL).
+*/
+size_t
+d_aio_pending
+(
+    const struct d_aio_engine* _engine
+)
+{
+    struct d_aio_engine* engine;
+    size_t               pending;
+
+    if (!_engine)
+    {
+        return 0;
+    }
+
+    if (_engine->backend == D_AIO_BACKEND_IO_URING)
+    {
+        return _engine->in_flight + _engine->done.count;
+    }
+
+    // the lock is logically const here; only the counters are read
+    engine = (struct d_aio_engine*)_engine;
+
+    d_mutex_lock(&engine->lock);
+    pending = engine->in_flight + engine->done.count;
+    d_mutex_unlock(&engine->lock);
+
+    return pending;
+}
+
+
+/*
+d_aio_attach_event_handler
+  Route completions of requests without a callback into an event handler's
+queue. Each completion becomes an event with id `_event_id`, `args` pointing
+at the request and `num_args` 1; bind a listener for `_event_id` and run
+d_event_handler_process_events to consume them. If the handler's queue is
+full, the completion falls through to d_aio_next instead of being lost.
+
+Parameter(s):
+  _engine:   engine.
+  _handler:  event handler, or NULL to detach.
+  _event_id: event id to use for completions.
+Return:
+  0 on success, -1 on failure.
+*/
+int
+d_aio_attach_event_handler
+(
+    struct d_aio_engine*    _engine,
+    struct d_event_handler* _handler,
+    d_event_id              _event_id
+)
+{
+    if (!_engine)
+    {
+        errno = EINVAL;
+
+        return -1;
+    }
+
+    _engine->handler  = _handler;
+    _engine->event_id = _event_id;
+
+    return 0;
+}
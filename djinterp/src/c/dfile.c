@@ -11,6 +11,14 @@
 ///             INTERNAL DEFINITIONS                                        ///
 ///////////////////////////////////////////////////////////////////////////////
 
+// Linux-only headers for the accelerated d_copy_file paths
+#if defined(D_ENV_PLATFORM_LINUX)
+    #include <sys/ioctl.h>
+    #include <sys/sendfile.h>
+    #include <sys/syscall.h>
+    #include <linux/fs.h>       // FICLONE
+#endif
+
 // internal directory handle structure
 struct d_dir_t
 {
@@ -25,10 +33,29 @@ struct d_dir_t
     struct d_dirent_t entry;
 };
 
+// d_internal_fwrite_entry
+//   type: one staged write of a d_fwrite_group.
+struct d_internal_fwrite_entry
+{
+    char* path;     // final destination
+    char* temp;     // sibling temporary holding the new contents
+    int   fd;       // open descriptor of `temp`, or -1 once closed
+};
+
+// internal write group structure
+struct d_fwrite_group
+{
+    struct d_internal_fwrite_entry* entries;
+    size_t                          count;
+    size_t                          capacity;
+};
+
 
 // D_INTERNAL_FILE_COPY_BUF_SIZE
-//   constant: buffer size for file copy operations.
-#define D_INTERNAL_FILE_COPY_BUF_SIZE 65536
+//   constant: buffer size for file copy operations. Only used when no
+// in-kernel copy primitive applies; large enough that per-call overhead is
+// negligible against the transfer itself.
+#define D_INTERNAL_FILE_COPY_BUF_SIZE (1024 * 1024)
 
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -770,6 +797,74 @@ d_fflush
 }
 
 
+/*
+d_fsync_dir
+  Make changes to a directory's entries (files created, renamed or removed in
+it) durable. A rename is only crash-safe once the containing directory has
+been synchronized. Windows offers no directory handle to flush; renames done
+with MOVEFILE_WRITE_THROUGH are already durable there, so this is a no-op.
+
+Parameter(s):
+  _path: path to the directory.
+Return:
+  0 on success, -1 on failure.
+*/
+int
+d_fsync_dir
+(
+    const char* _path
+)
+{
+    // parameter validation
+    if (!_path)
+    {
+        errno = EINVAL;
+
+        return -1;
+    }
+
+#if defined(D_FILE_PLATFORM_WINDOWS)
+    return 0;
+#else
+    {
+        int fd;
+        int result;
+        int saved_errno;
+        int flags;
+
+        flags = O_RDONLY;
+    #if defined(O_DIRECTORY)
+        flags |= O_DIRECTORY;
+    #endif
+    #if defined(O_CLOEXEC)
+        flags |= O_CLOEXEC;
+    #endif
+
+        fd = open(_path, flags);
+        if (fd < 0)
+        {
+            return -1;
+        }
+
+        result = fsync(fd);
+
+        // some filesystems cannot sync directories; nothing more to do there
+        if ( (result != 0) &&
+             ( (errno == EINVAL) || (errno == EROFS) ) )
+        {
+            result = 0;
+        }
+
+        saved_errno = errno;
+        close(fd);
+        errno = saved_errno;
+
+        return result;
+    }
+#endif
+}
+
+
 ///////////////////////////////////////////////////////////////////////////////
 ///             VII.  FILE LOCKING                                          ///
 ///////////////////////////////////////////////////////////////////////////////
@@ -2169,9 +2264,347 @@ d_rename
 }
 
 
+#if defined(D_FILE_PLATFORM_POSIX)
+
+// strategies tried by d_internal_copy_segment, fastest first; a strategy that
+// reports "not supported here" is dropped for the rest of the copy
+#define D_INTERNAL_COPY_RANGE     0   // copy_file_range (in-kernel, may offload)
+#define D_INTERNAL_COPY_SENDFILE  1   // sendfile (in-kernel, page cache only)
+#define D_INTERNAL_COPY_BUFFERED  2   // pread/pwrite through a user buffer
+
+/*
+d_internal_copy_unsupported
+  Returns nonzero if `_error` means that an accelerated copy primitive cannot
+be used for this pair of files (as opposed to a genuine I/O error).
+*/
+static int
+d_internal_copy_unsupported
+(
+    int _error
+)
+{
+    return ( (_error == ENOSYS)     ||
+             (_error == EXDEV)      ||
+             (_error == EINVAL)     ||
+             (_error == EBADF)      ||
+             (_error == EPERM)      ||
+  #if defined(ENOTSUP)
+             (_error == ENOTSUP)    ||
+  #endif
+             (_error == EOPNOTSUPP) );
+}
+
+
+/*
+d_internal_copy_buffer
+  Lazily allocates the page-aligned bounce buffer used by the buffered copy
+strategies. Alignment keeps the kernel's copy_to_user/copy_from_user on whole
+pages and lets the same buffer serve O_DIRECT descriptors.
+
+Parameter(s):
+  _buffer: pointer to the caller's buffer slot (NULL until first use).
+Return:
+  The buffer, or NULL (errno = ENOMEM) on allocation failure.
+*/
+static char*
+d_internal_copy_buffer
+(
+    char** _buffer
+)
+{
+    void* memory;
+
+    if (!*_buffer)
+    {
+        memory = NULL;
+
+        if (posix_memalign(&memory, 4096, D_INTERNAL_FILE_COPY_BUF_SIZE) != 0)
+        {
+            errno = ENOMEM;
+
+            return NULL;
+        }
+
+        *_buffer = (char*)memory;
+    }
+
+    return *_buffer;
+}
+
+
+/*
+d_internal_copy_segment
+  Copies `_length` bytes at `_offset` of `_src` to the same offset of `_dst`,
+using the fastest strategy that still works for this pair of descriptors.
+
+Parameter(s):
+  _src:      source descriptor.
+  _dst:      destination descriptor.
+  _offset:   file offset of the segment (same in both files).
+  _length:   number of bytes to copy.
+  _strategy: in/out; current D_INTERNAL_COPY_* strategy.
+  _buffer:   in/out; bounce buffer slot for the buffered strategy.
+  _end:      out; offset just past the last byte copied. Less than
+             `_offset + _length` if the source hit end of file early.
+Return:
+  0 on success, -1 on failure.
+*/
+static int
+d_internal_copy_segment
+(
+    int    _src,
+    int    _dst,
+    off_t  _offset,
+    off_t  _length,
+    int*   _strategy,
+    char** _buffer,
+    off_t* _end
+)
+{
+    ssize_t n;
+    ssize_t written;
+    size_t  chunk;
+    size_t  done;
+    char*   buffer;
+
+    *_end = _offset;
+
+    while (_length > 0)
+    {
+        chunk = ((uint64_t)_length > (uint64_t)(SIZE_MAX >> 1))
+                    ? (SIZE_MAX >> 1)
+                    : (size_t)_length;
+
+        switch (*_strategy)
+        {
+  #if ( defined(D_ENV_PLATFORM_LINUX) &&  \
+        defined(__NR_copy_file_range) )
+            case D_INTERNAL_COPY_RANGE:
+            {
+                int64_t in_off;
+                int64_t out_off;
+
+                in_off  = (int64_t)_offset;
+                out_off = (int64_t)_offset;
+                n       = (ssize_t)syscall(__NR_copy_file_range,
+                                           _src, &in_off,
+                                           _dst, &out_off,
+                                           chunk, 0u);
+
+                break;
+            }
+  #endif
+
+  #if defined(D_ENV_PLATFORM_LINUX)
+            case D_INTERNAL_COPY_SENDFILE:
+            {
+                off_t in_off;
+
+                // sendfile writes at the destination's file position
+                if (lseek(_dst, _offset, SEEK_SET) < 0)
+                {
+                    return -1;
+                }
+
+                in_off = _offset;
+                n      = sendfile(_dst,
+                                  _src,
+                                  &in_off,
+                                  (chunk > 0x7FFFF000u) ? 0x7FFFF000u
+                                                        : chunk);
+
+                break;
+            }
+  #endif
+
+            default:
+            {
+                buffer = d_internal_copy_buffer(_buffer);
+                if (!buffer)
+                {
+                    return -1;
+                }
+
+                if (chunk > D_INTERNAL_FILE_COPY_BUF_SIZE)
+                {
+                    chunk = D_INTERNAL_FILE_COPY_BUF_SIZE;
+                }
+
+                n = pread(_src, buffer, chunk, _offset);
+                if (n > 0)
+                {
+                    for (done = 0; done < (size_t)n; )
+                    {
+                        written = pwrite(_dst,
+                                         buffer + done,
+                                         (size_t)n - done,
+                                         _offset + (off_t)done);
+                        if (written < 0)
+                        {
+                            if (errno == EINTR)
+                            {
+                                continue;
+                            }
+
+                            return -1;
+                        }
+
+                        done += (size_t)written;
+                    }
+                }
+
+                *_strategy = D_INTERNAL_COPY_BUFFERED;
+
+                break;
+            }
+        }
+
+        if (n < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+
+            // drop to the next strategy only if nothing went wrong on disk
+            if ( (*_strategy != D_INTERNAL_COPY_BUFFERED) &&
+                 (d_internal_copy_unsupported(errno)) )
+            {
+                (*_strategy)++;
+
+                continue;
+            }
+
+            return -1;
+        }
+
+        // end of file before `_length`; the caller sees it through `_end`
+        if (n == 0)
+        {
+            break;
+        }
+
+        _offset += (off_t)n;
+        _length -= (off_t)n;
+        *_end    = _offset;
+    }
+
+    return 0;
+}
+
+
+/*
+d_internal_copy_stream
+  Copies from the current position of `_src` until end of file. Used for
+sources whose size is not known up front (pipes, character devices, and
+procfs-style files that report a size of zero).
+*/
+static int
+d_internal_copy_stream
+(
+    int    _src,
+    int    _dst,
+    char** _buffer
+)
+{
+    char*   buffer;
+    ssize_t n;
+    ssize_t written;
+    size_t  done;
+
+    buffer = d_internal_copy_buffer(_buffer);
+    if (!buffer)
+    {
+        return -1;
+    }
+
+    for (;;)
+    {
+        n = read(_src, buffer, D_INTERNAL_FILE_COPY_BUF_SIZE);
+        if (n == 0)
+        {
+            return 0;
+        }
+
+        if (n < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+
+            return -1;
+        }
+
+        for (done = 0; done < (size_t)n; )
+        {
+            written = write(_dst, buffer + done, (size_t)n - done);
+            if (written < 0)
+            {
+                if (errno == EINTR)
+                {
+                    continue;
+                }
+
+                return -1;
+            }
+
+            done += (size_t)written;
+        }
+    }
+}
+
+
+/*
+d_internal_copy_tail
+  Finishes a copy whose source ended before the size fstat reported, either
+because it shrank during the copy or because it is a pseudo-file (sysfs,
+procfs) whose st_size is nominal. Streams whatever remains after `_offset`
+and truncates the pre-sized destination to the bytes actually copied.
+*/
+static int
+d_internal_copy_tail
+(
+    int    _src,
+    int    _dst,
+    off_t  _offset,
+    char** _buffer
+)
+{
+    off_t end;
+
+    if ( (lseek(_src, _offset, SEEK_SET) < 0) ||
+         (lseek(_dst, _offset, SEEK_SET) < 0) )
+    {
+        return -1;
+    }
+
+    if (d_internal_copy_stream(_src, _dst, _buffer) != 0)
+    {
+        return -1;
+    }
+
+    end = lseek(_dst, 0, SEEK_CUR);
+    if (end < 0)
+    {
+        return -1;
+    }
+
+    return ftruncate(_dst, end);
+}
+
+#endif  // D_FILE_PLATFORM_POSIX
+
+
 /*
 d_copy_file
-  Copy file contents.
+  Copy file contents. On Linux the copy is attempted, in order, as a reflink
+(FICLONE; shares extents on copy-on-write filesystems), with copy_file_range
+(in-kernel, may be offloaded to the storage), with sendfile, and finally with
+a large aligned pread/pwrite loop. Holes in sparse source files are found with
+SEEK_DATA/SEEK_HOLE where available and left as holes in the destination.
+The destination is created with the source's permission bits (subject to the
+process umask) and truncated if it already exists.
 
 Parameter(s):
   _src: source file path.
@@ -2196,7 +2629,7 @@ d_copy_file
     }
 
 #if defined(D_FILE_PLATFORM_WINDOWS)
-    // use Windows CopyFile for efficiency
+    // CopyFileA already copies in the kernel and block-clones on ReFS
     if (!CopyFileA(_src, _dst, FALSE))
     {
         errno = EACCES;
@@ -2206,57 +2639,158 @@ d_copy_file
 
     return 0;
 #else
-    FILE*  src_file;
-    FILE*  dst_file;
-    char*  buffer;
-    size_t bytes_read;
-    int    result;
-
-    // portable implementation
-    src_file = d_fopen(_src, "rb");
-    if (!src_file)
+    struct stat st;
+    int         src_fd;
+    int         dst_fd;
+    int         strategy;
+    int         result;
+    int         saved_errno;
+    char*       buffer;
+    off_t       data;
+    off_t       hole;
+    off_t       end;
+
+    src_fd = open(_src, O_RDONLY | O_CLOEXEC);
+    if (src_fd < 0)
     {
         return -1;
     }
 
-    dst_file = d_fopen(_dst, "wb");
-    if (!dst_file)
+    if (fstat(src_fd, &st) != 0)
     {
-        fclose(src_file);
+        saved_errno = errno;
+        close(src_fd);
+        errno = saved_errno;
 
         return -1;
     }
 
-    buffer = malloc(D_INTERNAL_FILE_COPY_BUF_SIZE);
-    if (!buffer)
+    dst_fd = open(_dst,
+                  O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC,
+                  (mode_t)(st.st_mode & 0777));
+    if (dst_fd < 0)
     {
-        fclose(src_file);
-        fclose(dst_file);
-        errno = ENOMEM;
+        saved_errno = errno;
+        close(src_fd);
+        errno = saved_errno;
 
         return -1;
     }
 
-    result = 0;
+    result   = 0;
+    buffer   = NULL;
+    strategy = D_INTERNAL_COPY_RANGE;
 
-    while ((bytes_read = fread(buffer, 1, D_INTERNAL_FILE_COPY_BUF_SIZE, 
-                               src_file)) > 0)
+  #if !defined(__NR_copy_file_range)
+    strategy = D_INTERNAL_COPY_SENDFILE;
+  #endif
+  #if !defined(D_ENV_PLATFORM_LINUX)
+    strategy = D_INTERNAL_COPY_BUFFERED;
+  #endif
+
+    if ( (!S_ISREG(st.st_mode)) ||
+         (st.st_size == 0) )
+    {
+        // unknown length: stream until end of file
+        result = d_internal_copy_stream(src_fd, dst_fd, &buffer);
+    }
+  #if ( defined(D_ENV_PLATFORM_LINUX) &&  \
+        defined(FICLONE) )
+    else if (ioctl(dst_fd, FICLONE, src_fd) == 0)
+    {
+        // reflinked: shares extents (and holes) with the source
+        result = 0;
+    }
+  #endif
+    else
     {
-        if (fwrite(buffer, 1, bytes_read, dst_file) != bytes_read)
+  #if defined(POSIX_FADV_SEQUENTIAL)
+        // only the buffered and sendfile paths go through the page cache,
+        // but the hint is free for the others
+        posix_fadvise(src_fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+  #endif
+
+        // size the destination first so skipped holes read back as zeros
+        if (ftruncate(dst_fd, st.st_size) != 0)
         {
             result = -1;
-            break;
+        }
+
+        data = 0;
+
+        while ( (result == 0) &&
+                (data < st.st_size) )
+        {
+  #if ( defined(SEEK_DATA) &&  \
+        defined(SEEK_HOLE) )
+            off_t next;
+
+            next = lseek(src_fd, data, SEEK_DATA);
+            if (next < 0)
+            {
+                // ENXIO: nothing but hole up to end of file
+                if (errno == ENXIO)
+                {
+                    break;
+                }
+
+                // filesystem cannot report holes; treat it all as data
+                next = data;
+                hole = st.st_size;
+            }
+            else
+            {
+                hole = lseek(src_fd, next, SEEK_HOLE);
+                if ( (hole < 0) ||
+                     (hole > st.st_size) )
+                {
+                    hole = st.st_size;
+                }
+            }
+
+            data = next;
+  #else
+            hole = st.st_size;
+  #endif
+
+            result = d_internal_copy_segment(src_fd,
+                                             dst_fd,
+                                             data,
+                                             hole - data,
+                                             &strategy,
+                                             &buffer,
+                                             &end);
+
+            // short read: the pre-sized destination must not keep the
+            // tail the source no longer has
+            if ( (result == 0) &&
+                 (end < hole) )
+            {
+                result = d_internal_copy_tail(src_fd, dst_fd, end, &buffer);
+
+                break;
+            }
+
+            data = hole;
         }
     }
 
-    if (ferror(src_file))
+    saved_errno = errno;
+
+    free(buffer);
+
+    if (close(dst_fd) != 0)
     {
+        if (result == 0)
+        {
+            saved_errno = errno;
+        }
+
         result = -1;
     }
 
-    free(buffer);
-    fclose(src_file);
-    fclose(dst_file);
+    close(src_fd);
+    errno = saved_errno;
 
     return result;
 #endif
@@ -2616,10 +3150,6 @@ d_path_join
     const char* _path2
 )
 {
-    size_t len1;
-    size_t len2;
-    int    need_sep;
-
     // parameter validation
     if ( (!_buf)       || 
          (_bufsize == 0) )
@@ -2627,71 +3157,26 @@ d_path_join
         return NULL;
     }
 
-    // handle NULL paths
-    if ( (!_path1) && 
-         (!_path2) )
-    {
-        _buf[0] = '\0';
-
-        return _buf;
-    }
+    errno = 0;
 
-    if (!_path1)
+    if ( (d_path_join_to(_buf,
+                         _bufsize,
+                         _path1,
+                         (_path1) ? strlen(_path1) : 0,
+                         _path2,
+                         (_path2) ? strlen(_path2) : 0) == 0) &&
+         (errno != 0) )
     {
-        return d_strcpy_s(_buf, _bufsize, _path2) == 0 ? _buf : NULL;
+        return NULL;
     }
 
-    if (!_path2)
-    {
-        return d_strcpy_s(_buf, _bufsize, _path1) == 0 ? _buf : NULL;
-    }
+    return _buf;
+}
 
-    len1 = strlen(_path1);
-    len2 = strlen(_path2);
 
-    // check if separator needed
-    need_sep = 0;
-    if (len1 > 0)
-    {
-        char last = _path1[len1 - 1];
-
-        if ( (last != D_FILE_PATH_SEP) && 
-             (last != D_FILE_PATH_SEP_ALT) )
-        {
-            need_sep = 1;
-        }
-    }
-
-    // check if path2 starts with separator (absolute path)
-    if ( (len2 > 0) && 
-         ((_path2[0] == D_FILE_PATH_SEP) || (_path2[0] == D_FILE_PATH_SEP_ALT)) )
-    {
-        need_sep = 0;
-    }
-
-    // check buffer size
-    if (len1 + len2 + need_sep >= _bufsize)
-    {
-        return NULL;
-    }
-
-    d_strcpy_s(_buf, _bufsize, _path1);
-
-    if (need_sep)
-    {
-        _buf[len1]     = D_FILE_PATH_SEP;
-        _buf[len1 + 1] = '\0';
-    }
-
-    d_strcat_s(_buf, _bufsize, _path2);
-
-    return _buf;
-}
-
-
-/*
-d_path_normalize
-  Normalize path (resolve . and .., fix separators).
+/*
+d_path_normalize
+  Normalize path (resolve . and .., fix separators). See d_path_normalize_to.
 
 Parameter(s):
   _path:    input path.
@@ -2708,16 +3193,6 @@ d_path_normalize
     size_t      _bufsize
 )
 {
-    char   temp[D_FILE_PATH_MAX];
-    char*  components[D_FILE_PATH_MAX / 2];
-    int    num_components;
-    char*  p;
-    char*  token;
-    char*  saveptr;
-    size_t len;
-    int    i;
-    int    is_absolute;
-
     // parameter validation
     if ( (!_path)       || 
          (!_buf)        || 
@@ -2726,106 +3201,11 @@ d_path_normalize
         return NULL;
     }
 
-    len = strlen(_path);
-    if (len >= D_FILE_PATH_MAX)
+    if (d_path_normalize_to(_path, strlen(_path), _buf, _bufsize) == 0)
     {
         return NULL;
     }
 
-    d_strcpy_s(temp, sizeof(temp), _path);
-
-    // normalize separators
-    for (p = temp; *p; p++)
-    {
-        if (*p == D_FILE_PATH_SEP_ALT)
-        {
-            *p = D_FILE_PATH_SEP;
-        }
-    }
-
-    // check if absolute
-    is_absolute = d_path_is_absolute(temp);
-
-    // tokenize and resolve . and ..
-    num_components = 0;
-    token = d_strtok_r(temp, D_FILE_PATH_SEP_STR, &saveptr);
-
-    while (token)
-    {
-        if ( (strcmp(token, ".") == 0) || 
-             (strlen(token) == 0) )
-        {
-            // skip "." and empty components
-        }
-        else if (strcmp(token, "..") == 0)
-        {
-            // go up one level
-            if (num_components > 0)
-            {
-                num_components--;
-            }
-        }
-        else
-        {
-            components[num_components++] = token;
-        }
-
-        token = d_strtok_r(NULL, D_FILE_PATH_SEP_STR, &saveptr);
-    }
-
-    // build result
-    _buf[0] = '\0';
-
-    if (is_absolute)
-    {
-#if defined(D_FILE_PLATFORM_WINDOWS)
-        // preserve drive letter
-        if ( (len >= 2) && 
-             (_path[1] == ':') )
-        {
-            _buf[0] = _path[0];
-            _buf[1] = ':';
-            _buf[2] = D_FILE_PATH_SEP;
-            _buf[3] = '\0';
-        }
-        else
-        {
-            _buf[0] = D_FILE_PATH_SEP;
-            _buf[1] = '\0';
-        }
-#else
-        _buf[0] = D_FILE_PATH_SEP;
-        _buf[1] = '\0';
-#endif
-    }
-
-    for (i = 0; i < num_components; i++)
-    {
-        if (i > 0 || is_absolute)
-        {
-            if (strlen(_buf) + 1 >= _bufsize)
-            {
-                return NULL;
-            }
-
-            d_strcat_s(_buf, _bufsize, D_FILE_PATH_SEP_STR);
-        }
-
-        if (strlen(_buf) + strlen(components[i]) >= _bufsize)
-        {
-            return NULL;
-        }
-
-        d_strcat_s(_buf, _bufsize, components[i]);
-    }
-
-    // handle empty result
-    if (_buf[0] == '\0')
-    {
-        _buf[0] = '.';
-        _buf[1] = '\0';
-    }
-
     return _buf;
 }
 
@@ -2937,434 +3317,2858 @@ d_get_extension
 }
 
 
-///////////////////////////////////////////////////////////////////////////////
-///             XIII. SYMBOLIC LINKS                                        ///
-///////////////////////////////////////////////////////////////////////////////
+/*
+d_internal_path_is_sep
+  Returns nonzero if `_c` is the native or the alternate path separator.
+*/
+static int
+d_internal_path_is_sep
+(
+    char _c
+)
+{
+    return ( (_c == D_FILE_PATH_SEP) ||
+             (_c == D_FILE_PATH_SEP_ALT) );
+}
 
-#if D_FILE_HAS_SYMLINKS
 
 /*
-d_symlink
-  Create symbolic link.
-
-Parameter(s):
-  _target:   target path.
-  _linkpath: path for the symbolic link.
-Return:
-  0 on success, -1 on failure.
+d_internal_path_last_sep
+  Returns the index of the last separator in the first `_length` bytes of
+`_path`, or `_length` if there is none.
 */
-int
-d_symlink
+static size_t
+d_internal_path_last_sep
 (
-    const char* _target, 
-    const char* _linkpath
+    const char* _path,
+    size_t      _length
 )
 {
-    // parameter validation
-    if ( (!_target) || 
-         (!_linkpath) )
-    {
-        errno = EINVAL;
-
-        return -1;
-    }
+    size_t i;
 
-#if defined(D_FILE_PLATFORM_WINDOWS)
+    for (i = _length; i > 0; i--)
     {
-        DWORD flags;
-
-        flags = 0;
-
-        // check if target is a directory
-        if (d_is_dir(_target))
+        if (d_internal_path_is_sep(_path[i - 1]))
         {
-            flags |= SYMBOLIC_LINK_FLAG_DIRECTORY;
+            return i - 1;
         }
+    }
 
-        // try unprivileged symlink first (Windows 10 1703+)
-        flags |= SYMBOLIC_LINK_FLAG_ALLOW_UNPRIVILEGED_CREATE;
+    return _length;
+}
 
-        if (!CreateSymbolicLinkA(_linkpath, _target, flags))
-        {
-            // retry without unprivileged flag
-            flags &= ~SYMBOLIC_LINK_FLAG_ALLOW_UNPRIVILEGED_CREATE;
 
-            if (!CreateSymbolicLinkA(_linkpath, _target, flags))
-            {
-                errno = EPERM;
+/*
+d_internal_path_root
+  Measures the root prefix of an absolute path: the number of input bytes it
+spans (including any run of separators after it) and the number of bytes the
+canonical root occupies ("/", "C:\" or "\\" for UNC). Both are 0 for a
+relative path.
+*/
+static void
+d_internal_path_root
+(
+    const char* _path,
+    size_t      _length,
+    size_t*     _in_length,
+    size_t*     _out_length
+)
+{
+    size_t in;
 
-                return -1;
-            }
-        }
+    in           = 0;
+    *_out_length = 0;
 
-        return 0;
+#if defined(D_FILE_PLATFORM_WINDOWS)
+    if ( (_length >= 3) &&
+         (isalpha((unsigned char)_path[0])) &&
+         (_path[1] == ':') &&
+         (d_internal_path_is_sep(_path[2])) )
+    {
+        in           = 3;
+        *_out_length = 3;
+    }
+    else if ( (_length >= 2) &&
+              (d_internal_path_is_sep(_path[0])) &&
+              (d_internal_path_is_sep(_path[1])) )
+    {
+        in           = 2;
+        *_out_length = 2;
     }
 #else
-    return symlink(_target, _linkpath);
+    if ( (_length >= 1) &&
+         (_path[0] == D_FILE_PATH_SEP) )
+    {
+        in           = 1;
+        *_out_length = 1;
+    }
 #endif
+
+    if (*_out_length != 0)
+    {
+        while ( (in < _length) &&
+                (d_internal_path_is_sep(_path[in])) )
+        {
+            in++;
+        }
+    }
+
+    *_in_length = in;
+
+    return;
 }
 
 
 /*
-d_readlink
-  Read symbolic link target.
+d_path_dirname_slice
+  Locates the directory component of a path without copying it. Matches
+d_dirname: everything before the last separator, or the root separator alone.
+A path without separators yields an empty slice, which stands for ".".
 
 Parameter(s):
-  _path:    path to symbolic link.
-  _buf:     buffer to receive the target.
-  _bufsize: size of buffer.
+  _path:   input path; need not be null-terminated.
+  _length: number of bytes of `_path` to consider.
 Return:
-  Number of bytes placed in _buf (not null-terminated), or -1 on error.
+  Slice of `_path` holding the directory component.
 */
-ssize_t
-d_readlink
+struct d_path_slice
+d_path_dirname_slice
 (
-    const char* _path, 
-    char*       _buf, 
-    size_t      _bufsize
+    const char* _path,
+    size_t      _length
 )
 {
-    // parameter validation
-    if ( (!_path) || 
-         (!_buf)  || 
-         (_bufsize == 0) )
-    {
-        errno = EINVAL;
+    struct d_path_slice slice;
+    size_t              sep;
 
-        return -1;
-    }
+    slice.offset = 0;
+    slice.length = 0;
 
-#if defined(D_FILE_PLATFORM_WINDOWS)
+    if (!_path)
     {
-        HANDLE h;
-        char   buffer[MAXIMUM_REPARSE_DATA_BUFFER_SIZE];
-        DWORD  bytes_returned;
-        BOOL   result;
-
-        h = CreateFileA(_path,
-                        GENERIC_READ,
-                        FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
-                        NULL,
-                        OPEN_EXISTING,
-                        FILE_FLAG_BACKUP_SEMANTICS | FILE_FLAG_OPEN_REPARSE_POINT,
-                        NULL);
-
-        if (h == INVALID_HANDLE_VALUE)
-        {
-            errno = ENOENT;
-
-            return -1;
-        }
-
-        result = DeviceIoControl(h,
-                                 FSCTL_GET_REPARSE_POINT,
-                                 NULL,
-                                 0,
-                                 buffer,
-                                 sizeof(buffer),
-                                 &bytes_returned,
-                                 NULL);
-
-        CloseHandle(h);
+        return slice;
+    }
 
-        if (!result)
-        {
-            errno = EINVAL;
+    sep = d_internal_path_last_sep(_path, _length);
 
-            return -1;
-        }
+    if (sep == _length)
+    {
+        return slice;
+    }
 
-        // parse reparse point data - simplified for symlinks
-        // full implementation would parse REPARSE_DATA_BUFFER
-        errno = ENOSYS;
+    // a separator in first position is the root itself
+    slice.length = (sep == 0) ? 1 : sep;
 
-        return -1;
-    }
-#else
-    return readlink(_path, _buf, _bufsize);
-#endif
+    return slice;
 }
 
 
 /*
-d_is_symlink
-  Check if path is a symbolic link.
+d_path_basename_slice
+  Locates the final component of a path without copying it. Matches
+d_basename: everything after the last separator (empty for a trailing one).
 
 Parameter(s):
-  _path: path to check.
+  _path:   input path; need not be null-terminated.
+  _length: number of bytes of `_path` to consider.
 Return:
-  Non-zero if symlink, 0 otherwise.
+  Slice of `_path` holding the final component.
 */
-int
-d_is_symlink
+struct d_path_slice
+d_path_basename_slice
 (
-    const char* _path
+    const char* _path,
+    size_t      _length
 )
 {
-    struct d_stat_t st;
+    struct d_path_slice slice;
+    size_t              sep;
 
-    if (d_lstat(_path, &st) != 0)
+    slice.offset = 0;
+    slice.length = 0;
+
+    if (!_path)
     {
-        return 0;
+        return slice;
     }
 
-    return S_ISLNK(st.st_mode) ? 1 : 0;
-}
+    sep = d_internal_path_last_sep(_path, _length);
 
-#endif  // D_FILE_HAS_SYMLINKS
+    slice.offset = (sep == _length) ? 0 : sep + 1;
+    slice.length = _length - slice.offset;
 
+    return slice;
+}
 
-///////////////////////////////////////////////////////////////////////////////
-///             XIV.  PIPE OPERATIONS                                       ///
-///////////////////////////////////////////////////////////////////////////////
 
 /*
-d_popen
-  Open process pipe.
+d_path_extension_slice
+  Locates the extension (including the dot) of the final component of a path.
+Matches d_get_extension: a leading dot (".bashrc") is not an extension.
 
 Parameter(s):
-  _command: command to execute.
-  _mode:    mode ("r" for reading, "w" for writing).
+  _path:   input path; need not be null-terminated.
+  _length: number of bytes of `_path` to consider.
 Return:
-  File pointer on success, NULL on failure.
+  Slice of `_path` holding the extension; empty (positioned at `_length`) if
+the final component has none.
 */
-FILE*
-d_popen
+struct d_path_slice
+d_path_extension_slice
 (
-    const char* _command, 
-    const char* _mode
+    const char* _path,
+    size_t      _length
 )
 {
-    // parameter validation
-    if ( (!_command) || 
-         (!_mode) )
-    {
-        return NULL;
+    struct d_path_slice name;
+    struct d_path_slice slice;
+    size_t              i;
+
+    slice.offset = _length;
+    slice.length = 0;
+
+    if (!_path)
+    {
+        slice.offset = 0;
+
+        return slice;
+    }
+
+    name = d_path_basename_slice(_path, _length);
+
+    for (i = _length; i > name.offset + 1; i--)
+    {
+        if (_path[i - 1] == '.')
+        {
+            slice.offset = i - 1;
+            slice.length = _length - slice.offset;
+
+            break;
+        }
+    }
+
+    return slice;
+}
+
+
+/*
+d_path_next_component
+  Iterates over the components of a path without copying them. Runs of
+separators are skipped; "." and ".." are reported like any other name, and a
+root is not a component (use d_path_is_absolute to detect one).
+
+Parameter(s):
+  _path:      input path; need not be null-terminated.
+  _length:    number of bytes of `_path` to consider.
+  _cursor:    iteration state; set to 0 before the first call.
+  _component: receives the next component.
+Return:
+  Nonzero if a component was produced, 0 at the end of the path (or on
+invalid arguments, with errno set to EINVAL).
+*/
+int
+d_path_next_component
+(
+    const char*          _path,
+    size_t               _length,
+    size_t*              _cursor,
+    struct d_path_slice* _component
+)
+{
+    size_t start;
+    size_t end;
+
+    // parameter validation
+    if ( (!_path)   ||
+         (!_cursor) ||
+         (!_component) )
+    {
+        errno = EINVAL;
+
+        return 0;
+    }
+
+    start = *_cursor;
+
+    while ( (start < _length) &&
+            (d_internal_path_is_sep(_path[start])) )
+    {
+        start++;
+    }
+
+    if (start >= _length)
+    {
+        *_cursor = _length;
+
+        return 0;
+    }
+
+    end = start;
+
+    while ( (end < _length) &&
+            (!d_internal_path_is_sep(_path[end])) )
+    {
+        end++;
+    }
+
+    _component->offset = start;
+    _component->length = end - start;
+    *_cursor           = end;
+
+    return 1;
+}
+
+
+/*
+d_path_join_to
+  Joins two paths into a caller buffer, inserting a separator only when the
+first does not end with one and the second does not start with one. A NULL
+path contributes nothing. `_path1` may already live at the start of `_buf`
+(appending in place); `_path2` must not overlap `_buf`.
+
+Parameter(s):
+  _buf:     buffer to receive the result.
+  _bufsize: size of buffer.
+  _path1:   first path, or NULL.
+  _length1: number of bytes of `_path1` to use.
+  _path2:   second path, or NULL.
+  _length2: number of bytes of `_path2` to use.
+Return:
+  Length of the joined path (excluding the terminator), or 0 on failure with
+errno set to EINVAL or ERANGE. Joining two empty paths also returns 0, with
+errno left untouched.
+*/
+size_t
+d_path_join_to
+(
+    char*       _buf,
+    size_t      _bufsize,
+    const char* _path1,
+    size_t      _length1,
+    const char* _path2,
+    size_t      _length2
+)
+{
+    size_t need_sep;
+
+    // parameter validation
+    if ( (!_buf)        ||
+         (_bufsize == 0) )
+    {
+        errno = EINVAL;
+
+        return 0;
+    }
+
+    if (!_path1)
+    {
+        _length1 = 0;
+    }
+
+    if (!_path2)
+    {
+        _length2 = 0;
+    }
+
+    need_sep = 0;
+
+    if ( (_path2)       &&
+         (_length1 > 0) &&
+         (!d_internal_path_is_sep(_path1[_length1 - 1])) &&
+         ( (_length2 == 0) ||
+           (!d_internal_path_is_sep(_path2[0])) ) )
+    {
+        need_sep = 1;
+    }
+
+    if (_length1 + need_sep + _length2 >= _bufsize)
+    {
+        errno = ERANGE;
+
+        return 0;
+    }
+
+    if ( (_length1 > 0) &&
+         (_path1 != _buf) )
+    {
+        memmove(_buf, _path1, _length1);
+    }
+
+    if (need_sep)
+    {
+        _buf[_length1] = D_FILE_PATH_SEP;
+    }
+
+    if (_length2 > 0)
+    {
+        d_memcpy(_buf + _length1 + need_sep, _path2, _length2);
+    }
+
+    _buf[_length1 + need_sep + _length2] = '\0';
+
+    return _length1 + need_sep + _length2;
+}
+
+
+/*
+d_path_normalize_to
+  Lexically normalizes a path into a caller buffer in a single pass: runs of
+separators collapse, alternate separators become native ones, "." components
+are dropped and ".." removes the preceding component. A ".." at the root of an
+absolute path is dropped; leading ".." components of a relative path are kept.
+An empty result is written as ".". The output is never longer than the input,
+so `_buf` may be `_path` itself.
+
+Parameter(s):
+  _path:    input path; need not be null-terminated.
+  _length:  number of bytes of `_path` to consider.
+  _buf:     buffer to receive the result.
+  _bufsize: size of buffer.
+Return:
+  Length of the normalized path (excluding the terminator), or 0 on failure
+with errno set to EINVAL or ERANGE.
+*/
+size_t
+d_path_normalize_to
+(
+    const char* _path,
+    size_t      _length,
+    char*       _buf,
+    size_t      _bufsize
+)
+{
+    struct d_path_slice part;
+    size_t              cursor;
+    size_t              root_in;
+    size_t              root_out;
+    size_t              floor;
+    size_t              pos;
+    size_t              sep;
+    size_t              need_sep;
+
+    // parameter validation
+    if ( (!_path)       ||
+         (!_buf)        ||
+         (_bufsize == 0) )
+    {
+        errno = EINVAL;
+
+        return 0;
+    }
+
+    d_internal_path_root(_path, _length, &root_in, &root_out);
+
+    if (root_out >= _bufsize)
+    {
+        errno = ERANGE;
+
+        return 0;
+    }
+
+    // canonical root; every byte written is at or behind the byte being read
+    for (pos = 0; pos < root_out; pos++)
+    {
+        _buf[pos] = D_FILE_PATH_SEP;
+    }
+
+    // drive letter ("C:\")
+    if (root_out == 3)
+    {
+        _buf[0] = _path[0];
+        _buf[1] = ':';
+    }
+
+    floor  = root_out;    // ".." never pops below this point
+    cursor = root_in;
+
+    while (d_path_next_component(_path, _length, &cursor, &part))
+    {
+        if ( (part.length == 1) &&
+             (_path[part.offset] == '.') )
+        {
+            continue;
+        }
+
+        if ( (part.length == 2) &&
+             (_path[part.offset] == '.') &&
+             (_path[part.offset + 1] == '.') )
+        {
+            if (pos > floor)
+            {
+                // drop the last emitted component and its separator
+                sep = d_internal_path_last_sep(_buf + floor, pos - floor);
+                pos = (sep == pos - floor) ? floor : floor + sep;
+
+                continue;
+            }
+
+            if (root_out != 0)
+            {
+                continue;
+            }
+
+            // relative path climbing above its start: keep the ".."
+        }
+
+        need_sep = (pos > root_out) ? 1 : 0;
+
+        if (pos + need_sep + part.length >= _bufsize)
+        {
+            errno = ERANGE;
+
+            return 0;
+        }
+
+        if (need_sep)
+        {
+            _buf[pos++] = D_FILE_PATH_SEP;
+        }
+
+        memmove(_buf + pos, _path + part.offset, part.length);
+        pos += part.length;
+
+        if ( (root_out == 0) &&
+             (part.length == 2) &&
+             (_buf[pos - 1] == '.') &&
+             (_buf[pos - 2] == '.') )
+        {
+            floor = pos;
+        }
+    }
+
+    if (pos == 0)
+    {
+        if (_bufsize < 2)
+        {
+            errno = ERANGE;
+
+            return 0;
+        }
+
+        _buf[pos++] = '.';
+    }
+
+    _buf[pos] = '\0';
+
+    return pos;
+}
+
+
+/*
+d_internal_path_builder_reserve
+  Grows the builder so that it can hold `_length` bytes plus a terminator,
+at least doubling the capacity each time.
+*/
+static int
+d_internal_path_builder_reserve
+(
+    struct d_path_builder* _builder,
+    size_t                 _length
+)
+{
+    char*  data;
+    size_t capacity;
+
+    if (_length < _builder->capacity)
+    {
+        return 0;
+    }
+
+    capacity = (_builder->capacity > 0)
+                   ? _builder->capacity
+                   : D_PATH_BUILDER_DEFAULT_CAPACITY;
+
+    while (capacity <= _length)
+    {
+        capacity *= 2;
+    }
+
+    data = (char*)realloc(_builder->data, capacity);
+
+    if (!data)
+    {
+        errno = ENOMEM;
+
+        return -1;
+    }
+
+    _builder->data     = data;
+    _builder->capacity = capacity;
+
+    return 0;
+}
+
+
+/*
+d_path_builder_init
+  Initializes an empty path builder.
+
+Parameter(s):
+  _builder:  builder to initialize.
+  _capacity: initial buffer size, or 0 for D_PATH_BUILDER_DEFAULT_CAPACITY.
+Return:
+  0 on success, -1 on failure (errno set).
+*/
+int
+d_path_builder_init
+(
+    struct d_path_builder* _builder,
+    size_t                 _capacity
+)
+{
+    if (!_builder)
+    {
+        errno = EINVAL;
+
+        return -1;
+    }
+
+    if (_capacity == 0)
+    {
+        _capacity = D_PATH_BUILDER_DEFAULT_CAPACITY;
+    }
+
+    _builder->data = (char*)malloc(_capacity);
+
+    if (!_builder->data)
+    {
+        _builder->length   = 0;
+        _builder->capacity = 0;
+        errno              = ENOMEM;
+
+        return -1;
+    }
+
+    _builder->data[0]  = '\0';
+    _builder->length   = 0;
+    _builder->capacity = _capacity;
+
+    return 0;
+}
+
+
+/*
+d_path_builder_free
+  Releases the buffer owned by a path builder and leaves it empty.
+
+Parameter(s):
+  _builder: builder to release; may be NULL.
+Return:
+  none.
+*/
+void
+d_path_builder_free
+(
+    struct d_path_builder* _builder
+)
+{
+    if (!_builder)
+    {
+        return;
+    }
+
+    free(_builder->data);
+
+    _builder->data     = NULL;
+    _builder->length   = 0;
+    _builder->capacity = 0;
+
+    return;
+}
+
+
+/*
+d_path_builder_set
+  Replaces the builder's contents with a path. `_path` may point into the
+builder's own buffer.
+
+Parameter(s):
+  _builder: builder to modify.
+  _path:    new contents; need not be null-terminated.
+  _length:  number of bytes of `_path` to use.
+Return:
+  0 on success, -1 on failure (errno set).
+*/
+int
+d_path_builder_set
+(
+    struct d_path_builder* _builder,
+    const char*            _path,
+    size_t                 _length
+)
+{
+    if ( (!_builder) ||
+         ( (!_path) && (_length > 0) ) )
+    {
+        errno = EINVAL;
+
+        return -1;
+    }
+
+    // keep a source inside the buffer valid across a reallocation
+    if ( (_path)                      &&
+         (_builder->data)             &&
+         (_path >= _builder->data)    &&
+         (_path < _builder->data + _builder->capacity) )
+    {
+        memmove(_builder->data, _path, _length);
+    }
+    else
+    {
+        if (d_internal_path_builder_reserve(_builder, _length) != 0)
+        {
+            return -1;
+        }
+
+        if (_length > 0)
+        {
+            d_memcpy(_builder->data, _path, _length);
+        }
+    }
+
+    _builder->data[_length] = '\0';
+    _builder->length        = _length;
+
+    return 0;
+}
+
+
+/*
+d_path_builder_push
+  Appends a component, inserting a separator when needed. The returned mark
+restores the previous path when passed to d_path_builder_truncate, which is
+how a recursive walk enters and leaves a directory without reallocating.
+
+Parameter(s):
+  _builder:   builder to modify.
+  _component: component to append; need not be null-terminated.
+  _length:    number of bytes of `_component` to use.
+Return:
+  Length of the path before the push, or D_PATH_BUILDER_NPOS on failure
+(errno set); the builder is unchanged on failure.
+*/
+size_t
+d_path_builder_push
+(
+    struct d_path_builder* _builder,
+    const char*            _component,
+    size_t                 _length
+)
+{
+    size_t mark;
+    size_t need_sep;
+
+    if ( (!_builder) ||
+         ( (!_component) && (_length > 0) ) )
+    {
+        errno = EINVAL;
+
+        return D_PATH_BUILDER_NPOS;
+    }
+
+    mark     = _builder->length;
+    need_sep = 0;
+
+    if ( (mark > 0)    &&
+         (_length > 0) &&
+         (!d_internal_path_is_sep(_builder->data[mark - 1])) &&
+         (!d_internal_path_is_sep(_component[0])) )
+    {
+        need_sep = 1;
+    }
+
+    if (d_internal_path_builder_reserve(_builder,
+                                        mark + need_sep + _length) != 0)
+    {
+        return D_PATH_BUILDER_NPOS;
+    }
+
+    if (need_sep)
+    {
+        _builder->data[mark] = D_FILE_PATH_SEP;
+    }
+
+    if (_length > 0)
+    {
+        d_memcpy(_builder->data + mark + need_sep, _component, _length);
+    }
+
+    _builder->length                 = mark + need_sep + _length;
+    _builder->data[_builder->length] = '\0';
+
+    return mark;
+}
+
+
+/*
+d_path_builder_truncate
+  Cuts the path back to a mark returned by d_path_builder_push (or any length
+not greater than the current one). The buffer is kept for reuse.
+
+Parameter(s):
+  _builder: builder to modify.
+  _mark:    length to cut back to.
+Return:
+  none.
+*/
+void
+d_path_builder_truncate
+(
+    struct d_path_builder* _builder,
+    size_t                 _mark
+)
+{
+    if ( (!_builder)       ||
+         (!_builder->data) ||
+         (_mark > _builder->length) )
+    {
+        return;
+    }
+
+    _builder->length      = _mark;
+    _builder->data[_mark] = '\0';
+
+    return;
+}
+
+
+/*
+d_path_builder_pop
+  Removes the last component (and the separators before it) without going
+past the root.
+
+Parameter(s):
+  _builder: builder to modify.
+Return:
+  0 if a component was removed, -1 if there was none to remove.
+*/
+int
+d_path_builder_pop
+(
+    struct d_path_builder* _builder
+)
+{
+    size_t root_in;
+    size_t root_out;
+    size_t end;
+
+    if ( (!_builder) ||
+         (!_builder->data) )
+    {
+        return -1;
+    }
+
+    d_internal_path_root(_builder->data,
+                         _builder->length,
+                         &root_in,
+                         &root_out);
+
+    end = _builder->length;
+
+    // trailing separators, then the name, then the separators before it
+    while ( (end > root_in) &&
+            (d_internal_path_is_sep(_builder->data[end - 1])) )
+    {
+        end--;
+    }
+
+    if (end <= root_in)
+    {
+        return -1;
+    }
+
+    while ( (end > root_in) &&
+            (!d_internal_path_is_sep(_builder->data[end - 1])) )
+    {
+        end--;
+    }
+
+    while ( (end > root_in) &&
+            (d_internal_path_is_sep(_builder->data[end - 1])) )
+    {
+        end--;
+    }
+
+    _builder->length    = end;
+    _builder->data[end] = '\0';
+
+    return 0;
+}
+
+
+/*
+d_path_builder_normalize
+  Normalizes the builder's path in place (see d_path_normalize_to).
+
+Parameter(s):
+  _builder: builder to modify.
+Return:
+  0 on success, -1 on failure (errno set).
+*/
+int
+d_path_builder_normalize
+(
+    struct d_path_builder* _builder
+)
+{
+    size_t length;
+
+    if (!_builder)
+    {
+        errno = EINVAL;
+
+        return -1;
+    }
+
+    // an empty path becomes "."
+    if (d_internal_path_builder_reserve(_builder, 1) != 0)
+    {
+        return -1;
+    }
+
+    length = d_path_normalize_to(_builder->data,
+                                 _builder->length,
+                                 _builder->data,
+                                 _builder->capacity);
+
+    if (length == 0)
+    {
+        return -1;
+    }
+
+    _builder->length = length;
+
+    return 0;
+}
+
+
+///////////////////////////////////////////////////////////////////////////////
+///             XIII. SYMBOLIC LINKS                                        ///
+///////////////////////////////////////////////////////////////////////////////
+
+#if D_FILE_HAS_SYMLINKS
+
+/*
+d_symlink
+  Create symbolic link.
+
+Parameter(s):
+  _target:   target path.
+  _linkpath: path for the symbolic link.
+Return:
+  0 on success, -1 on failure.
+*/
+int
+d_symlink
+(
+    const char* _target, 
+    const char* _linkpath
+)
+{
+    // parameter validation
+    if ( (!_target) || 
+         (!_linkpath) )
+    {
+        errno = EINVAL;
+
+        return -1;
+    }
+
+#if defined(D_FILE_PLATFORM_WINDOWS)
+    {
+        DWORD flags;
+
+        flags = 0;
+
+        // check if target is a directory
+        if (d_is_dir(_target))
+        {
+            flags |= SYMBOLIC_LINK_FLAG_DIRECTORY;
+        }
+
+        // try unprivileged symlink first (Windows 10 1703+)
+        flags |= SYMBOLIC_LINK_FLAG_ALLOW_UNPRIVILEGED_CREATE;
+
+        if (!CreateSymbolicLinkA(_linkpath, _target, flags))
+        {
+            // retry without unprivileged flag
+            flags &= ~SYMBOLIC_LINK_FLAG_ALLOW_UNPRIVILEGED_CREATE;
+
+            if (!CreateSymbolicLinkA(_linkpath, _target, flags))
+            {
+                errno = EPERM;
+
+                return -1;
+            }
+        }
+
+        return 0;
+    }
+#else
+    return symlink(_target, _linkpath);
+#endif
+}
+
+
+/*
+d_readlink
+  Read symbolic link target.
+
+Parameter(s):
+  _path:    path to symbolic link.
+  _buf:     buffer to receive the target.
+  _bufsize: size of buffer.
+Return:
+  Number of bytes placed in _buf (not null-terminated), or -1 on error.
+*/
+ssize_t
+d_readlink
+(
+    const char* _path, 
+    char*       _buf, 
+    size_t      _bufsize
+)
+{
+    // parameter validation
+    if ( (!_path) || 
+         (!_buf)  || 
+         (_bufsize == 0) )
+    {
+        errno = EINVAL;
+
+        return -1;
+    }
+
+#if defined(D_FILE_PLATFORM_WINDOWS)
+    {
+        HANDLE h;
+        char   buffer[MAXIMUM_REPARSE_DATA_BUFFER_SIZE];
+        DWORD  bytes_returned;
+        BOOL   result;
+
+        h = CreateFileA(_path,
+                        GENERIC_READ,
+                        FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+                        NULL,
+                        OPEN_EXISTING,
+                        FILE_FLAG_BACKUP_SEMANTICS | FILE_FLAG_OPEN_REPARSE_POINT,
+                        NULL);
+
+        if (h == INVALID_HANDLE_VALUE)
+        {
+            errno = ENOENT;
+
+            return -1;
+        }
+
+        result = DeviceIoControl(h,
+                                 FSCTL_GET_REPARSE_POINT,
+                                 NULL,
+                                 0,
+                                 buffer,
+                                 sizeof(buffer),
+                                 &bytes_returned,
+                                 NULL);
+
+        CloseHandle(h);
+
+        if (!result)
+        {
+            errno = EINVAL;
+
+            return -1;
+        }
+
+        // parse reparse point data - simplified for symlinks
+        // full implementation would parse REPARSE_DATA_BUFFER
+        errno = ENOSYS;
+
+        return -1;
+    }
+#else
+    return readlink(_path, _buf, _bufsize);
+#endif
+}
+
+
+/*
+d_is_symlink
+  Check if path is a symbolic link.
+
+Parameter(s):
+  _path: path to check.
+Return:
+  Non-zero if symlink, 0 otherwise.
+*/
+int
+d_is_symlink
+(
+    const char* _path
+)
+{
+    struct d_stat_t st;
+
+    if (d_lstat(_path, &st) != 0)
+    {
+        return 0;
+    }
+
+    return S_ISLNK(st.st_mode) ? 1 : 0;
+}
+
+#endif  // D_FILE_HAS_SYMLINKS
+
+
+///////////////////////////////////////////////////////////////////////////////
+///             XIV.  PIPE OPERATIONS                                       ///
+///////////////////////////////////////////////////////////////////////////////
+
+/*
+d_popen
+  Open process pipe.
+
+Parameter(s):
+  _command: command to execute.
+  _mode:    mode ("r" for reading, "w" for writing).
+Return:
+  File pointer on success, NULL on failure.
+*/
+FILE*
+d_popen
+(
+    const char* _command, 
+    const char* _mode
+)
+{
+    // parameter validation
+    if ( (!_command) || 
+         (!_mode) )
+    {
+        return NULL;
+    }
+
+#if defined(D_FILE_PLATFORM_WINDOWS)
+    return _popen(_command, _mode);
+#else
+    return popen(_command, _mode);
+#endif
+}
+
+
+/*
+d_pclose
+  Close process pipe.
+
+Parameter(s):
+  _stream: file pointer from d_popen.
+Return:
+  Exit status of command, or -1 on error.
+*/
+int
+d_pclose
+(
+    FILE* _stream
+)
+{
+    // parameter validation
+    if (!_stream)
+    {
+        return -1;
+    }
+
+#if defined(D_FILE_PLATFORM_WINDOWS)
+    return _pclose(_stream);
+#else
+    return pclose(_stream);
+#endif
+}
+
+
+///////////////////////////////////////////////////////////////////////////////
+///             XV.   BINARY I/O HELPERS                                    ///
+///////////////////////////////////////////////////////////////////////////////
+
+/*
+d_fread_all
+  Read entire file into memory.
+
+Parameter(s):
+  _path: path to file.
+  _size: pointer to receive the number of bytes read (may be NULL).
+Return:
+  Pointer to allocated buffer containing file contents, or NULL on failure.
+  Caller must free the returned buffer.
+*/
+void*
+d_fread_all
+(
+    const char* _path, 
+    size_t*     _size
+)
+{
+    FILE*   file;
+    int64_t file_size;
+    void*   buffer;
+    size_t  bytes_read;
+
+    // parameter validation
+    if (!_path)
+    {
+        return NULL;
+    }
+
+    if (_size)
+    {
+        *_size = 0;
+    }
+
+    file = d_fopen(_path, "rb");
+    if (!file)
+    {
+        return NULL;
+    }
+
+    file_size = d_file_size_stream(file);
+    if (file_size < 0)
+    {
+        fclose(file);
+
+        return NULL;
+    }
+
+    buffer = malloc((size_t)file_size + 1);  // +1 for null terminator
+    if (!buffer)
+    {
+        fclose(file);
+        errno = ENOMEM;
+
+        return NULL;
+    }
+
+    bytes_read = fread(buffer, 1, (size_t)file_size, file);
+    fclose(file);
+
+    if (bytes_read != (size_t)file_size)
+    {
+        free(buffer);
+
+        return NULL;
+    }
+
+    // null-terminate for convenience with text files
+    ((char*)buffer)[bytes_read] = '\0';
+
+    if (_size)
+    {
+        *_size = bytes_read;
+    }
+
+    return buffer;
+}
+
+
+/*
+d_fwrite_all
+  Write buffer to file (creates or overwrites).
+
+Parameter(s):
+  _path: path to file.
+  _data: data to write.
+  _size: number of bytes to write.
+Return:
+  0 on success, -1 on failure.
+*/
+int
+d_fwrite_all
+(
+    const char* _path, 
+    const void* _data, 
+    size_t      _size
+)
+{
+    FILE*  file;
+    size_t bytes_written;
+
+    // parameter validation
+    if ( (!_path) || 
+         ((!_data) && (_size > 0)) )
+    {
+        errno = EINVAL;
+
+        return -1;
+    }
+
+    file = d_fopen(_path, "wb");
+    if (!file)
+    {
+        return -1;
+    }
+
+    if (_size > 0)
+    {
+        bytes_written = fwrite(_data, 1, _size, file);
+        if (bytes_written != _size)
+        {
+            fclose(file);
+
+            return -1;
+        }
+    }
+
+    fclose(file);
+
+    return 0;
+}
+
+/*
+d_fappend_all
+  Append buffer to file.
+
+Parameter(s):
+  _path: path to file.
+  _data: data to append.
+  _size: number of bytes to append.
+Return:
+  0 on success, -1 on failure.
+*/
+int
+d_fappend_all
+(
+    const char* _path, 
+    const void* _data, 
+    size_t      _size
+)
+{
+    FILE*  file;
+    size_t bytes_written;
+
+    // parameter validation
+    if ( (!_path) || 
+         ( (!_data) && (_size > 0) ) )
+    {
+        errno = EINVAL;
+
+        return -1;
+    }
+
+    file = d_fopen(_path, "ab");
+    if (!file)
+    {
+        return -1;
+    }
+
+    if (_size > 0)
+    {
+        bytes_written = fwrite(_data, 1, _size, file);
+        if (bytes_written != _size)
+        {
+            fclose(file);
+
+            return -1;
+        }
+    }
+
+    fclose(file);
+
+    return 0;
+}
+
+
+
+/*
+d_internal_atomic_stage
+  Writes `_data` to a fresh temporary file next to `_path` (same directory, so
+the final rename cannot cross filesystems). The temporary gets the mode of the
+file it will replace, or rw-r--r-- if `_path` does not exist yet.
+
+Parameter(s):
+  _path: final destination path.
+  _data: data to write.
+  _size: number of bytes to write.
+  _temp: receives the heap-allocated temporary path (caller frees).
+  _fd:   receives the open descriptor of the temporary.
+Return:
+  0 on success, -1 on failure (nothing is left behind on failure).
+*/
+static int
+d_internal_atomic_stage
+(
+    const char* _path,
+    const void* _data,
+    size_t      _size,
+    char**      _temp,
+    int*        _fd
+)
+{
+    static const char suffix[] = ".tmpXXXXXX";
+    struct d_stat_t   st;
+    char*             temp;
+    size_t            length;
+    size_t            done;
+    ssize_t           written;
+    int               fd;
+    int               saved_errno;
+
+    length = strlen(_path);
+    temp   = malloc(length + sizeof(suffix));
+
+    if (!temp)
+    {
+        errno = ENOMEM;
+
+        return -1;
+    }
+
+    d_memcpy(temp, _path, length);
+    d_memcpy(temp + length, suffix, sizeof(suffix));
+
+    fd = d_mkstemp(temp);
+    if (fd < 0)
+    {
+        saved_errno = errno;
+        free(temp);
+        errno = saved_errno;
+
+        return -1;
+    }
+
+#if defined(D_FILE_PLATFORM_POSIX)
+    // mkstemp creates 0600; match what is being replaced
+    fchmod(fd,
+           (d_stat(_path, &st) == 0) ? (mode_t)(st.st_mode & 0777)
+                                     : (mode_t)(S_IRUSR | S_IWUSR |
+                                                S_IRGRP | S_IROTH));
+#else
+    (void)st;
+#endif
+
+    for (done = 0; done < _size; )
+    {
+        written = d_write(fd, (const char*)_data + done, _size - done);
+        if (written < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+
+            saved_errno = errno;
+            d_close(fd);
+            d_unlink(temp);
+            free(temp);
+            errno = saved_errno;
+
+            return -1;
+        }
+
+        done += (size_t)written;
+    }
+
+    *_temp = temp;
+    *_fd   = fd;
+
+    return 0;
+}
+
+
+/*
+d_internal_atomic_publish
+  Renames a synced temporary file over its destination, replacing it in a
+single step.
+
+Parameter(s):
+  _temp: temporary path.
+  _path: final destination path.
+Return:
+  0 on success, -1 on failure.
+*/
+static int
+d_internal_atomic_publish
+(
+    const char* _temp,
+    const char* _path
+)
+{
+#if defined(D_FILE_PLATFORM_WINDOWS)
+    if (!MoveFileExA(_temp,
+                     _path,
+                     MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH))
+    {
+        errno = EACCES;
+
+        return -1;
+    }
+
+    return 0;
+#else
+    return rename(_temp, _path);
+#endif
+}
+
+
+/*
+d_internal_atomic_sync_parent
+  Synchronizes the directory containing `_path`.
+
+Parameter(s):
+  _path: path whose parent directory should be synchronized.
+Return:
+  0 on success, -1 on failure.
+*/
+static int
+d_internal_atomic_sync_parent
+(
+    const char* _path
+)
+{
+    char dir[D_FILE_PATH_MAX];
+
+    if (!d_dirname(_path, dir, sizeof(dir)))
+    {
+        errno = ENAMETOOLONG;
+
+        return -1;
+    }
+
+    return d_fsync_dir(dir);
+}
+
+
+/*
+d_fwrite_all_atomic
+  Write buffer to file such that, after a crash at any point, the file holds
+either its complete previous contents or the complete new contents. The data
+is written to a sibling temporary file, synced, renamed over `_path`, and the
+directory is synced so the rename itself survives the crash.
+  Each call pays two synchronous flushes; to write many files, stage them in
+a d_fwrite_group and commit once instead.
+
+Parameter(s):
+  _path: path to file.
+  _data: data to write.
+  _size: number of bytes to write.
+Return:
+  0 on success, -1 on failure. On failure `_path` is untouched.
+*/
+int
+d_fwrite_all_atomic
+(
+    const char* _path,
+    const void* _data,
+    size_t      _size
+)
+{
+    char* temp;
+    int   fd;
+    int   synced;
+    int   closed;
+    int   saved_errno;
+
+    // parameter validation
+    if ( (!_path) ||
+         ( (!_data) && (_size > 0) ) )
+    {
+        errno = EINVAL;
+
+        return -1;
+    }
+
+    if (d_internal_atomic_stage(_path, _data, _size, &temp, &fd) != 0)
+    {
+        return -1;
+    }
+
+    synced = d_fsync(fd);
+    closed = d_close(fd);
+
+    if ( (synced != 0) ||
+         (closed != 0) )
+    {
+        saved_errno = errno;
+        d_unlink(temp);
+        free(temp);
+        errno = saved_errno;
+
+        return -1;
+    }
+
+    if (d_internal_atomic_publish(temp, _path) != 0)
+    {
+        saved_errno = errno;
+        d_unlink(temp);
+        free(temp);
+        errno = saved_errno;
+
+        return -1;
+    }
+
+    free(temp);
+
+    return d_internal_atomic_sync_parent(_path);
+}
+
+
+/*
+d_fwrite_group_new
+  Create an empty write group. A write group stages any number of atomic file
+writes and makes them durable together in d_fwrite_group_commit, so that the
+cost of synchronous flushes is shared by the whole batch instead of being paid
+once or twice per file.
+
+Parameter(s):
+  none.
+Return:
+  A new group, or NULL on allocation failure. Free with d_fwrite_group_free.
+*/
+struct d_fwrite_group*
+d_fwrite_group_new
+(
+    void
+)
+{
+    struct d_fwrite_group* group;
+
+    group = malloc(sizeof(struct d_fwrite_group));
+    if (!group)
+    {
+        errno = ENOMEM;
+
+        return NULL;
+    }
+
+    d_memset(group, 0, sizeof(struct d_fwrite_group));
+
+    return group;
+}
+
+
+/*
+d_fwrite_group_add
+  Stage an atomic write of `_data` to `_path`. The data goes to a sibling
+temporary file immediately, but `_path` is not touched until the group is
+committed. Staging the same path twice is allowed; the later write wins.
+  Every staged write holds a file descriptor open until commit or abort.
+
+Parameter(s):
+  _group: write group.
+  _path:  path to file.
+  _data:  data to write.
+  _size:  number of bytes to write.
+Return:
+  0 on success, -1 on failure (the group is unchanged on failure).
+*/
+int
+d_fwrite_group_add
+(
+    struct d_fwrite_group* _group,
+    const char*            _path,
+    const void*            _data,
+    size_t                 _size
+)
+{
+    struct d_internal_fwrite_entry* entries;
+    size_t                          capacity;
+    char*                           path;
+    char*                           temp;
+    int                             fd;
+    int                             saved_errno;
+
+    // parameter validation
+    if ( (!_group) ||
+         (!_path)  ||
+         ( (!_data) && (_size > 0) ) )
+    {
+        errno = EINVAL;
+
+        return -1;
+    }
+
+    if (_group->count == _group->capacity)
+    {
+        capacity = (_group->capacity) ? (_group->capacity * 2) : 8;
+        entries  = realloc(_group->entries,
+                           capacity * sizeof(struct d_internal_fwrite_entry));
+
+        if (!entries)
+        {
+            errno = ENOMEM;
+
+            return -1;
+        }
+
+        _group->entries  = entries;
+        _group->capacity = capacity;
+    }
+
+    path = d_strdup(_path);
+    if (!path)
+    {
+        errno = ENOMEM;
+
+        return -1;
+    }
+
+    if (d_internal_atomic_stage(_path, _data, _size, &temp, &fd) != 0)
+    {
+        saved_errno = errno;
+        free(path);
+        errno = saved_errno;
+
+        return -1;
+    }
+
+    _group->entries[_group->count].path = path;
+    _group->entries[_group->count].temp = temp;
+    _group->entries[_group->count].fd   = fd;
+    _group->count++;
+
+    return 0;
+}
+
+
+/*
+d_fwrite_group_count
+  Number of writes currently staged in a group.
+
+Parameter(s):
+  _group: write group.
+Return:
+  The number of staged writes (0 for NULL).
+*/
+size_t
+d_fwrite_group_count
+(
+    const struct d_fwrite_group* _group
+)
+{
+    return (_group) ? _group->count : 0;
+}
+
+
+/*
+d_fwrite_group_commit
+  Make every staged write durable and visible. The commit runs in phases:
+  1. start write-back of all temporaries at once (Linux: sync_file_range), so
+     the device sees one large batch instead of a trickle;
+  2. fsync each temporary; after the first, these mostly find their data
+     already on disk and the filesystem journal already committed;
+  3. rename each temporary over its destination, in staging order;
+  4. fsync each distinct parent directory once.
+  Each destination individually has the same all-or-nothing guarantee as
+d_fwrite_all_atomic. The batch as a whole is not transactional: a crash
+during phase 3 can leave some destinations updated and others not.
+  The group is empty (and reusable) after commit, whether it succeeded or not.
+
+Parameter(s):
+  _group: write group.
+Return:
+  0 on success, -1 if any write could not be made durable. If the failure
+  happens before phase 3, no destination has been modified.
+*/
+int
+d_fwrite_group_commit
+(
+    struct d_fwrite_group* _group
+)
+{
+    struct d_internal_fwrite_entry* entry;
+    char                            dir[D_FILE_PATH_MAX];
+    char                            last_dir[D_FILE_PATH_MAX];
+    size_t                          i;
+    int                             synced;
+    int                             closed;
+    int                             result;
+    int                             saved_errno;
+
+    // parameter validation
+    if (!_group)
+    {
+        errno = EINVAL;
+
+        return -1;
+    }
+
+    result      = 0;
+    saved_errno = 0;
+
+#if ( defined(D_ENV_PLATFORM_LINUX) &&   \
+      defined(__NR_sync_file_range) && \
+      defined(SYNC_FILE_RANGE_WRITE) )
+    // phase 1: queue write-back for the whole batch before waiting on any.
+    // glibc only declares sync_file_range under _GNU_SOURCE, so go through
+    // syscall as d_internal_copy_segment does for copy_file_range; the
+    // offsets are passed as 64-bit values so 32-bit ABIs split them into
+    // register pairs as the kernel expects.
+    for (i = 0; i < _group->count; i++)
+    {
+        syscall(__NR_sync_file_range,
+                _group->entries[i].fd,
+                (int64_t)0,
+                (int64_t)0,
+                (unsigned int)SYNC_FILE_RANGE_WRITE);
+    }
+#endif
+
+    // phase 2: wait for data; abandon the batch if any file cannot be synced
+    for (i = 0; i < _group->count; i++)
+    {
+        entry = &_group->entries[i];
+
+        synced    = d_fsync(entry->fd);
+        closed    = d_close(entry->fd);
+        entry->fd = -1;
+
+        if ( (synced != 0) ||
+             (closed != 0) )
+        {
+            saved_errno = errno;
+            d_fwrite_group_abort(_group);
+            errno = saved_errno;
+
+            return -1;
+        }
+    }
+
+    // phase 3: publish
+    for (i = 0; i < _group->count; i++)
+    {
+        entry = &_group->entries[i];
+
+        if (d_internal_atomic_publish(entry->temp, entry->path) != 0)
+        {
+            saved_errno = errno;
+            result      = -1;
+            d_unlink(entry->temp);
+        }
+    }
+
+    // phase 4: sync each parent directory once; groups are usually written
+    // into one or a few directories, so comparing against the previous entry
+    // skips nearly all repeats without any bookkeeping
+    last_dir[0] = '\0';
+
+    for (i = 0; i < _group->count; i++)
+    {
+        if (!d_dirname(_group->entries[i].path, dir, sizeof(dir)))
+        {
+            saved_errno = ENAMETOOLONG;
+            result      = -1;
+
+            continue;
+        }
+
+        if (strcmp(dir, last_dir) == 0)
+        {
+            continue;
+        }
+
+        if (d_fsync_dir(dir) != 0)
+        {
+            saved_errno = errno;
+            result      = -1;
+        }
+
+        d_memcpy(last_dir, dir, strlen(dir) + 1);
+    }
+
+    // release bookkeeping; temporaries are gone (renamed or unlinked)
+    for (i = 0; i < _group->count; i++)
+    {
+        free(_group->entries[i].path);
+        free(_group->entries[i].temp);
+    }
+
+    _group->count = 0;
+
+    if (result != 0)
+    {
+        errno = saved_errno;
+    }
+
+    return result;
+}
+
+
+/*
+d_fwrite_group_abort
+  Discard every staged write; no destination is modified.
+
+Parameter(s):
+  _group: write group.
+Return:
+  none.
+*/
+void
+d_fwrite_group_abort
+(
+    struct d_fwrite_group* _group
+)
+{
+    size_t i;
+
+    if (!_group)
+    {
+        return;
+    }
+
+    for (i = 0; i < _group->count; i++)
+    {
+        if (_group->entries[i].fd >= 0)
+        {
+            d_close(_group->entries[i].fd);
+        }
+
+        d_unlink(_group->entries[i].temp);
+        free(_group->entries[i].path);
+        free(_group->entries[i].temp);
+    }
+
+    _group->count = 0;
+
+    return;
+}
+
+
+/*
+d_fwrite_group_free
+  Abort any staged writes and free the group.
+
+Parameter(s):
+  _group: write group (may be NULL).
+Return:
+  none.
+*/
+void
+d_fwrite_group_free
+(
+    struct d_fwrite_group* _group
+)
+{
+    if (!_group)
+    {
+        return;
+    }
+
+    d_fwrite_group_abort(_group);
+    free(_group->entries);
+    free(_group);
+
+    return;
+}
+
+
+///////////////////////////////////////////////////////////////////////////////
+///             XVI.  MEMORY-MAPPED FILES                                   ///
+///////////////////////////////////////////////////////////////////////////////
+
+#if D_FILE_HAS_MMAP
+
+// MAP_ANONYMOUS is spelled MAP_ANON on older BSD-derived systems
+#if ( defined(D_FILE_PLATFORM_POSIX) &&  \
+      (!defined(MAP_ANONYMOUS))      &&  \
+      defined(MAP_ANON) )
+    #define MAP_ANONYMOUS MAP_ANON
+#endif
+
+/*
+d_internal_mmap_system_page
+  Returns the virtual memory page size. This is the granularity at which the
+kernel zero-fills the tail of a mapping and at which madvise/msync operate; on
+Windows it is smaller than the offset alignment returned by d_mmap_page_size.
+
+Parameter(s):
+  none.
+Return:
+  The page size in bytes.
+*/
+static size_t
+d_internal_mmap_system_page
+(
+    void
+)
+{
+    static size_t page = 0;
+
+    if (!page)
+    {
+#if defined(D_FILE_PLATFORM_WINDOWS)
+        SYSTEM_INFO info;
+
+        GetSystemInfo(&info);
+        page = (size_t)info.dwPageSize;
+#else
+        long value;
+
+        value = sysconf(_SC_PAGESIZE);
+        page  = (value > 0) ? (size_t)value : 4096;
+#endif
+    }
+
+    return page;
+}
+
+
+/*
+d_internal_mmap_subrange
+  Resolves a byte range relative to a mapping's requested data into a
+page-aligned address range suitable for the platform advise/sync calls.
+
+Parameter(s):
+  _map:    mapping the range lies in.
+  _offset: offset of the range from `_map->data`.
+  _length: length of the range, or 0 for "to the end of the mapping".
+  _addr:   receives the page-aligned start address.
+  _bytes:  receives the length measured from `*_addr`.
+Return:
+  0 on success, -1 (errno = EINVAL) if the range is outside the mapping.
+*/
+static int
+d_internal_mmap_subrange
+(
+    const struct d_mmap_t* _map,
+    size_t                 _offset,
+    size_t                 _length,
+    char**                 _addr,
+    size_t*                _bytes
+)
+{
+    char*  start;
+    size_t page;
+    size_t slack;
+
+    if ( (!_map)                        ||
+         (_offset > _map->size)         ||
+         (_length > _map->size - _offset) )
+    {
+        errno = EINVAL;
+
+        return -1;
+    }
+
+    if (_length == 0)
+    {
+        _length = _map->size - _offset;
+    }
+
+    start = (char*)_map->data + _offset;
+    page  = d_internal_mmap_system_page();
+    slack = (size_t)((uintptr_t)start % page);
+
+    *_addr  = start - slack;
+    *_bytes = _length + slack;
+
+    return 0;
+}
+
+
+/*
+d_mmap_page_size
+  Returns the alignment that the underlying platform requires for mapping
+offsets. d_mmap_range and d_mmap_fd accept any offset and round down to this
+internally, but callers that tile a large file into windows should choose
+window boundaries that are multiples of this value to avoid overlap.
+
+Parameter(s):
+  none.
+Return:
+  The mapping offset granularity in bytes (page size on POSIX, allocation
+  granularity on Windows).
+*/
+size_t
+d_mmap_page_size
+(
+    void
+)
+{
+#if defined(D_FILE_PLATFORM_WINDOWS)
+    static size_t granularity = 0;
+
+    if (!granularity)
+    {
+        SYSTEM_INFO info;
+
+        GetSystemInfo(&info);
+        granularity = (size_t)info.dwAllocationGranularity;
+    }
+
+    return granularity;
+#else
+    return d_internal_mmap_system_page();
+#endif
+}
+
+
+/*
+d_mmap_fd
+  Map a byte range of an open file descriptor into memory. The descriptor may
+be closed once this returns; the mapping keeps its own reference to the file.
+  An empty range (including any range of an empty file) succeeds and yields a
+mapping with `data == NULL` and `size == 0`, which d_munmap accepts.
+
+Parameter(s):
+  _fd:     file descriptor opened with access compatible with `_flags`
+           (read for D_MMAP_READ/D_MMAP_PRIVATE, read-write for
+           D_MMAP_WRITE without D_MMAP_PRIVATE).
+  _offset: file offset of the first byte to map; need not be aligned.
+  _length: number of bytes to map, or 0 to map through end of file.
+  _flags:  combination of D_MMAP_* flags; D_MMAP_READ is implied.
+  _map:    receives the mapping.
+Return:
+  0 on success, -1 on failure (errno is set). The range must lie within the
+  current file size; mapping past end of file is rejected with EINVAL.
+*/
+int
+d_mmap_fd
+(
+    int              _fd,
+    d_off_t          _offset,
+    size_t           _length,
+    int              _flags,
+    struct d_mmap_t* _map
+)
+{
+    struct d_stat_t st;
+    uint64_t        file_size;
+    uint64_t        aligned;
+    size_t          delta;
+    size_t          map_length;
+    void*           base;
+
+    // parameter validation
+    if ( (!_map) ||
+         (_offset < 0) )
+    {
+        errno = EINVAL;
+
+        return -1;
+    }
+
+    if (_fd < 0)
+    {
+        errno = EBADF;
+
+        return -1;
+    }
+
+    d_memset(_map, 0, sizeof(struct d_mmap_t));
+
+    if (d_fstat(_fd, &st) != 0)
+    {
+        return -1;
+    }
+
+    file_size = st.st_size;
+
+    if ((uint64_t)_offset > file_size)
+    {
+        errno = EINVAL;
+
+        return -1;
+    }
+
+    if (_length == 0)
+    {
+        if (file_size - (uint64_t)_offset > (uint64_t)SIZE_MAX)
+        {
+            errno = EOVERFLOW;
+
+            return -1;
+        }
+
+        _length = (size_t)(file_size - (uint64_t)_offset);
+    }
+    else if ((uint64_t)_length > file_size - (uint64_t)_offset)
+    {
+        errno = EINVAL;
+
+        return -1;
+    }
+
+    _map->offset = _offset;
+    _map->flags  = _flags | D_MMAP_READ;
+
+    // nothing to map; an empty view is still a valid view
+    if (_length == 0)
+    {
+        return 0;
+    }
+
+    aligned = (uint64_t)_offset - ((uint64_t)_offset % d_mmap_page_size());
+    delta   = (size_t)((uint64_t)_offset - aligned);
+
+    if (_length > SIZE_MAX - delta)
+    {
+        errno = EOVERFLOW;
+
+        return -1;
+    }
+
+    map_length = _length + delta;
+
+#if defined(D_FILE_PLATFORM_WINDOWS)
+    {
+        HANDLE file;
+        HANDLE mapping;
+        DWORD  protect;
+        DWORD  access;
+
+        file = (HANDLE)_get_osfhandle(_fd);
+        if (file == INVALID_HANDLE_VALUE)
+        {
+            errno = EBADF;
+
+            return -1;
+        }
+
+        if (_flags & D_MMAP_PRIVATE)
+        {
+            protect = PAGE_WRITECOPY;
+            access  = FILE_MAP_COPY;
+        }
+        else if (_flags & D_MMAP_WRITE)
+        {
+            protect = PAGE_READWRITE;
+            access  = FILE_MAP_WRITE;
+        }
+        else
+        {
+            protect = PAGE_READONLY;
+            access  = FILE_MAP_READ;
+        }
+
+        mapping = CreateFileMappingA(file, NULL, protect, 0, 0, NULL);
+        if (!mapping)
+        {
+            errno = EACCES;
+
+            return -1;
+        }
+
+        base = MapViewOfFile(mapping,
+                             access,
+                             (DWORD)(aligned >> 32),
+                             (DWORD)(aligned & 0xFFFFFFFFu),
+                             map_length);
+
+        // the view holds its own reference to the section object
+        CloseHandle(mapping);
+
+        if (!base)
+        {
+            errno = (GetLastError() == ERROR_NOT_ENOUGH_MEMORY) ? ENOMEM
+                                                                : EACCES;
+
+            return -1;
+        }
+
+        // keep a handle so d_msync can flush file metadata and data
+        _map->file = NULL;
+
+        if ( (_flags & D_MMAP_WRITE) &&
+             (!(_flags & D_MMAP_PRIVATE)) )
+        {
+            DuplicateHandle(GetCurrentProcess(),
+                            file,
+                            GetCurrentProcess(),
+                            &_map->file,
+                            0,
+                            FALSE,
+                            DUPLICATE_SAME_ACCESS);
+        }
+    }
+#else
+    {
+        int prot;
+        int mflags;
+
+        prot   = PROT_READ;
+        mflags = (_flags & D_MMAP_PRIVATE) ? MAP_PRIVATE : MAP_SHARED;
+
+        if (_flags & (D_MMAP_WRITE | D_MMAP_PRIVATE))
+        {
+            prot |= PROT_WRITE;
+        }
+
+    #if defined(MAP_POPULATE)
+        if (_flags & D_MMAP_POPULATE)
+        {
+            mflags |= MAP_POPULATE;
+        }
+    #endif
+
+        base = mmap(NULL,
+                    map_length,
+                    prot,
+                    mflags,
+                    _fd,
+                    (off_t)aligned);
+
+        if (base == MAP_FAILED)
+        {
+            return -1;
+        }
+    }
+#endif
+
+    _map->base   = base;
+    _map->length = map_length;
+    _map->data   = (char*)base + delta;
+    _map->size   = _length;
+
+#if ( defined(D_FILE_PLATFORM_WINDOWS) ||  \
+      (!defined(MAP_POPULATE)) )
+    if (_flags & D_MMAP_POPULATE)
+    {
+        d_mmap_prefetch(_map, 0, 0);
+    }
+#endif
+
+    return 0;
+}
+
+
+/*
+d_mmap_range
+  Map a byte range of a file into memory.
+
+Parameter(s):
+  _path:   path to file.
+  _offset: file offset of the first byte to map; need not be aligned.
+  _length: number of bytes to map, or 0 to map through end of file.
+  _flags:  combination of D_MMAP_* flags.
+  _map:    receives the mapping.
+Return:
+  0 on success, -1 on failure (errno is set).
+*/
+int
+d_mmap_range
+(
+    const char*      _path,
+    d_off_t          _offset,
+    size_t           _length,
+    int              _flags,
+    struct d_mmap_t* _map
+)
+{
+    int fd;
+    int open_flags;
+    int result;
+    int saved_errno;
+
+    // parameter validation
+    if ( (!_path) ||
+         (!_map) )
+    {
+        errno = EINVAL;
+
+        return -1;
+    }
+
+    open_flags = ( (_flags & D_MMAP_WRITE) &&
+                   (!(_flags & D_MMAP_PRIVATE)) ) ? O_RDWR
+                                                  : O_RDONLY;
+#if defined(O_BINARY)
+    open_flags |= O_BINARY;
+#endif
+#if defined(O_CLOEXEC)
+    open_flags |= O_CLOEXEC;
+#endif
+
+    fd = d_open(_path, open_flags);
+    if (fd < 0)
+    {
+        return -1;
     }
 
-#if defined(D_FILE_PLATFORM_WINDOWS)
-    return _popen(_command, _mode);
-#else
-    return popen(_command, _mode);
-#endif
+    result      = d_mmap_fd(fd, _offset, _length, _flags, _map);
+    saved_errno = errno;
+
+    d_close(fd);
+    errno = saved_errno;
+
+    return result;
 }
 
 
 /*
-d_pclose
-  Close process pipe.
+d_mmap
+  Map an entire file into memory.
 
 Parameter(s):
-  _stream: file pointer from d_popen.
+  _path:  path to file.
+  _flags: combination of D_MMAP_* flags.
+  _map:   receives the mapping.
 Return:
-  Exit status of command, or -1 on error.
+  0 on success, -1 on failure (errno is set).
 */
 int
-d_pclose
+d_mmap
 (
-    FILE* _stream
+    const char*      _path,
+    int              _flags,
+    struct d_mmap_t* _map
+)
+{
+    return d_mmap_range(_path, 0, 0, _flags, _map);
+}
+
+
+/*
+d_munmap
+  Release a mapping created by d_mmap, d_mmap_range, d_mmap_fd or
+d_fread_all_view. Dirty pages of a shared writable mapping are still written
+back by the system, but not synchronously; call d_msync with D_MSYNC_SYNC
+first if durability matters. The structure is zeroed on return.
+
+Parameter(s):
+  _map: mapping to release.
+Return:
+  0 on success, -1 on failure.
+*/
+int
+d_munmap
+(
+    struct d_mmap_t* _map
 )
 {
+    int result;
+
     // parameter validation
-    if (!_stream)
+    if (!_map)
     {
+        errno = EINVAL;
+
         return -1;
     }
 
+    result = 0;
+
+    if (_map->base)
+    {
 #if defined(D_FILE_PLATFORM_WINDOWS)
-    return _pclose(_stream);
+        if (!UnmapViewOfFile(_map->base))
+        {
+            errno  = EINVAL;
+            result = -1;
+        }
+
+        if (_map->file)
+        {
+            CloseHandle(_map->file);
+        }
 #else
-    return pclose(_stream);
+        result = munmap(_map->base, _map->length);
 #endif
-}
+    }
 
+    d_memset(_map, 0, sizeof(struct d_mmap_t));
+
+    return result;
+}
 
-///////////////////////////////////////////////////////////////////////////////
-///             XV.   BINARY I/O HELPERS                                    ///
-///////////////////////////////////////////////////////////////////////////////
 
 /*
-d_fread_all
-  Read entire file into memory.
+d_madvise
+  Give the system an access-pattern hint for part of a mapping. Hints that a
+platform does not support are accepted and ignored.
 
 Parameter(s):
-  _path: path to file.
-  _size: pointer to receive the number of bytes read (may be NULL).
+  _map:    mapping the range lies in.
+  _offset: offset of the range from the start of the mapped data.
+  _length: length of the range, or 0 for "to the end of the mapping".
+  _advice: one of the D_MADV_* constants.
 Return:
-  Pointer to allocated buffer containing file contents, or NULL on failure.
-  Caller must free the returned buffer.
+  0 on success, -1 on failure.
 */
-void*
-d_fread_all
+int
+d_madvise
 (
-    const char* _path, 
-    size_t*     _size
+    const struct d_mmap_t* _map,
+    size_t                 _offset,
+    size_t                 _length,
+    int                    _advice
 )
 {
-    FILE*   file;
-    int64_t file_size;
-    void*   buffer;
-    size_t  bytes_read;
+    char*  addr;
+    size_t bytes;
 
-    // parameter validation
-    if (!_path)
+    if (d_internal_mmap_subrange(_map, _offset, _length, &addr, &bytes) != 0)
     {
-        return NULL;
+        return -1;
     }
 
-    if (_size)
+    if (bytes == 0)
     {
-        *_size = 0;
+        return 0;
     }
 
-    file = d_fopen(_path, "rb");
-    if (!file)
+#if defined(D_FILE_PLATFORM_WINDOWS)
+    switch (_advice)
     {
-        return NULL;
-    }
+        case D_MADV_WILLNEED:
+        #if ( defined(_WIN32_WINNT) &&  \
+              (_WIN32_WINNT >= 0x0602) )
+        {
+            WIN32_MEMORY_RANGE_ENTRY entry;
 
-    file_size = d_file_size_stream(file);
-    if (file_size < 0)
-    {
-        fclose(file);
+            entry.VirtualAddress = addr;
+            entry.NumberOfBytes  = bytes;
 
-        return NULL;
+            // best effort: failure only means no readahead happens
+            PrefetchVirtualMemory(GetCurrentProcess(), 1, &entry, 0);
+        }
+        #endif
+            break;
+
+        case D_MADV_DONTNEED:
+            // unlocking unlocked pages trims them from the working set
+            VirtualUnlock(addr, bytes);
+            break;
+
+        case D_MADV_NORMAL:
+        case D_MADV_SEQUENTIAL:
+        case D_MADV_RANDOM:
+            break;
+
+        default:
+            errno = EINVAL;
+
+            return -1;
     }
 
-    buffer = malloc((size_t)file_size + 1);  // +1 for null terminator
-    if (!buffer)
+    return 0;
+#else
     {
-        fclose(file);
-        errno = ENOMEM;
+        int native;
+        int error;
 
-        return NULL;
-    }
+        switch (_advice)
+        {
+            case D_MADV_NORMAL:
+                native = POSIX_MADV_NORMAL;
+                break;
 
-    bytes_read = fread(buffer, 1, (size_t)file_size, file);
-    fclose(file);
+            case D_MADV_SEQUENTIAL:
+                native = POSIX_MADV_SEQUENTIAL;
+                break;
 
-    if (bytes_read != (size_t)file_size)
-    {
-        free(buffer);
+            case D_MADV_RANDOM:
+                native = POSIX_MADV_RANDOM;
+                break;
 
-        return NULL;
-    }
+            case D_MADV_WILLNEED:
+                native = POSIX_MADV_WILLNEED;
+                break;
 
-    // null-terminate for convenience with text files
-    ((char*)buffer)[bytes_read] = '\0';
+            case D_MADV_DONTNEED:
+                native = POSIX_MADV_DONTNEED;
+                break;
 
-    if (_size)
-    {
-        *_size = bytes_read;
+            default:
+                errno = EINVAL;
+
+                return -1;
+        }
+
+        // posix_madvise reports failure through its return value
+        error = posix_madvise(addr, bytes, native);
+        if (error != 0)
+        {
+            errno = error;
+
+            return -1;
+        }
+
+        return 0;
     }
+#endif
+}
 
-    return buffer;
+
+/*
+d_mmap_prefetch
+  Ask the system to start reading part of a mapping in ahead of use, so that
+a following scan does not stall on page faults.
+
+Parameter(s):
+  _map:    mapping the range lies in.
+  _offset: offset of the range from the start of the mapped data.
+  _length: length of the range, or 0 for "to the end of the mapping".
+Return:
+  0 on success, -1 on failure.
+*/
+int
+d_mmap_prefetch
+(
+    const struct d_mmap_t* _map,
+    size_t                 _offset,
+    size_t                 _length
+)
+{
+    return d_madvise(_map, _offset, _length, D_MADV_WILLNEED);
 }
 
 
 /*
-d_fwrite_all
-  Write buffer to file (creates or overwrites).
+d_msync
+  Write modified pages of a shared writable mapping back to the file.
 
 Parameter(s):
-  _path: path to file.
-  _data: data to write.
-  _size: number of bytes to write.
+  _map:    mapping the range lies in.
+  _offset: offset of the range from the start of the mapped data.
+  _length: length of the range, or 0 for "to the end of the mapping".
+  _mode:   D_MSYNC_SYNC to wait until the data reaches storage, or
+           D_MSYNC_ASYNC to only schedule the write-back.
 Return:
   0 on success, -1 on failure.
 */
 int
-d_fwrite_all
+d_msync
 (
-    const char* _path, 
-    const void* _data, 
-    size_t      _size
+    const struct d_mmap_t* _map,
+    size_t                 _offset,
+    size_t                 _length,
+    int                    _mode
 )
 {
-    FILE*  file;
-    size_t bytes_written;
+    char*  addr;
+    size_t bytes;
 
-    // parameter validation
-    if ( (!_path) || 
-         ((!_data) && (_size > 0)) )
+    if (d_internal_mmap_subrange(_map, _offset, _length, &addr, &bytes) != 0)
     {
-        errno = EINVAL;
-
         return -1;
     }
 
-    file = d_fopen(_path, "wb");
-    if (!file)
+    if (bytes == 0)
     {
-        return -1;
+        return 0;
     }
 
-    if (_size > 0)
+#if defined(D_FILE_PLATFORM_WINDOWS)
+    if (!FlushViewOfFile(addr, bytes))
     {
-        bytes_written = fwrite(_data, 1, _size, file);
-        if (bytes_written != _size)
-        {
-            fclose(file);
+        errno = EIO;
 
-            return -1;
-        }
+        return -1;
     }
 
-    fclose(file);
+    // FlushViewOfFile only queues the writes; flushing the file waits for them
+    if ( (_mode == D_MSYNC_SYNC) &&
+         (_map->file)            &&
+         (!FlushFileBuffers(_map->file)) )
+    {
+        errno = EIO;
+
+        return -1;
+    }
 
     return 0;
+#else
+    return msync(addr,
+                 bytes,
+                 (_mode == D_MSYNC_SYNC) ? MS_SYNC
+                                         : MS_ASYNC);
+#endif
 }
 
+#endif  // D_FILE_HAS_MMAP
+
+
 /*
-d_fappend_all
-  Append buffer to file.
+d_fread_all_view
+  Read-only view of an entire file without copying it. Large regular files are
+mapped; `_view->data[_view->size]` is nonetheless always '\0', because the
+kernel zero-fills the unused tail of the last page. When the file size is an
+exact multiple of the page size there is no such tail, so on POSIX a spare
+zero page is reserved directly behind the mapping; elsewhere the view falls
+back to a heap copy. Small files, non-regular files (pipes, procfs) and
+platforms without mapping support are read through d_fread_all.
+  As with any file mapping, truncating the file while the view is alive makes
+access to the removed pages fault; do not use this on files that other
+processes may shrink concurrently.
 
 Parameter(s):
   _path: path to file.
-  _data: data to append.
-  _size: number of bytes to append.
+  _view: receives the view; release it with d_file_view_release.
 Return:
-  0 on success, -1 on failure.
+  0 on success, -1 on failure (errno is set).
 */
 int
-d_fappend_all
+d_fread_all_view
 (
-    const char* _path, 
-    const void* _data, 
-    size_t      _size
+    const char*           _path,
+    struct d_file_view_t* _view
 )
 {
-    FILE*  file;
-    size_t bytes_written;
+    size_t size;
+    void*  copy;
 
     // parameter validation
-    if ( (!_path) || 
-         ( (!_data) && (_size > 0) ) )
+    if ( (!_path) ||
+         (!_view) )
     {
         errno = EINVAL;
 
         return -1;
     }
 
-    file = d_fopen(_path, "ab");
-    if (!file)
-    {
-        return -1;
-    }
+    d_memset(_view, 0, sizeof(struct d_file_view_t));
 
-    if (_size > 0)
+#if D_FILE_HAS_MMAP
     {
-        bytes_written = fwrite(_data, 1, _size, file);
-        if (bytes_written != _size)
+        struct d_stat_t st;
+        int             fd;
+        int             open_flags;
+        int             result;
+        int             saved_errno;
+        size_t          page;
+
+        open_flags = O_RDONLY;
+    #if defined(O_BINARY)
+        open_flags |= O_BINARY;
+    #endif
+    #if defined(O_CLOEXEC)
+        open_flags |= O_CLOEXEC;
+    #endif
+
+        fd = d_open(_path, open_flags);
+        if (fd < 0)
         {
-            fclose(file);
+            return -1;
+        }
+
+        if (d_fstat(fd, &st) != 0)
+        {
+            saved_errno = errno;
+            d_close(fd);
+            errno = saved_errno;
 
             return -1;
         }
+
+        page   = d_internal_mmap_system_page();
+        result = 1;  // 1 = not mapped, fall back to a copy
+
+        if ( (S_ISREG(st.st_mode))                         &&
+             (st.st_size >= D_FILE_VIEW_MMAP_THRESHOLD)    &&
+             (st.st_size <  (uint64_t)SIZE_MAX - page) )
+        {
+            if ((st.st_size % page) != 0)
+            {
+                // the zero-filled tail of the last page is the terminator
+                result = d_mmap_fd(fd, 0, 0, D_MMAP_READ, &_view->map);
+            }
+    #if ( defined(D_FILE_PLATFORM_POSIX) &&  \
+          defined(MAP_ANONYMOUS)         &&  \
+          defined(MAP_FIXED) )
+            else
+            {
+                void*  reserve;
+                void*  base;
+                size_t length;
+
+                // reserve one extra zero page, then place the file over the
+                // front of the reservation
+                length  = (size_t)st.st_size;
+                reserve = mmap(NULL,
+                               length + page,
+                               PROT_READ,
+                               MAP_PRIVATE | MAP_ANONYMOUS,
+                               -1,
+                               0);
+
+                if (reserve != MAP_FAILED)
+                {
+                    base = mmap(reserve,
+                                length,
+                                PROT_READ,
+                                MAP_SHARED | MAP_FIXED,
+                                fd,
+                                0);
+
+                    if (base == MAP_FAILED)
+                    {
+                        munmap(reserve, length + page);
+                    }
+                    else
+                    {
+                        _view->map.data   = base;
+                        _view->map.size   = length;
+                        _view->map.offset = 0;
+                        _view->map.base   = base;
+                        _view->map.length = length + page;
+                        _view->map.flags  = D_MMAP_READ;
+
+                        result = 0;
+                    }
+                }
+            }
+    #endif
+        }
+
+        d_close(fd);
+
+        if (result == 0)
+        {
+            _view->data   = (const char*)_view->map.data;
+            _view->size   = _view->map.size;
+            _view->mapped = 1;
+
+            return 0;
+        }
+
+        // any mapping failure degrades to the copying path below
+        d_memset(&_view->map, 0, sizeof(struct d_mmap_t));
     }
+#endif  // D_FILE_HAS_MMAP
 
-    fclose(file);
+    copy = d_fread_all(_path, &size);
+    if (!copy)
+    {
+        return -1;
+    }
+
+    _view->data   = (const char*)copy;
+    _view->size   = size;
+    _view->mapped = 0;
 
     return 0;
 }
 
+
+/*
+d_file_view_release
+  Release a view obtained from d_fread_all_view. The structure is zeroed on
+return; releasing a zeroed view is a no-op.
+
+Parameter(s):
+  _view: view to release.
+Return:
+  none.
+*/
+void
+d_file_view_release
+(
+    struct d_file_view_t* _view
+)
+{
+    if (!_view)
+    {
+        return;
+    }
+
+#if D_FILE_HAS_MMAP
+    if (_view->mapped)
+    {
+        d_munmap(&_view->map);
+    }
+    else
+#endif
+    {
+        free((void*)_view->data);
+    }
+
+    d_memset(_view, 0, sizeof(struct d_file_view_t));
+
+    return;
+}
@@ -1,5 +1,18 @@
 #include "..\..\inc\c\dio.h"
 
+#if D_ENV_C_HAS_AVX2
+    #include <immintrin.h>
+#elif D_ENV_C_HAS_SSE2
+    #include <emmintrin.h>
+#elif ( D_ENV_C_HAS_NEON &&  \
+        (D_ENV_ARCH_TYPE == D_ENV_ARCH_TYPE_ARM64) )
+    #include <arm_neon.h>
+#endif
+
+#if defined(D_ENV_COMPILER_MSVC)
+    #include <intrin.h>
+#endif
+
 
 /*
 d_sscanf
@@ -565,3 +578,685 @@ d_clearerr
     return;
 }
 
+
+///////////////////////////////////////////////////////////////////////////////
+///             VI.   LINE READER                                           ///
+///////////////////////////////////////////////////////////////////////////////
+
+// D_INTERNAL_LINE_ALIGN
+//   constant: alignment of block-mode buffers (one page), so each read()
+// lands on page boundaries and can be served without a bounce copy.
+#define D_INTERNAL_LINE_ALIGN 4096
+
+// d_line_reader
+//   struct: reader state. Pending bytes are data[start, end); `scan` marks
+// how far the delimiter search has already looked, so a record that spans
+// several refills is scanned only once.
+struct d_line_reader
+{
+    const char*     data;       // mapping, caller memory, or `buffer`
+    size_t          start;      // first byte of the next record
+    size_t          end;        // one past the last valid byte
+    size_t          scan;       // delimiter search resumes here
+    char*           buffer;     // block mode only
+    size_t          capacity;   // block mode only
+    int             fd;         // block mode only, else -1
+    bool            owns_fd;
+    bool            eof;        // no more bytes will arrive
+    bool            mapped;
+    int             flags;
+    char            delimiter;
+    size_t          line_number;
+#if D_FILE_HAS_MMAP
+    struct d_mmap_t map;
+#endif
+};
+
+
+#if ( D_ENV_C_HAS_AVX2 ||  \
+      D_ENV_C_HAS_SSE2 )
+
+/*
+d_internal_line_ctz
+  Index of the lowest set bit of a nonzero movemask result.
+*/
+static unsigned
+d_internal_line_ctz
+(
+    unsigned _mask
+)
+{
+#if defined(D_ENV_COMPILER_MSVC)
+    unsigned long index;
+
+    _BitScanForward(&index, (unsigned long)_mask);
+
+    return (unsigned)index;
+#else
+    return (unsigned)__builtin_ctz(_mask);
+#endif
+}
+
+#endif
+
+
+/*
+d_internal_line_find
+  Finds the first `_c` in [_p, _end) with the widest vector compare the
+build targets (AVX2, SSE2 or NEON), or memchr elsewhere.
+
+Return:
+  Pointer to the byte, or NULL if it does not occur.
+*/
+static const char*
+d_internal_line_find
+(
+    const char* _p,
+    const char* _end,
+    char        _c
+)
+{
+#if D_ENV_C_HAS_AVX2
+    __m256i needle;
+    __m256i chunk;
+    int     mask;
+
+    needle = _mm256_set1_epi8(_c);
+
+    while (_end - _p >= 32)
+    {
+        chunk = _mm256_loadu_si256((const __m256i*)_p);
+        mask  = _mm256_movemask_epi8(_mm256_cmpeq_epi8(chunk, needle));
+
+        if (mask)
+        {
+            return _p + d_internal_line_ctz((unsigned)mask);
+        }
+
+        _p += 32;
+    }
+#elif D_ENV_C_HAS_SSE2
+    __m128i needle;
+    __m128i chunk;
+    int     mask;
+
+    needle = _mm_set1_epi8(_c);
+
+    while (_end - _p >= 16)
+    {
+        chunk = _mm_loadu_si128((const __m128i*)_p);
+        mask  = _mm_movemask_epi8(_mm_cmpeq_epi8(chunk, needle));
+
+        if (mask)
+        {
+            return _p + d_internal_line_ctz((unsigned)mask);
+        }
+
+        _p += 16;
+    }
+#elif ( D_ENV_C_HAS_NEON &&  \
+        (D_ENV_ARCH_TYPE == D_ENV_ARCH_TYPE_ARM64) )
+    uint8x16_t needle;
+    uint8x16_t hits;
+    int        i;
+
+    needle = vdupq_n_u8((uint8_t)_c);
+
+    while (_end - _p >= 16)
+    {
+        hits = vceqq_u8(vld1q_u8((const uint8_t*)_p), needle);
+
+        // any lane set? then locate it among these 16 bytes
+        if (vmaxvq_u8(hits))
+        {
+            for (i = 0; _p[i] != _c; i++)
+            {
+            }
+
+            return _p + i;
+        }
+
+        _p += 16;
+    }
+#endif
+
+    return (_p < _end) ? (const char*)memchr(_p, (unsigned char)_c, (size_t)(_end - _p))
+                       : NULL;
+}
+
+
+/*
+d_internal_line_alloc
+  Allocates a page-aligned block buffer.
+*/
+static char*
+d_internal_line_alloc
+(
+    size_t _size
+)
+{
+#if defined(D_FILE_PLATFORM_WINDOWS)
+    return (char*)_aligned_malloc(_size, D_INTERNAL_LINE_ALIGN);
+#else
+    void* memory;
+
+    return (posix_memalign(&memory, D_INTERNAL_LINE_ALIGN, _size) == 0) ? (char*)memory
+                                                                         : NULL;
+#endif
+}
+
+
+/*
+d_internal_line_release
+  Frees a buffer from d_internal_line_alloc.
+*/
+static void
+d_internal_line_release
+(
+    char* _buffer
+)
+{
+#if defined(D_FILE_PLATFORM_WINDOWS)
+    _aligned_free(_buffer);
+#else
+    free(_buffer);
+#endif
+
+    return;
+}
+
+
+/*
+d_internal_line_new
+  Allocates a reader with default settings.
+*/
+static struct d_line_reader*
+d_internal_line_new
+(
+    int _flags
+)
+{
+    struct d_line_reader* reader;
+
+    reader = calloc(1, sizeof(struct d_line_reader));
+    if (!reader)
+    {
+        errno = ENOMEM;
+
+        return NULL;
+    }
+
+    reader->fd        = -1;
+    reader->flags     = _flags;
+    reader->delimiter = '\n';
+
+    return reader;
+}
+
+
+/*
+d_internal_line_refill
+  Block mode: moves the unconsumed tail to the front of the buffer (growing
+it if a single record fills it) and reads the next block behind it.
+
+Return:
+  0 on success (possibly setting `eof`), -1 on read or allocation failure.
+*/
+static int
+d_internal_line_refill
+(
+    struct d_line_reader* _reader
+)
+{
+    char*   grown;
+    size_t  pending;
+    ssize_t got;
+
+    pending = _reader->end - _reader->start;
+
+    if (_reader->start > 0)
+    {
+        memmove(_reader->buffer, _reader->buffer + _reader->start, pending);
+        _reader->scan  -= _reader->start;
+        _reader->start  = 0;
+        _reader->end    = pending;
+    }
+
+    // a record longer than the buffer: double it
+    if (_reader->capacity - _reader->end < D_LINE_READER_BLOCK_SIZE / 2)
+    {
+        grown = d_internal_line_alloc(_reader->capacity * 2);
+        if (!grown)
+        {
+            errno = ENOMEM;
+
+            return -1;
+        }
+
+        d_memcpy(grown, _reader->buffer, _reader->end);
+        d_internal_line_release(_reader->buffer);
+
+        _reader->buffer    = grown;
+        _reader->data      = grown;
+        _reader->capacity *= 2;
+    }
+
+    do
+    {
+        got = d_read(_reader->fd,
+                     _reader->buffer + _reader->end,
+                     _reader->capacity - _reader->end);
+    } while ( (got < 0) &&
+              (errno == EINTR) );
+
+    if (got < 0)
+    {
+        return -1;
+    }
+
+    if (got == 0)
+    {
+        _reader->eof = true;
+    }
+
+    _reader->end += (size_t)got;
+
+    return 0;
+}
+
+
+/*
+d_line_reader_open
+  Open a file for line reading. Regular, non-empty files are memory-mapped
+(with sequential read-ahead advice) unless D_LINE_READER_NO_MMAP is given
+or mapping fails; anything else is read in D_LINE_READER_BLOCK_SIZE blocks.
+
+Parameter(s):
+  _path:  file to read.
+  _flags: D_LINE_READER_* flags.
+Return:
+  A new reader, or NULL on failure (errno set).
+*/
+struct d_line_reader*
+d_line_reader_open
+(
+    const char* _path,
+    int         _flags
+)
+{
+    struct d_line_reader* reader;
+    int                   open_flags;
+    int                   fd;
+
+    if (!_path)
+    {
+        errno = EINVAL;
+
+        return NULL;
+    }
+
+    open_flags = O_RDONLY;
+#if defined(O_BINARY)
+    open_flags |= O_BINARY;
+#endif
+#if defined(O_CLOEXEC)
+    open_flags |= O_CLOEXEC;
+#endif
+
+    fd = d_open(_path, open_flags);
+    if (fd < 0)
+    {
+        return NULL;
+    }
+
+#if D_FILE_HAS_MMAP
+    if (!(_flags & D_LINE_READER_NO_MMAP))
+    {
+        struct d_stat_t st;
+
+        if ( (d_fstat(fd, &st) == 0) &&
+             (S_ISREG(st.st_mode))   &&
+             (st.st_size > 0)        &&
+             (st.st_size <= (uint64_t)SIZE_MAX) )
+        {
+            reader = d_internal_line_new(_flags);
+            if (!reader)
+            {
+                d_close(fd);
+
+                return NULL;
+            }
+
+            if (d_mmap_fd(fd, 0, (size_t)st.st_size, D_MMAP_READ, &reader->map) == 0)
+            {
+                d_close(fd);
+                d_madvise(&reader->map, 0, reader->map.size, D_MADV_SEQUENTIAL);
+
+                reader->data   = (const char*)reader->map.data;
+                reader->end    = reader->map.size;
+                reader->eof    = true;
+                reader->mapped = true;
+
+                return reader;
+            }
+
+            free(reader);
+        }
+    }
+#endif
+
+    reader = d_line_reader_from_fd(fd, (_flags | D_LINE_READER_OWN_FD));
+    if (!reader)
+    {
+        d_close(fd);
+    }
+
+    return reader;
+}
+
+
+/*
+d_line_reader_from_fd
+  Read lines from an open descriptor (file, pipe, socket, terminal) in
+block mode. Reading starts at the descriptor's current position.
+
+Parameter(s):
+  _fd:    descriptor to read.
+  _flags: D_LINE_READER_* flags; with D_LINE_READER_OWN_FD the reader closes
+          `_fd` when freed.
+Return:
+  A new reader, or NULL on failure (errno set).
+*/
+struct d_line_reader*
+d_line_reader_from_fd
+(
+    int _fd,
+    int _flags
+)
+{
+    struct d_line_reader* reader;
+
+    if (_fd < 0)
+    {
+        errno = EBADF;
+
+        return NULL;
+    }
+
+    reader = d_internal_line_new(_flags);
+    if (!reader)
+    {
+        return NULL;
+    }
+
+    reader->buffer = d_internal_line_alloc(2 * D_LINE_READER_BLOCK_SIZE);
+    if (!reader->buffer)
+    {
+        free(reader);
+        errno = ENOMEM;
+
+        return NULL;
+    }
+
+    reader->data     = reader->buffer;
+    reader->capacity = 2 * D_LINE_READER_BLOCK_SIZE;
+    reader->fd       = _fd;
+    reader->owns_fd  = ((_flags & D_LINE_READER_OWN_FD) != 0);
+
+    return reader;
+}
+
+
+/*
+d_line_reader_from_memory
+  Read lines from a caller-owned buffer (e.g. a d_file_view_t). Slices point
+directly into `_data`, which must outlive the reader.
+
+Parameter(s):
+  _data:  bytes to split.
+  _size:  number of bytes.
+  _flags: D_LINE_READER_* flags.
+Return:
+  A new reader, or NULL on failure (errno set).
+*/
+struct d_line_reader*
+d_line_reader_from_memory
+(
+    const char* _data,
+    size_t      _size,
+    int         _flags
+)
+{
+    struct d_line_reader* reader;
+
+    if ( (!_data) &&
+         (_size > 0) )
+    {
+        errno = EINVAL;
+
+        return NULL;
+    }
+
+    reader = d_internal_line_new(_flags);
+    if (!reader)
+    {
+        return NULL;
+    }
+
+    reader->data = _data;
+    reader->end  = _size;
+    reader->eof  = true;
+
+    return reader;
+}
+
+
+/*
+d_line_reader_set_delimiter
+  Change the record delimiter (default '\n'). CR stripping applies only to
+the '\n' delimiter.
+
+Parameter(s):
+  _reader:    reader.
+  _delimiter: record delimiter byte, e.g. '\0' for NUL-separated records.
+Return:
+  none.
+*/
+void
+d_line_reader_set_delimiter
+(
+    struct d_line_reader* _reader,
+    char                  _delimiter
+)
+{
+    if (_reader)
+    {
+        _reader->delimiter = _delimiter;
+    }
+
+    return;
+}
+
+
+/*
+d_line_reader_next
+  Return the next record as a slice into the reader's storage, without
+copying. The delimiter - and for '\n' a preceding '\r' - is stripped unless
+D_LINE_READER_KEEP_EOL was given. A final record without a delimiter is
+still returned. The slice stays valid until the next call or d_line_reader_
+free; records that straddle block boundaries are stitched together in the
+buffer first, so every slice is contiguous.
+
+Parameter(s):
+  _reader: reader.
+  _line:   receives a pointer to the record (not NUL-terminated).
+  _length: receives the record length in bytes.
+Return:
+  1 if a record was returned, 0 at end of input, -1 on error (errno set).
+*/
+int
+d_line_reader_next
+(
+    struct d_line_reader* _reader,
+    const char**          _line,
+    size_t*               _length
+)
+{
+    const char* hit;
+    size_t      length;
+    size_t      consumed;
+
+    if ( (!_reader) ||
+         (!_line)   ||
+         (!_length) )
+    {
+        errno = EINVAL;
+
+        return -1;
+    }
+
+    for (;;)
+    {
+        hit = (_reader->scan < _reader->end)
+                  ? d_internal_line_find(_reader->data + _reader->scan,
+                                         _reader->data + _reader->end,
+                                         _reader->delimiter)
+                  : NULL;
+
+        if (hit)
+        {
+            consumed = (size_t)(hit - _reader->data) + 1;
+            length   = consumed - _reader->start;
+
+            break;
+        }
+
+        _reader->scan = _reader->end;
+
+        if (_reader->eof)
+        {
+            if (_reader->start == _reader->end)
+            {
+                return 0;
+            }
+
+            // trailing record without a delimiter
+            consumed = _reader->end;
+            length   = consumed - _reader->start;
+            *_line   = _reader->data + _reader->start;
+            *_length = length;
+
+            _reader->start = consumed;
+            _reader->scan  = consumed;
+            _reader->line_number++;
+
+            return 1;
+        }
+
+        if (d_internal_line_refill(_reader) != 0)
+        {
+            return -1;
+        }
+    }
+
+    *_line = _reader->data + _reader->start;
+
+    if (!(_reader->flags & D_LINE_READER_KEEP_EOL))
+    {
+        length--;
+
+        if ( (_reader->delimiter == '\n') &&
+             (length > 0) &&
+             ((*_line)[length - 1] == '\r') )
+        {
+            length--;
+        }
+    }
+
+    *_length = length;
+
+    _reader->start = consumed;
+    _reader->scan  = consumed;
+    _reader->line_number++;
+
+    return 1;
+}
+
+
+/*
+d_line_reader_line_number
+  Number of records returned so far (so the 1-based number of the most
+recent one).
+
+Parameter(s):
+  _reader: reader.
+Return:
+  The record count (0 for NULL).
+*/
+size_t
+d_line_reader_line_number
+(
+    const struct d_line_reader* _reader
+)
+{
+    return (_reader) ? _reader->line_number : 0;
+}
+
+
+/*
+d_line_reader_is_mapped
+  Report whether the reader is serving slices from a memory mapping.
+
+Parameter(s):
+  _reader: reader.
+Return:
+  true for a mapped file, false for block or memory mode (or NULL).
+*/
+bool
+d_line_reader_is_mapped
+(
+    const struct d_line_reader* _reader
+)
+{
+    return (_reader) ? _reader->mapped : false;
+}
+
+
+/*
+d_line_reader_free
+  Release a reader, its buffer or mapping, and (if owned) its descriptor.
+
+Parameter(s):
+  _reader: reader to free (may be NULL).
+Return:
+  none.
+*/
+void
+d_line_reader_free
+(
+    struct d_line_reader* _reader
+)
+{
+    if (!_reader)
+    {
+        return;
+    }
+
+#if D_FILE_HAS_MMAP
+    if (_reader->mapped)
+    {
+        d_munmap(&_reader->map);
+    }
+#endif
+
+    if ( (_reader->owns_fd) &&
+         (_reader->fd >= 0) )
+    {
+        d_close(_reader->fd);
+    }
+
+    d_internal_line_release(_reader->buffer);
+    free(_reader);
+
+    return;
+}
@@ -0,0 +1,2179 @@
+/******************************************************************************
+* djinterp [core]                                                  dstatcache.c
+*
+* Implementation of the metadata cache: an open-addressing table of stat
+* results keyed by normalized path, batch resolution through statx, and the
+* inotify watcher thread (Linux).
+*
+* path:      \src\dstatcache.c
+* link:      TBA
+* author(s): Samuel 'teer' Neal-Blim                          date: 2026.10.18
+******************************************************************************/
+#include "..\..\inc\c\dstatcache.h"
+#include "..\..\inc\c\datomic.h"
+#include "..\..\inc\c\dmutex.h"
+#include "..\..\inc\c\dtime.h"
+
+#if D_STAT_CACHE_HAS_STATX
+    #include <sys/syscall.h>
+    #include <sys/sysmacros.h>
+
+    // statx needs the raw system call number; without it fall back to stat
+    #if !defined(SYS_statx)
+        #undef  D_STAT_CACHE_HAS_STATX
+        #define D_STAT_CACHE_HAS_STATX 0
+    #endif
+#endif
+
+#if D_STAT_CACHE_HAS_INOTIFY
+    #include <poll.h>
+    #include <sys/inotify.h>
+#endif
+
+
+///////////////////////////////////////////////////////////////////////////////
+///             INTERNAL DEFINITIONS                                        ///
+///////////////////////////////////////////////////////////////////////////////
+
+// record slots of an entry
+#define D_INTERNAL_STAT_CACHE_FOLLOW    0     // d_stat semantics
+#define D_INTERNAL_STAT_CACHE_NOFOLLOW  1     // d_lstat semantics
+
+// directory descriptor meaning "relative to the working directory"
+#if defined(D_FILE_PLATFORM_POSIX)
+    #define D_INTERNAL_STAT_CACHE_CWD   AT_FDCWD
+#else
+    #define D_INTERNAL_STAT_CACHE_CWD   (-100)
+#endif
+
+// events that make a watched directory's cached children stale
+#define D_INTERNAL_STAT_CACHE_EVENTS                          \
+    ( IN_ATTRIB | IN_MODIFY | IN_CREATE | IN_DELETE |         \
+      IN_MOVED_FROM | IN_MOVED_TO | IN_DELETE_SELF |          \
+      IN_MOVE_SELF | IN_ONLYDIR )
+
+// d_internal_stat_cache_record
+//   type: one cached stat (or lstat) outcome.
+struct d_internal_stat_cache_record
+{
+    struct d_stat_t st;
+    int64_t         stamp_ns;       // monotonic time of the call (TTL mode)
+    uint64_t        generation;     // cache generation at the time of the call
+    int             error;          // 0, or errno of the failed call
+    bool            valid;
+};
+
+// d_internal_stat_cache_entry
+//   type: one path and its two records. Watched directories are kept in a
+// second table of the same entries, where only `wd` is meaningful.
+struct d_internal_stat_cache_entry
+{
+    uint64_t                            hash;
+    size_t                              length;
+    int                                 wd;
+    struct d_internal_stat_cache_record records[2];
+    char                                path[];
+};
+
+// d_internal_stat_cache_table
+//   type: linear-probing hash table of entries; capacity is a power of two.
+struct d_internal_stat_cache_table
+{
+    struct d_internal_stat_cache_entry** slots;
+    size_t                               capacity;
+    size_t                               count;
+};
+
+// d_internal_stat_cache_miss
+//   type: a path d_stat_cache_stat_batch has to resolve; `key` is an offset
+// into the batch's key arena.
+struct d_internal_stat_cache_miss
+{
+    size_t                              index;
+    size_t                              key;
+    size_t                              length;
+    size_t                              dir_length;
+    size_t                              name;
+    uint64_t                            hash;
+    const char*                         arena;
+    bool                                covered;
+    struct d_internal_stat_cache_record record;
+};
+
+struct d_stat_cache
+{
+    struct d_rwlock_t                  lock;
+    struct d_internal_stat_cache_table entries;
+    uint64_t                           generation;
+    int64_t                            ttl_ns;
+    size_t                             max_entries;
+    int                                flags;
+    d_atomic_int                       use_statx;
+    d_atomic_ullong                    hits;
+    d_atomic_ullong                    misses;
+    d_atomic_ullong                    syscalls;
+    d_atomic_ullong                    invalidations;
+    bool                               watching;
+#if D_STAT_CACHE_HAS_INOTIFY
+    struct d_internal_stat_cache_table watches;
+    struct d_internal_stat_cache_entry** by_wd;     // watch entries by wd
+    size_t                             by_wd_capacity;
+    uint64_t                           event_seq;   // bumped per event batch
+    int                                inotify_fd;
+    int                                wake[2];     // pipe that stops the watcher
+    d_thread_t                         watcher;
+#endif
+};
+
+#if D_STAT_CACHE_HAS_STATX
+
+// d_internal_statx_timestamp, d_internal_statx
+//   type: the kernel's statx structures, declared here so that the C
+// library's own (optional) declarations are not needed.
+struct d_internal_statx_timestamp
+{
+    int64_t  tv_sec;
+    uint32_t tv_nsec;
+    int32_t  reserved;
+};
+
+struct d_internal_statx
+{
+    uint32_t                          stx_mask;
+    uint32_t                          stx_blksize;
+    uint64_t                          stx_attributes;
+    uint32_t                          stx_nlink;
+    uint32_t                          stx_uid;
+    uint32_t                          stx_gid;
+    uint16_t                          stx_mode;
+    uint16_t                          spare0;
+    uint64_t                          stx_ino;
+    uint64_t                          stx_size;
+    uint64_t                          stx_blocks;
+    uint64_t                          stx_attributes_mask;
+    struct d_internal_statx_timestamp stx_atime;
+    struct d_internal_statx_timestamp stx_btime;
+    struct d_internal_statx_timestamp stx_ctime;
+    struct d_internal_statx_timestamp stx_mtime;
+    uint32_t                          stx_rdev_major;
+    uint32_t                          stx_rdev_minor;
+    uint32_t                          stx_dev_major;
+    uint32_t                          stx_dev_minor;
+    uint64_t                          spare2[14];
+};
+
+// STATX_BASIC_STATS: everything struct stat reports
+#define D_INTERNAL_STATX_BASIC_STATS 0x000007ffU
+
+#endif  // D_STAT_CACHE_HAS_STATX
+
+
+///////////////////////////////////////////////////////////////////////////////
+///             INTERNAL HELPERS                                            ///
+///////////////////////////////////////////////////////////////////////////////
+
+/*
+d_internal_stat_cache_hash
+  FNV-1a hash of a key.
+*/
+static uint64_t
+d_internal_stat_cache_hash
+(
+    const char* _key,
+    size_t      _length
+)
+{
+    uint64_t hash;
+    size_t   i;
+
+    hash = 0xcbf29ce484222325ULL;
+
+    for (i = 0; i < _length; i++)
+    {
+        hash ^= (uint8_t)_key[i];
+        hash *= 0x100000001b3ULL;
+    }
+
+    return hash;
+}
+
+
+/*
+d_internal_stat_cache_key
+  Writes the cache key of `_path` into `_key` (D_FILE_PATH_MAX bytes) and
+returns its length, or 0 if the path should bypass the cache.
+  The key is the d_path_normalize form of the path with a trailing separator
+kept, since "file/" and "file" stat differently. Paths that are already in
+that form, which is almost all of them, are copied after a single scan.
+Paths containing a ".." component are kept verbatim: normalizing "../x" to
+"x", or "link/.." to ".", would change which file is meant.
+*/
+static size_t
+d_internal_stat_cache_key
+(
+    const char* _path,
+    char*       _key
+)
+{
+    size_t length;
+    size_t start;
+    size_t i;
+    bool   dotdot;
+    bool   normal;
+    bool   trailing;
+
+    length = strlen(_path);
+
+    if ( (length == 0) ||
+         (length >= D_FILE_PATH_MAX - 1) )
+    {
+        return 0;
+    }
+
+    dotdot = false;
+    normal = true;
+    start  = 0;
+
+    for (i = 0; i <= length; i++)
+    {
+        if ( (i < length) &&
+             (_path[i] != D_FILE_PATH_SEP) &&
+             (_path[i] != D_FILE_PATH_SEP_ALT) )
+        {
+            continue;
+        }
+
+        // alternate separators (Windows '/') are rewritten
+        if ( (i < length) &&
+             (_path[i] != D_FILE_PATH_SEP) )
+        {
+            normal = false;
+        }
+
+        if ( (i - start == 2) &&
+             (_path[start] == '.') &&
+             (_path[start + 1] == '.') )
+        {
+            dotdot = true;
+        }
+        else if ( (i - start == 1) &&
+                  (_path[start] == '.') &&
+                  (length > 1) )
+        {
+            // "." components
+            normal = false;
+        }
+        else if ( (i == start) &&
+                  (i > 0) &&
+                  (i < length) )
+        {
+            // empty components ("a//b")
+            normal = false;
+        }
+
+        start = i + 1;
+    }
+
+    if ( (dotdot) ||
+         (normal) )
+    {
+        d_memcpy(_key, _path, length + 1);
+
+        return length;
+    }
+
+    trailing = ( (_path[length - 1] == D_FILE_PATH_SEP) ||
+                 (_path[length - 1] == D_FILE_PATH_SEP_ALT) );
+
+    if (!d_path_normalize(_path, _key, D_FILE_PATH_MAX - 1))
+    {
+        return 0;
+    }
+
+    length = strlen(_key);
+
+    if ( (trailing) &&
+         (_key[length - 1] != D_FILE_PATH_SEP) )
+    {
+        _key[length++] = D_FILE_PATH_SEP;
+        _key[length]   = '\0';
+    }
+
+    return length;
+}
+
+
+/*
+d_internal_stat_cache_split
+  Splits a key into its directory and final name: returns the length of the
+directory part and stores the offset of the name in `_name`. A key without a
+separator has an empty directory (the working directory); the directory of
+"/x" is "/".
+*/
+static size_t
+d_internal_stat_cache_split
+(
+    const char* _key,
+    size_t      _length,
+    size_t*     _name
+)
+{
+    size_t end;
+
+    end = _length;
+
+    if ( (end > 1) &&
+         (_key[end - 1] == D_FILE_PATH_SEP) )
+    {
+        end--;
+    }
+
+    while ( (end > 0) &&
+            (_key[end - 1] != D_FILE_PATH_SEP) )
+    {
+        end--;
+    }
+
+    *_name = end;
+
+    if (end == 0)
+    {
+        return 0;
+    }
+
+    return (end == 1) ? 1 : end - 1;
+}
+
+
+/*
+d_internal_stat_cache_table_find
+  Returns the slot holding `_key`, or SIZE_MAX.
+*/
+static size_t
+d_internal_stat_cache_table_find
+(
+    const struct d_internal_stat_cache_table* _table,
+    const char*                               _key,
+    size_t                                    _length,
+    uint64_t                                  _hash
+)
+{
+    struct d_internal_stat_cache_entry* entry;
+    size_t                              mask;
+    size_t                              i;
+
+    if (_table->capacity == 0)
+    {
+        return SIZE_MAX;
+    }
+
+    mask = _table->capacity - 1;
+
+    for (i = (size_t)_hash & mask; (entry = _table->slots[i]) != NULL;
+         i = (i + 1) & mask)
+    {
+        if ( (entry->hash == _hash) &&
+             (entry->length == _length) &&
+             (memcmp(entry->path, _key, _length) == 0) )
+        {
+            return i;
+        }
+    }
+
+    return SIZE_MAX;
+}
+
+
+/*
+d_internal_stat_cache_table_insert
+  Adds an entry known not to be present, growing the table at 3/4 load.
+*/
+static bool
+d_internal_stat_cache_table_insert
+(
+    struct d_internal_stat_cache_table* _table,
+    struct d_internal_stat_cache_entry* _entry
+)
+{
+    struct d_internal_stat_cache_entry** slots;
+    size_t                               capacity;
+    size_t                               mask;
+    size_t                               i;
+    size_t                               j;
+
+    if ((_table->count + 1) * 4 > _table->capacity * 3)
+    {
+        capacity = (_table->capacity) ? _table->capacity * 2 : 64;
+        slots    = calloc(capacity, sizeof(*slots));
+
+        if (!slots)
+        {
+            return false;
+        }
+
+        mask = capacity - 1;
+
+        for (i = 0; i < _table->capacity; i++)
+        {
+            if (_table->slots[i])
+            {
+                for (j = (size_t)_table->slots[i]->hash & mask; slots[j];
+                     j = (j + 1) & mask)
+                {
+                }
+
+                slots[j] = _table->slots[i];
+            }
+        }
+
+        free(_table->slots);
+        _table->slots    = slots;
+        _table->capacity = capacity;
+    }
+
+    mask = _table->capacity - 1;
+
+    for (i = (size_t)_entry->hash & mask; _table->slots[i]; i = (i + 1) & mask)
+    {
+    }
+
+    _table->slots[i] = _entry;
+    _table->count++;
+
+    return true;
+}
+
+
+/*
+d_internal_stat_cache_table_remove
+  Removes and returns the entry in slot `_index`, shifting the rest of its
+probe run back so that no tombstones are needed.
+*/
+static struct d_internal_stat_cache_entry*
+d_internal_stat_cache_table_remove
+(
+    struct d_internal_stat_cache_table* _table,
+    size_t                              _index
+)
+{
+    struct d_internal_stat_cache_entry* removed;
+    size_t                              mask;
+    size_t                              hole;
+    size_t                              i;
+    size_t                              home;
+
+    removed = _table->slots[_index];
+    mask    = _table->capacity - 1;
+    hole    = _index;
+
+    for (i = (hole + 1) & mask; _table->slots[i]; i = (i + 1) & mask)
+    {
+        home = (size_t)_table->slots[i]->hash & mask;
+
+        // move the entry back unless its home lies cyclically in (hole, i]
+        if (((i - home) & mask) >= ((i - hole) & mask))
+        {
+            _table->slots[hole] = _table->slots[i];
+            hole                = i;
+        }
+    }
+
+    _table->slots[hole] = NULL;
+    _table->count--;
+
+    return removed;
+}
+
+
+/*
+d_internal_stat_cache_table_clear
+  Frees every entry and empties the table, keeping its capacity.
+*/
+static void
+d_internal_stat_cache_table_clear
+(
+    struct d_internal_stat_cache_table* _table
+)
+{
+    size_t i;
+
+    for (i = 0; i < _table->capacity; i++)
+    {
+        free(_table->slots[i]);
+        _table->slots[i] = NULL;
+    }
+
+    _table->count = 0;
+
+    return;
+}
+
+
+/*
+d_internal_stat_cache_drop
+  Removes the entry for `_key`, if any. Caller holds the write lock.
+*/
+static void
+d_internal_stat_cache_drop
+(
+    struct d_stat_cache* _cache,
+    const char*          _key,
+    size_t               _length
+)
+{
+    size_t index;
+
+    index = d_internal_stat_cache_table_find(
+                &_cache->entries,
+                _key,
+                _length,
+                d_internal_stat_cache_hash(_key, _length));
+
+    if (index != SIZE_MAX)
+    {
+        free(d_internal_stat_cache_table_remove(&_cache->entries, index));
+        d_atomic_fetch_add_ullong_explicit(&_cache->invalidations,
+                                           1,
+                                           D_MEMORY_ORDER_RELAXED);
+    }
+
+    return;
+}
+
+
+/*
+d_internal_stat_cache_fresh
+  Tells whether a record may still be returned. Caller holds the lock.
+*/
+static bool
+d_internal_stat_cache_fresh
+(
+    const struct d_stat_cache*                 _cache,
+    const struct d_internal_stat_cache_record* _record,
+    int64_t                                    _now
+)
+{
+    return ( (_record->valid) &&
+             (_record->generation == _cache->generation) &&
+             ( (_cache->ttl_ns == 0) ||
+               (_now - _record->stamp_ns < _cache->ttl_ns) ) );
+}
+
+
+/*
+d_internal_stat_cache_uncached
+  Answers a query directly, for a NULL cache or a path the cache bypasses.
+*/
+static int
+d_internal_stat_cache_uncached
+(
+    const char*      _path,
+    int              _slot,
+    struct d_stat_t* _buf
+)
+{
+    return (_slot == D_INTERNAL_STAT_CACHE_FOLLOW) ? d_stat(_path, _buf)
+                                                   : d_lstat(_path, _buf);
+}
+
+
+/*
+d_internal_stat_cache_resolve
+  Stats `_name` relative to the directory descriptor `_dirfd` into `_record`.
+`_key` is the same file as a full path, used when statx is unavailable.
+*/
+static void
+d_internal_stat_cache_resolve
+(
+    struct d_stat_cache*                 _cache,
+    int                                  _dirfd,
+    const char*                          _name,
+    const char*                          _key,
+    int                                  _slot,
+    struct d_internal_stat_cache_record* _record
+)
+{
+#if D_STAT_CACHE_HAS_STATX
+    struct d_internal_statx sx;
+    long                    rc;
+#endif
+
+    d_atomic_fetch_add_ullong_explicit(&_cache->syscalls,
+                                       1,
+                                       D_MEMORY_ORDER_RELAXED);
+
+    _record->valid = true;
+    _record->error = 0;
+
+#if D_STAT_CACHE_HAS_STATX
+    if (d_atomic_load_int_explicit(&_cache->use_statx, D_MEMORY_ORDER_RELAXED))
+    {
+        rc = syscall(SYS_statx,
+                     _dirfd,
+                     _name,
+                     (_slot == D_INTERNAL_STAT_CACHE_NOFOLLOW)
+                         ? AT_SYMLINK_NOFOLLOW
+                         : 0,
+                     D_INTERNAL_STATX_BASIC_STATS,
+                     &sx);
+
+        if (rc == 0)
+        {
+            d_memset(&_record->st, 0, sizeof(struct d_stat_t));
+
+            _record->st.st_size  = sx.stx_size;
+            _record->st.st_mtime = (uint64_t)sx.stx_mtime.tv_sec;
+            _record->st.st_atime = (uint64_t)sx.stx_atime.tv_sec;
+            _record->st.st_ctime = (uint64_t)sx.stx_ctime.tv_sec;
+            _record->st.st_mode  = sx.stx_mode;
+            _record->st.st_nlink = sx.stx_nlink;
+            _record->st.st_uid   = sx.stx_uid;
+            _record->st.st_gid   = sx.stx_gid;
+            _record->st.st_dev   = (uint64_t)makedev(sx.stx_dev_major,
+                                                     sx.stx_dev_minor);
+            _record->st.st_ino   = sx.stx_ino;
+
+            return;
+        }
+
+        // a kernel (or sandbox) without statx: use stat from now on
+        if ( (errno != ENOSYS) &&
+             (errno != EPERM) )
+        {
+            _record->error = errno;
+
+            return;
+        }
+
+        d_atomic_store_int_explicit(&_cache->use_statx,
+                                    0,
+                                    D_MEMORY_ORDER_RELAXED);
+    }
+#else
+    (void)_dirfd;
+    (void)_name;
+#endif
+
+    if (d_internal_stat_cache_uncached(_key, _slot, &_record->st) != 0)
+    {
+        _record->error = errno;
+    }
+
+    return;
+}
+
+
+/*
+d_internal_stat_cache_result
+  Copies a record to the caller, restoring errno for a cached failure.
+*/
+static int
+d_internal_stat_cache_result
+(
+    const struct d_internal_stat_cache_record* _record,
+    struct d_stat_t*                           _buf
+)
+{
+    if (_record->error)
+    {
+        errno = _record->error;
+
+        return -1;
+    }
+
+    *_buf = _record->st;
+
+    return 0;
+}
+
+
+/*
+d_internal_stat_cache_lookup
+  Looks a key up under the shared lock; true if a fresh record was copied
+into `_record`.
+*/
+static bool
+d_internal_stat_cache_lookup
+(
+    struct d_stat_cache*                 _cache,
+    const char*                          _key,
+    size_t                               _length,
+    uint64_t                             _hash,
+    int                                  _slot,
+    int64_t                              _now,
+    struct d_internal_stat_cache_record* _record
+)
+{
+    size_t index;
+    bool   found;
+
+    found = false;
+    index = d_internal_stat_cache_table_find(&_cache->entries,
+                                             _key,
+                                             _length,
+                                             _hash);
+
+    if ( (index != SIZE_MAX) &&
+         (d_internal_stat_cache_fresh(_cache,
+                                      &_cache->entries.slots[index]->records[_slot],
+                                      _now)) )
+    {
+        *_record = _cache->entries.slots[index]->records[_slot];
+        found    = true;
+    }
+
+    return found;
+}
+
+
+/*
+d_internal_stat_cache_store
+  Records the outcome of a miss. Caller holds the write lock. `_seq` is the
+watch event count seen before the stat was issued; if events arrived since,
+the result may already be stale and is not kept.
+*/
+static void
+d_internal_stat_cache_store
+(
+    struct d_stat_cache*                 _cache,
+    const char*                          _key,
+    size_t                               _length,
+    uint64_t                             _hash,
+    int                                  _slot,
+    struct d_internal_stat_cache_record* _record,
+    uint64_t                             _seq,
+    bool                                 _covered
+)
+{
+    struct d_internal_stat_cache_entry* entry;
+    size_t                              index;
+
+    if ( (_record->error) &&
+         (_cache->flags & D_STAT_CACHE_NO_NEGATIVE) )
+    {
+        return;
+    }
+
+#if D_STAT_CACHE_HAS_INOTIFY
+    if ( (_cache->watching) &&
+         ( (_seq != _cache->event_seq) ||
+           ( (!_covered) &&
+             (_cache->ttl_ns == 0) ) ) )
+    {
+        return;
+    }
+#else
+    (void)_seq;
+    (void)_covered;
+#endif
+
+    _record->generation = _cache->generation;
+    _record->stamp_ns   = (_cache->ttl_ns) ? d_monotonic_time_ns() : 0;
+
+    index = d_internal_stat_cache_table_find(&_cache->entries,
+                                             _key,
+                                             _length,
+                                             _hash);
+
+    if (index != SIZE_MAX)
+    {
+        entry = _cache->entries.slots[index];
+    }
+    else
+    {
+        if (_cache->entries.count >= _cache->max_entries)
+        {
+            d_internal_stat_cache_table_clear(&_cache->entries);
+        }
+
+        entry = calloc(1, sizeof(struct d_internal_stat_cache_entry) +
+                          _length + 1);
+
+        if (!entry)
+        {
+            return;
+        }
+
+        entry->hash   = _hash;
+        entry->length = _length;
+        entry->wd     = -1;
+        d_memcpy(entry->path, _key, _length + 1);
+
+        if (!d_internal_stat_cache_table_insert(&_cache->entries, entry))
+        {
+            free(entry);
+
+            return;
+        }
+    }
+
+    entry->records[_slot] = *_record;
+
+    // an lstat that did not land on a symlink answers the stat as well
+    if ( (_slot == D_INTERNAL_STAT_CACHE_NOFOLLOW) &&
+         ( ( (_record->error == 0) &&
+             (!S_ISLNK(_record->st.st_mode)) ) ||
+           (_record->error == ENOENT) ) )
+    {
+        entry->records[D_INTERNAL_STAT_CACHE_FOLLOW] = *_record;
+    }
+
+    return;
+}
+
+
+#if D_STAT_CACHE_HAS_INOTIFY
+
+/*
+d_internal_stat_cache_watch_dir
+  Ensures the directory `_dir` (empty for the working directory) is watched.
+Returns true if it is. Caller holds the write lock.
+*/
+static bool
+d_internal_stat_cache_watch_dir
+(
+    struct d_stat_cache* _cache,
+    const char*          _dir,
+    size_t               _length,
+    bool*                _existed
+)
+{
+    struct d_internal_stat_cache_entry*  entry;
+    struct d_internal_stat_cache_entry** by_wd;
+    uint64_t                             hash;
+    size_t                               capacity;
+    int                                  wd;
+
+    hash     = d_internal_stat_cache_hash(_dir, _length);
+    *_existed = true;
+
+    if (d_internal_stat_cache_table_find(&_cache->watches,
+                                         _dir,
+                                         _length,
+                                         hash) != SIZE_MAX)
+    {
+        return true;
+    }
+
+    *_existed = false;
+
+    entry = calloc(1, sizeof(struct d_internal_stat_cache_entry) + _length + 1);
+
+    if (!entry)
+    {
+        return false;
+    }
+
+    entry->hash   = hash;
+    entry->length = _length;
+    d_memcpy(entry->path, _dir, _length);
+    entry->path[_length] = '\0';
+
+    wd = inotify_add_watch(_cache->inotify_fd,
+                           (_length) ? entry->path : ".",
+                           D_INTERNAL_STAT_CACHE_EVENTS);
+
+    if (wd < 0)
+    {
+        free(entry);
+
+        return false;
+    }
+
+    entry->wd = wd;
+
+    if ((size_t)wd >= _cache->by_wd_capacity)
+    {
+        capacity = (_cache->by_wd_capacity) ? _cache->by_wd_capacity : 64;
+
+        while (capacity <= (size_t)wd)
+        {
+            capacity *= 2;
+        }
+
+        by_wd = realloc(_cache->by_wd, capacity * sizeof(*by_wd));
+
+        if (!by_wd)
+        {
+            inotify_rm_watch(_cache->inotify_fd, wd);
+            free(entry);
+
+            return false;
+        }
+
+        d_memset(by_wd + _cache->by_wd_capacity,
+                 0,
+                 (capacity - _cache->by_wd_capacity) * sizeof(*by_wd));
+
+        _cache->by_wd          = by_wd;
+        _cache->by_wd_capacity = capacity;
+    }
+
+    // the kernel hands out the same wd for a directory reached through
+    // another path (a symlink); its events would name the other path
+    if (_cache->by_wd[wd])
+    {
+        free(entry);
+
+        return false;
+    }
+
+    if (!d_internal_stat_cache_table_insert(&_cache->watches, entry))
+    {
+        inotify_rm_watch(_cache->inotify_fd, wd);
+        free(entry);
+
+        return false;
+    }
+
+    _cache->by_wd[wd] = entry;
+
+    return true;
+}
+
+
+/*
+d_internal_stat_cache_cover
+  Watches the directory holding `_key` and every directory above it, so that
+renaming or replacing any of them is noticed. Returns true if the immediate
+directory is watched. Caller holds the write lock.
+*/
+static bool
+d_internal_stat_cache_cover
+(
+    struct d_stat_cache* _cache,
+    const char*          _key,
+    size_t               _length
+)
+{
+    size_t dir_length;
+    size_t name;
+    bool   covered;
+    bool   existed;
+
+    dir_length = d_internal_stat_cache_split(_key, _length, &name);
+    covered    = d_internal_stat_cache_watch_dir(_cache,
+                                                 _key,
+                                                 dir_length,
+                                                 &existed);
+
+    // once a watched ancestor is reached, the rest of the chain already is
+    while ( (!existed) &&
+            (dir_length > 0) &&
+            ( (dir_length > 1) ||
+              (_key[0] != D_FILE_PATH_SEP) ) )
+    {
+        dir_length = d_internal_stat_cache_split(_key, dir_length, &name);
+        d_internal_stat_cache_watch_dir(_cache, _key, dir_length, &existed);
+    }
+
+    return covered;
+}
+
+
+/*
+d_internal_stat_cache_prepare
+  Before a miss is resolved: with watching on, covers the key and returns the
+current event count through `_seq`. Returns whether the key is covered.
+*/
+static bool
+d_internal_stat_cache_prepare
+(
+    struct d_stat_cache* _cache,
+    const char*          _key,
+    size_t               _length,
+    uint64_t*            _seq
+)
+{
+    bool covered;
+
+    *_seq = 0;
+
+    if (!_cache->watching)
+    {
+        return false;
+    }
+
+    d_rwlock_wrlock(&_cache->lock);
+    covered = d_internal_stat_cache_cover(_cache, _key, _length);
+    *_seq   = _cache->event_seq;
+    d_rwlock_unlock(&_cache->lock);
+
+    return covered;
+}
+
+
+/*
+d_internal_stat_cache_dispatch
+  Applies one inotify event. Caller holds the write lock.
+  Changes to a directory entry that is itself a watched directory (or any
+directory created, removed or moved) can affect paths anywhere below it, so
+they retire every entry through the generation; anything else drops just the
+named entry and the directory's own entry, whose times and link count moved.
+*/
+static void
+d_internal_stat_cache_dispatch
+(
+    struct d_stat_cache*         _cache,
+    const struct inotify_event*  _event
+)
+{
+    struct d_internal_stat_cache_entry* watch;
+    char                                key[D_FILE_PATH_MAX];
+    size_t                              name_length;
+    size_t                              length;
+    size_t                              index;
+
+    if (_event->mask & IN_Q_OVERFLOW)
+    {
+        _cache->generation++;
+
+        return;
+    }
+
+    if ( (_event->wd < 0) ||
+         ((size_t)_event->wd >= _cache->by_wd_capacity) ||
+         (!(watch = _cache->by_wd[_event->wd])) )
+    {
+        return;
+    }
+
+    if (_event->mask & IN_IGNORED)
+    {
+        index = d_internal_stat_cache_table_find(&_cache->watches,
+                                                 watch->path,
+                                                 watch->length,
+                                                 watch->hash);
+
+        if (index != SIZE_MAX)
+        {
+            d_internal_stat_cache_table_remove(&_cache->watches, index);
+        }
+
+        _cache->by_wd[_event->wd] = NULL;
+        _cache->generation++;
+        free(watch);
+
+        return;
+    }
+
+    if (_event->mask & (IN_DELETE_SELF | IN_MOVE_SELF))
+    {
+        _cache->generation++;
+
+        return;
+    }
+
+    // the directory's own entry ("." for the working directory)
+    if (watch->length)
+    {
+        d_internal_stat_cache_drop(_cache, watch->path, watch->length);
+    }
+    else
+    {
+        d_internal_stat_cache_drop(_cache, ".", 1);
+    }
+
+    if ( (_event->len == 0) ||
+         (_event->name[0] == '\0') )
+    {
+        return;
+    }
+
+    name_length = strlen(_event->name);
+
+    if (watch->length + name_length + 3 > sizeof(key))
+    {
+        _cache->generation++;
+
+        return;
+    }
+
+    length = 0;
+
+    if (watch->length)
+    {
+        d_memcpy(key, watch->path, watch->length);
+        length = watch->length;
+
+        if (key[length - 1] != D_FILE_PATH_SEP)
+        {
+            key[length++] = D_FILE_PATH_SEP;
+        }
+    }
+
+    d_memcpy(key + length, _event->name, name_length);
+    length      += name_length;
+    key[length]  = '\0';
+
+    if ( ( (_event->mask & IN_ISDIR) &&
+           (_event->mask & (IN_CREATE | IN_DELETE |
+                            IN_MOVED_FROM | IN_MOVED_TO)) ) ||
+         (d_internal_stat_cache_table_find(
+              &_cache->watches,
+              key,
+              length,
+              d_internal_stat_cache_hash(key, length)) != SIZE_MAX) )
+    {
+        _cache->generation++;
+
+        return;
+    }
+
+    d_internal_stat_cache_drop(_cache, key, length);
+
+    // "name/" is a separate key
+    key[length++] = D_FILE_PATH_SEP;
+    key[length]   = '\0';
+    d_internal_stat_cache_drop(_cache, key, length);
+
+    return;
+}
+
+
+/*
+d_internal_stat_cache_watch_main
+  Watcher thread: waits for inotify events and applies each batch under the
+write lock, so that queries never pay for draining the queue.
+*/
+static d_thread_result_t
+d_internal_stat_cache_watch_main
+(
+    void* _arg
+)
+{
+    struct d_stat_cache*        cache;
+    const struct inotify_event* event;
+    struct pollfd               fds[2];
+    ssize_t                     got;
+    size_t                      offset;
+    union
+    {
+        struct inotify_event event;
+        char                 bytes[16 * 1024];
+    } buffer;
+
+    cache = (struct d_stat_cache*)_arg;
+
+    fds[0].fd     = cache->inotify_fd;
+    fds[0].events = POLLIN;
+    fds[1].fd     = cache->wake[0];
+    fds[1].events = POLLIN;
+
+    for (;;)
+    {
+        fds[0].revents = 0;
+        fds[1].revents = 0;
+
+        if (poll(fds, 2, -1) < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+
+            break;
+        }
+
+        if (fds[1].revents)
+        {
+            break;
+        }
+
+        got = read(cache->inotify_fd, buffer.bytes, sizeof(buffer.bytes));
+
+        if (got <= 0)
+        {
+            if ( (got < 0) &&
+                 ( (errno == EINTR) ||
+                   (errno == EAGAIN) ) )
+            {
+                continue;
+            }
+
+            break;
+        }
+
+        d_rwlock_wrlock(&cache->lock);
+
+        for (offset = 0; offset < (size_t)got;
+             offset += sizeof(struct inotify_event) + event->len)
+        {
+            event = (const struct inotify_event*)(buffer.bytes + offset);
+            d_internal_stat_cache_dispatch(cache, event);
+        }
+
+        cache->event_seq++;
+        d_rwlock_unlock(&cache->lock);
+    }
+
+    return D_THREAD_SUCCESS;
+}
+
+
+/*
+d_internal_stat_cache_watch_start
+  Sets up inotify and the watcher thread; on failure the cache simply runs
+without watching.
+*/
+static void
+d_internal_stat_cache_watch_start
+(
+    struct d_stat_cache* _cache
+)
+{
+    _cache->inotify_fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    _cache->wake[0]    = -1;
+    _cache->wake[1]    = -1;
+
+    if (_cache->inotify_fd < 0)
+    {
+        return;
+    }
+
+    if (pipe(_cache->wake) != 0)
+    {
+        _cache->wake[0] = -1;
+        _cache->wake[1] = -1;
+    }
+    else if (d_thread_create(&_cache->watcher,
+                             d_internal_stat_cache_watch_main,
+                             _cache) == D_MUTEX_SUCCESS)
+    {
+        _cache->watching = true;
+
+        return;
+    }
+
+    if (_cache->wake[0] >= 0)
+    {
+        close(_cache->wake[0]);
+        close(_cache->wake[1]);
+    }
+
+    close(_cache->inotify_fd);
+    _cache->inotify_fd = -1;
+
+    return;
+}
+
+#else
+
+static bool
+d_internal_stat_cache_prepare
+(
+    struct d_stat_cache* _cache,
+    const char*          _key,
+    size_t               _length,
+    uint64_t*            _seq
+)
+{
+    (void)_cache;
+    (void)_key;
+    (void)_length;
+
+    *_seq = 0;
+
+    return false;
+}
+
+#endif  // D_STAT_CACHE_HAS_INOTIFY
+
+
+/*
+d_internal_stat_cache_query
+  Shared body of the single-path queries.
+*/
+static int
+d_internal_stat_cache_query
+(
+    struct d_stat_cache* _cache,
+    const char*          _path,
+    int                  _slot,
+    struct d_stat_t*     _buf
+)
+{
+    char                                key[D_FILE_PATH_MAX];
+    struct d_internal_stat_cache_record record;
+    size_t                              length;
+    uint64_t                            hash;
+    uint64_t                            seq;
+    int64_t                             now;
+    bool                                covered;
+    bool                                hit;
+
+    // parameter validation
+    if ( (!_path) ||
+         (!_buf) )
+    {
+        errno = EINVAL;
+
+        return -1;
+    }
+
+    length = (_cache) ? d_internal_stat_cache_key(_path, key) : 0;
+
+    if (length == 0)
+    {
+        return d_internal_stat_cache_uncached(_path, _slot, _buf);
+    }
+
+    hash = d_internal_stat_cache_hash(key, length);
+    now  = (_cache->ttl_ns) ? d_monotonic_time_ns() : 0;
+
+    d_rwlock_rdlock(&_cache->lock);
+    hit = d_internal_stat_cache_lookup(_cache,
+                                       key,
+                                       length,
+                                       hash,
+                                       _slot,
+                                       now,
+                                       &record);
+    d_rwlock_unlock(&_cache->lock);
+
+    if (hit)
+    {
+        d_atomic_fetch_add_ullong_explicit(&_cache->hits,
+                                           1,
+                                           D_MEMORY_ORDER_RELAXED);
+
+        return d_internal_stat_cache_result(&record, _buf);
+    }
+
+    d_atomic_fetch_add_ullong_explicit(&_cache->misses,
+                                       1,
+                                       D_MEMORY_ORDER_RELAXED);
+
+    covered = d_internal_stat_cache_prepare(_cache, key, length, &seq);
+    d_internal_stat_cache_resolve(_cache,
+                                  D_INTERNAL_STAT_CACHE_CWD,
+                                  key,
+                                  key,
+                                  _slot,
+                                  &record);
+
+    d_rwlock_wrlock(&_cache->lock);
+    d_internal_stat_cache_store(_cache,
+                                key,
+                                length,
+                                hash,
+                                _slot,
+                                &record,
+                                seq,
+                                covered);
+    d_rwlock_unlock(&_cache->lock);
+
+    return d_internal_stat_cache_result(&record, _buf);
+}
+
+
+/*
+d_internal_stat_cache_compare_misses
+  Orders batch misses by directory, then by name, so each directory is opened
+once.
+*/
+static int
+d_internal_stat_cache_compare_misses
+(
+    const void* _a,
+    const void* _b
+)
+{
+    const struct d_internal_stat_cache_miss* a;
+    const struct d_internal_stat_cache_miss* b;
+    size_t                                   common;
+    int                                      order;
+
+    a      = (const struct d_internal_stat_cache_miss*)_a;
+    b      = (const struct d_internal_stat_cache_miss*)_b;
+    common = (a->dir_length < b->dir_length) ? a->dir_length : b->dir_length;
+    order  = memcmp(a->arena + a->key, b->arena + b->key, common);
+
+    if (order != 0)
+    {
+        return order;
+    }
+
+    if (a->dir_length != b->dir_length)
+    {
+        return (a->dir_length < b->dir_length) ? -1 : 1;
+    }
+
+    return strcmp(a->arena + a->key + a->name, b->arena + b->key + b->name);
+}
+
+
+/*
+d_internal_stat_cache_resolve_misses
+  Resolves sorted batch misses, opening each directory once and stat'ing its
+entries relative to it. Directories that cannot be opened fall back to full
+paths, which also reproduces the exact error a plain stat would give.
+*/
+static void
+d_internal_stat_cache_resolve_misses
+(
+    struct d_stat_cache*               _cache,
+    struct d_internal_stat_cache_miss* _misses,
+    size_t                             _count,
+    int                                _slot
+)
+{
+    struct d_internal_stat_cache_miss* miss;
+    size_t                             i;
+#if D_STAT_CACHE_HAS_STATX
+    char                               dir[D_FILE_PATH_MAX];
+    size_t                             group;
+    int                                dirfd;
+    int                                flags;
+    bool                               relative;
+
+    flags = O_RDONLY | O_DIRECTORY | O_CLOEXEC;
+    #if defined(O_PATH)
+        flags |= O_PATH;
+    #endif
+
+    for (group = 0; group < _count; group = i)
+    {
+        miss  = &_misses[group];
+        dirfd = D_INTERNAL_STAT_CACHE_CWD;
+
+        if ( (miss->dir_length) &&
+             (d_atomic_load_int_explicit(&_cache->use_statx,
+                                         D_MEMORY_ORDER_RELAXED)) )
+        {
+            d_memcpy(dir, miss->arena + miss->key, miss->dir_length);
+            dir[miss->dir_length] = '\0';
+            dirfd = open(dir, flags);
+
+            if (dirfd < 0)
+            {
+                dirfd = D_INTERNAL_STAT_CACHE_CWD;
+            }
+        }
+
+        for (i = group;
+             ( (i < _count) &&
+               (_misses[i].dir_length == miss->dir_length) &&
+               (memcmp(_misses[i].arena + _misses[i].key,
+                       miss->arena + miss->key,
+                       miss->dir_length) == 0) );
+             i++)
+        {
+            // "/" has no final name to resolve relative to its directory
+            relative = ( (dirfd != D_INTERNAL_STAT_CACHE_CWD) &&
+                         (_misses[i].name < _misses[i].length) );
+
+            d_internal_stat_cache_resolve(
+                _cache,
+                (relative) ? dirfd : D_INTERNAL_STAT_CACHE_CWD,
+                _misses[i].arena + _misses[i].key +
+                    ((relative) ? _misses[i].name : 0),
+                _misses[i].arena + _misses[i].key,
+                _slot,
+                &_misses[i].record);
+        }
+
+        if (dirfd != D_INTERNAL_STAT_CACHE_CWD)
+        {
+            close(dirfd);
+        }
+    }
+#else
+    for (i = 0; i < _count; i++)
+    {
+        miss = &_misses[i];
+        d_internal_stat_cache_resolve(_cache,
+                                      D_INTERNAL_STAT_CACHE_CWD,
+                                      miss->arena + miss->key,
+                                      miss->arena + miss->key,
+                                      _slot,
+                                      &miss->record);
+    }
+#endif
+
+    return;
+}
+
+
+///////////////////////////////////////////////////////////////////////////////
+///             III.  CACHE LIFETIME                                        ///
+///////////////////////////////////////////////////////////////////////////////
+
+/*
+d_stat_cache_new
+  Creates a metadata cache.
+
+Parameter(s):
+  _options: configuration, or NULL for defaults (no TTL, no watching).
+Return:
+  A new cache, or NULL with errno set. D_STAT_CACHE_WATCH is a request: when
+  inotify is unavailable the cache is still created and relies on its TTL and
+  explicit invalidation (see d_stat_cache_is_watching).
+*/
+struct d_stat_cache*
+d_stat_cache_new
+(
+    const struct d_stat_cache_options* _options
+)
+{
+    struct d_stat_cache* cache;
+
+    cache = calloc(1, sizeof(struct d_stat_cache));
+
+    if (!cache)
+    {
+        errno = ENOMEM;
+
+        return NULL;
+    }
+
+    if (_options)
+    {
+        cache->ttl_ns      = (int64_t)_options->ttl_ns;
+        cache->max_entries = _options->max_entries;
+        cache->flags       = _options->flags;
+    }
+
+    if (cache->max_entries == 0)
+    {
+        cache->max_entries = D_STAT_CACHE_DEFAULT_MAX_ENTRIES;
+    }
+
+    if (d_rwlock_init(&cache->lock) != D_MUTEX_SUCCESS)
+    {
+        free(cache);
+        errno = ENOMEM;
+
+        return NULL;
+    }
+
+    d_atomic_init_int(&cache->use_statx, D_STAT_CACHE_HAS_STATX);
+    d_atomic_init_ullong(&cache->hits, 0);
+    d_atomic_init_ullong(&cache->misses, 0);
+    d_atomic_init_ullong(&cache->syscalls, 0);
+    d_atomic_init_ullong(&cache->invalidations, 0);
+
+#if D_STAT_CACHE_HAS_INOTIFY
+    cache->inotify_fd = -1;
+    cache->wake[0]    = -1;
+    cache->wake[1]    = -1;
+
+    if (cache->flags & D_STAT_CACHE_WATCH)
+    {
+        d_internal_stat_cache_watch_start(cache);
+    }
+#endif
+
+    return cache;
+}
+
+
+/*
+d_stat_cache_free
+  Stops watching and releases a cache and all its entries.
+
+Parameter(s):
+  _cache: cache to free; NULL is ignored.
+Return:
+  none.
+*/
+void
+d_stat_cache_free
+(
+    struct d_stat_cache* _cache
+)
+{
+    if (!_cache)
+    {
+        return;
+    }
+
+#if D_STAT_CACHE_HAS_INOTIFY
+    if (_cache->watching)
+    {
+        while ( (write(_cache->wake[1], "", 1) < 0) &&
+                (errno == EINTR) )
+        {
+        }
+
+        d_thread_join(_cache->watcher, NULL);
+        close(_cache->wake[0]);
+        close(_cache->wake[1]);
+        close(_cache->inotify_fd);
+    }
+
+    d_internal_stat_cache_table_clear(&_cache->watches);
+    free(_cache->watches.slots);
+    free(_cache->by_wd);
+#endif
+
+    d_internal_stat_cache_table_clear(&_cache->entries);
+    free(_cache->entries.slots);
+    d_rwlock_destroy(&_cache->lock);
+    free(_cache);
+
+    return;
+}
+
+
+/*
+d_stat_cache_is_watching
+  Tells whether a cache is being invalidated by filesystem events.
+
+Parameter(s):
+  _cache: cache to query.
+Return:
+  true if D_STAT_CACHE_WATCH was requested and inotify could be set up.
+*/
+bool
+d_stat_cache_is_watching
+(
+    const struct d_stat_cache* _cache
+)
+{
+    return ( (_cache) &&
+             (_cache->watching) );
+}
+
+
+///////////////////////////////////////////////////////////////////////////////
+///             IV.   QUERIES                                               ///
+///////////////////////////////////////////////////////////////////////////////
+
+/*
+d_stat_cache_stat
+  Cached d_stat.
+
+Parameter(s):
+  _cache: cache to consult, or NULL to call d_stat directly.
+  _path:  path to query.
+  _buf:   receives the status.
+Return:
+  0 on success, -1 with errno set on failure (cached failures included).
+*/
+int
+d_stat_cache_stat
+(
+    struct d_stat_cache* _cache,
+    const char*          _path,
+    struct d_stat_t*     _buf
+)
+{
+    return d_internal_stat_cache_query(_cache,
+                                       _path,
+                                       D_INTERNAL_STAT_CACHE_FOLLOW,
+                                       _buf);
+}
+
+
+/*
+d_stat_cache_lstat
+  Cached d_lstat.
+
+Parameter(s):
+  _cache: cache to consult, or NULL to call d_lstat directly.
+  _path:  path to query.
+  _buf:   receives the status.
+Return:
+  0 on success, -1 with errno set on failure (cached failures included).
+*/
+int
+d_stat_cache_lstat
+(
+    struct d_stat_cache* _cache,
+    const char*          _path,
+    struct d_stat_t*     _buf
+)
+{
+    return d_internal_stat_cache_query(_cache,
+                                       _path,
+                                       D_INTERNAL_STAT_CACHE_NOFOLLOW,
+                                       _buf);
+}
+
+
+/*
+d_stat_cache_file_exists
+  Cached d_file_exists.
+
+Parameter(s):
+  _cache: cache to consult, or NULL.
+  _path:  path to check.
+Return:
+  Non-zero if the path exists, 0 if not.
+*/
+int
+d_stat_cache_file_exists
+(
+    struct d_stat_cache* _cache,
+    const char*          _path
+)
+{
+    struct d_stat_t st;
+
+    if (!_path)
+    {
+        return 0;
+    }
+
+    return (d_stat_cache_stat(_cache, _path, &st) == 0) ? 1 : 0;
+}
+
+
+/*
+d_stat_cache_is_file
+  Cached d_is_file.
+
+Parameter(s):
+  _cache: cache to consult, or NULL.
+  _path:  path to check.
+Return:
+  Non-zero if the path is a regular file, 0 otherwise.
+*/
+int
+d_stat_cache_is_file
+(
+    struct d_stat_cache* _cache,
+    const char*          _path
+)
+{
+    struct d_stat_t st;
+
+    if (d_stat_cache_stat(_cache, _path, &st) != 0)
+    {
+        return 0;
+    }
+
+    return S_ISREG(st.st_mode) ? 1 : 0;
+}
+
+
+/*
+d_stat_cache_is_dir
+  Cached d_is_dir.
+
+Parameter(s):
+  _cache: cache to consult, or NULL.
+  _path:  path to check.
+Return:
+  Non-zero if the path is a directory, 0 otherwise.
+*/
+int
+d_stat_cache_is_dir
+(
+    struct d_stat_cache* _cache,
+    const char*          _path
+)
+{
+    struct d_stat_t st;
+
+    if (d_stat_cache_stat(_cache, _path, &st) != 0)
+    {
+        return 0;
+    }
+
+    return S_ISDIR(st.st_mode) ? 1 : 0;
+}
+
+
+/*
+d_stat_cache_is_symlink
+  Cached d_is_symlink.
+
+Parameter(s):
+  _cache: cache to consult, or NULL.
+  _path:  path to check.
+Return:
+  Non-zero if the path is a symbolic link, 0 otherwise.
+*/
+int
+d_stat_cache_is_symlink
+(
+    struct d_stat_cache* _cache,
+    const char*          _path
+)
+{
+    struct d_stat_t st;
+
+    if (d_stat_cache_lstat(_cache, _path, &st) != 0)
+    {
+        return 0;
+    }
+
+    return S_ISLNK(st.st_mode) ? 1 : 0;
+}
+
+
+/*
+d_stat_cache_stat_batch
+  Queries many paths at once. Hits are collected under a single shared lock;
+misses are sorted by directory and resolved relative to one descriptor per
+directory (statx), then stored under a single exclusive lock.
+
+Parameter(s):
+  _cache:        cache to consult, or NULL to stat every path.
+  _paths:        paths to query.
+  _count:        number of paths.
+  _follow_links: true for d_stat semantics, false for d_lstat.
+  _results:      receives one result per path, in input order.
+Return:
+  The number of paths whose stat succeeded, or 0 with errno set if the
+  arguments are invalid or memory runs out.
+*/
+size_t
+d_stat_cache_stat_batch
+(
+    struct d_stat_cache*        _cache,
+    const char* const*          _paths,
+    size_t                      _count,
+    bool                        _follow_links,
+    struct d_stat_cache_result* _results
+)
+{
+    struct d_internal_stat_cache_miss*  misses;
+    struct d_internal_stat_cache_miss*  miss;
+    struct d_internal_stat_cache_record record;
+    char                                key[D_FILE_PATH_MAX];
+    char*                               arena;
+    char*                               grown;
+    size_t                              arena_size;
+    size_t                              arena_capacity;
+    size_t                              miss_count;
+    size_t                              length;
+    size_t                              succeeded;
+    size_t                              i;
+    uint64_t                            hash;
+    uint64_t                            seq;
+    int64_t                             now;
+    int                                 slot;
+
+    // parameter validation
+    if ( (!_paths) ||
+         (!_results) )
+    {
+        errno = EINVAL;
+
+        return 0;
+    }
+
+    slot      = (_follow_links) ? D_INTERNAL_STAT_CACHE_FOLLOW
+                                : D_INTERNAL_STAT_CACHE_NOFOLLOW;
+    succeeded = 0;
+
+    if ( (!_cache) ||
+         (_count == 0) )
+    {
+        for (i = 0; i < _count; i++)
+        {
+            _results[i].error = 0;
+
+            if ( (!_paths[i]) ||
+                 (d_internal_stat_cache_uncached(_paths[i],
+                                                 slot,
+                                                 &_results[i].st) != 0) )
+            {
+                _results[i].error = (_paths[i]) ? errno : EINVAL;
+            }
+            else
+            {
+                succeeded++;
+            }
+        }
+
+        return succeeded;
+    }
+
+    misses         = malloc(_count * sizeof(*misses));
+    arena_capacity = 4096;
+    arena          = malloc(arena_capacity);
+
+    if ( (!misses) ||
+         (!arena) )
+    {
+        free(misses);
+        free(arena);
+        errno = ENOMEM;
+
+        return 0;
+    }
+
+    arena_size = 0;
+    miss_count = 0;
+    now        = (_cache->ttl_ns) ? d_monotonic_time_ns() : 0;
+
+    // pass 1: answer what the cache can, queue the rest
+    d_rwlock_rdlock(&_cache->lock);
+
+    for (i = 0; i < _count; i++)
+    {
+        _results[i].error = 0;
+        length            = (_paths[i])
+                                ? d_internal_stat_cache_key(_paths[i], key)
+                                : 0;
+
+        if (length == 0)
+        {
+            if (!_paths[i])
+            {
+                _results[i].error = EINVAL;
+            }
+            else if (d_internal_stat_cache_uncached(_paths[i],
+                                                    slot,
+                                                    &_results[i].st) != 0)
+            {
+                _results[i].error = errno;
+            }
+
+            continue;
+        }
+
+        hash = d_internal_stat_cache_hash(key, length);
+
+        if (d_internal_stat_cache_lookup(_cache,
+                                         key,
+                                         length,
+                                         hash,
+                                         slot,
+                                         now,
+                                         &record))
+        {
+            _results[i].st    = record.st;
+            _results[i].error = record.error;
+            d_atomic_fetch_add_ullong_explicit(&_cache->hits,
+                                               1,
+                                               D_MEMORY_ORDER_RELAXED);
+
+            continue;
+        }
+
+        if (arena_size + length + 1 > arena_capacity)
+        {
+            while (arena_size + length + 1 > arena_capacity)
+            {
+                arena_capacity *= 2;
+            }
+
+            grown = realloc(arena, arena_capacity);
+
+            if (!grown)
+            {
+                // resolve this one uncached rather than fail the batch
+                if (d_internal_stat_cache_uncached(key,
+                                                   slot,
+                                                   &_results[i].st) != 0)
+                {
+                    _results[i].error = errno;
+                }
+
+                continue;
+            }
+
+            arena = grown;
+        }
+
+        miss             = &misses[miss_count++];
+        miss->index      = i;
+        miss->key        = arena_size;
+        miss->length     = length;
+        miss->hash       = hash;
+        miss->dir_length = d_internal_stat_cache_split(key, length, &miss->name);
+
+        d_memcpy(arena + arena_size, key, length + 1);
+        arena_size += length + 1;
+    }
+
+    d_rwlock_unlock(&_cache->lock);
+
+    if (miss_count)
+    {
+        d_atomic_fetch_add_ullong_explicit(&_cache->misses,
+                                           miss_count,
+                                           D_MEMORY_ORDER_RELAXED);
+
+        for (i = 0; i < miss_count; i++)
+        {
+            misses[i].arena   = arena;
+            misses[i].covered = false;
+        }
+
+        qsort(misses,
+              miss_count,
+              sizeof(*misses),
+              d_internal_stat_cache_compare_misses);
+
+        // pass 2: watch the directories involved, then resolve
+        seq = 0;
+
+#if D_STAT_CACHE_HAS_INOTIFY
+        if (_cache->watching)
+        {
+            d_rwlock_wrlock(&_cache->lock);
+
+            for (i = 0; i < miss_count; i++)
+            {
+                misses[i].covered =
+                    d_internal_stat_cache_cover(_cache,
+                                                arena + misses[i].key,
+                                                misses[i].length);
+            }
+
+            seq = _cache->event_seq;
+            d_rwlock_unlock(&_cache->lock);
+        }
+#endif
+
+        d_internal_stat_cache_resolve_misses(_cache, misses, miss_count, slot);
+
+        // pass 3: record everything under one exclusive lock
+        d_rwlock_wrlock(&_cache->lock);
+
+        for (i = 0; i < miss_count; i++)
+        {
+            miss = &misses[i];
+
+            _results[miss->index].st    = miss->record.st;
+            _results[miss->index].error = miss->record.error;
+
+            d_internal_stat_cache_store(_cache,
+                                        arena + miss->key,
+                                        miss->length,
+                                        miss->hash,
+                                        slot,
+                                        &miss->record,
+                                        seq,
+                                        miss->covered);
+        }
+
+        d_rwlock_unlock(&_cache->lock);
+    }
+
+    free(misses);
+    free(arena);
+
+    for (i = 0; i < _count; i++)
+    {
+        if (_results[i].error == 0)
+        {
+            succeeded++;
+        }
+    }
+
+    return succeeded;
+}
+
+
+///////////////////////////////////////////////////////////////////////////////
+///             V.    INVALIDATION AND STATISTICS                           ///
+///////////////////////////////////////////////////////////////////////////////
+
+/*
+d_stat_cache_invalidate
+  Forgets everything cached about one path.
+
+Parameter(s):
+  _cache: cache to update; NULL is ignored.
+  _path:  path whose entry is dropped (normalized like a query).
+Return:
+  none.
+*/
+void
+d_stat_cache_invalidate
+(
+    struct d_stat_cache* _cache,
+    const char*          _path
+)
+{
+    char   key[D_FILE_PATH_MAX];
+    size_t length;
+
+    if ( (!_cache) ||
+         (!_path) )
+    {
+        return;
+    }
+
+    length = d_internal_stat_cache_key(_path, key);
+
+    if (length)
+    {
+        d_rwlock_wrlock(&_cache->lock);
+        d_internal_stat_cache_drop(_cache, key, length);
+        d_rwlock_unlock(&_cache->lock);
+    }
+
+    return;
+}
+
+
+/*
+d_stat_cache_invalidate_all
+  Makes every cached entry stale in O(1) by advancing the cache generation.
+Stale entries are refreshed in place the next time they are queried.
+
+Parameter(s):
+  _cache: cache to update; NULL is ignored.
+Return:
+  none.
+*/
+void
+d_stat_cache_invalidate_all
+(
+    struct d_stat_cache* _cache
+)
+{
+    if (!_cache)
+    {
+        return;
+    }
+
+    d_rwlock_wrlock(&_cache->lock);
+    _cache->generation++;
+    d_rwlock_unlock(&_cache->lock);
+
+    return;
+}
+
+
+/*
+d_stat_cache_get_stats
+  Reads the cache counters.
+
+Parameter(s):
+  _cache: cache to query.
+  _stats: receives the counters; zeroed if `_cache` is NULL.
+Return:
+  none.
+*/
+void
+d_stat_cache_get_stats
+(
+    struct d_stat_cache*       _cache,
+    struct d_stat_cache_stats* _stats
+)
+{
+    if (!_stats)
+    {
+        return;
+    }
+
+    d_memset(_stats, 0, sizeof(struct d_stat_cache_stats));
+
+    if (!_cache)
+    {
+        return;
+    }
+
+    _stats->hits          = d_atomic_load_ullong(&_cache->hits);
+    _stats->misses        = d_atomic_load_ullong(&_cache->misses);
+    _stats->syscalls      = d_atomic_load_ullong(&_cache->syscalls);
+    _stats->invalidations = d_atomic_load_ullong(&_cache->invalidations);
+
+    d_rwlock_rdlock(&_cache->lock);
+    _stats->entries = _cache->entries.count;
+#if D_STAT_CACHE_HAS_INOTIFY
+    _stats->watches = _cache->watches.count;
+#endif
+    d_rwlock_unlock(&_cache->lock);
+
+    return;
+}
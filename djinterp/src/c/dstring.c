@@ -2820,6 +2820,127 @@ d_string_append_formatted
     return true;
 }
 
+/*
+d_string_append_int
+  Append the decimal text of a signed integer without going through a format
+string.
+
+Parameter(s):
+  _string: d_string to modify.
+  _value:  value to append.
+Return:
+  true if successful, false otherwise.
+*/
+bool
+d_string_append_int
+(
+    struct d_string* _string,
+    int64_t          _value
+)
+{
+    if ( (_string == NULL) ||
+         (!d_string_internal_grow(_string,
+                                  _string->size + D_FMT_INT_BUFFER_SIZE)) )
+    {
+        return false;
+    }
+
+    _string->size += d_fmt_int64(_string->text + _string->size, _value);
+
+    return true;
+}
+
+/*
+d_string_append_uint
+  Append the decimal text of an unsigned integer.
+
+Parameter(s):
+  _string: d_string to modify.
+  _value:  value to append.
+Return:
+  true if successful, false otherwise.
+*/
+bool
+d_string_append_uint
+(
+    struct d_string* _string,
+    uint64_t         _value
+)
+{
+    if ( (_string == NULL) ||
+         (!d_string_internal_grow(_string,
+                                  _string->size + D_FMT_INT_BUFFER_SIZE)) )
+    {
+        return false;
+    }
+
+    _string->size += d_fmt_uint64(_string->text + _string->size, _value);
+
+    return true;
+}
+
+/*
+d_string_append_hex
+  Append the lowercase hexadecimal text of a value, without prefix or leading
+zeros.
+
+Parameter(s):
+  _string: d_string to modify.
+  _value:  value to append.
+Return:
+  true if successful, false otherwise.
+*/
+bool
+d_string_append_hex
+(
+    struct d_string* _string,
+    uint64_t         _value
+)
+{
+    if ( (_string == NULL) ||
+         (!d_string_internal_grow(_string,
+                                  _string->size + D_FMT_HEX_BUFFER_SIZE)) )
+    {
+        return false;
+    }
+
+    _string->size += d_fmt_hex64(_string->text + _string->size,
+                                 _value,
+                                 false);
+
+    return true;
+}
+
+/*
+d_string_append_double
+  Append the shortest text that reads back as exactly `_value` (see
+d_fmt_double).
+
+Parameter(s):
+  _string: d_string to modify.
+  _value:  value to append.
+Return:
+  true if successful, false otherwise.
+*/
+bool
+d_string_append_double
+(
+    struct d_string* _string,
+    double           _value
+)
+{
+    if ( (_string == NULL) ||
+         (!d_string_internal_grow(_string,
+                                  _string->size + D_FMT_DOUBLE_BUFFER_SIZE)) )
+    {
+        return false;
+    }
+
+    _string->size += d_fmt_double(_string->text + _string->size, _value);
+
+    return true;
+}
+
 
 /******************************************************************************
 * Modification Functions - Prepend
@@ -0,0 +1,1543 @@
+/******************************************************************************
+* djinterp [core]                                                      dwalk.c
+*
+* Implementation of the parallel recursive directory walker.
+*
+* path:      \src\dwalk.c
+* link:      TBA
+* author(s): Samuel 'teer' Neal-Blim                          date: 2026.10.18
+******************************************************************************/
+#include "..\..\inc\c\dwalk.h"
+#include "..\..\inc\c\dmutex.h"
+#include "..\..\inc\c\string_fn.h"
+
+#if defined(D_FILE_PLATFORM_POSIX)
+    #include <dirent.h>
+    #include <fcntl.h>
+    #include <sys/stat.h>
+#endif
+
+#if D_DIR_WALK_HAS_GETDENTS
+    #include <sys/syscall.h>
+#endif
+
+
+///////////////////////////////////////////////////////////////////////////////
+///             INTERNAL DEFINITIONS                                        ///
+///////////////////////////////////////////////////////////////////////////////
+
+// D_INTERNAL_WALK_FLUSH_EVERY
+//   constant: subdirectories gathered before a worker publishes them to its
+// deque, so thieves can start on a huge directory before it is fully read.
+#define D_INTERNAL_WALK_FLUSH_EVERY 64
+
+// d_internal_walk_task
+//   type: one directory waiting to be read.
+struct d_internal_walk_task
+{
+    char*  path;    // full path, owned by the task
+    size_t length;  // strlen(path)
+    size_t depth;   // 0 for the root
+};
+
+// d_internal_walk_deque
+//   type: a worker's pending directories. The owner pushes and pops at the
+// tail (depth-first, cache-warm); thieves take from the head (the oldest and
+// usually largest subtrees).
+struct d_internal_walk_deque
+{
+    d_mutex_t                    lock;
+    struct d_internal_walk_task* tasks;
+    size_t                       head;
+    size_t                       tail;
+    size_t                       capacity;
+};
+
+// d_internal_walk_slot
+//   type: a collected entry before the per-worker string pools are merged.
+struct d_internal_walk_slot
+{
+    size_t   offset;    // into the worker's string pool
+    uint64_t ino;
+    uint32_t depth;
+    uint8_t  type;
+};
+
+struct d_internal_walk_context;
+
+// d_internal_walk_worker
+//   type: per-thread walk state.
+struct d_internal_walk_worker
+{
+    struct d_internal_walk_context* context;
+    size_t                          index;
+    struct d_internal_walk_deque    deque;
+    struct d_internal_walk_task*    pending;        // found, not yet published
+    size_t                          pending_count;
+    size_t                          pending_capacity;
+    char*                           path;           // D_FILE_PATH_MAX scratch
+    char*                           dents;          // getdents64 buffer
+    bool                            stopped;
+    size_t                          errors;
+
+    // collect mode
+    struct d_internal_walk_slot*    slots;
+    size_t                          slot_count;
+    size_t                          slot_capacity;
+    char*                           strings;
+    size_t                          strings_length;
+    size_t                          strings_capacity;
+};
+
+// d_internal_walk_context
+//   type: state shared by all workers of one walk. `outstanding` counts
+// directories queued or being read; the walk is over when it reaches zero.
+// `generation` changes whenever work is published, so a worker about to
+// sleep can tell that its fruitless scan is already stale.
+struct d_internal_walk_context
+{
+    struct d_dir_walk_options      options;
+    fn_dir_walk_visit              visit;
+    void*                          user_data;
+    bool                           collect;
+    const char*                    root;
+    size_t                         relative_offset;
+#if defined(D_FILE_PLATFORM_POSIX)
+    int                            root_fd;
+#endif
+    struct d_internal_walk_worker* workers;
+    size_t                         worker_count;
+
+    d_mutex_t                      lock;
+    d_cond_t                       wake;
+    size_t                         outstanding;
+    size_t                         sleepers;
+    size_t                         generation;
+    bool                           stop;
+};
+
+#if D_DIR_WALK_HAS_GETDENTS
+
+// d_internal_dirent64
+//   type: record layout returned by getdents64.
+struct d_internal_dirent64
+{
+    uint64_t       d_ino;
+    int64_t        d_off;
+    unsigned short d_reclen;
+    unsigned char  d_type;
+    char           d_name[];
+};
+
+#endif  // D_DIR_WALK_HAS_GETDENTS
+
+
+///////////////////////////////////////////////////////////////////////////////
+///             WORK-STEALING DEQUE                                         ///
+///////////////////////////////////////////////////////////////////////////////
+
+/*
+d_internal_walk_deque_push
+  Appends tasks at the tail of a deque (caller holds no deque lock).
+
+Return:
+  true on success, false if the deque could not grow.
+*/
+static bool
+d_internal_walk_deque_push
+(
+    struct d_internal_walk_deque* _deque,
+    struct d_internal_walk_task*  _tasks,
+    size_t                        _count
+)
+{
+    struct d_internal_walk_task* grown;
+    size_t                       live;
+    size_t                       capacity;
+
+    d_mutex_lock(&_deque->lock);
+
+    live = _deque->tail - _deque->head;
+
+    // slide the live window to the front before growing
+    if ( (_deque->head > 0) &&
+         (_deque->tail + _count > _deque->capacity) )
+    {
+        memmove(_deque->tasks,
+                _deque->tasks + _deque->head,
+                live * sizeof(struct d_internal_walk_task));
+        _deque->head = 0;
+        _deque->tail = live;
+    }
+
+    if (_deque->tail + _count > _deque->capacity)
+    {
+        capacity = (_deque->capacity) ? (_deque->capacity * 2) : 64;
+
+        while (capacity < _deque->tail + _count)
+        {
+            capacity *= 2;
+        }
+
+        grown = realloc(_deque->tasks, capacity * sizeof(struct d_internal_walk_task));
+        if (!grown)
+        {
+            d_mutex_unlock(&_deque->lock);
+
+            return false;
+        }
+
+        _deque->tasks    = grown;
+        _deque->capacity = capacity;
+    }
+
+    d_memcpy(_deque->tasks + _deque->tail,
+             _tasks,
+             _count * sizeof(struct d_internal_walk_task));
+    _deque->tail += _count;
+
+    d_mutex_unlock(&_deque->lock);
+
+    return true;
+}
+
+
+/*
+d_internal_walk_deque_take
+  Removes one task from the tail (owner) or head (thief) of a deque.
+
+Return:
+  true if a task was taken.
+*/
+static bool
+d_internal_walk_deque_take
+(
+    struct d_internal_walk_deque* _deque,
+    bool                          _steal,
+    struct d_internal_walk_task*  _task
+)
+{
+    bool taken;
+
+    d_mutex_lock(&_deque->lock);
+
+    taken = (_deque->tail > _deque->head);
+
+    if (taken)
+    {
+        if (_steal)
+        {
+            *_task = _deque->tasks[_deque->head++];
+        }
+        else
+        {
+            *_task = _deque->tasks[--_deque->tail];
+        }
+
+        if (_deque->head == _deque->tail)
+        {
+            _deque->head = 0;
+            _deque->tail = 0;
+        }
+    }
+
+    d_mutex_unlock(&_deque->lock);
+
+    return taken;
+}
+
+
+/*
+d_internal_walk_next_task
+  Finds the next directory for a worker: its own deque first, then the other
+workers' deques in round-robin order starting after itself.
+*/
+static bool
+d_internal_walk_next_task
+(
+    struct d_internal_walk_worker* _worker,
+    struct d_internal_walk_task*   _task
+)
+{
+    struct d_internal_walk_context* context;
+    size_t                          i;
+
+    context = _worker->context;
+
+    if (d_internal_walk_deque_take(&_worker->deque, false, _task))
+    {
+        return true;
+    }
+
+    for (i = 1; i < context->worker_count; i++)
+    {
+        if (d_internal_walk_deque_take(
+                &context->workers[(_worker->index + i) % context->worker_count].deque,
+                true,
+                _task))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+
+/*
+d_internal_walk_publish
+  Moves a worker's pending subdirectories into its deque and updates the
+shared bookkeeping. `_finished` is true when the directory that produced them
+is done, which retires it from the outstanding count. The deque push happens
+under the context lock so that a worker deciding to sleep cannot miss it.
+*/
+static void
+d_internal_walk_publish
+(
+    struct d_internal_walk_worker* _worker,
+    bool                           _finished
+)
+{
+    struct d_internal_walk_context* context;
+    size_t                          count;
+    size_t                          i;
+
+    context = _worker->context;
+    count   = _worker->pending_count;
+
+    d_mutex_lock(&context->lock);
+
+    if ( (count > 0) &&
+         (!d_internal_walk_deque_push(&_worker->deque, _worker->pending, count)) )
+    {
+        // out of memory: drop these subtrees rather than the whole walk
+        for (i = 0; i < count; i++)
+        {
+            free(_worker->pending[i].path);
+        }
+
+        _worker->errors += count;
+        count            = 0;
+    }
+
+    _worker->pending_count = 0;
+    context->outstanding  += count;
+
+    if (_finished)
+    {
+        context->outstanding--;
+    }
+
+    if (_worker->stopped)
+    {
+        context->stop = true;
+    }
+
+    _worker->stopped = context->stop;
+
+    if (count > 0)
+    {
+        context->generation++;
+    }
+
+    if ( (context->sleepers > 0) &&
+         ( (count > 0)                    ||
+           (context->outstanding == 0)    ||
+           (context->stop) ) )
+    {
+        d_cond_broadcast(&context->wake);
+    }
+
+    d_mutex_unlock(&context->lock);
+
+    return;
+}
+
+
+/*
+d_internal_walk_defer
+  Queues a subdirectory on the worker's pending list, publishing the list
+when it fills.
+*/
+static void
+d_internal_walk_defer
+(
+    struct d_internal_walk_worker* _worker,
+    const char*                    _path,
+    size_t                         _length,
+    size_t                         _depth
+)
+{
+    struct d_internal_walk_task* grown;
+    char*                        copy;
+
+    if (_worker->pending_count == _worker->pending_capacity)
+    {
+        grown = realloc(_worker->pending,
+                        (_worker->pending_capacity + D_INTERNAL_WALK_FLUSH_EVERY) *
+                            sizeof(struct d_internal_walk_task));
+        if (!grown)
+        {
+            _worker->errors++;
+
+            return;
+        }
+
+        _worker->pending           = grown;
+        _worker->pending_capacity += D_INTERNAL_WALK_FLUSH_EVERY;
+    }
+
+    copy = malloc(_length + 1);
+    if (!copy)
+    {
+        _worker->errors++;
+
+        return;
+    }
+
+    d_memcpy(copy, _path, _length + 1);
+
+    _worker->pending[_worker->pending_count].path   = copy;
+    _worker->pending[_worker->pending_count].length = _length;
+    _worker->pending[_worker->pending_count].depth  = _depth;
+    _worker->pending_count++;
+
+    if (_worker->pending_count >= D_INTERNAL_WALK_FLUSH_EVERY)
+    {
+        d_internal_walk_publish(_worker, false);
+    }
+
+    return;
+}
+
+
+///////////////////////////////////////////////////////////////////////////////
+///             ENTRY HANDLING                                              ///
+///////////////////////////////////////////////////////////////////////////////
+
+/*
+d_internal_walk_matches_any
+  Tests an entry against a pattern list; patterns containing '/' see the
+relative path, others only the name.
+*/
+static bool
+d_internal_walk_matches_any
+(
+    const char* const* _patterns,
+    size_t             _count,
+    const char*        _relative,
+    const char*        _name
+)
+{
+    size_t i;
+
+    for (i = 0; i < _count; i++)
+    {
+        if ( (_patterns[i]) &&
+             (d_dir_walk_glob_match(_patterns[i],
+                                    (strchr(_patterns[i], '/')) ? _relative
+                                                                : _name)) )
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+
+/*
+d_internal_walk_record
+  Appends an entry to the worker's collection.
+
+Return:
+  true on success, false on allocation failure.
+*/
+static bool
+d_internal_walk_record
+(
+    struct d_internal_walk_worker*  _worker,
+    const struct d_dir_walk_entry*  _entry
+)
+{
+    struct d_internal_walk_slot* slots;
+    char*                        strings;
+    size_t                       capacity;
+
+    if (_worker->slot_count == _worker->slot_capacity)
+    {
+        capacity = (_worker->slot_capacity) ? (_worker->slot_capacity * 2) : 256;
+        slots    = realloc(_worker->slots, capacity * sizeof(struct d_internal_walk_slot));
+
+        if (!slots)
+        {
+            return false;
+        }
+
+        _worker->slots         = slots;
+        _worker->slot_capacity = capacity;
+    }
+
+    if (_worker->strings_length + _entry->path_len + 1 > _worker->strings_capacity)
+    {
+        capacity = (_worker->strings_capacity) ? (_worker->strings_capacity * 2)
+                                               : (16 * 1024);
+
+        while (capacity < _worker->strings_length + _entry->path_len + 1)
+        {
+            capacity *= 2;
+        }
+
+        strings = realloc(_worker->strings, capacity);
+        if (!strings)
+        {
+            return false;
+        }
+
+        _worker->strings          = strings;
+        _worker->strings_capacity = capacity;
+    }
+
+    d_memcpy(_worker->strings + _worker->strings_length,
+             _entry->path,
+             _entry->path_len + 1);
+
+    _worker->slots[_worker->slot_count].offset = _worker->strings_length;
+    _worker->slots[_worker->slot_count].ino    = _entry->ino;
+    _worker->slots[_worker->slot_count].depth  = (uint32_t)_entry->depth;
+    _worker->slots[_worker->slot_count].type   = _entry->type;
+    _worker->slot_count++;
+
+    _worker->strings_length += _entry->path_len + 1;
+
+    return true;
+}
+
+
+/*
+d_internal_walk_report_error
+  Counts an unreadable path and forwards it to the error callback.
+*/
+static void
+d_internal_walk_report_error
+(
+    struct d_internal_walk_worker* _worker,
+    const char*                    _path,
+    int                            _error
+)
+{
+    struct d_internal_walk_context* context;
+
+    context = _worker->context;
+    _worker->errors++;
+
+    if (context->options.on_error)
+    {
+        context->options.on_error(_path, _error, context->user_data);
+    }
+
+    return;
+}
+
+
+#if defined(D_FILE_PLATFORM_POSIX)
+
+/*
+d_internal_walk_type_of
+  Resolves DT_UNKNOWN with an fstatat relative to the open directory.
+*/
+static uint8_t
+d_internal_walk_type_of
+(
+    int         _dir_fd,
+    const char* _name
+)
+{
+    struct stat st;
+
+    if (fstatat(_dir_fd, _name, &st, AT_SYMLINK_NOFOLLOW) != 0)
+    {
+        return DT_UNKNOWN;
+    }
+
+    if (S_ISREG(st.st_mode))  return DT_REG;
+    if (S_ISDIR(st.st_mode))  return DT_DIR;
+    if (S_ISLNK(st.st_mode))  return DT_LNK;
+    if (S_ISCHR(st.st_mode))  return DT_CHR;
+    if (S_ISBLK(st.st_mode))  return DT_BLK;
+    if (S_ISFIFO(st.st_mode)) return DT_FIFO;
+    if (S_ISSOCK(st.st_mode)) return DT_SOCK;
+
+    return DT_UNKNOWN;
+}
+
+#endif  // D_FILE_PLATFORM_POSIX
+
+
+/*
+d_internal_walk_entry
+  Filters, reports and (for directories) defers one listing entry.
+
+Parameter(s):
+  _worker:  worker reading the directory.
+  _task:    the directory being read.
+  _dir_fd:  its open descriptor (POSIX; -1 elsewhere).
+  _name:    entry name.
+  _ino:     inode number from the listing.
+  _type:    DT_* type from the listing (may be DT_UNKNOWN).
+Return:
+  none.
+*/
+static void
+d_internal_walk_entry
+(
+    struct d_internal_walk_worker*     _worker,
+    const struct d_internal_walk_task* _task,
+    int                                _dir_fd,
+    const char*                        _name,
+    uint64_t                           _ino,
+    uint8_t                            _type
+)
+{
+    struct d_internal_walk_context* context;
+    struct d_dir_walk_entry         entry;
+    size_t                          name_length;
+    size_t                          prefix;
+    int                             verdict;
+    bool                            is_dir;
+
+    context = _worker->context;
+
+    // "." and ".."
+    if ( (_name[0] == '.') &&
+         ( (_name[1] == '\0') ||
+           ( (_name[1] == '.') && (_name[2] == '\0') ) ) )
+    {
+        return;
+    }
+
+    if ( (context->options.flags & D_DIR_WALK_SKIP_HIDDEN) &&
+         (_name[0] == '.') )
+    {
+        return;
+    }
+
+    // build "<dir>/<name>" in the worker's scratch buffer
+    name_length = strlen(_name);
+    prefix      = _task->length;
+
+    if ( (prefix > 0) &&
+         (_task->path[prefix - 1] != '/') &&
+         (_task->path[prefix - 1] != '\\') )
+    {
+        prefix++;
+    }
+
+    if (prefix + name_length >= D_FILE_PATH_MAX)
+    {
+        d_internal_walk_report_error(_worker, _task->path, ENAMETOOLONG);
+
+        return;
+    }
+
+    d_memcpy(_worker->path, _task->path, _task->length);
+
+    if (prefix > _task->length)
+    {
+        _worker->path[_task->length] = '/';
+    }
+
+    d_memcpy(_worker->path + prefix, _name, name_length + 1);
+
+#if defined(D_FILE_PLATFORM_POSIX)
+    if (_type == DT_UNKNOWN)
+    {
+        _type = d_internal_walk_type_of(_dir_fd, _name);
+    }
+#else
+    (void)_dir_fd;
+#endif
+
+    entry.path     = _worker->path;
+    entry.path_len = prefix + name_length;
+    entry.relative = _worker->path + context->relative_offset;
+    entry.name     = _worker->path + prefix;
+    entry.ino      = _ino;
+    entry.depth    = _task->depth + 1;
+    entry.type     = _type;
+
+    is_dir = (_type == DT_DIR);
+
+    if (d_internal_walk_matches_any(context->options.exclude,
+                                    context->options.exclude_count,
+                                    entry.relative,
+                                    entry.name))
+    {
+        return;
+    }
+
+    verdict = D_DIR_WALK_CONTINUE;
+
+    if ( (is_dir)
+             ? (!(context->options.flags & D_DIR_WALK_NO_DIRS))
+             : ( (!(context->options.flags & D_DIR_WALK_NO_FILES)) &&
+                 ( (context->options.include_count == 0) ||
+                   (d_internal_walk_matches_any(context->options.include,
+                                                context->options.include_count,
+                                                entry.relative,
+                                                entry.name)) ) ) )
+    {
+        if (context->collect)
+        {
+            if (!d_internal_walk_record(_worker, &entry))
+            {
+                d_internal_walk_report_error(_worker, entry.path, ENOMEM);
+            }
+        }
+        else
+        {
+            verdict = context->visit(&entry, context->user_data);
+        }
+    }
+
+    if (verdict == D_DIR_WALK_STOP)
+    {
+        _worker->stopped = true;
+
+        return;
+    }
+
+    if ( (is_dir) &&
+         (verdict != D_DIR_WALK_SKIP) &&
+         ( (context->options.max_depth == 0) ||
+           (entry.depth < context->options.max_depth) ) )
+    {
+        d_internal_walk_defer(_worker, entry.path, entry.path_len, entry.depth);
+    }
+
+    return;
+}
+
+
+/*
+d_internal_walk_directory
+  Reads one directory, handling every entry.
+*/
+static void
+d_internal_walk_directory
+(
+    struct d_internal_walk_worker*     _worker,
+    const struct d_internal_walk_task* _task
+)
+{
+    struct d_internal_walk_context* context;
+
+    context = _worker->context;
+
+#if defined(D_FILE_PLATFORM_POSIX)
+    {
+        int fd;
+
+        // the root prefix is resolved once, at d_dir_walk entry
+        fd = openat(context->root_fd,
+                    (_task->depth == 0) ? "." : (_task->path + context->relative_offset),
+                    O_RDONLY | O_DIRECTORY | O_NOFOLLOW | O_CLOEXEC);
+
+        if (fd < 0)
+        {
+            d_internal_walk_report_error(_worker, _task->path, errno);
+
+            return;
+        }
+
+    #if D_DIR_WALK_HAS_GETDENTS
+        {
+            struct d_internal_dirent64* record;
+            long                        bytes;
+            long                        at;
+
+            for (;;)
+            {
+                bytes = syscall(SYS_getdents64, fd, _worker->dents, D_DIR_WALK_BUFFER_SIZE);
+
+                if (bytes < 0)
+                {
+                    if (errno == EINTR)
+                    {
+                        continue;
+                    }
+
+                    d_internal_walk_report_error(_worker, _task->path, errno);
+
+                    break;
+                }
+
+                if (bytes == 0)
+                {
+                    break;
+                }
+
+                for (at = 0; ( (at < bytes) && (!_worker->stopped) ); at += record->d_reclen)
+                {
+                    record = (struct d_internal_dirent64*)(_worker->dents + at);
+
+                    d_internal_walk_entry(_worker,
+                                          _task,
+                                          fd,
+                                          record->d_name,
+                                          record->d_ino,
+                                          record->d_type);
+                }
+
+                if (_worker->stopped)
+                {
+                    break;
+                }
+            }
+
+            close(fd);
+        }
+    #else
+        {
+            DIR*           dir;
+            struct dirent* record;
+
+            dir = fdopendir(fd);
+            if (!dir)
+            {
+                d_internal_walk_report_error(_worker, _task->path, errno);
+                close(fd);
+
+                return;
+            }
+
+            while ( (!_worker->stopped) &&
+                    ((record = readdir(dir)) != NULL) )
+            {
+        #ifdef _DIRENT_HAVE_D_TYPE
+                d_internal_walk_entry(_worker, _task, dirfd(dir),
+                                      record->d_name, record->d_ino, record->d_type);
+        #else
+                d_internal_walk_entry(_worker, _task, dirfd(dir),
+                                      record->d_name, record->d_ino, DT_UNKNOWN);
+        #endif
+            }
+
+            // also closes fd
+            closedir(dir);
+        }
+    #endif
+    }
+#else
+    {
+        struct d_dir_t*    dir;
+        struct d_dirent_t* record;
+
+        dir = d_opendir((_task->depth == 0) ? context->root : _task->path);
+        if (!dir)
+        {
+            d_internal_walk_report_error(_worker, _task->path, (errno) ? errno : ENOENT);
+
+            return;
+        }
+
+        while ( (!_worker->stopped) &&
+                ((record = d_readdir(dir)) != NULL) )
+        {
+            d_internal_walk_entry(_worker, _task, -1,
+                                  record->d_name, record->d_ino, record->d_type);
+        }
+
+        d_closedir(dir);
+    }
+#endif
+
+    return;
+}
+
+
+/*
+d_internal_walk_worker_run
+  Worker loop: read directories until the shared outstanding count drops to
+zero or the walk is stopped.
+*/
+static void
+d_internal_walk_worker_run
+(
+    struct d_internal_walk_worker* _worker
+)
+{
+    struct d_internal_walk_context* context;
+    struct d_internal_walk_task     task;
+    size_t                          seen;
+
+    context = _worker->context;
+
+    for (;;)
+    {
+        if ( (!_worker->stopped) &&
+             (d_internal_walk_deque_take(&_worker->deque, false, &task)) )
+        {
+            d_internal_walk_directory(_worker, &task);
+            free(task.path);
+            d_internal_walk_publish(_worker, true);
+
+            continue;
+        }
+
+        // out of local work: note the generation, then try to steal
+        d_mutex_lock(&context->lock);
+        seen             = context->generation;
+        _worker->stopped = context->stop;
+        d_mutex_unlock(&context->lock);
+
+        if ( (!_worker->stopped) &&
+             (d_internal_walk_next_task(_worker, &task)) )
+        {
+            d_internal_walk_directory(_worker, &task);
+            free(task.path);
+            d_internal_walk_publish(_worker, true);
+
+            continue;
+        }
+
+        d_mutex_lock(&context->lock);
+
+        if ( (context->stop) ||
+             (context->outstanding == 0) )
+        {
+            d_mutex_unlock(&context->lock);
+
+            break;
+        }
+
+        // nothing published since the scan began: sleep until it is
+        if (context->generation == seen)
+        {
+            context->sleepers++;
+            d_cond_wait(&context->wake, &context->lock);
+            context->sleepers--;
+        }
+
+        d_mutex_unlock(&context->lock);
+    }
+
+    return;
+}
+
+
+/*
+d_internal_walk_thread_main
+  Thread entry point for helper workers.
+*/
+static d_thread_result_t
+d_internal_walk_thread_main
+(
+    void* _arg
+)
+{
+    d_internal_walk_worker_run((struct d_internal_walk_worker*)_arg);
+
+    return D_THREAD_SUCCESS;
+}
+
+
+/*
+d_internal_walk_merge
+  Combines the workers' collections into one d_dir_walk_result.
+
+Return:
+  0 on success, -1 on allocation failure.
+*/
+static int
+d_internal_walk_merge
+(
+    struct d_internal_walk_context* _context,
+    struct d_dir_walk_result*       _result
+)
+{
+    struct d_internal_walk_worker* worker;
+    size_t                         count;
+    size_t                         bytes;
+    size_t                         at;
+    size_t                         base;
+    size_t                         i;
+    size_t                         j;
+
+    count = 0;
+    bytes = 0;
+
+    for (i = 0; i < _context->worker_count; i++)
+    {
+        count += _context->workers[i].slot_count;
+        bytes += _context->workers[i].strings_length;
+    }
+
+    _result->items   = malloc(((count) ? count : 1) * sizeof(struct d_dir_walk_item));
+    _result->strings = malloc((bytes) ? bytes : 1);
+
+    if ( (!_result->items) ||
+         (!_result->strings) )
+    {
+        free(_result->items);
+        free(_result->strings);
+        _result->items   = NULL;
+        _result->strings = NULL;
+        errno            = ENOMEM;
+
+        return -1;
+    }
+
+    at   = 0;
+    base = 0;
+
+    for (i = 0; i < _context->worker_count; i++)
+    {
+        worker = &_context->workers[i];
+
+        if (worker->strings_length > 0)
+        {
+            d_memcpy(_result->strings + base, worker->strings, worker->strings_length);
+        }
+
+        for (j = 0; j < worker->slot_count; j++, at++)
+        {
+            _result->items[at].path  = _result->strings + base + worker->slots[j].offset;
+            _result->items[at].ino   = worker->slots[j].ino;
+            _result->items[at].depth = worker->slots[j].depth;
+            _result->items[at].type  = worker->slots[j].type;
+        }
+
+        base += worker->strings_length;
+    }
+
+    _result->count = count;
+
+    return 0;
+}
+
+
+/*
+d_internal_walk_compare_items
+  qsort comparator ordering collected items by path.
+*/
+static int
+d_internal_walk_compare_items
+(
+    const void* _a,
+    const void* _b
+)
+{
+    return strcmp(((const struct d_dir_walk_item*)_a)->path,
+                  ((const struct d_dir_walk_item*)_b)->path);
+}
+
+
+/*
+d_internal_walk_run
+  Shared implementation of d_dir_walk and d_dir_walk_collect.
+*/
+static int
+d_internal_walk_run
+(
+    const char*                      _root,
+    const struct d_dir_walk_options* _options,
+    fn_dir_walk_visit                _visit,
+    void*                            _user_data,
+    struct d_dir_walk_result*        _result
+)
+{
+    struct d_internal_walk_context context;
+    struct d_internal_walk_task    root_task;
+    struct d_internal_walk_task    leftover;
+    d_thread_t*                    threads;
+    size_t                         started;
+    size_t                         ready;
+    size_t                         length;
+    size_t                         i;
+    int                            status;
+    int                            saved;
+
+    d_memset(&context, 0, sizeof(context));
+
+    if (_options)
+    {
+        context.options = *_options;
+    }
+
+    context.visit     = _visit;
+    context.user_data = _user_data;
+    context.collect   = (_result != NULL);
+    context.root      = _root;
+
+    // trim trailing separators but keep a bare "/"
+    length = strlen(_root);
+
+    while ( (length > 1) &&
+            ( (_root[length - 1] == '/') || (_root[length - 1] == '\\') ) )
+    {
+        length--;
+    }
+
+    if (length >= D_FILE_PATH_MAX)
+    {
+        errno = ENAMETOOLONG;
+
+        return -1;
+    }
+
+    context.relative_offset = ( (length > 0) &&
+                                ( (_root[length - 1] == '/') ||
+                                  (_root[length - 1] == '\\') ) ) ? length
+                                                                  : length + 1;
+
+#if defined(D_FILE_PLATFORM_POSIX)
+    context.root_fd = open(_root, O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    if (context.root_fd < 0)
+    {
+        return -1;
+    }
+#else
+    if (!d_is_dir(_root))
+    {
+        errno = ENOTDIR;
+
+        return -1;
+    }
+#endif
+
+    context.worker_count = context.options.threads;
+
+    if (context.worker_count == 0)
+    {
+        context.worker_count = (d_thread_hardware_concurrency() > 0)
+                                   ? (size_t)d_thread_hardware_concurrency()
+                                   : 1;
+    }
+
+    context.workers = calloc(context.worker_count, sizeof(struct d_internal_walk_worker));
+    threads         = calloc(context.worker_count, sizeof(d_thread_t));
+    root_task.path  = malloc(length + 1);
+    ready           = 0;
+    status          = 0;
+
+    if ( (!context.workers) ||
+         (!threads)         ||
+         (!root_task.path) )
+    {
+        status = -1;
+        errno  = ENOMEM;
+    }
+
+    for (i = 0; ( (status == 0) && (i < context.worker_count) ); i++)
+    {
+        context.workers[i].context = &context;
+        context.workers[i].index   = i;
+        context.workers[i].path    = malloc(D_FILE_PATH_MAX);
+#if D_DIR_WALK_HAS_GETDENTS
+        context.workers[i].dents   = malloc(D_DIR_WALK_BUFFER_SIZE);
+#endif
+
+        d_mutex_init(&context.workers[i].deque.lock);
+        ready++;
+
+        if ( (!context.workers[i].path)
+#if D_DIR_WALK_HAS_GETDENTS
+             || (!context.workers[i].dents)
+#endif
+           )
+        {
+            status = -1;
+            errno  = ENOMEM;
+        }
+    }
+
+    if (status == 0)
+    {
+        d_mutex_init(&context.lock);
+        d_cond_init(&context.wake);
+
+        d_memcpy(root_task.path, _root, length);
+        root_task.path[length] = '\0';
+        root_task.length       = length;
+        root_task.depth        = 0;
+
+        context.outstanding = 1;
+        d_internal_walk_deque_push(&context.workers[0].deque, &root_task, 1);
+        root_task.path = NULL;
+
+        // worker 0 is the calling thread
+        started = 0;
+
+        for (i = 1; i < context.worker_count; i++)
+        {
+            if (d_thread_create(&threads[started],
+                                d_internal_walk_thread_main,
+                                &context.workers[i]) == D_MUTEX_SUCCESS)
+            {
+                started++;
+            }
+        }
+
+        d_internal_walk_worker_run(&context.workers[0]);
+
+        for (i = 0; i < started; i++)
+        {
+            d_thread_join(threads[i], NULL);
+        }
+
+        status = (context.stop) ? D_DIR_WALK_STOP : 0;
+
+        d_cond_destroy(&context.wake);
+        d_mutex_destroy(&context.lock);
+    }
+
+    saved = errno;
+
+    if ( (status != -1) &&
+         (_result) )
+    {
+        for (i = 0; i < context.worker_count; i++)
+        {
+            _result->errors += context.workers[i].errors;
+        }
+
+        if (d_internal_walk_merge(&context, _result) != 0)
+        {
+            status = -1;
+            saved  = ENOMEM;
+        }
+        else if (context.options.flags & D_DIR_WALK_SORT)
+        {
+            qsort(_result->items,
+                  _result->count,
+                  sizeof(struct d_dir_walk_item),
+                  d_internal_walk_compare_items);
+        }
+    }
+
+    // release per-worker state, including tasks abandoned by a stop
+    for (i = 0; i < ready; i++)
+    {
+        while (d_internal_walk_deque_take(&context.workers[i].deque, false, &leftover))
+        {
+            free(leftover.path);
+        }
+
+        d_mutex_destroy(&context.workers[i].deque.lock);
+        free(context.workers[i].deque.tasks);
+        free(context.workers[i].pending);
+        free(context.workers[i].path);
+        free(context.workers[i].dents);
+        free(context.workers[i].slots);
+        free(context.workers[i].strings);
+    }
+
+    free(context.workers);
+    free(threads);
+    free(root_task.path);
+
+#if defined(D_FILE_PLATFORM_POSIX)
+    close(context.root_fd);
+#endif
+
+    errno = saved;
+
+    return status;
+}
+
+
+///////////////////////////////////////////////////////////////////////////////
+///             III.  WALKING                                               ///
+///////////////////////////////////////////////////////////////////////////////
+
+/*
+d_dir_walk
+  Visit every entry below a directory. The root itself is not reported.
+Directories below the root that cannot be read are passed to
+`_options->on_error` (if set) and skipped. With more than one thread the
+visitor runs concurrently and entries arrive in no particular order; with
+`threads` = 1 the walk is depth-first on the calling thread.
+
+Parameter(s):
+  _root:      directory to walk.
+  _options:   walk configuration, or NULL for defaults.
+  _visit:     visitor callback.
+  _user_data: passed to `_visit` and `on_error`.
+Return:
+  0 when the walk completed, D_DIR_WALK_STOP if a visitor stopped it, or -1
+  if the root could not be opened or memory ran out (errno set).
+*/
+int
+d_dir_walk
+(
+    const char*                      _root,
+    const struct d_dir_walk_options* _options,
+    fn_dir_walk_visit                _visit,
+    void*                            _user_data
+)
+{
+    // parameter validation
+    if ( (!_root) ||
+         (!_visit) )
+    {
+        errno = EINVAL;
+
+        return -1;
+    }
+
+    return d_internal_walk_run(_root, _options, _visit, _user_data, NULL);
+}
+
+
+/*
+d_dir_walk_collect
+  Walk a directory and gather every reported entry into `_result`. Each
+worker fills its own buffers, which are merged once at the end, so
+collection adds no locking per entry.
+
+Parameter(s):
+  _root:    directory to walk.
+  _options: walk configuration, or NULL for defaults.
+  _result:  receives the entries; release with d_dir_walk_result_free.
+Return:
+  0 on success, -1 on failure (errno set; `_result` is left empty).
+*/
+int
+d_dir_walk_collect
+(
+    const char*                      _root,
+    const struct d_dir_walk_options* _options,
+    struct d_dir_walk_result*        _result
+)
+{
+    int status;
+
+    // parameter validation
+    if ( (!_root) ||
+         (!_result) )
+    {
+        errno = EINVAL;
+
+        return -1;
+    }
+
+    d_memset(_result, 0, sizeof(struct d_dir_walk_result));
+
+    status = d_internal_walk_run(_root, _options, NULL, NULL, _result);
+
+    return (status == -1) ? -1 : 0;
+}
+
+
+/*
+d_dir_walk_result_free
+  Release the storage held by a d_dir_walk_result and reset it.
+
+Parameter(s):
+  _result: result to release (may be NULL).
+Return:
+  none.
+*/
+void
+d_dir_walk_result_free
+(
+    struct d_dir_walk_result* _result
+)
+{
+    if (!_result)
+    {
+        return;
+    }
+
+    free(_result->items);
+    free(_result->strings);
+    d_memset(_result, 0, sizeof(struct d_dir_walk_result));
+
+    return;
+}
+
+
+///////////////////////////////////////////////////////////////////////////////
+///             IV.   PATTERN MATCHING                                      ///
+///////////////////////////////////////////////////////////////////////////////
+
+/*
+d_internal_walk_class_match
+  Matches one character against a bracket expression starting after '['.
+
+Return:
+  Pointer just past the closing ']' if the class matched, NULL if it did not
+  match. `*_valid` is cleared when there is no closing ']'.
+*/
+static const char*
+d_internal_walk_class_match
+(
+    const char* _class,
+    char        _c,
+    bool*       _valid
+)
+{
+    const char* p;
+    bool        negate;
+    bool        matched;
+
+    p       = _class;
+    negate  = ( (*p == '!') || (*p == '^') );
+    matched = false;
+    *_valid = true;
+
+    if (negate)
+    {
+        p++;
+    }
+
+    // a leading ']' is a literal member
+    do
+    {
+        if (*p == '\0')
+        {
+            *_valid = false;
+
+            return NULL;
+        }
+
+        if ( (p[1] == '-') &&
+             (p[2] != ']') &&
+             (p[2] != '\0') )
+        {
+            matched = matched ||
+                      ( ((unsigned char)_c >= (unsigned char)p[0]) &&
+                        ((unsigned char)_c <= (unsigned char)p[2]) );
+            p += 3;
+        }
+        else
+        {
+            matched = matched || (*p == _c);
+            p++;
+        }
+    } while (*p != ']');
+
+    return (matched != negate) ? (p + 1) : NULL;
+}
+
+
+/*
+d_dir_walk_glob_match
+  Match a path against a glob pattern. `*` matches any run of characters
+other than '/', `**` matches across '/' (and "**<slash>" also matches no
+directories at all), `?` matches one character other than '/', and
+`[...]` matches a character class (ranges allowed, `!` or `^` negates).
+An unterminated '[' is matched literally.
+
+Parameter(s):
+  _pattern: glob pattern.
+  _text:    path or name to test.
+Return:
+  true if `_text` matches the whole pattern.
+*/
+bool
+d_dir_walk_glob_match
+(
+    const char* _pattern,
+    const char* _text
+)
+{
+    const char* p;
+    const char* t;
+    const char* next;
+    bool        deep;
+    bool        valid;
+
+    if ( (!_pattern) ||
+         (!_text) )
+    {
+        return false;
+    }
+
+    p = _pattern;
+    t = _text;
+
+    while (*p)
+    {
+        if (*p == '*')
+        {
+            deep = (p[1] == '*');
+            p   += (deep) ? 2 : 1;
+
+            // "**/" may match zero directories
+            if ( (deep) &&
+                 (*p == '/') &&
+                 (d_dir_walk_glob_match(p + 1, t)) )
+            {
+                return true;
+            }
+
+            if (*p == '\0')
+            {
+                return (deep) || (strchr(t, '/') == NULL);
+            }
+
+            for (;; t++)
+            {
+                if (d_dir_walk_glob_match(p, t))
+                {
+                    return true;
+                }
+
+                if ( (*t == '\0') ||
+                     ( (!deep) && (*t == '/') ) )
+                {
+                    return false;
+                }
+            }
+        }
+
+        if (*t == '\0')
+        {
+            return false;
+        }
+
+        if (*p == '?')
+        {
+            if (*t == '/')
+            {
+                return false;
+            }
+
+            p++;
+            t++;
+
+            continue;
+        }
+
+        if (*p == '[')
+        {
+            next = d_internal_walk_class_match(p + 1, *t, &valid);
+
+            if (valid)
+            {
+                if ( (!next) ||
+                     (*t == '/') )
+                {
+                    return false;
+                }
+
+                p = next;
+                t++;
+
+                continue;
+            }
+        }
+
+        if (*p != *t)
+        {
+            return false;
+        }
+
+        p++;
+        t++;
+    }
+
+    return (*t == '\0');
+}
@@ -17,7 +17,7 @@ d_event_handler_new
         return NULL;
     }
 
-    handler->events = d_circular_array_new(_events_capacity, sizeof(struct d_event));
+    handler->events = d_circular_array_new_pow2(_events_capacity, sizeof(struct d_event));
 
     if (!handler->events)
     {
@@ -182,7 +182,7 @@ d_event_handler_fire_event
 
     if (listener->fn)
     {
-        listener->fn(_event->context);
+        listener->fn(_event->args);
 
         return 1;
     }
@@ -1771,6 +1771,192 @@ d_filter_apply_operation_internal
     }
 }
 
+/*
+d_filter_is_predicate_chain_internal
+  Tests whether every operation of a chain is a predicate (WHERE or
+WHERE_NOT). Such a chain keeps or drops each element on its own, so it can
+be evaluated per element without building intermediate arrays, and the
+surviving positions can be recorded in a bitset.
+
+Parameter(s):
+  _chain: the filter chain to inspect.
+Return:
+  true if the chain holds only predicate operations (an empty chain
+qualifies), false otherwise.
+*/
+static bool
+d_filter_is_predicate_chain_internal
+(
+    const struct d_filter_chain* _chain
+)
+{
+    size_t i;
+
+    for (i = 0; i < _chain->count; i++)
+    {
+        if ( (_chain->operations[i].type != D_FILTER_OP_WHERE) &&
+             (_chain->operations[i].type != D_FILTER_OP_WHERE_NOT) )
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/*
+d_filter_predicates_match_internal
+  Evaluates a predicate-only chain against one element. An operation
+without a test function matches nothing.
+
+Parameter(s):
+  _chain:   a chain accepted by d_filter_is_predicate_chain_internal.
+  _element: pointer to the element to test.
+Return:
+  true if the element passes every operation, false otherwise.
+*/
+static bool
+d_filter_predicates_match_internal
+(
+    const struct d_filter_chain* _chain,
+    const void*                  _element
+)
+{
+    const struct d_filter_operation* op;
+    size_t                           i;
+
+    for (i = 0; i < _chain->count; i++)
+    {
+        op = &_chain->operations[i];
+
+        if ( (!op->params.test) ||
+             (op->params.test(_element, op->params.context) ==
+              (op->type == D_FILTER_OP_WHERE_NOT)) )
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/*
+d_filter_predicate_bitset_internal
+  Evaluates a predicate-only chain over an input array, setting bit i of
+the returned bitset when element i passes. No element is copied.
+
+Parameter(s):
+  _chain:        a chain accepted by d_filter_is_predicate_chain_internal.
+  _input:        the source array.
+  _count:        the number of elements.
+  _element_size: the size in bytes of each element.
+Return:
+  A new bitset of `_count` bits, or NULL if allocation fails.
+*/
+static struct d_bitset*
+d_filter_predicate_bitset_internal
+(
+    const struct d_filter_chain* _chain,
+    const void*                  _input,
+    size_t                       _count,
+    size_t                       _element_size
+)
+{
+    struct d_bitset* matches;
+    const char*      in_bytes;
+    uint64_t         word;
+    size_t           i;
+    size_t           j;
+
+    matches = d_bitset_new(_count);
+
+    if (!matches)
+    {
+        return NULL;
+    }
+
+    in_bytes = (const char*)_input;
+
+    // fill one word at a time rather than read-modify-write per bit
+    for (i = 0; i < matches->word_count; i++)
+    {
+        word = 0;
+
+        for (j = 0;
+             (j < D_BITSET_WORD_BITS) &&
+             ((i * D_BITSET_WORD_BITS) + j < _count);
+             j++)
+        {
+            word |= (uint64_t)d_filter_predicates_match_internal(
+                        _chain,
+                        in_bytes + (((i * D_BITSET_WORD_BITS) + j) *
+                                    _element_size)) << j;
+        }
+
+        matches->words[i] = word;
+    }
+
+    return matches;
+}
+
+/*
+d_filter_gather_internal
+  Fills a filter result with copies of the input elements whose bits are
+set, in input order.
+
+Parameter(s):
+  _result:       the result to fill.
+  _matches:      bitset of positions to copy.
+  _input:        the source array.
+  _element_size: the size in bytes of each element.
+Return:
+  none; `_result->status` reports the outcome.
+*/
+static void
+d_filter_gather_internal
+(
+    struct d_filter_result* _result,
+    const struct d_bitset*  _matches,
+    const void*             _input,
+    size_t                  _element_size
+)
+{
+    char*       out_bytes;
+    const char* in_bytes;
+    size_t      out_count;
+    size_t      index;
+
+    out_count = d_bitset_count(_matches);
+
+    // like the other appliers, an empty result still owns an allocation
+    _result->elements = malloc((out_count != 0) ? out_count * _element_size
+                                                : _element_size);
+
+    if (!_result->elements)
+    {
+        _result->status = D_FILTER_RESULT_NO_MEMORY;
+
+        return;
+    }
+
+    out_bytes = (char*)_result->elements;
+    in_bytes  = (const char*)_input;
+    index     = 0;
+
+    while (d_bitset_next(_matches, index, &index))
+    {
+        memcpy(out_bytes, in_bytes + (index * _element_size), _element_size);
+        out_bytes += _element_size;
+        index++;
+    }
+
+    _result->count  = out_count;
+    _result->status = (out_count == 0) ? D_FILTER_RESULT_EMPTY
+                                       : D_FILTER_RESULT_SUCCESS;
+
+    return;
+}
+
 /*
 d_filter_apply_operation
   Applies a single filter operation to an input array and returns a
@@ -2033,11 +2219,8 @@ d_filter_chain_matches_element
     size_t                       _element_size
 )
 {
-    size_t                           i;
-    const struct d_filter_operation* op;
-    bool                             matches;
-    bool                             all_predicates;
-    struct d_filter_result*          result;
+    bool                    matches;
+    struct d_filter_result* result;
 
     if ( (!_chain)          ||
          (!_element)        ||
@@ -2054,44 +2237,9 @@ d_filter_chain_matches_element
 
     // fast path: if every operation is a predicate (WHERE / WHERE_NOT),
     // evaluate directly without allocation
-    all_predicates = true;
-
-    for (i = 0; i < _chain->count; i++)
+    if (d_filter_is_predicate_chain_internal(_chain))
     {
-        if ( (_chain->operations[i].type != D_FILTER_OP_WHERE) &&
-             (_chain->operations[i].type != D_FILTER_OP_WHERE_NOT) )
-        {
-            all_predicates = false;
-
-            break;
-        }
-    }
-
-    if (all_predicates)
-    {
-        for (i = 0; i < _chain->count; i++)
-        {
-            op = &_chain->operations[i];
-
-            if (!op->params.test)
-            {
-                return false;
-            }
-
-            matches = op->params.test(_element, op->params.context);
-
-            if (op->type == D_FILTER_OP_WHERE_NOT)
-            {
-                matches = !matches;
-            }
-
-            if (!matches)
-            {
-                return false;
-            }
-        }
-
-        return true;
+        return d_filter_predicates_match_internal(_chain, _element);
     }
 
     // general path: wrap in 1-element array and apply chain
@@ -2446,11 +2594,45 @@ d_filter_difference_free
 ///             V.    COMBINATOR APPLICATION                                ///
 ///////////////////////////////////////////////////////////////////////////////
 
+/*
+d_filter_all_predicate_chains_internal
+  Tests whether every chain of a combinator is present and holds only
+predicate operations, so the combinator can run as bitset algebra.
+
+Parameter(s):
+  _chains: the combinator's chains.
+  _count:  the number of chains.
+Return:
+  true if all chains qualify, false otherwise.
+*/
+static bool
+d_filter_all_predicate_chains_internal
+(
+    struct d_filter_chain* const* _chains,
+    size_t                        _count
+)
+{
+    size_t i;
+
+    for (i = 0; i < _count; i++)
+    {
+        if ( (!_chains[i]) ||
+             (!d_filter_is_predicate_chain_internal(_chains[i])) )
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
 /*
 d_filter_apply_union
   Applies a union combinator, returning elements matching any filter.
-Uses byte comparison to map sub-filter results back to original input
-indices, preserving original element order.
+When every chain is predicate-only, each chain is evaluated into a bitset
+of input positions and the bitsets are OR-ed together. Otherwise byte
+comparison maps sub-filter results back to original input indices.
+Either way the original element order is preserved.
 
 Parameter(s):
   _union:        the union combinator.
@@ -2471,6 +2653,8 @@ d_filter_apply_union
 {
     struct d_filter_result* result;
     struct d_filter_result* sub_result;
+    struct d_bitset*        matches;
+    struct d_bitset*        part;
     bool*                   included;
     size_t                  i;
     size_t                  j;
@@ -2498,6 +2682,44 @@ d_filter_apply_union
         return result;
     }
 
+    // predicate-only chains: OR the per-chain bitsets
+    if (d_filter_all_predicate_chains_internal(_union->filters,
+                                               _union->count))
+    {
+        matches = d_bitset_new(_count);
+
+        for (i = 0; (matches) && (i < _union->count); i++)
+        {
+            part = d_filter_predicate_bitset_internal(_union->filters[i],
+                                                      _input,
+                                                      _count,
+                                                      _element_size);
+
+            if (!part)
+            {
+                d_bitset_free(matches);
+                matches = NULL;
+
+                break;
+            }
+
+            d_bitset_or(matches, part);
+            d_bitset_free(part);
+        }
+
+        if (!matches)
+        {
+            result->status = D_FILTER_RESULT_NO_MEMORY;
+
+            return result;
+        }
+
+        d_filter_gather_internal(result, matches, _input, _element_size);
+        d_bitset_free(matches);
+
+        return result;
+    }
+
     included = (bool*)calloc(_count, sizeof(bool));
 
     if (!included)
@@ -2606,7 +2828,9 @@ d_filter_apply_union
 d_filter_apply_intersection
   Applies an intersection combinator, returning only elements that
 pass all contained filter chains. Applies chains sequentially so
-each narrows the result set.
+each narrows the result set. When every chain is predicate-only, the
+surviving input positions are kept in a bitset and each chain is only
+evaluated on positions still set, so no element is copied until the end.
 
 Parameter(s):
   _inter:        the intersection combinator.
@@ -2627,8 +2851,10 @@ d_filter_apply_intersection
 {
     struct d_filter_result* result;
     struct d_filter_result* sub_result;
+    struct d_bitset*        matches;
     void*                   current_data;
     size_t                  current_count;
+    size_t                  index;
     size_t                  i;
 
     result = malloc(sizeof(struct d_filter_result));
@@ -2649,6 +2875,44 @@ d_filter_apply_intersection
         return result;
     }
 
+    // predicate-only chains: clear the positions each chain rejects
+    if (d_filter_all_predicate_chains_internal(_inter->filters,
+                                               _inter->count))
+    {
+        matches = d_bitset_new(_count);
+
+        if (!matches)
+        {
+            result->status = D_FILTER_RESULT_NO_MEMORY;
+
+            return result;
+        }
+
+        d_bitset_set_all(matches);
+
+        for (i = 0; i < _inter->count; i++)
+        {
+            index = 0;
+
+            while (d_bitset_next(matches, index, &index))
+            {
+                if (!d_filter_predicates_match_internal(
+                         _inter->filters[i],
+                         (const char*)_input + (index * _element_size)))
+                {
+                    d_bitset_reset(matches, index);
+                }
+
+                index++;
+            }
+        }
+
+        d_filter_gather_internal(result, matches, _input, _element_size);
+        d_bitset_free(matches);
+
+        return result;
+    }
+
     // start with a copy of the input
     current_data = malloc(_count * _element_size);
 
@@ -2712,7 +2976,8 @@ d_filter_apply_intersection
 d_filter_apply_difference
   Applies a difference combinator (include - exclude). Returns elements
 that pass the include chain but do not appear in the exclude chain's
-results.
+results. When both chains are predicate-only, this is the include bitset
+with the exclude bitset's positions cleared (and-not).
 
 Parameter(s):
   _diff:         the difference combinator.
@@ -2734,6 +2999,9 @@ d_filter_apply_difference
     struct d_filter_result*  result;
     struct d_filter_result* include_result;
     struct d_filter_result* exclude_result;
+    struct d_filter_chain*  chains[2];
+    struct d_bitset*        included;
+    struct d_bitset*        excluded_set;
     size_t                  i;
     size_t                  j;
     size_t                  out_count;
@@ -2760,6 +3028,39 @@ d_filter_apply_difference
         return result;
     }
 
+    // predicate-only chains: include AND NOT exclude
+    chains[0] = _diff->include;
+    chains[1] = _diff->exclude;
+
+    if (d_filter_all_predicate_chains_internal(chains, 2))
+    {
+        included     = d_filter_predicate_bitset_internal(_diff->include,
+                                                          _input,
+                                                          _count,
+                                                          _element_size);
+        excluded_set = d_filter_predicate_bitset_internal(_diff->exclude,
+                                                          _input,
+                                                          _count,
+                                                          _element_size);
+
+        if ( (!included) ||
+             (!excluded_set) )
+        {
+            d_bitset_free(included);
+            d_bitset_free(excluded_set);
+            result->status = D_FILTER_RESULT_NO_MEMORY;
+
+            return result;
+        }
+
+        d_bitset_andnot(included, excluded_set);
+        d_filter_gather_internal(result, included, _input, _element_size);
+        d_bitset_free(included);
+        d_bitset_free(excluded_set);
+
+        return result;
+    }
+
     // apply include chain
     include_result = d_filter_apply_chain(_diff->include, 
                                           _input, 
@@ -3008,8 +3309,9 @@ d_filter_none_match
 /*
 d_filter_get_indices
   Returns indices of elements remaining after applying a filter chain.
-Applies the chain, then matches result elements back to original input
-indices by byte comparison.
+A predicate-only chain is evaluated in place into a bitset whose set
+positions are the indices. Any other chain is applied, then its result
+elements are matched back to original input indices by byte comparison.
 
 Parameter(s):
   _chain:        the filter chain.
@@ -3032,6 +3334,7 @@ d_filter_get_indices
 )
 {
     struct d_filter_result* result;
+    struct d_bitset*       matches;
     size_t*                indices;
     size_t                 idx_count;
     size_t                 i;
@@ -3047,6 +3350,29 @@ d_filter_get_indices
 
     *(_out_count) = 0;
 
+    if ( (_chain)              &&
+         (_input)              &&
+         (_element_size != 0)  &&
+         (d_filter_is_predicate_chain_internal(_chain)) )
+    {
+        matches   = d_filter_predicate_bitset_internal(_chain,
+                                                       _input,
+                                                       _count,
+                                                       _element_size);
+        idx_count = d_bitset_count(matches);
+        indices   = (idx_count != 0) ? malloc(idx_count * sizeof(size_t))
+                                     : NULL;
+
+        if (indices)
+        {
+            *(_out_count) = d_bitset_to_indices(matches, indices);
+        }
+
+        d_bitset_free(matches);
+
+        return indices;
+    }
+
     result = d_filter_apply_chain(_chain, _input, _count, _element_size);
 
     if ( (!result) ||
@@ -3113,6 +3439,66 @@ d_filter_get_indices
     return indices;
 }
 
+/*
+d_filter_get_bitset
+  Returns the positions of the elements remaining after applying a filter
+chain as a bitset of `_count` bits: one bit per input element instead of
+one size_t per match. Bitsets from several chains over the same input can
+then be combined with d_bitset_and / d_bitset_or / d_bitset_andnot, or
+compressed with d_roaring_new_from_bitset when sparse.
+  A predicate-only chain is evaluated without copying any element; other
+chains go through d_filter_get_indices.
+
+Parameter(s):
+  _chain:        the filter chain.
+  _input:        the source array.
+  _count:        the number of elements.
+  _element_size: the size in bytes of each element.
+Return:
+  A newly allocated bitset, or NULL if a parameter is invalid or
+allocation fails. Caller must free it with d_bitset_free.
+*/
+struct d_bitset*
+d_filter_get_bitset
+(
+    const struct d_filter_chain* _chain,
+    const void*                  _input,
+    size_t                       _count,
+    size_t                       _element_size
+)
+{
+    struct d_bitset* matches;
+    size_t*          indices;
+    size_t           idx_count;
+
+    if ( (!_chain)           ||
+         (!_input)           ||
+         (_element_size == 0) )
+    {
+        return NULL;
+    }
+
+    if (d_filter_is_predicate_chain_internal(_chain))
+    {
+        return d_filter_predicate_bitset_internal(_chain,
+                                                  _input,
+                                                  _count,
+                                                  _element_size);
+    }
+
+    idx_count = 0;
+    indices   = d_filter_get_indices(_chain,
+                                     _input,
+                                     _count,
+                                     _element_size,
+                                     &idx_count);
+    matches   = d_bitset_new_from_indices(_count, indices, idx_count);
+
+    free(indices);
+
+    return matches;
+}
+
 
 ///////////////////////////////////////////////////////////////////////////////
 ///             VII.  UTILITY FUNCTIONS                                     ///
@@ -9,6 +9,7 @@
 * author(s): Samuel 'teer' Neal-Blim                          date: 2025.12.21
 ******************************************************************************/
 #include "../../../inc/c/test/test_session.h"
+#include "../../../inc/c/dmutex.h"
 
 
 /******************************************************************************
@@ -314,6 +315,379 @@ d_internal_session_add_children
     return true;
 }
 
+/******************************************************************************
+ * INTERNAL HELPERS - PARALLEL EXECUTION
+ *****************************************************************************/
+
+// d_internal_session_job
+//   struct: one module scheduled for parallel execution, plus its outcome.
+// Outcomes are written back here and reported in registration order once
+// all workers have finished, so output does not depend on scheduling.
+struct d_internal_session_job
+{
+    struct d_test_type* module;
+    bool                ran;
+    bool                passed;
+};
+
+// d_internal_session_queue
+//   struct: a worker's slice of the job list. The owner takes jobs from the
+// front; idle workers steal from the back.
+struct d_internal_session_queue
+{
+    d_mutex_t lock;
+    size_t*   items;
+    size_t    front;
+    size_t    back;
+};
+
+struct d_internal_session_pool;
+
+// d_internal_session_worker
+//   struct: per-thread state; statistics are private to the worker and
+// merged into the session after all workers have been joined.
+struct d_internal_session_worker
+{
+    struct d_internal_session_pool* pool;
+    size_t                          id;
+    struct d_internal_session_queue queue;
+    struct d_test_statistics        stats;
+    d_thread_t                      thread;
+    bool                            started;
+};
+
+// d_internal_session_pool
+//   struct: shared state for one parallel pass over the session's modules.
+struct d_internal_session_pool
+{
+    struct d_test_session*            session;
+    struct d_internal_session_job*    jobs;
+    size_t                            job_count;
+    struct d_internal_session_worker* workers;
+    size_t                            worker_count;
+    d_mutex_t                         state_lock;
+    size_t                            failures;
+    size_t                            fail_fast;
+    bool                              abort_on_failure;
+    bool                              stop;
+};
+
+/*
+d_internal_session_queue_pop
+  Takes the next job from the front of the worker's own queue.
+*/
+static bool
+d_internal_session_queue_pop
+(
+    struct d_internal_session_queue* _queue,
+    size_t*                          _job
+)
+{
+    bool found;
+
+    d_mutex_lock(&_queue->lock);
+
+    found = (_queue->front < _queue->back);
+
+    if (found)
+    {
+        *_job = _queue->items[_queue->front++];
+    }
+
+    d_mutex_unlock(&_queue->lock);
+
+    return found;
+}
+
+/*
+d_internal_session_queue_steal
+  Takes a job from the back of another worker's queue.
+*/
+static bool
+d_internal_session_queue_steal
+(
+    struct d_internal_session_queue* _queue,
+    size_t*                          _job
+)
+{
+    bool found;
+
+    d_mutex_lock(&_queue->lock);
+
+    found = (_queue->front < _queue->back);
+
+    if (found)
+    {
+        *_job = _queue->items[--_queue->back];
+    }
+
+    d_mutex_unlock(&_queue->lock);
+
+    return found;
+}
+
+/*
+d_internal_session_next_job
+  Gets the next job for a worker: its own queue first, then the other
+workers' queues in round-robin order. Returns false once every queue is
+empty or the pass has been stopped.
+*/
+static bool
+d_internal_session_next_job
+(
+    struct d_internal_session_worker* _worker,
+    size_t*                           _job
+)
+{
+    struct d_internal_session_pool* pool;
+    size_t                          i;
+    size_t                          victim;
+    bool                            stop;
+
+    pool = _worker->pool;
+
+    d_mutex_lock(&pool->state_lock);
+    stop = ( (pool->stop) ||
+             (pool->session->status == D_TEST_SESSION_STATUS_ABORTED) );
+    d_mutex_unlock(&pool->state_lock);
+
+    if (stop)
+    {
+        return false;
+    }
+
+    if (d_internal_session_queue_pop(&_worker->queue, _job))
+    {
+        return true;
+    }
+
+    for (i = 1; i < pool->worker_count; i++)
+    {
+        victim = (_worker->id + i) % pool->worker_count;
+
+        if (d_internal_session_queue_steal(&pool->workers[victim].queue, _job))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/*
+d_internal_session_worker_main
+  Thread entry point: runs jobs until none remain, recording each outcome
+in the job table and the worker's own statistics.
+*/
+static d_thread_result_t
+d_internal_session_worker_main
+(
+    void* _arg
+)
+{
+    struct d_internal_session_worker* worker;
+    struct d_internal_session_pool*   pool;
+    struct d_internal_session_job*    job;
+    size_t                            index;
+    bool                              passed;
+
+    worker = (struct d_internal_session_worker*)_arg;
+    pool   = worker->pool;
+
+    while (d_internal_session_next_job(worker, &index))
+    {
+        job    = &pool->jobs[index];
+        passed = d_test_module_run(job->module->D_KEYWORD_TEST_MODULE,
+                                   pool->session->config);
+
+        job->ran    = true;
+        job->passed = passed;
+
+        if (passed)
+        {
+            D_STAT_COUNTER_INC_MODULE_PASS(&worker->stats);
+
+            continue;
+        }
+
+        D_STAT_COUNTER_INC_MODULE_FAIL(&worker->stats);
+
+        d_mutex_lock(&pool->state_lock);
+
+        pool->failures++;
+
+        if ( (pool->abort_on_failure) ||
+             ( (pool->fail_fast > 0) && (pool->failures >= pool->fail_fast) ) )
+        {
+            pool->stop = true;
+        }
+
+        d_mutex_unlock(&pool->state_lock);
+    }
+
+    return D_THREAD_SUCCESS;
+}
+
+/*
+d_internal_session_run_parallel
+  Runs one pass over the session's modules on `_worker_count` threads (the
+calling thread acts as worker 0). Modules are dealt out in contiguous
+slices and rebalanced by work stealing. Module results are written and
+statistics merged in registration order after all workers finish.
+
+Parameter(s):
+  _session:          the session being run.
+  _worker_count:     number of workers, including the calling thread.
+  _abort_on_failure: stop scheduling new modules after the first failure.
+  _fail_fast:        stop scheduling after this many failures (0 = never).
+Return:
+  true if every module that ran passed.
+*/
+static bool
+d_internal_session_run_parallel
+(
+    struct d_test_session* _session,
+    size_t                 _worker_count,
+    bool                   _abort_on_failure,
+    size_t                 _fail_fast
+)
+{
+    struct d_internal_session_pool pool;
+    struct d_test_type*            child;
+    size_t*                        slots;
+    size_t                         child_count;
+    size_t                         per_worker;
+    size_t                         i;
+    bool                           all_passed;
+
+    child_count = d_test_session_child_count(_session);
+
+    pool.session          = _session;
+    pool.job_count        = 0;
+    pool.worker_count     = _worker_count;
+    pool.failures         = _session->failure_count;
+    pool.fail_fast        = _fail_fast;
+    pool.abort_on_failure = _abort_on_failure;
+    pool.stop             = false;
+    pool.jobs             = (struct d_internal_session_job*)calloc(
+                                child_count ? child_count : 1,
+                                sizeof(struct d_internal_session_job));
+    pool.workers          = (struct d_internal_session_worker*)calloc(
+                                _worker_count,
+                                sizeof(struct d_internal_session_worker));
+    slots                 = (size_t*)malloc((child_count ? child_count : 1) *
+                                            sizeof(size_t));
+
+    if ( (!pool.jobs) || (!pool.workers) || (!slots) )
+    {
+        free(pool.jobs);
+        free(pool.workers);
+        free(slots);
+
+        return false;
+    }
+
+    for (i = 0; i < child_count; i++)
+    {
+        child = d_test_session_get_child_at(_session, i);
+
+        if ( (!child) || (!child->D_KEYWORD_TEST_MODULE) )
+        {
+            continue;
+        }
+
+        pool.jobs[pool.job_count].module = child;
+        slots[pool.job_count]            = pool.job_count;
+        pool.job_count++;
+    }
+
+    if (pool.worker_count > pool.job_count)
+    {
+        pool.worker_count = (pool.job_count > 0) ? pool.job_count : 1;
+    }
+
+    // deal contiguous slices so each worker starts on neighbouring modules
+    per_worker = (pool.job_count + pool.worker_count - 1) / pool.worker_count;
+
+    d_mutex_init(&pool.state_lock);
+
+    for (i = 0; i < pool.worker_count; i++)
+    {
+        pool.workers[i].pool        = &pool;
+        pool.workers[i].id          = i;
+        pool.workers[i].queue.items = slots;
+        pool.workers[i].queue.front = (i * per_worker < pool.job_count)
+                                          ? i * per_worker
+                                          : pool.job_count;
+        pool.workers[i].queue.back  = ((i + 1) * per_worker < pool.job_count)
+                                          ? (i + 1) * per_worker
+                                          : pool.job_count;
+        D_STATISTICS_RESET(&pool.workers[i].stats);
+        d_mutex_init(&pool.workers[i].queue.lock);
+    }
+
+    // a worker whose thread fails to start still has its queue drained
+    // by the others through stealing
+    for (i = 1; i < pool.worker_count; i++)
+    {
+        pool.workers[i].started =
+            (d_thread_create(&pool.workers[i].thread,
+                             d_internal_session_worker_main,
+                             &pool.workers[i]) == D_MUTEX_SUCCESS);
+    }
+
+    d_internal_session_worker_main(&pool.workers[0]);
+
+    for (i = 1; i < pool.worker_count; i++)
+    {
+        if (pool.workers[i].started)
+        {
+            d_thread_join(pool.workers[i].thread, NULL);
+        }
+    }
+
+    // merge per-worker statistics and report in registration order
+    all_passed = true;
+
+    for (i = 0; i < pool.worker_count; i++)
+    {
+        d_test_statistics_add(&_session->stats, &pool.workers[i].stats);
+        d_mutex_destroy(&pool.workers[i].queue.lock);
+    }
+
+    for (i = 0; i < pool.job_count; i++)
+    {
+        if (!pool.jobs[i].ran)
+        {
+            continue;
+        }
+
+        d_test_session_write_module_start(_session, pool.jobs[i].module);
+        d_test_session_write_module_end(_session,
+                                        pool.jobs[i].module,
+                                        pool.jobs[i].passed);
+
+        if (!pool.jobs[i].passed)
+        {
+            all_passed = false;
+        }
+    }
+
+    _session->failure_count = pool.failures;
+
+    if (pool.stop)
+    {
+        _session->status = D_TEST_SESSION_STATUS_ABORTED;
+    }
+
+    d_mutex_destroy(&pool.state_lock);
+    free(slots);
+    free(pool.workers);
+    free(pool.jobs);
+
+    return all_passed;
+}
+
 /******************************************************************************
  * CONSTRUCTOR/DESTRUCTOR FUNCTIONS
  *****************************************************************************/
@@ -861,10 +1235,12 @@ d_test_session_run
     size_t              child_count;
     size_t              repeat_count;
     size_t              fail_fast;
+    size_t              worker_count;
     struct d_test_type* child;
     bool                child_passed;
     bool                all_passed;
     bool                abort_on_failure;
+    bool                parallel;
     void*               opt_value;
 
     if (!_session)
@@ -890,6 +1266,26 @@ d_test_session_run
                                           D_TEST_SESSION_OPT_FAIL_FAST);
     fail_fast = opt_value ? (size_t)(uintptr_t)opt_value : 0;
 
+    opt_value = d_test_session_get_option(_session,
+                                          D_TEST_SESSION_OPT_PARALLEL);
+    parallel = opt_value ? (bool)(uintptr_t)opt_value : false;
+
+    opt_value = d_test_session_get_option(_session,
+                                          D_TEST_SESSION_OPT_PARALLEL_WORKERS);
+    worker_count = opt_value ? (size_t)(uintptr_t)opt_value 
+                             : D_TEST_SESSION_DEFAULT_PARALLEL_WORKERS;
+
+    if (worker_count == 0)
+    {
+        worker_count = (size_t)d_thread_hardware_concurrency();
+    }
+
+    // a single worker gains nothing over the serial path
+    if (worker_count <= 1)
+    {
+        parallel = false;
+    }
+
     _session->status         = D_TEST_SESSION_STATUS_RUNNING;
     _session->current_index  = 0;
     _session->failure_count  = 0;
@@ -915,6 +1311,24 @@ d_test_session_run
                                    repeat_count);
         }
 
+        if (parallel)
+        {
+            if (!d_internal_session_run_parallel(_session,
+                                                 worker_count,
+                                                 abort_on_failure,
+                                                 fail_fast))
+            {
+                all_passed = false;
+            }
+
+            if (_session->status == D_TEST_SESSION_STATUS_ABORTED)
+            {
+                break;
+            }
+
+            continue;
+        }
+
         for (i = 0; i < child_count; i++)
         {
             if (_session->status == D_TEST_SESSION_STATUS_PAUSED)
@@ -1,5 +1,17 @@
 ﻿#include "../../../inc/c/test/test_standalone.h"
 
+#if D_TEST_SA_HAS_ISOLATION
+    #include <errno.h>
+    #include <poll.h>
+    #include <signal.h>
+    #include <stdint.h>
+    #include <string.h>
+    #include <sys/types.h>
+    #include <sys/wait.h>
+    #include <time.h>
+    #include <unistd.h>
+#endif
+
 
 /******************************************************************************
  * INTERNAL DUAL-OUTPUT HELPER
@@ -111,6 +123,8 @@ d_test_sa_options_init
     _options->show_module_footer = true;
     _options->list_failures      = false;
     _options->output_file        = NULL;
+    _options->jobs               = 0;
+    _options->timeout_ms         = 0;
 
     return;
 }
@@ -126,6 +140,8 @@ Recognized flags:
   -nf             suppress per-module result footers
   -lf             list all failures at end of run
   -o <filepath>   mirror output to file
+  -j <n>          run modules isolated in up to n child processes
+  -t <ms>         per-module time limit for isolated runs
   -h, --help      print usage and return false
 
 Parameter(s):
@@ -205,6 +221,38 @@ d_test_sa_options_parse
                 return false;
             }
         }
+        // -j <n> : isolated worker processes
+        else if (strcmp(_argv[i], "-j") == 0)
+        {
+            if (i + 1 < _argc)
+            {
+                i++;
+                _options->jobs = (size_t)strtoul(_argv[i], NULL, 10);
+            }
+            else
+            {
+                printf("ERROR: -j requires a process count "
+                       "argument\n");
+
+                return false;
+            }
+        }
+        // -t <ms> : per-module timeout (isolated runs)
+        else if (strcmp(_argv[i], "-t") == 0)
+        {
+            if (i + 1 < _argc)
+            {
+                i++;
+                _options->timeout_ms = (size_t)strtoul(_argv[i], NULL, 10);
+            }
+            else
+            {
+                printf("ERROR: -t requires a millisecond "
+                       "argument\n");
+
+                return false;
+            }
+        }
         // -h / --help : print usage
         else if ( (strcmp(_argv[i], "-h") == 0)    ||
                   (strcmp(_argv[i], "--help") == 0) )
@@ -262,6 +310,10 @@ d_test_sa_options_print_usage
            "of run\n");
     printf("  -o <file>    Mirror all output to "
            "file\n");
+    printf("  -j <n>       Run modules isolated in up "
+           "to n child processes\n");
+    printf("  -t <ms>      Per-module time limit for "
+           "isolated runs\n");
     printf("  -h, --help   Show this help message\n");
     printf("\n");
     printf("Defaults: no numbering, all output shown, "
@@ -377,11 +429,91 @@ d_test_sa_failure_list_add
     _list->entries[_list->count].module_name = _module;
     _list->entries[_list->count].test_name   = _name;
     _list->entries[_list->count].message     = _message;
+    _list->entries[_list->count].owned       = false;
     _list->count++;
 
     return;
 }
 
+/*
+d_test_sa_failure_list_add_copy
+  Records a failure entry like d_test_sa_failure_list_add, but stores heap
+copies of the test name and message (the module name is still referenced).
+Used when the strings do not outlive the call, e.g. results decoded from an
+isolated module process. Copies are released by d_test_sa_failure_list_free.
+
+Parameter(s):
+  _list:    the failure list to add to
+  _module:  name of the module where the failure occurred
+  _name:    name of the assertion or test that failed
+  _message: failure message/description
+Return:
+  none.
+*/
+void
+d_test_sa_failure_list_add_copy
+(
+    struct d_test_sa_failure_list* _list,
+    const char*                    _module,
+    const char*                    _name,
+    const char*                    _message
+)
+{
+    size_t name_len;
+    size_t message_len;
+    size_t count;
+    char*  block;
+
+    if (!_list)
+    {
+        return;
+    }
+
+    name_len    = _name    ? strlen(_name)    : 0;
+    message_len = _message ? strlen(_message) : 0;
+
+    // one block holds both strings; test_name owns it
+    block = (char*)malloc(name_len + message_len + 2);
+
+    if (!block)
+    {
+        return;
+    }
+
+    if (name_len)
+    {
+        memcpy(block, _name, name_len);
+    }
+
+    block[name_len] = '\0';
+
+    if (message_len)
+    {
+        memcpy(block + name_len + 1, _message, message_len);
+    }
+
+    block[name_len + 1 + message_len] = '\0';
+
+    count = _list->count;
+
+    d_test_sa_failure_list_add(_list,
+                               _module,
+                               block,
+                               block + name_len + 1);
+
+    // add silently drops entries past the limit or on allocation failure
+    if (_list->count == count)
+    {
+        free(block);
+
+        return;
+    }
+
+    _list->entries[count].owned = true;
+
+    return;
+}
+
 /*
 d_test_sa_failure_list_print
   Prints all recorded failures to stdout as a summary block.
@@ -532,6 +664,8 @@ d_test_sa_failure_list_free
     struct d_test_sa_failure_list* _list
 )
 {
+    size_t i;
+
     if (!_list)
     {
         return;
@@ -539,6 +673,14 @@ d_test_sa_failure_list_free
 
     if (_list->entries)
     {
+        for (i = 0; i < _list->count; i++)
+        {
+            if (_list->entries[i].owned)
+            {
+                free((void*)_list->entries[i].test_name);
+            }
+        }
+
         free(_list->entries);
         _list->entries = NULL;
     }
@@ -1671,6 +1813,43 @@ d_test_sa_get_elapsed_time
     return (double)(_end - _start) / CLOCKS_PER_SEC;
 }
 
+/*
+d_test_internal_wall_time
+  Returns a wall-clock reading in seconds for timing suites and modules.
+Uses CLOCK_MONOTONIC where available, then timespec_get; unlike clock(),
+time spent sleeping or waiting on child processes is counted. Falls back
+to clock() only when neither wall clock exists.
+
+Return:
+  Seconds since an arbitrary fixed point.
+*/
+static double
+d_test_internal_wall_time
+(
+    void
+)
+{
+    struct timespec ts;
+
+#if D_TIME_HAS_CLOCK_GETTIME
+    if (clock_gettime(CLOCK_MONOTONIC, &ts) == 0)
+    {
+        return (double)ts.tv_sec + ((double)ts.tv_nsec / 1e9);
+    }
+#endif
+
+#if D_TIME_HAS_TIMESPEC_GET
+    if (timespec_get(&ts, TIME_UTC) == TIME_UTC)
+    {
+        return (double)ts.tv_sec + ((double)ts.tv_nsec / 1e9);
+    }
+#endif
+
+    (void)ts;
+
+    return (double)clock() / CLOCKS_PER_SEC;
+}
+
 /******************************************************************************
  * STANDALONE TEST OUTPUT FORMATTING FUNCTIONS
  *****************************************************************************/
@@ -2417,79 +2596,125 @@ d_test_sa_runner_set_show_notes
 }
 
 /*
-d_test_sa_runner_execute
-  Executes all registered test modules and generates comprehensive output.
-Respects CLI options for numbering, footers, file output, and failure
-listing.
+d_test_internal_run_module
+  Runs a single registered module in the current process and fills
+_counter with its results.
 
 Parameter(s):
-  _runner: the runner to execute
+  _entry:   the module registration entry
+  _counter: counter to receive the module's results (pre-reset)
 Return:
-  0 if all tests passed, 1 if any tests failed.
+  true if every assertion and test in the module passed.
 */
-int
-d_test_sa_runner_execute
+static bool
+d_test_internal_run_module
 (
-    struct d_test_sa_runner* _runner
+    const struct d_test_sa_module_entry* _entry,
+    struct d_test_counter*               _counter
 )
 {
-    size_t                 i;
-    clock_t                suite_start;
-    clock_t                suite_end;
-    clock_t                module_start;
-    clock_t                module_end;
-    bool                   overall_result;
-    struct d_test_counter  overall_counter;
-    size_t                 modules_passed;
+    struct d_test_object* test_results;
+    bool                  module_result;
 
-    if (!_runner)
+    module_result = false;
+
+    if (_entry->run_fn)
     {
-        return 1;
+        // tree-based test function
+        test_results = _entry->run_fn();
+
+        if (test_results)
+        {
+            d_test_default_print_object(test_results, 0, _counter);
+
+            module_result =
+                (_counter->assertions_passed ==
+                 _counter->assertions_total) &&
+                (_counter->tests_passed ==
+                 _counter->tests_total);
+
+            d_test_object_free(test_results);
+        }
+    }
+    else if (_entry->run_counter)
+    {
+        // counter-based test function
+        module_result = _entry->run_counter(_counter);
     }
 
-    // set up global state for assertion functions
-    g_d_test_options        = &_runner->options;
-    g_d_test_failures       = &_runner->failures;
-    g_d_test_assertion_number = 0;
-    g_d_test_test_number      = 0;
-    g_d_test_current_module   = NULL;
-    g_d_test_output_file      = NULL;
+    return module_result;
+}
 
-    // open output file if specified
-    if (_runner->options.output_file)
+/*
+d_test_internal_report_module
+  Prints the per-module footer and implementation notes, as enabled by the
+runner's options.
+
+Parameter(s):
+  _runner:  the runner
+  _index:   index of the module
+  _counter: the module's results
+Return:
+  none.
+*/
+static void
+d_test_internal_report_module
+(
+    const struct d_test_sa_runner* _runner,
+    size_t                         _index,
+    struct d_test_counter*         _counter
+)
+{
+    // print module results (if footers enabled)
+    if (_runner->options.show_module_footer)
     {
-        g_d_test_output_file = d_fopen(
-            _runner->options.output_file, "w");
+        d_test_sa_create_module_test_results(
+            _runner->modules[_index].name,
+            _counter);
+    }
 
-        if (!g_d_test_output_file)
-        {
-            printf("WARNING: could not open output file "
-                   "'%s'\n",
-                   _runner->options.output_file);
-        }
+    // print module notes if enabled
+    if ( _runner->show_notes                   &&
+         _runner->modules[_index].notes        &&
+         _runner->modules[_index].note_count > 0 )
+    {
+        d_test_sa_create_implementation_notes(
+            _runner->modules[_index].note_count,
+            _runner->modules[_index].notes);
     }
 
-    // initialize tracking
-    overall_result = true;
-    modules_passed = 0;
-    d_test_counter_reset(&overall_counter);
+    return;
+}
 
-    // record suite start time
-    suite_start = clock();
+/*
+d_test_internal_execute_in_process
+  Runs every registered module sequentially in the current process.
 
-    // print framework header
-    d_test_sa_create_framework_header(
-        _runner->suite_name,
-        _runner->suite_description);
+Parameter(s):
+  _runner:         the runner
+  _overall:        counter accumulating results across modules
+  _modules_passed: incremented once per passing module
+Return:
+  true if every module passed.
+*/
+static bool
+d_test_internal_execute_in_process
+(
+    struct d_test_sa_runner* _runner,
+    struct d_test_counter*   _overall,
+    size_t*                  _modules_passed
+)
+{
+    size_t                i;
+    struct d_test_counter module_counter;
+    bool                  module_result;
+    bool                  overall_result;
+
+    overall_result = true;
 
-    // execute each registered module
     for (i = 0; i < _runner->module_count; i++)
     {
-        struct d_test_counter  module_counter;
-        bool                   module_result;
-
         d_test_counter_reset(&module_counter);
-        module_result = false;
 
         // set current module name for failure tracking
         g_d_test_current_module = _runner->modules[i].name;
@@ -2506,81 +2731,801 @@ d_test_sa_runner_execute
             _runner->modules[i].name,
             _runner->modules[i].description);
 
-        // record module start time
-        module_start = clock();
+        module_result = d_test_internal_run_module(&_runner->modules[i],
+                                                   &module_counter);
 
-        // execute module tests
-        if (_runner->modules[i].run_fn)
+        d_test_internal_report_module(_runner, i, &module_counter);
+
+        // update overall counters
+        d_test_counter_add(_overall, &module_counter);
+
+        if (module_result)
         {
-            // tree-based test function
-            struct d_test_object* test_results;
+            (*_modules_passed)++;
+        }
 
-            test_results = _runner->modules[i].run_fn();
+        overall_result = overall_result && module_result;
+    }
 
-            if (test_results)
-            {
-                d_test_default_print_object(
-                    test_results, 0, &module_counter);
+    return overall_result;
+}
+
+#if D_TEST_SA_HAS_ISOLATION
+
+// DTestSaFrameType
+//   enum: record types streamed from an isolated module process to the
+// runner. Every record is a d_test_internal_frame header followed by
+// `size` payload bytes.
+enum DTestSaFrameType
+{
+    D_TEST_SA_FRAME_FAILURE = 1,   // "test_name\0message\0"
+    D_TEST_SA_FRAME_RESULT  = 2    // struct d_test_internal_frame_result
+};
+
+// d_test_internal_frame
+//   struct: header of one streamed record.
+struct d_test_internal_frame
+{
+    uint32_t type;
+    uint32_t size;
+};
+
+// d_test_internal_frame_result
+//   struct: payload of the final record sent by a module process. Parent
+// and child are the same executable, so the layout is shared as-is.
+struct d_test_internal_frame_result
+{
+    struct d_test_counter counter;
+    double                elapsed;
+    uint32_t              passed;
+};
+
+// d_test_internal_isolated_job
+//   struct: parent-side state for one module process.
+struct d_test_internal_isolated_job
+{
+    pid_t   pid;
+    int     fd;          // read end of the result pipe, -1 once closed
+    int     status;      // waitpid status
+    int64_t start_ms;    // monotonic launch time
+    bool    started;
+    bool    timed_out;
+    FILE*   capture;     // module's stdout, shared with the child
+    char*   data;        // raw frames received so far
+    size_t  size;
+    size_t  capacity;
+};
+
+/*
+d_test_internal_now_ms
+  Returns monotonic wall-clock time in milliseconds.
+*/
+static int64_t
+d_test_internal_now_ms
+(
+    void
+)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ((int64_t)ts.tv_sec * 1000) + (int64_t)(ts.tv_nsec / 1000000);
+}
+
+/*
+d_test_internal_write_all
+  Writes an entire buffer to a file descriptor, retrying on partial writes
+and interrupts.
+*/
+static bool
+d_test_internal_write_all
+(
+    int         _fd,
+    const void* _data,
+    size_t      _size
+)
+{
+    const char* cursor;
+    ssize_t     written;
+
+    cursor = (const char*)_data;
 
-                module_result =
-                    (module_counter.assertions_passed ==
-                     module_counter.assertions_total) &&
-                    (module_counter.tests_passed ==
-                     module_counter.tests_total);
+    while (_size > 0)
+    {
+        written = write(_fd, cursor, _size);
 
-                d_test_object_free(test_results);
+        if (written < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
             }
+
+            return false;
         }
-        else if (_runner->modules[i].run_counter)
+
+        cursor += written;
+        _size  -= (size_t)written;
+    }
+
+    return true;
+}
+
+/*
+d_test_internal_write_frame
+  Writes one framed record to a file descriptor.
+*/
+static bool
+d_test_internal_write_frame
+(
+    int         _fd,
+    uint32_t    _type,
+    const void* _payload,
+    size_t      _size
+)
+{
+    struct d_test_internal_frame frame;
+
+    frame.type = _type;
+    frame.size = (uint32_t)_size;
+
+    return d_test_internal_write_all(_fd, &frame, sizeof(frame)) &&
+           d_test_internal_write_all(_fd, _payload, _size);
+}
+
+/*
+d_test_internal_isolated_child
+  Body of a module process: sends stdout to the job's capture file, runs
+the module, then streams each recorded failure and the final result over
+_fd. Output written before a crash stays in the capture file, which the
+parent owns. Never returns.
+*/
+static void
+d_test_internal_isolated_child
+(
+    struct d_test_sa_runner* _runner,
+    size_t                   _index,
+    FILE*                    _capture,
+    int                      _fd
+)
+{
+    struct d_test_sa_failure_list       failures;
+    struct d_test_internal_frame_result result;
+    size_t                              i;
+    size_t                              name_len;
+    size_t                              message_len;
+    char*                               payload;
+    double                              start;
+
+    // route everything the module prints into the capture file
+    if (_capture)
+    {
+        dup2(fileno(_capture), STDOUT_FILENO);
+    }
+
+    // the parent mirrors replayed output to the file itself
+    g_d_test_output_file    = NULL;
+    g_d_test_current_module = _runner->modules[_index].name;
+    g_d_test_assertion_number = 0;
+    g_d_test_test_number      = 0;
+
+    d_test_sa_failure_list_init(&failures);
+    g_d_test_failures = &failures;
+
+    d_test_counter_reset(&result.counter);
+
+    start          = d_test_internal_wall_time();
+    result.passed  = d_test_internal_run_module(&_runner->modules[_index],
+                                                &result.counter) ? 1u : 0u;
+    result.elapsed = d_test_internal_wall_time() - start;
+
+    fflush(stdout);
+
+    for (i = 0; i < failures.count; i++)
+    {
+        name_len    = failures.entries[i].test_name
+                          ? strlen(failures.entries[i].test_name)
+                          : 0;
+        message_len = failures.entries[i].message
+                          ? strlen(failures.entries[i].message)
+                          : 0;
+        payload     = (char*)malloc(name_len + message_len + 2);
+
+        if (!payload)
         {
-            // counter-based test function
-            module_result =
-                _runner->modules[i].run_counter(
-                    &module_counter);
+            continue;
         }
 
-        // record module end time
-        module_end = clock();
+        payload[name_len]                   = '\0';
+        payload[name_len + 1 + message_len] = '\0';
 
-        // print module results (if footers enabled)
-        if (_runner->options.show_module_footer)
+        if (name_len)
         {
-            d_test_sa_create_module_test_results(
-                _runner->modules[i].name,
-                &module_counter);
+            memcpy(payload, failures.entries[i].test_name, name_len);
         }
 
-        // print module notes if enabled
-        if ( _runner->show_notes              &&
-             _runner->modules[i].notes        &&
-             _runner->modules[i].note_count > 0 )
+        if (message_len)
         {
-            d_test_sa_create_implementation_notes(
-                _runner->modules[i].note_count,
-                _runner->modules[i].notes);
+            memcpy(payload + name_len + 1,
+                   failures.entries[i].message,
+                   message_len);
         }
 
-        // update overall counters
-        d_test_counter_add(&overall_counter,
-                           &module_counter);
+        d_test_internal_write_frame(_fd,
+                                    D_TEST_SA_FRAME_FAILURE,
+                                    payload,
+                                    name_len + message_len + 2);
 
-        if (module_result)
-        {
-            modules_passed++;
+        free(payload);
+    }
+
+    d_test_internal_write_frame(_fd,
+                                D_TEST_SA_FRAME_RESULT,
+                                &result,
+                                sizeof(result));
+
+    close(_fd);
+
+    // skip atexit handlers and stdio flushes inherited from the parent
+    _exit(0);
+}
+
+/*
+d_test_internal_isolated_spawn
+  Forks a process for module _index. On failure the job is left with
+started == false and is reported as a failed module.
+*/
+static void
+d_test_internal_isolated_spawn
+(
+    struct d_test_sa_runner*             _runner,
+    size_t                               _index,
+    struct d_test_internal_isolated_job* _job
+)
+{
+    int pipe_fds[2];
+
+    _job->started   = false;
+    _job->timed_out = false;
+    _job->fd        = -1;
+    _job->status    = 0;
+    _job->capture   = tmpfile();
+
+    if (pipe(pipe_fds) != 0)
+    {
+        return;
+    }
+
+    // buffered output must not be duplicated into the child
+    fflush(stdout);
+
+    if (g_d_test_output_file)
+    {
+        fflush(g_d_test_output_file);
+    }
+
+    _job->pid = fork();
+
+    if (_job->pid < 0)
+    {
+        close(pipe_fds[0]);
+        close(pipe_fds[1]);
+
+        return;
+    }
+
+    if (_job->pid == 0)
+    {
+        close(pipe_fds[0]);
+        d_test_internal_isolated_child(_runner,
+                                       _index,
+                                       _job->capture,
+                                       pipe_fds[1]);
+    }
+
+    close(pipe_fds[1]);
+
+    _job->fd       = pipe_fds[0];
+    _job->start_ms = d_test_internal_now_ms();
+    _job->started  = true;
+
+    return;
+}
+
+/*
+d_test_internal_isolated_read
+  Drains available bytes from a job's pipe. Returns false once the pipe
+reached end-of-file (the child exited or was killed).
+*/
+static bool
+d_test_internal_isolated_read
+(
+    struct d_test_internal_isolated_job* _job
+)
+{
+    char*   grown;
+    size_t  new_capacity;
+    ssize_t got;
+
+    if (_job->capacity - _job->size < 4096)
+    {
+        new_capacity = (_job->capacity > 0) ? _job->capacity * 2 : 8192;
+        grown        = (char*)realloc(_job->data, new_capacity);
+
+        if (!grown)
+        {
+            return false;
+        }
+
+        _job->data     = grown;
+        _job->capacity = new_capacity;
+    }
+
+    got = read(_job->fd,
+               _job->data + _job->size,
+               _job->capacity - _job->size);
+
+    if (got < 0)
+    {
+        return (errno == EINTR) || (errno == EAGAIN);
+    }
+
+    if (got == 0)
+    {
+        return false;
+    }
+
+    _job->size += (size_t)got;
+
+    return true;
+}
+
+/*
+d_test_internal_isolated_replay
+  Prints a finished module's captured output and folds its streamed
+results into _counter and the runner's failure list. A module that died
+before reporting (crash, timeout, failed launch) is counted as one failed
+test. Returns the module's pass/fail status.
+*/
+static bool
+d_test_internal_isolated_replay
+(
+    struct d_test_sa_runner*                   _runner,
+    size_t                                     _index,
+    const struct d_test_internal_isolated_job* _job,
+    struct d_test_counter*                     _counter
+)
+{
+    struct d_test_internal_frame        frame;
+    struct d_test_internal_frame_result result;
+    const char*                         payload;
+    const char*                         name;
+    char                                buffer[4096];
+    size_t                              count;
+    size_t                              offset;
+    bool                                have_result;
+    char                                reason[128];
+
+    // captured output first, exactly as the module printed it
+    if (_job->capture)
+    {
+        rewind(_job->capture);
+
+        while ((count = fread(buffer, 1, sizeof(buffer), _job->capture)) > 0)
+        {
+            fwrite(buffer, 1, count, stdout);
+
+            if (g_d_test_output_file)
+            {
+                fwrite(buffer, 1, count, g_d_test_output_file);
+            }
+        }
+    }
+
+    have_result = false;
+    offset      = 0;
+
+    while (offset + sizeof(frame) <= _job->size)
+    {
+        memcpy(&frame, _job->data + offset, sizeof(frame));
+
+        if (offset + sizeof(frame) + frame.size > _job->size)
+        {
+            // truncated record: the process died mid-write
+            break;
+        }
+
+        payload = _job->data + offset + sizeof(frame);
+        offset += sizeof(frame) + frame.size;
+
+        switch (frame.type)
+        {
+            case D_TEST_SA_FRAME_FAILURE:
+                name = payload;
+
+                d_test_sa_failure_list_add_copy(
+                    &_runner->failures,
+                    _runner->modules[_index].name,
+                    name,
+                    name + strlen(name) + 1);
+
+                break;
+
+            case D_TEST_SA_FRAME_RESULT:
+                if (frame.size == sizeof(result))
+                {
+                    memcpy(&result, payload, sizeof(result));
+                    have_result = true;
+                }
+
+                break;
+
+            default:
+                break;
+        }
+    }
+
+    if (have_result)
+    {
+        *_counter = result.counter;
+
+        return (result.passed != 0);
+    }
+
+    // the module never reported: describe why and count it as a failure
+    if (!_job->started)
+    {
+        snprintf(reason, sizeof(reason), "could not start module process");
+    }
+    else if (_job->timed_out)
+    {
+        snprintf(reason, sizeof(reason),
+                   "timed out after %zu ms",
+                   _runner->options.timeout_ms);
+    }
+    else if (WIFSIGNALED(_job->status))
+    {
+        snprintf(reason, sizeof(reason),
+                   "crashed (signal %d)",
+                   WTERMSIG(_job->status));
+    }
+    else
+    {
+        snprintf(reason, sizeof(reason),
+                   "exited without reporting (status %d)",
+                   WIFEXITED(_job->status) ? WEXITSTATUS(_job->status) : -1);
+    }
+
+    D_INTERNAL_TPRINTF("%s%s module %s\n",
+                       D_INDENT,
+                       D_TEST_SYMBOL_FAIL,
+                       reason);
+
+    _counter->tests_total++;
+
+    d_test_sa_failure_list_add_copy(&_runner->failures,
+                                    _runner->modules[_index].name,
+                                    "(module process)",
+                                    reason);
+
+    return false;
+}
+
+/*
+d_test_internal_execute_isolated
+  Runs every registered module in its own child process, at most
+`options.jobs` at a time. Results are streamed back over pipes as framed
+binary records while modules run, and each module's stdout goes to its own
+temporary file; once all have finished, output is replayed in
+registration order so reports match a sequential run. A
+module that crashes, or exceeds `options.timeout_ms` (then killed), is
+reported as a failure without affecting the others.
+
+Parameter(s):
+  _runner:         the runner
+  _overall:        counter accumulating results across modules
+  _modules_passed: incremented once per passing module
+Return:
+  true if every module passed.
+*/
+static bool
+d_test_internal_execute_isolated
+(
+    struct d_test_sa_runner* _runner,
+    struct d_test_counter*   _overall,
+    size_t*                  _modules_passed
+)
+{
+    struct d_test_internal_isolated_job* jobs;
+    struct pollfd*                       fds;
+    size_t*                              fd_jobs;
+    struct d_test_counter                module_counter;
+    size_t                               next;
+    size_t                               running;
+    size_t                               poll_count;
+    size_t                               i;
+    int64_t                              now;
+    int64_t                              remaining;
+    int                                  wait_ms;
+    bool                                 module_result;
+    bool                                 overall_result;
+
+    if (_runner->module_count == 0)
+    {
+        return true;
+    }
+
+    jobs    = (struct d_test_internal_isolated_job*)calloc(
+                  _runner->module_count,
+                  sizeof(struct d_test_internal_isolated_job));
+    fds     = (struct pollfd*)calloc(_runner->module_count,
+                                     sizeof(struct pollfd));
+    fd_jobs = (size_t*)calloc(_runner->module_count, sizeof(size_t));
+
+    if ( (!jobs) || (!fds) || (!fd_jobs) )
+    {
+        free(jobs);
+        free(fds);
+        free(fd_jobs);
+
+        return d_test_internal_execute_in_process(_runner,
+                                                  _overall,
+                                                  _modules_passed);
+    }
+
+    next    = 0;
+    running = 0;
+
+    while ( (next < _runner->module_count) || (running > 0) )
+    {
+        // keep the pool full
+        while ( (next < _runner->module_count) &&
+                (running < _runner->options.jobs) )
+        {
+            d_test_internal_isolated_spawn(_runner, next, &jobs[next]);
+
+            if (jobs[next].started)
+            {
+                running++;
+            }
+
+            next++;
+        }
+
+        if (running == 0)
+        {
+            continue;
+        }
+
+        // wait for output, bounded by the nearest deadline
+        poll_count = 0;
+        wait_ms    = -1;
+        now        = d_test_internal_now_ms();
+
+        for (i = 0; i < next; i++)
+        {
+            if (jobs[i].fd < 0)
+            {
+                continue;
+            }
+
+            fds[poll_count].fd      = jobs[i].fd;
+            fds[poll_count].events  = POLLIN;
+            fds[poll_count].revents = 0;
+            fd_jobs[poll_count]     = i;
+            poll_count++;
+
+            if ( (_runner->options.timeout_ms > 0) &&
+                 (!jobs[i].timed_out) )
+            {
+                remaining = jobs[i].start_ms +
+                            (int64_t)_runner->options.timeout_ms - now;
+
+                if (remaining < 0)
+                {
+                    remaining = 0;
+                }
+
+                if ( (wait_ms < 0) || (remaining < (int64_t)wait_ms) )
+                {
+                    wait_ms = (int)remaining;
+                }
+            }
+        }
+
+        if ( (poll(fds, (nfds_t)poll_count, wait_ms) < 0) &&
+             (errno != EINTR) )
+        {
+            break;
+        }
+
+        for (i = 0; i < poll_count; i++)
+        {
+            struct d_test_internal_isolated_job* job;
+
+            if (!fds[i].revents)
+            {
+                continue;
+            }
+
+            job = &jobs[fd_jobs[i]];
+
+            if (!d_test_internal_isolated_read(job))
+            {
+                close(job->fd);
+                job->fd = -1;
+
+                while ( (waitpid(job->pid, &job->status, 0) < 0) &&
+                        (errno == EINTR) )
+                {
+                }
+
+                running--;
+            }
+        }
+
+        // enforce the per-module time limit
+        if (_runner->options.timeout_ms > 0)
+        {
+            now = d_test_internal_now_ms();
+
+            for (i = 0; i < next; i++)
+            {
+                if ( (jobs[i].fd >= 0)   &&
+                     (!jobs[i].timed_out) &&
+                     (now - jobs[i].start_ms >=
+                          (int64_t)_runner->options.timeout_ms) )
+                {
+                    // the pipe reports EOF once the process is gone
+                    kill(jobs[i].pid, SIGKILL);
+                    jobs[i].timed_out = true;
+                }
+            }
+        }
+    }
+
+    overall_result = true;
+
+    for (i = 0; i < _runner->module_count; i++)
+    {
+        d_test_counter_reset(&module_counter);
+
+        d_test_sa_create_module_test_header(
+            _runner->modules[i].name,
+            _runner->modules[i].description);
+
+        module_result = d_test_internal_isolated_replay(_runner,
+                                                        i,
+                                                        &jobs[i],
+                                                        &module_counter);
+
+        d_test_internal_report_module(_runner, i, &module_counter);
+
+        d_test_counter_add(_overall, &module_counter);
+
+        if (module_result)
+        {
+            (*_modules_passed)++;
         }
 
         overall_result = overall_result && module_result;
+
+        if (jobs[i].capture)
+        {
+            fclose(jobs[i].capture);
+        }
+
+        free(jobs[i].data);
     }
 
+    free(fd_jobs);
+    free(fds);
+    free(jobs);
+
+    return overall_result;
+}
+
+#endif  // D_TEST_SA_HAS_ISOLATION
+
+/*
+d_test_sa_runner_execute
+  Executes all registered test modules and generates comprehensive output.
+Respects CLI options for numbering, footers, file output, and failure
+listing. With `options.jobs` > 0 (and D_TEST_SA_HAS_ISOLATION), modules
+run in isolated child processes; see d_test_internal_execute_isolated.
+
+Parameter(s):
+  _runner: the runner to execute
+Return:
+  0 if all tests passed, 1 if any tests failed.
+*/
+int
+d_test_sa_runner_execute
+(
+    struct d_test_sa_runner* _runner
+)
+{
+    double                 suite_start;
+    double                 suite_end;
+    bool                   overall_result;
+    struct d_test_counter  overall_counter;
+    size_t                 modules_passed;
+
+    if (!_runner)
+    {
+        return 1;
+    }
+
+    // set up global state for assertion functions
+    g_d_test_options        = &_runner->options;
+    g_d_test_failures       = &_runner->failures;
+    g_d_test_assertion_number = 0;
+    g_d_test_test_number      = 0;
+    g_d_test_current_module   = NULL;
+    g_d_test_output_file      = NULL;
+
+    // open output file if specified
+    if (_runner->options.output_file)
+    {
+        g_d_test_output_file = d_fopen(
+            _runner->options.output_file, "w");
+
+        if (!g_d_test_output_file)
+        {
+            printf("WARNING: could not open output file "
+                   "'%s'\n",
+                   _runner->options.output_file);
+        }
+    }
+
+    // initialize tracking
+    overall_result = true;
+    modules_passed = 0;
+    d_test_counter_reset(&overall_counter);
+
+    // record suite start time
+    suite_start = d_test_internal_wall_time();
+
+    // print framework header
+    d_test_sa_create_framework_header(
+        _runner->suite_name,
+        _runner->suite_description);
+
+    // execute registered modules
+#if D_TEST_SA_HAS_ISOLATION
+    if (_runner->options.jobs > 0)
+    {
+        overall_result = d_test_internal_execute_isolated(_runner,
+                                                          &overall_counter,
+                                                          &modules_passed);
+    }
+    else
+    {
+        overall_result = d_test_internal_execute_in_process(_runner,
+                                                            &overall_counter,
+                                                            &modules_passed);
+    }
+#else
+    if (_runner->options.jobs > 0)
+    {
+        printf("WARNING: isolated execution is not available on this "
+               "platform; running modules in-process\n");
+    }
+
+    overall_result = d_test_internal_execute_in_process(_runner,
+                                                        &overall_counter,
+                                                        &modules_passed);
+#endif
+
     // record suite end time
-    suite_end = clock();
+    suite_end = d_test_internal_wall_time();
 
     // build suite results
     _runner->results.modules_total  = _runner->module_count;
     _runner->results.modules_passed = modules_passed;
     _runner->results.totals         = overall_counter;
-    _runner->results.total_time     =
-        d_test_sa_get_elapsed_time(suite_start, suite_end);
+    _runner->results.total_time     = suite_end - suite_start;
 
     // print comprehensive results
     d_test_sa_create_comprehensive_results(
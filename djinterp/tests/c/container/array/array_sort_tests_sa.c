@@ -0,0 +1,30 @@
+#include "./array_sort_tests_sa.h"
+
+
+/*
+d_tests_sa_array_sort_run_all
+  Module-level aggregation function that runs all array_sort tests.
+  Executes tests for all categories:
+  - Comparator sort
+  - Typed, radix and keyed sorts
+  - Parallel sort and merge
+  - Performance against qsort
+*/
+bool
+d_tests_sa_array_sort_run_all
+(
+    struct d_test_counter* _counter
+)
+{
+    bool result;
+
+    result = true;
+
+    // run all test categories
+    result = d_tests_sa_array_sort_comparator_all(_counter) && result;
+    result = d_tests_sa_array_sort_typed_all(_counter) && result;
+    result = d_tests_sa_array_sort_parallel_all(_counter) && result;
+    result = d_tests_sa_array_sort_performance_all(_counter) && result;
+
+    return result;
+}
@@ -0,0 +1,87 @@
+/******************************************************************************
+* djinterp [test]                                       array_sort_tests_sa.h
+*
+*   Unit test declarations for `array_sort.h` module.
+*   Covers the comparator introsort (including odd element sizes and
+* adversarial inputs), the generated typed and radix sorts, float total
+* order, stable keyed record sorts, the merge-based and parallel sorts of
+* `array_sort_parallel.h`, and a timing comparison against qsort.
+*
+*
+* path:      /tests/container/array/array_sort_tests_sa.h
+* link(s):   TBA
+* author(s): Samuel 'teer' Neal-Blim                          date: 2026.10.18
+******************************************************************************/
+
+#ifndef DJINTERP_TESTS_ARRAY_SORT_SA_
+#define DJINTERP_TESTS_ARRAY_SORT_SA_ 1
+
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "../../../../inc/c/djinterp.h"
+#include "../../../../inc/c/dtime.h"
+#include "../../../../inc/c/test/test_standalone.h"
+#include "../../../../inc/c/container/array/array_sort.h"
+#include "../../../../inc/c/container/array/array_sort_parallel.h"
+
+
+#ifndef D_TEST_ARRAY_SORT_BENCH_COUNT
+    // D_TEST_ARRAY_SORT_BENCH_COUNT
+    //   constant: number of elements sorted by the performance tests.
+    #define D_TEST_ARRAY_SORT_BENCH_COUNT 1000000
+#endif  // D_TEST_ARRAY_SORT_BENCH_COUNT
+
+
+/******************************************************************************
+ * I. COMPARATOR SORT TESTS
+ *****************************************************************************/
+bool d_tests_sa_array_sort_comparator(struct d_test_counter* _counter);
+bool d_tests_sa_array_sort_element_sizes(struct d_test_counter* _counter);
+bool d_tests_sa_array_sort_patterns(struct d_test_counter* _counter);
+
+// I.   aggregation function
+bool d_tests_sa_array_sort_comparator_all(struct d_test_counter* _counter);
+
+
+/******************************************************************************
+ * II. TYPED, RADIX AND KEYED SORT TESTS
+ *****************************************************************************/
+bool d_tests_sa_array_sort_typed_int(struct d_test_counter* _counter);
+bool d_tests_sa_array_sort_typed_float(struct d_test_counter* _counter);
+bool d_tests_sa_array_sort_radix(struct d_test_counter* _counter);
+bool d_tests_sa_array_sort_keyed(struct d_test_counter* _counter);
+
+// II.  aggregation function
+bool d_tests_sa_array_sort_typed_all(struct d_test_counter* _counter);
+
+
+/******************************************************************************
+ * III. PARALLEL SORT AND MERGE TESTS
+ *****************************************************************************/
+bool d_tests_sa_array_sort_parallel_unstable(struct d_test_counter* _counter);
+bool d_tests_sa_array_sort_parallel_stable(struct d_test_counter* _counter);
+bool d_tests_sa_array_merge_runs_parallel(struct d_test_counter* _counter);
+
+// III. aggregation function
+bool d_tests_sa_array_sort_parallel_all(struct d_test_counter* _counter);
+
+
+/******************************************************************************
+ * IV. PERFORMANCE TESTS
+ *****************************************************************************/
+bool d_tests_sa_array_sort_performance(struct d_test_counter* _counter);
+
+// IV.  aggregation function
+bool d_tests_sa_array_sort_performance_all(struct d_test_counter* _counter);
+
+
+/******************************************************************************
+ * MODULE-LEVEL AGGREGATION
+ *****************************************************************************/
+bool d_tests_sa_array_sort_run_all(struct d_test_counter* _counter);
+
+
+#endif  // DJINTERP_TESTS_ARRAY_SORT_SA_
@@ -0,0 +1,366 @@
+#include "./array_sort_tests_sa.h"
+
+
+///////////////////////////////////////////////////////////////////////////////
+// file-scope helpers
+///////////////////////////////////////////////////////////////////////////////
+
+// d_test_array_sort_wide
+//   struct: element whose size is not a multiple of eight, exercising the
+// byte tail of the swap.
+struct d_test_array_sort_wide
+{
+    int  key;
+    char tag[9];
+};
+
+// helper: orders ints
+static int
+d_test_array_sort_compare_int
+(
+    const void* _a,
+    const void* _b
+)
+{
+    return (*(const int*)_a > *(const int*)_b) -
+           (*(const int*)_a < *(const int*)_b);
+}
+
+// helper: orders wide elements by key
+static int
+d_test_array_sort_compare_wide
+(
+    const void* _a,
+    const void* _b
+)
+{
+    const struct d_test_array_sort_wide* a;
+    const struct d_test_array_sort_wide* b;
+
+    a = (const struct d_test_array_sort_wide*)_a;
+    b = (const struct d_test_array_sort_wide*)_b;
+
+    return (a->key > b->key) - (a->key < b->key);
+}
+
+// helper: orders bytes
+static int
+d_test_array_sort_compare_byte
+(
+    const void* _a,
+    const void* _b
+)
+{
+    return (int)*(const unsigned char*)_a - (int)*(const unsigned char*)_b;
+}
+
+// helper: deterministic pseudo-random sequence
+static uint32_t
+d_test_array_sort_next
+(
+    uint32_t* _state
+)
+{
+    *_state = (*_state * 1664525u) + 1013904223u;
+
+    return *_state >> 8;
+}
+
+// helper: true if `_values` is in non-decreasing order
+static bool
+d_test_array_sort_is_sorted_int
+(
+    const int* _values,
+    size_t     _count
+)
+{
+    size_t i;
+
+    for (i = 1; i < _count; i++)
+    {
+        if (_values[i - 1] > _values[i])
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// helper: sorts a copy with d_array_sort and compares it to qsort
+static bool
+d_test_array_sort_matches_qsort
+(
+    const int* _values,
+    size_t     _count
+)
+{
+    int* ours;
+    int* reference;
+    bool same;
+
+    ours      = malloc((_count + 1) * sizeof(int));
+    reference = malloc((_count + 1) * sizeof(int));
+
+    if ( (!ours) ||
+         (!reference) )
+    {
+        free(ours);
+        free(reference);
+
+        return false;
+    }
+
+    memcpy(ours, _values, _count * sizeof(int));
+    memcpy(reference, _values, _count * sizeof(int));
+
+    d_array_sort(ours, _count, sizeof(int), d_test_array_sort_compare_int);
+    qsort(reference, _count, sizeof(int), d_test_array_sort_compare_int);
+
+    same = (memcmp(ours, reference, _count * sizeof(int)) == 0);
+
+    free(ours);
+    free(reference);
+
+    return same;
+}
+
+
+/******************************************************************************
+ * I. COMPARATOR SORT TESTS
+ *****************************************************************************/
+
+/*
+d_tests_sa_array_sort_comparator
+  Tests the d_array_sort function.
+  Tests the following:
+  - NULL, empty and single-element inputs are left alone
+  - every size from 0 to 200 matches qsort on random input
+  - a large random input is sorted
+*/
+bool
+d_tests_sa_array_sort_comparator
+(
+    struct d_test_counter* _counter
+)
+{
+    bool     result;
+    int      values[200];
+    int*     large;
+    uint32_t state;
+    size_t   count;
+    size_t   i;
+    bool     agree;
+
+    result = true;
+    state  = 7;
+
+    // test 1: degenerate inputs
+    values[0] = 2;
+    values[1] = 1;
+    d_array_sort(NULL, 2, sizeof(int), d_test_array_sort_compare_int);
+    d_array_sort(values, 2, 0, d_test_array_sort_compare_int);
+    d_array_sort(values, 2, sizeof(int), NULL);
+    d_array_sort(values, 1, sizeof(int), d_test_array_sort_compare_int);
+
+    result = d_assert_standalone(
+        (values[0] == 2) &&
+        (values[1] == 1),
+        "sort_degenerate",
+        "Invalid or trivial inputs should be left unchanged",
+        _counter) && result;
+
+    // test 2: every small size
+    agree = true;
+
+    for (count = 0; (agree) && (count <= 200); count++)
+    {
+        for (i = 0; i < count; i++)
+        {
+            values[i] = (int)(d_test_array_sort_next(&state) % 100) - 50;
+        }
+
+        agree = d_test_array_sort_matches_qsort(values, count);
+    }
+
+    result = d_assert_standalone(
+        agree,
+        "sort_small_sizes",
+        "Sizes 0..200 should match qsort",
+        _counter) && result;
+
+    // test 3: large input
+    large = malloc(100000 * sizeof(int));
+
+    if (large)
+    {
+        for (i = 0; i < 100000; i++)
+        {
+            large[i] = (int)d_test_array_sort_next(&state);
+        }
+
+        d_array_sort(large, 100000, sizeof(int), d_test_array_sort_compare_int);
+    }
+
+    result = d_assert_standalone(
+        (large) &&
+        (d_test_array_sort_is_sorted_int(large, 100000)),
+        "sort_large",
+        "A large random input should be sorted",
+        _counter) && result;
+
+    free(large);
+
+    return result;
+}
+
+
+/*
+d_tests_sa_array_sort_element_sizes
+  Tests d_array_sort on elements that are not word sized.
+  Tests the following:
+  - 13-byte elements move whole (key and payload stay together)
+  - single-byte elements
+*/
+bool
+d_tests_sa_array_sort_element_sizes
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                          result;
+    struct d_test_array_sort_wide wide[100];
+    unsigned char                 bytes[100];
+    size_t                        i;
+    bool                          intact;
+
+    result = true;
+
+    for (i = 0; i < 100; i++)
+    {
+        wide[i].key = (int)((i * 37) % 100);
+        snprintf(wide[i].tag, sizeof(wide[i].tag), "k%d", wide[i].key);
+        bytes[i] = (unsigned char)((i * 91) % 256);
+    }
+
+    d_array_sort(wide,
+                 100,
+                 sizeof(struct d_test_array_sort_wide),
+                 d_test_array_sort_compare_wide);
+
+    intact = true;
+
+    for (i = 0; (intact) && (i < 100); i++)
+    {
+        char expected[9];
+
+        snprintf(expected, sizeof(expected), "k%d", (int)i);
+        intact = (wide[i].key == (int)i) &&
+                 (strcmp(wide[i].tag, expected) == 0);
+    }
+
+    // test 1: odd-sized records
+    result = d_assert_standalone(
+        intact,
+        "sort_wide_elements",
+        "Odd-sized elements should be sorted and moved whole",
+        _counter) && result;
+
+    // test 2: bytes, via a comparator
+    {
+        unsigned char reference[100];
+
+        memcpy(reference, bytes, sizeof(bytes));
+
+        d_array_sort(bytes, 100, 1, d_test_array_sort_compare_byte);
+        qsort(reference, 100, 1, d_test_array_sort_compare_byte);
+
+        result = d_assert_standalone(
+            memcmp(bytes, reference, sizeof(bytes)) == 0,
+            "sort_byte_elements",
+            "Single-byte elements should be sorted",
+            _counter) && result;
+    }
+
+    return result;
+}
+
+
+/*
+d_tests_sa_array_sort_patterns
+  Tests d_array_sort on inputs that defeat naive quicksorts.
+  Tests the following:
+  - sorted, reversed and all-equal inputs
+  - organ-pipe and sawtooth inputs
+*/
+bool
+d_tests_sa_array_sort_patterns
+(
+    struct d_test_counter* _counter
+)
+{
+    bool   result;
+    int*   values;
+    size_t count;
+    size_t i;
+    int    pattern;
+    bool   agree;
+
+    result = true;
+    count  = 20000;
+    values = malloc(count * sizeof(int));
+    agree  = (values != NULL);
+
+    for (pattern = 0; (agree) && (pattern < 5); pattern++)
+    {
+        for (i = 0; i < count; i++)
+        {
+            switch (pattern)
+            {
+                case 0:  values[i] = (int)i;                                    break;
+                case 1:  values[i] = (int)(count - i);                          break;
+                case 2:  values[i] = 42;                                        break;
+                case 3:  values[i] = (int)((i < count / 2) ? i : count - i);    break;
+                default: values[i] = (int)(i % 64);                             break;
+            }
+        }
+
+        agree = d_test_array_sort_matches_qsort(values, count);
+    }
+
+    // test 1: patterned inputs
+    result = d_assert_standalone(
+        agree,
+        "sort_patterns",
+        "Sorted, reversed, equal, organ-pipe and sawtooth inputs should sort",
+        _counter) && result;
+
+    free(values);
+
+    return result;
+}
+
+
+/*
+d_tests_sa_array_sort_comparator_all
+  Aggregation function that runs all comparator sort tests.
+*/
+bool
+d_tests_sa_array_sort_comparator_all
+(
+    struct d_test_counter* _counter
+)
+{
+    bool result;
+
+    result = true;
+
+    printf("\n  [SECTION] Comparator Sort\n");
+    printf("  -------------------------\n");
+
+    result = d_tests_sa_array_sort_comparator(_counter) && result;
+    result = d_tests_sa_array_sort_element_sizes(_counter) && result;
+    result = d_tests_sa_array_sort_patterns(_counter) && result;
+
+    return result;
+}
@@ -0,0 +1,439 @@
+#include "./array_sort_tests_sa.h"
+
+
+///////////////////////////////////////////////////////////////////////////////
+// file-scope helpers
+///////////////////////////////////////////////////////////////////////////////
+
+// d_test_array_sort_record
+//   struct: record with a coarse key and its original position, used to
+// check stability.
+struct d_test_array_sort_record
+{
+    uint32_t key;
+    uint32_t position;
+};
+
+// helper: orders uint32 values
+static int
+d_test_array_sort_parallel_compare_u32
+(
+    const void* _a,
+    const void* _b
+)
+{
+    return (*(const uint32_t*)_a > *(const uint32_t*)_b) -
+           (*(const uint32_t*)_a < *(const uint32_t*)_b);
+}
+
+// helper: orders records by key only
+static int
+d_test_array_sort_parallel_compare_record
+(
+    const void* _a,
+    const void* _b
+)
+{
+    const struct d_test_array_sort_record* a;
+    const struct d_test_array_sort_record* b;
+
+    a = (const struct d_test_array_sort_record*)_a;
+    b = (const struct d_test_array_sort_record*)_b;
+
+    return (a->key > b->key) - (a->key < b->key);
+}
+
+// helper: fills `_values` with a fixed pseudo-random sequence
+static void
+d_test_array_sort_parallel_fill
+(
+    uint32_t* _values,
+    size_t    _count,
+    uint32_t  _seed
+)
+{
+    size_t i;
+
+    for (i = 0; i < _count; i++)
+    {
+        _seed      = (_seed * 1664525u) + 1013904223u;
+        _values[i] = _seed >> 4;
+    }
+
+    return;
+}
+
+// helper: true if `_values` equals `_expected` element for element
+static bool
+d_test_array_sort_parallel_equal
+(
+    const uint32_t* _values,
+    const uint32_t* _expected,
+    size_t          _count
+)
+{
+    return (memcmp(_values, _expected, _count * sizeof(uint32_t)) == 0);
+}
+
+// helper: true if records are ordered by key and, within a key, by their
+// original position
+static bool
+d_test_array_sort_parallel_stable_order
+(
+    const struct d_test_array_sort_record* _records,
+    size_t                                 _count
+)
+{
+    size_t i;
+
+    for (i = 1; i < _count; i++)
+    {
+        if ( (_records[i - 1].key > _records[i].key) ||
+             ( (_records[i - 1].key == _records[i].key) &&
+               (_records[i - 1].position > _records[i].position) ) )
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+
+/******************************************************************************
+ * III. PARALLEL SORT AND MERGE TESTS
+ *****************************************************************************/
+
+/*
+d_tests_sa_array_sort_parallel_unstable
+  Tests d_array_sort_parallel in unstable mode against the sequential sort.
+  Tests the following:
+  - NULL elements, zero size and NULL comparator rejection
+  - inputs below the threshold are sorted on the calling thread
+  - large inputs on 2, 3 (not a power of two) and all hardware threads
+*/
+bool
+d_tests_sa_array_sort_parallel_unstable
+(
+    struct d_test_counter* _counter
+)
+{
+    bool      result;
+    uint32_t* source;
+    uint32_t* expected;
+    uint32_t* values;
+    size_t    count;
+    size_t    small;
+    bool      same;
+
+    result   = true;
+    count    = ((size_t)D_ARRAY_SORT_PARALLEL_THRESHOLD * 3) + 17;
+    source   = malloc(count * sizeof(uint32_t));
+    expected = malloc(count * sizeof(uint32_t));
+    values   = malloc(count * sizeof(uint32_t));
+
+    if ( (!source)   ||
+         (!expected) ||
+         (!values) )
+    {
+        free(source);
+        free(expected);
+        free(values);
+
+        return d_assert_standalone(false,
+                                   "parallel_unstable_alloc",
+                                   "Allocation of test buffers failed",
+                                   _counter);
+    }
+
+    // test 1: invalid arguments
+    result = d_assert_standalone(
+        (!d_array_sort_parallel(NULL, 4, sizeof(uint32_t), d_test_array_sort_parallel_compare_u32, D_ARRAY_SORT_UNSTABLE, 2)) &&
+        (!d_array_sort_parallel(values, 4, 0, d_test_array_sort_parallel_compare_u32, D_ARRAY_SORT_UNSTABLE, 2)) &&
+        (!d_array_sort_parallel(values, 4, sizeof(uint32_t), NULL, D_ARRAY_SORT_UNSTABLE, 2)),
+        "parallel_unstable_invalid",
+        "NULL elements, zero size and NULL comparator should be rejected",
+        _counter) && result;
+
+    d_test_array_sort_parallel_fill(source, count, 11);
+
+    // test 2: below the threshold
+    small = (size_t)D_ARRAY_SORT_PARALLEL_THRESHOLD / 2;
+    memcpy(values, source, small * sizeof(uint32_t));
+    memcpy(expected, source, small * sizeof(uint32_t));
+    d_array_sort_uint32(expected, small);
+    same = d_array_sort_parallel(values, small, sizeof(uint32_t), d_test_array_sort_parallel_compare_u32, D_ARRAY_SORT_UNSTABLE, 4) &&
+           d_test_array_sort_parallel_equal(values, expected, small);
+
+    result = d_assert_standalone(
+        same,
+        "parallel_unstable_small",
+        "Short input should be sorted on the calling thread",
+        _counter) && result;
+
+    memcpy(expected, source, count * sizeof(uint32_t));
+    d_array_sort_uint32(expected, count);
+
+    // test 3: two threads
+    memcpy(values, source, count * sizeof(uint32_t));
+    same = d_array_sort_parallel(values, count, sizeof(uint32_t), d_test_array_sort_parallel_compare_u32, D_ARRAY_SORT_UNSTABLE, 2) &&
+           d_test_array_sort_parallel_equal(values, expected, count);
+
+    result = d_assert_standalone(
+        same,
+        "parallel_unstable_two",
+        "Two-thread sort should match the sequential result",
+        _counter) && result;
+
+    // test 4: three threads (odd number of runs)
+    memcpy(values, source, count * sizeof(uint32_t));
+    same = d_array_sort_parallel(values, count, sizeof(uint32_t), d_test_array_sort_parallel_compare_u32, D_ARRAY_SORT_UNSTABLE, 3) &&
+           d_test_array_sort_parallel_equal(values, expected, count);
+
+    result = d_assert_standalone(
+        same,
+        "parallel_unstable_three",
+        "Three-thread sort should match the sequential result",
+        _counter) && result;
+
+    // test 5: hardware concurrency
+    memcpy(values, source, count * sizeof(uint32_t));
+    same = d_array_sort_parallel(values, count, sizeof(uint32_t), d_test_array_sort_parallel_compare_u32, D_ARRAY_SORT_UNSTABLE, 0) &&
+           d_test_array_sort_parallel_equal(values, expected, count);
+
+    result = d_assert_standalone(
+        same,
+        "parallel_unstable_hardware",
+        "Sort on all hardware threads should match the sequential result",
+        _counter) && result;
+
+    free(source);
+    free(expected);
+    free(values);
+
+    return result;
+}
+
+
+/*
+d_tests_sa_array_sort_parallel_stable
+  Tests d_array_sort_stable and d_array_sort_parallel in stable mode.
+  Tests the following:
+  - sequential merge sort keeps equal keys in their original order
+  - parallel stable sort on 3 and 4 threads keeps equal keys in order
+  - already sorted and reversed input
+*/
+bool
+d_tests_sa_array_sort_parallel_stable
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                             result;
+    struct d_test_array_sort_record* records;
+    uint32_t*                        keys;
+    size_t                           count;
+    size_t                           small;
+    size_t                           i;
+    bool                             ok;
+
+    result  = true;
+    count   = ((size_t)D_ARRAY_SORT_PARALLEL_THRESHOLD * 2) + 5;
+    small   = count / 2;
+    records = malloc(count * sizeof(struct d_test_array_sort_record));
+    keys    = malloc(count * sizeof(uint32_t));
+
+    if ( (!records) ||
+         (!keys) )
+    {
+        free(records);
+        free(keys);
+
+        return d_assert_standalone(false,
+                                   "parallel_stable_alloc",
+                                   "Allocation of test buffers failed",
+                                   _counter);
+    }
+
+    d_test_array_sort_parallel_fill(keys, count, 29);
+
+    // test 1: sequential merge sort, few distinct keys
+    for (i = 0; i < small; i++)
+    {
+        records[i].key      = keys[i] % 37;
+        records[i].position = (uint32_t)i;
+    }
+
+    ok = d_array_sort_stable(records, small, sizeof(struct d_test_array_sort_record), d_test_array_sort_parallel_compare_record) &&
+         d_test_array_sort_parallel_stable_order(records, small);
+
+    result = d_assert_standalone(
+        ok,
+        "stable_sequential",
+        "Merge sort should order by key and keep ties in place",
+        _counter) && result;
+
+    // test 2: parallel stable sort on three threads
+    for (i = 0; i < count; i++)
+    {
+        records[i].key      = keys[i] % 101;
+        records[i].position = (uint32_t)i;
+    }
+
+    ok = d_array_sort_parallel(records, count, sizeof(struct d_test_array_sort_record), d_test_array_sort_parallel_compare_record, D_ARRAY_SORT_STABLE, 3) &&
+         d_test_array_sort_parallel_stable_order(records, count);
+
+    result = d_assert_standalone(
+        ok,
+        "stable_parallel_three",
+        "Three-thread stable sort should keep ties in place",
+        _counter) && result;
+
+    // test 3: parallel stable sort on four threads, reversed keys
+    for (i = 0; i < count; i++)
+    {
+        records[i].key      = (uint32_t)((count - i) / 3);
+        records[i].position = (uint32_t)i;
+    }
+
+    ok = d_array_sort_parallel(records, count, sizeof(struct d_test_array_sort_record), d_test_array_sort_parallel_compare_record, D_ARRAY_SORT_STABLE, 4) &&
+         d_test_array_sort_parallel_stable_order(records, count);
+
+    result = d_assert_standalone(
+        ok,
+        "stable_parallel_reversed",
+        "Reversed input should come out ascending with ties in place",
+        _counter) && result;
+
+    // test 4: already sorted input stays put
+    ok = d_array_sort_parallel(records, count, sizeof(struct d_test_array_sort_record), d_test_array_sort_parallel_compare_record, D_ARRAY_SORT_STABLE, 4) &&
+         d_test_array_sort_parallel_stable_order(records, count);
+
+    result = d_assert_standalone(
+        ok,
+        "stable_parallel_sorted",
+        "Sorting sorted input should leave it unchanged",
+        _counter) && result;
+
+    free(records);
+    free(keys);
+
+    return result;
+}
+
+
+/*
+d_tests_sa_array_merge_runs_parallel
+  Tests d_array_merge_runs_parallel.
+  Tests the following:
+  - decreasing run ends rejection
+  - a single run is left alone
+  - uneven runs, including an empty one, merged on several threads
+  - ties go to the earlier run
+*/
+bool
+d_tests_sa_array_merge_runs_parallel
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                             result;
+    struct d_test_array_sort_record* records;
+    size_t                           run_ends[5];
+    size_t                           bad_ends[2] = { 4, 2 };
+    size_t                           count;
+    size_t                           start;
+    size_t                           run;
+    size_t                           i;
+    bool                             ok;
+
+    result = true;
+
+    // five runs: large, small, empty, medium, large
+    run_ends[0] = (size_t)D_ARRAY_SORT_PARALLEL_THRESHOLD;
+    run_ends[1] = run_ends[0] + 3;
+    run_ends[2] = run_ends[1];
+    run_ends[3] = run_ends[2] + 20000;
+    run_ends[4] = run_ends[3] + (size_t)D_ARRAY_SORT_PARALLEL_THRESHOLD;
+    count       = run_ends[4];
+    records     = malloc(count * sizeof(struct d_test_array_sort_record));
+
+    if (!records)
+    {
+        return d_assert_standalone(false,
+                                   "merge_runs_alloc",
+                                   "Allocation of test buffer failed",
+                                   _counter);
+    }
+
+    // test 1: run ends must not decrease
+    result = d_assert_standalone(
+        !d_array_merge_runs_parallel(records, sizeof(struct d_test_array_sort_record), bad_ends, 2, d_test_array_sort_parallel_compare_record, 2),
+        "merge_runs_bad_ends",
+        "Decreasing run ends should be rejected",
+        _counter) && result;
+
+    // each run counts up in steps that differ per run, so many keys repeat
+    // across runs; position records the run so ties can be checked
+    start = 0;
+
+    for (run = 0; run < 5; run++)
+    {
+        for (i = start; i < run_ends[run]; i++)
+        {
+            records[i].key      = (uint32_t)(((i - start) * (run + 1)) / 2);
+            records[i].position = (uint32_t)i;
+        }
+
+        start = run_ends[run];
+    }
+
+    // test 2: a single run is already merged
+    ok = d_array_merge_runs_parallel(records, sizeof(struct d_test_array_sort_record), run_ends, 1, d_test_array_sort_parallel_compare_record, 2) &&
+         (records[0].position == 0);
+
+    result = d_assert_standalone(
+        ok,
+        "merge_runs_single",
+        "A single run should be accepted and left as is",
+        _counter) && result;
+
+    // test 3: merge on four threads
+    ok = d_array_merge_runs_parallel(records, sizeof(struct d_test_array_sort_record), run_ends, 5, d_test_array_sort_parallel_compare_record, 4) &&
+         d_test_array_sort_parallel_stable_order(records, count);
+
+    result = d_assert_standalone(
+        ok,
+        "merge_runs_result",
+        "Runs should merge into key order with earlier runs first on ties",
+        _counter) && result;
+
+    free(records);
+
+    return result;
+}
+
+
+/*
+d_tests_sa_array_sort_parallel_all
+  Aggregation function that runs all parallel sort and merge tests.
+*/
+bool
+d_tests_sa_array_sort_parallel_all
+(
+    struct d_test_counter* _counter
+)
+{
+    bool result;
+
+    result = true;
+
+    printf("\n  [SECTION] Parallel Sort and Merge\n");
+    printf("  ---------------------------------\n");
+
+    result = d_tests_sa_array_sort_parallel_unstable(_counter) && result;
+    result = d_tests_sa_array_sort_parallel_stable(_counter) && result;
+    result = d_tests_sa_array_merge_runs_parallel(_counter) && result;
+
+    return result;
+}
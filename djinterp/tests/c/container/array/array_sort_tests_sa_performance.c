@@ -0,0 +1,280 @@
+#include "./array_sort_tests_sa.h"
+
+
+///////////////////////////////////////////////////////////////////////////////
+// file-scope helpers
+///////////////////////////////////////////////////////////////////////////////
+
+// d_test_array_sort_row
+//   struct: 24-byte record keyed by `key`, typical of sorted table rows.
+struct d_test_array_sort_row
+{
+    int64_t id;
+    int64_t key;
+    int64_t payload;
+};
+
+// helper: orders int64 values for qsort
+static int
+d_test_array_sort_perf_compare_int64
+(
+    const void* _a,
+    const void* _b
+)
+{
+    return (*(const int64_t*)_a > *(const int64_t*)_b) -
+           (*(const int64_t*)_a < *(const int64_t*)_b);
+}
+
+// helper: orders rows by key for qsort
+static int
+d_test_array_sort_perf_compare_row
+(
+    const void* _a,
+    const void* _b
+)
+{
+    const struct d_test_array_sort_row* a;
+    const struct d_test_array_sort_row* b;
+
+    a = (const struct d_test_array_sort_row*)_a;
+    b = (const struct d_test_array_sort_row*)_b;
+
+    return (a->key > b->key) - (a->key < b->key);
+}
+
+// helper: fills `_values` with a fixed pseudo-random sequence
+static void
+d_test_array_sort_perf_fill
+(
+    int64_t* _values,
+    size_t   _count
+)
+{
+    uint64_t state;
+    size_t   i;
+
+    state = 1;
+
+    for (i = 0; i < _count; i++)
+    {
+        state      = (state * 6364136223846793005ull) + 1ull;
+        _values[i] = (int64_t)(state ^ (state >> 31));
+    }
+
+    return;
+}
+
+// helper: true if int64 values are ascending
+static bool
+d_test_array_sort_perf_sorted
+(
+    const int64_t* _values,
+    size_t         _count
+)
+{
+    size_t i;
+
+    for (i = 1; i < _count; i++)
+    {
+        if (_values[i - 1] > _values[i])
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// helper: prints one timing line relative to the qsort baseline
+static void
+d_test_array_sort_perf_report
+(
+    const char* _label,
+    int64_t     _elapsed_us,
+    int64_t     _baseline_us
+)
+{
+    printf("      %-28s %9lld us  (%.2fx qsort)\n",
+           _label,
+           (long long)_elapsed_us,
+           (_elapsed_us > 0) ? (double)_baseline_us / (double)_elapsed_us : 0.0);
+
+    return;
+}
+
+
+/******************************************************************************
+ * IV. PERFORMANCE TESTS
+ *****************************************************************************/
+
+/*
+d_tests_sa_array_sort_performance
+  Times the sorts against qsort on D_TEST_ARRAY_SORT_BENCH_COUNT elements and
+prints the results. Only the sorted output is asserted; timings vary by
+machine and are informational.
+  Tests the following:
+  - int64 values: qsort, d_array_sort, d_array_sort_int64, radix, and
+    d_array_sort_parallel (unstable and stable, all hardware threads)
+  - 24-byte rows: qsort, d_array_sort, d_array_sort_keyed_int64
+*/
+bool
+d_tests_sa_array_sort_performance
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                          result;
+    int64_t*                      source;
+    int64_t*                      values;
+    struct d_test_array_sort_row* rows;
+    size_t                        count;
+    size_t                        i;
+    int64_t                       start;
+    int64_t                       baseline;
+    bool                          sorted;
+
+    result = true;
+    count  = D_TEST_ARRAY_SORT_BENCH_COUNT;
+    source = malloc(count * sizeof(int64_t));
+    values = malloc(count * sizeof(int64_t));
+    rows   = malloc(count * sizeof(struct d_test_array_sort_row));
+
+    if ( (!source) ||
+         (!values) ||
+         (!rows) )
+    {
+        free(source);
+        free(values);
+        free(rows);
+
+        return d_assert_standalone(false,
+                                   "performance_alloc",
+                                   "Allocation of benchmark buffers failed",
+                                   _counter);
+    }
+
+    d_test_array_sort_perf_fill(source, count);
+
+    printf("    %zu int64 values:\n", count);
+
+    memcpy(values, source, count * sizeof(int64_t));
+    start = d_monotonic_time_us();
+    qsort(values, count, sizeof(int64_t), d_test_array_sort_perf_compare_int64);
+    baseline = d_monotonic_time_us() - start;
+    d_test_array_sort_perf_report("qsort", baseline, baseline);
+
+    memcpy(values, source, count * sizeof(int64_t));
+    start = d_monotonic_time_us();
+    d_array_sort(values, count, sizeof(int64_t), d_test_array_sort_perf_compare_int64);
+    d_test_array_sort_perf_report("d_array_sort", d_monotonic_time_us() - start, baseline);
+    sorted = d_test_array_sort_perf_sorted(values, count);
+
+    memcpy(values, source, count * sizeof(int64_t));
+    start = d_monotonic_time_us();
+    d_array_sort_int64(values, count);
+    d_test_array_sort_perf_report("d_array_sort_int64", d_monotonic_time_us() - start, baseline);
+    sorted = d_test_array_sort_perf_sorted(values, count) && sorted;
+
+    memcpy(values, source, count * sizeof(int64_t));
+    start = d_monotonic_time_us();
+    d_array_radix_sort_int64(values, count);
+    d_test_array_sort_perf_report("d_array_radix_sort_int64", d_monotonic_time_us() - start, baseline);
+    sorted = d_test_array_sort_perf_sorted(values, count) && sorted;
+
+    memcpy(values, source, count * sizeof(int64_t));
+    start = d_monotonic_time_us();
+    d_array_sort_parallel(values, count, sizeof(int64_t), d_test_array_sort_perf_compare_int64, D_ARRAY_SORT_UNSTABLE, 0);
+    d_test_array_sort_perf_report("d_array_sort_parallel", d_monotonic_time_us() - start, baseline);
+    sorted = d_test_array_sort_perf_sorted(values, count) && sorted;
+
+    memcpy(values, source, count * sizeof(int64_t));
+    start = d_monotonic_time_us();
+    d_array_sort_parallel(values, count, sizeof(int64_t), d_test_array_sort_perf_compare_int64, D_ARRAY_SORT_STABLE, 0);
+    d_test_array_sort_perf_report("d_array_sort_parallel stable", d_monotonic_time_us() - start, baseline);
+    sorted = d_test_array_sort_perf_sorted(values, count) && sorted;
+
+    // test 1: all value sorts produced sorted output
+    result = d_assert_standalone(
+        sorted,
+        "performance_values",
+        "Every timed value sort should produce sorted output",
+        _counter) && result;
+
+    printf("    %zu 24-byte rows:\n", count);
+
+    for (i = 0; i < count; i++)
+    {
+        rows[i].id  = (int64_t)i;
+        rows[i].key = source[i];
+    }
+
+    start = d_monotonic_time_us();
+    qsort(rows, count, sizeof(struct d_test_array_sort_row), d_test_array_sort_perf_compare_row);
+    baseline = d_monotonic_time_us() - start;
+    d_test_array_sort_perf_report("qsort", baseline, baseline);
+
+    for (i = 0; i < count; i++)
+    {
+        rows[i].id  = (int64_t)i;
+        rows[i].key = source[i];
+    }
+
+    start = d_monotonic_time_us();
+    d_array_sort(rows, count, sizeof(struct d_test_array_sort_row), d_test_array_sort_perf_compare_row);
+    d_test_array_sort_perf_report("d_array_sort", d_monotonic_time_us() - start, baseline);
+
+    for (i = 0; i < count; i++)
+    {
+        rows[i].id  = (int64_t)i;
+        rows[i].key = source[i];
+    }
+
+    start  = d_monotonic_time_us();
+    sorted = d_array_sort_keyed_int64(rows,
+                                      count,
+                                      sizeof(struct d_test_array_sort_row),
+                                      offsetof(struct d_test_array_sort_row, key));
+    d_test_array_sort_perf_report("d_array_sort_keyed_int64", d_monotonic_time_us() - start, baseline);
+
+    for (i = 1; (sorted) && (i < count); i++)
+    {
+        sorted = (rows[i - 1].key <= rows[i].key);
+    }
+
+    // test 2: keyed rows sorted
+    result = d_assert_standalone(
+        sorted,
+        "performance_rows",
+        "The keyed row sort should produce sorted output",
+        _counter) && result;
+
+    free(source);
+    free(values);
+    free(rows);
+
+    return result;
+}
+
+
+/*
+d_tests_sa_array_sort_performance_all
+  Aggregation function that runs all performance tests.
+*/
+bool
+d_tests_sa_array_sort_performance_all
+(
+    struct d_test_counter* _counter
+)
+{
+    bool result;
+
+    result = true;
+
+    printf("\n  [SECTION] Performance (vs qsort)\n");
+    printf("  --------------------------------\n");
+
+    result = d_tests_sa_array_sort_performance(_counter) && result;
+
+    return result;
+}
@@ -0,0 +1,478 @@
+#include "./array_sort_tests_sa.h"
+
+
+///////////////////////////////////////////////////////////////////////////////
+// file-scope helpers
+///////////////////////////////////////////////////////////////////////////////
+
+#define D_TEST_ARRAY_SORT_TYPED_COUNT 5000
+
+// d_test_array_sort_record
+//   struct: record sorted by one of its members; `seq` checks stability.
+struct d_test_array_sort_record
+{
+    uint32_t seq;
+    double   weight;
+    int64_t  key;
+};
+
+// helper: deterministic pseudo-random 64-bit sequence
+static uint64_t
+d_test_array_sort_next64
+(
+    uint64_t* _state
+)
+{
+    *_state = (*_state * 6364136223846793005ull) + 1442695040888963407ull;
+
+    return *_state ^ (*_state >> 29);
+}
+
+// helper: orders int64 values for qsort
+static int
+d_test_array_sort_compare_int64
+(
+    const void* _a,
+    const void* _b
+)
+{
+    return (*(const int64_t*)_a > *(const int64_t*)_b) -
+           (*(const int64_t*)_a < *(const int64_t*)_b);
+}
+
+// helper: orders uint32 values for qsort
+static int
+d_test_array_sort_compare_uint32
+(
+    const void* _a,
+    const void* _b
+)
+{
+    return (*(const uint32_t*)_a > *(const uint32_t*)_b) -
+           (*(const uint32_t*)_a < *(const uint32_t*)_b);
+}
+
+// helper: true if a double array is in total order (NaNs at the ends)
+static bool
+d_test_array_sort_is_total_order
+(
+    const double* _values,
+    size_t        _count
+)
+{
+    size_t i;
+
+    for (i = 1; i < _count; i++)
+    {
+        double a = _values[i - 1];
+        double b = _values[i];
+
+        // a NaN may only be followed by a NaN of the same sign
+        if (isnan(a))
+        {
+            if ( (!signbit(a)) &&
+                 (!isnan(b)) )
+            {
+                return false;
+            }
+
+            continue;
+        }
+
+        if ( (isnan(b)) &&
+             (signbit(b)) )
+        {
+            return false;
+        }
+
+        if ( (!isnan(b)) &&
+             ( (a > b) ||
+               ( (a == 0.0) && (b == 0.0) && (!signbit(a)) && (signbit(b)) ) ) )
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+
+/******************************************************************************
+ * II. TYPED, RADIX AND KEYED SORT TESTS
+ *****************************************************************************/
+
+/*
+d_tests_sa_array_sort_typed_int
+  Tests the generated integer comparison sorts.
+  Tests the following:
+  - int64 and uint32 sorts match qsort, including extreme values
+  - int32 negatives sort before positives; uint64 top bit sorts last
+  - NULL and tiny inputs
+*/
+bool
+d_tests_sa_array_sort_typed_int
+(
+    struct d_test_counter* _counter
+)
+{
+    bool      result;
+    int64_t   signed_values[D_TEST_ARRAY_SORT_TYPED_COUNT];
+    int64_t   signed_reference[D_TEST_ARRAY_SORT_TYPED_COUNT];
+    uint32_t  unsigned_values[D_TEST_ARRAY_SORT_TYPED_COUNT];
+    uint32_t  unsigned_reference[D_TEST_ARRAY_SORT_TYPED_COUNT];
+    int32_t   small[6] = { 5, -7, INT32_MAX, 0, INT32_MIN, -1 };
+    uint64_t  wide[4]  = { UINT64_MAX, 1, (uint64_t)1 << 63, 0 };
+    uint64_t  state;
+    size_t    i;
+
+    result = true;
+    state  = 3;
+
+    for (i = 0; i < D_TEST_ARRAY_SORT_TYPED_COUNT; i++)
+    {
+        signed_values[i]   = (int64_t)d_test_array_sort_next64(&state);
+        unsigned_values[i] = (uint32_t)d_test_array_sort_next64(&state) % 1000u;
+    }
+
+    signed_values[0] = INT64_MIN;
+    signed_values[1] = INT64_MAX;
+
+    memcpy(signed_reference, signed_values, sizeof(signed_values));
+    memcpy(unsigned_reference, unsigned_values, sizeof(unsigned_values));
+
+    d_array_sort_int64(signed_values, D_TEST_ARRAY_SORT_TYPED_COUNT);
+    d_array_sort_uint32(unsigned_values, D_TEST_ARRAY_SORT_TYPED_COUNT);
+    qsort(signed_reference,
+          D_TEST_ARRAY_SORT_TYPED_COUNT,
+          sizeof(int64_t),
+          d_test_array_sort_compare_int64);
+    qsort(unsigned_reference,
+          D_TEST_ARRAY_SORT_TYPED_COUNT,
+          sizeof(uint32_t),
+          d_test_array_sort_compare_uint32);
+
+    // test 1: agreement with qsort
+    result = d_assert_standalone(
+        (memcmp(signed_values, signed_reference, sizeof(signed_values)) == 0) &&
+        (memcmp(unsigned_values, unsigned_reference, sizeof(unsigned_values)) == 0),
+        "typed_int_qsort",
+        "Typed integer sorts should match qsort",
+        _counter) && result;
+
+    d_array_sort_int32(small, 6);
+    d_array_sort_uint64(wide, 4);
+
+    // test 2: sign handling
+    result = d_assert_standalone(
+        (small[0] == INT32_MIN) &&
+        (small[1] == -7) &&
+        (small[2] == -1) &&
+        (small[5] == INT32_MAX) &&
+        (wide[0] == 0) &&
+        (wide[2] == ((uint64_t)1 << 63)) &&
+        (wide[3] == UINT64_MAX),
+        "typed_int_sign",
+        "Signed and unsigned orders should be respected",
+        _counter) && result;
+
+    // test 3: NULL input
+    d_array_sort_int32(NULL, 5);
+    d_array_sort_int32(small, 0);
+
+    result = d_assert_standalone(
+        small[0] == INT32_MIN,
+        "typed_int_null",
+        "NULL and empty inputs should be ignored",
+        _counter) && result;
+
+    return result;
+}
+
+
+/*
+d_tests_sa_array_sort_typed_float
+  Tests the generated floating-point sorts.
+  Tests the following:
+  - signed zeros, infinities and NaNs land in IEEE total order
+  - large random double arrays are ordered
+  - float sort
+*/
+bool
+d_tests_sa_array_sort_typed_float
+(
+    struct d_test_counter* _counter
+)
+{
+    bool     result;
+    double   specials[8];
+    double   values[D_TEST_ARRAY_SORT_TYPED_COUNT];
+    float    floats[5] = { 2.5f, -1.0f, 0.0f, -3.25f, 1.0f };
+    uint64_t state;
+    size_t   i;
+
+    result      = true;
+    state       = 11;
+    specials[0] = NAN;
+    specials[1] = 1.0;
+    specials[2] = -0.0;
+    specials[3] = -INFINITY;
+    specials[4] = 0.0;
+    specials[5] = -NAN;
+    specials[6] = INFINITY;
+    specials[7] = -2.0;
+
+    d_array_sort_double(specials, 8);
+
+    // test 1: total order of special values
+    result = d_assert_standalone(
+        (isnan(specials[0])) &&
+        (signbit(specials[0])) &&
+        (specials[1] == -INFINITY) &&
+        (specials[2] == -2.0) &&
+        (specials[3] == 0.0) && (signbit(specials[3])) &&
+        (specials[4] == 0.0) && (!signbit(specials[4])) &&
+        (specials[5] == 1.0) &&
+        (specials[6] == INFINITY) &&
+        (isnan(specials[7])) &&
+        (!signbit(specials[7])),
+        "typed_float_specials",
+        "-NaN, -inf, -2, -0, +0, 1, +inf, +NaN expected",
+        _counter) && result;
+
+    for (i = 0; i < D_TEST_ARRAY_SORT_TYPED_COUNT; i++)
+    {
+        values[i] = ((double)(int64_t)d_test_array_sort_next64(&state)) / 1e9;
+    }
+
+    values[10] = NAN;
+    values[20] = -0.0;
+
+    d_array_sort_double(values, D_TEST_ARRAY_SORT_TYPED_COUNT);
+
+    // test 2: random doubles
+    result = d_assert_standalone(
+        d_test_array_sort_is_total_order(values, D_TEST_ARRAY_SORT_TYPED_COUNT),
+        "typed_float_random",
+        "Random doubles should be in total order",
+        _counter) && result;
+
+    d_array_sort_float(floats, 5);
+
+    // test 3: floats
+    result = d_assert_standalone(
+        (floats[0] == -3.25f) &&
+        (floats[1] == -1.0f) &&
+        (floats[2] == 0.0f) &&
+        (floats[4] == 2.5f),
+        "typed_float_float",
+        "Floats should be sorted",
+        _counter) && result;
+
+    return result;
+}
+
+
+/*
+d_tests_sa_array_sort_radix
+  Tests the generated LSD radix sorts.
+  Tests the following:
+  - each radix sort agrees with the comparison sort of the same type
+  - inputs below the radix threshold
+  - inputs whose keys share their upper bytes (skipped passes)
+*/
+bool
+d_tests_sa_array_sort_radix
+(
+    struct d_test_counter* _counter
+)
+{
+    bool     result;
+    int64_t  a64[D_TEST_ARRAY_SORT_TYPED_COUNT];
+    int64_t  b64[D_TEST_ARRAY_SORT_TYPED_COUNT];
+    uint32_t a32[D_TEST_ARRAY_SORT_TYPED_COUNT];
+    uint32_t b32[D_TEST_ARRAY_SORT_TYPED_COUNT];
+    double   ad[D_TEST_ARRAY_SORT_TYPED_COUNT];
+    double   bd[D_TEST_ARRAY_SORT_TYPED_COUNT];
+    uint64_t state;
+    size_t   i;
+
+    result = true;
+    state  = 5;
+
+    for (i = 0; i < D_TEST_ARRAY_SORT_TYPED_COUNT; i++)
+    {
+        a64[i] = (int64_t)d_test_array_sort_next64(&state);
+        a32[i] = (uint32_t)d_test_array_sort_next64(&state);
+        ad[i]  = ((double)(int64_t)d_test_array_sort_next64(&state)) / 1e12;
+    }
+
+    ad[3] = -0.0;
+    ad[4] = NAN;
+    ad[5] = -INFINITY;
+
+    memcpy(b64, a64, sizeof(a64));
+    memcpy(b32, a32, sizeof(a32));
+    memcpy(bd, ad, sizeof(ad));
+
+    d_array_radix_sort_int64(a64, D_TEST_ARRAY_SORT_TYPED_COUNT);
+    d_array_radix_sort_uint32(a32, D_TEST_ARRAY_SORT_TYPED_COUNT);
+    d_array_radix_sort_double(ad, D_TEST_ARRAY_SORT_TYPED_COUNT);
+    d_array_sort_int64(b64, D_TEST_ARRAY_SORT_TYPED_COUNT);
+    d_array_sort_uint32(b32, D_TEST_ARRAY_SORT_TYPED_COUNT);
+    d_array_sort_double(bd, D_TEST_ARRAY_SORT_TYPED_COUNT);
+
+    // test 1: agreement with the comparison sorts (bitwise, so NaN and -0
+    // positions are compared too)
+    result = d_assert_standalone(
+        (memcmp(a64, b64, sizeof(a64)) == 0) &&
+        (memcmp(a32, b32, sizeof(a32)) == 0) &&
+        (memcmp(ad, bd, sizeof(ad)) == 0),
+        "radix_agrees",
+        "Radix sorts should match the comparison sorts",
+        _counter) && result;
+
+    // test 2: small input handed to the comparison sort
+    a64[0] = 3;
+    a64[1] = -3;
+    a64[2] = 0;
+    d_array_radix_sort_int64(a64, 3);
+
+    result = d_assert_standalone(
+        (a64[0] == -3) &&
+        (a64[1] == 0) &&
+        (a64[2] == 3),
+        "radix_small",
+        "Inputs below the threshold should be sorted",
+        _counter) && result;
+
+    // test 3: narrow keys, most passes skipped
+    for (i = 0; i < D_TEST_ARRAY_SORT_TYPED_COUNT; i++)
+    {
+        a64[i] = 1000000 + (int64_t)((i * 7919) % 300);
+        b64[i] = a64[i];
+    }
+
+    d_array_radix_sort_int64(a64, D_TEST_ARRAY_SORT_TYPED_COUNT);
+    d_array_sort_int64(b64, D_TEST_ARRAY_SORT_TYPED_COUNT);
+
+    result = d_assert_standalone(
+        memcmp(a64, b64, sizeof(a64)) == 0,
+        "radix_narrow_keys",
+        "Keys sharing their upper bytes should sort",
+        _counter) && result;
+
+    return result;
+}
+
+
+/*
+d_tests_sa_array_sort_keyed
+  Tests the keyed record sorts.
+  Tests the following:
+  - records sorted by an int64 member are stable
+  - records sorted by a double member through the runtime dispatcher
+  - invalid key placement and key types are rejected
+*/
+bool
+d_tests_sa_array_sort_keyed
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                            result;
+    struct d_test_array_sort_record records[D_TEST_ARRAY_SORT_TYPED_COUNT];
+    uint64_t                        state;
+    size_t                          i;
+    bool                            stable;
+
+    result = true;
+    state  = 17;
+
+    for (i = 0; i < D_TEST_ARRAY_SORT_TYPED_COUNT; i++)
+    {
+        records[i].seq    = (uint32_t)i;
+        records[i].key    = (int64_t)(d_test_array_sort_next64(&state) % 64) - 32;
+        records[i].weight = (double)(int64_t)(d_test_array_sort_next64(&state) % 2001) - 1000.0;
+    }
+
+    // test 1: stable int64 key
+    stable = d_array_sort_keyed_int64(records,
+                                      D_TEST_ARRAY_SORT_TYPED_COUNT,
+                                      sizeof(struct d_test_array_sort_record),
+                                      offsetof(struct d_test_array_sort_record, key));
+
+    for (i = 1; (stable) && (i < D_TEST_ARRAY_SORT_TYPED_COUNT); i++)
+    {
+        stable = (records[i - 1].key < records[i].key) ||
+                 ( (records[i - 1].key == records[i].key) &&
+                   (records[i - 1].seq < records[i].seq) );
+    }
+
+    result = d_assert_standalone(
+        stable,
+        "keyed_stable",
+        "Records should be ordered by key with ties in input order",
+        _counter) && result;
+
+    // test 2: runtime dispatch on a double member
+    stable = d_array_sort_keyed(records,
+                                D_TEST_ARRAY_SORT_TYPED_COUNT,
+                                sizeof(struct d_test_array_sort_record),
+                                D_ARRAY_SORT_KEY_DOUBLE,
+                                offsetof(struct d_test_array_sort_record, weight));
+
+    for (i = 1; (stable) && (i < D_TEST_ARRAY_SORT_TYPED_COUNT); i++)
+    {
+        // stability: within equal weights the previous key order survives
+        stable = (records[i - 1].weight < records[i].weight) ||
+                 ( (records[i - 1].weight == records[i].weight) &&
+                   (records[i - 1].key <= records[i].key) );
+    }
+
+    result = d_assert_standalone(
+        stable,
+        "keyed_dispatch_double",
+        "Dispatching on a double key should sort stably",
+        _counter) && result;
+
+    // test 3: invalid arguments
+    result = d_assert_standalone(
+        (!d_array_sort_keyed_int64(records, 2, 4, 0)) &&
+        (!d_array_sort_keyed_int64(records, 2, sizeof(struct d_test_array_sort_record),
+                                   sizeof(struct d_test_array_sort_record) - 4)) &&
+        (!d_array_sort_keyed_int64(NULL, 2, sizeof(struct d_test_array_sort_record), 0)) &&
+        (!d_array_sort_keyed(records, 2, sizeof(struct d_test_array_sort_record),
+                             (enum d_array_sort_key)99, 0)) &&
+        (d_array_sort_keyed_int64(records, 1, sizeof(struct d_test_array_sort_record), 0)),
+        "keyed_invalid",
+        "Keys outside the record and unknown key types should be rejected",
+        _counter) && result;
+
+    return result;
+}
+
+
+/*
+d_tests_sa_array_sort_typed_all
+  Aggregation function that runs all typed, radix and keyed sort tests.
+*/
+bool
+d_tests_sa_array_sort_typed_all
+(
+    struct d_test_counter* _counter
+)
+{
+    bool result;
+
+    result = true;
+
+    printf("\n  [SECTION] Typed, Radix and Keyed Sorts\n");
+    printf("  --------------------------------------\n");
+
+    result = d_tests_sa_array_sort_typed_int(_counter) && result;
+    result = d_tests_sa_array_sort_typed_float(_counter) && result;
+    result = d_tests_sa_array_sort_radix(_counter) && result;
+    result = d_tests_sa_array_sort_keyed(_counter) && result;
+
+    return result;
+}
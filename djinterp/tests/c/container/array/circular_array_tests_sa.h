@@ -28,6 +28,7 @@
  *****************************************************************************/
 bool d_tests_sa_circular_array_new(struct d_test_counter* _counter);
 bool d_tests_sa_circular_array_new_default_capacity(struct d_test_counter* _counter);
+bool d_tests_sa_circular_array_new_pow2(struct d_test_counter* _counter);
 bool d_tests_sa_circular_array_new_from_arr(struct d_test_counter* _counter);
 bool d_tests_sa_circular_array_new_from_args(struct d_test_counter* _counter);
 bool d_tests_sa_circular_array_new_copy(struct d_test_counter* _counter);
@@ -64,6 +65,8 @@ bool d_tests_sa_circular_array_pop(struct d_test_counter* _counter);
 bool d_tests_sa_circular_array_pop_front(struct d_test_counter* _counter);
 bool d_tests_sa_circular_array_pop_back(struct d_test_counter* _counter);
 bool d_tests_sa_circular_array_pop_to(struct d_test_counter* _counter);
+bool d_tests_sa_circular_array_pop_all_to(struct d_test_counter* _counter);
+bool d_tests_sa_circular_array_bulk_wrap(struct d_test_counter* _counter);
 bool d_tests_sa_circular_array_push_overwrite(struct d_test_counter* _counter);
 
 // III. aggregation function
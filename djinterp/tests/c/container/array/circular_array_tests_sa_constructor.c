@@ -158,6 +158,80 @@ d_tests_sa_circular_array_new_default_capacity
 }
 
 
+/*
+d_tests_sa_circular_array_new_pow2
+  Tests the d_circular_array_new_pow2 function.
+  Tests the following:
+  - capacity rounds up to a power of two and sets the mask
+  - an exact power of two is kept
+  - a non-power-of-two capacity from d_circular_array_new has no mask
+  - zero capacity and overflowing capacity return NULL
+*/
+bool
+d_tests_sa_circular_array_new_pow2
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                      result;
+    struct d_circular_array*  arr;
+
+    result = true;
+
+    // test 1: rounds 5 up to 8
+    arr = d_circular_array_new_pow2(5, sizeof(int));
+
+    if (arr)
+    {
+        result = d_assert_standalone(
+            (arr->capacity == 8) && (arr->mask == 7),
+            "new_pow2_round_up",
+            "Capacity 5 should round up to 8 with mask 7",
+            _counter) && result;
+
+        d_circular_array_free(arr);
+    }
+
+    // test 2: exact power of two is kept
+    arr = d_circular_array_new_pow2(16, sizeof(int));
+
+    if (arr)
+    {
+        result = d_assert_standalone(
+            (arr->capacity == 16) && (arr->mask == 15),
+            "new_pow2_exact",
+            "Capacity 16 should stay 16 with mask 15",
+            _counter) && result;
+
+        d_circular_array_free(arr);
+    }
+
+    // test 3: other capacities wrap without a mask
+    arr = d_circular_array_new(5, sizeof(int));
+
+    if (arr)
+    {
+        result = d_assert_standalone(
+            arr->mask == 0,
+            "new_pow2_no_mask",
+            "Capacity 5 from d_circular_array_new should have no mask",
+            _counter) && result;
+
+        d_circular_array_free(arr);
+    }
+
+    // test 4: invalid capacities
+    result = d_assert_standalone(
+        (d_circular_array_new_pow2(0, sizeof(int)) == NULL) &&
+        (d_circular_array_new_pow2(SIZE_MAX, sizeof(int)) == NULL),
+        "new_pow2_invalid",
+        "Zero or overflowing capacity should return NULL",
+        _counter) && result;
+
+    return result;
+}
+
+
 /*
 d_tests_sa_circular_array_new_from_arr
   Tests the d_circular_array_new_from_arr function.
@@ -687,6 +761,7 @@ d_tests_sa_circular_array_constructor_all
 
     result = d_tests_sa_circular_array_new(_counter) && result;
     result = d_tests_sa_circular_array_new_default_capacity(_counter) && result;
+    result = d_tests_sa_circular_array_new_pow2(_counter) && result;
     result = d_tests_sa_circular_array_new_from_arr(_counter) && result;
     result = d_tests_sa_circular_array_new_from_args(_counter) && result;
     result = d_tests_sa_circular_array_new_copy(_counter) && result;
@@ -644,6 +644,168 @@ d_tests_sa_circular_array_pop_to
 }
 
 
+/*
+d_tests_sa_circular_array_pop_all_to
+  Tests the d_circular_array_pop_all_to function.
+  Tests the following:
+  - pops several elements oldest first
+  - popping more than stored fails and leaves the array unchanged
+  - NULL array and NULL output fail
+*/
+bool
+d_tests_sa_circular_array_pop_all_to
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                      result;
+    struct d_circular_array*  arr;
+    int                       values[] = {10, 20, 30, 40};
+    int                       out[4]   = {0, 0, 0, 0};
+
+    result = true;
+
+    arr = d_circular_array_new(5, sizeof(int));
+
+    if (arr)
+    {
+        d_circular_array_push_all(arr, values, 4);
+
+        // test 1: pop three elements
+        result = d_assert_standalone(
+            d_circular_array_pop_all_to(arr, out, 3) &&
+            (out[0] == 10) && (out[1] == 20) && (out[2] == 30),
+            "pop_all_to_values",
+            "Should pop 10, 20, 30 in order",
+            _counter) && result;
+
+        result = d_assert_standalone(
+            (arr->count == 1) && (*(int*)d_circular_array_front(arr) == 40),
+            "pop_all_to_remaining",
+            "One element (40) should remain",
+            _counter) && result;
+
+        // test 2: more than stored
+        result = d_assert_standalone(
+            !d_circular_array_pop_all_to(arr, out, 2) && (arr->count == 1),
+            "pop_all_to_underflow",
+            "Popping more than stored should fail without change",
+            _counter) && result;
+
+        // test 3: NULL output
+        result = d_assert_standalone(
+            !d_circular_array_pop_all_to(arr, NULL, 1),
+            "pop_all_to_null_out",
+            "NULL output should fail",
+            _counter) && result;
+
+        d_circular_array_free(arr);
+    }
+
+    // test 4: NULL array
+    result = d_assert_standalone(
+        !d_circular_array_pop_all_to(NULL, out, 1),
+        "pop_all_to_null",
+        "Pop all from NULL should fail",
+        _counter) && result;
+
+    return result;
+}
+
+
+/*
+d_tests_sa_circular_array_bulk_wrap
+  Tests bulk pushes and pops whose range wraps past the end of the buffer,
+for both a masked (power-of-two) and an unmasked capacity.
+  Tests the following:
+  - push_all split across the end of the buffer keeps order
+  - pop_all_to split across the end of the buffer keeps order
+  - push_all_front and push_all_overwrite across the end
+*/
+bool
+d_tests_sa_circular_array_bulk_wrap
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                      result;
+    struct d_circular_array*  arr;
+    size_t                    capacities[2] = {8, 7};
+    size_t                    c;
+    int                       values[8]     = {1, 2, 3, 4, 5, 6, 7, 8};
+    int                       out[8];
+    int                       front[2]      = {-2, -1};
+    bool                      ok;
+    size_t                    i;
+
+    result = true;
+
+    for (c = 0; c < 2; c++)
+    {
+        arr = d_circular_array_new(capacities[c], sizeof(int));
+
+        if (!arr)
+        {
+            continue;
+        }
+
+        // move head near the end so the next push wraps
+        d_circular_array_push_all(arr, values, 5);
+        d_circular_array_pop_all_to(arr, out, 5);
+        d_circular_array_push_all(arr, values, 6);
+
+        ok = (arr->count == 6) && (arr->head == 5);
+
+        for (i = 0; (ok) && (i < 6); i++)
+        {
+            ok = (*(int*)d_circular_array_get(arr, (d_index)i) == values[i]);
+        }
+
+        // test 1: wrapped push keeps order
+        result = d_assert_standalone(
+            ok,
+            (c == 0) ? "bulk_wrap_push_pow2" : "bulk_wrap_push_odd",
+            "Wrapped push_all should keep logical order",
+            _counter) && result;
+
+        // test 2: wrapped pop keeps order
+        ok = d_circular_array_pop_all_to(arr, out, 6);
+
+        for (i = 0; (ok) && (i < 6); i++)
+        {
+            ok = (out[i] == values[i]);
+        }
+
+        result = d_assert_standalone(
+            ok && (arr->count == 0),
+            (c == 0) ? "bulk_wrap_pop_pow2" : "bulk_wrap_pop_odd",
+            "Wrapped pop_all_to should return elements oldest first",
+            _counter) && result;
+
+        // test 3: push_all_front wrapping below slot 0, then overwrite
+        d_circular_array_clear(arr);
+        d_circular_array_push_all(arr, values, 3);
+        d_circular_array_push_all_front(arr, front, 2);
+        d_circular_array_push_all_overwrite(arr, values + 3, 4);
+
+        // logical contents: the last `capacity` of -2 -1 1 2 3 4 5 6 7
+        ok = (arr->count == capacities[c]) &&
+             (*(int*)d_circular_array_back(arr) == 7) &&
+             (*(int*)d_circular_array_front(arr) == ((c == 0) ? -1 : 1));
+
+        result = d_assert_standalone(
+            ok,
+            (c == 0) ? "bulk_wrap_front_pow2" : "bulk_wrap_front_odd",
+            "Front and overwriting bulk pushes should wrap correctly",
+            _counter) && result;
+
+        d_circular_array_free(arr);
+    }
+
+    return result;
+}
+
+
 /*
 d_tests_sa_circular_array_push_overwrite
   Tests the d_circular_array_push_overwrite function.
@@ -752,6 +914,8 @@ d_tests_sa_circular_array_modification_all
     result = d_tests_sa_circular_array_pop_front(_counter) && result;
     result = d_tests_sa_circular_array_pop_back(_counter) && result;
     result = d_tests_sa_circular_array_pop_to(_counter) && result;
+    result = d_tests_sa_circular_array_pop_all_to(_counter) && result;
+    result = d_tests_sa_circular_array_bulk_wrap(_counter) && result;
     result = d_tests_sa_circular_array_push_overwrite(_counter) && result;
 
     return result;
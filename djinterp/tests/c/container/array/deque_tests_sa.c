@@ -0,0 +1,28 @@
+#include "./deque_tests_sa.h"
+
+
+/*
+d_tests_sa_deque_run_all
+  Module-level aggregation function that runs all deque tests.
+  Executes tests for all categories:
+  - Constructor and element access functions
+  - Modification functions
+  - Bulk and conversion functions
+*/
+bool
+d_tests_sa_deque_run_all
+(
+    struct d_test_counter* _counter
+)
+{
+    bool result;
+
+    result = true;
+
+    // run all test categories
+    result = d_tests_sa_deque_access_all(_counter) && result;
+    result = d_tests_sa_deque_modification_all(_counter) && result;
+    result = d_tests_sa_deque_bulk_all(_counter) && result;
+
+    return result;
+}
@@ -0,0 +1,67 @@
+/******************************************************************************
+* djinterp [test]                                            deque_tests_sa.h
+*
+*   Unit test declarations for `deque.h` module.
+*   Covers construction, indexed access across block boundaries, pushing and
+* popping at both ends, address stability, block reuse under queue-style
+* churn, bulk append/prepend and range copy-out.
+*
+*
+* path:      /tests/container/array/deque_tests_sa.h
+* link(s):   TBA
+* author(s): Samuel 'teer' Neal-Blim                          date: 2026.10.18
+******************************************************************************/
+
+#ifndef DJINTERP_TESTS_DEQUE_SA_
+#define DJINTERP_TESTS_DEQUE_SA_ 1
+
+#include <stdlib.h>
+#include "../../../../inc/c/djinterp.h"
+#include "../../../../inc/c/dmemory.h"
+#include "../../../../inc/c/test/test_standalone.h"
+#include "../../../../inc/c/container/array/deque.h"
+
+
+/******************************************************************************
+ * I. CONSTRUCTOR AND ACCESS FUNCTION TESTS
+ *****************************************************************************/
+bool d_tests_sa_deque_new(struct d_test_counter* _counter);
+bool d_tests_sa_deque_new_from_arr(struct d_test_counter* _counter);
+bool d_tests_sa_deque_new_copy(struct d_test_counter* _counter);
+bool d_tests_sa_deque_get_set(struct d_test_counter* _counter);
+
+// I.   aggregation function
+bool d_tests_sa_deque_access_all(struct d_test_counter* _counter);
+
+
+/******************************************************************************
+ * II. MODIFICATION FUNCTION TESTS
+ *****************************************************************************/
+bool d_tests_sa_deque_push_pop_back(struct d_test_counter* _counter);
+bool d_tests_sa_deque_push_pop_front(struct d_test_counter* _counter);
+bool d_tests_sa_deque_stable_addresses(struct d_test_counter* _counter);
+bool d_tests_sa_deque_queue_churn(struct d_test_counter* _counter);
+
+// II.  aggregation function
+bool d_tests_sa_deque_modification_all(struct d_test_counter* _counter);
+
+
+/******************************************************************************
+ * III. BULK AND CONVERSION FUNCTION TESTS
+ *****************************************************************************/
+bool d_tests_sa_deque_append_prepend(struct d_test_counter* _counter);
+bool d_tests_sa_deque_pop_front_range(struct d_test_counter* _counter);
+bool d_tests_sa_deque_copy_to(struct d_test_counter* _counter);
+bool d_tests_sa_deque_clear_shrink(struct d_test_counter* _counter);
+
+// III. aggregation function
+bool d_tests_sa_deque_bulk_all(struct d_test_counter* _counter);
+
+
+/******************************************************************************
+ * MODULE-LEVEL AGGREGATION
+ *****************************************************************************/
+bool d_tests_sa_deque_run_all(struct d_test_counter* _counter);
+
+
+#endif  // DJINTERP_TESTS_DEQUE_SA_
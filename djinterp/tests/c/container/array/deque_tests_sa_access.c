@@ -0,0 +1,277 @@
+#include "./deque_tests_sa.h"
+
+
+/******************************************************************************
+ * I. CONSTRUCTOR AND ACCESS FUNCTION TESTS
+ *****************************************************************************/
+
+/*
+d_tests_sa_deque_new
+  Tests d_deque_new and d_deque_new_block_capacity.
+  Tests the following:
+  - a new deque is empty and allocates neither map nor blocks
+  - the block capacity is rounded up to a power of two
+  - a zero element size is rejected
+*/
+bool
+d_tests_sa_deque_new
+(
+    struct d_test_counter* _counter
+)
+{
+    bool            result;
+    struct d_deque* dq;
+
+    result = true;
+
+    // test 1: default construction
+    dq = d_deque_new(sizeof(int));
+
+    result = d_assert_standalone(
+        (dq != NULL) &&
+        (dq->count == 0) &&
+        (dq->map == NULL) &&
+        (d_deque_is_empty(dq)) &&
+        (d_deque_block_capacity(dq) == D_DEQUE_DEFAULT_BLOCK_CAPACITY),
+        "new_default",
+        "A new deque should be empty with nothing allocated",
+        _counter) && result;
+
+    d_deque_free(dq);
+
+    // test 2: block capacity rounding
+    dq = d_deque_new_block_capacity(5, sizeof(int));
+
+    result = d_assert_standalone(
+        (dq != NULL) &&
+        (d_deque_block_capacity(dq) == 8),
+        "new_block_capacity",
+        "Block capacity should be rounded up to a power of two",
+        _counter) && result;
+
+    d_deque_free(dq);
+
+    // test 3: invalid element size
+    result = d_assert_standalone(
+        d_deque_new(0) == NULL,
+        "new_zero_size",
+        "A zero element size should be rejected",
+        _counter) && result;
+
+    return result;
+}
+
+
+/*
+d_tests_sa_deque_new_from_arr
+  Tests the d_deque_new_from_arr function.
+  Tests the following:
+  - elements are copied in order across several blocks
+  - NULL source with a non-zero count is rejected
+*/
+bool
+d_tests_sa_deque_new_from_arr
+(
+    struct d_test_counter* _counter
+)
+{
+    bool            result;
+    struct d_deque* dq;
+    int             values[200];
+    bool            ordered;
+    int             i;
+
+    result = true;
+
+    for (i = 0; i < 200; i++)
+    {
+        values[i] = i * 3;
+    }
+
+    dq      = d_deque_new_from_arr(sizeof(int), values, 200);
+    ordered = (dq != NULL) && (dq->count == 200);
+
+    for (i = 0; (ordered) && (i < 200); i++)
+    {
+        ordered = (*(int*)d_deque_get(dq, i) == i * 3);
+    }
+
+    // test 1: copy across blocks
+    result = d_assert_standalone(
+        ordered && ((dq->map_end - dq->map_begin) == 4),
+        "new_from_arr_order",
+        "200 elements should occupy four blocks of 64 in order",
+        _counter) && result;
+
+    d_deque_free(dq);
+
+    // test 2: NULL source
+    result = d_assert_standalone(
+        d_deque_new_from_arr(sizeof(int), NULL, 4) == NULL,
+        "new_from_arr_null",
+        "A NULL source with a non-zero count should be rejected",
+        _counter) && result;
+
+    return result;
+}
+
+
+/*
+d_tests_sa_deque_new_copy
+  Tests the d_deque_new_copy function.
+  Tests the following:
+  - a copy of a deque whose first block is partly used holds the same
+    elements in the same order
+  - the copy is independent of the source
+*/
+bool
+d_tests_sa_deque_new_copy
+(
+    struct d_test_counter* _counter
+)
+{
+    bool            result;
+    struct d_deque* dq;
+    struct d_deque* copy;
+    bool            same;
+    int             value;
+    int             i;
+
+    result = true;
+    dq     = d_deque_new_block_capacity(4, sizeof(int));
+
+    // front-pushed elements leave the first block partly used
+    for (i = 0; i < 11; i++)
+    {
+        value = i;
+        d_deque_push_front(dq, &value);
+    }
+
+    copy = d_deque_new_copy(dq);
+    same = (copy != NULL) &&
+           (copy->count == 11) &&
+           (d_deque_block_capacity(copy) == 4);
+
+    for (i = 0; (same) && (i < 11); i++)
+    {
+        same = (*(int*)d_deque_get(copy, i) == *(int*)d_deque_get(dq, i));
+    }
+
+    // test 1: same contents
+    result = d_assert_standalone(
+        same,
+        "new_copy_contents",
+        "The copy should hold the same elements in order",
+        _counter) && result;
+
+    // test 2: independence
+    value = -1;
+    d_deque_set(copy, 0, &value);
+
+    result = d_assert_standalone(
+        (*(int*)d_deque_front(dq) == 10),
+        "new_copy_independent",
+        "Changing the copy should not change the source",
+        _counter) && result;
+
+    d_deque_free(copy);
+    d_deque_free(dq);
+
+    result = d_assert_standalone(
+        d_deque_new_copy(NULL) == NULL,
+        "new_copy_null",
+        "Copying NULL should return NULL",
+        _counter) && result;
+
+    return result;
+}
+
+
+/*
+d_tests_sa_deque_get_set
+  Tests d_deque_get, d_deque_set, d_deque_front and d_deque_back.
+  Tests the following:
+  - positive and negative indices
+  - out-of-range and empty-deque access returns NULL / false
+*/
+bool
+d_tests_sa_deque_get_set
+(
+    struct d_test_counter* _counter
+)
+{
+    bool            result;
+    struct d_deque* dq;
+    int             value;
+    int             i;
+
+    result = true;
+    dq     = d_deque_new_block_capacity(4, sizeof(int));
+
+    // test 1: empty deque
+    result = d_assert_standalone(
+        (d_deque_get(dq, 0) == NULL) &&
+        (d_deque_front(dq) == NULL) &&
+        (d_deque_back(dq) == NULL),
+        "get_empty",
+        "Access on an empty deque should return NULL",
+        _counter) && result;
+
+    for (i = 0; i < 10; i++)
+    {
+        d_deque_push_back(dq, &i);
+    }
+
+    // test 2: indexed access
+    result = d_assert_standalone(
+        (*(int*)d_deque_get(dq, 5) == 5) &&
+        (*(int*)d_deque_get(dq, -1) == 9) &&
+        (*(int*)d_deque_front(dq) == 0) &&
+        (*(int*)d_deque_back(dq) == 9) &&
+        (d_deque_get(dq, 10) == NULL),
+        "get_index",
+        "Positive and negative indices should resolve across blocks",
+        _counter) && result;
+
+    // test 3: set
+    value = 42;
+
+    result = d_assert_standalone(
+        (d_deque_set(dq, -2, &value)) &&
+        (*(int*)d_deque_get(dq, 8) == 42) &&
+        (!d_deque_set(dq, 10, &value)) &&
+        (!d_deque_set(dq, 0, NULL)),
+        "set_index",
+        "Set should write in range and reject invalid calls",
+        _counter) && result;
+
+    d_deque_free(dq);
+
+    return result;
+}
+
+
+/*
+d_tests_sa_deque_access_all
+  Aggregation function that runs all constructor and access tests.
+*/
+bool
+d_tests_sa_deque_access_all
+(
+    struct d_test_counter* _counter
+)
+{
+    bool result;
+
+    result = true;
+
+    printf("\n  [SECTION] Constructor and Access Functions\n");
+    printf("  ------------------------------------------\n");
+
+    result = d_tests_sa_deque_new(_counter) && result;
+    result = d_tests_sa_deque_new_from_arr(_counter) && result;
+    result = d_tests_sa_deque_new_copy(_counter) && result;
+    result = d_tests_sa_deque_get_set(_counter) && result;
+
+    return result;
+}
@@ -0,0 +1,303 @@
+#include "./deque_tests_sa.h"
+
+
+/******************************************************************************
+ * III. BULK AND CONVERSION FUNCTION TESTS
+ *****************************************************************************/
+
+/*
+d_tests_sa_deque_append_prepend
+  Tests d_deque_append and d_deque_prepend.
+  Tests the following:
+  - append fills the last partial block and adds new ones
+  - prepend keeps the order of its input ahead of the existing elements
+  - empty and invalid calls
+*/
+bool
+d_tests_sa_deque_append_prepend
+(
+    struct d_test_counter* _counter
+)
+{
+    bool            result;
+    struct d_deque* dq;
+    int             values[40];
+    bool            ordered;
+    int             i;
+
+    result = true;
+    dq     = d_deque_new_block_capacity(8, sizeof(int));
+
+    for (i = 0; i < 40; i++)
+    {
+        values[i] = i;
+    }
+
+    // [20 .. 39] in two appends, then [0 .. 19] in two prepends
+    d_deque_append(dq, values + 20, 3);
+    d_deque_append(dq, values + 23, 17);
+    d_deque_prepend(dq, values + 15, 5);
+    d_deque_prepend(dq, values, 15);
+
+    ordered = (dq->count == 40);
+
+    for (i = 0; (ordered) && (i < 40); i++)
+    {
+        ordered = (*(int*)d_deque_get(dq, i) == i);
+    }
+
+    // test 1: order
+    result = d_assert_standalone(
+        ordered,
+        "append_prepend_order",
+        "Bulk inserts at both ends should give 0 .. 39",
+        _counter) && result;
+
+    // test 2: empty and invalid calls
+    result = d_assert_standalone(
+        (d_deque_append(dq, NULL, 0)) &&
+        (d_deque_prepend(dq, NULL, 0)) &&
+        (!d_deque_append(dq, NULL, 1)) &&
+        (!d_deque_prepend(NULL, values, 1)) &&
+        (dq->count == 40),
+        "append_prepend_invalid",
+        "Empty inserts should succeed and invalid ones fail",
+        _counter) && result;
+
+    d_deque_free(dq);
+
+    return result;
+}
+
+
+/*
+d_tests_sa_deque_pop_front_range
+  Tests the d_deque_pop_front_range_to function.
+  Tests the following:
+  - a batch spanning several blocks is copied out in order
+  - the remaining elements are unaffected
+  - requesting more than the count fails without changes
+*/
+bool
+d_tests_sa_deque_pop_front_range
+(
+    struct d_test_counter* _counter
+)
+{
+    bool            result;
+    struct d_deque* dq;
+    int             out[30];
+    bool            ordered;
+    int             i;
+
+    result = true;
+    dq     = d_deque_new_block_capacity(4, sizeof(int));
+
+    for (i = 0; i < 50; i++)
+    {
+        d_deque_push_back(dq, &i);
+    }
+
+    d_deque_pop_front_to(dq, NULL);
+
+    ordered = d_deque_pop_front_range_to(dq, out, 30);
+
+    for (i = 0; (ordered) && (i < 30); i++)
+    {
+        ordered = (out[i] == i + 1);
+    }
+
+    // test 1: batch contents
+    result = d_assert_standalone(
+        ordered &&
+        (dq->count == 19) &&
+        (*(int*)d_deque_front(dq) == 31) &&
+        ((dq->map_end - dq->map_begin) == 6),
+        "pop_front_range",
+        "A batch pop should copy out in order and release drained blocks",
+        _counter) && result;
+
+    // test 2: too many
+    result = d_assert_standalone(
+        (!d_deque_pop_front_range_to(dq, out, 20)) &&
+        (dq->count == 19) &&
+        (d_deque_pop_front_range_to(dq, NULL, 19)) &&
+        (d_deque_is_empty(dq)),
+        "pop_front_range_bounds",
+        "Popping more than the count should fail without changes",
+        _counter) && result;
+
+    d_deque_free(dq);
+
+    return result;
+}
+
+
+/*
+d_tests_sa_deque_copy_to
+  Tests d_deque_copy_to and d_deque_to_linear_array.
+  Tests the following:
+  - a range that starts and ends inside blocks is copied in order
+  - out-of-range requests fail
+  - the linear copy matches the deque
+*/
+bool
+d_tests_sa_deque_copy_to
+(
+    struct d_test_counter* _counter
+)
+{
+    bool            result;
+    struct d_deque* dq;
+    int             out[20];
+    int*            linear;
+    bool            ordered;
+    int             value;
+    int             i;
+
+    result = true;
+    dq     = d_deque_new_block_capacity(4, sizeof(int));
+
+    // -3 .. 29 with the first block partly used
+    for (i = 0; i < 30; i++)
+    {
+        d_deque_push_back(dq, &i);
+    }
+
+    for (i = 1; i <= 3; i++)
+    {
+        value = -i;
+        d_deque_push_front(dq, &value);
+    }
+
+    ordered = d_deque_copy_to(dq, 2, 20, out);
+
+    for (i = 0; (ordered) && (i < 20); i++)
+    {
+        ordered = (out[i] == i - 1);
+    }
+
+    // test 1: range
+    result = d_assert_standalone(
+        ordered,
+        "copy_to_range",
+        "Range copy should cross block boundaries in order",
+        _counter) && result;
+
+    // test 2: bounds
+    result = d_assert_standalone(
+        (!d_deque_copy_to(dq, 30, 4, out)) &&
+        (!d_deque_copy_to(dq, 0, 1, NULL)) &&
+        (d_deque_copy_to(dq, 33, 0, out)),
+        "copy_to_bounds",
+        "Out-of-range copies should fail",
+        _counter) && result;
+
+    // test 3: linear array
+    linear  = (int*)d_deque_to_linear_array(dq);
+    ordered = (linear != NULL);
+
+    for (i = 0; (ordered) && (i < 33); i++)
+    {
+        ordered = (linear[i] == i - 3);
+    }
+
+    result = d_assert_standalone(
+        ordered,
+        "to_linear_array",
+        "Linear copy should match the deque",
+        _counter) && result;
+
+    free(linear);
+    d_deque_free(dq);
+
+    return result;
+}
+
+
+/*
+d_tests_sa_deque_clear_shrink
+  Tests d_deque_clear and d_deque_shrink_to_fit.
+  Tests the following:
+  - clear empties the deque and keeps one spare block
+  - shrink_to_fit releases the spare and the map
+  - the deque is usable afterwards
+*/
+bool
+d_tests_sa_deque_clear_shrink
+(
+    struct d_test_counter* _counter
+)
+{
+    bool            result;
+    struct d_deque* dq;
+    int             i;
+
+    result = true;
+    dq     = d_deque_new_block_capacity(4, sizeof(int));
+
+    for (i = 0; i < 100; i++)
+    {
+        d_deque_push_front(dq, &i);
+    }
+
+    // test 1: clear
+    result = d_assert_standalone(
+        (d_deque_clear(dq)) &&
+        (d_deque_count(dq) == 0) &&
+        (dq->map_begin == dq->map_end) &&
+        (dq->spare != NULL),
+        "clear",
+        "Clear should release all blocks but the spare",
+        _counter) && result;
+
+    // test 2: shrink
+    result = d_assert_standalone(
+        (d_deque_shrink_to_fit(dq)) &&
+        (dq->spare == NULL) &&
+        (dq->map == NULL),
+        "shrink_to_fit",
+        "Shrink should free the spare and the empty map",
+        _counter) && result;
+
+    // test 3: reuse
+    i = 7;
+
+    result = d_assert_standalone(
+        (d_deque_push_front(dq, &i)) &&
+        (*(int*)d_deque_back(dq) == 7) &&
+        (!d_deque_clear(NULL)),
+        "clear_reuse",
+        "The deque should be usable after shrinking",
+        _counter) && result;
+
+    d_deque_free(dq);
+
+    return result;
+}
+
+
+/*
+d_tests_sa_deque_bulk_all
+  Aggregation function that runs all bulk and conversion tests.
+*/
+bool
+d_tests_sa_deque_bulk_all
+(
+    struct d_test_counter* _counter
+)
+{
+    bool result;
+
+    result = true;
+
+    printf("\n  [SECTION] Bulk and Conversion Functions\n");
+    printf("  ---------------------------------------\n");
+
+    result = d_tests_sa_deque_append_prepend(_counter) && result;
+    result = d_tests_sa_deque_pop_front_range(_counter) && result;
+    result = d_tests_sa_deque_copy_to(_counter) && result;
+    result = d_tests_sa_deque_clear_shrink(_counter) && result;
+
+    return result;
+}
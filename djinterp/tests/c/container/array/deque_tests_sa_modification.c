@@ -0,0 +1,279 @@
+#include "./deque_tests_sa.h"
+
+
+/******************************************************************************
+ * II. MODIFICATION FUNCTION TESTS
+ *****************************************************************************/
+
+/*
+d_tests_sa_deque_push_pop_back
+  Tests d_deque_push_back and d_deque_pop_back_to.
+  Tests the following:
+  - LIFO order across several blocks
+  - emptied blocks are released as the deque shrinks
+  - popping an empty deque fails
+*/
+bool
+d_tests_sa_deque_push_pop_back
+(
+    struct d_test_counter* _counter
+)
+{
+    bool            result;
+    struct d_deque* dq;
+    bool            ordered;
+    int             value;
+    int             i;
+
+    result = true;
+    dq     = d_deque_new_block_capacity(4, sizeof(int));
+
+    for (i = 0; i < 50; i++)
+    {
+        d_deque_push_back(dq, &i);
+    }
+
+    // test 1: pushes
+    result = d_assert_standalone(
+        (dq->count == 50) &&
+        ((dq->map_end - dq->map_begin) == 13),
+        "push_back_count",
+        "50 elements should use 13 blocks of 4",
+        _counter) && result;
+
+    ordered = true;
+
+    for (i = 49; (ordered) && (i >= 0); i--)
+    {
+        ordered = (d_deque_pop_back_to(dq, &value)) && (value == i);
+    }
+
+    // test 2: pops come back in reverse order and release every block
+    result = d_assert_standalone(
+        ordered &&
+        (dq->count == 0) &&
+        (dq->map_end == dq->map_begin) &&
+        (dq->spare != NULL),
+        "pop_back_order",
+        "Pops should return LIFO order and keep one spare block",
+        _counter) && result;
+
+    // test 3: empty
+    result = d_assert_standalone(
+        (!d_deque_pop_back_to(dq, &value)) &&
+        (!d_deque_pop_back_to(NULL, &value)),
+        "pop_back_empty",
+        "Popping an empty or NULL deque should fail",
+        _counter) && result;
+
+    d_deque_free(dq);
+
+    return result;
+}
+
+
+/*
+d_tests_sa_deque_push_pop_front
+  Tests d_deque_push_front and d_deque_pop_front_to.
+  Tests the following:
+  - front pushes reverse the order and grow the map at the front
+  - mixing front and back pushes gives the expected sequence
+  - popping from the front drains the deque in order
+*/
+bool
+d_tests_sa_deque_push_pop_front
+(
+    struct d_test_counter* _counter
+)
+{
+    bool            result;
+    struct d_deque* dq;
+    bool            ordered;
+    int             value;
+    int             i;
+
+    result = true;
+    dq     = d_deque_new_block_capacity(4, sizeof(int));
+
+    // -1 .. -100 at the front, 0 .. 99 at the back
+    for (i = 0; i < 100; i++)
+    {
+        value = -(i + 1);
+        d_deque_push_front(dq, &value);
+        d_deque_push_back(dq, &i);
+    }
+
+    ordered = (dq->count == 200);
+
+    for (i = 0; (ordered) && (i < 200); i++)
+    {
+        ordered = (*(int*)d_deque_get(dq, i) == i - 100);
+    }
+
+    // test 1: mixed pushes
+    result = d_assert_standalone(
+        ordered,
+        "push_front_order",
+        "Front and back pushes should give -100 .. 99",
+        _counter) && result;
+
+    ordered = true;
+
+    for (i = 0; (ordered) && (i < 200); i++)
+    {
+        ordered = (d_deque_pop_front_to(dq, &value)) && (value == i - 100);
+    }
+
+    // test 2: drain from the front
+    result = d_assert_standalone(
+        ordered &&
+        (d_deque_is_empty(dq)) &&
+        (dq->front == 0) &&
+        (!d_deque_pop_front_to(dq, NULL)),
+        "pop_front_order",
+        "Front pops should return FIFO order until empty",
+        _counter) && result;
+
+    d_deque_free(dq);
+
+    return result;
+}
+
+
+/*
+d_tests_sa_deque_stable_addresses
+  Tests that pushing at either end never moves existing elements.
+  Tests the following:
+  - pointers taken before many front and back pushes stay valid
+*/
+bool
+d_tests_sa_deque_stable_addresses
+(
+    struct d_test_counter* _counter
+)
+{
+    bool            result;
+    struct d_deque* dq;
+    int*            first;
+    int*            middle;
+    int             value;
+    int             i;
+
+    result = true;
+    dq     = d_deque_new_block_capacity(4, sizeof(int));
+
+    for (i = 0; i < 6; i++)
+    {
+        d_deque_push_back(dq, &i);
+    }
+
+    first  = (int*)d_deque_get(dq, 0);
+    middle = (int*)d_deque_get(dq, 5);
+
+    for (i = 0; i < 1000; i++)
+    {
+        value = 1000 + i;
+        d_deque_push_front(dq, &value);
+        d_deque_push_back(dq, &value);
+    }
+
+    // test 1: the map was reallocated, the elements were not
+    result = d_assert_standalone(
+        (first == (int*)d_deque_get(dq, 1000)) &&
+        (middle == (int*)d_deque_get(dq, 1005)) &&
+        (*first == 0) &&
+        (*middle == 5),
+        "stable_addresses",
+        "Elements should not move when either end grows",
+        _counter) && result;
+
+    d_deque_free(dq);
+
+    return result;
+}
+
+
+/*
+d_tests_sa_deque_queue_churn
+  Tests a long-running FIFO work queue.
+  Tests the following:
+  - pushing at the back and popping at the front many times keeps the
+    order and does not grow the block map without bound
+*/
+bool
+d_tests_sa_deque_queue_churn
+(
+    struct d_test_counter* _counter
+)
+{
+    bool            result;
+    struct d_deque* dq;
+    bool            ordered;
+    int             next_in;
+    int             next_out;
+    int             value;
+
+    result   = true;
+    dq       = d_deque_new_block_capacity(8, sizeof(int));
+    ordered  = true;
+    next_in  = 0;
+    next_out = 0;
+
+    // keep between 20 and 30 elements queued while 100000 pass through
+    while (next_in < 100000)
+    {
+        while ( (next_in < 100000) &&
+                ((next_in - next_out) < 30) )
+        {
+            d_deque_push_back(dq, &next_in);
+            next_in++;
+        }
+
+        while ( (ordered) &&
+                ((next_in - next_out) > 20) )
+        {
+            ordered = (d_deque_pop_front_to(dq, &value)) &&
+                      (value == next_out);
+            next_out++;
+        }
+    }
+
+    // test 1: order and bounded map
+    result = d_assert_standalone(
+        ordered &&
+        (dq->count == 20) &&
+        (dq->map_capacity <= 4 * D_DEQUE_MIN_MAP_CAPACITY),
+        "queue_churn",
+        "A steady FIFO should keep order and a small block map",
+        _counter) && result;
+
+    d_deque_free(dq);
+
+    return result;
+}
+
+
+/*
+d_tests_sa_deque_modification_all
+  Aggregation function that runs all modification tests.
+*/
+bool
+d_tests_sa_deque_modification_all
+(
+    struct d_test_counter* _counter
+)
+{
+    bool result;
+
+    result = true;
+
+    printf("\n  [SECTION] Modification Functions\n");
+    printf("  --------------------------------\n");
+
+    result = d_tests_sa_deque_push_pop_back(_counter) && result;
+    result = d_tests_sa_deque_push_pop_front(_counter) && result;
+    result = d_tests_sa_deque_stable_addresses(_counter) && result;
+    result = d_tests_sa_deque_queue_churn(_counter) && result;
+
+    return result;
+}
@@ -0,0 +1,28 @@
+#include "./segmented_array_tests_sa.h"
+
+
+/*
+d_tests_sa_segmented_array_run_all
+  Module-level aggregation function that runs all segmented_array tests.
+  Executes tests for all categories:
+  - Constructor and element access functions
+  - Modification functions
+  - Block, search and filter functions
+*/
+bool
+d_tests_sa_segmented_array_run_all
+(
+    struct d_test_counter* _counter
+)
+{
+    bool result;
+
+    result = true;
+
+    // run all test categories
+    result = d_tests_sa_segmented_array_access_all(_counter) && result;
+    result = d_tests_sa_segmented_array_modification_all(_counter) && result;
+    result = d_tests_sa_segmented_array_block_all(_counter) && result;
+
+    return result;
+}
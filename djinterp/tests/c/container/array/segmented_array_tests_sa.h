@@ -0,0 +1,69 @@
+/******************************************************************************
+* djinterp [test]                                  segmented_array_tests_sa.h
+*
+*   Unit test declarations for `segmented_array.h` module.
+*   Covers construction, indexed access across block boundaries, address
+* stability while growing, bulk append and copy-out, block iteration, search,
+* and the block-wise filter adaptors.
+*
+*
+* path:      /tests/container/array/segmented_array_tests_sa.h
+* link(s):   TBA
+* author(s): Samuel 'teer' Neal-Blim                          date: 2026.10.18
+******************************************************************************/
+
+#ifndef DJINTERP_TESTS_SEGMENTED_ARRAY_SA_
+#define DJINTERP_TESTS_SEGMENTED_ARRAY_SA_ 1
+
+#include <stdlib.h>
+#include <errno.h>
+#include "../../../../inc/c/djinterp.h"
+#include "../../../../inc/c/dmemory.h"
+#include "../../../../inc/c/test/test_standalone.h"
+#include "../../../../inc/c/container/array/segmented_array.h"
+
+
+/******************************************************************************
+ * I. CONSTRUCTOR AND ACCESS FUNCTION TESTS
+ *****************************************************************************/
+bool d_tests_sa_segmented_array_new(struct d_test_counter* _counter);
+bool d_tests_sa_segmented_array_new_from_arr(struct d_test_counter* _counter);
+bool d_tests_sa_segmented_array_new_copy(struct d_test_counter* _counter);
+bool d_tests_sa_segmented_array_get_set(struct d_test_counter* _counter);
+
+// I.   aggregation function
+bool d_tests_sa_segmented_array_access_all(struct d_test_counter* _counter);
+
+
+/******************************************************************************
+ * II. MODIFICATION FUNCTION TESTS
+ *****************************************************************************/
+bool d_tests_sa_segmented_array_push_back(struct d_test_counter* _counter);
+bool d_tests_sa_segmented_array_stable_addresses(struct d_test_counter* _counter);
+bool d_tests_sa_segmented_array_append(struct d_test_counter* _counter);
+bool d_tests_sa_segmented_array_pop_truncate(struct d_test_counter* _counter);
+bool d_tests_sa_segmented_array_reserve_shrink(struct d_test_counter* _counter);
+
+// II.  aggregation function
+bool d_tests_sa_segmented_array_modification_all(struct d_test_counter* _counter);
+
+
+/******************************************************************************
+ * III. BLOCK, SEARCH AND FILTER FUNCTION TESTS
+ *****************************************************************************/
+bool d_tests_sa_segmented_array_blocks(struct d_test_counter* _counter);
+bool d_tests_sa_segmented_array_copy_to(struct d_test_counter* _counter);
+bool d_tests_sa_segmented_array_find(struct d_test_counter* _counter);
+bool d_tests_sa_segmented_array_filter(struct d_test_counter* _counter);
+
+// III. aggregation function
+bool d_tests_sa_segmented_array_block_all(struct d_test_counter* _counter);
+
+
+/******************************************************************************
+ * MODULE-LEVEL AGGREGATION
+ *****************************************************************************/
+bool d_tests_sa_segmented_array_run_all(struct d_test_counter* _counter);
+
+
+#endif  // DJINTERP_TESTS_SEGMENTED_ARRAY_SA_
@@ -0,0 +1,283 @@
+#include "./segmented_array_tests_sa.h"
+
+
+/******************************************************************************
+ * I. CONSTRUCTOR AND ACCESS FUNCTION TESTS
+ *****************************************************************************/
+
+/*
+d_tests_sa_segmented_array_new
+  Tests d_segmented_array_new and d_segmented_array_new_block_capacity.
+  Tests the following:
+  - a new array is empty and allocates no blocks
+  - the first block capacity is rounded up to a power of two
+  - a zero element size is rejected
+*/
+bool
+d_tests_sa_segmented_array_new
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                      result;
+    struct d_segmented_array* arr;
+
+    result = true;
+
+    // test 1: default construction
+    arr = d_segmented_array_new(sizeof(int));
+
+    result = d_assert_standalone(
+        (arr != NULL) &&
+        (arr->count == 0) &&
+        (arr->block_count == 0) &&
+        (d_segmented_array_capacity(arr) == 0) &&
+        (d_segmented_array_block_capacity(arr, 0) ==
+             D_SEGMENTED_ARRAY_DEFAULT_BLOCK_CAPACITY),
+        "new_default",
+        "A new array should be empty with no blocks allocated",
+        _counter) && result;
+
+    d_segmented_array_free(arr);
+
+    // test 2: block capacity rounding
+    arr = d_segmented_array_new_block_capacity(5, sizeof(int));
+
+    result = d_assert_standalone(
+        (arr != NULL) &&
+        (d_segmented_array_block_capacity(arr, 0) == 8) &&
+        (d_segmented_array_block_capacity(arr, 1) == 16) &&
+        (d_segmented_array_block_capacity(arr, 2) == 32),
+        "new_block_capacity",
+        "Block capacities should start at the next power of two and double",
+        _counter) && result;
+
+    d_segmented_array_free(arr);
+
+    // test 3: invalid element size
+    result = d_assert_standalone(
+        d_segmented_array_new(0) == NULL,
+        "new_zero_size",
+        "A zero element size should be rejected",
+        _counter) && result;
+
+    return result;
+}
+
+
+/*
+d_tests_sa_segmented_array_new_from_arr
+  Tests the d_segmented_array_new_from_arr function.
+  Tests the following:
+  - elements are copied in order across several blocks
+  - NULL source with a non-zero count is rejected
+*/
+bool
+d_tests_sa_segmented_array_new_from_arr
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                      result;
+    struct d_segmented_array* arr;
+    int                       values[100];
+    bool                      ordered;
+    int                       i;
+
+    result = true;
+
+    for (i = 0; i < 100; i++)
+    {
+        values[i] = i * 3;
+    }
+
+    arr     = d_segmented_array_new_from_arr(sizeof(int), values, 100);
+    ordered = (arr != NULL) && (arr->count == 100);
+
+    for (i = 0; (ordered) && (i < 100); i++)
+    {
+        ordered = (*(int*)d_segmented_array_get(arr, i) == i * 3);
+    }
+
+    // test 1: copy across blocks
+    result = d_assert_standalone(
+        ordered && (arr->block_count == 3),
+        "new_from_arr_order",
+        "100 elements should occupy blocks of 16, 32 and 64 in order",
+        _counter) && result;
+
+    d_segmented_array_free(arr);
+
+    // test 2: NULL source
+    result = d_assert_standalone(
+        d_segmented_array_new_from_arr(sizeof(int), NULL, 4) == NULL,
+        "new_from_arr_null",
+        "A NULL source with a non-zero count should be rejected",
+        _counter) && result;
+
+    return result;
+}
+
+
+/*
+d_tests_sa_segmented_array_new_copy
+  Tests the d_segmented_array_new_copy function.
+  Tests the following:
+  - the copy holds the same elements in independent storage
+  - copying NULL returns NULL
+*/
+bool
+d_tests_sa_segmented_array_new_copy
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                      result;
+    struct d_segmented_array* arr;
+    struct d_segmented_array* copy;
+    int                       value;
+    int                       i;
+
+    result = true;
+    arr    = d_segmented_array_new_block_capacity(4, sizeof(int));
+
+    for (i = 0; i < 50; i++)
+    {
+        d_segmented_array_push_back(arr, &i);
+    }
+
+    copy  = d_segmented_array_new_copy(arr);
+    value = -1;
+    d_segmented_array_set(arr, 20, &value);
+
+    // test 1: contents and independence
+    result = d_assert_standalone(
+        (copy != NULL) &&
+        (copy->count == 50) &&
+        (*(int*)d_segmented_array_get(copy, 49) == 49) &&
+        (*(int*)d_segmented_array_get(copy, 20) == 20) &&
+        (d_segmented_array_get(copy, 20) != d_segmented_array_get(arr, 20)),
+        "new_copy_contents",
+        "A copy should hold the same elements in its own blocks",
+        _counter) && result;
+
+    d_segmented_array_free(copy);
+    d_segmented_array_free(arr);
+
+    // test 2: NULL
+    result = d_assert_standalone(
+        d_segmented_array_new_copy(NULL) == NULL,
+        "new_copy_null",
+        "Copying NULL should return NULL",
+        _counter) && result;
+
+    return result;
+}
+
+
+/*
+d_tests_sa_segmented_array_get_set
+  Tests element access functions.
+  Tests the following:
+  - get at every block boundary
+  - negative indices count from the back
+  - out-of-range indices return NULL / false
+  - front and back
+*/
+bool
+d_tests_sa_segmented_array_get_set
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                      result;
+    struct d_segmented_array* arr;
+    bool                      boundaries;
+    int                       value;
+    int                       i;
+
+    result = true;
+    arr    = d_segmented_array_new_block_capacity(2, sizeof(int));
+
+    for (i = 0; i < 62; i++)
+    {
+        d_segmented_array_push_back(arr, &i);
+    }
+
+    // blocks of 2, 4, 8, 16, 32 start at 0, 2, 6, 14, 30
+    boundaries = (*(int*)d_segmented_array_get(arr, 1) == 1)   &&
+                 (*(int*)d_segmented_array_get(arr, 2) == 2)   &&
+                 (*(int*)d_segmented_array_get(arr, 5) == 5)   &&
+                 (*(int*)d_segmented_array_get(arr, 6) == 6)   &&
+                 (*(int*)d_segmented_array_get(arr, 14) == 14) &&
+                 (*(int*)d_segmented_array_get(arr, 29) == 29) &&
+                 (*(int*)d_segmented_array_get(arr, 30) == 30) &&
+                 (*(int*)d_segmented_array_get(arr, 61) == 61);
+
+    // test 1: block boundaries
+    result = d_assert_standalone(
+        boundaries,
+        "get_boundaries",
+        "Indices on both sides of each block boundary should resolve",
+        _counter) && result;
+
+    // test 2: negative indices, front and back
+    result = d_assert_standalone(
+        (*(int*)d_segmented_array_get(arr, -1) == 61) &&
+        (*(int*)d_segmented_array_get(arr, -62) == 0) &&
+        (*(int*)d_segmented_array_front(arr) == 0) &&
+        (*(int*)d_segmented_array_back(arr) == 61),
+        "get_negative",
+        "Negative indices, front and back should resolve",
+        _counter) && result;
+
+    // test 3: set
+    value = 1000;
+
+    result = d_assert_standalone(
+        (d_segmented_array_set(arr, 30, &value)) &&
+        (*(int*)d_segmented_array_get(arr, 30) == 1000),
+        "set_value",
+        "Set should overwrite the element in place",
+        _counter) && result;
+
+    // test 4: out of range
+    result = d_assert_standalone(
+        (d_segmented_array_get(arr, 62) == NULL) &&
+        (d_segmented_array_get(arr, -63) == NULL) &&
+        (!d_segmented_array_set(arr, 62, &value)) &&
+        (d_segmented_array_get(NULL, 0) == NULL),
+        "get_out_of_range",
+        "Out-of-range access should fail",
+        _counter) && result;
+
+    d_segmented_array_free(arr);
+
+    return result;
+}
+
+
+/*
+d_tests_sa_segmented_array_access_all
+  Aggregation function that runs all constructor and access tests.
+*/
+bool
+d_tests_sa_segmented_array_access_all
+(
+    struct d_test_counter* _counter
+)
+{
+    bool result;
+
+    result = true;
+
+    printf("\n  [SECTION] Constructor and Access Functions\n");
+    printf("  ------------------------------------------\n");
+
+    result = d_tests_sa_segmented_array_new(_counter) && result;
+    result = d_tests_sa_segmented_array_new_from_arr(_counter) && result;
+    result = d_tests_sa_segmented_array_new_copy(_counter) && result;
+    result = d_tests_sa_segmented_array_get_set(_counter) && result;
+
+    return result;
+}
@@ -0,0 +1,354 @@
+#include "./segmented_array_tests_sa.h"
+
+
+///////////////////////////////////////////////////////////////////////////////
+// file-scope helpers
+///////////////////////////////////////////////////////////////////////////////
+
+// helper: orders ints for the search tests
+static int
+d_test_segmented_array_compare_int
+(
+    const void* _a,
+    const void* _b
+)
+{
+    return (*(const int*)_a > *(const int*)_b) -
+           (*(const int*)_a < *(const int*)_b);
+}
+
+#if D_CFG_CONTAINER_FILTER_SEGMENTED_ARRAY
+// helper: true for multiples of the int pointed to by `_context`
+static bool
+d_test_segmented_array_is_multiple
+(
+    const void* _element,
+    void*       _context
+)
+{
+    return (*(const int*)_element % *(const int*)_context) == 0;
+}
+#endif  // D_CFG_CONTAINER_FILTER_SEGMENTED_ARRAY
+
+// helper: array of 0..count-1 with a first block of 4
+static struct d_segmented_array*
+d_test_segmented_array_range
+(
+    int _count
+)
+{
+    struct d_segmented_array* arr;
+    int                       i;
+
+    arr = d_segmented_array_new_block_capacity(4, sizeof(int));
+
+    for (i = 0; (arr) && (i < _count); i++)
+    {
+        d_segmented_array_push_back(arr, &i);
+    }
+
+    return arr;
+}
+
+
+/******************************************************************************
+ * III. BLOCK, SEARCH AND FILTER FUNCTION TESTS
+ *****************************************************************************/
+
+/*
+d_tests_sa_segmented_array_blocks
+  Tests the block access functions.
+  Tests the following:
+  - blocks cover the elements in order with the expected sizes
+  - the last block reports only its used part
+  - out-of-range blocks return NULL
+*/
+bool
+d_tests_sa_segmented_array_blocks
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                      result;
+    struct d_segmented_array* arr;
+    const int*                block;
+    size_t                    block_count;
+    size_t                    b;
+    size_t                    i;
+    int                       expected;
+    bool                      ordered;
+
+    result   = true;
+    arr      = d_test_segmented_array_range(28);
+    expected = 0;
+    ordered  = (d_segmented_array_block_count(arr) == 3);
+
+    // blocks of 4, 8 and 16 hold exactly 28 elements
+    for (b = 0; (ordered) && (b < d_segmented_array_block_count(arr)); b++)
+    {
+        block = (const int*)d_segmented_array_block(arr, b, &block_count);
+
+        for (i = 0; (ordered) && (i < block_count); i++)
+        {
+            ordered = (block[i] == expected++);
+        }
+    }
+
+    // test 1: full blocks
+    result = d_assert_standalone(
+        ordered && (expected == 28),
+        "blocks_order",
+        "Blocks should cover all 28 elements in order",
+        _counter) && result;
+
+    d_segmented_array_free(arr);
+
+    arr   = d_test_segmented_array_range(30);
+    block = (const int*)d_segmented_array_block(arr, 3, &block_count);
+
+    // test 2: partial last block
+    result = d_assert_standalone(
+        (d_segmented_array_block_count(arr) == 4) &&
+        (block != NULL) &&
+        (block_count == 2) &&
+        (block[0] == 28) &&
+        (block[1] == 29),
+        "blocks_partial",
+        "The last block should report only its used elements",
+        _counter) && result;
+
+    // test 3: out of range
+    result = d_assert_standalone(
+        (d_segmented_array_block(arr, 4, &block_count) == NULL) &&
+        (block_count == 0) &&
+        (d_segmented_array_block(arr, 0, NULL) == NULL),
+        "blocks_out_of_range",
+        "Unused blocks should not be handed out",
+        _counter) && result;
+
+    d_segmented_array_free(arr);
+
+    return result;
+}
+
+
+/*
+d_tests_sa_segmented_array_copy_to
+  Tests copy_to and to_linear_array.
+  Tests the following:
+  - a range spanning block boundaries is copied in order
+  - the linear copy matches the array
+  - out-of-range ranges are rejected
+*/
+bool
+d_tests_sa_segmented_array_copy_to
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                      result;
+    struct d_segmented_array* arr;
+    int                       out[20];
+    int*                      linear;
+    bool                      ordered;
+    int                       i;
+
+    result  = true;
+    arr     = d_test_segmented_array_range(60);
+    ordered = d_segmented_array_copy_to(arr, 2, 20, out);
+
+    for (i = 0; (ordered) && (i < 20); i++)
+    {
+        ordered = (out[i] == i + 2);
+    }
+
+    // test 1: range across blocks
+    result = d_assert_standalone(
+        ordered,
+        "copy_to_range",
+        "A range crossing blocks should be copied in order",
+        _counter) && result;
+
+    linear  = (int*)d_segmented_array_to_linear_array(arr);
+    ordered = (linear != NULL);
+
+    for (i = 0; (ordered) && (i < 60); i++)
+    {
+        ordered = (linear[i] == i);
+    }
+
+    // test 2: linear copy
+    result = d_assert_standalone(
+        ordered,
+        "to_linear_array",
+        "The linear copy should hold every element in order",
+        _counter) && result;
+
+    free(linear);
+
+    // test 3: bounds
+    result = d_assert_standalone(
+        (!d_segmented_array_copy_to(arr, 50, 11, out)) &&
+        (d_segmented_array_copy_to(arr, 60, 0, out)) &&
+        (!d_segmented_array_copy_to(arr, 0, 1, NULL)),
+        "copy_to_bounds",
+        "Ranges past the end should be rejected",
+        _counter) && result;
+
+    d_segmented_array_free(arr);
+
+    return result;
+}
+
+
+/*
+d_tests_sa_segmented_array_find
+  Tests find and contains.
+  Tests the following:
+  - values in the first and in later blocks are found at the right index
+  - a missing value returns -1
+*/
+bool
+d_tests_sa_segmented_array_find
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                      result;
+    struct d_segmented_array* arr;
+    int                       value;
+    ssize_t                   first;
+    ssize_t                   later;
+
+    result = true;
+    arr    = d_test_segmented_array_range(100);
+
+    value = 3;
+    first = d_segmented_array_find(arr, &value, d_test_segmented_array_compare_int);
+    value = 77;
+    later = d_segmented_array_find(arr, &value, d_test_segmented_array_compare_int);
+
+    // test 1: found
+    result = d_assert_standalone(
+        (first == 3) &&
+        (later == 77),
+        "find_found",
+        "Find should return the index of the value",
+        _counter) && result;
+
+    // test 2: missing
+    value = 500;
+
+    result = d_assert_standalone(
+        (d_segmented_array_find(arr, &value, d_test_segmented_array_compare_int) == -1) &&
+        (!d_segmented_array_contains(arr, &value, d_test_segmented_array_compare_int)) &&
+        (d_segmented_array_find(arr, &value, NULL) == -1),
+        "find_missing",
+        "A missing value should not be found",
+        _counter) && result;
+
+    d_segmented_array_free(arr);
+
+    return result;
+}
+
+
+/*
+d_tests_sa_segmented_array_filter
+  Tests the block-wise filter adaptors.
+  Tests the following:
+  - count_where, find_first, any_match and all_match over several blocks
+  - filter_in_place keeps matching elements in order across blocks
+*/
+bool
+d_tests_sa_segmented_array_filter
+(
+    struct d_test_counter* _counter
+)
+{
+    bool result;
+
+    result = true;
+
+#if D_CFG_CONTAINER_FILTER_SEGMENTED_ARRAY
+    {
+        struct d_segmented_array* arr;
+        int                       divisor;
+        int*                      match;
+        bool                      ordered;
+        size_t                    kept;
+        size_t                    i;
+
+        arr     = d_test_segmented_array_range(100);
+        divisor = 7;
+        match   = (int*)d_segmented_array_find_first(arr,
+                                                     d_test_segmented_array_is_multiple,
+                                                     &divisor);
+
+        // test 1: queries
+        result = d_assert_standalone(
+            (d_segmented_array_count_where(arr,
+                                           d_test_segmented_array_is_multiple,
+                                           &divisor) == 15) &&
+            (match == d_segmented_array_get(arr, 0)) &&
+            (d_segmented_array_any_match(arr,
+                                         d_test_segmented_array_is_multiple,
+                                         &divisor)) &&
+            (!d_segmented_array_all_match(arr,
+                                          d_test_segmented_array_is_multiple,
+                                          &divisor)),
+            "filter_queries",
+            "Block-wise queries should see every element",
+            _counter) && result;
+
+        // test 2: in-place filter
+        kept    = d_segmented_array_filter_in_place(arr,
+                                                    d_test_segmented_array_is_multiple,
+                                                    &divisor);
+        ordered = (kept == 15) && (arr->count == 15);
+
+        for (i = 0; (ordered) && (i < kept); i++)
+        {
+            ordered = (*(int*)d_segmented_array_get(arr, (d_index)i) == (int)i * 7);
+        }
+
+        result = d_assert_standalone(
+            ordered,
+            "filter_in_place",
+            "In-place filtering should compact survivors in order",
+            _counter) && result;
+
+        d_segmented_array_free(arr);
+    }
+#else
+    (void)_counter;
+#endif  // D_CFG_CONTAINER_FILTER_SEGMENTED_ARRAY
+
+    return result;
+}
+
+
+/*
+d_tests_sa_segmented_array_block_all
+  Aggregation function that runs all block, search and filter tests.
+*/
+bool
+d_tests_sa_segmented_array_block_all
+(
+    struct d_test_counter* _counter
+)
+{
+    bool result;
+
+    result = true;
+
+    printf("\n  [SECTION] Block, Search and Filter Functions\n");
+    printf("  --------------------------------------------\n");
+
+    result = d_tests_sa_segmented_array_blocks(_counter) && result;
+    result = d_tests_sa_segmented_array_copy_to(_counter) && result;
+    result = d_tests_sa_segmented_array_find(_counter) && result;
+    result = d_tests_sa_segmented_array_filter(_counter) && result;
+
+    return result;
+}
@@ -0,0 +1,339 @@
+#include "./segmented_array_tests_sa.h"
+
+
+/******************************************************************************
+ * II. MODIFICATION FUNCTION TESTS
+ *****************************************************************************/
+
+/*
+d_tests_sa_segmented_array_push_back
+  Tests d_segmented_array_push_back and d_segmented_array_emplace_back.
+  Tests the following:
+  - blocks are allocated only when the previous ones are full
+  - emplace returns the address of the new last element
+  - NULL arguments are rejected
+*/
+bool
+d_tests_sa_segmented_array_push_back
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                      result;
+    struct d_segmented_array* arr;
+    int*                      slot;
+    int                       i;
+
+    result = true;
+    arr    = d_segmented_array_new_block_capacity(4, sizeof(int));
+
+    for (i = 0; i < 4; i++)
+    {
+        d_segmented_array_push_back(arr, &i);
+    }
+
+    // test 1: first block filled exactly
+    result = d_assert_standalone(
+        (arr->count == 4) &&
+        (arr->block_count == 1) &&
+        (d_segmented_array_capacity(arr) == 4),
+        "push_back_first_block",
+        "Four pushes should fill the first block only",
+        _counter) && result;
+
+    i = 4;
+    d_segmented_array_push_back(arr, &i);
+
+    // test 2: next block on overflow
+    result = d_assert_standalone(
+        (arr->block_count == 2) &&
+        (d_segmented_array_capacity(arr) == 12) &&
+        (*(int*)d_segmented_array_back(arr) == 4),
+        "push_back_second_block",
+        "The fifth push should allocate a block of twice the size",
+        _counter) && result;
+
+    // test 3: emplace
+    slot = (int*)d_segmented_array_emplace_back(arr);
+
+    if (slot)
+    {
+        *slot = 77;
+    }
+
+    result = d_assert_standalone(
+        (slot != NULL) &&
+        (arr->count == 6) &&
+        (d_segmented_array_back(arr) == slot) &&
+        (*(int*)d_segmented_array_get(arr, 5) == 77),
+        "emplace_back",
+        "Emplace should return the new last element",
+        _counter) && result;
+
+    // test 4: NULL arguments
+    result = d_assert_standalone(
+        (!d_segmented_array_push_back(NULL, &i)) &&
+        (!d_segmented_array_push_back(arr, NULL)) &&
+        (d_segmented_array_emplace_back(NULL) == NULL),
+        "push_back_null",
+        "NULL arguments should be rejected",
+        _counter) && result;
+
+    d_segmented_array_free(arr);
+
+    return result;
+}
+
+
+/*
+d_tests_sa_segmented_array_stable_addresses
+  Tests that element addresses survive growth.
+  Tests the following:
+  - pointers taken early still reach the same elements after many appends
+*/
+bool
+d_tests_sa_segmented_array_stable_addresses
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                      result;
+    struct d_segmented_array* arr;
+    int*                      early[3];
+    int                       i;
+
+    result = true;
+    arr    = d_segmented_array_new_block_capacity(2, sizeof(int));
+
+    for (i = 0; i < 3; i++)
+    {
+        d_segmented_array_push_back(arr, &i);
+        early[i] = (int*)d_segmented_array_back(arr);
+    }
+
+    for (i = 3; i < 10000; i++)
+    {
+        d_segmented_array_push_back(arr, &i);
+    }
+
+    // test 1: early pointers unchanged
+    result = d_assert_standalone(
+        (early[0] == d_segmented_array_get(arr, 0)) &&
+        (early[1] == d_segmented_array_get(arr, 1)) &&
+        (early[2] == d_segmented_array_get(arr, 2)) &&
+        (*early[0] == 0) &&
+        (*early[2] == 2) &&
+        (*(int*)d_segmented_array_get(arr, 9999) == 9999),
+        "stable_addresses",
+        "Growth should never move existing elements",
+        _counter) && result;
+
+    d_segmented_array_free(arr);
+
+    return result;
+}
+
+
+/*
+d_tests_sa_segmented_array_append
+  Tests the d_segmented_array_append function.
+  Tests the following:
+  - a bulk append spanning several blocks keeps order
+  - appending to a partly filled block
+  - empty and invalid appends
+*/
+bool
+d_tests_sa_segmented_array_append
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                      result;
+    struct d_segmented_array* arr;
+    int                       values[300];
+    bool                      ordered;
+    int                       i;
+
+    result = true;
+
+    for (i = 0; i < 300; i++)
+    {
+        values[i] = i;
+    }
+
+    arr = d_segmented_array_new_block_capacity(8, sizeof(int));
+
+    d_segmented_array_append(arr, values, 5);
+    d_segmented_array_append(arr, values + 5, 295);
+
+    ordered = (arr->count == 300);
+
+    for (i = 0; (ordered) && (i < 300); i++)
+    {
+        ordered = (*(int*)d_segmented_array_get(arr, i) == i);
+    }
+
+    // test 1: order across partial and full blocks
+    result = d_assert_standalone(
+        ordered,
+        "append_order",
+        "Bulk appends should preserve order across blocks",
+        _counter) && result;
+
+    // test 2: empty and invalid appends
+    result = d_assert_standalone(
+        (d_segmented_array_append(arr, NULL, 0)) &&
+        (!d_segmented_array_append(arr, NULL, 3)) &&
+        (!d_segmented_array_append(NULL, values, 3)) &&
+        (arr->count == 300),
+        "append_invalid",
+        "Empty appends succeed; invalid ones leave the array unchanged",
+        _counter) && result;
+
+    d_segmented_array_free(arr);
+
+    return result;
+}
+
+
+/*
+d_tests_sa_segmented_array_pop_truncate
+  Tests pop, truncate and clear.
+  Tests the following:
+  - pop copies out the last element
+  - truncate and clear keep the blocks
+  - popping an empty array fails
+*/
+bool
+d_tests_sa_segmented_array_pop_truncate
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                      result;
+    struct d_segmented_array* arr;
+    int                       values[40];
+    int                       out;
+    size_t                    capacity;
+    int                       i;
+
+    result = true;
+
+    for (i = 0; i < 40; i++)
+    {
+        values[i] = i;
+    }
+
+    arr      = d_segmented_array_new_from_arr(sizeof(int), values, 40);
+    capacity = d_segmented_array_capacity(arr);
+    out      = -1;
+
+    // test 1: pop
+    result = d_assert_standalone(
+        (d_segmented_array_pop_back_to(arr, &out)) &&
+        (out == 39) &&
+        (arr->count == 39),
+        "pop_back_to",
+        "Pop should copy out and remove the last element",
+        _counter) && result;
+
+    // test 2: truncate
+    result = d_assert_standalone(
+        (d_segmented_array_truncate(arr, 10)) &&
+        (arr->count == 10) &&
+        (!d_segmented_array_truncate(arr, 11)) &&
+        (d_segmented_array_capacity(arr) == capacity),
+        "truncate",
+        "Truncate should shrink the count and keep the blocks",
+        _counter) && result;
+
+    // test 3: clear then pop
+    result = d_assert_standalone(
+        (d_segmented_array_clear(arr)) &&
+        (d_segmented_array_is_empty(arr)) &&
+        (!d_segmented_array_pop_back_to(arr, &out)),
+        "clear_pop_empty",
+        "Clear should empty the array; popping it then fails",
+        _counter) && result;
+
+    d_segmented_array_free(arr);
+
+    return result;
+}
+
+
+/*
+d_tests_sa_segmented_array_reserve_shrink
+  Tests reserve and shrink_to_fit.
+  Tests the following:
+  - reserve allocates enough blocks without adding elements
+  - shrink_to_fit frees blocks that hold no elements
+*/
+bool
+d_tests_sa_segmented_array_reserve_shrink
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                      result;
+    struct d_segmented_array* arr;
+    int                       i;
+
+    result = true;
+    arr    = d_segmented_array_new_block_capacity(16, sizeof(int));
+
+    // test 1: reserve
+    result = d_assert_standalone(
+        (d_segmented_array_reserve(arr, 1000)) &&
+        (d_segmented_array_capacity(arr) >= 1000) &&
+        (arr->count == 0),
+        "reserve",
+        "Reserve should allocate capacity without adding elements",
+        _counter) && result;
+
+    for (i = 0; i < 20; i++)
+    {
+        d_segmented_array_push_back(arr, &i);
+    }
+
+    // test 2: shrink
+    result = d_assert_standalone(
+        (d_segmented_array_shrink_to_fit(arr)) &&
+        (arr->block_count == 2) &&
+        (d_segmented_array_capacity(arr) == 48) &&
+        (*(int*)d_segmented_array_get(arr, 19) == 19),
+        "shrink_to_fit",
+        "Shrink should keep only the blocks holding elements",
+        _counter) && result;
+
+    d_segmented_array_free(arr);
+
+    return result;
+}
+
+
+/*
+d_tests_sa_segmented_array_modification_all
+  Aggregation function that runs all modification tests.
+*/
+bool
+d_tests_sa_segmented_array_modification_all
+(
+    struct d_test_counter* _counter
+)
+{
+    bool result;
+
+    result = true;
+
+    printf("\n  [SECTION] Modification Functions\n");
+    printf("  --------------------------------\n");
+
+    result = d_tests_sa_segmented_array_push_back(_counter) && result;
+    result = d_tests_sa_segmented_array_stable_addresses(_counter) && result;
+    result = d_tests_sa_segmented_array_append(_counter) && result;
+    result = d_tests_sa_segmented_array_pop_truncate(_counter) && result;
+    result = d_tests_sa_segmented_array_reserve_shrink(_counter) && result;
+
+    return result;
+}
@@ -0,0 +1,26 @@
+#include "./soa_table_tests_sa.h"
+
+
+/*
+d_tests_sa_soa_table_run_all
+  Module-level aggregation function that runs all soa_table tests.
+  Executes tests for all categories:
+  - Schema and row functions
+  - Scan functions
+*/
+bool
+d_tests_sa_soa_table_run_all
+(
+    struct d_test_counter* _counter
+)
+{
+    bool result;
+
+    result = true;
+
+    // run all test categories
+    result = d_tests_sa_soa_table_row_all(_counter) && result;
+    result = d_tests_sa_soa_table_scan_all(_counter) && result;
+
+    return result;
+}
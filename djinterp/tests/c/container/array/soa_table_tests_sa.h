@@ -0,0 +1,70 @@
+/******************************************************************************
+* djinterp [test]                                        soa_table_tests_sa.h
+*
+*   Unit test declarations for `soa_table.h` module.
+*   Covers schema construction from type descriptors, row scatter/gather,
+* column and cell access, removal, and the typed and comparator scans.
+*
+*
+* path:      /tests/container/array/soa_table_tests_sa.h
+* link(s):   TBA
+* author(s): Samuel 'teer' Neal-Blim                          date: 2026.10.18
+******************************************************************************/
+
+#ifndef DJINTERP_TESTS_SOA_TABLE_SA_
+#define DJINTERP_TESTS_SOA_TABLE_SA_ 1
+
+#include <stdlib.h>
+#include "../../../../inc/c/djinterp.h"
+#include "../../../../inc/c/dmemory.h"
+#include "../../../../inc/c/test/test_standalone.h"
+#include "../../../../inc/c/container/array/soa_table.h"
+
+
+// d_tests_sa_soa_row
+//   struct: row type shared by the soa_table tests.
+struct d_tests_sa_soa_row
+{
+    const char* name;
+    int32_t     flags;
+    uint64_t    id;
+    double      weight;
+};
+
+// fixture: table over `d_tests_sa_soa_row` with one column per member
+struct d_soa_table* d_tests_sa_soa_table_fixture(size_t _row_count);
+
+
+/******************************************************************************
+ * I. SCHEMA AND ROW FUNCTION TESTS
+ *****************************************************************************/
+bool d_tests_sa_soa_table_new(struct d_test_counter* _counter);
+bool d_tests_sa_soa_table_push_get_row(struct d_test_counter* _counter);
+bool d_tests_sa_soa_table_push_rows(struct d_test_counter* _counter);
+bool d_tests_sa_soa_table_cells(struct d_test_counter* _counter);
+bool d_tests_sa_soa_table_remove(struct d_test_counter* _counter);
+
+// I.   aggregation function
+bool d_tests_sa_soa_table_row_all(struct d_test_counter* _counter);
+
+
+/******************************************************************************
+ * II. SCAN FUNCTION TESTS
+ *****************************************************************************/
+bool d_tests_sa_soa_table_select(struct d_test_counter* _counter);
+bool d_tests_sa_soa_table_refine(struct d_test_counter* _counter);
+bool d_tests_sa_soa_table_count_typed(struct d_test_counter* _counter);
+bool d_tests_sa_soa_table_type_check(struct d_test_counter* _counter);
+bool d_tests_sa_soa_table_select_cmp(struct d_test_counter* _counter);
+
+// II.  aggregation function
+bool d_tests_sa_soa_table_scan_all(struct d_test_counter* _counter);
+
+
+/******************************************************************************
+ * MODULE-LEVEL AGGREGATION
+ *****************************************************************************/
+bool d_tests_sa_soa_table_run_all(struct d_test_counter* _counter);
+
+
+#endif  // DJINTERP_TESTS_SOA_TABLE_SA_
@@ -0,0 +1,381 @@
+#include "./soa_table_tests_sa.h"
+
+
+/******************************************************************************
+ * I. SCHEMA AND ROW FUNCTION TESTS
+ *****************************************************************************/
+
+/*
+d_tests_sa_soa_table_fixture
+  Builds a table over `d_tests_sa_soa_row` holding `_row_count` rows where
+row i has flags i % 4, id 1000 + i and weight i / 2.0.
+*/
+struct d_soa_table*
+d_tests_sa_soa_table_fixture
+(
+    size_t _row_count
+)
+{
+    static const struct d_soa_field fields[] =
+    {
+        D_SOA_FIELD(struct d_tests_sa_soa_row, name,   D_TYPE_INFO_STRING),
+        D_SOA_FIELD(struct d_tests_sa_soa_row, flags,  D_TYPE_INFO_INT32),
+        D_SOA_FIELD(struct d_tests_sa_soa_row, id,     D_TYPE_INFO_UINT64),
+        D_SOA_FIELD(struct d_tests_sa_soa_row, weight, D_TYPE_INFO_DOUBLE)
+    };
+
+    struct d_soa_table*       table;
+    struct d_tests_sa_soa_row row;
+    size_t                    i;
+
+    table = d_soa_table_new(fields, 4, 0);
+
+    for (i = 0; (table) && (i < _row_count); i++)
+    {
+        row.name   = (i % 2) ? "odd" : "even";
+        row.flags  = (int32_t)(i % 4);
+        row.id     = 1000 + i;
+        row.weight = (double)i / 2.0;
+
+        d_soa_table_push_row(table, &row);
+    }
+
+    return table;
+}
+
+
+/*
+d_tests_sa_soa_table_new
+  Tests the d_soa_table_new function.
+  Tests the following:
+  - one column per field with the field's size, type and name
+  - size 0 is derived from the type descriptor
+  - invalid schemas are rejected
+*/
+bool
+d_tests_sa_soa_table_new
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                result;
+    struct d_soa_table* table;
+    struct d_soa_field  derived[2] =
+    {
+        { "a", D_TYPE_INFO_INT,   0, 0 },
+        { "b", D_TYPE_INFO_FLOAT, 0, 0 }
+    };
+
+    result = true;
+
+    // test 1: fixture schema
+    table = d_tests_sa_soa_table_fixture(0);
+
+    result = d_assert_standalone(
+        (table != NULL) &&
+        (d_soa_table_column_count(table) == 4) &&
+        (d_soa_table_count(table) == 0) &&
+        (table->capacity == D_SOA_TABLE_DEFAULT_CAPACITY) &&
+        (d_soa_table_field(table, 2)->size == sizeof(uint64_t)) &&
+        (d_soa_table_field(table, 3)->type == D_TYPE_INFO_DOUBLE) &&
+        (d_soa_table_column_index(table, "weight") == 3) &&
+        (d_soa_table_column_index(table, "missing") == -1),
+        "new_schema",
+        "Columns should mirror the schema fields",
+        _counter) && result;
+
+    d_soa_table_free(table);
+
+    // test 2: derived sizes
+    table = d_soa_table_new(derived, 2, 100);
+
+    result = d_assert_standalone(
+        (table != NULL) &&
+        (table->capacity == 100) &&
+        (d_soa_table_field(table, 0)->size == sizeof(int)) &&
+        (d_soa_table_field(table, 1)->size == sizeof(float)),
+        "new_derived_size",
+        "A zero field size should come from the type descriptor",
+        _counter) && result;
+
+    d_soa_table_free(table);
+
+    // test 3: invalid schemas
+    derived[0].type = D_TYPE_INFO_VOID;
+
+    result = d_assert_standalone(
+        (d_soa_table_new(NULL, 2, 0) == NULL) &&
+        (d_soa_table_new(derived, 0, 0) == NULL) &&
+        (d_soa_table_new(derived, 2, 0) == NULL),
+        "new_invalid",
+        "Missing fields or a field without a size should be rejected",
+        _counter) && result;
+
+    return result;
+}
+
+
+/*
+d_tests_sa_soa_table_push_get_row
+  Tests d_soa_table_push_row and d_soa_table_get_row.
+  Tests the following:
+  - a row struct round-trips through the columns
+  - each field lands in its own contiguous column
+  - growth past the initial capacity
+*/
+bool
+d_tests_sa_soa_table_push_get_row
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                      result;
+    struct d_soa_table*       table;
+    struct d_tests_sa_soa_row row;
+    const uint64_t*           ids;
+    bool                      ordered;
+    size_t                    i;
+
+    result = true;
+    table  = d_tests_sa_soa_table_fixture(40);
+
+    // test 1: round trip
+    memset(&row, 0, sizeof(row));
+
+    result = d_assert_standalone(
+        (d_soa_table_get_row(table, 37, &row)) &&
+        (strcmp(row.name, "odd") == 0) &&
+        (row.flags == 1) &&
+        (row.id == 1037) &&
+        (row.weight == 18.5),
+        "get_row",
+        "A gathered row should equal the pushed row",
+        _counter) && result;
+
+    // test 2: contiguous column
+    ids     = (const uint64_t*)d_soa_table_column(table, 2);
+    ordered = (ids != NULL) && (table->capacity >= 40);
+
+    for (i = 0; (ordered) && (i < 40); i++)
+    {
+        ordered = (ids[i] == 1000 + i);
+    }
+
+    result = d_assert_standalone(
+        ordered,
+        "column_contiguous",
+        "The id column should hold every id in row order",
+        _counter) && result;
+
+    // test 3: invalid calls
+    result = d_assert_standalone(
+        (!d_soa_table_get_row(table, 40, &row)) &&
+        (!d_soa_table_push_row(table, NULL)) &&
+        (!d_soa_table_push_row(NULL, &row)),
+        "row_invalid",
+        "Out-of-range or NULL arguments should fail",
+        _counter) && result;
+
+    d_soa_table_free(table);
+
+    return result;
+}
+
+
+/*
+d_tests_sa_soa_table_push_rows
+  Tests the d_soa_table_push_rows function.
+  Tests the following:
+  - a row array is scattered column by column
+  - an empty batch succeeds
+*/
+bool
+d_tests_sa_soa_table_push_rows
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                      result;
+    struct d_soa_table*       table;
+    struct d_tests_sa_soa_row rows[50];
+    struct d_tests_sa_soa_row row;
+    bool                      same;
+    size_t                    i;
+
+    result = true;
+    table  = d_tests_sa_soa_table_fixture(3);
+
+    for (i = 0; i < 50; i++)
+    {
+        rows[i].name   = "batch";
+        rows[i].flags  = -(int32_t)i;
+        rows[i].id     = i * i;
+        rows[i].weight = -(double)i;
+    }
+
+    same = d_soa_table_push_rows(table, rows, sizeof(rows[0]), 50) &&
+           (d_soa_table_count(table) == 53);
+
+    for (i = 0; (same) && (i < 50); i++)
+    {
+        same = (d_soa_table_get_row(table, i + 3, &row)) &&
+               (row.flags == rows[i].flags) &&
+               (row.id == rows[i].id) &&
+               (row.weight == rows[i].weight);
+    }
+
+    // test 1: batch
+    result = d_assert_standalone(
+        same,
+        "push_rows",
+        "A batch of rows should follow the existing rows",
+        _counter) && result;
+
+    // test 2: empty and invalid batches
+    result = d_assert_standalone(
+        (d_soa_table_push_rows(table, NULL, sizeof(rows[0]), 0)) &&
+        (!d_soa_table_push_rows(table, NULL, sizeof(rows[0]), 1)) &&
+        (d_soa_table_count(table) == 53),
+        "push_rows_empty",
+        "An empty batch should succeed and a NULL batch fail",
+        _counter) && result;
+
+    d_soa_table_free(table);
+
+    return result;
+}
+
+
+/*
+d_tests_sa_soa_table_cells
+  Tests d_soa_table_cell and d_soa_table_set_cell.
+  Tests the following:
+  - a cell write changes only that column
+  - out-of-range access returns NULL / false
+*/
+bool
+d_tests_sa_soa_table_cells
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                      result;
+    struct d_soa_table*       table;
+    struct d_tests_sa_soa_row row;
+    double                    weight;
+
+    result = true;
+    table  = d_tests_sa_soa_table_fixture(10);
+    weight = 99.0;
+
+    // test 1: write one cell
+    result = d_assert_standalone(
+        (d_soa_table_set_cell(table, 4, 3, &weight)) &&
+        (*(double*)d_soa_table_cell(table, 4, 3) == 99.0) &&
+        (d_soa_table_get_row(table, 4, &row)) &&
+        (row.id == 1004) &&
+        (row.flags == 0),
+        "set_cell",
+        "A cell write should change only its column",
+        _counter) && result;
+
+    // test 2: bounds
+    result = d_assert_standalone(
+        (d_soa_table_cell(table, 10, 0) == NULL) &&
+        (d_soa_table_cell(table, 0, 4) == NULL) &&
+        (!d_soa_table_set_cell(table, 0, 0, NULL)),
+        "cell_bounds",
+        "Out-of-range cells should be rejected",
+        _counter) && result;
+
+    d_soa_table_free(table);
+
+    return result;
+}
+
+
+/*
+d_tests_sa_soa_table_remove
+  Tests d_soa_table_remove, d_soa_table_remove_swap and d_soa_table_clear.
+  Tests the following:
+  - ordered removal shifts every column
+  - swap removal moves the last row into the gap
+  - clear empties the table
+*/
+bool
+d_tests_sa_soa_table_remove
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                result;
+    struct d_soa_table* table;
+    const uint64_t*     ids;
+
+    result = true;
+    table  = d_tests_sa_soa_table_fixture(6);
+
+    // test 1: ordered remove of row 1: ids 1000, 1002, 1003, 1004, 1005
+    result = d_assert_standalone(
+        (d_soa_table_remove(table, 1)) &&
+        (d_soa_table_count(table) == 5) &&
+        ((ids = (const uint64_t*)d_soa_table_column(table, 2))[1] == 1002) &&
+        (ids[4] == 1005) &&
+        (*(int32_t*)d_soa_table_cell(table, 1, 1) == 2),
+        "remove_ordered",
+        "Ordered remove should shift later rows in every column",
+        _counter) && result;
+
+    // test 2: swap remove of row 0: ids 1005, 1002, 1003, 1004
+    result = d_assert_standalone(
+        (d_soa_table_remove_swap(table, 0)) &&
+        (d_soa_table_count(table) == 4) &&
+        (ids[0] == 1005) &&
+        (*(double*)d_soa_table_cell(table, 0, 3) == 2.5) &&
+        (d_soa_table_remove_swap(table, 3)) &&
+        (ids[2] == 1003),
+        "remove_swap",
+        "Swap remove should move the last row into the gap",
+        _counter) && result;
+
+    // test 3: bounds and clear
+    result = d_assert_standalone(
+        (!d_soa_table_remove(table, 3)) &&
+        (!d_soa_table_remove_swap(table, 3)) &&
+        (d_soa_table_clear(table)) &&
+        (d_soa_table_count(table) == 0),
+        "remove_clear",
+        "Out-of-range removes should fail and clear should empty",
+        _counter) && result;
+
+    d_soa_table_free(table);
+
+    return result;
+}
+
+
+/*
+d_tests_sa_soa_table_row_all
+  Aggregation function that runs all schema and row tests.
+*/
+bool
+d_tests_sa_soa_table_row_all
+(
+    struct d_test_counter* _counter
+)
+{
+    bool result;
+
+    result = true;
+
+    printf("\n  [SECTION] Schema and Row Functions\n");
+    printf("  ----------------------------------\n");
+
+    result = d_tests_sa_soa_table_new(_counter) && result;
+    result = d_tests_sa_soa_table_push_get_row(_counter) && result;
+    result = d_tests_sa_soa_table_push_rows(_counter) && result;
+    result = d_tests_sa_soa_table_cells(_counter) && result;
+    result = d_tests_sa_soa_table_remove(_counter) && result;
+
+    return result;
+}
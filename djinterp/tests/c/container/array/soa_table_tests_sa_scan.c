@@ -0,0 +1,293 @@
+#include "./soa_table_tests_sa.h"
+
+
+/******************************************************************************
+ * II. SCAN FUNCTION TESTS
+ *****************************************************************************/
+
+/*
+d_tests_sa_soa_table_internal_strcmp
+  Comparator for `const char*` cells against a `const char*` operand.
+*/
+static int
+d_tests_sa_soa_table_internal_strcmp
+(
+    const void* _cell,
+    const void* _value
+)
+{
+    return strcmp(*(const char* const*)_cell, (const char*)_value);
+}
+
+
+/*
+d_tests_sa_soa_table_select
+  Tests the typed select functions.
+  Tests the following:
+  - each comparison selects the expected rows in ascending order
+  - an empty table selects nothing
+*/
+bool
+d_tests_sa_soa_table_select
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                result;
+    struct d_soa_table* table;
+    size_t              rows[100];
+    size_t              matched;
+    bool                ordered;
+    size_t              i;
+
+    result = true;
+    table  = d_tests_sa_soa_table_fixture(100);
+
+    // test 1: equality on an int32 column: rows 3, 7, 11, ...
+    matched = d_soa_table_select_int32(table, 1, D_SOA_EQ, 3, rows);
+    ordered = (matched == 25);
+
+    for (i = 0; (ordered) && (i < matched); i++)
+    {
+        ordered = (rows[i] == (4 * i) + 3);
+    }
+
+    result = d_assert_standalone(
+        ordered,
+        "select_eq",
+        "flags == 3 should select every fourth row from 3",
+        _counter) && result;
+
+    // test 2: the other comparisons
+    result = d_assert_standalone(
+        (d_soa_table_select_uint64(table, 2, D_SOA_LT, 1010, rows) == 10) &&
+        (rows[9] == 9) &&
+        (d_soa_table_select_uint64(table, 2, D_SOA_GE, 1090, rows) == 10) &&
+        (rows[0] == 90) &&
+        (d_soa_table_select_double(table, 3, D_SOA_LE, 1.0, rows) == 3) &&
+        (d_soa_table_select_double(table, 3, D_SOA_GT, 49.0, rows) == 1) &&
+        (d_soa_table_select_int32(table, 1, D_SOA_NE, 0, rows) == 75),
+        "select_ops",
+        "LT, GE, LE, GT and NE should select the expected counts",
+        _counter) && result;
+
+    d_soa_table_clear(table);
+
+    // test 3: empty table
+    result = d_assert_standalone(
+        d_soa_table_select_int32(table, 1, D_SOA_NE, 0, rows) == 0,
+        "select_empty",
+        "Selecting from an empty table should match nothing",
+        _counter) && result;
+
+    d_soa_table_free(table);
+
+    return result;
+}
+
+
+/*
+d_tests_sa_soa_table_refine
+  Tests the typed refine functions.
+  Tests the following:
+  - a selection on one column narrowed by a second column
+  - refining an empty selection
+*/
+bool
+d_tests_sa_soa_table_refine
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                result;
+    struct d_soa_table* table;
+    size_t              rows[200];
+    size_t              matched;
+    bool                ordered;
+    size_t              i;
+
+    result = true;
+    table  = d_tests_sa_soa_table_fixture(200);
+
+    // flags == 1 (rows 1, 5, 9, ...) and weight >= 50.0 (rows >= 100)
+    matched = d_soa_table_select_int32(table, 1, D_SOA_EQ, 1, rows);
+    matched = d_soa_table_refine_double(table, 3, D_SOA_GE, 50.0, rows, matched);
+    ordered = (matched == 25);
+
+    for (i = 0; (ordered) && (i < matched); i++)
+    {
+        ordered = (rows[i] == 101 + (4 * i));
+    }
+
+    // test 1: two-column filter
+    result = d_assert_standalone(
+        ordered,
+        "refine_two_columns",
+        "flags == 1 && weight >= 50 should keep rows 101, 105, ... 197",
+        _counter) && result;
+
+    // test 2: empty selection
+    result = d_assert_standalone(
+        d_soa_table_refine_uint64(table, 2, D_SOA_GT, 0, rows, 0) == 0,
+        "refine_empty",
+        "Refining an empty selection should keep nothing",
+        _counter) && result;
+
+    d_soa_table_free(table);
+
+    return result;
+}
+
+
+/*
+d_tests_sa_soa_table_count_typed
+  Tests the typed count functions.
+  Tests the following:
+  - counts agree with the corresponding selects
+*/
+bool
+d_tests_sa_soa_table_count_typed
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                result;
+    struct d_soa_table* table;
+    size_t              rows[1000];
+
+    result = true;
+    table  = d_tests_sa_soa_table_fixture(1000);
+
+    // test 1: agreement
+    result = d_assert_standalone(
+        (d_soa_table_count_int32(table, 1, D_SOA_GT, 1) == 500) &&
+        (d_soa_table_count_uint64(table, 2, D_SOA_LT, 1500) ==
+             d_soa_table_select_uint64(table, 2, D_SOA_LT, 1500, rows)) &&
+        (d_soa_table_count_double(table, 3, D_SOA_EQ, 0.5) == 1),
+        "count_typed",
+        "Typed counts should agree with the selections",
+        _counter) && result;
+
+    d_soa_table_free(table);
+
+    return result;
+}
+
+
+/*
+d_tests_sa_soa_table_type_check
+  Tests that typed scans check the column's type descriptor.
+  Tests the following:
+  - mismatched width, signedness or floating-point kind matches nothing
+  - a pointer column is never scanned as an integer
+*/
+bool
+d_tests_sa_soa_table_type_check
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                result;
+    struct d_soa_table* table;
+    size_t              rows[10];
+
+    result = true;
+    table  = d_tests_sa_soa_table_fixture(10);
+
+    // test 1: mismatches
+    result = d_assert_standalone(
+        (d_soa_table_count_int64(table, 1, D_SOA_GE, 0) == 0) &&
+        (d_soa_table_count_uint32(table, 1, D_SOA_GE, 0) == 0) &&
+        (d_soa_table_count_int64(table, 2, D_SOA_GE, 0) == 0) &&
+        (d_soa_table_count_uint64(table, 3, D_SOA_GE, 0) == 0) &&
+        (d_soa_table_count_uint64(table, 0, D_SOA_NE, 0) == 0) &&
+        (d_soa_table_select_int32(table, 9, D_SOA_EQ, 0, rows) == 0) &&
+        (d_soa_table_select_int32(table, 1, D_SOA_EQ, 0, NULL) == 0),
+        "type_check",
+        "Scans should refuse columns of another type",
+        _counter) && result;
+
+    d_soa_table_free(table);
+
+    return result;
+}
+
+
+/*
+d_tests_sa_soa_table_select_cmp
+  Tests the d_soa_table_select_cmp function.
+  Tests the following:
+  - a string column selected through a comparator
+  - invalid arguments
+*/
+bool
+d_tests_sa_soa_table_select_cmp
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                result;
+    struct d_soa_table* table;
+    size_t              rows[20];
+    size_t              matched;
+
+    result = true;
+    table  = d_tests_sa_soa_table_fixture(20);
+
+    matched = d_soa_table_select_cmp(table,
+                                     0,
+                                     D_SOA_EQ,
+                                     "odd",
+                                     d_tests_sa_soa_table_internal_strcmp,
+                                     rows);
+
+    // test 1: string column
+    result = d_assert_standalone(
+        (matched == 10) &&
+        (rows[0] == 1) &&
+        (rows[9] == 19),
+        "select_cmp",
+        "name == \"odd\" should select the odd rows",
+        _counter) && result;
+
+    // test 2: invalid arguments
+    result = d_assert_standalone(
+        (d_soa_table_select_cmp(table, 0, D_SOA_EQ, "odd", NULL, rows) == 0) &&
+        (d_soa_table_select_cmp(table, 4, D_SOA_EQ, "odd",
+                                d_tests_sa_soa_table_internal_strcmp,
+                                rows) == 0),
+        "select_cmp_invalid",
+        "Missing comparator or column should match nothing",
+        _counter) && result;
+
+    d_soa_table_free(table);
+
+    return result;
+}
+
+
+/*
+d_tests_sa_soa_table_scan_all
+  Aggregation function that runs all scan tests.
+*/
+bool
+d_tests_sa_soa_table_scan_all
+(
+    struct d_test_counter* _counter
+)
+{
+    bool result;
+
+    result = true;
+
+    printf("\n  [SECTION] Scan Functions\n");
+    printf("  ------------------------\n");
+
+    result = d_tests_sa_soa_table_select(_counter) && result;
+    result = d_tests_sa_soa_table_refine(_counter) && result;
+    result = d_tests_sa_soa_table_count_typed(_counter) && result;
+    result = d_tests_sa_soa_table_type_check(_counter) && result;
+    result = d_tests_sa_soa_table_select_cmp(_counter) && result;
+
+    return result;
+}
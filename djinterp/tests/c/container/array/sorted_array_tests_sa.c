@@ -0,0 +1,26 @@
+#include "./sorted_array_tests_sa.h"
+
+
+/*
+d_tests_sa_sorted_array_run_all
+  Module-level aggregation function that runs all sorted_array tests.
+  Executes tests for all categories:
+  - Constructor and modification functions
+  - Search, snapshot and filter functions
+*/
+bool
+d_tests_sa_sorted_array_run_all
+(
+    struct d_test_counter* _counter
+)
+{
+    bool result;
+
+    result = true;
+
+    // run all test categories
+    result = d_tests_sa_sorted_array_modification_all(_counter) && result;
+    result = d_tests_sa_sorted_array_search_all(_counter) && result;
+
+    return result;
+}
@@ -0,0 +1,68 @@
+/******************************************************************************
+* djinterp [test]                                     sorted_array_tests_sa.h
+*
+*   Unit test declarations for `sorted_array.h` module.
+*   Covers construction, single and batched insertion (including stability of
+* equal elements), removal, comparator and integer-keyed searches, the
+* Eytzinger snapshot, and the filter adaptors.
+*
+*
+* path:      /tests/container/array/sorted_array_tests_sa.h
+* link(s):   TBA
+* author(s): Samuel 'teer' Neal-Blim                          date: 2026.10.18
+******************************************************************************/
+
+#ifndef DJINTERP_TESTS_SORTED_ARRAY_SA_
+#define DJINTERP_TESTS_SORTED_ARRAY_SA_ 1
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include "../../../../inc/c/djinterp.h"
+#include "../../../../inc/c/dmemory.h"
+#include "../../../../inc/c/test/test_standalone.h"
+#include "../../../../inc/c/container/array/sorted_array.h"
+
+
+// d_test_sorted_array_record
+//   struct: keyed element used by the tests; `seq` records insertion order so
+// stability can be checked.
+struct d_test_sorted_array_record
+{
+    int32_t seq;
+    int64_t key;
+};
+
+
+/******************************************************************************
+ * I. CONSTRUCTOR AND MODIFICATION FUNCTION TESTS
+ *****************************************************************************/
+bool d_tests_sa_sorted_array_new(struct d_test_counter* _counter);
+bool d_tests_sa_sorted_array_insert(struct d_test_counter* _counter);
+bool d_tests_sa_sorted_array_insert_all(struct d_test_counter* _counter);
+bool d_tests_sa_sorted_array_insert_all_stable(struct d_test_counter* _counter);
+bool d_tests_sa_sorted_array_remove(struct d_test_counter* _counter);
+
+// I.   aggregation function
+bool d_tests_sa_sorted_array_modification_all(struct d_test_counter* _counter);
+
+
+/******************************************************************************
+ * II. SEARCH, SNAPSHOT AND FILTER FUNCTION TESTS
+ *****************************************************************************/
+bool d_tests_sa_sorted_array_bounds(struct d_test_counter* _counter);
+bool d_tests_sa_sorted_array_keyed_search(struct d_test_counter* _counter);
+bool d_tests_sa_sorted_array_snapshot(struct d_test_counter* _counter);
+bool d_tests_sa_sorted_array_filter(struct d_test_counter* _counter);
+
+// II.  aggregation function
+bool d_tests_sa_sorted_array_search_all(struct d_test_counter* _counter);
+
+
+/******************************************************************************
+ * MODULE-LEVEL AGGREGATION
+ *****************************************************************************/
+bool d_tests_sa_sorted_array_run_all(struct d_test_counter* _counter);
+
+
+#endif  // DJINTERP_TESTS_SORTED_ARRAY_SA_
@@ -0,0 +1,513 @@
+#include "./sorted_array_tests_sa.h"
+
+
+///////////////////////////////////////////////////////////////////////////////
+// file-scope helpers
+///////////////////////////////////////////////////////////////////////////////
+
+// helper: orders ints
+static int
+d_test_sorted_array_compare_int
+(
+    const void* _a,
+    const void* _b
+)
+{
+    return (*(const int*)_a > *(const int*)_b) -
+           (*(const int*)_a < *(const int*)_b);
+}
+
+// helper: orders records by key only, so equal keys expose stability
+static int
+d_test_sorted_array_compare_record
+(
+    const void* _a,
+    const void* _b
+)
+{
+    const struct d_test_sorted_array_record* a;
+    const struct d_test_sorted_array_record* b;
+
+    a = (const struct d_test_sorted_array_record*)_a;
+    b = (const struct d_test_sorted_array_record*)_b;
+
+    return (a->key > b->key) - (a->key < b->key);
+}
+
+// helper: true if the array holds exactly 0..count-1 in order
+static bool
+d_test_sorted_array_is_range
+(
+    const struct d_sorted_array* _arr,
+    int                          _count
+)
+{
+    int i;
+
+    if (d_sorted_array_count(_arr) != (size_t)_count)
+    {
+        return false;
+    }
+
+    for (i = 0; i < _count; i++)
+    {
+        if (*(const int*)d_sorted_array_get(_arr, i) != i)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// helper: true if records are ordered by key and, within a key, by seq
+static bool
+d_test_sorted_array_is_stable
+(
+    const struct d_sorted_array* _arr
+)
+{
+    const struct d_test_sorted_array_record* prev;
+    const struct d_test_sorted_array_record* cur;
+    size_t                                   i;
+
+    for (i = 1; i < d_sorted_array_count(_arr); i++)
+    {
+        prev = d_sorted_array_get(_arr, (d_index)(i - 1));
+        cur  = d_sorted_array_get(_arr, (d_index)i);
+
+        if ( (prev->key > cur->key) ||
+             ( (prev->key == cur->key) && (prev->seq > cur->seq) ) )
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+
+/******************************************************************************
+ * I. CONSTRUCTOR AND MODIFICATION FUNCTION TESTS
+ *****************************************************************************/
+
+/*
+d_tests_sa_sorted_array_new
+  Tests the constructor functions.
+  Tests the following:
+  - comparator and keyed arrays start empty
+  - invalid element sizes, comparators and key placements are rejected
+  - new_from_arr sorts its source
+*/
+bool
+d_tests_sa_sorted_array_new
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                   result;
+    struct d_sorted_array* arr;
+    struct d_sorted_array* keyed;
+    int                    values[6] = { 5, 3, 0, 4, 1, 2 };
+
+    result = true;
+    arr    = d_sorted_array_new(sizeof(int), d_test_sorted_array_compare_int);
+    keyed  = d_sorted_array_new_keyed(sizeof(struct d_test_sorted_array_record),
+                                      D_SORTED_ARRAY_KEY_INT64,
+                                      offsetof(struct d_test_sorted_array_record, key));
+
+    // test 1: empty arrays
+    result = d_assert_standalone(
+        (arr) &&
+        (keyed) &&
+        (d_sorted_array_is_empty(arr)) &&
+        (d_sorted_array_is_empty(keyed)) &&
+        (keyed->key == D_SORTED_ARRAY_KEY_INT64) &&
+        (d_sorted_array_front(arr) == NULL),
+        "new_empty",
+        "New arrays should be empty",
+        _counter) && result;
+
+    // test 2: invalid parameters
+    result = d_assert_standalone(
+        (d_sorted_array_new(0, d_test_sorted_array_compare_int) == NULL) &&
+        (d_sorted_array_new(sizeof(int), NULL) == NULL) &&
+        (d_sorted_array_new_keyed(sizeof(int),
+                                  D_SORTED_ARRAY_KEY_INT64,
+                                  0) == NULL) &&
+        (d_sorted_array_new_keyed(8,
+                                  D_SORTED_ARRAY_KEY_INT32,
+                                  5) == NULL) &&
+        (d_sorted_array_new_keyed(8,
+                                  D_SORTED_ARRAY_KEY_COMPARATOR,
+                                  0) == NULL),
+        "new_invalid",
+        "Invalid sizes, comparators and key offsets should return NULL",
+        _counter) && result;
+
+    d_sorted_array_free(arr);
+
+    // test 3: new_from_arr
+    arr = d_sorted_array_new_from_arr(sizeof(int),
+                                      d_test_sorted_array_compare_int,
+                                      values,
+                                      6);
+
+    result = d_assert_standalone(
+        (d_test_sorted_array_is_range(arr, 6)) &&
+        (*(int*)d_sorted_array_back(arr) == 5),
+        "new_from_arr",
+        "new_from_arr should hold the source in sorted order",
+        _counter) && result;
+
+    d_sorted_array_free(arr);
+    d_sorted_array_free(keyed);
+
+    return result;
+}
+
+
+/*
+d_tests_sa_sorted_array_insert
+  Tests the d_sorted_array_insert function.
+  Tests the following:
+  - single inserts in arbitrary order end up sorted, growing the buffer
+  - equal elements are placed after existing ones
+*/
+bool
+d_tests_sa_sorted_array_insert
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                              result;
+    struct d_sorted_array*            arr;
+    struct d_test_sorted_array_record record;
+    int                               i;
+    int                               value;
+
+    result = true;
+    arr    = d_sorted_array_new(sizeof(int), d_test_sorted_array_compare_int);
+
+    // insert a permutation of 0..99
+    for (i = 0; i < 100; i++)
+    {
+        value = (i * 37) % 100;
+        d_sorted_array_insert(arr, &value);
+    }
+
+    // test 1: sorted after single inserts
+    result = d_assert_standalone(
+        (d_test_sorted_array_is_range(arr, 100)) &&
+        (d_sorted_array_capacity(arr) >= 100) &&
+        (d_sorted_array_is_sorted(arr)),
+        "insert_sorted",
+        "Single inserts should keep the array sorted",
+        _counter) && result;
+
+    d_sorted_array_free(arr);
+
+    // test 2: stability of single inserts
+    arr = d_sorted_array_new(sizeof(struct d_test_sorted_array_record),
+                             d_test_sorted_array_compare_record);
+
+    for (i = 0; i < 60; i++)
+    {
+        record.seq = i;
+        record.key = (i * 7) % 5;
+        d_sorted_array_insert(arr, &record);
+    }
+
+    result = d_assert_standalone(
+        d_test_sorted_array_is_stable(arr),
+        "insert_stable",
+        "Equal elements should keep insertion order",
+        _counter) && result;
+
+    // test 3: invalid parameters
+    result = d_assert_standalone(
+        (!d_sorted_array_insert(arr, NULL)) &&
+        (!d_sorted_array_insert(NULL, &record)) &&
+        (d_sorted_array_count(arr) == 60),
+        "insert_invalid",
+        "NULL arguments should be rejected",
+        _counter) && result;
+
+    d_sorted_array_free(arr);
+
+    return result;
+}
+
+
+/*
+d_tests_sa_sorted_array_insert_all
+  Tests the d_sorted_array_insert_all function.
+  Tests the following:
+  - a large unsorted batch into an empty array
+  - batches interleaving with existing elements
+  - keyed arrays merge without a comparator
+  - empty and invalid batches
+*/
+bool
+d_tests_sa_sorted_array_insert_all
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                              result;
+    struct d_sorted_array*            arr;
+    struct d_test_sorted_array_record records[500];
+    int*                              values;
+    bool                              ordered;
+    int                               i;
+
+    result = true;
+    values = malloc(1000 * sizeof(int));
+    arr    = d_sorted_array_new(sizeof(int), d_test_sorted_array_compare_int);
+
+    if (!values)
+    {
+        d_sorted_array_free(arr);
+
+        return d_assert_standalone(false,
+                                   "insert_all_alloc",
+                                   "Allocation of test values failed",
+                                   _counter);
+    }
+
+    // odd numbers first, descending
+    for (i = 0; i < 500; i++)
+    {
+        values[i] = 999 - (2 * i);
+    }
+
+    d_sorted_array_insert_all(arr, values, 500);
+
+    // test 1: batch into an empty array
+    ordered = (d_sorted_array_count(arr) == 500);
+
+    for (i = 0; (ordered) && (i < 500); i++)
+    {
+        ordered = (*(int*)d_sorted_array_get(arr, i) == (2 * i) + 1);
+    }
+
+    result = d_assert_standalone(
+        ordered,
+        "insert_all_empty",
+        "A reversed batch should be sorted on insertion",
+        _counter) && result;
+
+    // even numbers in a scrambled order
+    for (i = 0; i < 500; i++)
+    {
+        values[i] = 2 * ((i * 211) % 500);
+    }
+
+    d_sorted_array_insert_all(arr, values, 500);
+
+    // test 2: interleaving merge
+    result = d_assert_standalone(
+        d_test_sorted_array_is_range(arr, 1000),
+        "insert_all_merge",
+        "A batch should merge with existing elements",
+        _counter) && result;
+
+    // test 3: empty and invalid batches
+    result = d_assert_standalone(
+        (d_sorted_array_insert_all(arr, NULL, 0)) &&
+        (!d_sorted_array_insert_all(arr, NULL, 4)) &&
+        (!d_sorted_array_insert_all(NULL, values, 4)) &&
+        (d_sorted_array_count(arr) == 1000),
+        "insert_all_invalid",
+        "Empty batches succeed; invalid ones leave the array unchanged",
+        _counter) && result;
+
+    d_sorted_array_free(arr);
+    free(values);
+
+    // test 4: keyed merge, including negative keys
+    arr = d_sorted_array_new_keyed(sizeof(struct d_test_sorted_array_record),
+                                   D_SORTED_ARRAY_KEY_INT64,
+                                   offsetof(struct d_test_sorted_array_record, key));
+
+    for (i = 0; i < 500; i++)
+    {
+        records[i].seq = i;
+        records[i].key = (int64_t)((i * 163) % 500) - 250;
+    }
+
+    d_sorted_array_insert_all(arr, records, 250);
+    d_sorted_array_insert_all(arr, records + 250, 250);
+
+    result = d_assert_standalone(
+        (d_sorted_array_count(arr) == 500) &&
+        (d_sorted_array_is_sorted(arr)) &&
+        (((struct d_test_sorted_array_record*)d_sorted_array_front(arr))->key == -250) &&
+        (((struct d_test_sorted_array_record*)d_sorted_array_back(arr))->key == 249),
+        "insert_all_keyed",
+        "Keyed batches should merge by key",
+        _counter) && result;
+
+    d_sorted_array_free(arr);
+
+    return result;
+}
+
+
+/*
+d_tests_sa_sorted_array_insert_all_stable
+  Tests stability of d_sorted_array_insert_all.
+  Tests the following:
+  - equal keys within a batch keep their batch order
+  - equal keys across batches place existing elements first
+*/
+bool
+d_tests_sa_sorted_array_insert_all_stable
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                              result;
+    struct d_sorted_array*            arr;
+    struct d_test_sorted_array_record records[300];
+    int                               i;
+
+    result = true;
+    arr    = d_sorted_array_new(sizeof(struct d_test_sorted_array_record),
+                                d_test_sorted_array_compare_record);
+
+    // few distinct keys, seq increasing across both batches
+    for (i = 0; i < 300; i++)
+    {
+        records[i].seq = i;
+        records[i].key = (i * 13) % 7;
+    }
+
+    d_sorted_array_insert_all(arr, records, 100);
+
+    // test 1: within one batch
+    result = d_assert_standalone(
+        d_test_sorted_array_is_stable(arr),
+        "insert_all_stable_batch",
+        "Equal keys within a batch should keep their order",
+        _counter) && result;
+
+    d_sorted_array_insert_all(arr, records + 100, 200);
+
+    // test 2: across batches
+    result = d_assert_standalone(
+        (d_sorted_array_count(arr) == 300) &&
+        (d_test_sorted_array_is_stable(arr)),
+        "insert_all_stable_merge",
+        "Existing elements should precede equal new ones",
+        _counter) && result;
+
+    d_sorted_array_free(arr);
+
+    return result;
+}
+
+
+/*
+d_tests_sa_sorted_array_remove
+  Tests removal and clearing.
+  Tests the following:
+  - remove by value takes the first equal element
+  - remove_at with negative indices
+  - missing values and bad indices fail
+  - clear keeps the buffer
+*/
+bool
+d_tests_sa_sorted_array_remove
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                   result;
+    struct d_sorted_array* arr;
+    int                    values[8] = { 1, 2, 2, 3, 5, 8, 13, 21 };
+    int                    probe;
+    size_t                 capacity;
+
+    result = true;
+    arr    = d_sorted_array_new_from_arr(sizeof(int),
+                                         d_test_sorted_array_compare_int,
+                                         values,
+                                         8);
+    probe  = 2;
+
+    // test 1: remove by value
+    result = d_assert_standalone(
+        (d_sorted_array_remove(arr, &probe)) &&
+        (d_sorted_array_count(arr) == 7) &&
+        (d_sorted_array_count_equal(arr, &probe) == 1),
+        "remove_value",
+        "Removing a duplicated value should remove one copy",
+        _counter) && result;
+
+    // test 2: remove_at, negative index
+    result = d_assert_standalone(
+        (d_sorted_array_remove_at(arr, -1)) &&
+        (*(int*)d_sorted_array_back(arr) == 13) &&
+        (d_sorted_array_remove_at(arr, 0)) &&
+        (*(int*)d_sorted_array_front(arr) == 2),
+        "remove_at",
+        "remove_at should accept negative indices",
+        _counter) && result;
+
+    probe = 4;
+
+    // test 3: failures
+    result = d_assert_standalone(
+        (!d_sorted_array_remove(arr, &probe)) &&
+        (!d_sorted_array_remove_at(arr, 5)) &&
+        (!d_sorted_array_remove_at(arr, -6)) &&
+        (d_sorted_array_count(arr) == 5),
+        "remove_missing",
+        "Missing values and out-of-range indices should fail",
+        _counter) && result;
+
+    // test 4: clear
+    capacity = d_sorted_array_capacity(arr);
+
+    result = d_assert_standalone(
+        (d_sorted_array_clear(arr)) &&
+        (d_sorted_array_is_empty(arr)) &&
+        (d_sorted_array_capacity(arr) == capacity) &&
+        (d_sorted_array_reserve(arr, 1000)) &&
+        (d_sorted_array_capacity(arr) >= 1000),
+        "remove_clear",
+        "clear should keep the buffer; reserve should grow it",
+        _counter) && result;
+
+    d_sorted_array_free(arr);
+
+    return result;
+}
+
+
+/*
+d_tests_sa_sorted_array_modification_all
+  Aggregation function that runs all constructor and modification tests.
+*/
+bool
+d_tests_sa_sorted_array_modification_all
+(
+    struct d_test_counter* _counter
+)
+{
+    bool result;
+
+    result = true;
+
+    printf("\n  [SECTION] Constructor and Modification Functions\n");
+    printf("  ------------------------------------------------\n");
+
+    result = d_tests_sa_sorted_array_new(_counter) && result;
+    result = d_tests_sa_sorted_array_insert(_counter) && result;
+    result = d_tests_sa_sorted_array_insert_all(_counter) && result;
+    result = d_tests_sa_sorted_array_insert_all_stable(_counter) && result;
+    result = d_tests_sa_sorted_array_remove(_counter) && result;
+
+    return result;
+}
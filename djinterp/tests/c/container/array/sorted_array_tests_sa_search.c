@@ -0,0 +1,444 @@
+#include "./sorted_array_tests_sa.h"
+
+
+///////////////////////////////////////////////////////////////////////////////
+// file-scope helpers
+///////////////////////////////////////////////////////////////////////////////
+
+// helper: orders ints
+static int
+d_test_sorted_array_compare_int
+(
+    const void* _a,
+    const void* _b
+)
+{
+    return (*(const int*)_a > *(const int*)_b) -
+           (*(const int*)_a < *(const int*)_b);
+}
+
+#if D_CFG_CONTAINER_FILTER_ARRAY_SORTED
+// helper: true for even ints
+static bool
+d_test_sorted_array_is_even
+(
+    const void* _element,
+    void*       _context
+)
+{
+    (void)_context;
+
+    return (*(const int*)_element % 2) == 0;
+}
+#endif  // D_CFG_CONTAINER_FILTER_ARRAY_SORTED
+
+// helper: reference lower bound by linear scan over 3 * i (i < count)
+static size_t
+d_test_sorted_array_linear_lower
+(
+    int _count,
+    int _probe
+)
+{
+    int i;
+
+    for (i = 0; (i < _count) && ((3 * i) < _probe); i++)
+    {
+    }
+
+    return (size_t)i;
+}
+
+// helper: array of ints 0, 3, 6, ... with `_count` elements
+static struct d_sorted_array*
+d_test_sorted_array_multiples
+(
+    int _count
+)
+{
+    struct d_sorted_array* arr;
+    int                    value;
+    int                    i;
+
+    arr = d_sorted_array_new(sizeof(int), d_test_sorted_array_compare_int);
+
+    for (i = 0; (arr) && (i < _count); i++)
+    {
+        value = 3 * i;
+        d_sorted_array_insert(arr, &value);
+    }
+
+    return arr;
+}
+
+
+/******************************************************************************
+ * II. SEARCH, SNAPSHOT AND FILTER FUNCTION TESTS
+ *****************************************************************************/
+
+/*
+d_tests_sa_sorted_array_bounds
+  Tests lower_bound, upper_bound, find and count_equal.
+  Tests the following:
+  - lower_bound agrees with a linear scan for every size and probe
+  - duplicates: bounds bracket the run and find returns its start
+  - NULL arguments
+*/
+bool
+d_tests_sa_sorted_array_bounds
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                   result;
+    struct d_sorted_array* arr;
+    int                    values[9] = { 1, 4, 4, 4, 4, 7, 7, 9, 12 };
+    int                    count;
+    int                    probe;
+    bool                   agree;
+
+    result = true;
+    agree  = true;
+
+    // every size 0..40 catches off-by-one errors in the halving loop
+    for (count = 0; (agree) && (count <= 40); count++)
+    {
+        arr = d_test_sorted_array_multiples(count);
+
+        for (probe = -1; (agree) && (probe <= (3 * count) + 1); probe++)
+        {
+            agree = (d_sorted_array_lower_bound(arr, &probe) ==
+                     d_test_sorted_array_linear_lower(count, probe)) &&
+                    (d_sorted_array_contains(arr, &probe) ==
+                     ( (probe >= 0) && (probe % 3 == 0) && (probe < 3 * count) ));
+        }
+
+        d_sorted_array_free(arr);
+    }
+
+    // test 1: agreement with a linear scan
+    result = d_assert_standalone(
+        agree,
+        "bounds_linear",
+        "lower_bound should match a linear scan for all sizes",
+        _counter) && result;
+
+    arr   = d_sorted_array_new_from_arr(sizeof(int),
+                                        d_test_sorted_array_compare_int,
+                                        values,
+                                        9);
+    probe = 4;
+
+    // test 2: runs of duplicates
+    result = d_assert_standalone(
+        (d_sorted_array_lower_bound(arr, &probe) == 1) &&
+        (d_sorted_array_upper_bound(arr, &probe) == 5) &&
+        (d_sorted_array_find(arr, &probe) == 1) &&
+        (d_sorted_array_count_equal(arr, &probe) == 4),
+        "bounds_duplicates",
+        "Bounds should bracket a run of equal elements",
+        _counter) && result;
+
+    probe = 13;
+
+    // test 3: past the end and NULL arguments
+    result = d_assert_standalone(
+        (d_sorted_array_lower_bound(arr, &probe) == 9) &&
+        (d_sorted_array_find(arr, &probe) == -1) &&
+        (d_sorted_array_find(NULL, &probe) == -1) &&
+        (d_sorted_array_lower_bound(arr, NULL) == 0),
+        "bounds_edges",
+        "Probes past the end and NULL arguments should be handled",
+        _counter) && result;
+
+    d_sorted_array_free(arr);
+
+    return result;
+}
+
+
+/*
+d_tests_sa_sorted_array_keyed_search
+  Tests searches on integer-keyed arrays.
+  Tests the following:
+  - typed lower bounds agree with element-shaped probes
+  - out-of-range keys for 32-bit and unsigned key types
+  - comparator arrays reject the typed entry points
+*/
+bool
+d_tests_sa_sorted_array_keyed_search
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                              result;
+    struct d_sorted_array*            arr;
+    struct d_sorted_array*            unsigned_arr;
+    struct d_sorted_array*            plain;
+    struct d_test_sorted_array_record record;
+    uint32_t                          u;
+    int                               i;
+    bool                              agree;
+
+    result       = true;
+    arr          = d_sorted_array_new_keyed(sizeof(struct d_test_sorted_array_record),
+                                            D_SORTED_ARRAY_KEY_INT64,
+                                            offsetof(struct d_test_sorted_array_record, key));
+    unsigned_arr = d_sorted_array_new_keyed(sizeof(uint32_t),
+                                            D_SORTED_ARRAY_KEY_UINT32,
+                                            0);
+    plain        = d_test_sorted_array_multiples(10);
+
+    // keys -100, -90, ..., 90
+    for (i = 0; i < 20; i++)
+    {
+        record.seq = i;
+        record.key = (int64_t)(i * 10) - 100;
+        d_sorted_array_insert(arr, &record);
+
+        // 0, 0x10000000, ..., 0xF0000000
+        if (i < 16)
+        {
+            u = (uint32_t)i * 0x10000000u;
+            d_sorted_array_insert(unsigned_arr, &u);
+        }
+    }
+
+    agree = true;
+
+    for (i = -110; (agree) && (i <= 110); i++)
+    {
+        record.key = i;
+        agree      = (d_sorted_array_lower_bound_int(arr, i) ==
+                      d_sorted_array_lower_bound(arr, &record));
+    }
+
+    // test 1: typed and probe searches agree
+    result = d_assert_standalone(
+        (agree) &&
+        (d_sorted_array_lower_bound_int(arr, -100) == 0) &&
+        (d_sorted_array_lower_bound_int(arr, -95) == 1) &&
+        (d_sorted_array_lower_bound_int(arr, 91) == 20),
+        "keyed_search_int",
+        "Typed lower bounds should match element-shaped probes",
+        _counter) && result;
+
+    u = 0xF0000000u;
+
+    // test 2: unsigned keys above INT32_MAX and negative probes
+    result = d_assert_standalone(
+        (d_sorted_array_count(unsigned_arr) == 16) &&
+        (d_sorted_array_find(unsigned_arr, &u) == 15) &&
+        (d_sorted_array_lower_bound_uint(unsigned_arr, 0x80000001u) == 9) &&
+        (d_sorted_array_lower_bound_int(unsigned_arr, -5) == 0) &&
+        (d_sorted_array_lower_bound_uint(unsigned_arr, UINT64_MAX) == 16) &&
+        (d_sorted_array_lower_bound_uint(arr, UINT64_MAX) == 20),
+        "keyed_search_range",
+        "Keys outside a type's range should land at either end",
+        _counter) && result;
+
+    // test 3: comparator arrays
+    result = d_assert_standalone(
+        (d_sorted_array_lower_bound_int(plain, 6) == 0) &&
+        (d_sorted_array_lower_bound_uint(NULL, 6) == 0),
+        "keyed_search_comparator",
+        "Typed searches on comparator arrays should return 0",
+        _counter) && result;
+
+    d_sorted_array_free(arr);
+    d_sorted_array_free(unsigned_arr);
+    d_sorted_array_free(plain);
+
+    return result;
+}
+
+
+/*
+d_tests_sa_sorted_array_snapshot
+  Tests the Eytzinger snapshot.
+  Tests the following:
+  - snapshot lower bounds match the array for every size and probe
+  - keyed snapshots, typed and probe entry points
+  - find, and probes past the largest element
+  - the snapshot is independent of later changes to the array
+*/
+bool
+d_tests_sa_sorted_array_snapshot
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                            result;
+    struct d_sorted_array*          arr;
+    struct d_sorted_array_snapshot* snapshot;
+    const int*                      found;
+    size_t                          index;
+    int                             count;
+    int                             probe;
+    int64_t                         key;
+    bool                            agree;
+
+    result = true;
+    agree  = true;
+
+    for (count = 0; (agree) && (count <= 70); count++)
+    {
+        arr      = d_test_sorted_array_multiples(count);
+        snapshot = d_sorted_array_snapshot_new(arr);
+        agree    = (snapshot != NULL);
+
+        for (probe = -1; (agree) && (probe <= (3 * count) + 1); probe++)
+        {
+            index = d_sorted_array_lower_bound(arr, &probe);
+            found = d_sorted_array_snapshot_lower_bound(snapshot, &probe);
+            agree = (index == (size_t)count)
+                        ? (found == NULL)
+                        : ( (found) &&
+                            (*found == *(int*)d_sorted_array_get(arr, (d_index)index)) );
+        }
+
+        d_sorted_array_snapshot_free(snapshot);
+        d_sorted_array_free(arr);
+    }
+
+    // test 1: comparator snapshots
+    result = d_assert_standalone(
+        agree,
+        "snapshot_comparator",
+        "Snapshot lower bounds should match the array",
+        _counter) && result;
+
+    arr = d_sorted_array_new_keyed(sizeof(int64_t), D_SORTED_ARRAY_KEY_INT64, 0);
+
+    for (key = -500; key < 500; key += 5)
+    {
+        d_sorted_array_insert(arr, &key);
+    }
+
+    snapshot = d_sorted_array_snapshot_new(arr);
+    agree    = (snapshot != NULL);
+
+    for (key = -510; (agree) && (key <= 510); key++)
+    {
+        const int64_t* typed;
+
+        index = d_sorted_array_lower_bound_int(arr, key);
+        typed = d_sorted_array_snapshot_lower_bound_int(snapshot, key);
+        agree = (index == d_sorted_array_count(arr))
+                    ? (typed == NULL)
+                    : ( (typed) &&
+                        (*typed == *(int64_t*)d_sorted_array_get(arr, (d_index)index)) &&
+                        (typed == d_sorted_array_snapshot_lower_bound(snapshot, &key)) );
+    }
+
+    // test 2: keyed snapshots
+    result = d_assert_standalone(
+        agree,
+        "snapshot_keyed",
+        "Typed snapshot searches should match the array",
+        _counter) && result;
+
+    key = 45;
+
+    // test 3: find and independence from the array
+    d_sorted_array_clear(arr);
+
+    result = d_assert_standalone(
+        (d_sorted_array_snapshot_find(snapshot, &key) != NULL) &&
+        (*(const int64_t*)d_sorted_array_snapshot_find(snapshot, &key) == 45) &&
+        (d_sorted_array_snapshot_lower_bound_uint(snapshot, UINT64_MAX) == NULL) &&
+        (d_sorted_array_snapshot_find(NULL, &key) == NULL),
+        "snapshot_find",
+        "A snapshot should answer finds after the array changes",
+        _counter) && result;
+
+    key = 46;
+
+    // test 4: miss
+    result = d_assert_standalone(
+        d_sorted_array_snapshot_find(snapshot, &key) == NULL,
+        "snapshot_find_miss",
+        "Finding a missing key should return NULL",
+        _counter) && result;
+
+    d_sorted_array_snapshot_free(snapshot);
+    d_sorted_array_free(arr);
+
+    return result;
+}
+
+
+/*
+d_tests_sa_sorted_array_filter
+  Tests the filter adaptors (when enabled).
+  Tests the following:
+  - count_where counts matching elements
+  - filter_in_place keeps the remaining elements sorted
+*/
+bool
+d_tests_sa_sorted_array_filter
+(
+    struct d_test_counter* _counter
+)
+{
+#if D_CFG_CONTAINER_FILTER_ARRAY_SORTED
+    bool                   result;
+    struct d_sorted_array* arr;
+    int                    probe;
+
+    result = true;
+    arr    = d_test_sorted_array_multiples(20);
+
+    // test 1: count_where
+    result = d_assert_standalone(
+        d_sorted_array_count_where(arr, d_test_sorted_array_is_even, NULL) == 10,
+        "filter_count_where",
+        "count_where should count the even multiples of 3",
+        _counter) && result;
+
+    probe = 18;
+
+    // test 2: filter_in_place
+    result = d_assert_standalone(
+        (d_sorted_array_filter_in_place(arr, d_test_sorted_array_is_even, NULL) == 10) &&
+        (d_sorted_array_is_sorted(arr)) &&
+        (d_sorted_array_find(arr, &probe) == 3),
+        "filter_in_place",
+        "filter_in_place should leave a sorted, searchable array",
+        _counter) && result;
+
+    d_sorted_array_free(arr);
+
+    return result;
+#else
+    (void)_counter;
+
+    return true;
+#endif  // D_CFG_CONTAINER_FILTER_ARRAY_SORTED
+}
+
+
+/*
+d_tests_sa_sorted_array_search_all
+  Aggregation function that runs all search, snapshot and filter tests.
+*/
+bool
+d_tests_sa_sorted_array_search_all
+(
+    struct d_test_counter* _counter
+)
+{
+    bool result;
+
+    result = true;
+
+    printf("\n  [SECTION] Search, Snapshot and Filter Functions\n");
+    printf("  -----------------------------------------------\n");
+
+    result = d_tests_sa_sorted_array_bounds(_counter) && result;
+    result = d_tests_sa_sorted_array_keyed_search(_counter) && result;
+    result = d_tests_sa_sorted_array_snapshot(_counter) && result;
+    result = d_tests_sa_sorted_array_filter(_counter) && result;
+
+    return result;
+}
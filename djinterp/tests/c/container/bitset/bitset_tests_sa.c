@@ -0,0 +1,28 @@
+#include "./bitset_tests_sa.h"
+
+
+/*
+d_tests_sa_bitset_run_all
+  Module-level aggregation function that runs all bitset tests.
+  Executes tests for all categories:
+  - Construction and access
+  - Queries
+  - Set algebra
+*/
+bool
+d_tests_sa_bitset_run_all
+(
+    struct d_test_counter* _counter
+)
+{
+    bool result;
+
+    result = true;
+
+    // run all test categories
+    result = d_tests_sa_bitset_access_all(_counter) && result;
+    result = d_tests_sa_bitset_query_all(_counter) && result;
+    result = d_tests_sa_bitset_algebra_all(_counter) && result;
+
+    return result;
+}
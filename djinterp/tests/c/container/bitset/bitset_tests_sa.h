@@ -0,0 +1,67 @@
+/******************************************************************************
+* djinterp [test]                                           bitset_tests_sa.h
+*
+*   Unit test declarations for `bitset.h` module.
+*   Covers construction, single-bit and range access, resizing, popcount,
+* rank/select/next queries, and the in-place set algebra including the
+* vectorized word kernels.
+*
+*
+* path:      /tests/container/bitset/bitset_tests_sa.h
+* link(s):   TBA
+* author(s): Samuel 'teer' Neal-Blim                          date: 2026.10.18
+******************************************************************************/
+
+#ifndef DJINTERP_TESTS_BITSET_SA_
+#define DJINTERP_TESTS_BITSET_SA_ 1
+
+#include <stdlib.h>
+#include "../../../../inc/c/djinterp.h"
+#include "../../../../inc/c/dmemory.h"
+#include "../../../../inc/c/test/test_standalone.h"
+#include "../../../../inc/c/container/bitset/bitset.h"
+
+
+/******************************************************************************
+ * I. CONSTRUCTION AND ACCESS TESTS
+ *****************************************************************************/
+bool d_tests_sa_bitset_new(struct d_test_counter* _counter);
+bool d_tests_sa_bitset_set_reset(struct d_test_counter* _counter);
+bool d_tests_sa_bitset_set_range(struct d_test_counter* _counter);
+bool d_tests_sa_bitset_resize(struct d_test_counter* _counter);
+
+// I.   aggregation function
+bool d_tests_sa_bitset_access_all(struct d_test_counter* _counter);
+
+
+/******************************************************************************
+ * II. QUERY TESTS
+ *****************************************************************************/
+bool d_tests_sa_bitset_count(struct d_test_counter* _counter);
+bool d_tests_sa_bitset_rank_select(struct d_test_counter* _counter);
+bool d_tests_sa_bitset_next(struct d_test_counter* _counter);
+bool d_tests_sa_bitset_to_indices(struct d_test_counter* _counter);
+
+// II.  aggregation function
+bool d_tests_sa_bitset_query_all(struct d_test_counter* _counter);
+
+
+/******************************************************************************
+ * III. SET ALGEBRA TESTS
+ *****************************************************************************/
+bool d_tests_sa_bitset_and_or(struct d_test_counter* _counter);
+bool d_tests_sa_bitset_xor_andnot(struct d_test_counter* _counter);
+bool d_tests_sa_bitset_mismatched_sizes(struct d_test_counter* _counter);
+bool d_tests_sa_bitset_words(struct d_test_counter* _counter);
+
+// III. aggregation function
+bool d_tests_sa_bitset_algebra_all(struct d_test_counter* _counter);
+
+
+/******************************************************************************
+ * MODULE-LEVEL AGGREGATION
+ *****************************************************************************/
+bool d_tests_sa_bitset_run_all(struct d_test_counter* _counter);
+
+
+#endif  // DJINTERP_TESTS_BITSET_SA_
@@ -0,0 +1,297 @@
+#include "./bitset_tests_sa.h"
+
+
+/******************************************************************************
+ * I. CONSTRUCTION AND ACCESS TESTS
+ *****************************************************************************/
+
+/*
+d_tests_sa_bitset_new
+  Tests the bitset constructors.
+  Tests the following:
+  - a new bitset is all clear with the right word count
+  - a copy is independent of its source
+  - construction from indices sets exactly those bits
+  - an out-of-range index is rejected
+*/
+bool
+d_tests_sa_bitset_new
+(
+    struct d_test_counter* _counter
+)
+{
+    bool             result;
+    struct d_bitset* bits;
+    struct d_bitset* copy;
+    size_t           indices[4] = { 129, 0, 64, 63 };
+
+    result = true;
+
+    // test 1: empty bitsets
+    bits = d_bitset_new(130);
+
+    result = d_assert_standalone(
+        (bits != NULL) &&
+        (d_bitset_size(bits) == 130) &&
+        (bits->word_count == 3) &&
+        (d_bitset_count(bits) == 0) &&
+        (!d_bitset_any(bits)),
+        "new_clear",
+        "A new bitset of 130 bits should use 3 clear words",
+        _counter) && result;
+
+    d_bitset_free(bits);
+
+    // test 2: from indices and copy
+    bits = d_bitset_new_from_indices(130, indices, 4);
+    copy = d_bitset_new_copy(bits);
+
+    d_bitset_reset(bits, 0);
+
+    result = d_assert_standalone(
+        (copy != NULL) &&
+        (d_bitset_count(copy) == 4) &&
+        (d_bitset_test(copy, 0)) &&
+        (d_bitset_test(copy, 129)) &&
+        (!d_bitset_test(bits, 0)) &&
+        (!d_bitset_equals(bits, copy)),
+        "new_from_indices_copy",
+        "Indices should be set and the copy independent",
+        _counter) && result;
+
+    d_bitset_free(bits);
+    d_bitset_free(copy);
+
+    // test 3: invalid input
+    indices[0] = 130;
+
+    result = d_assert_standalone(
+        (d_bitset_new_from_indices(130, indices, 4) == NULL) &&
+        (d_bitset_new_from_indices(130, NULL, 1) == NULL) &&
+        (d_bitset_new_copy(NULL) == NULL),
+        "new_invalid",
+        "Out-of-range indices or NULL sources should be rejected",
+        _counter) && result;
+
+    return result;
+}
+
+
+/*
+d_tests_sa_bitset_set_reset
+  Tests d_bitset_set, d_bitset_reset, d_bitset_flip and d_bitset_test.
+  Tests the following:
+  - single bits on both sides of a word boundary
+  - out-of-range positions fail
+  - set_all keeps bits past the size clear
+*/
+bool
+d_tests_sa_bitset_set_reset
+(
+    struct d_test_counter* _counter
+)
+{
+    bool             result;
+    struct d_bitset* bits;
+
+    result = true;
+    bits   = d_bitset_new(70);
+
+    // test 1: single bits
+    result = d_assert_standalone(
+        (d_bitset_set(bits, 63)) &&
+        (d_bitset_set(bits, 64)) &&
+        (d_bitset_flip(bits, 69)) &&
+        (d_bitset_reset(bits, 63)) &&
+        (!d_bitset_test(bits, 63)) &&
+        (d_bitset_test(bits, 64)) &&
+        (d_bitset_test(bits, 69)) &&
+        (d_bitset_count(bits) == 2),
+        "set_reset_flip",
+        "Bit operations should affect only their bit",
+        _counter) && result;
+
+    // test 2: out of range
+    result = d_assert_standalone(
+        (!d_bitset_set(bits, 70)) &&
+        (!d_bitset_reset(bits, 70)) &&
+        (!d_bitset_flip(bits, 70)) &&
+        (!d_bitset_test(bits, 70)) &&
+        (!d_bitset_set(NULL, 0)),
+        "set_out_of_range",
+        "Positions past the size should be rejected",
+        _counter) && result;
+
+    // test 3: set_all / reset_all
+    result = d_assert_standalone(
+        (d_bitset_set_all(bits)) &&
+        (d_bitset_count(bits) == 70) &&
+        (bits->words[1] == 0x3F) &&
+        (d_bitset_reset_all(bits)) &&
+        (!d_bitset_any(bits)),
+        "set_all",
+        "set_all should set exactly `size` bits",
+        _counter) && result;
+
+    d_bitset_free(bits);
+
+    return result;
+}
+
+
+/*
+d_tests_sa_bitset_set_range
+  Tests the d_bitset_set_range function.
+  Tests the following:
+  - a range inside one word
+  - a range spanning partial and whole words
+  - a range ending on a word boundary
+  - a range past the end fails
+*/
+bool
+d_tests_sa_bitset_set_range
+(
+    struct d_test_counter* _counter
+)
+{
+    bool             result;
+    struct d_bitset* bits;
+
+    result = true;
+    bits   = d_bitset_new(300);
+
+    // test 1: inside one word
+    result = d_assert_standalone(
+        (d_bitset_set_range(bits, 3, 5)) &&
+        (bits->words[0] == 0xF8) &&
+        (d_bitset_set_range(bits, 0, 0)),
+        "set_range_word",
+        "Bits 3..7 should be set",
+        _counter) && result;
+
+    d_bitset_reset_all(bits);
+
+    // test 2: spanning words [60, 200)
+    result = d_assert_standalone(
+        (d_bitset_set_range(bits, 60, 140)) &&
+        (d_bitset_count(bits) == 140) &&
+        (!d_bitset_test(bits, 59)) &&
+        (d_bitset_test(bits, 60)) &&
+        (d_bitset_test(bits, 199)) &&
+        (!d_bitset_test(bits, 200)),
+        "set_range_span",
+        "A range across words should set exactly its bits",
+        _counter) && result;
+
+    d_bitset_reset_all(bits);
+
+    // test 3: ending on a word boundary, and a whole aligned word
+    result = d_assert_standalone(
+        (d_bitset_set_range(bits, 100, 28)) &&
+        (d_bitset_set_range(bits, 192, 64)) &&
+        (bits->words[1] == 0xFFFFFFF000000000ULL) &&
+        (bits->words[3] == ~(uint64_t)0) &&
+        (d_bitset_count(bits) == 92),
+        "set_range_boundary",
+        "Ranges ending on a word boundary should fill the word",
+        _counter) && result;
+
+    // test 4: out of range
+    result = d_assert_standalone(
+        (!d_bitset_set_range(bits, 290, 11)) &&
+        (!d_bitset_set_range(bits, 301, 0)),
+        "set_range_invalid",
+        "Ranges past the end should fail",
+        _counter) && result;
+
+    d_bitset_free(bits);
+
+    return result;
+}
+
+
+/*
+d_tests_sa_bitset_resize
+  Tests the d_bitset_resize function.
+  Tests the following:
+  - growing keeps bits and adds clear bits
+  - shrinking clears bits past the new size in the last word
+  - resizing to 0
+*/
+bool
+d_tests_sa_bitset_resize
+(
+    struct d_test_counter* _counter
+)
+{
+    bool             result;
+    struct d_bitset* bits;
+
+    result = true;
+    bits   = d_bitset_new(10);
+
+    d_bitset_set_all(bits);
+
+    // test 1: grow
+    result = d_assert_standalone(
+        (d_bitset_resize(bits, 200)) &&
+        (bits->word_count == 4) &&
+        (d_bitset_count(bits) == 10) &&
+        (!d_bitset_test(bits, 10)),
+        "resize_grow",
+        "Growing should keep bits and add clear ones",
+        _counter) && result;
+
+    // test 2: shrink within a word
+    d_bitset_set(bits, 150);
+
+    result = d_assert_standalone(
+        (d_bitset_resize(bits, 5)) &&
+        (bits->word_count == 1) &&
+        (d_bitset_count(bits) == 5) &&
+        (d_bitset_resize(bits, 64)) &&
+        (d_bitset_count(bits) == 5),
+        "resize_shrink",
+        "Shrinking should drop bits past the new size",
+        _counter) && result;
+
+    // test 3: to zero
+    result = d_assert_standalone(
+        (d_bitset_resize(bits, 0)) &&
+        (bits->words == NULL) &&
+        (d_bitset_count(bits) == 0) &&
+        (!d_bitset_resize(NULL, 1)),
+        "resize_zero",
+        "Resizing to 0 should release the words",
+        _counter) && result;
+
+    d_bitset_free(bits);
+
+    return result;
+}
+
+
+/*
+d_tests_sa_bitset_access_all
+  Aggregation function that runs all construction and access tests.
+*/
+bool
+d_tests_sa_bitset_access_all
+(
+    struct d_test_counter* _counter
+)
+{
+    bool result;
+
+    result = true;
+
+    printf("\n  [SECTION] Construction and Access\n");
+    printf("  ---------------------------------\n");
+
+    result = d_tests_sa_bitset_new(_counter) && result;
+    result = d_tests_sa_bitset_set_reset(_counter) && result;
+    result = d_tests_sa_bitset_set_range(_counter) && result;
+    result = d_tests_sa_bitset_resize(_counter) && result;
+
+    return result;
+}
@@ -0,0 +1,327 @@
+#include "./bitset_tests_sa.h"
+
+
+/******************************************************************************
+ * III. SET ALGEBRA TESTS
+ *****************************************************************************/
+
+/*
+d_tests_sa_bitset_internal_multiples
+  Returns a bitset of `_size` bits with every multiple of `_step` set.
+*/
+static struct d_bitset*
+d_tests_sa_bitset_internal_multiples
+(
+    size_t _size,
+    size_t _step
+)
+{
+    struct d_bitset* bits;
+    size_t           i;
+
+    bits = d_bitset_new(_size);
+
+    for (i = 0; (bits) && (i < _size); i += _step)
+    {
+        d_bitset_set(bits, i);
+    }
+
+    return bits;
+}
+
+
+/*
+d_tests_sa_bitset_and_or
+  Tests d_bitset_and, d_bitset_or and d_bitset_count_and.
+  Tests the following:
+  - multiples of 2 AND multiples of 3 are the multiples of 6
+  - multiples of 2 OR multiples of 3 by inclusion-exclusion
+  - count_and agrees with the materialized intersection
+*/
+bool
+d_tests_sa_bitset_and_or
+(
+    struct d_test_counter* _counter
+)
+{
+    bool             result;
+    struct d_bitset* twos;
+    struct d_bitset* threes;
+    struct d_bitset* sixes;
+    size_t           expected;
+
+    result = true;
+    twos   = d_tests_sa_bitset_internal_multiples(1003, 2);
+    threes = d_tests_sa_bitset_internal_multiples(1003, 3);
+    sixes  = d_tests_sa_bitset_internal_multiples(1003, 6);
+
+    // test 1: count_and before materializing
+    expected = d_bitset_count(sixes);
+
+    result = d_assert_standalone(
+        d_bitset_count_and(twos, threes) == expected,
+        "count_and",
+        "count_and(2k, 3k) should equal the count of 6k",
+        _counter) && result;
+
+    // test 2: or (502 + 335 - 168 = 669)
+    result = d_assert_standalone(
+        (d_bitset_or(twos, threes)) &&
+        (d_bitset_count(twos) == 669),
+        "or",
+        "2k OR 3k should hold 669 values below 1003",
+        _counter) && result;
+
+    // test 3: and (back to the multiples of 3, then of 6)
+    d_bitset_free(twos);
+    twos = d_tests_sa_bitset_internal_multiples(1003, 2);
+
+    result = d_assert_standalone(
+        (d_bitset_and(twos, threes)) &&
+        (d_bitset_equals(twos, sixes)) &&
+        (!d_bitset_and(twos, NULL)),
+        "and",
+        "2k AND 3k should equal 6k",
+        _counter) && result;
+
+    d_bitset_free(twos);
+    d_bitset_free(threes);
+    d_bitset_free(sixes);
+
+    return result;
+}
+
+
+/*
+d_tests_sa_bitset_xor_andnot
+  Tests d_bitset_xor and d_bitset_andnot.
+  Tests the following:
+  - xor with itself clears everything
+  - andnot removes the subtrahend's bits
+  - (a andnot b) or (a and b) == a
+*/
+bool
+d_tests_sa_bitset_xor_andnot
+(
+    struct d_test_counter* _counter
+)
+{
+    bool             result;
+    struct d_bitset* a;
+    struct d_bitset* b;
+    struct d_bitset* only_a;
+    struct d_bitset* both;
+
+    result = true;
+    a      = d_tests_sa_bitset_internal_multiples(777, 5);
+    b      = d_tests_sa_bitset_internal_multiples(777, 7);
+    only_a = d_bitset_new_copy(a);
+    both   = d_bitset_new_copy(a);
+
+    // test 1: andnot
+    result = d_assert_standalone(
+        (d_bitset_andnot(only_a, b)) &&
+        (d_bitset_test(only_a, 5)) &&
+        (!d_bitset_test(only_a, 35)) &&
+        (d_bitset_count(only_a) == d_bitset_count(a) - 23),
+        "andnot",
+        "5k ANDNOT 7k should drop the multiples of 35",
+        _counter) && result;
+
+    // test 2: recombine
+    d_bitset_and(both, b);
+    d_bitset_or(only_a, both);
+
+    result = d_assert_standalone(
+        d_bitset_equals(only_a, a),
+        "andnot_recombine",
+        "(a - b) | (a & b) should equal a",
+        _counter) && result;
+
+    // test 3: xor
+    result = d_assert_standalone(
+        (d_bitset_xor(only_a, a)) &&
+        (!d_bitset_any(only_a)) &&
+        (d_bitset_xor(only_a, b)) &&
+        (d_bitset_equals(only_a, b)),
+        "xor",
+        "a ^ a should be empty and 0 ^ b equal b",
+        _counter) && result;
+
+    d_bitset_free(a);
+    d_bitset_free(b);
+    d_bitset_free(only_a);
+    d_bitset_free(both);
+
+    return result;
+}
+
+
+/*
+d_tests_sa_bitset_mismatched_sizes
+  Tests set algebra between bitsets of different sizes.
+  Tests the following:
+  - and clears destination words past the source
+  - or ignores source bits past the destination's size
+  - andnot leaves destination words past the source unchanged
+*/
+bool
+d_tests_sa_bitset_mismatched_sizes
+(
+    struct d_test_counter* _counter
+)
+{
+    bool             result;
+    struct d_bitset* large;
+    struct d_bitset* small;
+
+    result = true;
+    large  = d_bitset_new(300);
+    small  = d_bitset_new(70);
+
+    d_bitset_set_all(large);
+    d_bitset_set_all(small);
+
+    // test 1: and
+    result = d_assert_standalone(
+        (d_bitset_and(large, small)) &&
+        (d_bitset_count(large) == 70),
+        "mismatched_and",
+        "AND with a shorter bitset should clear the rest",
+        _counter) && result;
+
+    // test 2: or into the shorter one
+    d_bitset_set_all(large);
+    d_bitset_reset_all(small);
+
+    result = d_assert_standalone(
+        (d_bitset_or(small, large)) &&
+        (d_bitset_count(small) == 70) &&
+        (small->words[1] == 0x3F),
+        "mismatched_or",
+        "OR from a longer bitset should stop at the destination size",
+        _counter) && result;
+
+    // test 3: andnot
+    result = d_assert_standalone(
+        (d_bitset_andnot(large, small)) &&
+        (d_bitset_count(large) == 230) &&
+        (d_bitset_test(large, 70)),
+        "mismatched_andnot",
+        "ANDNOT with a shorter bitset should keep the rest",
+        _counter) && result;
+
+    d_bitset_free(large);
+    d_bitset_free(small);
+
+    return result;
+}
+
+
+/*
+d_tests_sa_bitset_words
+  Tests the d_bitset_words_* kernels directly.
+  Tests the following:
+  - lengths that leave a remainder after the vector loop
+  - unaligned word arrays
+  - d_bitset_words_count
+*/
+bool
+d_tests_sa_bitset_words
+(
+    struct d_test_counter* _counter
+)
+{
+    bool     result;
+    uint64_t storage_a[12];
+    uint64_t storage_b[12];
+    uint64_t expected[12];
+    bool     same;
+    size_t   n;
+    size_t   i;
+
+    result = true;
+    same   = true;
+
+    // lengths 0 .. 11, starting at word 1 so vectors straddle alignment
+    for (n = 0; (same) && (n <= 11); n++)
+    {
+        for (i = 0; i < 12; i++)
+        {
+            storage_a[i] = 0x0123456789ABCDEFULL * (i + 1);
+            storage_b[i] = 0xF0F0F0F00F0F0F0FULL ^ (i * 0x1111);
+        }
+
+        for (i = 0; i < 12; i++)
+        {
+            expected[i] = storage_a[i];
+        }
+
+        for (i = 1; i < n + 1; i++)
+        {
+            expected[i] = ((storage_a[i] | storage_b[i]) ^ storage_b[i]) &
+                          ~storage_b[i];
+        }
+
+        d_bitset_words_or(storage_a + 1, storage_b + 1, n);
+        d_bitset_words_xor(storage_a + 1, storage_b + 1, n);
+        d_bitset_words_andnot(storage_a + 1, storage_b + 1, n);
+
+        for (i = 0; (same) && (i < 12); i++)
+        {
+            same = (storage_a[i] == expected[i]);
+        }
+    }
+
+    // test 1: or / xor / andnot
+    result = d_assert_standalone(
+        same,
+        "words_or_xor_andnot",
+        "Kernels should match the scalar result for every length",
+        _counter) && result;
+
+    // test 2: and and count
+    for (i = 0; i < 12; i++)
+    {
+        storage_a[i] = ~(uint64_t)0;
+        storage_b[i] = (uint64_t)i;
+    }
+
+    d_bitset_words_and(storage_a, storage_b, 11);
+
+    result = d_assert_standalone(
+        (storage_a[10] == 10) &&
+        (storage_a[11] == ~(uint64_t)0) &&
+        (d_bitset_words_count(storage_a, 11) == 17),
+        "words_and_count",
+        "AND should stop at the length and count should sum popcounts",
+        _counter) && result;
+
+    return result;
+}
+
+
+/*
+d_tests_sa_bitset_algebra_all
+  Aggregation function that runs all set algebra tests.
+*/
+bool
+d_tests_sa_bitset_algebra_all
+(
+    struct d_test_counter* _counter
+)
+{
+    bool result;
+
+    result = true;
+
+    printf("\n  [SECTION] Set Algebra\n");
+    printf("  ---------------------\n");
+
+    result = d_tests_sa_bitset_and_or(_counter) && result;
+    result = d_tests_sa_bitset_xor_andnot(_counter) && result;
+    result = d_tests_sa_bitset_mismatched_sizes(_counter) && result;
+    result = d_tests_sa_bitset_words(_counter) && result;
+
+    return result;
+}
@@ -0,0 +1,278 @@
+#include "./bitset_tests_sa.h"
+
+
+/******************************************************************************
+ * II. QUERY TESTS
+ *****************************************************************************/
+
+/*
+d_tests_sa_bitset_count
+  Tests d_bitset_count and d_bitset_popcount64.
+  Tests the following:
+  - popcount of edge-case words
+  - count over several words
+*/
+bool
+d_tests_sa_bitset_count
+(
+    struct d_test_counter* _counter
+)
+{
+    bool             result;
+    struct d_bitset* bits;
+    size_t           i;
+
+    result = true;
+
+    // test 1: single words
+    result = d_assert_standalone(
+        (d_bitset_popcount64(0) == 0) &&
+        (d_bitset_popcount64(~(uint64_t)0) == 64) &&
+        (d_bitset_popcount64(0x8000000000000001ULL) == 2) &&
+        (d_bitset_popcount64(0x5555555555555555ULL) == 32),
+        "popcount64",
+        "popcount64 should count the set bits of a word",
+        _counter) && result;
+
+    // test 2: every third bit of 1000
+    bits = d_bitset_new(1000);
+
+    for (i = 0; i < 1000; i += 3)
+    {
+        d_bitset_set(bits, i);
+    }
+
+    result = d_assert_standalone(
+        (d_bitset_count(bits) == 334) &&
+        (d_bitset_count(NULL) == 0),
+        "count",
+        "Every third bit of 1000 should count 334",
+        _counter) && result;
+
+    d_bitset_free(bits);
+
+    return result;
+}
+
+
+/*
+d_tests_sa_bitset_rank_select
+  Tests d_bitset_rank and d_bitset_select.
+  Tests the following:
+  - rank counts set bits strictly below a position
+  - select inverts rank for every set bit
+  - select past the count fails
+*/
+bool
+d_tests_sa_bitset_rank_select
+(
+    struct d_test_counter* _counter
+)
+{
+    bool             result;
+    struct d_bitset* bits;
+    size_t           bit;
+    bool             inverse;
+    size_t           i;
+
+    result = true;
+    bits   = d_bitset_new(500);
+
+    // squares below 500: 0, 1, 4, 9, ..., 484 (23 values)
+    for (i = 0; i * i < 500; i++)
+    {
+        d_bitset_set(bits, i * i);
+    }
+
+    // test 1: rank
+    result = d_assert_standalone(
+        (d_bitset_rank(bits, 0) == 0) &&
+        (d_bitset_rank(bits, 1) == 1) &&
+        (d_bitset_rank(bits, 64) == 8) &&
+        (d_bitset_rank(bits, 65) == 9) &&
+        (d_bitset_rank(bits, 500) == 23) &&
+        (d_bitset_rank(bits, 9999) == 23),
+        "rank",
+        "rank should count the squares below each position",
+        _counter) && result;
+
+    // test 2: select inverts rank
+    inverse = true;
+
+    for (i = 0; (inverse) && (i < 23); i++)
+    {
+        inverse = (d_bitset_select(bits, i, &bit)) &&
+                  (bit == i * i) &&
+                  (d_bitset_rank(bits, bit) == i);
+    }
+
+    result = d_assert_standalone(
+        inverse,
+        "select",
+        "select(k) should return the k-th square",
+        _counter) && result;
+
+    // test 3: past the count
+    result = d_assert_standalone(
+        (!d_bitset_select(bits, 23, &bit)) &&
+        (!d_bitset_select(bits, 0, NULL)),
+        "select_bounds",
+        "select past the count should fail",
+        _counter) && result;
+
+    d_bitset_free(bits);
+
+    return result;
+}
+
+
+/*
+d_tests_sa_bitset_next
+  Tests the d_bitset_next function.
+  Tests the following:
+  - iteration visits every set bit in order
+  - a start position inside a word masks lower bits
+  - no further bit returns false
+*/
+bool
+d_tests_sa_bitset_next
+(
+    struct d_test_counter* _counter
+)
+{
+    bool             result;
+    struct d_bitset* bits;
+    size_t           bit;
+    size_t           visited[4];
+    size_t           count;
+
+    result = true;
+    bits   = d_bitset_new(300);
+
+    d_bitset_set(bits, 5);
+    d_bitset_set(bits, 6);
+    d_bitset_set(bits, 200);
+    d_bitset_set(bits, 299);
+
+    count = 0;
+    bit   = 0;
+
+    while ( (count < 4) &&
+            (d_bitset_next(bits, bit, &bit)) )
+    {
+        visited[count++] = bit++;
+    }
+
+    // test 1: ordered iteration
+    result = d_assert_standalone(
+        (count == 4) &&
+        (visited[0] == 5) &&
+        (visited[1] == 6) &&
+        (visited[2] == 200) &&
+        (visited[3] == 299),
+        "next_iterate",
+        "next should visit 5, 6, 200, 299",
+        _counter) && result;
+
+    // test 2: start positions
+    result = d_assert_standalone(
+        (d_bitset_next(bits, 7, &bit)) &&
+        (bit == 200) &&
+        (!d_bitset_next(bits, 300, &bit)) &&
+        (d_bitset_reset(bits, 299)) &&
+        (!d_bitset_next(bits, 201, &bit)),
+        "next_start",
+        "next should skip lower bits and fail past the last set bit",
+        _counter) && result;
+
+    d_bitset_free(bits);
+
+    return result;
+}
+
+
+/*
+d_tests_sa_bitset_to_indices
+  Tests the d_bitset_to_indices function.
+  Tests the following:
+  - positions are written in ascending order
+  - the round trip through new_from_indices is lossless
+*/
+bool
+d_tests_sa_bitset_to_indices
+(
+    struct d_test_counter* _counter
+)
+{
+    bool             result;
+    struct d_bitset* bits;
+    struct d_bitset* back;
+    size_t           indices[200];
+    size_t           count;
+    bool             ordered;
+    size_t           i;
+
+    result = true;
+    bits   = d_bitset_new(1000);
+
+    for (i = 7; i < 1000; i += 7)
+    {
+        d_bitset_set(bits, i);
+    }
+
+    count   = d_bitset_to_indices(bits, indices);
+    ordered = (count == 142);
+
+    for (i = 0; (ordered) && (i < count); i++)
+    {
+        ordered = (indices[i] == (i + 1) * 7);
+    }
+
+    // test 1: ascending positions
+    result = d_assert_standalone(
+        ordered,
+        "to_indices",
+        "Multiples of 7 should be written in order",
+        _counter) && result;
+
+    // test 2: round trip
+    back = d_bitset_new_from_indices(1000, indices, count);
+
+    result = d_assert_standalone(
+        (d_bitset_equals(bits, back)) &&
+        (d_bitset_to_indices(bits, NULL) == 0),
+        "to_indices_round_trip",
+        "Indices should rebuild an equal bitset",
+        _counter) && result;
+
+    d_bitset_free(back);
+    d_bitset_free(bits);
+
+    return result;
+}
+
+
+/*
+d_tests_sa_bitset_query_all
+  Aggregation function that runs all query tests.
+*/
+bool
+d_tests_sa_bitset_query_all
+(
+    struct d_test_counter* _counter
+)
+{
+    bool result;
+
+    result = true;
+
+    printf("\n  [SECTION] Queries\n");
+    printf("  -----------------\n");
+
+    result = d_tests_sa_bitset_count(_counter) && result;
+    result = d_tests_sa_bitset_rank_select(_counter) && result;
+    result = d_tests_sa_bitset_next(_counter) && result;
+    result = d_tests_sa_bitset_to_indices(_counter) && result;
+
+    return result;
+}
@@ -0,0 +1,26 @@
+#include "./roaring_tests_sa.h"
+
+
+/*
+d_tests_sa_roaring_run_all
+  Module-level aggregation function that runs all roaring bitmap tests.
+  Executes tests for all categories:
+  - Element functions
+  - Set algebra and conversion
+*/
+bool
+d_tests_sa_roaring_run_all
+(
+    struct d_test_counter* _counter
+)
+{
+    bool result;
+
+    result = true;
+
+    // run all test categories
+    result = d_tests_sa_roaring_element_all(_counter) && result;
+    result = d_tests_sa_roaring_algebra_all(_counter) && result;
+
+    return result;
+}
@@ -0,0 +1,57 @@
+/******************************************************************************
+* djinterp [test]                                          roaring_tests_sa.h
+*
+*   Unit test declarations for `roaring.h` module.
+*   Covers adding and removing values across containers, the conversion
+* between array and bitmap containers at D_ROARING_ARRAY_MAX, rank/select,
+* the set algebra (checked against `d_bitset`), and conversions to arrays
+* and bitsets.
+*
+*
+* path:      /tests/container/bitset/roaring_tests_sa.h
+* link(s):   TBA
+* author(s): Samuel 'teer' Neal-Blim                          date: 2026.10.18
+******************************************************************************/
+
+#ifndef DJINTERP_TESTS_ROARING_SA_
+#define DJINTERP_TESTS_ROARING_SA_ 1
+
+#include <stdlib.h>
+#include "../../../../inc/c/djinterp.h"
+#include "../../../../inc/c/dmemory.h"
+#include "../../../../inc/c/test/test_standalone.h"
+#include "../../../../inc/c/container/bitset/bitset.h"
+#include "../../../../inc/c/container/bitset/roaring.h"
+
+
+/******************************************************************************
+ * I. ELEMENT FUNCTION TESTS
+ *****************************************************************************/
+bool d_tests_sa_roaring_add_remove(struct d_test_counter* _counter);
+bool d_tests_sa_roaring_container_conversion(struct d_test_counter* _counter);
+bool d_tests_sa_roaring_rank_select(struct d_test_counter* _counter);
+bool d_tests_sa_roaring_copy_equals(struct d_test_counter* _counter);
+
+// I.   aggregation function
+bool d_tests_sa_roaring_element_all(struct d_test_counter* _counter);
+
+
+/******************************************************************************
+ * II. SET ALGEBRA AND CONVERSION TESTS
+ *****************************************************************************/
+bool d_tests_sa_roaring_and(struct d_test_counter* _counter);
+bool d_tests_sa_roaring_or(struct d_test_counter* _counter);
+bool d_tests_sa_roaring_andnot(struct d_test_counter* _counter);
+bool d_tests_sa_roaring_bitset_conversion(struct d_test_counter* _counter);
+
+// II.  aggregation function
+bool d_tests_sa_roaring_algebra_all(struct d_test_counter* _counter);
+
+
+/******************************************************************************
+ * MODULE-LEVEL AGGREGATION
+ *****************************************************************************/
+bool d_tests_sa_roaring_run_all(struct d_test_counter* _counter);
+
+
+#endif  // DJINTERP_TESTS_ROARING_SA_
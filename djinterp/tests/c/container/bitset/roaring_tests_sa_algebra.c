@@ -0,0 +1,453 @@
+#include "./roaring_tests_sa.h"
+
+
+/******************************************************************************
+ * II. SET ALGEBRA AND CONVERSION TESTS
+ *****************************************************************************/
+
+// D_TESTS_SA_ROARING_SPAN
+//   constant: values used by the algebra tests lie below this bound, which
+// covers four chunks.
+#define D_TESTS_SA_ROARING_SPAN (4u * 65536u)
+
+
+/*
+d_tests_sa_roaring_internal_fill
+  Adds the same values to a roaring bitmap and a bitset of
+D_TESTS_SA_ROARING_SPAN bits. `_layout` selects the pattern:
+  0: chunk 0 dense (bitmap), chunk 1 sparse, chunk 3 dense
+  1: chunk 0 sparse, chunk 1 dense, chunk 2 sparse, chunk 3 dense
+*/
+static void
+d_tests_sa_roaring_internal_fill
+(
+    struct d_roaring* _roaring,
+    struct d_bitset*  _bits,
+    int               _layout
+)
+{
+    uint32_t i;
+    uint32_t value;
+
+    for (i = 0; i < 65536; i++)
+    {
+        value = (uint32_t)-1;
+
+        if (_layout == 0)
+        {
+            if (i % 3 == 0)
+            {
+                value = i;                          // chunk 0, 21846 values
+            }
+            else if (i % 97 == 1)
+            {
+                value = 0x10000u + i;               // chunk 1, 451 values
+            }
+            else if (i % 5 == 2)
+            {
+                value = 0x30000u + i;               // chunk 3, dense
+            }
+        }
+        else
+        {
+            if (i % 89 == 0)
+            {
+                value = i;                          // chunk 0, sparse
+            }
+            else if (i % 2 == 1)
+            {
+                value = 0x10000u + i;               // chunk 1, dense
+            }
+            else if (i % 61 == 4)
+            {
+                value = 0x20000u + i;               // chunk 2, sparse
+            }
+            else
+            {
+                value = 0x30000u + i;               // chunk 3, dense
+            }
+        }
+
+        if (value != (uint32_t)-1)
+        {
+            d_roaring_add(_roaring, value);
+            d_bitset_set(_bits, value);
+        }
+    }
+
+    return;
+}
+
+
+/*
+d_tests_sa_roaring_internal_matches
+  Tests whether a roaring bitmap holds exactly the set bits of a bitset.
+*/
+static bool
+d_tests_sa_roaring_internal_matches
+(
+    const struct d_roaring* _roaring,
+    const struct d_bitset*  _bits
+)
+{
+    struct d_roaring* expected;
+    bool              same;
+
+    expected = d_roaring_new_from_bitset(_bits);
+    same     = ( (_roaring) &&
+                 (d_roaring_equals(_roaring, expected)) &&
+                 (d_roaring_count(_roaring) == d_bitset_count(_bits)) );
+
+    d_roaring_free(expected);
+
+    return same;
+}
+
+
+/*
+d_tests_sa_roaring_internal_check
+  Runs one binary operation on both representations and compares them.
+`_op` is 0 for and, 1 for or, 2 for andnot; `_swap` exchanges operands.
+*/
+static bool
+d_tests_sa_roaring_internal_check
+(
+    int  _op,
+    bool _swap
+)
+{
+    struct d_roaring* a;
+    struct d_roaring* b;
+    struct d_roaring* combined;
+    struct d_bitset*  bits_a;
+    struct d_bitset*  bits_b;
+    bool              same;
+
+    a      = d_roaring_new();
+    b      = d_roaring_new();
+    bits_a = d_bitset_new(D_TESTS_SA_ROARING_SPAN);
+    bits_b = d_bitset_new(D_TESTS_SA_ROARING_SPAN);
+
+    d_tests_sa_roaring_internal_fill(a, bits_a, (_swap) ? 1 : 0);
+    d_tests_sa_roaring_internal_fill(b, bits_b, (_swap) ? 0 : 1);
+
+    switch (_op)
+    {
+        case 0:
+            combined = d_roaring_and(a, b);
+            d_bitset_and(bits_a, bits_b);
+            break;
+
+        case 1:
+            combined = d_roaring_or(a, b);
+            d_bitset_or(bits_a, bits_b);
+            break;
+
+        default:
+            combined = d_roaring_andnot(a, b);
+            d_bitset_andnot(bits_a, bits_b);
+            break;
+    }
+
+    same = d_tests_sa_roaring_internal_matches(combined, bits_a);
+
+    d_roaring_free(a);
+    d_roaring_free(b);
+    d_roaring_free(combined);
+    d_bitset_free(bits_a);
+    d_bitset_free(bits_b);
+
+    return same;
+}
+
+
+/*
+d_tests_sa_roaring_and
+  Tests the d_roaring_and function.
+  Tests the following:
+  - bitmap with array, array with bitmap, bitmap with bitmap, and
+    unmatched chunks, checked against d_bitset_and
+  - a result that drops below D_ROARING_ARRAY_MAX is stored as an array
+  - NULL operands return NULL
+*/
+bool
+d_tests_sa_roaring_and
+(
+    struct d_test_counter* _counter
+)
+{
+    bool              result;
+    struct d_roaring* a;
+    struct d_roaring* b;
+    struct d_roaring* both;
+    uint32_t          i;
+
+    result = true;
+
+    // test 1: mixed container pairs
+    result = d_assert_standalone(
+        (d_tests_sa_roaring_internal_check(0, false)) &&
+        (d_tests_sa_roaring_internal_check(0, true)),
+        "and_mixed",
+        "and should match d_bitset_and for every container pairing",
+        _counter) && result;
+
+    // test 2: two bitmaps with a small intersection
+    a = d_roaring_new();
+    b = d_roaring_new();
+
+    for (i = 0; i < 10000; i++)
+    {
+        d_roaring_add(a, i);
+        d_roaring_add(b, i + 9990);
+    }
+
+    both = d_roaring_and(a, b);
+
+    result = d_assert_standalone(
+        (both != NULL) &&
+        (d_roaring_count(both) == 10) &&
+        (both->container_count == 1) &&
+        (!both->containers[0].is_bitmap) &&
+        (d_roaring_and(a, NULL) == NULL),
+        "and_shrinks",
+        "A 10-value intersection of bitmaps should be an array",
+        _counter) && result;
+
+    d_roaring_free(a);
+    d_roaring_free(b);
+    d_roaring_free(both);
+
+    return result;
+}
+
+
+/*
+d_tests_sa_roaring_or
+  Tests the d_roaring_or function.
+  Tests the following:
+  - every container pairing, checked against d_bitset_or
+  - two arrays whose union exceeds D_ROARING_ARRAY_MAX become a bitmap
+  - or with an empty bitmap is a copy
+*/
+bool
+d_tests_sa_roaring_or
+(
+    struct d_test_counter* _counter
+)
+{
+    bool              result;
+    struct d_roaring* a;
+    struct d_roaring* b;
+    struct d_roaring* either;
+    struct d_roaring* empty;
+    struct d_roaring* same;
+    uint32_t          i;
+
+    result = true;
+
+    // test 1: mixed container pairs
+    result = d_assert_standalone(
+        (d_tests_sa_roaring_internal_check(1, false)) &&
+        (d_tests_sa_roaring_internal_check(1, true)),
+        "or_mixed",
+        "or should match d_bitset_or for every container pairing",
+        _counter) && result;
+
+    // test 2: arrays growing into a bitmap
+    a = d_roaring_new();
+    b = d_roaring_new();
+
+    for (i = 0; i < 3000; i++)
+    {
+        d_roaring_add(a, 2 * i);
+        d_roaring_add(b, 2 * i + 1);
+    }
+
+    either = d_roaring_or(a, b);
+
+    result = d_assert_standalone(
+        (!a->containers[0].is_bitmap) &&
+        (either != NULL) &&
+        (either->containers[0].is_bitmap) &&
+        (d_roaring_count(either) == 6000) &&
+        (d_roaring_rank(either, 6000) == 6000),
+        "or_grows",
+        "Two 3000-value arrays should combine into a 6000-value bitmap",
+        _counter) && result;
+
+    // test 3: empty operand
+    empty = d_roaring_new();
+    same  = d_roaring_or(empty, a);
+
+    result = d_assert_standalone(
+        (d_roaring_equals(same, a)),
+        "or_empty",
+        "or with an empty bitmap should equal the other operand",
+        _counter) && result;
+
+    d_roaring_free(a);
+    d_roaring_free(b);
+    d_roaring_free(either);
+    d_roaring_free(empty);
+    d_roaring_free(same);
+
+    return result;
+}
+
+
+/*
+d_tests_sa_roaring_andnot
+  Tests the d_roaring_andnot function.
+  Tests the following:
+  - every container pairing, checked against d_bitset_andnot
+  - a minus itself is empty and holds no containers
+*/
+bool
+d_tests_sa_roaring_andnot
+(
+    struct d_test_counter* _counter
+)
+{
+    bool              result;
+    struct d_roaring* a;
+    struct d_roaring* none;
+    uint32_t          i;
+
+    result = true;
+
+    // test 1: mixed container pairs
+    result = d_assert_standalone(
+        (d_tests_sa_roaring_internal_check(2, false)) &&
+        (d_tests_sa_roaring_internal_check(2, true)),
+        "andnot_mixed",
+        "andnot should match d_bitset_andnot for every container pairing",
+        _counter) && result;
+
+    // test 2: self difference
+    a = d_roaring_new();
+
+    for (i = 0; i < 20000; i += 3)
+    {
+        d_roaring_add(a, i * 11);
+    }
+
+    none = d_roaring_andnot(a, a);
+
+    result = d_assert_standalone(
+        (none != NULL) &&
+        (d_roaring_is_empty(none)) &&
+        (none->container_count == 0),
+        "andnot_self",
+        "a ANDNOT a should hold no containers",
+        _counter) && result;
+
+    d_roaring_free(a);
+    d_roaring_free(none);
+
+    return result;
+}
+
+
+/*
+d_tests_sa_roaring_bitset_conversion
+  Tests d_roaring_new_from_bitset, d_roaring_to_bitset and
+d_roaring_to_array.
+  Tests the following:
+  - a bitset round-trips through a roaring bitmap
+  - to_array writes values in ascending order
+  - to_bitset rejects values past the requested size
+*/
+bool
+d_tests_sa_roaring_bitset_conversion
+(
+    struct d_test_counter* _counter
+)
+{
+    bool              result;
+    struct d_bitset*  bits;
+    struct d_bitset*  back;
+    struct d_roaring* roaring;
+    uint32_t*         values;
+    size_t            count;
+    bool              ordered;
+    size_t            i;
+
+    result  = true;
+    bits    = d_bitset_new(D_TESTS_SA_ROARING_SPAN);
+    roaring = d_roaring_new();
+
+    d_tests_sa_roaring_internal_fill(roaring, bits, 1);
+    d_roaring_free(roaring);
+
+    // test 1: round trip
+    roaring = d_roaring_new_from_bitset(bits);
+    back    = d_roaring_to_bitset(roaring, D_TESTS_SA_ROARING_SPAN);
+
+    result = d_assert_standalone(
+        (roaring != NULL) &&
+        (back != NULL) &&
+        (d_roaring_count(roaring) == d_bitset_count(bits)) &&
+        (d_bitset_equals(bits, back)),
+        "bitset_round_trip",
+        "A bitset should survive conversion to roaring and back",
+        _counter) && result;
+
+    // test 2: ascending array
+    values  = malloc(d_roaring_count(roaring) * sizeof(uint32_t));
+    count   = d_roaring_to_array(roaring, values);
+    ordered = (count == d_bitset_count(bits));
+
+    for (i = 1; (ordered) && (i < count); i++)
+    {
+        ordered = (values[i - 1] < values[i]) &&
+                  (d_bitset_test(bits, values[i]));
+    }
+
+    result = d_assert_standalone(
+        ordered,
+        "to_array",
+        "to_array should write every value in ascending order",
+        _counter) && result;
+
+    // test 3: size too small
+    result = d_assert_standalone(
+        (d_roaring_to_bitset(roaring, 0x30000u) == NULL) &&
+        (d_roaring_new_from_bitset(NULL) == NULL),
+        "to_bitset_small",
+        "to_bitset should reject values past the size",
+        _counter) && result;
+
+    free(values);
+    d_bitset_free(back);
+    d_bitset_free(bits);
+    d_roaring_free(roaring);
+
+    return result;
+}
+
+
+/*
+d_tests_sa_roaring_algebra_all
+  Aggregation function that runs all set algebra and conversion tests.
+*/
+bool
+d_tests_sa_roaring_algebra_all
+(
+    struct d_test_counter* _counter
+)
+{
+    bool result;
+
+    result = true;
+
+    printf("\n  [SECTION] Set Algebra and Conversion\n");
+    printf("  ------------------------------------\n");
+
+    result = d_tests_sa_roaring_and(_counter) && result;
+    result = d_tests_sa_roaring_or(_counter) && result;
+    result = d_tests_sa_roaring_andnot(_counter) && result;
+    result = d_tests_sa_roaring_bitset_conversion(_counter) && result;
+
+    return result;
+}
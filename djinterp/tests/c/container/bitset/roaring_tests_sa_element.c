@@ -0,0 +1,345 @@
+#include "./roaring_tests_sa.h"
+
+
+/******************************************************************************
+ * I. ELEMENT FUNCTION TESTS
+ *****************************************************************************/
+
+/*
+d_tests_sa_roaring_add_remove
+  Tests d_roaring_add, d_roaring_remove, d_roaring_contains and
+d_roaring_clear.
+  Tests the following:
+  - values in different chunks create separate sorted containers
+  - duplicates do not change the count
+  - removing the last value of a chunk releases its container
+  - clear empties the bitmap
+*/
+bool
+d_tests_sa_roaring_add_remove
+(
+    struct d_test_counter* _counter
+)
+{
+    bool              result;
+    struct d_roaring* roaring;
+
+    result  = true;
+    roaring = d_roaring_new();
+
+    // test 1: values in three chunks, added out of order
+    result = d_assert_standalone(
+        (roaring != NULL) &&
+        (d_roaring_add(roaring, 0xFFFFFFFFu)) &&
+        (d_roaring_add(roaring, 7)) &&
+        (d_roaring_add(roaring, 0x10005u)) &&
+        (d_roaring_add(roaring, 3)) &&
+        (d_roaring_add(roaring, 7)) &&
+        (d_roaring_count(roaring) == 4) &&
+        (roaring->container_count == 3) &&
+        (roaring->containers[0].key == 0) &&
+        (roaring->containers[1].key == 1) &&
+        (roaring->containers[2].key == 0xFFFF),
+        "add_chunks",
+        "Values should land in key-sorted containers without duplicates",
+        _counter) && result;
+
+    // test 2: contains
+    result = d_assert_standalone(
+        (d_roaring_contains(roaring, 3)) &&
+        (d_roaring_contains(roaring, 0x10005u)) &&
+        (!d_roaring_contains(roaring, 5)) &&
+        (!d_roaring_contains(roaring, 0x20005u)) &&
+        (!d_roaring_contains(NULL, 3)),
+        "contains",
+        "contains should find exactly the added values",
+        _counter) && result;
+
+    // test 3: remove
+    result = d_assert_standalone(
+        (d_roaring_remove(roaring, 0x10005u)) &&
+        (!d_roaring_remove(roaring, 0x10005u)) &&
+        (roaring->container_count == 2) &&
+        (d_roaring_count(roaring) == 3),
+        "remove",
+        "Removing a chunk's last value should release its container",
+        _counter) && result;
+
+    // test 4: clear
+    result = d_assert_standalone(
+        (d_roaring_clear(roaring)) &&
+        (d_roaring_is_empty(roaring)) &&
+        (d_roaring_add(roaring, 1)) &&
+        (d_roaring_count(roaring) == 1),
+        "clear",
+        "clear should empty the bitmap and leave it usable",
+        _counter) && result;
+
+    d_roaring_free(roaring);
+
+    return result;
+}
+
+
+/*
+d_tests_sa_roaring_container_conversion
+  Tests the switch between array and bitmap containers.
+  Tests the following:
+  - D_ROARING_ARRAY_MAX values stay in an array container
+  - one more value converts the container to a bitmap
+  - removing back down to D_ROARING_ARRAY_MAX converts it back
+  - every value survives both conversions
+*/
+bool
+d_tests_sa_roaring_container_conversion
+(
+    struct d_test_counter* _counter
+)
+{
+    bool              result;
+    struct d_roaring* roaring;
+    bool              all_present;
+    uint32_t          i;
+
+    result  = true;
+    roaring = d_roaring_new();
+
+    // even values of chunk 2
+    for (i = 0; i < D_ROARING_ARRAY_MAX; i++)
+    {
+        d_roaring_add(roaring, 0x20000u + 2 * i);
+    }
+
+    // test 1: at the threshold
+    result = d_assert_standalone(
+        (roaring->container_count == 1) &&
+        (!roaring->containers[0].is_bitmap) &&
+        (d_roaring_count(roaring) == D_ROARING_ARRAY_MAX),
+        "array_at_max",
+        "D_ROARING_ARRAY_MAX values should stay in array form",
+        _counter) && result;
+
+    // test 2: one past the threshold
+    d_roaring_add(roaring, 0x20001u);
+
+    all_present = true;
+
+    for (i = 0; (all_present) && (i < D_ROARING_ARRAY_MAX); i++)
+    {
+        all_present = d_roaring_contains(roaring, 0x20000u + 2 * i);
+    }
+
+    result = d_assert_standalone(
+        (roaring->containers[0].is_bitmap) &&
+        (d_roaring_count(roaring) == D_ROARING_ARRAY_MAX + 1) &&
+        (all_present) &&
+        (d_roaring_contains(roaring, 0x20001u)) &&
+        (!d_roaring_contains(roaring, 0x20003u)),
+        "array_to_bitmap",
+        "The 4097th value should convert the container to a bitmap",
+        _counter) && result;
+
+    // test 3: back to an array
+    d_roaring_remove(roaring, 0x20000u);
+
+    all_present = true;
+
+    for (i = 1; (all_present) && (i < D_ROARING_ARRAY_MAX); i++)
+    {
+        all_present = d_roaring_contains(roaring, 0x20000u + 2 * i);
+    }
+
+    result = d_assert_standalone(
+        (!roaring->containers[0].is_bitmap) &&
+        (d_roaring_count(roaring) == D_ROARING_ARRAY_MAX) &&
+        (all_present) &&
+        (d_roaring_contains(roaring, 0x20001u)) &&
+        (!d_roaring_contains(roaring, 0x20000u)),
+        "bitmap_to_array",
+        "Dropping to D_ROARING_ARRAY_MAX values should restore array form",
+        _counter) && result;
+
+    d_roaring_free(roaring);
+
+    return result;
+}
+
+
+/*
+d_tests_sa_roaring_rank_select
+  Tests d_roaring_rank and d_roaring_select.
+  Tests the following:
+  - rank across array and bitmap containers
+  - select inverts rank
+  - select past the count fails
+*/
+bool
+d_tests_sa_roaring_rank_select
+(
+    struct d_test_counter* _counter
+)
+{
+    bool              result;
+    struct d_roaring* roaring;
+    uint32_t          value;
+    bool              inverse;
+    uint32_t          i;
+
+    result  = true;
+    roaring = d_roaring_new();
+
+    // chunk 0: 10 sparse values; chunk 3: 5000 consecutive values (bitmap)
+    for (i = 0; i < 10; i++)
+    {
+        d_roaring_add(roaring, i * 1000);
+    }
+
+    for (i = 0; i < 5000; i++)
+    {
+        d_roaring_add(roaring, 0x30000u + i);
+    }
+
+    // test 1: rank
+    result = d_assert_standalone(
+        (d_roaring_rank(roaring, 0) == 0) &&
+        (d_roaring_rank(roaring, 1) == 1) &&
+        (d_roaring_rank(roaring, 5000) == 5) &&
+        (d_roaring_rank(roaring, 0x30000u) == 10) &&
+        (d_roaring_rank(roaring, 0x30000u + 100) == 110) &&
+        (d_roaring_rank(roaring, 0xFFFFFFFFu) == 5010),
+        "rank",
+        "rank should count values below the bound across containers",
+        _counter) && result;
+
+    // test 2: select inverts rank
+    inverse = true;
+
+    for (i = 0; (inverse) && (i < 5010); i += 7)
+    {
+        inverse = (d_roaring_select(roaring, i, &value)) &&
+                  (d_roaring_rank(roaring, value) == i) &&
+                  (d_roaring_contains(roaring, value));
+    }
+
+    result = d_assert_standalone(
+        (inverse) &&
+        (d_roaring_select(roaring, 10, &value)) &&
+        (value == 0x30000u),
+        "select",
+        "select(k) should return the value of rank k",
+        _counter) && result;
+
+    // test 3: bounds
+    result = d_assert_standalone(
+        (!d_roaring_select(roaring, 5010, &value)) &&
+        (!d_roaring_select(roaring, 0, NULL)) &&
+        (d_roaring_rank(NULL, 5) == 0),
+        "select_bounds",
+        "select past the count should fail",
+        _counter) && result;
+
+    d_roaring_free(roaring);
+
+    return result;
+}
+
+
+/*
+d_tests_sa_roaring_copy_equals
+  Tests d_roaring_new_copy, d_roaring_new_from_array and d_roaring_equals.
+  Tests the following:
+  - a copy is equal and independent
+  - from_array ignores order and duplicates
+  - a container converted to a bitmap and back equals one built as an
+    array
+*/
+bool
+d_tests_sa_roaring_copy_equals
+(
+    struct d_test_counter* _counter
+)
+{
+    bool              result;
+    struct d_roaring* roaring;
+    struct d_roaring* copy;
+    struct d_roaring* dense;
+    struct d_roaring* sparse;
+    uint32_t          values[6] = { 70000, 5, 5, 70000, 1, 0xFFFF0000u };
+    uint32_t          i;
+
+    result  = true;
+    roaring = d_roaring_new_from_array(values, 6);
+    copy    = d_roaring_new_copy(roaring);
+
+    // test 1: from_array and copy
+    d_roaring_add(copy, 2);
+
+    result = d_assert_standalone(
+        (d_roaring_count(roaring) == 4) &&
+        (d_roaring_count(copy) == 5) &&
+        (!d_roaring_contains(roaring, 2)) &&
+        (!d_roaring_equals(roaring, copy)) &&
+        (d_roaring_remove(copy, 2)) &&
+        (d_roaring_equals(roaring, copy)),
+        "copy_from_array",
+        "from_array should dedupe and the copy should be independent",
+        _counter) && result;
+
+    // test 2: same values, different container forms
+    dense  = d_roaring_new();
+    sparse = d_roaring_new();
+
+    for (i = 0; i <= D_ROARING_ARRAY_MAX; i++)
+    {
+        d_roaring_add(dense, i);
+    }
+
+    d_roaring_remove(dense, D_ROARING_ARRAY_MAX);
+
+    for (i = 0; i < D_ROARING_ARRAY_MAX; i++)
+    {
+        d_roaring_add(sparse, i);
+    }
+
+    result = d_assert_standalone(
+        (d_roaring_equals(dense, sparse)) &&
+        (!d_roaring_equals(dense, roaring)) &&
+        (!d_roaring_equals(dense, NULL)) &&
+        (d_roaring_new_from_array(NULL, 1) == NULL),
+        "equals_forms",
+        "Bitmaps with the same values should compare equal",
+        _counter) && result;
+
+    d_roaring_free(roaring);
+    d_roaring_free(copy);
+    d_roaring_free(dense);
+    d_roaring_free(sparse);
+
+    return result;
+}
+
+
+/*
+d_tests_sa_roaring_element_all
+  Aggregation function that runs all element function tests.
+*/
+bool
+d_tests_sa_roaring_element_all
+(
+    struct d_test_counter* _counter
+)
+{
+    bool result;
+
+    result = true;
+
+    printf("\n  [SECTION] Element Functions\n");
+    printf("  ---------------------------\n");
+
+    result = d_tests_sa_roaring_add_remove(_counter) && result;
+    result = d_tests_sa_roaring_container_conversion(_counter) && result;
+    result = d_tests_sa_roaring_rank_select(_counter) && result;
+    result = d_tests_sa_roaring_copy_equals(_counter) && result;
+
+    return result;
+}
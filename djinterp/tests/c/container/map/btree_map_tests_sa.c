@@ -0,0 +1,26 @@
+#include "./btree_map_tests_sa.h"
+
+
+/*
+d_tests_sa_btree_map_run_all
+  Module-level aggregation function that runs all B+tree map tests.
+  Executes tests for all categories:
+  - Element functions
+  - Bulk load and ranges
+*/
+bool
+d_tests_sa_btree_map_run_all
+(
+    struct d_test_counter* _counter
+)
+{
+    bool result;
+
+    result = true;
+
+    // run all test categories
+    result = d_tests_sa_btree_map_element_all(_counter) && result;
+    result = d_tests_sa_btree_map_range_all(_counter) && result;
+
+    return result;
+}
@@ -0,0 +1,57 @@
+/******************************************************************************
+* djinterp [test]                                        btree_map_tests_sa.h
+*
+*   Unit test declarations for `btree_map.h` module.
+*   Covers construction and node layout, put/get/remove with splits, merges
+* and borrows (checked against a reference set), ascending inserts, bulk
+* loading, range cursors, the `d_iterator` adapter, and comparator keys.
+*
+*
+* path:      /tests/container/map/btree_map_tests_sa.h
+* link(s):   TBA
+* author(s): Samuel 'teer' Neal-Blim                          date: 2026.10.18
+******************************************************************************/
+
+#ifndef DJINTERP_TESTS_BTREE_MAP_SA_
+#define DJINTERP_TESTS_BTREE_MAP_SA_ 1
+
+#include <stdint.h>
+#include <stdlib.h>
+#include "../../../../inc/c/djinterp.h"
+#include "../../../../inc/c/dmemory.h"
+#include "../../../../inc/c/test/test_standalone.h"
+#include "../../../../inc/c/container/map/btree_map.h"
+
+
+/******************************************************************************
+ * I. ELEMENT FUNCTION TESTS
+ *****************************************************************************/
+bool d_tests_sa_btree_map_new(struct d_test_counter* _counter);
+bool d_tests_sa_btree_map_put_get(struct d_test_counter* _counter);
+bool d_tests_sa_btree_map_ascending(struct d_test_counter* _counter);
+bool d_tests_sa_btree_map_remove(struct d_test_counter* _counter);
+bool d_tests_sa_btree_map_random_ops(struct d_test_counter* _counter);
+
+// I.   aggregation function
+bool d_tests_sa_btree_map_element_all(struct d_test_counter* _counter);
+
+
+/******************************************************************************
+ * II. BULK LOAD AND RANGE TESTS
+ *****************************************************************************/
+bool d_tests_sa_btree_map_bulk_load(struct d_test_counter* _counter);
+bool d_tests_sa_btree_map_range(struct d_test_counter* _counter);
+bool d_tests_sa_btree_map_iterator(struct d_test_counter* _counter);
+bool d_tests_sa_btree_map_comparator(struct d_test_counter* _counter);
+
+// II.  aggregation function
+bool d_tests_sa_btree_map_range_all(struct d_test_counter* _counter);
+
+
+/******************************************************************************
+ * MODULE-LEVEL AGGREGATION
+ *****************************************************************************/
+bool d_tests_sa_btree_map_run_all(struct d_test_counter* _counter);
+
+
+#endif  // DJINTERP_TESTS_BTREE_MAP_SA_
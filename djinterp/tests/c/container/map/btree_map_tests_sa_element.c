@@ -0,0 +1,569 @@
+#include "./btree_map_tests_sa.h"
+
+
+/******************************************************************************
+ * I. ELEMENT FUNCTION TESTS
+ *****************************************************************************/
+
+/*
+d_tests_sa_btree_map_internal_matches
+  Walks an int64-keyed map in order and tests that it holds exactly the keys
+`k` with `_present[k]` set, each mapped to `k + 1`, in ascending order.
+*/
+static bool
+d_tests_sa_btree_map_internal_matches
+(
+    const struct d_btree_map* _map,
+    const bool*               _present,
+    size_t                    _universe
+)
+{
+    struct d_btree_map_cursor cursor;
+    const void*               key;
+    void*                     value;
+    int64_t                   current;
+    int64_t                   previous;
+    size_t                    seen;
+    size_t                    expected;
+    size_t                    i;
+
+    expected = 0;
+
+    for (i = 0; i < _universe; i++)
+    {
+        expected += (_present[i]) ? 1 : 0;
+    }
+
+    if ( (d_btree_map_count(_map) != expected) ||
+         (!d_btree_map_range(_map, NULL, NULL, &cursor)) )
+    {
+        return false;
+    }
+
+    seen     = 0;
+    previous = -1;
+
+    while (d_btree_map_cursor_next(&cursor, &key, &value))
+    {
+        memcpy(&current, key, sizeof(current));
+
+        if ( (current <= previous)              ||
+             (current < 0)                      ||
+             ((size_t)current >= _universe)     ||
+             (!_present[current])               ||
+             (value != (void*)(uintptr_t)(current + 1)) )
+        {
+            return false;
+        }
+
+        previous = current;
+        seen++;
+    }
+
+    return (seen == expected);
+}
+
+
+/*
+d_tests_sa_btree_map_internal_compare_bytes
+  Comparator for the wide-key map: orders 300-byte keys by memcmp.
+*/
+static int
+d_tests_sa_btree_map_internal_compare_bytes
+(
+    const void* _a,
+    const void* _b
+)
+{
+    return memcmp(_a, _b, 300);
+}
+
+
+/*
+d_tests_sa_btree_map_new
+  Tests d_btree_map_new and d_btree_map_new_keyed.
+  Tests the following:
+  - keyed maps pick the key size from the kind
+  - nodes are whole cache lines and 8-byte keys get 30 per node
+  - oversized keys still get D_BTREE_MAP_MIN_FANOUT per node
+  - invalid arguments return NULL
+*/
+bool
+d_tests_sa_btree_map_new
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                result;
+    struct d_btree_map* map32;
+    struct d_btree_map* map64;
+    struct d_btree_map* wide;
+
+    result = true;
+    map32  = d_btree_map_new_keyed(D_BTREE_MAP_KEY_UINT32);
+    map64  = d_btree_map_new_keyed(D_BTREE_MAP_KEY_INT64);
+    wide   = d_btree_map_new(300, d_tests_sa_btree_map_internal_compare_bytes);
+
+    // test 1: keyed maps
+    result = d_assert_standalone(
+        (map32 != NULL) &&
+        (map64 != NULL) &&
+        (map32->key_size == 4) &&
+        (map64->key_size == 8) &&
+        (d_btree_map_is_empty(map64)) &&
+        (d_btree_map_height(map64) == 0),
+        "new_keyed",
+        "Keyed maps should start empty with the kind's key size",
+        _counter) && result;
+
+    // test 2: node layout
+    result = d_assert_standalone(
+        (map64->node_size == D_BTREE_MAP_NODE_SIZE) &&
+        (map64->node_size % D_BTREE_MAP_CACHE_LINE == 0) &&
+        (map64->capacity == 30) &&
+        (map32->capacity > map64->capacity),
+        "new_layout",
+        "A 512-byte node should hold 30 int64 keys",
+        _counter) && result;
+
+    // test 3: oversized keys
+    result = d_assert_standalone(
+        (wide != NULL) &&
+        (wide->capacity == D_BTREE_MAP_MIN_FANOUT) &&
+        (wide->node_size % D_BTREE_MAP_CACHE_LINE == 0) &&
+        (wide->node_size >= wide->slot_offset +
+                            (wide->capacity + 1) * sizeof(void*)),
+        "new_wide_keys",
+        "300-byte keys should get the minimum fanout in a larger node",
+        _counter) && result;
+
+    // test 4: invalid arguments
+    result = d_assert_standalone(
+        (d_btree_map_new(0, d_tests_sa_btree_map_internal_compare_bytes) == NULL) &&
+        (d_btree_map_new(8, NULL) == NULL) &&
+        (d_btree_map_new_keyed(D_BTREE_MAP_KEY_COMPARATOR) == NULL),
+        "new_invalid",
+        "Zero key size, NULL comparator or COMPARATOR kind should fail",
+        _counter) && result;
+
+    d_btree_map_free(map32);
+    d_btree_map_free(map64);
+    d_btree_map_free(wide);
+
+    return result;
+}
+
+
+/*
+d_tests_sa_btree_map_put_get
+  Tests d_btree_map_put, d_btree_map_get, d_btree_map_contains,
+d_btree_map_first and d_btree_map_last.
+  Tests the following:
+  - keys inserted in scattered order are all found after many splits
+  - putting an existing key replaces its value without growing the map
+  - absent keys and NULL arguments
+*/
+bool
+d_tests_sa_btree_map_put_get
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                result;
+    struct d_btree_map* map;
+    bool                present[5000];
+    bool                found;
+    int64_t             key;
+    const void*         edge;
+    void*               value;
+    size_t              i;
+
+    result = true;
+    map    = d_btree_map_new_keyed(D_BTREE_MAP_KEY_INT64);
+
+    // 7919 is prime, so i * 7919 % 5000 visits every key once
+    for (i = 0; i < 5000; i++)
+    {
+        key        = (int64_t)((i * 7919) % 5000);
+        present[i] = true;
+        d_btree_map_put(map, &key, (void*)(uintptr_t)(key + 1));
+    }
+
+    found = true;
+
+    for (key = 0; (found) && (key < 5000); key++)
+    {
+        found = (d_btree_map_get(map, &key) == (void*)(uintptr_t)(key + 1));
+    }
+
+    // test 1: every key found, in order
+    result = d_assert_standalone(
+        (found) &&
+        (d_btree_map_count(map) == 5000) &&
+        (d_btree_map_height(map) >= 3) &&
+        (d_tests_sa_btree_map_internal_matches(map, present, 5000)),
+        "put_get_scattered",
+        "5000 scattered keys should all be found in ascending order",
+        _counter) && result;
+
+    // test 2: replace
+    key = 1234;
+
+    result = d_assert_standalone(
+        (d_btree_map_put(map, &key, NULL)) &&
+        (d_btree_map_count(map) == 5000) &&
+        (d_btree_map_get(map, &key) == NULL) &&
+        (d_btree_map_contains(map, &key)),
+        "put_replace",
+        "Putting an existing key should replace its value",
+        _counter) && result;
+
+    // test 3: absent keys
+    key = 5000;
+
+    result = d_assert_standalone(
+        (!d_btree_map_contains(map, &key)) &&
+        (d_btree_map_get(map, &key) == NULL) &&
+        (!d_btree_map_put(NULL, &key, NULL)) &&
+        (!d_btree_map_put(map, NULL, NULL)) &&
+        (d_btree_map_get(map, NULL) == NULL),
+        "get_absent",
+        "Absent keys and NULL arguments should not be found",
+        _counter) && result;
+
+    // test 4: first and last
+    edge = d_btree_map_first(map, &value);
+    memcpy(&key, edge, sizeof(key));
+
+    result = d_assert_standalone(
+        (key == 0) &&
+        (value == (void*)(uintptr_t)1),
+        "first",
+        "first should return the smallest key and its value",
+        _counter) && result;
+
+    edge = d_btree_map_last(map, &value);
+    memcpy(&key, edge, sizeof(key));
+
+    result = d_assert_standalone(
+        (key == 4999) &&
+        (value == (void*)(uintptr_t)5000) &&
+        (d_btree_map_first(NULL, NULL) == NULL),
+        "last",
+        "last should return the largest key and its value",
+        _counter) && result;
+
+    d_btree_map_free(map);
+
+    return result;
+}
+
+
+/*
+d_tests_sa_btree_map_ascending
+  Tests inserts in ascending key order.
+  Tests the following:
+  - appends keep nodes full: 900 keys (30 full leaves) fit in two levels
+  - the same keys inserted in descending order still work
+  - negative keys sort before positive ones
+*/
+bool
+d_tests_sa_btree_map_ascending
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                result;
+    struct d_btree_map* map;
+    bool                present[900];
+    int64_t             key;
+    size_t              i;
+
+    result = true;
+    map    = d_btree_map_new_keyed(D_BTREE_MAP_KEY_INT64);
+
+    for (i = 0; i < 900; i++)
+    {
+        key        = (int64_t)i;
+        present[i] = true;
+        d_btree_map_put(map, &key, (void*)(uintptr_t)(key + 1));
+    }
+
+    // test 1: full leaves
+    result = d_assert_standalone(
+        (d_btree_map_count(map) == 900) &&
+        (d_btree_map_height(map) == 2) &&
+        (d_tests_sa_btree_map_internal_matches(map, present, 900)),
+        "ascending_full_nodes",
+        "900 ascending keys should fill 30 leaves under one root",
+        _counter) && result;
+
+    d_btree_map_free(map);
+
+    // test 2: descending
+    map = d_btree_map_new_keyed(D_BTREE_MAP_KEY_INT64);
+
+    for (i = 900; i > 0; i--)
+    {
+        key = (int64_t)(i - 1);
+        d_btree_map_put(map, &key, (void*)(uintptr_t)(key + 1));
+    }
+
+    result = d_assert_standalone(
+        d_tests_sa_btree_map_internal_matches(map, present, 900),
+        "descending",
+        "900 descending keys should iterate in ascending order",
+        _counter) && result;
+
+    d_btree_map_free(map);
+
+    // test 3: signed order
+    map = d_btree_map_new_keyed(D_BTREE_MAP_KEY_INT64);
+
+    for (key = -500; key < 500; key++)
+    {
+        d_btree_map_put(map, &key, NULL);
+    }
+
+    memcpy(&key, d_btree_map_first(map, NULL), sizeof(key));
+
+    result = d_assert_standalone(
+        (key == -500) &&
+        (d_btree_map_count(map) == 1000),
+        "ascending_signed",
+        "Negative int64 keys should sort first",
+        _counter) && result;
+
+    d_btree_map_free(map);
+
+    return result;
+}
+
+
+/*
+d_tests_sa_btree_map_remove
+  Tests the d_btree_map_remove function.
+  Tests the following:
+  - removing every other key keeps the rest in order
+  - removing from the front of an ascending-built tree (thin right edge)
+  - removing everything empties the tree, which remains usable
+  - absent keys are not removed
+*/
+bool
+d_tests_sa_btree_map_remove
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                result;
+    struct d_btree_map* map;
+    bool                present[3000];
+    bool                removed;
+    int64_t             key;
+    size_t              i;
+
+    result = true;
+    map    = d_btree_map_new_keyed(D_BTREE_MAP_KEY_INT64);
+
+    for (i = 0; i < 3000; i++)
+    {
+        key        = (int64_t)i;
+        present[i] = true;
+        d_btree_map_put(map, &key, (void*)(uintptr_t)(key + 1));
+    }
+
+    // test 1: odd keys, in scattered order
+    removed = true;
+
+    for (i = 0; i < 3000; i++)
+    {
+        key = (int64_t)((i * 1237) % 3000);
+
+        if (key % 2 == 1)
+        {
+            removed      = d_btree_map_remove(map, &key) && removed;
+            present[key] = false;
+        }
+    }
+
+    result = d_assert_standalone(
+        (removed) &&
+        (d_tests_sa_btree_map_internal_matches(map, present, 3000)),
+        "remove_odd",
+        "Removing the odd keys should leave the even ones in order",
+        _counter) && result;
+
+    // test 2: absent keys
+    key = 1;
+
+    result = d_assert_standalone(
+        (!d_btree_map_remove(map, &key)) &&
+        (!d_btree_map_remove(NULL, &key)) &&
+        (!d_btree_map_remove(map, NULL)) &&
+        (d_btree_map_count(map) == 1500),
+        "remove_absent",
+        "Absent keys should not be removed",
+        _counter) && result;
+
+    // test 3: from the front, shrinking the tree
+    for (i = 0; i < 2990; i += 2)
+    {
+        key        = (int64_t)i;
+        present[i] = false;
+        d_btree_map_remove(map, &key);
+    }
+
+    result = d_assert_standalone(
+        (d_tests_sa_btree_map_internal_matches(map, present, 3000)) &&
+        (d_btree_map_height(map) == 1),
+        "remove_front",
+        "Five keys left should fit in a single leaf",
+        _counter) && result;
+
+    // test 4: everything, then reuse
+    for (key = 2990; key < 3000; key += 2)
+    {
+        d_btree_map_remove(map, &key);
+    }
+
+    key = 42;
+
+    result = d_assert_standalone(
+        (d_btree_map_is_empty(map)) &&
+        (d_btree_map_height(map) == 0) &&
+        (d_btree_map_first(map, NULL) == NULL) &&
+        (d_btree_map_put(map, &key, NULL)) &&
+        (d_btree_map_count(map) == 1),
+        "remove_all",
+        "An emptied map should have no nodes and accept new keys",
+        _counter) && result;
+
+    d_btree_map_free(map);
+
+    return result;
+}
+
+
+/*
+d_tests_sa_btree_map_random_ops
+  Tests a long random sequence of puts and removes against a reference
+set, with uint32 keys.
+  Tests the following:
+  - splits, borrows, merges and root changes keep every key reachable
+  - the count and the in-order walk match the reference after each phase
+*/
+bool
+d_tests_sa_btree_map_random_ops
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                      result;
+    struct d_btree_map*       map;
+    struct d_btree_map_cursor cursor;
+    const void*               walked;
+    void*                     value;
+    bool                      present[4000];
+    bool                      agree;
+    uint32_t                  state;
+    uint32_t                  key;
+    uint32_t                  previous;
+    size_t                    count;
+    size_t                    seen;
+    size_t                    phase;
+    size_t                    i;
+
+    result = true;
+    map    = d_btree_map_new_keyed(D_BTREE_MAP_KEY_UINT32);
+    state  = 12345;
+    count  = 0;
+    agree  = true;
+
+    for (i = 0; i < 4000; i++)
+    {
+        present[i] = false;
+    }
+
+    // phases alternate between mostly-insert and mostly-remove
+    for (phase = 0; phase < 6; phase++)
+    {
+        for (i = 0; i < 20000; i++)
+        {
+            state = (state * 1103515245u) + 12345u;
+            key   = (state >> 8) % 4000;
+
+            if ( ((state >> 4) % 4) < ((phase % 2 == 0) ? 3u : 1u) )
+            {
+                count       += (present[key]) ? 0 : 1;
+                present[key] = true;
+                agree = d_btree_map_put(map, &key, (void*)(uintptr_t)(key + 1)) &&
+                        agree;
+            }
+            else
+            {
+                agree = (d_btree_map_remove(map, &key) == present[key]) &&
+                        agree;
+                count       -= (present[key]) ? 1 : 0;
+                present[key] = false;
+            }
+        }
+
+        agree = (d_btree_map_count(map) == count) && agree;
+
+        // the in-order walk must be ascending and match the reference
+        d_btree_map_range(map, NULL, NULL, &cursor);
+        seen     = 0;
+        previous = 0;
+
+        while (d_btree_map_cursor_next(&cursor, &walked, &value))
+        {
+            memcpy(&key, walked, sizeof(key));
+            agree = (present[key]) &&
+                    ( (seen == 0) || (key > previous) ) &&
+                    (value == (void*)(uintptr_t)(key + 1)) &&
+                    agree;
+            previous = key;
+            seen++;
+        }
+
+        agree = (seen == count) && agree;
+    }
+
+    // test 1: agreement with the reference
+    result = d_assert_standalone(
+        agree,
+        "random_ops",
+        "120000 random puts and removes should match a reference set",
+        _counter) && result;
+
+    d_btree_map_free(map);
+
+    return result;
+}
+
+
+/*
+d_tests_sa_btree_map_element_all
+  Aggregation function that runs all element function tests.
+*/
+bool
+d_tests_sa_btree_map_element_all
+(
+    struct d_test_counter* _counter
+)
+{
+    bool result;
+
+    result = true;
+
+    printf("\n  [SECTION] Element Functions\n");
+    printf("  ---------------------------\n");
+
+    result = d_tests_sa_btree_map_new(_counter) && result;
+    result = d_tests_sa_btree_map_put_get(_counter) && result;
+    result = d_tests_sa_btree_map_ascending(_counter) && result;
+    result = d_tests_sa_btree_map_remove(_counter) && result;
+    result = d_tests_sa_btree_map_random_ops(_counter) && result;
+
+    return result;
+}
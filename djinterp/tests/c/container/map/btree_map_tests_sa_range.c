@@ -0,0 +1,476 @@
+#include "./btree_map_tests_sa.h"
+
+
+/******************************************************************************
+ * II. BULK LOAD AND RANGE TESTS
+ *****************************************************************************/
+
+/*
+d_tests_sa_btree_map_internal_evens
+  Creates an int64-keyed map of the even keys 0, 2, ..., 2 * (`_count` - 1),
+each mapped to its key + 1, through d_btree_map_bulk_load.
+*/
+static struct d_btree_map*
+d_tests_sa_btree_map_internal_evens
+(
+    size_t _count
+)
+{
+    struct d_btree_map* map;
+    int64_t*            keys;
+    void**              values;
+    size_t              i;
+
+    map    = d_btree_map_new_keyed(D_BTREE_MAP_KEY_INT64);
+    keys   = malloc(_count * sizeof(int64_t));
+    values = malloc(_count * sizeof(void*));
+
+    for (i = 0; i < _count; i++)
+    {
+        keys[i]   = (int64_t)(2 * i);
+        values[i] = (void*)(uintptr_t)(keys[i] + 1);
+    }
+
+    d_btree_map_bulk_load(map, keys, values, _count);
+
+    free(keys);
+    free(values);
+
+    return map;
+}
+
+/*
+d_tests_sa_btree_map_internal_count_range
+  Counts the entries of an int64-keyed map in [`_low`, `_high`), where a
+bound of -1 means none, and tests that they are consecutive even keys
+starting at `_first`.
+*/
+static size_t
+d_tests_sa_btree_map_internal_count_range
+(
+    const struct d_btree_map* _map,
+    int64_t                   _low,
+    int64_t                   _high,
+    int64_t                   _first
+)
+{
+    struct d_btree_map_cursor cursor;
+    const void*               key;
+    int64_t                   current;
+    size_t                    count;
+
+    d_btree_map_range(_map,
+                      (_low >= 0) ? &_low : NULL,
+                      (_high >= 0) ? &_high : NULL,
+                      &cursor);
+    count = 0;
+
+    while (d_btree_map_cursor_next(&cursor, &key, NULL))
+    {
+        memcpy(&current, key, sizeof(current));
+
+        if (current != _first + (int64_t)(2 * count))
+        {
+            return (size_t)-1;
+        }
+
+        count++;
+    }
+
+    return count;
+}
+
+
+/*
+d_tests_sa_btree_map_bulk_load
+  Tests the d_btree_map_bulk_load function.
+  Tests the following:
+  - a large sorted load is fully reachable with the expected height
+  - NULL values map every key to NULL
+  - unsorted or duplicate keys, and non-empty maps, are rejected
+  - the loaded tree accepts further puts and removes
+*/
+bool
+d_tests_sa_btree_map_bulk_load
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                result;
+    struct d_btree_map* map;
+    int64_t             keys[5] = { 1, 2, 3, 3, 4 };
+    int64_t             key;
+    bool                found;
+
+    result = true;
+    map    = d_tests_sa_btree_map_internal_evens(10000);
+    found  = true;
+
+    for (key = 0; (found) && (key < 20000); key += 2)
+    {
+        found = (d_btree_map_get(map, &key) == (void*)(uintptr_t)(key + 1));
+    }
+
+    // test 1: 10000 keys: 334 leaves, 11 internal nodes, one root
+    result = d_assert_standalone(
+        (found) &&
+        (d_btree_map_count(map) == 10000) &&
+        (d_btree_map_height(map) == 3) &&
+        (d_tests_sa_btree_map_internal_count_range(map, -1, -1, 0) == 10000),
+        "bulk_load_large",
+        "10000 sorted keys should load into three levels",
+        _counter) && result;
+
+    // test 2: further modification
+    key = 5;
+    d_btree_map_put(map, &key, NULL);
+    key = 0;
+
+    result = d_assert_standalone(
+        (d_btree_map_remove(map, &key)) &&
+        (d_btree_map_count(map) == 10000) &&
+        (d_tests_sa_btree_map_internal_count_range(map, 6, 20, 6) == 7),
+        "bulk_load_modify",
+        "A bulk-loaded tree should accept puts and removes",
+        _counter) && result;
+
+    // test 3: non-empty map rejected
+    result = d_assert_standalone(
+        (!d_btree_map_bulk_load(map, keys, NULL, 3)) &&
+        (d_btree_map_count(map) == 10000),
+        "bulk_load_not_empty",
+        "Loading into a non-empty map should fail",
+        _counter) && result;
+
+    d_btree_map_free(map);
+
+    // test 4: NULL values, and duplicates rejected
+    map = d_btree_map_new_keyed(D_BTREE_MAP_KEY_INT64);
+    key = 2;
+
+    result = d_assert_standalone(
+        (!d_btree_map_bulk_load(map, keys, NULL, 5)) &&
+        (d_btree_map_is_empty(map)) &&
+        (d_btree_map_bulk_load(map, keys, NULL, 3)) &&
+        (d_btree_map_contains(map, &key)) &&
+        (d_btree_map_get(map, &key) == NULL) &&
+        (d_btree_map_height(map) == 1) &&
+        (!d_btree_map_bulk_load(NULL, keys, NULL, 3)),
+        "bulk_load_validation",
+        "Duplicate keys should be rejected and NULL values allowed",
+        _counter) && result;
+
+    d_btree_map_free(map);
+
+    return result;
+}
+
+
+/*
+d_tests_sa_btree_map_range
+  Tests d_btree_map_range and d_btree_map_cursor_next.
+  Tests the following:
+  - bounds between keys, on keys, and missing bounds
+  - ranges crossing many leaves
+  - empty ranges and an empty map
+*/
+bool
+d_tests_sa_btree_map_range
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                      result;
+    struct d_btree_map*       map;
+    struct d_btree_map*       empty;
+    struct d_btree_map_cursor cursor;
+
+    result = true;
+    map    = d_tests_sa_btree_map_internal_evens(1000);
+    empty  = d_btree_map_new_keyed(D_BTREE_MAP_KEY_INT64);
+
+    // test 1: bounds between and on keys
+    result = d_assert_standalone(
+        (d_tests_sa_btree_map_internal_count_range(map, 101, 201, 102) == 50) &&
+        (d_tests_sa_btree_map_internal_count_range(map, 100, 200, 100) == 50) &&
+        (d_tests_sa_btree_map_internal_count_range(map, 100, 101, 100) == 1),
+        "range_bounds",
+        "[low, high) should include low and exclude high",
+        _counter) && result;
+
+    // test 2: open ends and long ranges
+    result = d_assert_standalone(
+        (d_tests_sa_btree_map_internal_count_range(map, -1, 10, 0) == 5) &&
+        (d_tests_sa_btree_map_internal_count_range(map, 1990, -1, 1990) == 5) &&
+        (d_tests_sa_btree_map_internal_count_range(map, 1, 1999, 2) == 999),
+        "range_open",
+        "Missing bounds should run to the ends of the map",
+        _counter) && result;
+
+    // test 3: empty ranges
+    result = d_assert_standalone(
+        (d_tests_sa_btree_map_internal_count_range(map, 2000, -1, 0) == 0) &&
+        (d_tests_sa_btree_map_internal_count_range(map, 50, 50, 0) == 0) &&
+        (d_tests_sa_btree_map_internal_count_range(map, 60, 40, 0) == 0) &&
+        (d_tests_sa_btree_map_internal_count_range(empty, -1, -1, 0) == 0),
+        "range_empty",
+        "Ranges with no keys should yield nothing",
+        _counter) && result;
+
+    // test 4: invalid arguments
+    result = d_assert_standalone(
+        (!d_btree_map_range(NULL, NULL, NULL, &cursor)) &&
+        (!d_btree_map_range(map, NULL, NULL, NULL)) &&
+        (!d_btree_map_cursor_next(NULL, NULL, NULL)),
+        "range_invalid",
+        "NULL arguments should be rejected",
+        _counter) && result;
+
+    d_btree_map_free(map);
+    d_btree_map_free(empty);
+
+    return result;
+}
+
+
+/*
+d_tests_sa_btree_map_iterator
+  Tests the d_btree_map_iterator adapter.
+  Tests the following:
+  - D_ITER_FOREACH yields the entries of the range in order
+  - the bounds are copied, so the caller's keys may change
+  - reset rewinds to the lower bound
+  - a NULL map yields an iterator that yields nothing
+*/
+bool
+d_tests_sa_btree_map_iterator
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                result;
+    struct d_btree_map* map;
+    struct d_iterator   iterator;
+    int64_t             low;
+    int64_t             high;
+    int64_t             key;
+    int64_t             expected;
+    bool                ordered;
+    size_t              count;
+
+    result = true;
+    map    = d_tests_sa_btree_map_internal_evens(1000);
+    low    = 500;
+    high   = 600;
+
+    iterator = d_btree_map_iterator(map, &low, &high);
+    low      = 0;
+    high     = 0;
+    count    = 0;
+    ordered  = true;
+    expected = 500;
+
+    D_ITER_FOREACH(struct d_btree_map_entry, entry, &iterator)
+    {
+        memcpy(&key, entry->key, sizeof(key));
+        ordered  = (key == expected) &&
+                   (entry->value == (void*)(uintptr_t)(key + 1)) &&
+                   ordered;
+        expected += 2;
+        count++;
+    }
+
+    // test 1: iteration
+    result = d_assert_standalone(
+        (ordered) &&
+        (count == 50) &&
+        (iterator.element_size == sizeof(struct d_btree_map_entry)),
+        "iterator_range",
+        "The iterator should yield keys 500..598 with their values",
+        _counter) && result;
+
+    // test 2: reset
+    count = 0;
+
+    result = d_assert_standalone(
+        (iterator.reset(&iterator)),
+        "iterator_reset",
+        "reset should succeed",
+        _counter) && result;
+
+    while (iterator.next(&iterator) != NULL)
+    {
+        count++;
+    }
+
+    result = d_assert_standalone(
+        count == 50,
+        "iterator_reset_count",
+        "A reset iterator should yield the same 50 entries",
+        _counter) && result;
+
+    iterator.destroy(&iterator);
+
+    // test 3: NULL map
+    iterator = d_btree_map_iterator(NULL, NULL, NULL);
+
+    result = d_assert_standalone(
+        (iterator.next(&iterator) == NULL) &&
+        (!iterator.reset(&iterator)),
+        "iterator_null",
+        "An iterator over a NULL map should yield nothing",
+        _counter) && result;
+
+    iterator.destroy(&iterator);
+    d_btree_map_free(map);
+
+    return result;
+}
+
+
+// d_tests_sa_btree_map_word
+//   struct: fixed-size string key for the comparator tests; 12 bytes, so
+// node slots need padding after the keys.
+struct d_tests_sa_btree_map_word
+{
+    char text[12];
+};
+
+/*
+d_tests_sa_btree_map_internal_compare_words
+  Orders d_tests_sa_btree_map_word keys alphabetically.
+*/
+static int
+d_tests_sa_btree_map_internal_compare_words
+(
+    const void* _a,
+    const void* _b
+)
+{
+    return strcmp(((const struct d_tests_sa_btree_map_word*)_a)->text,
+                  ((const struct d_tests_sa_btree_map_word*)_b)->text);
+}
+
+
+/*
+d_tests_sa_btree_map_comparator
+  Tests a map ordered by a caller-supplied comparator.
+  Tests the following:
+  - string keys of an odd size iterate in alphabetical order
+  - a prefix range selects keys between two bounds
+  - removes work through the comparator
+*/
+bool
+d_tests_sa_btree_map_comparator
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                             result;
+    struct d_btree_map*              map;
+    struct d_btree_map_cursor        cursor;
+    struct d_tests_sa_btree_map_word word;
+    struct d_tests_sa_btree_map_word low;
+    struct d_tests_sa_btree_map_word high;
+    struct d_tests_sa_btree_map_word previous;
+    const void*                      key;
+    bool                             ordered;
+    size_t                           count;
+    size_t                           i;
+
+    result = true;
+    map    = d_btree_map_new(sizeof(struct d_tests_sa_btree_map_word),
+                             d_tests_sa_btree_map_internal_compare_words);
+
+    // "w0000" .. "w1999", inserted in scattered order
+    for (i = 0; i < 2000; i++)
+    {
+        memset(&word, 0, sizeof(word));
+        snprintf(word.text, sizeof(word.text), "w%04u", (unsigned)((i * 7) % 2000));
+        d_btree_map_put(map, &word, NULL);
+    }
+
+    d_btree_map_range(map, NULL, NULL, &cursor);
+    memset(&previous, 0, sizeof(previous));
+    ordered = true;
+    count   = 0;
+
+    while (d_btree_map_cursor_next(&cursor, &key, NULL))
+    {
+        ordered = (d_tests_sa_btree_map_internal_compare_words(&previous, key) < 0) &&
+                  ordered;
+        memcpy(&previous, key, sizeof(previous));
+        count++;
+    }
+
+    // test 1: alphabetical order
+    result = d_assert_standalone(
+        (ordered) &&
+        (count == 2000) &&
+        (d_btree_map_count(map) == 2000),
+        "comparator_order",
+        "String keys should iterate alphabetically",
+        _counter) && result;
+
+    // test 2: prefix range ["w01", "w02")
+    memset(&low, 0, sizeof(low));
+    memset(&high, 0, sizeof(high));
+    strcpy(low.text, "w01");
+    strcpy(high.text, "w02");
+
+    d_btree_map_range(map, &low, &high, &cursor);
+    count = 0;
+
+    while (d_btree_map_cursor_next(&cursor, NULL, NULL))
+    {
+        count++;
+    }
+
+    result = d_assert_standalone(
+        count == 100,
+        "comparator_prefix_range",
+        "Keys w0100..w0199 should fall in [w01, w02)",
+        _counter) && result;
+
+    // test 3: remove
+    memset(&word, 0, sizeof(word));
+    strcpy(word.text, "w0150");
+
+    result = d_assert_standalone(
+        (d_btree_map_remove(map, &word)) &&
+        (!d_btree_map_contains(map, &word)) &&
+        (d_btree_map_count(map) == 1999),
+        "comparator_remove",
+        "A key should be removable through the comparator",
+        _counter) && result;
+
+    d_btree_map_free(map);
+
+    return result;
+}
+
+
+/*
+d_tests_sa_btree_map_range_all
+  Aggregation function that runs all bulk load and range tests.
+*/
+bool
+d_tests_sa_btree_map_range_all
+(
+    struct d_test_counter* _counter
+)
+{
+    bool result;
+
+    result = true;
+
+    printf("\n  [SECTION] Bulk Load and Ranges\n");
+    printf("  ------------------------------\n");
+
+    result = d_tests_sa_btree_map_bulk_load(_counter) && result;
+    result = d_tests_sa_btree_map_range(_counter) && result;
+    result = d_tests_sa_btree_map_iterator(_counter) && result;
+    result = d_tests_sa_btree_map_comparator(_counter) && result;
+
+    return result;
+}
@@ -63,6 +63,7 @@ bool d_tests_sa_vector_common_insert_element(struct d_test_counter* _counter);
 bool d_tests_sa_vector_common_insert_elements(struct d_test_counter* _counter);
 bool d_tests_sa_vector_common_erase(struct d_test_counter* _counter);
 bool d_tests_sa_vector_common_erase_range(struct d_test_counter* _counter);
+bool d_tests_sa_vector_common_apply_edits(struct d_test_counter* _counter);
 
 // III. aggregation function
 bool d_tests_sa_vector_common_element_all(struct d_test_counter* _counter);
@@ -944,6 +944,243 @@ d_tests_sa_vector_common_erase_range
 }
 
 
+/*
+d_tests_sa_vector_common_internal_equals
+  Helper: compares `_count` ints at `_elements` against `_expected`.
+*/
+static bool
+d_tests_sa_vector_common_internal_equals
+(
+    const void* _elements,
+    const int*  _expected,
+    size_t      _count
+)
+{
+    return (_count == 0) ||
+           (memcmp(_elements, _expected, _count * sizeof(int)) == 0);
+}
+
+/*
+d_tests_sa_vector_common_apply_edits
+  Tests the d_vector_common_apply_edits function for batched edits.
+  Tests the following:
+  - NULL parameter handling
+  - unsorted, overlapping and out-of-range edits are rejected unchanged
+  - erase-only batch (front-to-back compaction)
+  - insert-only batch (back-to-front fill, capacity growth)
+  - mixed batch that both grows and shrinks (assembled in a new buffer)
+  - insert and erase sharing an index
+*/
+bool
+d_tests_sa_vector_common_apply_edits
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                 result;
+    void*                elements;
+    size_t               count;
+    size_t               capacity;
+    size_t               i;
+    int                  a[2]    = { 100, 101 };
+    int                  b[3]    = { 200, 201, 202 };
+    struct d_vector_edit edits[4] = { { 0 } };
+
+    result   = true;
+    elements = NULL;
+    count    = 0;
+    capacity = 0;
+
+    // test 1: NULL parameters should fail
+    result = d_assert_standalone(
+        d_vector_common_apply_edits(NULL,
+                                    &count,
+                                    &capacity,
+                                    sizeof(int),
+                                    edits,
+                                    1) == D_FAILURE,
+        "apply_edits_null_elements",
+        "NULL elements should return D_FAILURE",
+        _counter) && result;
+
+    d_vector_common_init(&elements, &count, &capacity, sizeof(int), 8);
+
+    for (i = 0; i < 8; i++)
+    {
+        ((int*)elements)[i] = (int)i;
+    }
+
+    count = 8;  // [0..7]
+
+    result = d_assert_standalone(
+        d_vector_common_apply_edits(&elements,
+                                    &count,
+                                    &capacity,
+                                    sizeof(int),
+                                    NULL,
+                                    1) == D_FAILURE,
+        "apply_edits_null_edits",
+        "NULL edits with a count should return D_FAILURE",
+        _counter) && result;
+
+    // test 2: invalid batches leave the vector untouched
+    edits[0] = (struct d_vector_edit){ D_VECTOR_EDIT_ERASE, 4, 1, NULL };
+    edits[1] = (struct d_vector_edit){ D_VECTOR_EDIT_ERASE, 2, 1, NULL };
+
+    result = d_assert_standalone(
+        d_vector_common_apply_edits(&elements,
+                                    &count,
+                                    &capacity,
+                                    sizeof(int),
+                                    edits,
+                                    2) == D_FAILURE,
+        "apply_edits_unsorted",
+        "Unsorted edits should return D_FAILURE",
+        _counter) && result;
+
+    edits[0] = (struct d_vector_edit){ D_VECTOR_EDIT_ERASE, 2, 3, NULL };
+    edits[1] = (struct d_vector_edit){ D_VECTOR_EDIT_INSERT, 4, 2, a };
+
+    result = d_assert_standalone(
+        d_vector_common_apply_edits(&elements,
+                                    &count,
+                                    &capacity,
+                                    sizeof(int),
+                                    edits,
+                                    2) == D_FAILURE,
+        "apply_edits_overlap",
+        "Edit inside an erased range should return D_FAILURE",
+        _counter) && result;
+
+    edits[0] = (struct d_vector_edit){ D_VECTOR_EDIT_ERASE, 6, 3, NULL };
+
+    result = d_assert_standalone(
+        d_vector_common_apply_edits(&elements,
+                                    &count,
+                                    &capacity,
+                                    sizeof(int),
+                                    edits,
+                                    1) == D_FAILURE,
+        "apply_edits_out_of_range",
+        "Erase past the end should return D_FAILURE",
+        _counter) && result;
+
+    result = d_assert_standalone(
+        count == 8,
+        "apply_edits_invalid_unchanged",
+        "Rejected batch should not change the count",
+        _counter) && result;
+
+    // test 3: erase-only batch
+    edits[0] = (struct d_vector_edit){ D_VECTOR_EDIT_ERASE, 1, 2, NULL };
+    edits[1] = (struct d_vector_edit){ D_VECTOR_EDIT_ERASE, 5, 1, NULL };
+
+    {
+        const int expected[] = { 0, 3, 4, 6, 7 };
+
+        result = d_assert_standalone(
+            d_vector_common_apply_edits(&elements,
+                                        &count,
+                                        &capacity,
+                                        sizeof(int),
+                                        edits,
+                                        2) == D_SUCCESS &&
+            count == 5 &&
+            d_tests_sa_vector_common_internal_equals(elements, expected, 5),
+            "apply_edits_erase_only",
+            "Erase-only batch should give [0,3,4,6,7]",
+            _counter) && result;
+    }
+
+    // test 4: insert-only batch that outgrows the capacity
+    edits[0] = (struct d_vector_edit){ D_VECTOR_EDIT_INSERT, 0, 2, a };
+    edits[1] = (struct d_vector_edit){ D_VECTOR_EDIT_INSERT, 3, 3, b };
+    edits[2] = (struct d_vector_edit){ D_VECTOR_EDIT_INSERT, 5, 2, a };
+
+    {
+        const int expected[] = { 100, 101, 0, 3, 4, 200, 201, 202,
+                                 6, 7, 100, 101 };
+
+        result = d_assert_standalone(
+            d_vector_common_apply_edits(&elements,
+                                        &count,
+                                        &capacity,
+                                        sizeof(int),
+                                        edits,
+                                        3) == D_SUCCESS &&
+            count == 12 &&
+            capacity >= 12 &&
+            d_tests_sa_vector_common_internal_equals(elements, expected, 12),
+            "apply_edits_insert_only",
+            "Insert-only batch should insert at original positions",
+            _counter) && result;
+    }
+
+    // test 5: mixed batch (shrinks first, then grows past the original)
+    edits[0] = (struct d_vector_edit){ D_VECTOR_EDIT_ERASE, 0, 2, NULL };
+    edits[1] = (struct d_vector_edit){ D_VECTOR_EDIT_INSERT, 12, 3, b };
+    edits[2] = (struct d_vector_edit){ D_VECTOR_EDIT_INSERT, 12, 2, a };
+
+    {
+        const int expected[] = { 0, 3, 4, 200, 201, 202, 6, 7, 100, 101,
+                                 200, 201, 202, 100, 101 };
+
+        result = d_assert_standalone(
+            d_vector_common_apply_edits(&elements,
+                                        &count,
+                                        &capacity,
+                                        sizeof(int),
+                                        edits,
+                                        3) == D_SUCCESS &&
+            count == 15 &&
+            capacity >= 15 &&
+            d_tests_sa_vector_common_internal_equals(elements, expected, 15),
+            "apply_edits_mixed",
+            "Mixed batch should apply inserts in list order",
+            _counter) && result;
+    }
+
+    // test 6: replace a range (erase then insert at the same index)
+    edits[0] = (struct d_vector_edit){ D_VECTOR_EDIT_INSERT, 3, 2, a };
+    edits[1] = (struct d_vector_edit){ D_VECTOR_EDIT_ERASE, 3, 3, NULL };
+
+    {
+        const int expected[] = { 0, 3, 4, 100, 101, 6, 7, 100, 101,
+                                 200, 201, 202, 100, 101 };
+
+        result = d_assert_standalone(
+            d_vector_common_apply_edits(&elements,
+                                        &count,
+                                        &capacity,
+                                        sizeof(int),
+                                        edits,
+                                        2) == D_SUCCESS &&
+            count == 14 &&
+            d_tests_sa_vector_common_internal_equals(elements, expected, 14),
+            "apply_edits_replace",
+            "Insert and erase at one index should replace the range",
+            _counter) && result;
+    }
+
+    // test 7: empty batch is a no-op
+    result = d_assert_standalone(
+        d_vector_common_apply_edits(&elements,
+                                    &count,
+                                    &capacity,
+                                    sizeof(int),
+                                    NULL,
+                                    0) == D_SUCCESS &&
+        count == 14,
+        "apply_edits_empty_batch",
+        "Empty batch should succeed without changes",
+        _counter) && result;
+
+    free(elements);
+
+    return result;
+}
+
+
 /*
 d_tests_sa_vector_common_element_all
   Aggregation function that runs all element manipulation tests.
@@ -969,6 +1206,7 @@ d_tests_sa_vector_common_element_all
     result = d_tests_sa_vector_common_insert_elements(_counter) && result;
     result = d_tests_sa_vector_common_erase(_counter) && result;
     result = d_tests_sa_vector_common_erase_range(_counter) && result;
+    result = d_tests_sa_vector_common_apply_edits(_counter) && result;
 
     return result;
 }
\ No newline at end of file
@@ -63,6 +63,8 @@ bool d_tests_sa_vector_insert_elements(struct d_test_counter* _counter);
 bool d_tests_sa_vector_erase(struct d_test_counter* _counter);
 bool d_tests_sa_vector_erase_range(struct d_test_counter* _counter);
 bool d_tests_sa_vector_clear(struct d_test_counter* _counter);
+bool d_tests_sa_vector_apply_edits(struct d_test_counter* _counter);
+bool d_tests_sa_vector_gap(struct d_test_counter* _counter);
 
 // III. aggregation function
 bool d_tests_sa_vector_element_all(struct d_test_counter* _counter);
@@ -137,6 +139,9 @@ bool d_tests_sa_vector_search_all(struct d_test_counter* _counter);
 bool d_tests_sa_vector_swap(struct d_test_counter* _counter);
 bool d_tests_sa_vector_reverse(struct d_test_counter* _counter);
 bool d_tests_sa_vector_sort(struct d_test_counter* _counter);
+bool d_tests_sa_vector_sort_keyed(struct d_test_counter* _counter);
+bool d_tests_sa_vector_sort_parallel(struct d_test_counter* _counter);
+bool d_tests_sa_vector_merge_sorted(struct d_test_counter* _counter);
 bool d_tests_sa_vector_copy_to(struct d_test_counter* _counter);
 
 // IX.  aggregation function
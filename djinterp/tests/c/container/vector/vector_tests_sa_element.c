@@ -654,6 +654,199 @@ d_tests_sa_vector_clear
 }
 
 
+/*
+d_tests_sa_vector_apply_edits
+  Tests the d_vector_apply_edits function.
+  Tests the following:
+  - NULL vector rejection
+  - batch of inserts and erases applied at original positions
+  - invalid batch leaves the vector unchanged
+*/
+bool
+d_tests_sa_vector_apply_edits
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                 result;
+    struct d_vector*     vec;
+    int                  ins[2] = { 90, 91 };
+    struct d_vector_edit edits[3];
+
+    result = true;
+
+    edits[0] = (struct d_vector_edit){ D_VECTOR_EDIT_ERASE, 0, 1, NULL };
+    edits[1] = (struct d_vector_edit){ D_VECTOR_EDIT_INSERT, 2, 2, ins };
+    edits[2] = (struct d_vector_edit){ D_VECTOR_EDIT_ERASE, 3, 2, NULL };
+
+    // test 1: NULL vector should fail
+    result = d_assert_standalone(
+        d_vector_apply_edits(NULL, edits, 3) == D_FAILURE,
+        "apply_edits_null_vector",
+        "NULL vector should return D_FAILURE",
+        _counter) && result;
+
+    vec = d_vector_new_from_args(sizeof(int), 6, 1, 2, 3, 4, 5, 6);
+
+    if (vec)
+    {
+        // test 2: [1,2,3,4,5,6] -> [2,90,91,3,6]
+        result = d_assert_standalone(
+            d_vector_apply_edits(vec, edits, 3) == D_SUCCESS,
+            "apply_edits_success",
+            "Valid batch should return D_SUCCESS",
+            _counter) && result;
+
+        result = d_assert_standalone(
+            vec->count == 5 &&
+            *(int*)d_vector_at(vec, 0) == 2  &&
+            *(int*)d_vector_at(vec, 1) == 90 &&
+            *(int*)d_vector_at(vec, 2) == 91 &&
+            *(int*)d_vector_at(vec, 3) == 3  &&
+            *(int*)d_vector_at(vec, 4) == 6,
+            "apply_edits_result",
+            "Vector should be [2, 90, 91, 3, 6]",
+            _counter) && result;
+
+        // test 3: erase past the end is rejected without changes
+        edits[0] = (struct d_vector_edit){ D_VECTOR_EDIT_ERASE, 4, 2, NULL };
+
+        result = d_assert_standalone(
+            d_vector_apply_edits(vec, edits, 1) == D_FAILURE &&
+            vec->count == 5,
+            "apply_edits_invalid",
+            "Invalid batch should fail and leave the vector unchanged",
+            _counter) && result;
+
+        d_vector_free(vec);
+    }
+
+    return result;
+}
+
+
+/*
+d_tests_sa_vector_gap
+  Tests the d_vector_gap_* gap-buffer session functions.
+  Tests the following:
+  - begin rejects a cursor past the end
+  - insert at the cursor, including growth past the capacity
+  - cursor moves in both directions
+  - erase before and after the cursor, with bounds checks
+  - logical indexing across the gap
+  - end restores a contiguous vector usable by other functions
+*/
+bool
+d_tests_sa_vector_gap
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                result;
+    struct d_vector*    vec;
+    struct d_vector_gap gap;
+    int                 values[3] = { 7, 8, 9 };
+    int                 filler[40];
+    size_t              i;
+
+    result = true;
+    vec    = d_vector_new_from_args(sizeof(int), 4, 1, 2, 3, 4);
+
+    if (!vec)
+    {
+        return d_assert_standalone(false,
+                                   "gap_alloc",
+                                   "Failed to allocate vector",
+                                   _counter);
+    }
+
+    // test 1: cursor past the end should fail
+    result = d_assert_standalone(
+        d_vector_gap_begin(&gap, vec, 5) == D_FAILURE,
+        "gap_begin_out_of_range",
+        "Cursor past the end should return D_FAILURE",
+        _counter) && result;
+
+    // test 2: insert in the middle
+    result = d_assert_standalone(
+        d_vector_gap_begin(&gap, vec, 2) == D_SUCCESS &&
+        d_vector_gap_insert(&gap, values, 3) == D_SUCCESS &&
+        d_vector_gap_cursor(&gap) == 5 &&
+        vec->count == 7,
+        "gap_insert",
+        "Insert should advance the cursor and update count",
+        _counter) && result;
+
+    // [1,2,7,8,9 | 3,4]
+    result = d_assert_standalone(
+        *(int*)d_vector_gap_at(&gap, 4) == 9 &&
+        *(int*)d_vector_gap_at(&gap, 5) == 3 &&
+        *(int*)d_vector_gap_at(&gap, 6) == 4 &&
+        d_vector_gap_at(&gap, 7) == NULL,
+        "gap_at",
+        "Indexing should skip the gap",
+        _counter) && result;
+
+    // test 3: move left, erase before and after
+    result = d_assert_standalone(
+        d_vector_gap_move(&gap, 1) == D_SUCCESS &&
+        d_vector_gap_erase_after(&gap, 1) == D_SUCCESS &&
+        d_vector_gap_erase_before(&gap, 1) == D_SUCCESS &&
+        d_vector_gap_erase_before(&gap, 1) == D_FAILURE &&
+        vec->count == 5 &&
+        *(int*)d_vector_gap_at(&gap, 0) == 7,
+        "gap_move_erase",
+        "Erasing around the cursor should give [| 7,8,9,3,4]",
+        _counter) && result;
+
+    result = d_assert_standalone(
+        d_vector_gap_erase_after(&gap, 6) == D_FAILURE &&
+        d_vector_gap_move(&gap, 6) == D_FAILURE,
+        "gap_bounds",
+        "Erase or move past the end should return D_FAILURE",
+        _counter) && result;
+
+    // test 4: move right and grow well past the capacity
+    for (i = 0; i < 40; i++)
+    {
+        filler[i] = (int)(100 + i);
+    }
+
+    result = d_assert_standalone(
+        d_vector_gap_move(&gap, 4) == D_SUCCESS &&
+        d_vector_gap_insert(&gap, filler, 40) == D_SUCCESS &&
+        vec->count == 45 &&
+        *(int*)d_vector_gap_at(&gap, 44) == 4,
+        "gap_grow",
+        "Insert beyond the capacity should grow and keep the tail",
+        _counter) && result;
+
+    // test 5: end restores contiguity
+    result = d_assert_standalone(
+        d_vector_gap_end(&gap) == D_SUCCESS &&
+        gap.vector == NULL &&
+        *(int*)d_vector_at(vec, 0) == 7   &&
+        *(int*)d_vector_at(vec, 3) == 3   &&
+        *(int*)d_vector_at(vec, 4) == 100 &&
+        *(int*)d_vector_at(vec, 43) == 139 &&
+        *(int*)d_vector_at(vec, 44) == 4,
+        "gap_end",
+        "Vector should be contiguous after the session ends",
+        _counter) && result;
+
+    result = d_assert_standalone(
+        d_vector_gap_end(&gap) == D_FAILURE &&
+        d_vector_gap_insert(&gap, values, 1) == D_FAILURE,
+        "gap_closed",
+        "Closed session should reject further calls",
+        _counter) && result;
+
+    d_vector_free(vec);
+
+    return result;
+}
+
+
 /*
 d_tests_sa_vector_element_all
   Aggregation function that runs all element manipulation tests.
@@ -680,6 +873,8 @@ d_tests_sa_vector_element_all
     result = d_tests_sa_vector_erase(_counter) && result;
     result = d_tests_sa_vector_erase_range(_counter) && result;
     result = d_tests_sa_vector_clear(_counter) && result;
+    result = d_tests_sa_vector_apply_edits(_counter) && result;
+    result = d_tests_sa_vector_gap(_counter) && result;
 
     return result;
 }
@@ -208,6 +208,233 @@ d_tests_sa_vector_sort
 }
 
 
+/*
+d_tests_sa_vector_sort_keyed
+  Tests the d_vector_sort_keyed function.
+  Tests the following:
+  - NULL vector and bad key offset rejection
+  - records sorted by a key member, stably
+*/
+bool
+d_tests_sa_vector_sort_keyed
+(
+    struct d_test_counter* _counter
+)
+{
+    struct pair
+    {
+        int id;
+        int key;
+    };
+
+    bool             result;
+    struct d_vector* vec;
+    struct pair      pairs[5] = { {0, 3}, {1, -1}, {2, 3}, {3, 0}, {4, -1} };
+
+    result = true;
+
+    // test 1: NULL vector and key outside the element
+    result = d_assert_standalone(
+        !d_vector_sort_keyed(NULL, D_ARRAY_SORT_KEY_INT32, 0),
+        "sort_keyed_null_vector",
+        "NULL vector should be rejected",
+        _counter) && result;
+
+    vec = d_vector_new_from_array(sizeof(struct pair), pairs, 5);
+
+    if (vec)
+    {
+        result = d_assert_standalone(
+            !d_vector_sort_keyed(vec, D_ARRAY_SORT_KEY_INT32, sizeof(struct pair)),
+            "sort_keyed_bad_offset",
+            "A key past the end of the element should be rejected",
+            _counter) && result;
+
+        // test 2: stable sort by key
+        d_vector_sort_keyed(vec, D_ARRAY_SORT_KEY_INT32, offsetof(struct pair, key));
+
+        {
+            struct pair* arr    = (struct pair*)vec->elements;
+            bool         sorted = (arr[0].id == 1) && (arr[1].id == 4) &&
+                                  (arr[2].id == 3) && (arr[3].id == 0) &&
+                                  (arr[4].id == 2);
+
+            result = d_assert_standalone(
+                sorted,
+                "sort_keyed_result",
+                "Records should be ordered by key, ties in original order",
+                _counter) && result;
+        }
+
+        d_vector_free(vec);
+    }
+
+    return result;
+}
+
+
+/*
+d_tests_sa_vector_sort_parallel
+  Tests the d_vector_sort_parallel function.
+  Tests the following:
+  - NULL vector and NULL comparator rejection
+  - a vector large enough to be split across threads ends up sorted
+*/
+bool
+d_tests_sa_vector_sort_parallel
+(
+    struct d_test_counter* _counter
+)
+{
+    bool             result;
+    struct d_vector* vec;
+    size_t           count;
+    size_t           i;
+    uint32_t         state;
+    bool             sorted;
+
+    result = true;
+    count  = (size_t)D_ARRAY_SORT_PARALLEL_THRESHOLD * 2;
+
+    // test 1: NULL arguments
+    result = d_assert_standalone(
+        !d_vector_sort_parallel(NULL, int_comparator_util, D_ARRAY_SORT_UNSTABLE, 2),
+        "sort_parallel_null_vector",
+        "NULL vector should be rejected",
+        _counter) && result;
+
+    vec = d_vector_new(sizeof(int), count);
+
+    if (vec)
+    {
+        result = d_assert_standalone(
+            !d_vector_sort_parallel(vec, NULL, D_ARRAY_SORT_UNSTABLE, 2),
+            "sort_parallel_null_comparator",
+            "NULL comparator should be rejected",
+            _counter) && result;
+
+        state = 7;
+
+        for (i = 0; i < count; i++)
+        {
+            state                    = (state * 1664525u) + 1013904223u;
+            ((int*)vec->elements)[i] = (int)(state >> 8);
+        }
+
+        vec->count = count;
+
+        // test 2: sorted on four threads
+        sorted = d_vector_sort_parallel(vec, int_comparator_util, D_ARRAY_SORT_UNSTABLE, 4);
+
+        for (i = 1; (sorted) && (i < count); i++)
+        {
+            sorted = (((int*)vec->elements)[i - 1] <= ((int*)vec->elements)[i]);
+        }
+
+        result = d_assert_standalone(
+            sorted,
+            "sort_parallel_result",
+            "Elements should be in ascending order",
+            _counter) && result;
+
+        d_vector_free(vec);
+    }
+
+    return result;
+}
+
+
+/*
+d_tests_sa_vector_merge_sorted
+  Tests the d_vector_merge_sorted function.
+  Tests the following:
+  - NULL array and mismatched element size rejection
+  - NULL and empty inputs are skipped
+  - the result is sorted, holds every element, and leaves inputs unchanged
+*/
+bool
+d_tests_sa_vector_merge_sorted
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                   result;
+    struct d_vector*       a;
+    struct d_vector*       b;
+    struct d_vector*       empty;
+    struct d_vector*       wide;
+    struct d_vector*       merged;
+    const struct d_vector* inputs[4];
+    int                    expected[7] = { 1, 2, 3, 4, 5, 6, 9 };
+    size_t                 i;
+    bool                   same;
+
+    result = true;
+
+    // test 1: NULL input array
+    result = d_assert_standalone(
+        d_vector_merge_sorted(NULL, 2, int_comparator_util, 1) == NULL,
+        "merge_sorted_null",
+        "NULL vector array should return NULL",
+        _counter) && result;
+
+    a     = d_vector_new_from_args(sizeof(int), 4, 1, 3, 5, 9);
+    b     = d_vector_new_from_args(sizeof(int), 3, 2, 4, 6);
+    empty = d_vector_new(sizeof(int), 0);
+    wide  = d_vector_new(sizeof(double), 4);
+
+    if ( (a)     &&
+         (b)     &&
+         (empty) &&
+         (wide) )
+    {
+        // test 2: element sizes must match
+        inputs[0] = a;
+        inputs[1] = wide;
+
+        result = d_assert_standalone(
+            d_vector_merge_sorted(inputs, 2, int_comparator_util, 1) == NULL,
+            "merge_sorted_size_mismatch",
+            "Vectors with different element sizes should return NULL",
+            _counter) && result;
+
+        // test 3: merge with NULL and empty entries
+        inputs[0] = a;
+        inputs[1] = NULL;
+        inputs[2] = empty;
+        inputs[3] = b;
+        merged    = d_vector_merge_sorted(inputs, 4, int_comparator_util, 2);
+        same      = (merged) && (merged->count == 7);
+
+        for (i = 0; (same) && (i < 7); i++)
+        {
+            same = (((int*)merged->elements)[i] == expected[i]);
+        }
+
+        result = d_assert_standalone(
+            same,
+            "merge_sorted_result",
+            "Merged vector should be [1, 2, 3, 4, 5, 6, 9]",
+            _counter) && result;
+
+        result = d_assert_standalone(
+            (a->count == 4) && (b->count == 3),
+            "merge_sorted_inputs_unchanged",
+            "Input vectors should be left unchanged",
+            _counter) && result;
+
+        d_vector_free(merged);
+    }
+
+    d_vector_free(a);
+    d_vector_free(b);
+    d_vector_free(empty);
+    d_vector_free(wide);
+
+    return result;
+}
+
+
 /*
 d_tests_sa_vector_copy_to
   Tests the d_vector_copy_to function.
@@ -299,6 +526,9 @@ d_tests_sa_vector_utility_all
     result = d_tests_sa_vector_swap(_counter) && result;
     result = d_tests_sa_vector_reverse(_counter) && result;
     result = d_tests_sa_vector_sort(_counter) && result;
+    result = d_tests_sa_vector_sort_keyed(_counter) && result;
+    result = d_tests_sa_vector_sort_parallel(_counter) && result;
+    result = d_tests_sa_vector_merge_sorted(_counter) && result;
     result = d_tests_sa_vector_copy_to(_counter) && result;
 
     return result;
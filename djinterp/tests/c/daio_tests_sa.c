@@ -0,0 +1,26 @@
+#include ".\daio_tests_sa.h"
+
+
+/*
+d_tests_sa_daio_run_all
+  Module-level aggregation function that runs all daio tests.
+  Executes tests for all categories:
+  - Engine lifetime and submission
+  - Operations and completion delivery
+*/
+bool
+d_tests_sa_daio_run_all
+(
+    struct d_test_counter* _counter
+)
+{
+    bool result;
+
+    result = true;
+
+    // run all test categories
+    result = d_tests_sa_aio_engine_all(_counter) && result;
+    result = d_tests_sa_aio_ops_all(_counter) && result;
+
+    return result;
+}
@@ -0,0 +1,67 @@
+/******************************************************************************
+* djinterp [test]                                              daio_tests_sa.h
+*
+*   Unit test declarations for `daio.h` module.
+*   Covers engine lifetime, request submission and validation, each
+* operation (read, write, fsync, open, close), and the three completion
+* delivery paths (callback, event handler, d_aio_next). Tests run against
+* whichever backend d_aio_engine_new selects on the host.
+*
+*
+* path:      \tests\daio_tests_sa.h
+* link:      TBA
+* author(s): Samuel 'teer' Neal-Blim                          date: 2026.10.18
+******************************************************************************/
+
+#ifndef DJINTERP_TESTS_DAIO_STANDALONE_
+#define DJINTERP_TESTS_DAIO_STANDALONE_ 1
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "..\..\inc\c\test\test_standalone.h"
+#include "..\..\inc\c\daio.h"
+#include "..\..\inc\c\dfile.h"
+#include "..\..\inc\c\string_fn.h"
+#include "..\..\inc\c\event\event_handler.h"
+
+
+// D_TEST_DAIO_FILE
+//   constant: scratch file used by the daio tests (removed afterwards).
+#define D_TEST_DAIO_FILE "daio_test_tmp.bin"
+
+
+/******************************************************************************
+ * I. ENGINE LIFETIME AND SUBMISSION TESTS
+ *****************************************************************************/
+bool d_tests_sa_aio_engine_new_free(struct d_test_counter* _counter);
+bool d_tests_sa_aio_request_init(struct d_test_counter* _counter);
+bool d_tests_sa_aio_submit_invalid(struct d_test_counter* _counter);
+bool d_tests_sa_aio_null_safety(struct d_test_counter* _counter);
+
+// I. aggregation function
+bool d_tests_sa_aio_engine_all(struct d_test_counter* _counter);
+
+
+/******************************************************************************
+ * II. OPERATION AND COMPLETION TESTS
+ *****************************************************************************/
+bool d_tests_sa_aio_open_close(struct d_test_counter* _counter);
+bool d_tests_sa_aio_write_read(struct d_test_counter* _counter);
+bool d_tests_sa_aio_fsync(struct d_test_counter* _counter);
+bool d_tests_sa_aio_batch(struct d_test_counter* _counter);
+bool d_tests_sa_aio_errors(struct d_test_counter* _counter);
+bool d_tests_sa_aio_event_handler(struct d_test_counter* _counter);
+
+// II. aggregation function
+bool d_tests_sa_aio_ops_all(struct d_test_counter* _counter);
+
+
+/******************************************************************************
+ * MODULE-LEVEL AGGREGATION
+ *****************************************************************************/
+bool d_tests_sa_daio_run_all(struct d_test_counter* _counter);
+
+
+#endif  // DJINTERP_TESTS_DAIO_STANDALONE_
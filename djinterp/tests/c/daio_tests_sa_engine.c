@@ -0,0 +1,276 @@
+#include ".\daio_tests_sa.h"
+
+
+/*
+d_tests_sa_aio_engine_new_free
+  Tests the d_aio_engine_new, d_aio_engine_free and d_aio_backend functions.
+  Tests the following:
+  - default queue depth and worker count produce an engine
+  - the reported backend is one of the two known backends
+  - a fresh engine has nothing pending
+  - an explicit small queue depth and worker count are accepted
+*/
+bool
+d_tests_sa_aio_engine_new_free
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                 result;
+    struct d_aio_engine* engine;
+    int                  backend;
+
+    result = true;
+
+    // test 1: defaults
+    engine = d_aio_engine_new(0, 0);
+    result = d_assert_standalone(
+        engine != NULL,
+        "aio_engine_new_default",
+        "d_aio_engine_new(0, 0) should create an engine",
+        _counter) && result;
+
+    if (engine)
+    {
+        // test 2: backend is known
+        backend = d_aio_backend(engine);
+        result  = d_assert_standalone(
+            (backend == D_AIO_BACKEND_IO_URING) ||
+            (backend == D_AIO_BACKEND_THREAD_POOL),
+            "aio_engine_backend_known",
+            "d_aio_backend should report io_uring or thread pool",
+            _counter) && result;
+
+        printf("    (backend: %s)\n",
+               (backend == D_AIO_BACKEND_IO_URING) ? "io_uring"
+                                                   : "thread pool");
+
+        // test 3: nothing pending
+        result = d_assert_standalone(
+            d_aio_pending(engine) == 0,
+            "aio_engine_new_idle",
+            "A new engine should have no pending requests",
+            _counter) && result;
+
+        d_aio_engine_free(engine);
+    }
+
+    // test 4: explicit sizes
+    engine = d_aio_engine_new(4, 1);
+    result = d_assert_standalone(
+        engine != NULL,
+        "aio_engine_new_small",
+        "d_aio_engine_new(4, 1) should create an engine",
+        _counter) && result;
+
+    d_aio_engine_free(engine);
+
+    return result;
+}
+
+
+/*
+d_tests_sa_aio_request_init
+  Tests the d_aio_request_init function.
+  Tests the following:
+  - common fields are stored
+  - optional and output fields are cleared
+*/
+bool
+d_tests_sa_aio_request_init
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                 result;
+    struct d_aio_request request;
+    char                 buffer[8];
+
+    result = true;
+
+    d_memset(&request, 0xA5, sizeof(request));
+    d_aio_request_init(&request, D_AIO_OP_WRITE, 7, buffer, sizeof(buffer), 100);
+
+    // test 1: fields stored
+    result = d_assert_standalone(
+        (request.op == D_AIO_OP_WRITE) &&
+        (request.fd == 7)              &&
+        (request.buffer == buffer)     &&
+        (request.length == sizeof(buffer)) &&
+        (request.offset == 100),
+        "aio_request_init_fields",
+        "d_aio_request_init should store op, fd, buffer, length and offset",
+        _counter) && result;
+
+    // test 2: everything else cleared
+    result = d_assert_standalone(
+        (request.path == NULL)      &&
+        (request.flags == 0)        &&
+        (request.callback == NULL)  &&
+        (request.user_data == NULL) &&
+        (request.result == 0)       &&
+        (request.error == 0)        &&
+        (request.next == NULL),
+        "aio_request_init_cleared",
+        "d_aio_request_init should clear the remaining fields",
+        _counter) && result;
+
+    return result;
+}
+
+
+/*
+d_tests_sa_aio_submit_invalid
+  Tests d_aio_submit parameter validation.
+  Tests the following:
+  - unknown op is rejected with EINVAL
+  - OPEN without a path is rejected
+  - READ with a NULL buffer and nonzero length is rejected
+  - rejected requests are not counted as pending
+*/
+bool
+d_tests_sa_aio_submit_invalid
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                 result;
+    struct d_aio_engine* engine;
+    struct d_aio_request request;
+    int                  rc;
+
+    result = true;
+    engine = d_aio_engine_new(8, 1);
+
+    if (!engine)
+    {
+        return d_assert_standalone(false,
+                                   "aio_submit_invalid_engine",
+                                   "Engine creation failed",
+                                   _counter);
+    }
+
+    // test 1: unknown op
+    d_aio_request_init(&request, 99, 0, NULL, 0, 0);
+    errno  = 0;
+    rc     = d_aio_submit(engine, &request);
+    result = d_assert_standalone(
+        (rc == -1) && (errno == EINVAL),
+        "aio_submit_bad_op",
+        "Unknown op should fail with EINVAL",
+        _counter) && result;
+
+    // test 2: open without path
+    d_aio_request_init(&request, D_AIO_OP_OPEN, -1, NULL, 0, 0);
+    rc     = d_aio_submit(engine, &request);
+    result = d_assert_standalone(
+        rc == -1,
+        "aio_submit_open_no_path",
+        "OPEN without a path should be rejected",
+        _counter) && result;
+
+    // test 3: read into NULL
+    d_aio_request_init(&request, D_AIO_OP_READ, 0, NULL, 16, 0);
+    rc     = d_aio_submit(engine, &request);
+    result = d_assert_standalone(
+        rc == -1,
+        "aio_submit_read_null",
+        "READ into a NULL buffer should be rejected",
+        _counter) && result;
+
+    // test 4: nothing pending
+    result = d_assert_standalone(
+        d_aio_pending(engine) == 0,
+        "aio_submit_invalid_not_pending",
+        "Rejected requests should not be pending",
+        _counter) && result;
+
+    d_aio_engine_free(engine);
+
+    return result;
+}
+
+
+/*
+d_tests_sa_aio_null_safety
+  Tests NULL handling across the daio API.
+  Tests the following:
+  - every entry point tolerates a NULL engine
+  - submit rejects a NULL request
+*/
+bool
+d_tests_sa_aio_null_safety
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                 result;
+    struct d_aio_engine* engine;
+
+    result = true;
+
+    // test 1: NULL engine
+    d_aio_engine_free(NULL);
+    d_aio_request_init(NULL, D_AIO_OP_READ, 0, NULL, 0, 0);
+
+    result = d_assert_standalone(
+        (d_aio_submit(NULL, NULL) == -1)                  &&
+        (d_aio_flush(NULL) == -1)                         &&
+        (d_aio_poll(NULL, 0) == 0)                        &&
+        (d_aio_wait(NULL, 1, 0) == 0)                     &&
+        (d_aio_next(NULL) == NULL)                        &&
+        (d_aio_pending(NULL) == 0)                        &&
+        (d_aio_attach_event_handler(NULL, NULL, 0) == -1),
+        "aio_null_engine",
+        "All daio functions should handle a NULL engine",
+        _counter) && result;
+
+    // test 2: NULL request
+    engine = d_aio_engine_new(4, 1);
+
+    if (engine)
+    {
+        result = d_assert_standalone(
+            d_aio_submit(engine, NULL) == -1,
+            "aio_null_request",
+            "d_aio_submit should reject a NULL request",
+            _counter) && result;
+
+        // test 3: waiting on an idle engine returns immediately
+        result = d_assert_standalone(
+            d_aio_wait(engine, 1, 0) == 0,
+            "aio_wait_idle",
+            "d_aio_wait should return 0 when nothing is in flight",
+            _counter) && result;
+
+        d_aio_engine_free(engine);
+    }
+
+    return result;
+}
+
+
+/*
+d_tests_sa_aio_engine_all
+  Aggregation function that runs all engine lifetime and submission tests.
+*/
+bool
+d_tests_sa_aio_engine_all
+(
+    struct d_test_counter* _counter
+)
+{
+    bool result;
+
+    result = true;
+
+    printf("\n  [SECTION] Engine Lifetime and Submission\n");
+    printf("  ----------------------------------------\n");
+
+    result = d_tests_sa_aio_engine_new_free(_counter) && result;
+    result = d_tests_sa_aio_request_init(_counter) && result;
+    result = d_tests_sa_aio_submit_invalid(_counter) && result;
+    result = d_tests_sa_aio_null_safety(_counter) && result;
+
+    return result;
+}
@@ -0,0 +1,631 @@
+#include ".\daio_tests_sa.h"
+
+
+///////////////////////////////////////////////////////////////////////////////
+// file-scope helpers
+///////////////////////////////////////////////////////////////////////////////
+
+#define D_TEST_AIO_BLOCK  4096
+#define D_TEST_AIO_BLOCKS 32
+
+// event id used for the event handler test
+#define D_TEST_AIO_EVENT_ID 0x41
+
+// completion record filled by d_test_aio_on_complete
+struct d_test_aio_tally
+{
+    size_t count;
+    size_t bytes;
+    size_t failures;
+};
+
+// helper: callback that tallies completions
+static void
+d_test_aio_on_complete
+(
+    struct d_aio_request* _request,
+    void*                 _user_data
+)
+{
+    struct d_test_aio_tally* tally;
+
+    tally = (struct d_test_aio_tally*)_user_data;
+
+    tally->count++;
+
+    if (_request->error)
+    {
+        tally->failures++;
+    }
+    else if (_request->result > 0)
+    {
+        tally->bytes += (size_t)_request->result;
+    }
+
+    return;
+}
+
+// helper: submits one request, waits for it, and returns it via d_aio_next
+static struct d_aio_request*
+d_test_aio_run_one
+(
+    struct d_aio_engine*  _engine,
+    struct d_aio_request* _request
+)
+{
+    if (d_aio_submit(_engine, _request) != 0)
+    {
+        return NULL;
+    }
+
+    d_aio_wait(_engine, 1, 1);
+
+    return d_aio_next(_engine);
+}
+
+// helper: opens the scratch file through the engine
+static int
+d_test_aio_open_scratch
+(
+    struct d_aio_engine* _engine
+)
+{
+    struct d_aio_request  request;
+    struct d_aio_request* done;
+
+    d_aio_request_init(&request, D_AIO_OP_OPEN, -1, NULL, 0, 0);
+    request.path  = D_TEST_DAIO_FILE;
+    request.flags = O_RDWR | O_CREAT | O_TRUNC;
+    request.mode  = 0644;
+
+    done = d_test_aio_run_one(_engine, &request);
+
+    return ( (done == &request) &&
+             (request.error == 0) ) ? (int)request.result
+                                    : -1;
+}
+
+
+///////////////////////////////////////////////////////////////////////////////
+// test functions
+///////////////////////////////////////////////////////////////////////////////
+
+
+/*
+d_tests_sa_aio_open_close
+  Tests D_AIO_OP_OPEN and D_AIO_OP_CLOSE.
+  Tests the following:
+  - OPEN creates the file and yields a usable descriptor
+  - CLOSE succeeds on that descriptor
+  - OPEN of a missing file without O_CREAT reports ENOENT
+*/
+bool
+d_tests_sa_aio_open_close
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                  result;
+    struct d_aio_engine*  engine;
+    struct d_aio_request  request;
+    struct d_aio_request* done;
+    int                   fd;
+
+    result = true;
+    engine = d_aio_engine_new(8, 2);
+
+    if (!engine)
+    {
+        return d_assert_standalone(false,
+                                   "aio_open_close_engine",
+                                   "Engine creation failed",
+                                   _counter);
+    }
+
+    // test 1: open with create
+    fd     = d_test_aio_open_scratch(engine);
+    result = d_assert_standalone(
+        (fd >= 0) && (d_file_exists(D_TEST_DAIO_FILE)),
+        "aio_open_create",
+        "OPEN with O_CREAT should create the file and return an fd",
+        _counter) && result;
+
+    // test 2: close
+    if (fd >= 0)
+    {
+        d_aio_request_init(&request, D_AIO_OP_CLOSE, fd, NULL, 0, 0);
+        done   = d_test_aio_run_one(engine, &request);
+        result = d_assert_standalone(
+            (done == &request) &&
+            (request.error == 0) &&
+            (request.result == 0),
+            "aio_close",
+            "CLOSE should succeed on an fd from OPEN",
+            _counter) && result;
+    }
+
+    // test 3: open missing
+    d_aio_request_init(&request, D_AIO_OP_OPEN, -1, NULL, 0, 0);
+    request.path  = "daio_test_missing/none.bin";
+    request.flags = O_RDONLY;
+    done   = d_test_aio_run_one(engine, &request);
+    result = d_assert_standalone(
+        (done == &request) &&
+        (request.result == -1) &&
+        (request.error == ENOENT),
+        "aio_open_missing",
+        "OPEN of a missing file should report ENOENT",
+        _counter) && result;
+
+    d_aio_engine_free(engine);
+    d_remove(D_TEST_DAIO_FILE);
+
+    return result;
+}
+
+
+/*
+d_tests_sa_aio_write_read
+  Tests D_AIO_OP_WRITE and D_AIO_OP_READ.
+  Tests the following:
+  - a positioned write reports the full length
+  - a read at the same offset returns the written bytes
+  - a read past end of file returns 0
+*/
+bool
+d_tests_sa_aio_write_read
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                  result;
+    struct d_aio_engine*  engine;
+    struct d_aio_request  request;
+    struct d_aio_request* done;
+    const char*           text;
+    char                  buffer[64];
+    int                   fd;
+
+    result = true;
+    text   = "asynchronous hello";
+    engine = d_aio_engine_new(8, 2);
+    fd     = (engine) ? d_test_aio_open_scratch(engine) : -1;
+
+    if (fd < 0)
+    {
+        d_aio_engine_free(engine);
+
+        return d_assert_standalone(false,
+                                   "aio_write_read_setup",
+                                   "Engine or scratch file setup failed",
+                                   _counter);
+    }
+
+    // test 1: write at offset 10
+    d_aio_request_init(&request, D_AIO_OP_WRITE, fd, (void*)text, d_strnlen(text, 64), 10);
+    done   = d_test_aio_run_one(engine, &request);
+    result = d_assert_standalone(
+        (done == &request) &&
+        (request.result == (ssize_t)d_strnlen(text, 64)),
+        "aio_write",
+        "WRITE should transfer the full buffer",
+        _counter) && result;
+
+    // test 2: read it back
+    d_memset(buffer, 0, sizeof(buffer));
+    d_aio_request_init(&request, D_AIO_OP_READ, fd, buffer, d_strnlen(text, 64), 10);
+    done   = d_test_aio_run_one(engine, &request);
+    result = d_assert_standalone(
+        (done == &request) &&
+        (request.result == (ssize_t)d_strnlen(text, 64)) &&
+        (memcmp(buffer, text, d_strnlen(text, 64)) == 0),
+        "aio_read",
+        "READ should return the bytes written at that offset",
+        _counter) && result;
+
+    // test 3: read at end of file
+    d_aio_request_init(&request, D_AIO_OP_READ, fd, buffer, sizeof(buffer), 4096);
+    done   = d_test_aio_run_one(engine, &request);
+    result = d_assert_standalone(
+        (done == &request) &&
+        (request.result == 0) &&
+        (request.error == 0),
+        "aio_read_eof",
+        "READ past end of file should return 0",
+        _counter) && result;
+
+    d_close(fd);
+    d_aio_engine_free(engine);
+    d_remove(D_TEST_DAIO_FILE);
+
+    return result;
+}
+
+
+/*
+d_tests_sa_aio_fsync
+  Tests D_AIO_OP_FSYNC.
+  Tests the following:
+  - full fsync succeeds after a write
+  - data-only fsync (D_AIO_FSYNC_DATA) succeeds
+*/
+bool
+d_tests_sa_aio_fsync
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                  result;
+    struct d_aio_engine*  engine;
+    struct d_aio_request  request;
+    struct d_aio_request* done;
+    int                   fd;
+
+    result = true;
+    engine = d_aio_engine_new(8, 2);
+    fd     = (engine) ? d_test_aio_open_scratch(engine) : -1;
+
+    if (fd < 0)
+    {
+        d_aio_engine_free(engine);
+
+        return d_assert_standalone(false,
+                                   "aio_fsync_setup",
+                                   "Engine or scratch file setup failed",
+                                   _counter);
+    }
+
+    d_write(fd, "sync me", 7);
+
+    // test 1: fsync
+    d_aio_request_init(&request, D_AIO_OP_FSYNC, fd, NULL, 0, 0);
+    done   = d_test_aio_run_one(engine, &request);
+    result = d_assert_standalone(
+        (done == &request) &&
+        (request.result == 0) &&
+        (request.error == 0),
+        "aio_fsync",
+        "FSYNC should succeed",
+        _counter) && result;
+
+    // test 2: fdatasync
+    d_aio_request_init(&request, D_AIO_OP_FSYNC, fd, NULL, 0, 0);
+    request.flags = D_AIO_FSYNC_DATA;
+    done   = d_test_aio_run_one(engine, &request);
+    result = d_assert_standalone(
+        (done == &request) &&
+        (request.result == 0) &&
+        (request.error == 0),
+        "aio_fsync_data",
+        "FSYNC with D_AIO_FSYNC_DATA should succeed",
+        _counter) && result;
+
+    d_close(fd);
+    d_aio_engine_free(engine);
+    d_remove(D_TEST_DAIO_FILE);
+
+    return result;
+}
+
+
+/*
+d_tests_sa_aio_batch
+  Tests many requests in flight at once with callback delivery.
+  Tests the following:
+  - more writes than the queue depth are all accepted
+  - every callback fires once and the byte total matches
+  - nothing is left pending after d_aio_wait
+  - a batch of reads sees every block's contents
+*/
+bool
+d_tests_sa_aio_batch
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                    result;
+    struct d_aio_engine*    engine;
+    struct d_aio_request    requests[D_TEST_AIO_BLOCKS];
+    struct d_test_aio_tally tally;
+    unsigned char*          data;
+    unsigned char*          check;
+    bool                    submitted;
+    bool                    matches;
+    size_t                  i;
+    int                     fd;
+
+    result = true;
+    data   = malloc(D_TEST_AIO_BLOCK * D_TEST_AIO_BLOCKS);
+    check  = malloc(D_TEST_AIO_BLOCK * D_TEST_AIO_BLOCKS);
+    engine = d_aio_engine_new(8, 4);
+    fd     = ( (engine) && (data) && (check) ) ? d_test_aio_open_scratch(engine)
+                                                : -1;
+
+    if (fd < 0)
+    {
+        free(data);
+        free(check);
+        d_aio_engine_free(engine);
+
+        return d_assert_standalone(false,
+                                   "aio_batch_setup",
+                                   "Engine, buffer or scratch file setup failed",
+                                   _counter);
+    }
+
+    for (i = 0; i < (D_TEST_AIO_BLOCK * D_TEST_AIO_BLOCKS); i++)
+    {
+        data[i] = (unsigned char)((i / D_TEST_AIO_BLOCK) + (i * 7));
+    }
+
+    // test 1: submit every block
+    d_memset(&tally, 0, sizeof(tally));
+    submitted = true;
+
+    for (i = 0; i < D_TEST_AIO_BLOCKS; i++)
+    {
+        d_aio_request_init(&requests[i],
+                           D_AIO_OP_WRITE,
+                           fd,
+                           data + (i * D_TEST_AIO_BLOCK),
+                           D_TEST_AIO_BLOCK,
+                           (d_off_t)(i * D_TEST_AIO_BLOCK));
+        requests[i].callback  = d_test_aio_on_complete;
+        requests[i].user_data = &tally;
+
+        submitted = (d_aio_submit(engine, &requests[i]) == 0) && submitted;
+    }
+
+    result = d_assert_standalone(
+        submitted,
+        "aio_batch_submit",
+        "Submitting more writes than the queue depth should succeed",
+        _counter) && result;
+
+    // test 2: every callback fired
+    d_aio_wait(engine, D_TEST_AIO_BLOCKS, 0);
+    result = d_assert_standalone(
+        (tally.count == D_TEST_AIO_BLOCKS) &&
+        (tally.failures == 0) &&
+        (tally.bytes == (D_TEST_AIO_BLOCK * D_TEST_AIO_BLOCKS)),
+        "aio_batch_callbacks",
+        "Each write should complete once through its callback",
+        _counter) && result;
+
+    // test 3: drained
+    result = d_assert_standalone(
+        (d_aio_pending(engine) == 0) &&
+        (d_aio_next(engine) == NULL),
+        "aio_batch_drained",
+        "Nothing should remain pending or unclaimed",
+        _counter) && result;
+
+    // test 4: read everything back in one batch
+    d_memset(&tally, 0, sizeof(tally));
+    d_memset(check, 0, D_TEST_AIO_BLOCK * D_TEST_AIO_BLOCKS);
+
+    for (i = 0; i < D_TEST_AIO_BLOCKS; i++)
+    {
+        d_aio_request_init(&requests[i],
+                           D_AIO_OP_READ,
+                           fd,
+                           check + (i * D_TEST_AIO_BLOCK),
+                           D_TEST_AIO_BLOCK,
+                           (d_off_t)(i * D_TEST_AIO_BLOCK));
+        requests[i].callback  = d_test_aio_on_complete;
+        requests[i].user_data = &tally;
+
+        d_aio_submit(engine, &requests[i]);
+    }
+
+    d_aio_wait(engine, D_TEST_AIO_BLOCKS, 0);
+    matches = (memcmp(data, check, D_TEST_AIO_BLOCK * D_TEST_AIO_BLOCKS) == 0);
+    result  = d_assert_standalone(
+        (tally.count == D_TEST_AIO_BLOCKS) && matches,
+        "aio_batch_read_back",
+        "Batched reads should return every block written",
+        _counter) && result;
+
+    d_close(fd);
+    d_aio_engine_free(engine);
+    d_remove(D_TEST_DAIO_FILE);
+    free(data);
+    free(check);
+
+    return result;
+}
+
+
+/*
+d_tests_sa_aio_errors
+  Tests error reporting through completions.
+  Tests the following:
+  - READ on a closed descriptor completes with EBADF
+  - WRITE to a read-only descriptor completes with an error
+*/
+bool
+d_tests_sa_aio_errors
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                  result;
+    struct d_aio_engine*  engine;
+    struct d_aio_request  request;
+    struct d_aio_request* done;
+    char                  buffer[16];
+    int                   fd;
+
+    result = true;
+    engine = d_aio_engine_new(8, 1);
+    fd     = (engine) ? d_test_aio_open_scratch(engine) : -1;
+
+    if (fd < 0)
+    {
+        d_aio_engine_free(engine);
+
+        return d_assert_standalone(false,
+                                   "aio_errors_setup",
+                                   "Engine or scratch file setup failed",
+                                   _counter);
+    }
+
+    d_close(fd);
+
+    // test 1: bad descriptor
+    d_aio_request_init(&request, D_AIO_OP_READ, fd, buffer, sizeof(buffer), 0);
+    done   = d_test_aio_run_one(engine, &request);
+    result = d_assert_standalone(
+        (done == &request) &&
+        (request.result == -1) &&
+        (request.error == EBADF),
+        "aio_error_ebadf",
+        "READ on a closed fd should complete with EBADF",
+        _counter) && result;
+
+    // test 2: write to read-only fd
+    fd = d_open(D_TEST_DAIO_FILE, O_RDONLY);
+
+    if (fd >= 0)
+    {
+        d_aio_request_init(&request, D_AIO_OP_WRITE, fd, buffer, sizeof(buffer), 0);
+        done   = d_test_aio_run_one(engine, &request);
+        result = d_assert_standalone(
+            (done == &request) &&
+            (request.result == -1) &&
+            (request.error != 0),
+            "aio_error_readonly",
+            "WRITE to a read-only fd should complete with an error",
+            _counter) && result;
+
+        d_close(fd);
+    }
+
+    d_aio_engine_free(engine);
+    d_remove(D_TEST_DAIO_FILE);
+
+    return result;
+}
+
+
+/*
+d_tests_sa_aio_event_handler
+  Tests completion delivery through an attached d_event_handler.
+  Tests the following:
+  - attaching a handler succeeds
+  - a completion without a callback is queued as an event
+  - a completion with a callback still goes to the callback
+  - after detaching, completions return to d_aio_next
+*/
+bool
+d_tests_sa_aio_event_handler
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                    result;
+    struct d_aio_engine*    engine;
+    struct d_event_handler* handler;
+    struct d_aio_request    request;
+    struct d_test_aio_tally tally;
+    char                    buffer[16];
+    int                     fd;
+
+    result  = true;
+    engine  = d_aio_engine_new(8, 1);
+    handler = d_event_handler_new(16, 16);
+    fd      = ( (engine) && (handler) ) ? d_test_aio_open_scratch(engine)
+                                        : -1;
+
+    if (fd < 0)
+    {
+        d_event_handler_free(handler);
+        d_aio_engine_free(engine);
+
+        return d_assert_standalone(false,
+                                   "aio_event_handler_setup",
+                                   "Engine, handler or scratch file setup failed",
+                                   _counter);
+    }
+
+    // test 1: attach
+    result = d_assert_standalone(
+        d_aio_attach_event_handler(engine, handler, D_TEST_AIO_EVENT_ID) == 0,
+        "aio_attach_handler",
+        "Attaching an event handler should succeed",
+        _counter) && result;
+
+    // test 2: completion becomes an event
+    d_aio_request_init(&request, D_AIO_OP_WRITE, fd, "event", 5, 0);
+    d_aio_submit(engine, &request);
+    d_aio_wait(engine, 1, 0);
+
+    result = d_assert_standalone(
+        (d_event_handler_pending_events(handler) == 1) &&
+        (d_aio_next(engine) == NULL),
+        "aio_event_queued",
+        "A completion without a callback should be queued on the handler",
+        _counter) && result;
+
+    // test 3: callback takes precedence
+    d_memset(&tally, 0, sizeof(tally));
+    d_aio_request_init(&request, D_AIO_OP_READ, fd, buffer, 5, 0);
+    request.callback  = d_test_aio_on_complete;
+    request.user_data = &tally;
+    d_aio_submit(engine, &request);
+    d_aio_wait(engine, 1, 0);
+
+    result = d_assert_standalone(
+        (tally.count == 1) &&
+        (d_event_handler_pending_events(handler) == 1),
+        "aio_event_callback_first",
+        "A request with a callback should not produce an event",
+        _counter) && result;
+
+    // test 4: detach
+    d_aio_attach_event_handler(engine, NULL, 0);
+    d_aio_request_init(&request, D_AIO_OP_FSYNC, fd, NULL, 0, 0);
+    d_aio_submit(engine, &request);
+    d_aio_wait(engine, 1, 0);
+
+    result = d_assert_standalone(
+        d_aio_next(engine) == &request,
+        "aio_event_detached",
+        "After detaching, completions should go to d_aio_next",
+        _counter) && result;
+
+    d_close(fd);
+    d_aio_engine_free(engine);
+    d_event_handler_free(handler);
+    d_remove(D_TEST_DAIO_FILE);
+
+    return result;
+}
+
+
+/*
+d_tests_sa_aio_ops_all
+  Aggregation function that runs all operation and completion tests.
+*/
+bool
+d_tests_sa_aio_ops_all
+(
+    struct d_test_counter* _counter
+)
+{
+    bool result;
+
+    result = true;
+
+    printf("\n  [SECTION] Operations and Completion\n");
+    printf("  -----------------------------------\n");
+
+    result = d_tests_sa_aio_open_close(_counter) && result;
+    result = d_tests_sa_aio_write_read(_counter) && result;
+    result = d_tests_sa_aio_fsync(_counter) && result;
+    result = d_tests_sa_aio_batch(_counter) && result;
+    result = d_tests_sa_aio_errors(_counter) && result;
+    result = d_tests_sa_aio_event_handler(_counter) && result;
+
+    return result;
+}
@@ -47,9 +47,9 @@ d_tests_dfile_run_all
 
     // determine total test count based on available features
 #if D_FILE_HAS_SYMLINKS
-    total_tests = 14;
+    total_tests = 15;
 #else
-    total_tests = 13;
+    total_tests = 14;
 #endif
 
     // create root test group
@@ -81,6 +81,7 @@ d_tests_dfile_run_all
 
     root->elements[idx++] = d_tests_dfile_pipe_operations_all();
     root->elements[idx++] = d_tests_dfile_binary_io_all();
+    root->elements[idx++] = d_tests_dfile_memory_mapped_all();
     root->elements[idx++] = d_tests_dfile_null_params_all();
 
     // teardown test environment
@@ -153,6 +153,9 @@ struct d_test_object* d_tests_dfile_path_join(void);
 struct d_test_object* d_tests_dfile_path_normalize(void);
 struct d_test_object* d_tests_dfile_path_is_absolute(void);
 struct d_test_object* d_tests_dfile_get_extension(void);
+struct d_test_object* d_tests_dfile_path_slices(void);
+struct d_test_object* d_tests_dfile_path_normalize_to(void);
+struct d_test_object* d_tests_dfile_path_builder(void);
 struct d_test_object* d_tests_dfile_path_utilities_all(void);
 
 #if D_FILE_HAS_SYMLINKS
@@ -171,8 +174,19 @@ struct d_test_object* d_tests_dfile_pipe_operations_all(void);
 struct d_test_object* d_tests_dfile_fread_all(void);
 struct d_test_object* d_tests_dfile_fwrite_all(void);
 struct d_test_object* d_tests_dfile_fappend_all(void);
+struct d_test_object* d_tests_dfile_fwrite_all_atomic(void);
+struct d_test_object* d_tests_dfile_fwrite_group(void);
 struct d_test_object* d_tests_dfile_binary_io_all(void);
 
+// XVI. memory-mapped file tests
+#if D_FILE_HAS_MMAP
+struct d_test_object* d_tests_dfile_mmap(void);
+struct d_test_object* d_tests_dfile_mmap_range(void);
+struct d_test_object* d_tests_dfile_mmap_write(void);
+#endif
+struct d_test_object* d_tests_dfile_fread_all_view(void);
+struct d_test_object* d_tests_dfile_memory_mapped_all(void);
+
 // null parameter tests
 struct d_test_object* d_tests_dfile_null_params_all(void);
 
@@ -245,6 +245,226 @@ d_tests_dfile_fappend_all
 }
 
 
+/*
+d_tests_dfile_fwrite_all_atomic
+  Tests d_fwrite_all_atomic and d_fsync_dir.
+  Tests the following:
+  - creates a new file with the given content
+  - replaces an existing file
+  - leaves no temporary files behind
+  - d_fsync_dir succeeds on the test directory
+  - returns error for NULL path
+*/
+struct d_test_object*
+d_tests_dfile_fwrite_all_atomic
+(
+    void
+)
+{
+    struct d_test_object* group;
+    struct d_dir_t*       dir;
+    struct d_dirent_t*    entry;
+    char                  path_buf[D_INTERNAL_TEST_PATH_BUF_SIZE];
+    char*                 read_content;
+    size_t                read_size;
+    int                   result;
+    bool                  test_create;
+    bool                  test_replace;
+    bool                  test_no_temp;
+    bool                  test_dir_sync;
+    bool                  test_null_path;
+    size_t                idx;
+
+    // setup
+    d_tests_dfile_get_test_path(path_buf,
+                               sizeof(path_buf),
+                               "atomic_test.txt");
+
+    // test 1: create
+    result       = d_fwrite_all_atomic(path_buf, "first", 5);
+    read_content = (char*)d_fread_all(path_buf, &read_size);
+    test_create  = (result == 0) &&
+                   (read_content != NULL) &&
+                   (strcmp(read_content, "first") == 0);
+    free(read_content);
+
+    // test 2: replace
+    result       = d_fwrite_all_atomic(path_buf, "second!", 7);
+    read_content = (char*)d_fread_all(path_buf, &read_size);
+    test_replace = (result == 0) &&
+                   (read_content != NULL) &&
+                   (strcmp(read_content, "second!") == 0);
+    free(read_content);
+
+    // test 3: no ".tmp" siblings remain
+    test_no_temp = true;
+    dir          = d_opendir(D_TEST_DFILE_TEMP_DIR);
+
+    if (dir)
+    {
+        while ((entry = d_readdir(dir)) != NULL)
+        {
+            if (strstr(entry->d_name, "atomic_test.txt.tmp"))
+            {
+                test_no_temp = false;
+            }
+        }
+
+        d_closedir(dir);
+    }
+
+    // test 4: directory sync
+    test_dir_sync = (d_fsync_dir(D_TEST_DFILE_TEMP_DIR) == 0);
+
+    // cleanup
+    d_remove(path_buf);
+
+    // test 5: NULL path
+    result         = d_fwrite_all_atomic(NULL, "data", 4);
+    test_null_path = (result != 0);
+
+    // build result tree
+    group = d_test_object_new_interior("d_fwrite_all_atomic", 5);
+
+    if (!group)
+    {
+        return NULL;
+    }
+
+    idx = 0;
+    group->elements[idx++] = D_ASSERT_TRUE("create",
+                                           test_create,
+                                           "d_fwrite_all_atomic creates file");
+    group->elements[idx++] = D_ASSERT_TRUE("replace",
+                                           test_replace,
+                                           "d_fwrite_all_atomic replaces file");
+    group->elements[idx++] = D_ASSERT_TRUE("no_temp",
+                                           test_no_temp,
+                                           "no temporary file left behind");
+    group->elements[idx++] = D_ASSERT_TRUE("dir_sync",
+                                           test_dir_sync,
+                                           "d_fsync_dir syncs directory");
+    group->elements[idx++] = D_ASSERT_TRUE("null_path",
+                                           test_null_path,
+                                           "d_fwrite_all_atomic returns error for NULL");
+
+    return group;
+}
+
+
+/*
+d_tests_dfile_fwrite_group
+  Tests d_fwrite_group staging, commit and abort.
+  Tests the following:
+  - staged writes are not visible before commit
+  - commit publishes every staged write and empties the group
+  - abort discards staged writes
+  - returns error for NULL group
+*/
+struct d_test_object*
+d_tests_dfile_fwrite_group
+(
+    void
+)
+{
+    struct d_fwrite_group* wg;
+    struct d_test_object*  group;
+    char                   path_a[D_INTERNAL_TEST_PATH_BUF_SIZE];
+    char                   path_b[D_INTERNAL_TEST_PATH_BUF_SIZE];
+    char*                  content_a;
+    char*                  content_b;
+    size_t                 size;
+    bool                   test_staged;
+    bool                   test_commit;
+    bool                   test_abort;
+    bool                   test_null;
+    size_t                 idx;
+
+    // setup
+    d_tests_dfile_get_test_path(path_a, sizeof(path_a), "group_a.txt");
+    d_tests_dfile_get_test_path(path_b, sizeof(path_b), "group_b.txt");
+    d_fwrite_all(path_a, "old", 3);
+
+    test_staged = false;
+    test_commit = false;
+    test_abort  = false;
+    wg          = d_fwrite_group_new();
+
+    if (wg)
+    {
+        // test 1: staged but not yet visible
+        test_staged = (d_fwrite_group_add(wg, path_a, "alpha", 5) == 0) &&
+                      (d_fwrite_group_add(wg, path_b, "beta", 4) == 0)  &&
+                      (d_fwrite_group_count(wg) == 2)                   &&
+                      (!d_file_exists(path_b));
+
+        content_a   = (char*)d_fread_all(path_a, &size);
+        test_staged = test_staged &&
+                      (content_a != NULL) &&
+                      (strcmp(content_a, "old") == 0);
+        free(content_a);
+
+        // test 2: commit
+        test_commit = (d_fwrite_group_commit(wg) == 0) &&
+                      (d_fwrite_group_count(wg) == 0);
+
+        content_a   = (char*)d_fread_all(path_a, &size);
+        content_b   = (char*)d_fread_all(path_b, &size);
+        test_commit = test_commit &&
+                      (content_a != NULL) &&
+                      (content_b != NULL) &&
+                      (strcmp(content_a, "alpha") == 0) &&
+                      (strcmp(content_b, "beta") == 0);
+        free(content_a);
+        free(content_b);
+
+        // test 3: abort
+        d_fwrite_group_add(wg, path_a, "discarded", 9);
+        d_fwrite_group_abort(wg);
+
+        content_a  = (char*)d_fread_all(path_a, &size);
+        test_abort = (d_fwrite_group_count(wg) == 0) &&
+                     (content_a != NULL) &&
+                     (strcmp(content_a, "alpha") == 0);
+        free(content_a);
+
+        d_fwrite_group_free(wg);
+    }
+
+    // cleanup
+    d_remove(path_a);
+    d_remove(path_b);
+
+    // test 4: NULL group
+    test_null = (d_fwrite_group_add(NULL, path_a, "x", 1) != 0) &&
+                (d_fwrite_group_commit(NULL) != 0);
+
+    // build result tree
+    group = d_test_object_new_interior("d_fwrite_group", 4);
+
+    if (!group)
+    {
+        return NULL;
+    }
+
+    idx = 0;
+    group->elements[idx++] = D_ASSERT_TRUE("staged",
+                                           test_staged,
+                                           "staged writes are not visible");
+    group->elements[idx++] = D_ASSERT_TRUE("commit",
+                                           test_commit,
+                                           "commit publishes all writes");
+    group->elements[idx++] = D_ASSERT_TRUE("abort",
+                                           test_abort,
+                                           "abort discards staged writes");
+    group->elements[idx++] = D_ASSERT_TRUE("null",
+                                           test_null,
+                                           "NULL group is rejected");
+
+    return group;
+}
+
+
 /*
 d_tests_dfile_binary_io_all
   Runs all binary I/O helper tests.
@@ -252,6 +472,8 @@ d_tests_dfile_binary_io_all
   - d_fread_all
   - d_fwrite_all
   - d_fappend_all
+  - d_fwrite_all_atomic
+  - d_fwrite_group
 */
 struct d_test_object*
 d_tests_dfile_binary_io_all
@@ -262,7 +484,7 @@ d_tests_dfile_binary_io_all
     struct d_test_object* group;
     size_t                idx;
 
-    group = d_test_object_new_interior("XV. Binary I/O Helpers", 3);
+    group = d_test_object_new_interior("XV. Binary I/O Helpers", 5);
 
     if (!group)
     {
@@ -273,6 +495,8 @@ d_tests_dfile_binary_io_all
     group->elements[idx++] = d_tests_dfile_fread_all();
     group->elements[idx++] = d_tests_dfile_fwrite_all();
     group->elements[idx++] = d_tests_dfile_fappend_all();
+    group->elements[idx++] = d_tests_dfile_fwrite_all_atomic();
+    group->elements[idx++] = d_tests_dfile_fwrite_group();
 
     return group;
 }
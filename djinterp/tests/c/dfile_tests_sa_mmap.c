@@ -0,0 +1,479 @@
+#include "dfile_tests_sa.h"
+
+
+/******************************************************************************
+ * XVI. MEMORY-MAPPED FILE TESTS
+ *****************************************************************************/
+
+/*
+d_tests_dfile_internal_fill_pattern
+  Fills a buffer with a repeating, position-dependent byte pattern so that
+misplaced offsets are detected by content comparison.
+*/
+static void
+d_tests_dfile_internal_fill_pattern
+(
+    char*  _buf,
+    size_t _size
+)
+{
+    size_t i;
+
+    for (i = 0; i < _size; i++)
+    {
+        _buf[i] = (char)('a' + (i % 26));
+    }
+
+    return;
+}
+
+
+#if D_FILE_HAS_MMAP
+
+/*
+d_tests_dfile_mmap
+  Tests d_mmap and d_munmap on whole files.
+  Tests the following:
+  - maps an existing file read-only
+  - mapped size and content match the file
+  - d_munmap succeeds and clears the mapping
+  - an empty file maps to an empty view
+  - returns error for nonexistent file
+  - returns error for NULL path
+*/
+struct d_test_object*
+d_tests_dfile_mmap
+(
+    void
+)
+{
+    struct d_test_object* group;
+    struct d_mmap_t       map;
+    char                  path_buf[D_INTERNAL_TEST_PATH_BUF_SIZE];
+    char                  empty_buf[D_INTERNAL_TEST_PATH_BUF_SIZE];
+    int                   result;
+    bool                  test_map;
+    bool                  test_content;
+    bool                  test_unmap;
+    bool                  test_empty;
+    bool                  test_nonexistent;
+    bool                  test_null_path;
+    size_t                idx;
+
+    // setup
+    d_tests_dfile_get_test_path(path_buf,
+                               sizeof(path_buf),
+                               D_TEST_DFILE_TEST_FILENAME);
+    d_tests_dfile_get_test_path(empty_buf,
+                               sizeof(empty_buf),
+                               "mmap_empty.bin");
+
+    // test 1 & 2: map and verify
+    result   = d_mmap(path_buf, D_MMAP_READ, &map);
+    test_map = (result == 0);
+    test_content = test_map &&
+                   (map.size == strlen(D_TEST_DFILE_TEST_CONTENT)) &&
+                   (memcmp(map.data,
+                           D_TEST_DFILE_TEST_CONTENT,
+                           map.size) == 0);
+
+    // test 3: unmap
+    test_unmap = test_map &&
+                 (d_munmap(&map) == 0) &&
+                 (map.base == NULL);
+
+    // test 4: empty file
+    d_fwrite_all(empty_buf, NULL, 0);
+    result     = d_mmap(empty_buf, D_MMAP_READ, &map);
+    test_empty = (result == 0) &&
+                 (map.size == 0) &&
+                 (map.data == NULL) &&
+                 (d_munmap(&map) == 0);
+    d_remove(empty_buf);
+
+    // test 5: nonexistent file
+    result           = d_mmap("nonexistent_mmap_test.bin", D_MMAP_READ, &map);
+    test_nonexistent = (result != 0);
+
+    // test 6: NULL path
+    result         = d_mmap(NULL, D_MMAP_READ, &map);
+    test_null_path = (result != 0);
+
+    // build result tree
+    group = d_test_object_new_interior("d_mmap", 6);
+
+    if (!group)
+    {
+        return NULL;
+    }
+
+    idx = 0;
+    group->elements[idx++] = D_ASSERT_TRUE("map",
+                                           test_map,
+                                           "d_mmap maps file");
+    group->elements[idx++] = D_ASSERT_TRUE("content",
+                                           test_content,
+                                           "mapped content is correct");
+    group->elements[idx++] = D_ASSERT_TRUE("unmap",
+                                           test_unmap,
+                                           "d_munmap releases mapping");
+    group->elements[idx++] = D_ASSERT_TRUE("empty",
+                                           test_empty,
+                                           "empty file maps to empty view");
+    group->elements[idx++] = D_ASSERT_TRUE("nonexistent",
+                                           test_nonexistent,
+                                           "d_mmap fails for nonexistent");
+    group->elements[idx++] = D_ASSERT_TRUE("null_path",
+                                           test_null_path,
+                                           "d_mmap fails for NULL path");
+
+    return group;
+}
+
+
+/*
+d_tests_dfile_mmap_range
+  Tests d_mmap_range, d_madvise and d_mmap_prefetch.
+  Tests the following:
+  - maps a range at an unaligned offset
+  - range content matches the file
+  - advice and prefetch succeed inside the range
+  - advice outside the range is rejected
+  - ranges past end of file are rejected
+*/
+struct d_test_object*
+d_tests_dfile_mmap_range
+(
+    void
+)
+{
+    struct d_test_object* group;
+    struct d_mmap_t       map;
+    char                  path_buf[D_INTERNAL_TEST_PATH_BUF_SIZE];
+    char*                 data;
+    size_t                page;
+    size_t                size;
+    int                   result;
+    bool                  test_map;
+    bool                  test_content;
+    bool                  test_advise;
+    bool                  test_advise_bounds;
+    bool                  test_past_eof;
+    size_t                idx;
+
+    // setup: a file spanning several mapping granules
+    d_tests_dfile_get_test_path(path_buf,
+                               sizeof(path_buf),
+                               "mmap_range.bin");
+
+    page = d_mmap_page_size();
+    size = (3 * page) + 17;
+    data = malloc(size);
+
+    if (data)
+    {
+        d_tests_dfile_internal_fill_pattern(data, size);
+        d_fwrite_all(path_buf, data, size);
+    }
+
+    // test 1 & 2: unaligned range
+    result       = d_mmap_range(path_buf, (d_off_t)(page + 3), 100, D_MMAP_READ, &map);
+    test_map     = (data != NULL) && (result == 0) && (map.size == 100);
+    test_content = test_map &&
+                   (memcmp(map.data, data + page + 3, 100) == 0);
+
+    // test 3 & 4: advice
+    test_advise        = test_map &&
+                         (d_madvise(&map, 0, 0, D_MADV_SEQUENTIAL) == 0) &&
+                         (d_mmap_prefetch(&map, 10, 50) == 0);
+    test_advise_bounds = test_map &&
+                         (d_madvise(&map, 50, 100, D_MADV_RANDOM) != 0);
+
+    if (result == 0)
+    {
+        d_munmap(&map);
+    }
+
+    // test 5: past end of file
+    result        = d_mmap_range(path_buf, 0, size + 1, D_MMAP_READ, &map);
+    test_past_eof = (result != 0);
+
+    // cleanup
+    d_remove(path_buf);
+    free(data);
+
+    // build result tree
+    group = d_test_object_new_interior("d_mmap_range", 5);
+
+    if (!group)
+    {
+        return NULL;
+    }
+
+    idx = 0;
+    group->elements[idx++] = D_ASSERT_TRUE("map",
+                                           test_map,
+                                           "d_mmap_range maps unaligned range");
+    group->elements[idx++] = D_ASSERT_TRUE("content",
+                                           test_content,
+                                           "range content is correct");
+    group->elements[idx++] = D_ASSERT_TRUE("advise",
+                                           test_advise,
+                                           "d_madvise/d_mmap_prefetch succeed");
+    group->elements[idx++] = D_ASSERT_TRUE("advise_bounds",
+                                           test_advise_bounds,
+                                           "d_madvise rejects out-of-range");
+    group->elements[idx++] = D_ASSERT_TRUE("past_eof",
+                                           test_past_eof,
+                                           "d_mmap_range rejects past EOF");
+
+    return group;
+}
+
+
+/*
+d_tests_dfile_mmap_write
+  Tests writable and copy-on-write mappings with d_msync.
+  Tests the following:
+  - shared writable mapping writes reach the file after d_msync
+  - private mapping writes never reach the file
+*/
+struct d_test_object*
+d_tests_dfile_mmap_write
+(
+    void
+)
+{
+    struct d_test_object* group;
+    struct d_mmap_t       map;
+    char                  path_buf[D_INTERNAL_TEST_PATH_BUF_SIZE];
+    char*                 read_content;
+    size_t                read_size;
+    bool                  test_shared;
+    bool                  test_private;
+    size_t                idx;
+
+    // setup
+    d_tests_dfile_get_test_path(path_buf,
+                               sizeof(path_buf),
+                               "mmap_write.bin");
+    d_fwrite_all(path_buf, "hello world", 11);
+
+    // test 1: shared write + sync
+    test_shared = false;
+
+    if (d_mmap(path_buf, D_MMAP_WRITE, &map) == 0)
+    {
+        ((char*)map.data)[0] = 'J';
+        test_shared = (d_msync(&map, 0, 1, D_MSYNC_SYNC) == 0);
+        d_munmap(&map);
+
+        read_content = (char*)d_fread_all(path_buf, &read_size);
+        test_shared  = test_shared &&
+                       (read_content != NULL) &&
+                       (strcmp(read_content, "Jello world") == 0);
+        free(read_content);
+    }
+
+    // test 2: private write stays private
+    test_private = false;
+
+    if (d_mmap(path_buf, D_MMAP_PRIVATE, &map) == 0)
+    {
+        ((char*)map.data)[0] = 'Y';
+        test_private = (((char*)map.data)[0] == 'Y');
+        d_munmap(&map);
+
+        read_content = (char*)d_fread_all(path_buf, &read_size);
+        test_private = test_private &&
+                       (read_content != NULL) &&
+                       (strcmp(read_content, "Jello world") == 0);
+        free(read_content);
+    }
+
+    // cleanup
+    d_remove(path_buf);
+
+    // build result tree
+    group = d_test_object_new_interior("d_mmap_write", 2);
+
+    if (!group)
+    {
+        return NULL;
+    }
+
+    idx = 0;
+    group->elements[idx++] = D_ASSERT_TRUE("shared",
+                                           test_shared,
+                                           "shared mapping writes reach file");
+    group->elements[idx++] = D_ASSERT_TRUE("private",
+                                           test_private,
+                                           "private mapping writes stay private");
+
+    return group;
+}
+
+#endif  // D_FILE_HAS_MMAP
+
+
+/*
+d_tests_dfile_fread_all_view
+  Tests d_fread_all_view and d_file_view_release.
+  Tests the following:
+  - small files are viewed with correct content and terminator
+  - large files are viewed with correct content and terminator
+  - files whose size is a page multiple are still null-terminated
+  - release clears the view
+  - returns error for nonexistent file and NULL arguments
+*/
+struct d_test_object*
+d_tests_dfile_fread_all_view
+(
+    void
+)
+{
+    struct d_test_object* group;
+    struct d_file_view_t  view;
+    char                  path_buf[D_INTERNAL_TEST_PATH_BUF_SIZE];
+    char*                 data;
+    size_t                size;
+    size_t                multiple;
+    bool                  test_small;
+    bool                  test_large;
+    bool                  test_page_multiple;
+    bool                  test_release;
+    bool                  test_errors;
+    size_t                idx;
+
+    // test 1: small file
+    d_tests_dfile_get_test_path(path_buf,
+                               sizeof(path_buf),
+                               D_TEST_DFILE_TEST_FILENAME);
+
+    test_small = (d_fread_all_view(path_buf, &view) == 0) &&
+                 (view.size == strlen(D_TEST_DFILE_TEST_CONTENT)) &&
+                 (strcmp(view.data, D_TEST_DFILE_TEST_CONTENT) == 0);
+    d_file_view_release(&view);
+
+    // setup: buffer large enough to exceed the mapping threshold
+    multiple = D_FILE_VIEW_MMAP_THRESHOLD;
+#if D_FILE_HAS_MMAP
+    multiple = ( (D_FILE_VIEW_MMAP_THRESHOLD + d_mmap_page_size() - 1) /
+                 d_mmap_page_size() ) * d_mmap_page_size();
+#endif
+    size = multiple + 123;
+    data = malloc(size);
+
+    d_tests_dfile_get_test_path(path_buf,
+                               sizeof(path_buf),
+                               "view_large.bin");
+
+    test_large         = false;
+    test_page_multiple = false;
+    test_release       = false;
+
+    if (data)
+    {
+        d_tests_dfile_internal_fill_pattern(data, size);
+
+        // test 2: large file, size not a page multiple
+        d_fwrite_all(path_buf, data, size);
+        test_large = (d_fread_all_view(path_buf, &view) == 0) &&
+                     (view.size == size) &&
+                     (memcmp(view.data, data, size) == 0) &&
+                     (view.data[size] == '\0');
+        d_file_view_release(&view);
+
+        // test 3: large file, size exactly a page multiple
+        d_fwrite_all(path_buf, data, multiple);
+        test_page_multiple = (d_fread_all_view(path_buf, &view) == 0) &&
+                             (view.size == multiple) &&
+                             (memcmp(view.data, data, multiple) == 0) &&
+                             (view.data[multiple] == '\0');
+
+        // test 4: release
+        d_file_view_release(&view);
+        test_release = (view.data == NULL) &&
+                       (view.size == 0) &&
+                       (view.mapped == 0);
+
+        d_remove(path_buf);
+        free(data);
+    }
+
+    // test 5: error cases
+    test_errors = (d_fread_all_view("nonexistent_view_test.bin", &view) != 0) &&
+                  (d_fread_all_view(NULL, &view) != 0) &&
+                  (d_fread_all_view(path_buf, NULL) != 0);
+
+    // build result tree
+    group = d_test_object_new_interior("d_fread_all_view", 5);
+
+    if (!group)
+    {
+        return NULL;
+    }
+
+    idx = 0;
+    group->elements[idx++] = D_ASSERT_TRUE("small",
+                                           test_small,
+                                           "small file view is correct");
+    group->elements[idx++] = D_ASSERT_TRUE("large",
+                                           test_large,
+                                           "large file view is correct and terminated");
+    group->elements[idx++] = D_ASSERT_TRUE("page_multiple",
+                                           test_page_multiple,
+                                           "page-multiple file view is terminated");
+    group->elements[idx++] = D_ASSERT_TRUE("release",
+                                           test_release,
+                                           "d_file_view_release clears view");
+    group->elements[idx++] = D_ASSERT_TRUE("errors",
+                                           test_errors,
+                                           "d_fread_all_view rejects bad input");
+
+    return group;
+}
+
+
+/*
+d_tests_dfile_memory_mapped_all
+  Runs all memory-mapped file tests.
+  Tests the following:
+  - d_mmap / d_munmap
+  - d_mmap_range / d_madvise / d_mmap_prefetch
+  - d_msync with shared and private mappings
+  - d_fread_all_view / d_file_view_release
+*/
+struct d_test_object*
+d_tests_dfile_memory_mapped_all
+(
+    void
+)
+{
+    struct d_test_object* group;
+    size_t                idx;
+    size_t                count;
+
+#if D_FILE_HAS_MMAP
+    count = 4;
+#else
+    count = 1;
+#endif
+
+    group = d_test_object_new_interior("XVI. Memory-Mapped Files", count);
+
+    if (!group)
+    {
+        return NULL;
+    }
+
+    idx = 0;
+#if D_FILE_HAS_MMAP
+    group->elements[idx++] = d_tests_dfile_mmap();
+    group->elements[idx++] = d_tests_dfile_mmap_range();
+    group->elements[idx++] = d_tests_dfile_mmap_write();
+#endif
+    group->elements[idx++] = d_tests_dfile_fread_all_view();
+
+    return group;
+}
@@ -217,12 +217,70 @@ d_tests_dfile_rename
 }
 
 
+/*
+d_tests_dfile_read_to_eof
+  Reads `_path` with plain fread calls until EOF. Unlike d_fread_all, this
+does not trust st_size, so it also works for files that report a nominal
+size (sysfs, procfs).
+
+Parameter(s):
+  _path:     file to read
+  _buffer:   destination buffer
+  _capacity: size of `_buffer` in bytes
+  _length:   receives the number of bytes read
+Return:
+  - true if the whole file was read and fit in `_buffer`
+  - false on open or read failure, or if the file is larger than `_buffer`
+*/
+static bool
+d_tests_dfile_read_to_eof
+(
+    const char* _path,
+    char*       _buffer,
+    size_t      _capacity,
+    size_t*     _length
+)
+{
+    FILE*  file;
+    size_t got;
+    bool   ok;
+
+    file = fopen(_path, "rb");
+
+    if (!file)
+    {
+        return false;
+    }
+
+    *_length = 0;
+
+    while ( (*_length < _capacity) &&
+            ((got = fread(_buffer + *_length,
+                          1,
+                          _capacity - *_length,
+                          file)) > 0) )
+    {
+        *_length += got;
+    }
+
+    // a full buffer must be followed by EOF, not more data
+    ok = (!ferror(file)) &&
+         ( (*_length < _capacity) || (fgetc(file) == EOF) );
+
+    fclose(file);
+
+    return ok;
+}
+
+
 /*
 d_tests_dfile_copy_file
   Tests d_copy_file for copying file contents.
   Tests the following:
   - copies file successfully
   - copied content matches original
+  - file with a hole larger than the copy buffer copies intact
+  - a sysfs file reporting a nominal size copies only its real contents
   - returns error for nonexistent source
 */
 struct d_test_object*
@@ -234,11 +292,19 @@ d_tests_dfile_copy_file
     struct d_test_object* group;
     char                  src_buf[D_INTERNAL_TEST_PATH_BUF_SIZE];
     char                  dst_buf[D_INTERNAL_TEST_PATH_BUF_SIZE];
+    char                  sparse_buf[D_INTERNAL_TEST_PATH_BUF_SIZE];
     char*                 content;
+    char*                 copied;
+    char                  short_src[8192];
+    char                  short_dst[8192];
     size_t                size;
+    size_t                copied_size;
+    FILE*                 file;
     int                   result;
     bool                  test_copy;
     bool                  test_content;
+    bool                  test_sparse;
+    bool                  test_short;
     bool                  test_nonexistent;
     size_t                idx;
 
@@ -271,12 +337,71 @@ d_tests_dfile_copy_file
     // cleanup
     d_remove(dst_buf);
 
-    // test 3: nonexistent source
+    // test 3: data, a multi-megabyte hole, then more data
+    d_tests_dfile_get_test_path(sparse_buf,
+                               sizeof(sparse_buf),
+                               "copy_sparse.bin");
+    test_sparse = false;
+    file        = d_fopen(sparse_buf, "wb");
+
+    if (file)
+    {
+        fputs("head", file);
+        d_fseeko(file, (d_off_t)(3 * 1024 * 1024), SEEK_SET);
+        fputs("tail", file);
+        fclose(file);
+
+        if (d_copy_file(sparse_buf, dst_buf) == 0)
+        {
+            content = (char*)d_fread_all(sparse_buf, &size);
+            copied  = (char*)d_fread_all(dst_buf, &copied_size);
+
+            test_sparse = (content != NULL) &&
+                          (copied != NULL)  &&
+                          (size == copied_size) &&
+                          (memcmp(content, copied, size) == 0);
+
+            free(content);
+            free(copied);
+        }
+
+        d_remove(dst_buf);
+        d_remove(sparse_buf);
+    }
+
+    // test 4: sysfs reports st_size 4096 but reads back a few bytes
+    test_short = true;
+
+#if defined(D_ENV_PLATFORM_LINUX)
+    if (d_file_exists("/sys/devices/system/cpu/online"))
+    {
+        test_short = false;
+
+        // d_fread_all trusts st_size, so read both files until EOF
+        if ( (d_copy_file("/sys/devices/system/cpu/online", dst_buf) == 0) &&
+             (d_tests_dfile_read_to_eof("/sys/devices/system/cpu/online",
+                                        short_src,
+                                        sizeof(short_src),
+                                        &size)) &&
+             (d_tests_dfile_read_to_eof(dst_buf,
+                                        short_dst,
+                                        sizeof(short_dst),
+                                        &copied_size)) )
+        {
+            test_short = (size == copied_size) &&
+                         (memcmp(short_src, short_dst, size) == 0);
+        }
+
+        d_remove(dst_buf);
+    }
+#endif
+
+    // test 5: nonexistent source
     result = d_copy_file("nonexistent_copy_source.txt", dst_buf);
     test_nonexistent = (result != 0);
 
     // build result tree
-    group = d_test_object_new_interior("d_copy_file", 3);
+    group = d_test_object_new_interior("d_copy_file", 5);
 
     if (!group)
     {
@@ -290,6 +415,12 @@ d_tests_dfile_copy_file
     group->elements[idx++] = D_ASSERT_TRUE("content",
                                            test_content,
                                            "copied content matches original");
+    group->elements[idx++] = D_ASSERT_TRUE("sparse",
+                                           test_sparse,
+                                           "file with hole copies intact");
+    group->elements[idx++] = D_ASSERT_TRUE("short_read",
+                                           test_short,
+                                           "copy stops at the source's real end");
     group->elements[idx++] = D_ASSERT_TRUE("nonexistent",
                                            test_nonexistent,
                                            "d_copy_file fails for nonexistent source");
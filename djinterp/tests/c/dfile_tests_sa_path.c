@@ -535,6 +535,310 @@ d_tests_dfile_get_extension
 }
 
 
+/*
+d_tests_dfile_path_slices
+  Tests the slice-returning path functions.
+  Tests the following:
+  - d_path_dirname_slice agrees with d_dirname (root, none, nested)
+  - d_path_basename_slice agrees with d_basename
+  - d_path_extension_slice agrees with d_get_extension
+  - d_path_next_component walks the components of a path
+  - slices honour the length argument rather than a terminator
+*/
+struct d_test_object*
+d_tests_dfile_path_slices
+(
+    void
+)
+{
+    struct d_test_object* group;
+    struct d_path_slice   slice;
+    struct d_path_slice   part;
+    const char*           path;
+    size_t                cursor;
+    bool                  test_dirname;
+    bool                  test_basename;
+    bool                  test_extension;
+    bool                  test_components;
+    bool                  test_length;
+    size_t                idx;
+
+    path = "/usr/lib/libc.so.6";
+
+    // test 1: dirname slices
+    slice        = d_path_dirname_slice(path, strlen(path));
+    test_dirname = (slice.offset == 0) && (slice.length == 8);
+    slice        = d_path_dirname_slice("/usr", 4);
+    test_dirname = test_dirname && (slice.length == 1);
+    slice        = d_path_dirname_slice("file.txt", 8);
+    test_dirname = test_dirname && (slice.length == 0);
+
+    // test 2: basename slices
+    slice         = d_path_basename_slice(path, strlen(path));
+    test_basename = (slice.offset == 9) && (slice.length == 9);
+    slice         = d_path_basename_slice("file.txt", 8);
+    test_basename = test_basename && (slice.offset == 0) && (slice.length == 8);
+    slice         = d_path_basename_slice("dir/", 4);
+    test_basename = test_basename && (slice.length == 0);
+
+    // test 3: extension slices
+    slice          = d_path_extension_slice(path, strlen(path));
+    test_extension = (slice.offset == 16) && (slice.length == 2);
+    slice          = d_path_extension_slice("dir/.bashrc", 11);
+    test_extension = test_extension && (slice.length == 0);
+    slice          = d_path_extension_slice("a.d/file", 8);
+    test_extension = test_extension && (slice.length == 0);
+
+    // test 4: component iteration
+    cursor          = 0;
+    test_components = true;
+    path            = "//a/./bc//";
+
+    test_components = d_path_next_component(path, strlen(path), &cursor, &part) &&
+                      (part.offset == 2) && (part.length == 1);
+    test_components = test_components &&
+                      d_path_next_component(path, strlen(path), &cursor, &part) &&
+                      (part.offset == 4) && (part.length == 1);
+    test_components = test_components &&
+                      d_path_next_component(path, strlen(path), &cursor, &part) &&
+                      (memcmp(path + part.offset, "bc", 2) == 0);
+    test_components = test_components &&
+                      !d_path_next_component(path, strlen(path), &cursor, &part);
+
+    // test 5: only `_length` bytes are considered
+    path        = "src/main.c/ignored";
+    slice       = d_path_basename_slice(path, 10);
+    test_length = (slice.offset == 4) && (slice.length == 6);
+    slice       = d_path_extension_slice(path, 10);
+    test_length = test_length && (slice.offset == 8) && (slice.length == 2);
+
+    // build result tree
+    group = d_test_object_new_interior("d_path_*_slice", 5);
+
+    if (!group)
+    {
+        return NULL;
+    }
+
+    idx = 0;
+    group->elements[idx++] = D_ASSERT_TRUE("dirname",
+                                           test_dirname,
+                                           "d_path_dirname_slice locates the directory");
+    group->elements[idx++] = D_ASSERT_TRUE("basename",
+                                           test_basename,
+                                           "d_path_basename_slice locates the name");
+    group->elements[idx++] = D_ASSERT_TRUE("extension",
+                                           test_extension,
+                                           "d_path_extension_slice locates the extension");
+    group->elements[idx++] = D_ASSERT_TRUE("components",
+                                           test_components,
+                                           "d_path_next_component walks every component");
+    group->elements[idx++] = D_ASSERT_TRUE("length",
+                                           test_length,
+                                           "slices stop at the given length");
+
+    return group;
+}
+
+
+/*
+d_tests_dfile_path_normalize_to
+  Tests d_path_normalize_to and d_path_join_to.
+  Tests the following:
+  - resolves ".", ".." and repeated separators
+  - keeps leading ".." of relative paths, drops ".." at the root
+  - normalizes in place
+  - joins into a caller buffer, appending in place
+  - reports ERANGE when the buffer is too small
+*/
+struct d_test_object*
+d_tests_dfile_path_normalize_to
+(
+    void
+)
+{
+    struct d_test_object* group;
+    char                  buf[64];
+    char                  small[4];
+    size_t                len;
+    bool                  test_resolve;
+    bool                  test_dotdot;
+    bool                  test_in_place;
+    bool                  test_join;
+    bool                  test_range;
+    size_t                idx;
+
+    // test 1: "." / ".." / repeated separators
+    len          = d_path_normalize_to("/a/./b//../c/", 13, buf, sizeof(buf));
+    test_resolve = (len == 4) && (strcmp(buf, "/a/c") == 0);
+    len          = d_path_normalize_to("a/..", 4, buf, sizeof(buf));
+    test_resolve = test_resolve && (len == 1) && (strcmp(buf, ".") == 0);
+
+    // test 2: ".." above the start
+    len         = d_path_normalize_to("../x/../../y", 12, buf, sizeof(buf));
+    test_dotdot = (len == 7) && (strcmp(buf, "../../y") == 0);
+    len         = d_path_normalize_to("/../x", 5, buf, sizeof(buf));
+    test_dotdot = test_dotdot && (strcmp(buf, "/x") == 0);
+    test_dotdot = test_dotdot &&
+                  (d_path_normalize("../a", buf, sizeof(buf)) != NULL) &&
+                  (strcmp(buf, "../a") == 0);
+
+    // test 3: in place
+    d_strcpy_s(buf, sizeof(buf), "./src//lib/../inc/x.h");
+    len           = d_path_normalize_to(buf, strlen(buf), buf, sizeof(buf));
+    test_in_place = (len == 11) && (strcmp(buf, "src/inc/x.h") == 0);
+
+    // test 4: join, then append in place
+    len       = d_path_join_to(buf, sizeof(buf), "inc", 3, "c", 1);
+    test_join = (len == 5) && (strcmp(buf, "inc/c") == 0);
+    len       = d_path_join_to(buf, sizeof(buf), buf, len, "dfile.h", 7);
+    test_join = test_join && (len == 13) && (strcmp(buf, "inc/c/dfile.h") == 0);
+    len       = d_path_join_to(buf, sizeof(buf), "inc/", 4, "/c", 2);
+    test_join = test_join && (strcmp(buf, "inc//c") == 0);
+
+    // test 5: ERANGE
+    errno      = 0;
+    len        = d_path_normalize_to("abcd", 4, small, sizeof(small));
+    test_range = (len == 0) && (errno == ERANGE);
+    errno      = 0;
+    len        = d_path_join_to(small, sizeof(small), "ab", 2, "c", 1);
+    test_range = test_range && (len == 0) && (errno == ERANGE);
+
+    // build result tree
+    group = d_test_object_new_interior("d_path_normalize_to", 5);
+
+    if (!group)
+    {
+        return NULL;
+    }
+
+    idx = 0;
+    group->elements[idx++] = D_ASSERT_TRUE("resolve",
+                                           test_resolve,
+                                           "d_path_normalize_to resolves . and ..");
+    group->elements[idx++] = D_ASSERT_TRUE("dotdot",
+                                           test_dotdot,
+                                           "leading .. is kept only for relative paths");
+    group->elements[idx++] = D_ASSERT_TRUE("in_place",
+                                           test_in_place,
+                                           "d_path_normalize_to works in place");
+    group->elements[idx++] = D_ASSERT_TRUE("join",
+                                           test_join,
+                                           "d_path_join_to joins into the buffer");
+    group->elements[idx++] = D_ASSERT_TRUE("range",
+                                           test_range,
+                                           "short buffers fail with ERANGE");
+
+    return group;
+}
+
+
+/*
+d_tests_dfile_path_builder
+  Tests struct d_path_builder.
+  Tests the following:
+  - push inserts separators and returns a mark
+  - truncate restores a mark without reallocating
+  - the buffer grows past its initial capacity
+  - pop stops at the root
+  - normalize rewrites the path in place
+*/
+struct d_test_object*
+d_tests_dfile_path_builder
+(
+    void
+)
+{
+    struct d_test_object* group;
+    struct d_path_builder builder;
+    size_t                mark;
+    size_t                i;
+    char*                 data;
+    bool                  test_push;
+    bool                  test_truncate;
+    bool                  test_grow;
+    bool                  test_pop;
+    bool                  test_normalize;
+    size_t                idx;
+
+    test_push      = false;
+    test_truncate  = false;
+    test_grow      = false;
+    test_pop       = false;
+    test_normalize = false;
+
+    if (d_path_builder_init(&builder, 8) == 0)
+    {
+        // test 1: push
+        d_path_builder_set(&builder, "/tmp", 4);
+        mark      = d_path_builder_push(&builder, "walk", 4);
+        test_push = (mark == 4) &&
+                    (strcmp(builder.data, "/tmp/walk") == 0);
+
+        // test 2: truncate
+        data = builder.data;
+        d_path_builder_push(&builder, "x", 1);
+        d_path_builder_truncate(&builder, mark);
+        test_truncate = (builder.length == 4) &&
+                        (strcmp(builder.data, "/tmp") == 0) &&
+                        (builder.data == data);
+
+        // test 3: growth
+        for (i = 0; i < 100; i++)
+        {
+            d_path_builder_push(&builder, "dir", 3);
+        }
+
+        test_grow = (builder.length == 4 + 100 * 4) &&
+                    (builder.capacity > builder.length) &&
+                    (strncmp(builder.data + builder.length - 8, "/dir/dir", 8) == 0);
+
+        // test 4: pop
+        d_path_builder_set(&builder, "/a//b/", 6);
+        test_pop = (d_path_builder_pop(&builder) == 0) &&
+                   (strcmp(builder.data, "/a") == 0) &&
+                   (d_path_builder_pop(&builder) == 0) &&
+                   (strcmp(builder.data, "/") == 0) &&
+                   (d_path_builder_pop(&builder) == -1);
+
+        // test 5: normalize
+        d_path_builder_set(&builder, "a/./b/../c//", 12);
+        test_normalize = (d_path_builder_normalize(&builder) == 0) &&
+                         (builder.length == 3) &&
+                         (strcmp(builder.data, "a/c") == 0);
+
+        d_path_builder_free(&builder);
+    }
+
+    // build result tree
+    group = d_test_object_new_interior("d_path_builder", 5);
+
+    if (!group)
+    {
+        return NULL;
+    }
+
+    idx = 0;
+    group->elements[idx++] = D_ASSERT_TRUE("push",
+                                           test_push,
+                                           "d_path_builder_push appends a component");
+    group->elements[idx++] = D_ASSERT_TRUE("truncate",
+                                           test_truncate,
+                                           "d_path_builder_truncate restores a mark");
+    group->elements[idx++] = D_ASSERT_TRUE("grow",
+                                           test_grow,
+                                           "d_path_builder grows past its capacity");
+    group->elements[idx++] = D_ASSERT_TRUE("pop",
+                                           test_pop,
+                                           "d_path_builder_pop stops at the root");
+    group->elements[idx++] = D_ASSERT_TRUE("normalize",
+                                           test_normalize,
+                                           "d_path_builder_normalize works in place");
+
+    return group;
+}
+
+
 /*
 d_tests_dfile_path_utilities_all
   Runs all path utility tests.
@@ -548,6 +852,9 @@ d_tests_dfile_path_utilities_all
   - d_path_normalize
   - d_path_is_absolute
   - d_get_extension
+  - d_path_*_slice
+  - d_path_normalize_to / d_path_join_to
+  - d_path_builder
 */
 struct d_test_object*
 d_tests_dfile_path_utilities_all
@@ -558,7 +865,7 @@ d_tests_dfile_path_utilities_all
     struct d_test_object* group;
     size_t                idx;
 
-    group = d_test_object_new_interior("XII. Path Utilities", 9);
+    group = d_test_object_new_interior("XII. Path Utilities", 12);
 
     if (!group)
     {
@@ -575,6 +882,9 @@ d_tests_dfile_path_utilities_all
     group->elements[idx++] = d_tests_dfile_path_normalize();
     group->elements[idx++] = d_tests_dfile_path_is_absolute();
     group->elements[idx++] = d_tests_dfile_get_extension();
+    group->elements[idx++] = d_tests_dfile_path_slices();
+    group->elements[idx++] = d_tests_dfile_path_normalize_to();
+    group->elements[idx++] = d_tests_dfile_path_builder();
 
     return group;
 }
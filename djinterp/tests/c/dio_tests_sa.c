@@ -10,6 +10,7 @@ d_tests_sa_dio_run_all
   - Character and string I/O functions
   - Large file stream positioning functions
   - Error handling functions
+  - Line reader
 */
 bool
 d_tests_sa_dio_run_all
@@ -27,6 +28,7 @@ d_tests_sa_dio_run_all
     result = d_tests_sa_dio_char_string_io_all(_counter) && result;
     result = d_tests_sa_dio_file_positioning_all(_counter) && result;
     result = d_tests_sa_dio_error_handling_all(_counter) && result;
+    result = d_tests_sa_dio_line_reader_all(_counter) && result;
 
     return result;
 }
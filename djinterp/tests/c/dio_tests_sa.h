@@ -4,7 +4,7 @@
 *   Unit test declarations for `dio.h` module.
 *   Provides comprehensive testing of all d_io functions including formatted
 * input/output (secure variants), character and string I/O, large file stream
-* positioning, and error handling.
+* positioning, error handling, and the line reader.
 *
 *
 * path:      \tests\c\core\dio_tests_sa.h
@@ -85,6 +85,20 @@ bool d_tests_sa_dio_clearerr(struct d_test_counter* _counter);
 bool d_tests_sa_dio_error_handling_all(struct d_test_counter* _counter);
 
 
+/******************************************************************************
+ * VI. LINE READER TESTS
+ *****************************************************************************/
+bool d_tests_sa_dio_line_reader_memory(struct d_test_counter* _counter);
+bool d_tests_sa_dio_line_reader_crlf(struct d_test_counter* _counter);
+bool d_tests_sa_dio_line_reader_file(struct d_test_counter* _counter);
+bool d_tests_sa_dio_line_reader_spanning(struct d_test_counter* _counter);
+bool d_tests_sa_dio_line_reader_delimiter(struct d_test_counter* _counter);
+bool d_tests_sa_dio_line_reader_errors(struct d_test_counter* _counter);
+
+// VI.  aggregation function
+bool d_tests_sa_dio_line_reader_all(struct d_test_counter* _counter);
+
+
 /******************************************************************************
  * MODULE-LEVEL AGGREGATION
  *****************************************************************************/
@@ -0,0 +1,557 @@
+#include ".\dio_tests_sa.h"
+
+
+///////////////////////////////////////////////////////////////////////////////
+// file-scope helpers
+///////////////////////////////////////////////////////////////////////////////
+
+// helper: true if the slice equals the NUL-terminated `_expected`
+static bool
+d_test_line_is
+(
+    const char* _line,
+    size_t      _length,
+    const char* _expected
+)
+{
+    return (_length == strlen(_expected)) &&
+           (memcmp(_line, _expected, _length) == 0);
+}
+
+// helper: length of generated line `_i` in the spanning test; mixes short
+// lines with a few that are longer than a whole block
+static size_t
+d_test_line_length
+(
+    size_t _i
+)
+{
+    if ( (_i % 997) == 500 )
+    {
+        return (D_LINE_READER_BLOCK_SIZE * 3) + _i;
+    }
+
+    return (_i * 37) % 301;
+}
+
+
+///////////////////////////////////////////////////////////////////////////////
+// test functions
+///////////////////////////////////////////////////////////////////////////////
+
+
+/*
+d_tests_sa_dio_line_reader_memory
+  Tests d_line_reader_from_memory with '\n'-terminated input.
+  Tests the following:
+  - lines are returned in order with the delimiter stripped
+  - empty lines are returned as zero-length slices
+  - a final line without a delimiter is returned
+  - slices point into the source buffer (no copy)
+  - line numbers count returned records
+  - D_LINE_READER_KEEP_EOL keeps the delimiter
+*/
+bool
+d_tests_sa_dio_line_reader_memory
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                  result;
+    struct d_line_reader* reader;
+    const char*           text;
+    const char*           line;
+    size_t                length;
+    int                   rc;
+
+    result = true;
+    text   = "alpha\n\nbeta\ngamma";
+    reader = d_line_reader_from_memory(text, strlen(text), 0);
+
+    if (!reader)
+    {
+        return d_assert_standalone(false,
+                                   "line_reader_memory_new",
+                                   "d_line_reader_from_memory failed",
+                                   _counter);
+    }
+
+    // test 1: first line, zero-copy
+    rc     = d_line_reader_next(reader, &line, &length);
+    result = d_assert_standalone(
+        (rc == 1) &&
+        (d_test_line_is(line, length, "alpha")) &&
+        (line == text),
+        "line_reader_memory_first",
+        "First line should be 'alpha' and point into the source",
+        _counter) && result;
+
+    // test 2: empty line
+    rc     = d_line_reader_next(reader, &line, &length);
+    result = d_assert_standalone(
+        (rc == 1) && (length == 0),
+        "line_reader_memory_empty",
+        "An empty line should be a zero-length slice",
+        _counter) && result;
+
+    // test 3: middle and unterminated last line
+    d_line_reader_next(reader, &line, &length);
+    result = d_assert_standalone(
+        d_test_line_is(line, length, "beta"),
+        "line_reader_memory_middle",
+        "Third line should be 'beta'",
+        _counter) && result;
+
+    rc     = d_line_reader_next(reader, &line, &length);
+    result = d_assert_standalone(
+        (rc == 1) &&
+        (d_test_line_is(line, length, "gamma")) &&
+        (d_line_reader_line_number(reader) == 4),
+        "line_reader_memory_last",
+        "An unterminated final line should be returned as line 4",
+        _counter) && result;
+
+    // test 4: end
+    rc     = d_line_reader_next(reader, &line, &length);
+    result = d_assert_standalone(
+        (rc == 0) &&
+        (d_line_reader_next(reader, &line, &length) == 0),
+        "line_reader_memory_end",
+        "End of input should return 0 repeatedly",
+        _counter) && result;
+
+    d_line_reader_free(reader);
+
+    // test 5: keep delimiter
+    reader = d_line_reader_from_memory(text, strlen(text), D_LINE_READER_KEEP_EOL);
+
+    if (reader)
+    {
+        d_line_reader_next(reader, &line, &length);
+        result = d_assert_standalone(
+            d_test_line_is(line, length, "alpha\n"),
+            "line_reader_memory_keep_eol",
+            "D_LINE_READER_KEEP_EOL should keep the newline",
+            _counter) && result;
+
+        d_line_reader_free(reader);
+    }
+
+    return result;
+}
+
+
+/*
+d_tests_sa_dio_line_reader_crlf
+  Tests CRLF handling.
+  Tests the following:
+  - "\r\n" is stripped as a unit
+  - a lone '\r' inside a line is preserved
+  - KEEP_EOL keeps both characters
+*/
+bool
+d_tests_sa_dio_line_reader_crlf
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                  result;
+    struct d_line_reader* reader;
+    const char*           text;
+    const char*           line;
+    size_t                length;
+
+    result = true;
+    text   = "one\r\ntw\ro\r\n\r\nthree";
+    reader = d_line_reader_from_memory(text, strlen(text), 0);
+
+    if (!reader)
+    {
+        return d_assert_standalone(false,
+                                   "line_reader_crlf_new",
+                                   "d_line_reader_from_memory failed",
+                                   _counter);
+    }
+
+    // test 1: CRLF stripped
+    d_line_reader_next(reader, &line, &length);
+    result = d_assert_standalone(
+        d_test_line_is(line, length, "one"),
+        "line_reader_crlf_strip",
+        "CRLF should be stripped",
+        _counter) && result;
+
+    // test 2: inner CR preserved
+    d_line_reader_next(reader, &line, &length);
+    result = d_assert_standalone(
+        d_test_line_is(line, length, "tw\ro"),
+        "line_reader_crlf_inner_cr",
+        "A CR not followed by LF should be kept",
+        _counter) && result;
+
+    // test 3: CRLF-only line is empty
+    d_line_reader_next(reader, &line, &length);
+    result = d_assert_standalone(
+        length == 0,
+        "line_reader_crlf_empty",
+        "A bare CRLF should give an empty line",
+        _counter) && result;
+
+    d_line_reader_free(reader);
+
+    // test 4: keep both
+    reader = d_line_reader_from_memory(text, strlen(text), D_LINE_READER_KEEP_EOL);
+
+    if (reader)
+    {
+        d_line_reader_next(reader, &line, &length);
+        result = d_assert_standalone(
+            d_test_line_is(line, length, "one\r\n"),
+            "line_reader_crlf_keep",
+            "KEEP_EOL should keep CR and LF",
+            _counter) && result;
+
+        d_line_reader_free(reader);
+    }
+
+    return result;
+}
+
+
+/*
+d_tests_sa_dio_line_reader_file
+  Tests d_line_reader_open on a regular file, mapped and block mode.
+  Tests the following:
+  - the default mode maps a non-empty regular file
+  - D_LINE_READER_NO_MMAP uses block reads
+  - both modes return the same lines
+  - an empty file yields no lines
+*/
+bool
+d_tests_sa_dio_line_reader_file
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                  result;
+    struct d_line_reader* mapped;
+    struct d_line_reader* blocked;
+    FILE*                 file;
+    const char*           a;
+    const char*           b;
+    size_t                a_length;
+    size_t                b_length;
+    size_t                lines;
+    bool                  same;
+    int                   ra;
+    int                   rb;
+    int                   i;
+
+    result = true;
+
+    file = d_fopen("test_line_reader_temp.txt", "wb");
+    if (!file)
+    {
+        return d_assert_standalone(false,
+                                   "line_reader_file_setup",
+                                   "Failed to create the temp file",
+                                   _counter);
+    }
+
+    for (i = 0; i < 5000; i++)
+    {
+        fprintf(file, "record %d of the log\n", i);
+    }
+
+    fclose(file);
+
+    mapped  = d_line_reader_open("test_line_reader_temp.txt", 0);
+    blocked = d_line_reader_open("test_line_reader_temp.txt", D_LINE_READER_NO_MMAP);
+
+    // test 1: modes
+    result = d_assert_standalone(
+        (mapped != NULL) &&
+        (blocked != NULL) &&
+        (!d_line_reader_is_mapped(blocked))
+#if D_FILE_HAS_MMAP
+        && (d_line_reader_is_mapped(mapped))
+#endif
+        ,
+        "line_reader_file_modes",
+        "Default open should map; NO_MMAP should not",
+        _counter) && result;
+
+    // test 2: same contents
+    same  = ( (mapped) && (blocked) );
+    lines = 0;
+
+    while (same)
+    {
+        ra = d_line_reader_next(mapped, &a, &a_length);
+        rb = d_line_reader_next(blocked, &b, &b_length);
+
+        same = (ra == rb) &&
+               ( (ra != 1) ||
+                 ( (a_length == b_length) &&
+                   (memcmp(a, b, a_length) == 0) ) );
+
+        if (ra != 1)
+        {
+            break;
+        }
+
+        lines++;
+    }
+
+    result = d_assert_standalone(
+        same && (lines == 5000),
+        "line_reader_file_same",
+        "Mapped and block modes should return the same 5000 lines",
+        _counter) && result;
+
+    d_line_reader_free(mapped);
+    d_line_reader_free(blocked);
+
+    // test 3: empty file
+    file = d_fopen("test_line_reader_temp.txt", "wb");
+    if (file)
+    {
+        fclose(file);
+    }
+
+    mapped = d_line_reader_open("test_line_reader_temp.txt", 0);
+    result = d_assert_standalone(
+        (mapped != NULL) &&
+        (d_line_reader_next(mapped, &a, &a_length) == 0),
+        "line_reader_file_empty",
+        "An empty file should yield no lines",
+        _counter) && result;
+
+    d_line_reader_free(mapped);
+    d_remove("test_line_reader_temp.txt");
+
+    return result;
+}
+
+
+/*
+d_tests_sa_dio_line_reader_spanning
+  Tests block mode with records that straddle block boundaries.
+  Tests the following:
+  - every CRLF-terminated line comes back with the right length and bytes,
+    including lines several blocks long
+  - the line count matches what was written
+*/
+bool
+d_tests_sa_dio_line_reader_spanning
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                  result;
+    struct d_line_reader* reader;
+    FILE*                 file;
+    const char*           line;
+    size_t                length;
+    size_t                count;
+    size_t                i;
+    size_t                j;
+    bool                  intact;
+
+    result = true;
+    count  = 4000;
+
+    file = d_fopen("test_line_reader_span.txt", "wb");
+    if (!file)
+    {
+        return d_assert_standalone(false,
+                                   "line_reader_span_setup",
+                                   "Failed to create the temp file",
+                                   _counter);
+    }
+
+    for (i = 0; i < count; i++)
+    {
+        for (j = 0; j < d_test_line_length(i); j++)
+        {
+            fputc('a' + (int)((i + j) % 26), file);
+        }
+
+        fputs("\r\n", file);
+    }
+
+    fclose(file);
+
+    reader = d_line_reader_open("test_line_reader_span.txt", D_LINE_READER_NO_MMAP);
+    intact = (reader != NULL);
+
+    for (i = 0; ( (intact) && (i < count) ); i++)
+    {
+        intact = (d_line_reader_next(reader, &line, &length) == 1) &&
+                 (length == d_test_line_length(i));
+
+        for (j = 0; ( (intact) && (j < length) ); j++)
+        {
+            intact = (line[j] == (char)('a' + (int)((i + j) % 26)));
+        }
+    }
+
+    // test 1: every line intact
+    result = d_assert_standalone(
+        intact,
+        "line_reader_span_intact",
+        "Lines spanning blocks should be returned whole",
+        _counter) && result;
+
+    // test 2: count
+    result = d_assert_standalone(
+        (intact) &&
+        (d_line_reader_next(reader, &line, &length) == 0) &&
+        (d_line_reader_line_number(reader) == count),
+        "line_reader_span_count",
+        "The reader should return exactly the lines written",
+        _counter) && result;
+
+    d_line_reader_free(reader);
+    d_remove("test_line_reader_span.txt");
+
+    return result;
+}
+
+
+/*
+d_tests_sa_dio_line_reader_delimiter
+  Tests d_line_reader_set_delimiter.
+  Tests the following:
+  - NUL-separated records are split on '\0'
+  - '\r' is not stripped for a non-newline delimiter
+*/
+bool
+d_tests_sa_dio_line_reader_delimiter
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                  result;
+    struct d_line_reader* reader;
+    const char            data[] = "a/b\0c\r\0d";
+    const char*           line;
+    size_t                length;
+
+    result = true;
+    reader = d_line_reader_from_memory(data, sizeof(data) - 1, 0);
+
+    if (!reader)
+    {
+        return d_assert_standalone(false,
+                                   "line_reader_delim_new",
+                                   "d_line_reader_from_memory failed",
+                                   _counter);
+    }
+
+    d_line_reader_set_delimiter(reader, '\0');
+
+    // test 1: split on NUL
+    d_line_reader_next(reader, &line, &length);
+    result = d_assert_standalone(
+        d_test_line_is(line, length, "a/b"),
+        "line_reader_delim_nul",
+        "Records should be split on '\\0'",
+        _counter) && result;
+
+    // test 2: CR kept
+    d_line_reader_next(reader, &line, &length);
+    result = d_assert_standalone(
+        d_test_line_is(line, length, "c\r"),
+        "line_reader_delim_cr_kept",
+        "CR should be kept for a non-newline delimiter",
+        _counter) && result;
+
+    d_line_reader_free(reader);
+
+    return result;
+}
+
+
+/*
+d_tests_sa_dio_line_reader_errors
+  Tests invalid arguments.
+  Tests the following:
+  - opening a missing file returns NULL
+  - a negative fd is rejected
+  - NULL arguments to next return -1
+  - NULL readers are tolerated by the query and free functions
+*/
+bool
+d_tests_sa_dio_line_reader_errors
+(
+    struct d_test_counter* _counter
+)
+{
+    bool        result;
+    const char* line;
+    size_t      length;
+
+    result = true;
+
+    // test 1: missing file
+    result = d_assert_standalone(
+        d_line_reader_open("no_such_line_reader_file.txt", 0) == NULL,
+        "line_reader_error_missing",
+        "Opening a missing file should fail",
+        _counter) && result;
+
+    // test 2: bad fd
+    result = d_assert_standalone(
+        d_line_reader_from_fd(-1, 0) == NULL,
+        "line_reader_error_fd",
+        "A negative fd should be rejected",
+        _counter) && result;
+
+    // test 3: NULL next
+    result = d_assert_standalone(
+        d_line_reader_next(NULL, &line, &length) == -1,
+        "line_reader_error_null_next",
+        "d_line_reader_next(NULL) should return -1",
+        _counter) && result;
+
+    // test 4: NULL tolerated
+    d_line_reader_free(NULL);
+    d_line_reader_set_delimiter(NULL, ',');
+    result = d_assert_standalone(
+        (d_line_reader_line_number(NULL) == 0) &&
+        (!d_line_reader_is_mapped(NULL)),
+        "line_reader_error_null_queries",
+        "Queries on NULL should return defaults",
+        _counter) && result;
+
+    return result;
+}
+
+
+/*
+d_tests_sa_dio_line_reader_all
+  Aggregation function that runs all line reader tests.
+*/
+bool
+d_tests_sa_dio_line_reader_all
+(
+    struct d_test_counter* _counter
+)
+{
+    bool result;
+
+    result = true;
+
+    printf("\n  [SECTION] Line Reader\n");
+    printf("  ---------------------\n");
+
+    result = d_tests_sa_dio_line_reader_memory(_counter) && result;
+    result = d_tests_sa_dio_line_reader_crlf(_counter) && result;
+    result = d_tests_sa_dio_line_reader_file(_counter) && result;
+    result = d_tests_sa_dio_line_reader_spanning(_counter) && result;
+    result = d_tests_sa_dio_line_reader_delimiter(_counter) && result;
+    result = d_tests_sa_dio_line_reader_errors(_counter) && result;
+
+    return result;
+}
@@ -0,0 +1,30 @@
+#include ".\dnumber_tests_sa.h"
+
+
+/*
+d_tests_sa_dnumber_run_all
+  Module-level aggregation function that runs all dnumber tests.
+  Executes tests for all categories:
+  - Integer formatting
+  - Floating-point formatting
+  - Integer parsing
+  - Floating-point parsing
+*/
+bool
+d_tests_sa_dnumber_run_all
+(
+    struct d_test_counter* _counter
+)
+{
+    bool result;
+
+    result = true;
+
+    // run all test categories
+    result = d_tests_sa_number_fmt_int_all(_counter) && result;
+    result = d_tests_sa_number_fmt_double_all(_counter) && result;
+    result = d_tests_sa_number_parse_int_all(_counter) && result;
+    result = d_tests_sa_number_parse_double_all(_counter) && result;
+
+    return result;
+}
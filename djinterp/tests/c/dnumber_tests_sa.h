@@ -0,0 +1,83 @@
+/******************************************************************************
+* djinterp [test]                                           dnumber_tests_sa.h
+*
+*   Unit test declarations for `dnumber.h` module.
+*   Covers the locale-independent integer and floating-point formatters,
+* including boundary values, notation selection and round-tripping of the
+* shortest double representation, and the span-based parsers: consumed
+* lengths, range errors, correct rounding of hard cases, and agreement with
+* the formatters.
+*
+*
+* path:      \tests\dnumber_tests_sa.h
+* link:      TBA
+* author(s): Samuel 'teer' Neal-Blim                          date: 2026.10.18
+******************************************************************************/
+
+#ifndef DJINTERP_TESTS_DNUMBER_STANDALONE_
+#define DJINTERP_TESTS_DNUMBER_STANDALONE_ 1
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <errno.h>
+#include <string.h>
+#include "..\..\inc\c\test\test_standalone.h"
+#include "..\..\inc\c\dnumber.h"
+
+
+/******************************************************************************
+ * I. INTEGER FORMATTING TESTS
+ *****************************************************************************/
+bool d_tests_sa_number_fmt_unsigned(struct d_test_counter* _counter);
+bool d_tests_sa_number_fmt_signed(struct d_test_counter* _counter);
+bool d_tests_sa_number_fmt_hex(struct d_test_counter* _counter);
+
+// I. aggregation function
+bool d_tests_sa_number_fmt_int_all(struct d_test_counter* _counter);
+
+
+/******************************************************************************
+ * II. FLOATING-POINT FORMATTING TESTS
+ *****************************************************************************/
+bool d_tests_sa_number_fmt_double_special(struct d_test_counter* _counter);
+bool d_tests_sa_number_fmt_double_notation(struct d_test_counter* _counter);
+bool d_tests_sa_number_fmt_double_shortest(struct d_test_counter* _counter);
+bool d_tests_sa_number_fmt_double_roundtrip(struct d_test_counter* _counter);
+
+// II. aggregation function
+bool d_tests_sa_number_fmt_double_all(struct d_test_counter* _counter);
+
+
+/******************************************************************************
+ * III. INTEGER PARSING TESTS
+ *****************************************************************************/
+bool d_tests_sa_number_parse_int_values(struct d_test_counter* _counter);
+bool d_tests_sa_number_parse_int_range(struct d_test_counter* _counter);
+bool d_tests_sa_number_parse_int_span(struct d_test_counter* _counter);
+
+// III. aggregation function
+bool d_tests_sa_number_parse_int_all(struct d_test_counter* _counter);
+
+
+/******************************************************************************
+ * IV. FLOATING-POINT PARSING TESTS
+ *****************************************************************************/
+bool d_tests_sa_number_parse_double_syntax(struct d_test_counter* _counter);
+bool d_tests_sa_number_parse_double_special(struct d_test_counter* _counter);
+bool d_tests_sa_number_parse_double_rounding(struct d_test_counter* _counter);
+bool d_tests_sa_number_parse_double_range(struct d_test_counter* _counter);
+bool d_tests_sa_number_parse_double_roundtrip(struct d_test_counter* _counter);
+
+// IV. aggregation function
+bool d_tests_sa_number_parse_double_all(struct d_test_counter* _counter);
+
+
+/******************************************************************************
+ * MODULE-LEVEL AGGREGATION
+ *****************************************************************************/
+bool d_tests_sa_dnumber_run_all(struct d_test_counter* _counter);
+
+
+#endif  // DJINTERP_TESTS_DNUMBER_STANDALONE_
@@ -0,0 +1,482 @@
+#include ".\dnumber_tests_sa.h"
+
+
+/*
+d_tests_sa_number_double_matches
+  Helper: formats `_value` with d_fmt_double and compares the text and the
+returned length against `_expected`.
+*/
+static bool
+d_tests_sa_number_double_matches
+(
+    double      _value,
+    const char* _expected
+)
+{
+    char   buffer[D_FMT_DOUBLE_BUFFER_SIZE];
+    size_t length;
+
+    length = d_fmt_double(buffer, _value);
+
+    return (length == strlen(_expected)) &&
+           (strcmp(buffer, _expected) == 0);
+}
+
+
+/*
+d_tests_sa_number_fmt_unsigned
+  Tests d_fmt_uint32 and d_fmt_uint64.
+  Tests the following:
+  - zero and single digits
+  - every power-of-ten boundary matches snprintf
+  - UINT32_MAX and UINT64_MAX
+  - NULL buffer returns 0
+*/
+bool
+d_tests_sa_number_fmt_unsigned
+(
+    struct d_test_counter* _counter
+)
+{
+    bool     result;
+    bool     boundaries;
+    char     buffer[D_FMT_INT_BUFFER_SIZE];
+    char     expected[32];
+    uint64_t power;
+    int      i;
+
+    result = true;
+
+    // test 1: small values
+    result = d_assert_standalone(
+        (d_fmt_uint64(buffer, 0) == 1) && (strcmp(buffer, "0") == 0) &&
+        (d_fmt_uint64(buffer, 7) == 1) && (strcmp(buffer, "7") == 0) &&
+        (d_fmt_uint32(buffer, 42) == 2) && (strcmp(buffer, "42") == 0),
+        "fmt_unsigned_small",
+        "Zero and small values should format as their digits",
+        _counter) && result;
+
+    // test 2: 10^k - 1, 10^k and 10^k + 1 for every k
+    boundaries = true;
+    power      = 1;
+
+    for (i = 0; i < 20; i++)
+    {
+        snprintf(expected, sizeof(expected), "%llu",
+                 (unsigned long long)(power - 1));
+        d_fmt_uint64(buffer, power - 1);
+        boundaries = boundaries && (strcmp(buffer, expected) == 0);
+
+        snprintf(expected, sizeof(expected), "%llu",
+                 (unsigned long long)power);
+        d_fmt_uint64(buffer, power);
+        boundaries = boundaries && (strcmp(buffer, expected) == 0);
+
+        snprintf(expected, sizeof(expected), "%llu",
+                 (unsigned long long)(power + 1));
+        d_fmt_uint64(buffer, power + 1);
+        boundaries = boundaries && (strcmp(buffer, expected) == 0);
+
+        if (i < 19)
+        {
+            power *= 10;
+        }
+    }
+
+    result = d_assert_standalone(
+        boundaries,
+        "fmt_unsigned_boundaries",
+        "Values around every power of ten should match snprintf",
+        _counter) && result;
+
+    // test 3: maxima
+    result = d_assert_standalone(
+        (d_fmt_uint32(buffer, UINT32_MAX) == 10) &&
+        (strcmp(buffer, "4294967295") == 0) &&
+        (d_fmt_uint64(buffer, UINT64_MAX) == 20) &&
+        (strcmp(buffer, "18446744073709551615") == 0),
+        "fmt_unsigned_max",
+        "UINT32_MAX and UINT64_MAX should format in full",
+        _counter) && result;
+
+    // test 4: NULL
+    result = d_assert_standalone(
+        d_fmt_uint64(NULL, 1) == 0,
+        "fmt_unsigned_null",
+        "NULL buffer should return 0",
+        _counter) && result;
+
+    return result;
+}
+
+
+/*
+d_tests_sa_number_fmt_signed
+  Tests d_fmt_int32 and d_fmt_int64.
+  Tests the following:
+  - positive and negative values
+  - INT32_MIN and INT64_MIN, which cannot be negated as signed values
+*/
+bool
+d_tests_sa_number_fmt_signed
+(
+    struct d_test_counter* _counter
+)
+{
+    bool result;
+    char buffer[D_FMT_INT_BUFFER_SIZE];
+
+    result = true;
+
+    // test 1: signs
+    result = d_assert_standalone(
+        (d_fmt_int64(buffer, -1) == 2) && (strcmp(buffer, "-1") == 0) &&
+        (d_fmt_int64(buffer, 1234) == 4) && (strcmp(buffer, "1234") == 0) &&
+        (d_fmt_int32(buffer, -100000000) == 10) &&
+        (strcmp(buffer, "-100000000") == 0),
+        "fmt_signed_values",
+        "Negative values should carry a leading '-'",
+        _counter) && result;
+
+    // test 2: minima
+    result = d_assert_standalone(
+        (d_fmt_int32(buffer, INT32_MIN) == 11) &&
+        (strcmp(buffer, "-2147483648") == 0) &&
+        (d_fmt_int64(buffer, INT64_MIN) == 20) &&
+        (strcmp(buffer, "-9223372036854775808") == 0),
+        "fmt_signed_min",
+        "INT32_MIN and INT64_MIN should format correctly",
+        _counter) && result;
+
+    return result;
+}
+
+
+/*
+d_tests_sa_number_fmt_hex
+  Tests d_fmt_hex64.
+  Tests the following:
+  - no leading zeros, "0" for zero
+  - lowercase and uppercase digits
+  - full 16-digit values
+*/
+bool
+d_tests_sa_number_fmt_hex
+(
+    struct d_test_counter* _counter
+)
+{
+    bool result;
+    char buffer[D_FMT_HEX_BUFFER_SIZE];
+
+    result = true;
+
+    // test 1: short values
+    result = d_assert_standalone(
+        (d_fmt_hex64(buffer, 0, false) == 1) && (strcmp(buffer, "0") == 0) &&
+        (d_fmt_hex64(buffer, 0xF, false) == 1) && (strcmp(buffer, "f") == 0) &&
+        (d_fmt_hex64(buffer, 0x10, false) == 2) && (strcmp(buffer, "10") == 0),
+        "fmt_hex_short",
+        "Hex output should have no leading zeros",
+        _counter) && result;
+
+    // test 2: case
+    result = d_assert_standalone(
+        (d_fmt_hex64(buffer, 0xDEADBEEF, false) == 8) &&
+        (strcmp(buffer, "deadbeef") == 0) &&
+        (d_fmt_hex64(buffer, 0xDEADBEEF, true) == 8) &&
+        (strcmp(buffer, "DEADBEEF") == 0),
+        "fmt_hex_case",
+        "Hex digits should follow the requested case",
+        _counter) && result;
+
+    // test 3: full width
+    result = d_assert_standalone(
+        (d_fmt_hex64(buffer, UINT64_MAX, false) == 16) &&
+        (strcmp(buffer, "ffffffffffffffff") == 0),
+        "fmt_hex_full",
+        "UINT64_MAX should use all 16 digits",
+        _counter) && result;
+
+    return result;
+}
+
+
+/*
+d_tests_sa_number_fmt_int_all
+  Aggregation function that runs all integer formatting tests.
+*/
+bool
+d_tests_sa_number_fmt_int_all
+(
+    struct d_test_counter* _counter
+)
+{
+    bool result;
+
+    result = true;
+
+    printf("\n  [SECTION] Integer Formatting\n");
+    printf("  ----------------------------\n");
+
+    result = d_tests_sa_number_fmt_unsigned(_counter) && result;
+    result = d_tests_sa_number_fmt_signed(_counter) && result;
+    result = d_tests_sa_number_fmt_hex(_counter) && result;
+
+    return result;
+}
+
+
+/*
+d_tests_sa_number_fmt_double_special
+  Tests d_fmt_double on values that have no digits to search for.
+  Tests the following:
+  - positive and negative zero
+  - NaN and both infinities
+*/
+bool
+d_tests_sa_number_fmt_double_special
+(
+    struct d_test_counter* _counter
+)
+{
+    bool   result;
+    double zero;
+
+    result = true;
+    zero   = 0.0;
+
+    // test 1: zeros
+    result = d_assert_standalone(
+        d_tests_sa_number_double_matches(0.0, "0") &&
+        d_tests_sa_number_double_matches(-0.0, "-0"),
+        "fmt_double_zero",
+        "Zeros should format as \"0\" and \"-0\"",
+        _counter) && result;
+
+    // test 2: non-finite
+    result = d_assert_standalone(
+        d_tests_sa_number_double_matches(zero / zero, "nan")   &&
+        d_tests_sa_number_double_matches(1.0 / zero, "inf")    &&
+        d_tests_sa_number_double_matches(-1.0 / zero, "-inf"),
+        "fmt_double_nonfinite",
+        "NaN and infinities should format as nan / inf / -inf",
+        _counter) && result;
+
+    return result;
+}
+
+
+/*
+d_tests_sa_number_fmt_double_notation
+  Tests the choice between fixed and scientific notation.
+  Tests the following:
+  - integral values print without a decimal point
+  - fractions and small magnitudes down to 1e-4 use fixed notation
+  - magnitudes below 1e-4 or from 1e17 up use scientific notation
+*/
+bool
+d_tests_sa_number_fmt_double_notation
+(
+    struct d_test_counter* _counter
+)
+{
+    bool result;
+
+    result = true;
+
+    // test 1: integers
+    result = d_assert_standalone(
+        d_tests_sa_number_double_matches(1.0, "1")       &&
+        d_tests_sa_number_double_matches(100.0, "100")   &&
+        d_tests_sa_number_double_matches(-42.0, "-42")   &&
+        d_tests_sa_number_double_matches(1e16, "10000000000000000"),
+        "fmt_double_integral",
+        "Integral values should print without a decimal point",
+        _counter) && result;
+
+    // test 2: fixed
+    result = d_assert_standalone(
+        d_tests_sa_number_double_matches(1234.5, "1234.5") &&
+        d_tests_sa_number_double_matches(-1.5, "-1.5")     &&
+        d_tests_sa_number_double_matches(0.001, "0.001")   &&
+        d_tests_sa_number_double_matches(1e-4, "0.0001"),
+        "fmt_double_fixed",
+        "Moderate magnitudes should use fixed notation",
+        _counter) && result;
+
+    // test 3: scientific
+    result = d_assert_standalone(
+        d_tests_sa_number_double_matches(1e-5, "1e-5")                 &&
+        d_tests_sa_number_double_matches(1e17, "1e17")                 &&
+        d_tests_sa_number_double_matches(6.02214076e23, "6.02214076e23") &&
+        d_tests_sa_number_double_matches(5e-324, "5e-324")             &&
+        d_tests_sa_number_double_matches(-2.2250738585072014e-308,
+                                         "-2.2250738585072014e-308"),
+        "fmt_double_scientific",
+        "Very small and very large magnitudes should use scientific "
+        "notation",
+        _counter) && result;
+
+    return result;
+}
+
+
+/*
+d_tests_sa_number_fmt_double_shortest
+  Tests that d_fmt_double picks the shortest digit string.
+  Tests the following:
+  - classic binary-inexact decimals print as typed
+  - the largest double and the largest exact integer print in full
+  - 1e23, whose nearest double is below 10^23, still prints as "1e23"
+*/
+bool
+d_tests_sa_number_fmt_double_shortest
+(
+    struct d_test_counter* _counter
+)
+{
+    bool result;
+
+    result = true;
+
+    // test 1: decimal literals
+    result = d_assert_standalone(
+        d_tests_sa_number_double_matches(0.1, "0.1")   &&
+        d_tests_sa_number_double_matches(0.3, "0.3")   &&
+        d_tests_sa_number_double_matches(0.1 + 0.2, "0.30000000000000004"),
+        "fmt_double_shortest_decimal",
+        "Decimal literals should print as typed, sums at full precision",
+        _counter) && result;
+
+    // test 2: extremes
+    result = d_assert_standalone(
+        d_tests_sa_number_double_matches(1.7976931348623157e308,
+                                         "1.7976931348623157e308") &&
+        d_tests_sa_number_double_matches(9007199254740991.0,
+                                         "9007199254740991"),
+        "fmt_double_shortest_extremes",
+        "DBL_MAX and 2^53 - 1 should print in full",
+        _counter) && result;
+
+    // test 3: interval edges
+    result = d_assert_standalone(
+        d_tests_sa_number_double_matches(1e23, "1e23") &&
+        d_tests_sa_number_double_matches(1e22, "1e22"),
+        "fmt_double_shortest_edges",
+        "Powers of ten near the exact-representation limit should be short",
+        _counter) && result;
+
+    return result;
+}
+
+
+/*
+d_tests_sa_number_fmt_double_roundtrip
+  Tests that d_fmt_double output reads back to the same bits.
+  Tests the following:
+  - pseudo-random bit patterns across the whole finite range, including
+    subnormals, round-trip through strtod
+  - output never exceeds D_FMT_DOUBLE_BUFFER_SIZE - 1 characters
+*/
+bool
+d_tests_sa_number_fmt_double_roundtrip
+(
+    struct d_test_counter* _counter
+)
+{
+    bool     result;
+    bool     roundtrip;
+    bool     bounded;
+    char     buffer[D_FMT_DOUBLE_BUFFER_SIZE];
+    uint64_t state;
+    uint64_t bits;
+    double   value;
+    double   back;
+    size_t   length;
+    int      i;
+
+    result    = true;
+    roundtrip = true;
+    bounded   = true;
+    state     = 0x9E3779B97F4A7C15ULL;
+
+    for (i = 0; i < 100000; i++)
+    {
+        // xorshift64
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        bits   = state;
+
+        // every fourth value is forced subnormal
+        if ((i & 3) == 0)
+        {
+            bits &= ~(0x7FFULL << 52);
+        }
+
+        memcpy(&value, &bits, sizeof(value));
+
+        if (value != value)
+        {
+            continue;
+        }
+
+        length = d_fmt_double(buffer, value);
+
+        if ( (length >= D_FMT_DOUBLE_BUFFER_SIZE) ||
+             (length != strlen(buffer)) )
+        {
+            bounded = false;
+        }
+
+        back = strtod(buffer, NULL);
+
+        if (memcmp(&back, &value, sizeof(value)) != 0)
+        {
+            roundtrip = false;
+        }
+    }
+
+    // test 1: round trip
+    result = d_assert_standalone(
+        roundtrip,
+        "fmt_double_roundtrip",
+        "Formatted doubles should read back to identical bits",
+        _counter) && result;
+
+    // test 2: length bound
+    result = d_assert_standalone(
+        bounded,
+        "fmt_double_bounded",
+        "Output should fit D_FMT_DOUBLE_BUFFER_SIZE",
+        _counter) && result;
+
+    return result;
+}
+
+
+/*
+d_tests_sa_number_fmt_double_all
+  Aggregation function that runs all floating-point formatting tests.
+*/
+bool
+d_tests_sa_number_fmt_double_all
+(
+    struct d_test_counter* _counter
+)
+{
+    bool result;
+
+    result = true;
+
+    printf("\n  [SECTION] Floating-Point Formatting\n");
+    printf("  -----------------------------------\n");
+
+    result = d_tests_sa_number_fmt_double_special(_counter) && result;
+    result = d_tests_sa_number_fmt_double_notation(_counter) && result;
+    result = d_tests_sa_number_fmt_double_shortest(_counter) && result;
+    result = d_tests_sa_number_fmt_double_roundtrip(_counter) && result;
+
+    return result;
+}
@@ -0,0 +1,525 @@
+#include ".\dnumber_tests_sa.h"
+
+
+/*
+d_tests_sa_number_parse_double_is
+  Helper: parses the whole null-terminated `_text` and checks that every
+character was consumed and that the result has exactly the bits of
+`_expected`.
+*/
+static bool
+d_tests_sa_number_parse_double_is
+(
+    const char* _text,
+    double      _expected
+)
+{
+    double value;
+    size_t length;
+
+    length = strlen(_text);
+
+    return (d_parse_double(_text, length, &value) == length) &&
+           (memcmp(&value, &_expected, sizeof(value)) == 0);
+}
+
+
+/*
+d_tests_sa_number_parse_int_values
+  Tests d_parse_int64 and d_parse_uint64 on well-formed input.
+  Tests the following:
+  - signs and leading zeros
+  - long runs handled by the eight-digit path
+  - parsing stops at the first non-digit and reports the consumed length
+*/
+bool
+d_tests_sa_number_parse_int_values
+(
+    struct d_test_counter* _counter
+)
+{
+    bool     result;
+    int64_t  value;
+    uint64_t unsigned_value;
+
+    result = true;
+
+    // test 1: signs and zeros
+    result = d_assert_standalone(
+        (d_parse_int64("-42", 3, &value) == 3) && (value == -42) &&
+        (d_parse_int64("+7", 2, &value) == 2) && (value == 7)    &&
+        (d_parse_int64("0000012", 7, &value) == 7) && (value == 12),
+        "parse_int_signs",
+        "Signs and leading zeros should be accepted",
+        _counter) && result;
+
+    // test 2: long runs
+    result = d_assert_standalone(
+        (d_parse_uint64("1234567890123456789", 19, &unsigned_value) == 19) &&
+        (unsigned_value == 1234567890123456789ULL)                          &&
+        (d_parse_int64("-12345678", 9, &value) == 9)                        &&
+        (value == -12345678),
+        "parse_int_long",
+        "Multi-chunk digit runs should parse exactly",
+        _counter) && result;
+
+    // test 3: trailing characters
+    result = d_assert_standalone(
+        (d_parse_int64("123,456", 7, &value) == 3) && (value == 123) &&
+        (d_parse_uint64("99 bottles", 10, &unsigned_value) == 2)     &&
+        (unsigned_value == 99),
+        "parse_int_stop",
+        "Parsing should stop at the first non-digit",
+        _counter) && result;
+
+    return result;
+}
+
+
+/*
+d_tests_sa_number_parse_int_range
+  Tests range and syntax errors of the integer parsers.
+  Tests the following:
+  - INT64_MIN, INT64_MAX and UINT64_MAX are accepted
+  - one past each limit fails with ERANGE and leaves the value untouched
+  - empty input, a lone sign and '-' for unsigned fail with EINVAL
+*/
+bool
+d_tests_sa_number_parse_int_range
+(
+    struct d_test_counter* _counter
+)
+{
+    bool     result;
+    int64_t  value;
+    uint64_t unsigned_value;
+
+    result = true;
+
+    // test 1: limits
+    result = d_assert_standalone(
+        (d_parse_int64("9223372036854775807", 19, &value) == 19) &&
+        (value == INT64_MAX)                                      &&
+        (d_parse_int64("-9223372036854775808", 20, &value) == 20) &&
+        (value == INT64_MIN)                                      &&
+        (d_parse_uint64("18446744073709551615", 20,
+                        &unsigned_value) == 20)                   &&
+        (unsigned_value == UINT64_MAX),
+        "parse_int_limits",
+        "Boundary values should parse",
+        _counter) && result;
+
+    // test 2: overflow
+    value = 5;
+    errno = 0;
+    result = d_assert_standalone(
+        (d_parse_int64("9223372036854775808", 19, &value) == 0) &&
+        (errno == ERANGE)                                        &&
+        (value == 5)                                             &&
+        (d_parse_uint64("18446744073709551616", 20,
+                        &unsigned_value) == 0)                   &&
+        (d_parse_uint64("100000000000000000000", 21,
+                        &unsigned_value) == 0),
+        "parse_int_overflow",
+        "Values past the limits should fail with ERANGE",
+        _counter) && result;
+
+    // test 3: no digits
+    errno = 0;
+    result = d_assert_standalone(
+        (d_parse_int64("", 0, &value) == 0)          &&
+        (errno == EINVAL)                            &&
+        (d_parse_int64("-", 1, &value) == 0)         &&
+        (d_parse_int64("x1", 2, &value) == 0)        &&
+        (d_parse_uint64("-1", 2, &unsigned_value) == 0) &&
+        (d_parse_int64(NULL, 1, &value) == 0),
+        "parse_int_invalid",
+        "Input without digits should fail with EINVAL",
+        _counter) && result;
+
+    return result;
+}
+
+
+/*
+d_tests_sa_number_parse_int_span
+  Tests that the parsers honour the given length.
+  Tests the following:
+  - digits beyond `_length` are never read
+  - input need not be null-terminated
+*/
+bool
+d_tests_sa_number_parse_int_span
+(
+    struct d_test_counter* _counter
+)
+{
+    bool    result;
+    int64_t value;
+    double  real;
+    char    span[12];
+
+    result = true;
+
+    // unterminated digits
+    memcpy(span, "123456789012", sizeof(span));
+
+    // test 1: integer span
+    result = d_assert_standalone(
+        (d_parse_int64(span, 4, &value) == 4) && (value == 1234) &&
+        (d_parse_int64(span, 9, &value) == 9) && (value == 123456789),
+        "parse_span_int",
+        "Integer parsing should stop at _length",
+        _counter) && result;
+
+    // test 2: double span
+    result = d_assert_standalone(
+        (d_parse_double(span, 3, &real) == 3) && (real == 123.0),
+        "parse_span_double",
+        "Double parsing should stop at _length",
+        _counter) && result;
+
+    return result;
+}
+
+
+/*
+d_tests_sa_number_parse_int_all
+  Aggregation function that runs all integer parsing tests.
+*/
+bool
+d_tests_sa_number_parse_int_all
+(
+    struct d_test_counter* _counter
+)
+{
+    bool result;
+
+    result = true;
+
+    printf("\n  [SECTION] Integer Parsing\n");
+    printf("  -------------------------\n");
+
+    result = d_tests_sa_number_parse_int_values(_counter) && result;
+    result = d_tests_sa_number_parse_int_range(_counter) && result;
+    result = d_tests_sa_number_parse_int_span(_counter) && result;
+
+    return result;
+}
+
+
+/*
+d_tests_sa_number_parse_double_syntax
+  Tests the accepted double syntax and consumed lengths.
+  Tests the following:
+  - integer, fraction-only and trailing-dot forms
+  - exponents with and without sign
+  - an incomplete exponent is not consumed
+  - input without digits is rejected
+*/
+bool
+d_tests_sa_number_parse_double_syntax
+(
+    struct d_test_counter* _counter
+)
+{
+    bool   result;
+    double value;
+
+    result = true;
+
+    // test 1: mantissa forms
+    result = d_assert_standalone(
+        d_tests_sa_number_parse_double_is("42", 42.0)     &&
+        d_tests_sa_number_parse_double_is("-1.5", -1.5)   &&
+        d_tests_sa_number_parse_double_is(".25", 0.25)    &&
+        d_tests_sa_number_parse_double_is("3.", 3.0)      &&
+        d_tests_sa_number_parse_double_is("-0", -0.0),
+        "parse_double_mantissa",
+        "Mantissa forms should parse",
+        _counter) && result;
+
+    // test 2: exponents
+    result = d_assert_standalone(
+        d_tests_sa_number_parse_double_is("1e3", 1000.0)      &&
+        d_tests_sa_number_parse_double_is("2.5E-3", 0.0025)   &&
+        d_tests_sa_number_parse_double_is("7e+2", 700.0),
+        "parse_double_exponent",
+        "Exponents should scale the mantissa",
+        _counter) && result;
+
+    // test 3: partial consumption
+    result = d_assert_standalone(
+        (d_parse_double("1e", 2, &value) == 1) && (value == 1.0)   &&
+        (d_parse_double("2e+x", 4, &value) == 1) && (value == 2.0) &&
+        (d_parse_double("0.5,1", 5, &value) == 3),
+        "parse_double_partial",
+        "An exponent marker without digits should not be consumed",
+        _counter) && result;
+
+    // test 4: rejected
+    errno = 0;
+    result = d_assert_standalone(
+        (d_parse_double(".", 1, &value) == 0) &&
+        (errno == EINVAL)                     &&
+        (d_parse_double("-", 1, &value) == 0) &&
+        (d_parse_double("e5", 2, &value) == 0),
+        "parse_double_invalid",
+        "Input without mantissa digits should fail with EINVAL",
+        _counter) && result;
+
+    return result;
+}
+
+
+/*
+d_tests_sa_number_parse_double_special
+  Tests infinity and NaN spellings.
+  Tests the following:
+  - "inf" and "infinity" in any case, with sign
+  - "nan" yields a NaN
+  - a prefix of a special word is rejected
+*/
+bool
+d_tests_sa_number_parse_double_special
+(
+    struct d_test_counter* _counter
+)
+{
+    bool   result;
+    double value;
+
+    result = true;
+
+    // test 1: infinities
+    result = d_assert_standalone(
+        (d_parse_double("inf", 3, &value) == 3)            &&
+        (value > 0) && (value * 0.5 == value)              &&
+        (d_parse_double("-Infinity", 9, &value) == 9)      &&
+        (value < 0) && (value * 0.5 == value),
+        "parse_double_inf",
+        "Infinity spellings should parse with their sign",
+        _counter) && result;
+
+    // test 2: nan
+    result = d_assert_standalone(
+        (d_parse_double("NaN", 3, &value) == 3) && (value != value),
+        "parse_double_nan",
+        "\"nan\" should yield a NaN",
+        _counter) && result;
+
+    // test 3: prefixes
+    result = d_assert_standalone(
+        (d_parse_double("in", 2, &value) == 0) &&
+        (d_parse_double("na", 2, &value) == 0),
+        "parse_double_special_prefix",
+        "Incomplete special words should be rejected",
+        _counter) && result;
+
+    return result;
+}
+
+
+/*
+d_tests_sa_number_parse_double_rounding
+  Tests correct rounding on inputs that defeat naive conversion.
+  Tests the following:
+  - decimal literals that are not exact in binary
+  - exact halfway cases round to even, and any extra digit breaks the tie
+  - inputs with hundreds of significant digits
+  - the smallest subnormal and the normal/subnormal boundary
+*/
+bool
+d_tests_sa_number_parse_double_rounding
+(
+    struct d_test_counter* _counter
+)
+{
+    bool result;
+
+    result = true;
+
+    // test 1: inexact literals
+    result = d_assert_standalone(
+        d_tests_sa_number_parse_double_is("0.1", 0.1)     &&
+        d_tests_sa_number_parse_double_is("0.3", 0.3)     &&
+        d_tests_sa_number_parse_double_is("1e23", 1e23)   &&
+        d_tests_sa_number_parse_double_is("8.98846567431158e307",
+                                          8.98846567431158e307),
+        "parse_double_literals",
+        "Decimal literals should match the compiler's conversion",
+        _counter) && result;
+
+    // test 2: halfway between 1 and the next double (1 + 2^-52)
+    result = d_assert_standalone(
+        d_tests_sa_number_parse_double_is(
+            "1.00000000000000011102230246251565404236316680908203125",
+            1.0) &&
+        d_tests_sa_number_parse_double_is(
+            "1.00000000000000011102230246251565404236316680908203126",
+            1.0000000000000002) &&
+        d_tests_sa_number_parse_double_is("9007199254740993",
+                                          9007199254740992.0),
+        "parse_double_ties",
+        "Exact ties should round to even, anything above should round up",
+        _counter) && result;
+
+    // test 3: many digits
+    result = d_assert_standalone(
+        d_tests_sa_number_parse_double_is(
+            "123456789012345678901234567890", 1.2345678901234568e29) &&
+        d_tests_sa_number_parse_double_is(
+            "0.0000000000000000000000000000000000000000000012345",
+            1.2345e-45),
+        "parse_double_long",
+        "Inputs longer than 19 digits should round correctly",
+        _counter) && result;
+
+    // test 4: subnormals
+    result = d_assert_standalone(
+        d_tests_sa_number_parse_double_is("4.9e-324", 5e-324)        &&
+        d_tests_sa_number_parse_double_is("2.4703282292062328e-324",
+                                          5e-324)                    &&
+        d_tests_sa_number_parse_double_is("2.2250738585072011e-308",
+                                          2.2250738585072011e-308),
+        "parse_double_subnormal",
+        "Subnormal inputs should round correctly",
+        _counter) && result;
+
+    return result;
+}
+
+
+/*
+d_tests_sa_number_parse_double_range
+  Tests magnitudes outside the double range.
+  Tests the following:
+  - overflow yields a signed infinity
+  - underflow yields a signed zero
+  - absurd exponents are consumed in full
+*/
+bool
+d_tests_sa_number_parse_double_range
+(
+    struct d_test_counter* _counter
+)
+{
+    bool   result;
+    double value;
+    double zero;
+
+    result = true;
+    zero   = 0.0;
+
+    // test 1: overflow
+    result = d_assert_standalone(
+        d_tests_sa_number_parse_double_is("1e309", 1.0 / zero)    &&
+        d_tests_sa_number_parse_double_is("-1.8e308", -1.0 / zero),
+        "parse_double_overflow",
+        "Overflow should produce a signed infinity",
+        _counter) && result;
+
+    // test 2: underflow
+    result = d_assert_standalone(
+        d_tests_sa_number_parse_double_is("1e-400", 0.0)  &&
+        d_tests_sa_number_parse_double_is("-2e-324", -0.0),
+        "parse_double_underflow",
+        "Underflow should produce a signed zero",
+        _counter) && result;
+
+    // test 3: huge exponents
+    result = d_assert_standalone(
+        (d_parse_double("1e99999999999", 13, &value) == 13) &&
+        (value == 1.0 / zero),
+        "parse_double_huge_exponent",
+        "Very long exponents should saturate and be consumed",
+        _counter) && result;
+
+    return result;
+}
+
+
+/*
+d_tests_sa_number_parse_double_roundtrip
+  Tests d_parse_double against d_fmt_double.
+  Tests the following:
+  - pseudo-random bit patterns survive a format/parse round trip
+*/
+bool
+d_tests_sa_number_parse_double_roundtrip
+(
+    struct d_test_counter* _counter
+)
+{
+    bool     result;
+    bool     roundtrip;
+    char     buffer[D_FMT_DOUBLE_BUFFER_SIZE];
+    uint64_t state;
+    double   value;
+    double   back;
+    size_t   length;
+    int      i;
+
+    result    = true;
+    roundtrip = true;
+    state     = 0x2545F4914F6CDD1DULL;
+
+    for (i = 0; i < 100000; i++)
+    {
+        // xorshift64
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+
+        memcpy(&value, &state, sizeof(value));
+
+        if (value != value)
+        {
+            continue;
+        }
+
+        length = d_fmt_double(buffer, value);
+
+        if ( (d_parse_double(buffer, length, &back) != length) ||
+             (memcmp(&back, &value, sizeof(value)) != 0) )
+        {
+            roundtrip = false;
+        }
+    }
+
+    // test 1: round trip
+    result = d_assert_standalone(
+        roundtrip,
+        "parse_double_roundtrip",
+        "d_parse_double should invert d_fmt_double",
+        _counter) && result;
+
+    return result;
+}
+
+
+/*
+d_tests_sa_number_parse_double_all
+  Aggregation function that runs all floating-point parsing tests.
+*/
+bool
+d_tests_sa_number_parse_double_all
+(
+    struct d_test_counter* _counter
+)
+{
+    bool result;
+
+    result = true;
+
+    printf("\n  [SECTION] Floating-Point Parsing\n");
+    printf("  --------------------------------\n");
+
+    result = d_tests_sa_number_parse_double_syntax(_counter) && result;
+    result = d_tests_sa_number_parse_double_special(_counter) && result;
+    result = d_tests_sa_number_parse_double_rounding(_counter) && result;
+    result = d_tests_sa_number_parse_double_range(_counter) && result;
+    result = d_tests_sa_number_parse_double_roundtrip(_counter) && result;
+
+    return result;
+}
@@ -0,0 +1,101 @@
+#include ".\dstatcache_tests_sa.h"
+
+
+/*
+d_test_stat_cache_setup
+  Builds the scratch tree shared by all stat cache tests:
+    dstatcache_test_tmp/a.c
+    dstatcache_test_tmp/sub/b.h
+    dstatcache_test_tmp/sub/c.h
+    dstatcache_test_tmp/link -> a.c   (where symlinks are supported)
+*/
+bool
+d_test_stat_cache_setup
+(
+    void
+)
+{
+    if (d_mkdir_p(D_TEST_STAT_CACHE_ROOT "/sub", 0755) != 0)
+    {
+        return false;
+    }
+
+    if ( (d_fwrite_all(D_TEST_STAT_CACHE_ROOT "/a.c", "int a;\n", 7) != 0) ||
+         (d_fwrite_all(D_TEST_STAT_CACHE_ROOT "/sub/b.h", "b", 1) != 0) ||
+         (d_fwrite_all(D_TEST_STAT_CACHE_ROOT "/sub/c.h", "cc", 2) != 0) )
+    {
+        return false;
+    }
+
+#if D_FILE_HAS_SYMLINKS
+    d_symlink("a.c", D_TEST_STAT_CACHE_ROOT "/link");
+#endif
+
+    return true;
+}
+
+
+/*
+d_test_stat_cache_teardown
+  Removes the scratch tree, including anything a test left behind.
+*/
+void
+d_test_stat_cache_teardown
+(
+    void
+)
+{
+    d_remove(D_TEST_STAT_CACHE_ROOT "/a.c");
+    d_remove(D_TEST_STAT_CACHE_ROOT "/new.c");
+    d_remove(D_TEST_STAT_CACHE_ROOT "/link");
+    d_remove(D_TEST_STAT_CACHE_ROOT "/sub/b.h");
+    d_remove(D_TEST_STAT_CACHE_ROOT "/sub/c.h");
+    d_remove(D_TEST_STAT_CACHE_ROOT "/moved/b.h");
+    d_remove(D_TEST_STAT_CACHE_ROOT "/moved/c.h");
+    d_rmdir(D_TEST_STAT_CACHE_ROOT "/sub");
+    d_rmdir(D_TEST_STAT_CACHE_ROOT "/moved");
+    d_rmdir(D_TEST_STAT_CACHE_ROOT);
+
+    return;
+}
+
+
+/*
+d_tests_sa_dstatcache_run_all
+  Module-level aggregation function that runs all dstatcache tests.
+  Executes tests for all categories:
+  - Queries
+  - Invalidation
+  - Batch queries
+*/
+bool
+d_tests_sa_dstatcache_run_all
+(
+    struct d_test_counter* _counter
+)
+{
+    bool result;
+
+    result = true;
+
+    d_test_stat_cache_teardown();
+
+    if (!d_test_stat_cache_setup())
+    {
+        d_test_stat_cache_teardown();
+
+        return d_assert_standalone(false,
+                                   "stat_cache_setup",
+                                   "Failed to build the scratch tree",
+                                   _counter);
+    }
+
+    // run all test categories
+    result = d_tests_sa_stat_cache_query_all(_counter) && result;
+    result = d_tests_sa_stat_cache_invalidation_all(_counter) && result;
+    result = d_tests_sa_stat_cache_batch_all(_counter) && result;
+
+    d_test_stat_cache_teardown();
+
+    return result;
+}
@@ -0,0 +1,84 @@
+/******************************************************************************
+* djinterp [test]                                        dstatcache_tests_sa.h
+*
+*   Unit test declarations for `dstatcache.h` module.
+*   Covers cached metadata queries over a scratch tree: pass-through with a
+* NULL cache, hit and miss accounting, negative entries, path aliasing,
+* explicit, generation and TTL invalidation, the entry limit, batch queries,
+* and inotify-driven invalidation where the platform offers it.
+*
+*
+* path:      \tests\dstatcache_tests_sa.h
+* link:      TBA
+* author(s): Samuel 'teer' Neal-Blim                          date: 2026.10.18
+******************************************************************************/
+
+#ifndef DJINTERP_TESTS_DSTATCACHE_STANDALONE_
+#define DJINTERP_TESTS_DSTATCACHE_STANDALONE_ 1
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <errno.h>
+#include <string.h>
+#include "..\..\inc\c\test\test_standalone.h"
+#include "..\..\inc\c\dstatcache.h"
+#include "..\..\inc\c\dfile.h"
+#include "..\..\inc\c\dtime.h"
+
+
+// D_TEST_STAT_CACHE_ROOT
+//   constant: scratch tree built (and removed) by the stat cache tests.
+#define D_TEST_STAT_CACHE_ROOT "dstatcache_test_tmp"
+
+
+/******************************************************************************
+ * I. QUERY TESTS
+ *****************************************************************************/
+bool d_tests_sa_stat_cache_passthrough(struct d_test_counter* _counter);
+bool d_tests_sa_stat_cache_hits(struct d_test_counter* _counter);
+bool d_tests_sa_stat_cache_negative(struct d_test_counter* _counter);
+bool d_tests_sa_stat_cache_aliases(struct d_test_counter* _counter);
+bool d_tests_sa_stat_cache_predicates(struct d_test_counter* _counter);
+
+// I. aggregation function
+bool d_tests_sa_stat_cache_query_all(struct d_test_counter* _counter);
+
+
+/******************************************************************************
+ * II. INVALIDATION TESTS
+ *****************************************************************************/
+bool d_tests_sa_stat_cache_invalidate(struct d_test_counter* _counter);
+bool d_tests_sa_stat_cache_ttl(struct d_test_counter* _counter);
+bool d_tests_sa_stat_cache_limit(struct d_test_counter* _counter);
+bool d_tests_sa_stat_cache_watch(struct d_test_counter* _counter);
+
+// II. aggregation function
+bool d_tests_sa_stat_cache_invalidation_all(struct d_test_counter* _counter);
+
+
+/******************************************************************************
+ * III. BATCH TESTS
+ *****************************************************************************/
+bool d_tests_sa_stat_cache_batch(struct d_test_counter* _counter);
+bool d_tests_sa_stat_cache_batch_lstat(struct d_test_counter* _counter);
+
+// III. aggregation function
+bool d_tests_sa_stat_cache_batch_all(struct d_test_counter* _counter);
+
+
+/******************************************************************************
+ * SHARED HELPERS
+ *****************************************************************************/
+bool d_test_stat_cache_setup(void);
+void d_test_stat_cache_teardown(void);
+
+
+/******************************************************************************
+ * MODULE-LEVEL AGGREGATION
+ *****************************************************************************/
+bool d_tests_sa_dstatcache_run_all(struct d_test_counter* _counter);
+
+
+#endif  // DJINTERP_TESTS_DSTATCACHE_STANDALONE_
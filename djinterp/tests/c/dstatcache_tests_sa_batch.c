@@ -0,0 +1,266 @@
+#include ".\dstatcache_tests_sa.h"
+
+
+///////////////////////////////////////////////////////////////////////////////
+// file-scope helpers
+///////////////////////////////////////////////////////////////////////////////
+
+#define D_TEST_STAT_CACHE_BATCH_COUNT 10
+
+// paths in no particular order: several directories, aliases, misses, root
+static const char* d_test_stat_cache_batch_paths[D_TEST_STAT_CACHE_BATCH_COUNT] =
+{
+    D_TEST_STAT_CACHE_ROOT "/sub/c.h",
+    D_TEST_STAT_CACHE_ROOT "/a.c",
+    D_TEST_STAT_CACHE_ROOT "/missing.h",
+    D_TEST_STAT_CACHE_ROOT "/sub/b.h",
+    D_TEST_STAT_CACHE_ROOT "/sub",
+    D_TEST_STAT_CACHE_ROOT "/./sub//b.h",
+    D_TEST_STAT_CACHE_ROOT "/nodir/x.h",
+    D_TEST_STAT_CACHE_ROOT,
+    D_TEST_STAT_CACHE_ROOT "/a.c/",
+    "/"
+};
+
+// helper: true if every batch result agrees with d_stat / d_lstat
+static bool
+d_test_stat_cache_batch_matches
+(
+    const struct d_stat_cache_result* _results,
+    bool                              _follow_links
+)
+{
+    struct d_stat_t st;
+    size_t          i;
+    int             rc;
+    int             error;
+
+    for (i = 0; i < D_TEST_STAT_CACHE_BATCH_COUNT; i++)
+    {
+        errno = 0;
+        rc    = (_follow_links)
+                    ? d_stat(d_test_stat_cache_batch_paths[i], &st)
+                    : d_lstat(d_test_stat_cache_batch_paths[i], &st);
+        error = (rc == 0) ? 0 : errno;
+
+        if (_results[i].error != error)
+        {
+            return false;
+        }
+
+        if ( (error == 0) &&
+             ( (_results[i].st.st_ino != st.st_ino) ||
+               (_results[i].st.st_size != st.st_size) ||
+               (_results[i].st.st_mode != st.st_mode) ||
+               (_results[i].st.st_dev != st.st_dev) ) )
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+
+///////////////////////////////////////////////////////////////////////////////
+// test functions
+///////////////////////////////////////////////////////////////////////////////
+
+
+/*
+d_tests_sa_stat_cache_batch
+  Tests d_stat_cache_stat_batch.
+  Tests the following:
+  - results arrive in input order and agree with d_stat
+  - the return value counts the successful paths
+  - a repeated batch is answered entirely from the cache
+  - a NULL cache and invalid arguments
+*/
+bool
+d_tests_sa_stat_cache_batch
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                       result;
+    struct d_stat_cache*       cache;
+    struct d_stat_cache_result results[D_TEST_STAT_CACHE_BATCH_COUNT];
+    struct d_stat_cache_stats  stats;
+    size_t                     succeeded;
+
+    result = true;
+    cache  = d_stat_cache_new(NULL);
+
+    if (!cache)
+    {
+        return d_assert_standalone(false,
+                                   "stat_cache_batch_new",
+                                   "d_stat_cache_new failed",
+                                   _counter);
+    }
+
+    succeeded = d_stat_cache_stat_batch(cache,
+                                        d_test_stat_cache_batch_paths,
+                                        D_TEST_STAT_CACHE_BATCH_COUNT,
+                                        true,
+                                        results);
+
+    // test 1: agreement with d_stat
+    result = d_assert_standalone(
+        (succeeded == 7) &&
+        (d_test_stat_cache_batch_matches(results, true)),
+        "stat_cache_batch_first",
+        "A cold batch should agree with d_stat path by path",
+        _counter) && result;
+
+    d_stat_cache_get_stats(cache, &stats);
+
+    // test 2: aliases resolved once
+    result = d_assert_standalone(
+        (stats.misses == 10) &&
+        (stats.syscalls == 10) &&
+        (stats.entries == 9),
+        "stat_cache_batch_entries",
+        "Aliased paths in one batch should share an entry",
+        _counter) && result;
+
+    // test 3: warm batch
+    d_memset(results, 0xff, sizeof(results));
+    succeeded = d_stat_cache_stat_batch(cache,
+                                        d_test_stat_cache_batch_paths,
+                                        D_TEST_STAT_CACHE_BATCH_COUNT,
+                                        true,
+                                        results);
+    d_stat_cache_get_stats(cache, &stats);
+
+    result = d_assert_standalone(
+        (succeeded == 7) &&
+        (stats.hits == D_TEST_STAT_CACHE_BATCH_COUNT) &&
+        (stats.syscalls == 10) &&
+        (d_test_stat_cache_batch_matches(results, true)),
+        "stat_cache_batch_warm",
+        "A repeated batch should not issue any system call",
+        _counter) && result;
+
+    // test 4: NULL cache
+    succeeded = d_stat_cache_stat_batch(NULL,
+                                        d_test_stat_cache_batch_paths,
+                                        D_TEST_STAT_CACHE_BATCH_COUNT,
+                                        true,
+                                        results);
+
+    result = d_assert_standalone(
+        (succeeded == 7) &&
+        (d_test_stat_cache_batch_matches(results, true)),
+        "stat_cache_batch_null_cache",
+        "A NULL cache should stat every path directly",
+        _counter) && result;
+
+    // test 5: invalid arguments
+    errno = 0;
+
+    result = d_assert_standalone(
+        (d_stat_cache_stat_batch(cache, NULL, 1, true, results) == 0) &&
+        (errno == EINVAL) &&
+        (d_stat_cache_stat_batch(cache,
+                                 d_test_stat_cache_batch_paths,
+                                 0,
+                                 true,
+                                 results) == 0),
+        "stat_cache_batch_invalid",
+        "NULL arrays should fail with EINVAL; an empty batch returns 0",
+        _counter) && result;
+
+    d_stat_cache_free(cache);
+
+    return result;
+}
+
+
+/*
+d_tests_sa_stat_cache_batch_lstat
+  Tests d_stat_cache_stat_batch without following symlinks.
+  Tests the following:
+  - results agree with d_lstat
+  - a link is reported as a link
+*/
+bool
+d_tests_sa_stat_cache_batch_lstat
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                       result;
+    struct d_stat_cache*       cache;
+    struct d_stat_cache_result results[D_TEST_STAT_CACHE_BATCH_COUNT];
+
+    result = true;
+    cache  = d_stat_cache_new(NULL);
+
+    if (!cache)
+    {
+        return d_assert_standalone(false,
+                                   "stat_cache_batch_lstat_new",
+                                   "d_stat_cache_new failed",
+                                   _counter);
+    }
+
+    d_stat_cache_stat_batch(cache,
+                            d_test_stat_cache_batch_paths,
+                            D_TEST_STAT_CACHE_BATCH_COUNT,
+                            false,
+                            results);
+
+    // test 1: agreement with d_lstat
+    result = d_assert_standalone(
+        d_test_stat_cache_batch_matches(results, false),
+        "stat_cache_batch_lstat_match",
+        "A no-follow batch should agree with d_lstat",
+        _counter) && result;
+
+#if D_FILE_HAS_SYMLINKS
+    {
+        const char* link_path;
+
+        link_path = D_TEST_STAT_CACHE_ROOT "/link";
+
+        d_stat_cache_stat_batch(cache, &link_path, 1, false, results);
+
+        // test 2: link seen as a link
+        result = d_assert_standalone(
+            (results[0].error == 0) &&
+            (S_ISLNK(results[0].st.st_mode)),
+            "stat_cache_batch_lstat_link",
+            "A no-follow batch should report the link itself",
+            _counter) && result;
+    }
+#endif
+
+    d_stat_cache_free(cache);
+
+    return result;
+}
+
+
+/*
+d_tests_sa_stat_cache_batch_all
+  Aggregation function that runs all batch tests.
+*/
+bool
+d_tests_sa_stat_cache_batch_all
+(
+    struct d_test_counter* _counter
+)
+{
+    bool result;
+
+    result = true;
+
+    printf("\n  [SECTION] Batch Queries\n");
+    printf("  -----------------------\n");
+
+    result = d_tests_sa_stat_cache_batch(_counter) && result;
+    result = d_tests_sa_stat_cache_batch_lstat(_counter) && result;
+
+    return result;
+}
@@ -0,0 +1,749 @@
+#include ".\dstatcache_tests_sa.h"
+
+
+///////////////////////////////////////////////////////////////////////////////
+// file-scope helpers
+///////////////////////////////////////////////////////////////////////////////
+
+#define D_TEST_STAT_CACHE_FILE    D_TEST_STAT_CACHE_ROOT "/a.c"
+#define D_TEST_STAT_CACHE_NEW     D_TEST_STAT_CACHE_ROOT "/new.c"
+#define D_TEST_STAT_CACHE_MISSING D_TEST_STAT_CACHE_ROOT "/missing.h"
+
+// helper: counters of a cache
+static struct d_stat_cache_stats
+d_test_stat_cache_stats
+(
+    struct d_stat_cache* _cache
+)
+{
+    struct d_stat_cache_stats stats;
+
+    d_stat_cache_get_stats(_cache, &stats);
+
+    return stats;
+}
+
+// helper: polls `_path` until its cached existence equals `_expected`
+static bool
+d_test_stat_cache_wait_exists
+(
+    struct d_stat_cache* _cache,
+    const char*          _path,
+    int                  _expected
+)
+{
+    int attempt;
+
+    for (attempt = 0; attempt < 200; attempt++)
+    {
+        if (d_stat_cache_file_exists(_cache, _path) == _expected)
+        {
+            return true;
+        }
+
+        d_sleep_ms(5);
+    }
+
+    return false;
+}
+
+
+///////////////////////////////////////////////////////////////////////////////
+// test functions
+///////////////////////////////////////////////////////////////////////////////
+
+
+/*
+d_tests_sa_stat_cache_passthrough
+  Tests the queries with a NULL cache.
+  Tests the following:
+  - results equal the uncached dfile.h functions
+  - NULL arguments are rejected with EINVAL
+  - d_stat_cache_get_stats zeroes its output for a NULL cache
+*/
+bool
+d_tests_sa_stat_cache_passthrough
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                      result;
+    struct d_stat_t           cached;
+    struct d_stat_t           direct;
+    struct d_stat_cache_stats stats;
+    int                       rc;
+
+    result = true;
+
+    rc = d_stat_cache_stat(NULL, D_TEST_STAT_CACHE_FILE, &cached);
+    d_stat(D_TEST_STAT_CACHE_FILE, &direct);
+
+    // test 1: same answer as d_stat
+    result = d_assert_standalone(
+        (rc == 0) &&
+        (cached.st_size == direct.st_size) &&
+        (cached.st_ino == direct.st_ino),
+        "stat_cache_passthrough_stat",
+        "A NULL cache should answer exactly like d_stat",
+        _counter) && result;
+
+    // test 2: predicates
+    result = d_assert_standalone(
+        (d_stat_cache_is_file(NULL, D_TEST_STAT_CACHE_FILE)) &&
+        (d_stat_cache_is_dir(NULL, D_TEST_STAT_CACHE_ROOT)) &&
+        (!d_stat_cache_file_exists(NULL, D_TEST_STAT_CACHE_MISSING)),
+        "stat_cache_passthrough_predicates",
+        "Predicates with a NULL cache should match the filesystem",
+        _counter) && result;
+
+    // test 3: NULL arguments
+    errno = 0;
+    rc    = d_stat_cache_stat(NULL, NULL, &cached);
+
+    result = d_assert_standalone(
+        (rc == -1) &&
+        (errno == EINVAL) &&
+        (!d_stat_cache_file_exists(NULL, NULL)),
+        "stat_cache_passthrough_null",
+        "NULL paths should be rejected with EINVAL",
+        _counter) && result;
+
+    // test 4: statistics of a NULL cache
+    stats.hits = 7;
+    d_stat_cache_get_stats(NULL, &stats);
+
+    result = d_assert_standalone(
+        (stats.hits == 0) &&
+        (stats.entries == 0) &&
+        (!d_stat_cache_is_watching(NULL)),
+        "stat_cache_passthrough_stats",
+        "A NULL cache should report zeroed statistics",
+        _counter) && result;
+
+    return result;
+}
+
+
+/*
+d_tests_sa_stat_cache_hits
+  Tests hit and miss accounting.
+  Tests the following:
+  - the first query misses and issues one stat, the second hits
+  - cached results equal d_stat
+*/
+bool
+d_tests_sa_stat_cache_hits
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                      result;
+    struct d_stat_cache*      cache;
+    struct d_stat_t           first;
+    struct d_stat_t           second;
+    struct d_stat_t           direct;
+    struct d_stat_cache_stats stats;
+
+    result = true;
+    cache  = d_stat_cache_new(NULL);
+
+    // test 1: created
+    result = d_assert_standalone(
+        cache != NULL,
+        "stat_cache_hits_new",
+        "d_stat_cache_new should create a cache with default options",
+        _counter) && result;
+
+    if (!cache)
+    {
+        return result;
+    }
+
+    d_stat(D_TEST_STAT_CACHE_FILE, &direct);
+
+    // test 2: miss then hit
+    result = d_assert_standalone(
+        (d_stat_cache_stat(cache, D_TEST_STAT_CACHE_FILE, &first) == 0) &&
+        (d_stat_cache_stat(cache, D_TEST_STAT_CACHE_FILE, &second) == 0),
+        "stat_cache_hits_status",
+        "Both queries should succeed",
+        _counter) && result;
+
+    stats = d_test_stat_cache_stats(cache);
+
+    result = d_assert_standalone(
+        (stats.misses == 1) &&
+        (stats.hits == 1) &&
+        (stats.syscalls == 1) &&
+        (stats.entries == 1),
+        "stat_cache_hits_counters",
+        "The second query should be answered without a system call",
+        _counter) && result;
+
+    // test 3: contents
+    result = d_assert_standalone(
+        (first.st_size == 7) &&
+        (first.st_size == direct.st_size) &&
+        (first.st_ino == direct.st_ino) &&
+        (first.st_mode == direct.st_mode) &&
+        (first.st_mtime == direct.st_mtime) &&
+        (second.st_ino == first.st_ino),
+        "stat_cache_hits_contents",
+        "Cached status should equal d_stat",
+        _counter) && result;
+
+    d_stat_cache_free(cache);
+
+    return result;
+}
+
+
+/*
+d_tests_sa_stat_cache_negative
+  Tests caching of failed lookups.
+  Tests the following:
+  - a cached failure reports the original errno
+  - D_STAT_CACHE_NO_NEGATIVE asks the filesystem every time
+*/
+bool
+d_tests_sa_stat_cache_negative
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                        result;
+    struct d_stat_cache*        cache;
+    struct d_stat_cache_options options;
+    struct d_stat_t             st;
+    struct d_stat_cache_stats   stats;
+    int                         first_errno;
+    int                         second_errno;
+
+    result = true;
+    cache  = d_stat_cache_new(NULL);
+
+    if (!cache)
+    {
+        return d_assert_standalone(false,
+                                   "stat_cache_negative_new",
+                                   "d_stat_cache_new failed",
+                                   _counter);
+    }
+
+    errno = 0;
+    d_stat_cache_stat(cache, D_TEST_STAT_CACHE_MISSING, &st);
+    first_errno = errno;
+    errno       = 0;
+    d_stat_cache_stat(cache, D_TEST_STAT_CACHE_MISSING, &st);
+    second_errno = errno;
+    stats        = d_test_stat_cache_stats(cache);
+
+    // test 1: cached ENOENT
+    result = d_assert_standalone(
+        (first_errno == ENOENT) &&
+        (second_errno == ENOENT) &&
+        (stats.hits == 1) &&
+        (stats.syscalls == 1),
+        "stat_cache_negative_cached",
+        "A missing path should be cached with its errno",
+        _counter) && result;
+
+    d_stat_cache_free(cache);
+
+    // test 2: D_STAT_CACHE_NO_NEGATIVE
+    d_memset(&options, 0, sizeof(options));
+    options.flags = D_STAT_CACHE_NO_NEGATIVE;
+    cache         = d_stat_cache_new(&options);
+
+    if (cache)
+    {
+        d_stat_cache_file_exists(cache, D_TEST_STAT_CACHE_MISSING);
+        d_stat_cache_file_exists(cache, D_TEST_STAT_CACHE_MISSING);
+        stats = d_test_stat_cache_stats(cache);
+
+        result = d_assert_standalone(
+            (stats.hits == 0) &&
+            (stats.syscalls == 2) &&
+            (stats.entries == 0),
+            "stat_cache_negative_disabled",
+            "D_STAT_CACHE_NO_NEGATIVE should not keep failures",
+            _counter) && result;
+
+        d_stat_cache_free(cache);
+    }
+
+    return result;
+}
+
+
+/*
+d_tests_sa_stat_cache_aliases
+  Tests path normalization of cache keys.
+  Tests the following:
+  - "./" and doubled separators share the normalized entry
+  - a trailing separator is a different key ("file/" is not a directory)
+  - ".." paths are answered correctly
+*/
+bool
+d_tests_sa_stat_cache_aliases
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                      result;
+    struct d_stat_cache*      cache;
+    struct d_stat_t           st;
+    struct d_stat_cache_stats stats;
+    int                       rc;
+
+    result = true;
+    cache  = d_stat_cache_new(NULL);
+
+    if (!cache)
+    {
+        return d_assert_standalone(false,
+                                   "stat_cache_aliases_new",
+                                   "d_stat_cache_new failed",
+                                   _counter);
+    }
+
+    d_stat_cache_stat(cache, D_TEST_STAT_CACHE_ROOT "/a.c", &st);
+    d_stat_cache_stat(cache, D_TEST_STAT_CACHE_ROOT "/./a.c", &st);
+    d_stat_cache_stat(cache, D_TEST_STAT_CACHE_ROOT "//a.c", &st);
+    d_stat_cache_stat(cache, "./" D_TEST_STAT_CACHE_ROOT "/a.c", &st);
+    stats = d_test_stat_cache_stats(cache);
+
+    // test 1: one entry for all spellings
+    result = d_assert_standalone(
+        (stats.misses == 1) &&
+        (stats.hits == 3) &&
+        (stats.entries == 1),
+        "stat_cache_aliases_shared",
+        "Equivalent spellings should share one entry",
+        _counter) && result;
+
+    // test 2: trailing separator
+    errno = 0;
+    rc    = d_stat_cache_stat(cache, D_TEST_STAT_CACHE_ROOT "/a.c/", &st);
+
+    result = d_assert_standalone(
+        (rc == -1) &&
+        (errno == ENOTDIR) &&
+        (d_stat_cache_is_dir(cache, D_TEST_STAT_CACHE_ROOT "/sub/")),
+        "stat_cache_aliases_trailing",
+        "\"file/\" should fail with ENOTDIR, \"dir/\" should succeed",
+        _counter) && result;
+
+    // test 3: ".." resolves through the filesystem
+    result = d_assert_standalone(
+        (d_stat_cache_is_file(cache, D_TEST_STAT_CACHE_ROOT "/sub/../a.c")) &&
+        (!d_stat_cache_file_exists(cache,
+                                   D_TEST_STAT_CACHE_ROOT "/missing/../a.c")),
+        "stat_cache_aliases_dotdot",
+        "\"..\" should not be collapsed across a missing directory",
+        _counter) && result;
+
+    d_stat_cache_free(cache);
+
+    return result;
+}
+
+
+/*
+d_tests_sa_stat_cache_predicates
+  Tests the convenience predicates against their dfile.h counterparts.
+  Tests the following:
+  - d_stat_cache_file_exists / is_file / is_dir
+  - d_stat_cache_is_symlink and d_stat_cache_lstat on a link
+*/
+bool
+d_tests_sa_stat_cache_predicates
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                 result;
+    struct d_stat_cache* cache;
+    const char*          paths[4];
+    size_t               i;
+    bool                 same;
+
+    result   = true;
+    cache    = d_stat_cache_new(NULL);
+    paths[0] = D_TEST_STAT_CACHE_FILE;
+    paths[1] = D_TEST_STAT_CACHE_ROOT "/sub";
+    paths[2] = D_TEST_STAT_CACHE_MISSING;
+    paths[3] = D_TEST_STAT_CACHE_ROOT;
+
+    if (!cache)
+    {
+        return d_assert_standalone(false,
+                                   "stat_cache_predicates_new",
+                                   "d_stat_cache_new failed",
+                                   _counter);
+    }
+
+    // ask twice so that the second round comes from the cache
+    same = true;
+
+    for (i = 0; i < 8; i++)
+    {
+        same = same &&
+               (!d_stat_cache_file_exists(cache, paths[i % 4]) ==
+                !d_file_exists(paths[i % 4])) &&
+               (!d_stat_cache_is_file(cache, paths[i % 4]) ==
+                !d_is_file(paths[i % 4])) &&
+               (!d_stat_cache_is_dir(cache, paths[i % 4]) ==
+                !d_is_dir(paths[i % 4]));
+    }
+
+    // test 1: file predicates
+    result = d_assert_standalone(
+        same,
+        "stat_cache_predicates_match",
+        "Cached predicates should match the dfile.h functions",
+        _counter) && result;
+
+#if D_FILE_HAS_SYMLINKS
+    {
+        struct d_stat_t st;
+
+        // test 2: symlinks
+        result = d_assert_standalone(
+            (d_stat_cache_is_symlink(cache, D_TEST_STAT_CACHE_ROOT "/link")) &&
+            (!d_stat_cache_is_symlink(cache, D_TEST_STAT_CACHE_FILE)) &&
+            (d_stat_cache_is_file(cache, D_TEST_STAT_CACHE_ROOT "/link")) &&
+            (d_stat_cache_lstat(cache, D_TEST_STAT_CACHE_ROOT "/link", &st) == 0) &&
+            (S_ISLNK(st.st_mode)),
+            "stat_cache_predicates_symlink",
+            "lstat should see the link, stat its target",
+            _counter) && result;
+    }
+#endif
+
+    d_stat_cache_free(cache);
+
+    return result;
+}
+
+
+/*
+d_tests_sa_stat_cache_query_all
+  Aggregation function that runs all query tests.
+*/
+bool
+d_tests_sa_stat_cache_query_all
+(
+    struct d_test_counter* _counter
+)
+{
+    bool result;
+
+    result = true;
+
+    printf("\n  [SECTION] Queries\n");
+    printf("  -----------------\n");
+
+    result = d_tests_sa_stat_cache_passthrough(_counter) && result;
+    result = d_tests_sa_stat_cache_hits(_counter) && result;
+    result = d_tests_sa_stat_cache_negative(_counter) && result;
+    result = d_tests_sa_stat_cache_aliases(_counter) && result;
+    result = d_tests_sa_stat_cache_predicates(_counter) && result;
+
+    return result;
+}
+
+
+/*
+d_tests_sa_stat_cache_invalidate
+  Tests explicit invalidation.
+  Tests the following:
+  - without invalidation, a cached answer outlives the change
+  - d_stat_cache_invalidate refreshes one path
+  - d_stat_cache_invalidate_all refreshes every path
+*/
+bool
+d_tests_sa_stat_cache_invalidate
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                 result;
+    struct d_stat_cache* cache;
+
+    result = true;
+    cache  = d_stat_cache_new(NULL);
+
+    if (!cache)
+    {
+        return d_assert_standalone(false,
+                                   "stat_cache_invalidate_new",
+                                   "d_stat_cache_new failed",
+                                   _counter);
+    }
+
+    d_stat_cache_file_exists(cache, D_TEST_STAT_CACHE_NEW);
+    d_fwrite_all(D_TEST_STAT_CACHE_NEW, "n", 1);
+
+    // test 1: stale until invalidated
+    result = d_assert_standalone(
+        !d_stat_cache_file_exists(cache, D_TEST_STAT_CACHE_NEW),
+        "stat_cache_invalidate_stale",
+        "A cached answer should be kept until invalidated",
+        _counter) && result;
+
+    // test 2: single path
+    d_stat_cache_invalidate(cache, "./" D_TEST_STAT_CACHE_NEW);
+
+    result = d_assert_standalone(
+        d_stat_cache_file_exists(cache, D_TEST_STAT_CACHE_NEW),
+        "stat_cache_invalidate_path",
+        "d_stat_cache_invalidate should drop the normalized entry",
+        _counter) && result;
+
+    // test 3: everything
+    d_remove(D_TEST_STAT_CACHE_NEW);
+    d_stat_cache_invalidate_all(cache);
+
+    result = d_assert_standalone(
+        !d_stat_cache_file_exists(cache, D_TEST_STAT_CACHE_NEW),
+        "stat_cache_invalidate_all",
+        "d_stat_cache_invalidate_all should retire every entry",
+        _counter) && result;
+
+    d_stat_cache_free(cache);
+
+    return result;
+}
+
+
+/*
+d_tests_sa_stat_cache_ttl
+  Tests expiry by age.
+  Tests the following:
+  - an entry younger than the TTL is served from memory
+  - an entry older than the TTL is refreshed
+*/
+bool
+d_tests_sa_stat_cache_ttl
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                        result;
+    struct d_stat_cache*        cache;
+    struct d_stat_cache_options options;
+
+    result = true;
+
+    d_memset(&options, 0, sizeof(options));
+    options.ttl_ns = 50ULL * 1000 * 1000;
+    cache          = d_stat_cache_new(&options);
+
+    if (!cache)
+    {
+        return d_assert_standalone(false,
+                                   "stat_cache_ttl_new",
+                                   "d_stat_cache_new failed",
+                                   _counter);
+    }
+
+    d_stat_cache_file_exists(cache, D_TEST_STAT_CACHE_NEW);
+    d_fwrite_all(D_TEST_STAT_CACHE_NEW, "n", 1);
+
+    // test 1: still fresh
+    result = d_assert_standalone(
+        !d_stat_cache_file_exists(cache, D_TEST_STAT_CACHE_NEW),
+        "stat_cache_ttl_fresh",
+        "An entry within its TTL should be served from memory",
+        _counter) && result;
+
+    d_sleep_ms(80);
+
+    // test 2: expired
+    result = d_assert_standalone(
+        d_stat_cache_file_exists(cache, D_TEST_STAT_CACHE_NEW),
+        "stat_cache_ttl_expired",
+        "An entry past its TTL should be refreshed",
+        _counter) && result;
+
+    d_remove(D_TEST_STAT_CACHE_NEW);
+    d_stat_cache_free(cache);
+
+    return result;
+}
+
+
+/*
+d_tests_sa_stat_cache_limit
+  Tests the entry limit.
+  Tests the following:
+  - the cache never holds more than max_entries paths
+*/
+bool
+d_tests_sa_stat_cache_limit
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                        result;
+    struct d_stat_cache*        cache;
+    struct d_stat_cache_options options;
+    struct d_stat_cache_stats   stats;
+    char                        path[64];
+    size_t                      largest;
+    int                         i;
+
+    result = true;
+
+    d_memset(&options, 0, sizeof(options));
+    options.max_entries = 4;
+    cache               = d_stat_cache_new(&options);
+
+    if (!cache)
+    {
+        return d_assert_standalone(false,
+                                   "stat_cache_limit_new",
+                                   "d_stat_cache_new failed",
+                                   _counter);
+    }
+
+    largest = 0;
+
+    for (i = 0; i < 20; i++)
+    {
+        snprintf(path, sizeof(path), D_TEST_STAT_CACHE_ROOT "/none%d", i);
+        d_stat_cache_file_exists(cache, path);
+        stats = d_test_stat_cache_stats(cache);
+
+        if (stats.entries > largest)
+        {
+            largest = stats.entries;
+        }
+    }
+
+    // test 1: bounded
+    result = d_assert_standalone(
+        (largest == 4) &&
+        (stats.misses == 20),
+        "stat_cache_limit_bounded",
+        "The cache should stay within max_entries",
+        _counter) && result;
+
+    d_stat_cache_free(cache);
+
+    return result;
+}
+
+
+/*
+d_tests_sa_stat_cache_watch
+  Tests inotify-driven invalidation (skipped where watching is unavailable).
+  Tests the following:
+  - creating and removing a file invalidates its cached answer
+  - renaming a directory invalidates paths below it
+*/
+bool
+d_tests_sa_stat_cache_watch
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                        result;
+    struct d_stat_cache*        cache;
+    struct d_stat_cache_options options;
+    struct d_stat_cache_stats   stats;
+
+    result = true;
+
+    d_memset(&options, 0, sizeof(options));
+    options.flags = D_STAT_CACHE_WATCH;
+    cache         = d_stat_cache_new(&options);
+
+    if (!cache)
+    {
+        return d_assert_standalone(false,
+                                   "stat_cache_watch_new",
+                                   "d_stat_cache_new failed",
+                                   _counter);
+    }
+
+    if (!d_stat_cache_is_watching(cache))
+    {
+        printf("    (file watching unavailable; skipped)\n");
+        d_stat_cache_free(cache);
+
+        return result;
+    }
+
+    // test 1: creation
+    d_stat_cache_file_exists(cache, D_TEST_STAT_CACHE_NEW);
+    d_fwrite_all(D_TEST_STAT_CACHE_NEW, "n", 1);
+
+    result = d_assert_standalone(
+        d_test_stat_cache_wait_exists(cache, D_TEST_STAT_CACHE_NEW, 1),
+        "stat_cache_watch_create",
+        "Creating a file should invalidate its negative entry",
+        _counter) && result;
+
+    // test 2: removal
+    d_remove(D_TEST_STAT_CACHE_NEW);
+
+    result = d_assert_standalone(
+        d_test_stat_cache_wait_exists(cache, D_TEST_STAT_CACHE_NEW, 0),
+        "stat_cache_watch_remove",
+        "Removing a file should invalidate its entry",
+        _counter) && result;
+
+    // test 3: renaming a directory above a cached path
+    d_stat_cache_file_exists(cache, D_TEST_STAT_CACHE_ROOT "/sub/b.h");
+    d_rename(D_TEST_STAT_CACHE_ROOT "/sub", D_TEST_STAT_CACHE_ROOT "/moved", 0);
+
+    result = d_assert_standalone(
+        d_test_stat_cache_wait_exists(cache,
+                                      D_TEST_STAT_CACHE_ROOT "/sub/b.h",
+                                      0),
+        "stat_cache_watch_rename",
+        "Renaming a directory should invalidate paths below it",
+        _counter) && result;
+
+    d_rename(D_TEST_STAT_CACHE_ROOT "/moved", D_TEST_STAT_CACHE_ROOT "/sub", 0);
+    stats = d_test_stat_cache_stats(cache);
+
+    // test 4: directories are watched
+    result = d_assert_standalone(
+        stats.watches >= 2,
+        "stat_cache_watch_count",
+        "The directories of cached paths should be watched",
+        _counter) && result;
+
+    d_stat_cache_free(cache);
+
+    return result;
+}
+
+
+/*
+d_tests_sa_stat_cache_invalidation_all
+  Aggregation function that runs all invalidation tests.
+*/
+bool
+d_tests_sa_stat_cache_invalidation_all
+(
+    struct d_test_counter* _counter
+)
+{
+    bool result;
+
+    result = true;
+
+    printf("\n  [SECTION] Invalidation\n");
+    printf("  ----------------------\n");
+
+    result = d_tests_sa_stat_cache_invalidate(_counter) && result;
+    result = d_tests_sa_stat_cache_ttl(_counter) && result;
+    result = d_tests_sa_stat_cache_limit(_counter) && result;
+    result = d_tests_sa_stat_cache_watch(_counter) && result;
+
+    return result;
+}
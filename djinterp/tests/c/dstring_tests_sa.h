@@ -211,6 +211,7 @@ struct d_test_object* d_tests_sa_dstring_append_cstr(void);
 struct d_test_object* d_tests_sa_dstring_append_buffer(void);
 struct d_test_object* d_tests_sa_dstring_append_char(void);
 struct d_test_object* d_tests_sa_dstring_append_formatted(void);
+struct d_test_object* d_tests_sa_dstring_append_typed(void);
 struct d_test_object* d_tests_sa_dstring_prepend(void);
 struct d_test_object* d_tests_sa_dstring_prepend_cstr(void);
 struct d_test_object* d_tests_sa_dstring_prepend_char(void);
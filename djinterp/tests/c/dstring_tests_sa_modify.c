@@ -1050,6 +1050,107 @@ d_tests_sa_dstring_append_formatted
     return group;
 }
 
+/*
+d_tests_sa_dstring_append_typed
+  Tests d_string_append_int, d_string_append_uint, d_string_append_hex and
+d_string_append_double.
+  Tests the following:
+  - a sequence of typed appends builds the expected text
+  - growth from an empty string keeps the text null-terminated
+  - NULL destination handling
+*/
+struct d_test_object*
+d_tests_sa_dstring_append_typed
+(
+    void
+)
+{
+    struct d_test_object* group;
+    struct d_string*      dest;
+    bool                  result;
+    size_t                idx;
+    int                   i;
+
+    group = d_test_object_new_interior("d_string_append_typed", 3);
+
+    if (!group)
+    {
+        return NULL;
+    }
+
+    idx = 0;
+
+    // test: mixed typed appends
+    dest = d_string_new_from_cstr("v=");
+
+    if (dest)
+    {
+        result = d_string_append_int(dest, -42)       &&
+                 d_string_append_char(dest, ' ')      &&
+                 d_string_append_uint(dest, 18446744073709551615ULL) &&
+                 d_string_append_char(dest, ' ')      &&
+                 d_string_append_hex(dest, 0xBEEF)    &&
+                 d_string_append_char(dest, ' ')      &&
+                 d_string_append_double(dest, 0.1);
+        group->elements[idx++] = D_ASSERT_TRUE(
+            "append_typed_mixed",
+            result && d_string_equals_cstr(dest,
+                          "v=-42 18446744073709551615 beef 0.1"),
+            "should append each value's text");
+
+        d_string_free(dest);
+    }
+    else
+    {
+        group->elements[idx++] = D_ASSERT_TRUE(
+            "append_typed_mixed",
+            false,
+            "failed to allocate test string");
+    }
+
+    // test: repeated appends grow an empty string
+    dest = d_string_new();
+
+    if (dest)
+    {
+        result = true;
+
+        for (i = 0; i < 100; i++)
+        {
+            result = d_string_append_uint(dest, 1234567890) && result;
+        }
+
+        group->elements[idx++] = D_ASSERT_TRUE(
+            "append_typed_growth",
+            result                              &&
+            (d_string_length(dest) == 1000)     &&
+            (dest->text[dest->size] == '\0')    &&
+            d_string_starts_with_cstr(dest, "12345678901234567890"),
+            "should grow and stay null-terminated");
+
+        d_string_free(dest);
+    }
+    else
+    {
+        group->elements[idx++] = D_ASSERT_TRUE(
+            "append_typed_growth",
+            false,
+            "failed to allocate test string");
+    }
+
+    // test: NULL destination handling
+    result = d_string_append_int(NULL, 1)    ||
+             d_string_append_uint(NULL, 1)   ||
+             d_string_append_hex(NULL, 1)    ||
+             d_string_append_double(NULL, 1.0);
+    group->elements[idx++] = D_ASSERT_FALSE(
+        "append_typed_null_dest",
+        result,
+        "should return false for NULL destination");
+
+    return group;
+}
+
 
 /******************************************************************************
  * III. PREPEND TESTS
@@ -2734,7 +2835,7 @@ d_tests_sa_dstring_modify_all
   Tests the following:
   - assignment functions (assign, assign_cstr, assign_buffer, assign_char)
   - append functions (append, append_cstr, append_buffer, append_char, 
-    append_formatted)
+    append_formatted, typed appends)
   - prepend functions (prepend, prepend_cstr, prepend_char)
   - insert functions (insert, insert_cstr, insert_char)
   - erase functions (erase, erase_char, clear)
@@ -2750,7 +2851,7 @@ d_tests_sa_dstring_modify_all
     struct d_test_object* group;
     size_t                idx;
 
-    group = d_test_object_new_interior("Modification Functions", 23);
+    group = d_test_object_new_interior("Modification Functions", 24);
 
     if (!group)
     {
@@ -2771,6 +2872,7 @@ d_tests_sa_dstring_modify_all
     group->elements[idx++] = d_tests_sa_dstring_append_buffer();
     group->elements[idx++] = d_tests_sa_dstring_append_char();
     group->elements[idx++] = d_tests_sa_dstring_append_formatted();
+    group->elements[idx++] = d_tests_sa_dstring_append_typed();
 
     // III. prepend tests
     group->elements[idx++] = d_tests_sa_dstring_prepend();
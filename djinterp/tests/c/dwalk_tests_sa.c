@@ -0,0 +1,26 @@
+#include ".\dwalk_tests_sa.h"
+
+
+/*
+d_tests_sa_dwalk_run_all
+  Module-level aggregation function that runs all dwalk tests.
+  Executes tests for all categories:
+  - Pattern matching
+  - Directory walks
+*/
+bool
+d_tests_sa_dwalk_run_all
+(
+    struct d_test_counter* _counter
+)
+{
+    bool result;
+
+    result = true;
+
+    // run all test categories
+    result = d_tests_sa_dir_walk_glob_all(_counter) && result;
+    result = d_tests_sa_dir_walk_all(_counter) && result;
+
+    return result;
+}
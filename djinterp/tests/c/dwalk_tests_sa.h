@@ -0,0 +1,66 @@
+/******************************************************************************
+* djinterp [test]                                             dwalk_tests_sa.h
+*
+*   Unit test declarations for `dwalk.h` module.
+*   Covers glob pattern matching and directory walks over a scratch tree:
+* visitor and collect modes, serial and parallel traversal, filters, depth
+* limits, early stop, and error reporting.
+*
+*
+* path:      \tests\dwalk_tests_sa.h
+* link:      TBA
+* author(s): Samuel 'teer' Neal-Blim                          date: 2026.10.18
+******************************************************************************/
+
+#ifndef DJINTERP_TESTS_DWALK_STANDALONE_
+#define DJINTERP_TESTS_DWALK_STANDALONE_ 1
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "..\..\inc\c\test\test_standalone.h"
+#include "..\..\inc\c\dwalk.h"
+#include "..\..\inc\c\dfile.h"
+#include "..\..\inc\c\dmutex.h"
+#include "..\..\inc\c\string_fn.h"
+
+
+// D_TEST_DWALK_ROOT
+//   constant: scratch tree built (and removed) by the walk tests.
+#define D_TEST_DWALK_ROOT "dwalk_test_tmp"
+
+
+/******************************************************************************
+ * I. PATTERN MATCHING TESTS
+ *****************************************************************************/
+bool d_tests_sa_dir_walk_glob_literal(struct d_test_counter* _counter);
+bool d_tests_sa_dir_walk_glob_wildcards(struct d_test_counter* _counter);
+bool d_tests_sa_dir_walk_glob_classes(struct d_test_counter* _counter);
+
+// I. aggregation function
+bool d_tests_sa_dir_walk_glob_all(struct d_test_counter* _counter);
+
+
+/******************************************************************************
+ * II. WALK TESTS
+ *****************************************************************************/
+bool d_tests_sa_dir_walk_visit(struct d_test_counter* _counter);
+bool d_tests_sa_dir_walk_collect(struct d_test_counter* _counter);
+bool d_tests_sa_dir_walk_parallel(struct d_test_counter* _counter);
+bool d_tests_sa_dir_walk_filters(struct d_test_counter* _counter);
+bool d_tests_sa_dir_walk_depth(struct d_test_counter* _counter);
+bool d_tests_sa_dir_walk_control(struct d_test_counter* _counter);
+bool d_tests_sa_dir_walk_errors(struct d_test_counter* _counter);
+
+// II. aggregation function
+bool d_tests_sa_dir_walk_all(struct d_test_counter* _counter);
+
+
+/******************************************************************************
+ * MODULE-LEVEL AGGREGATION
+ *****************************************************************************/
+bool d_tests_sa_dwalk_run_all(struct d_test_counter* _counter);
+
+
+#endif  // DJINTERP_TESTS_DWALK_STANDALONE_
@@ -0,0 +1,177 @@
+#include ".\dwalk_tests_sa.h"
+
+
+/*
+d_tests_sa_dir_walk_glob_literal
+  Tests d_dir_walk_glob_match with patterns that contain no wildcards.
+  Tests the following:
+  - identical strings match
+  - prefixes and extensions of the text do not match
+  - NULL arguments never match
+*/
+bool
+d_tests_sa_dir_walk_glob_literal
+(
+    struct d_test_counter* _counter
+)
+{
+    bool result;
+
+    result = true;
+
+    // test 1: exact match
+    result = d_assert_standalone(
+        d_dir_walk_glob_match("main.c", "main.c") &&
+        d_dir_walk_glob_match("", ""),
+        "glob_literal_exact",
+        "Identical strings should match",
+        _counter) && result;
+
+    // test 2: partial strings
+    result = d_assert_standalone(
+        (!d_dir_walk_glob_match("main.c", "main.cpp")) &&
+        (!d_dir_walk_glob_match("main.cpp", "main.c")) &&
+        (!d_dir_walk_glob_match("main", "")),
+        "glob_literal_partial",
+        "A pattern must match the whole text",
+        _counter) && result;
+
+    // test 3: NULL
+    result = d_assert_standalone(
+        (!d_dir_walk_glob_match(NULL, "x")) &&
+        (!d_dir_walk_glob_match("x", NULL)),
+        "glob_literal_null",
+        "NULL pattern or text should not match",
+        _counter) && result;
+
+    return result;
+}
+
+
+/*
+d_tests_sa_dir_walk_glob_wildcards
+  Tests the `*`, `**` and `?` wildcards.
+  Tests the following:
+  - `*` matches within one component only
+  - `**` crosses directory separators, and `**` followed by a slash also
+    matches zero directories
+  - `?` matches exactly one non-separator character
+*/
+bool
+d_tests_sa_dir_walk_glob_wildcards
+(
+    struct d_test_counter* _counter
+)
+{
+    bool result;
+
+    result = true;
+
+    // test 1: single star
+    result = d_assert_standalone(
+        d_dir_walk_glob_match("*.c", "main.c")      &&
+        d_dir_walk_glob_match("*", "")              &&
+        d_dir_walk_glob_match("a*b*c", "axxbyyc")   &&
+        (!d_dir_walk_glob_match("*.c", "src/main.c")) &&
+        (!d_dir_walk_glob_match("*.c", "main.h")),
+        "glob_star",
+        "'*' should match any run of characters except '/'",
+        _counter) && result;
+
+    // test 2: double star
+    result = d_assert_standalone(
+        d_dir_walk_glob_match("src/**/*.c", "src/a/b/main.c") &&
+        d_dir_walk_glob_match("src/**/*.c", "src/main.c")     &&
+        d_dir_walk_glob_match("**", "a/b/c")                  &&
+        d_dir_walk_glob_match("build/**", "build/obj/x.o")    &&
+        (!d_dir_walk_glob_match("src/**/*.c", "lib/main.c")),
+        "glob_double_star",
+        "'**' should match across '/' including zero directories",
+        _counter) && result;
+
+    // test 3: question mark
+    result = d_assert_standalone(
+        d_dir_walk_glob_match("file?.txt", "file1.txt")    &&
+        (!d_dir_walk_glob_match("file?.txt", "file.txt"))  &&
+        (!d_dir_walk_glob_match("a?b", "a/b")),
+        "glob_question",
+        "'?' should match one character other than '/'",
+        _counter) && result;
+
+    return result;
+}
+
+
+/*
+d_tests_sa_dir_walk_glob_classes
+  Tests bracket expressions.
+  Tests the following:
+  - sets and ranges match their members
+  - `!` and `^` negate the class
+  - an unterminated '[' is treated literally
+*/
+bool
+d_tests_sa_dir_walk_glob_classes
+(
+    struct d_test_counter* _counter
+)
+{
+    bool result;
+
+    result = true;
+
+    // test 1: sets and ranges
+    result = d_assert_standalone(
+        d_dir_walk_glob_match("*.[ch]", "x.c")       &&
+        d_dir_walk_glob_match("*.[ch]", "x.h")       &&
+        d_dir_walk_glob_match("v[0-9]", "v7")        &&
+        (!d_dir_walk_glob_match("*.[ch]", "x.o"))    &&
+        (!d_dir_walk_glob_match("v[0-9]", "vx")),
+        "glob_class_members",
+        "Sets and ranges should match their members only",
+        _counter) && result;
+
+    // test 2: negation
+    result = d_assert_standalone(
+        d_dir_walk_glob_match("[!a]x", "bx")   &&
+        d_dir_walk_glob_match("[^a]x", "bx")   &&
+        (!d_dir_walk_glob_match("[!a]x", "ax")),
+        "glob_class_negated",
+        "'!' and '^' should negate a class",
+        _counter) && result;
+
+    // test 3: unterminated
+    result = d_assert_standalone(
+        d_dir_walk_glob_match("a[b", "a[b") &&
+        (!d_dir_walk_glob_match("a[b", "ab")),
+        "glob_class_unterminated",
+        "An unterminated '[' should match literally",
+        _counter) && result;
+
+    return result;
+}
+
+
+/*
+d_tests_sa_dir_walk_glob_all
+  Aggregation function that runs all pattern matching tests.
+*/
+bool
+d_tests_sa_dir_walk_glob_all
+(
+    struct d_test_counter* _counter
+)
+{
+    bool result;
+
+    result = true;
+
+    printf("\n  [SECTION] Pattern Matching\n");
+    printf("  --------------------------\n");
+
+    result = d_tests_sa_dir_walk_glob_literal(_counter) && result;
+    result = d_tests_sa_dir_walk_glob_wildcards(_counter) && result;
+    result = d_tests_sa_dir_walk_glob_classes(_counter) && result;
+
+    return result;
+}
@@ -0,0 +1,715 @@
+#include ".\dwalk_tests_sa.h"
+
+
+///////////////////////////////////////////////////////////////////////////////
+// file-scope helpers
+///////////////////////////////////////////////////////////////////////////////
+
+// the scratch tree: 6 directories and 10 files, four levels deep
+#define D_TEST_DWALK_DIRS  6
+#define D_TEST_DWALK_FILES 10
+#define D_TEST_DWALK_TOTAL (D_TEST_DWALK_DIRS + D_TEST_DWALK_FILES)
+
+static const char* d_test_dwalk_dirs[] =
+{
+    D_TEST_DWALK_ROOT "/src/deep/deeper",
+    D_TEST_DWALK_ROOT "/build/obj",
+    D_TEST_DWALK_ROOT "/docs"
+};
+
+static const char* d_test_dwalk_files[] =
+{
+    D_TEST_DWALK_ROOT "/a.c",
+    D_TEST_DWALK_ROOT "/b.h",
+    D_TEST_DWALK_ROOT "/.hidden",
+    D_TEST_DWALK_ROOT "/src/x.c",
+    D_TEST_DWALK_ROOT "/src/y.txt",
+    D_TEST_DWALK_ROOT "/src/deep/z.c",
+    D_TEST_DWALK_ROOT "/src/deep/deeper/w.c",
+    D_TEST_DWALK_ROOT "/build/out.o",
+    D_TEST_DWALK_ROOT "/build/obj/m.o",
+    D_TEST_DWALK_ROOT "/docs/readme.md"
+};
+
+// tally shared by concurrent visitor calls
+struct d_test_dwalk_tally
+{
+    d_mutex_t   lock;
+    size_t      files;
+    size_t      dirs;
+    size_t      max_depth;
+    size_t      stop_after;     // 0 = never stop
+    const char* skip_name;      // directory name to return D_DIR_WALK_SKIP for
+    bool        relative_ok;    // every `relative` was a suffix of `path`
+};
+
+// helper: visitor that counts entries
+static int
+d_test_dwalk_count
+(
+    const struct d_dir_walk_entry* _entry,
+    void*                          _user_data
+)
+{
+    struct d_test_dwalk_tally* tally;
+    int                        verdict;
+    size_t                     seen;
+
+    tally   = (struct d_test_dwalk_tally*)_user_data;
+    verdict = D_DIR_WALK_CONTINUE;
+
+    d_mutex_lock(&tally->lock);
+
+    if (_entry->type == DT_DIR)
+    {
+        tally->dirs++;
+    }
+    else
+    {
+        tally->files++;
+    }
+
+    if (_entry->depth > tally->max_depth)
+    {
+        tally->max_depth = _entry->depth;
+    }
+
+    if ( (_entry->path_len != strlen(_entry->path)) ||
+         (strcmp(_entry->path + (_entry->path_len - strlen(_entry->relative)),
+                 _entry->relative) != 0) )
+    {
+        tally->relative_ok = false;
+    }
+
+    seen = tally->files + tally->dirs;
+    d_mutex_unlock(&tally->lock);
+
+    if ( (tally->stop_after) &&
+         (seen >= tally->stop_after) )
+    {
+        verdict = D_DIR_WALK_STOP;
+    }
+    else if ( (tally->skip_name) &&
+              (_entry->type == DT_DIR) &&
+              (strcmp(_entry->name, tally->skip_name) == 0) )
+    {
+        verdict = D_DIR_WALK_SKIP;
+    }
+
+    return verdict;
+}
+
+// helper: resets a tally
+static void
+d_test_dwalk_tally_reset
+(
+    struct d_test_dwalk_tally* _tally
+)
+{
+    _tally->files       = 0;
+    _tally->dirs        = 0;
+    _tally->max_depth   = 0;
+    _tally->stop_after  = 0;
+    _tally->skip_name   = NULL;
+    _tally->relative_ok = true;
+
+    return;
+}
+
+// helper: number of entries a collect with `_options` reports
+static size_t
+d_test_dwalk_collect_count
+(
+    const struct d_dir_walk_options* _options
+)
+{
+    struct d_dir_walk_result walked;
+    size_t                   count;
+
+    if (d_dir_walk_collect(D_TEST_DWALK_ROOT, _options, &walked) != 0)
+    {
+        return (size_t)-1;
+    }
+
+    count = walked.count;
+    d_dir_walk_result_free(&walked);
+
+    return count;
+}
+
+// helper: builds the scratch tree
+static bool
+d_test_dwalk_setup
+(
+    void
+)
+{
+    FILE*  file;
+    size_t i;
+
+    for (i = 0; i < (sizeof(d_test_dwalk_dirs) / sizeof(d_test_dwalk_dirs[0])); i++)
+    {
+        if (d_mkdir_p(d_test_dwalk_dirs[i], 0755) != 0)
+        {
+            return false;
+        }
+    }
+
+    for (i = 0; i < (sizeof(d_test_dwalk_files) / sizeof(d_test_dwalk_files[0])); i++)
+    {
+        file = fopen(d_test_dwalk_files[i], "w");
+        if (!file)
+        {
+            return false;
+        }
+
+        fputs("x", file);
+        fclose(file);
+    }
+
+    return true;
+}
+
+// helper: removes the scratch tree (deepest entries first)
+static void
+d_test_dwalk_teardown
+(
+    void
+)
+{
+    struct d_dir_walk_options options;
+    struct d_dir_walk_result  walked;
+    size_t                    i;
+
+    d_memset(&options, 0, sizeof(options));
+    options.threads = 1;
+    options.flags   = D_DIR_WALK_SORT;
+
+    if (d_dir_walk_collect(D_TEST_DWALK_ROOT, &options, &walked) == 0)
+    {
+        // reverse path order puts children before their parents
+        for (i = walked.count; i > 0; i--)
+        {
+            if (walked.items[i - 1].type == DT_DIR)
+            {
+                d_rmdir(walked.items[i - 1].path);
+            }
+            else
+            {
+                d_remove(walked.items[i - 1].path);
+            }
+        }
+
+        d_dir_walk_result_free(&walked);
+    }
+
+    d_rmdir(D_TEST_DWALK_ROOT);
+
+    return;
+}
+
+
+///////////////////////////////////////////////////////////////////////////////
+// test functions
+///////////////////////////////////////////////////////////////////////////////
+
+
+/*
+d_tests_sa_dir_walk_visit
+  Tests d_dir_walk on a single thread.
+  Tests the following:
+  - every file and directory is visited exactly once
+  - depth counts from 1 at the root's children
+  - `relative` and `path_len` agree with `path`
+*/
+bool
+d_tests_sa_dir_walk_visit
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                      result;
+    struct d_dir_walk_options options;
+    struct d_test_dwalk_tally tally;
+    int                       rc;
+
+    result = true;
+
+    d_memset(&options, 0, sizeof(options));
+    options.threads = 1;
+
+    d_mutex_init(&tally.lock);
+    d_test_dwalk_tally_reset(&tally);
+
+    rc = d_dir_walk(D_TEST_DWALK_ROOT, &options, d_test_dwalk_count, &tally);
+
+    // test 1: completed
+    result = d_assert_standalone(
+        rc == 0,
+        "dir_walk_visit_status",
+        "d_dir_walk should return 0 when the walk completes",
+        _counter) && result;
+
+    // test 2: counts
+    result = d_assert_standalone(
+        (tally.files == D_TEST_DWALK_FILES) &&
+        (tally.dirs == D_TEST_DWALK_DIRS),
+        "dir_walk_visit_counts",
+        "Every file and directory should be visited once",
+        _counter) && result;
+
+    // test 3: depth
+    result = d_assert_standalone(
+        tally.max_depth == 4,
+        "dir_walk_visit_depth",
+        "The deepest file should be reported at depth 4",
+        _counter) && result;
+
+    // test 4: entry strings
+    result = d_assert_standalone(
+        tally.relative_ok,
+        "dir_walk_visit_strings",
+        "relative and path_len should be consistent with path",
+        _counter) && result;
+
+    d_mutex_destroy(&tally.lock);
+
+    return result;
+}
+
+
+/*
+d_tests_sa_dir_walk_collect
+  Tests d_dir_walk_collect.
+  Tests the following:
+  - the result holds every entry
+  - D_DIR_WALK_SORT orders items by path
+  - item types are resolved
+  - freeing resets the result
+*/
+bool
+d_tests_sa_dir_walk_collect
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                      result;
+    struct d_dir_walk_options options;
+    struct d_dir_walk_result  walked;
+    bool                      sorted;
+    size_t                    dirs;
+    size_t                    i;
+    int                       rc;
+
+    result = true;
+
+    d_memset(&options, 0, sizeof(options));
+    options.flags = D_DIR_WALK_SORT;
+
+    rc = d_dir_walk_collect(D_TEST_DWALK_ROOT, &options, &walked);
+
+    // test 1: all entries
+    result = d_assert_standalone(
+        (rc == 0) &&
+        (walked.count == D_TEST_DWALK_TOTAL) &&
+        (walked.errors == 0),
+        "dir_walk_collect_count",
+        "Collect should gather every entry without errors",
+        _counter) && result;
+
+    if (rc == 0)
+    {
+        sorted = true;
+        dirs   = 0;
+
+        for (i = 0; i < walked.count; i++)
+        {
+            if ( (i > 0) &&
+                 (strcmp(walked.items[i - 1].path, walked.items[i].path) >= 0) )
+            {
+                sorted = false;
+            }
+
+            if (walked.items[i].type == DT_DIR)
+            {
+                dirs++;
+            }
+        }
+
+        // test 2: sorted
+        result = d_assert_standalone(
+            sorted &&
+            (strcmp(walked.items[0].path, D_TEST_DWALK_ROOT "/.hidden") == 0),
+            "dir_walk_collect_sorted",
+            "D_DIR_WALK_SORT should order items by path",
+            _counter) && result;
+
+        // test 3: types
+        result = d_assert_standalone(
+            dirs == D_TEST_DWALK_DIRS,
+            "dir_walk_collect_types",
+            "Collected items should carry their directory type",
+            _counter) && result;
+    }
+
+    // test 4: free
+    d_dir_walk_result_free(&walked);
+    result = d_assert_standalone(
+        (walked.items == NULL) &&
+        (walked.count == 0),
+        "dir_walk_collect_free",
+        "d_dir_walk_result_free should reset the result",
+        _counter) && result;
+
+    return result;
+}
+
+
+/*
+d_tests_sa_dir_walk_parallel
+  Tests multi-threaded walks.
+  Tests the following:
+  - a 4-thread visitor walk sees every entry once
+  - a 4-thread collect matches the serial collect path for path
+*/
+bool
+d_tests_sa_dir_walk_parallel
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                      result;
+    struct d_dir_walk_options options;
+    struct d_test_dwalk_tally tally;
+    struct d_dir_walk_result  serial;
+    struct d_dir_walk_result  parallel;
+    bool                      same;
+    size_t                    i;
+
+    result = true;
+
+    d_memset(&options, 0, sizeof(options));
+    options.threads = 4;
+
+    d_mutex_init(&tally.lock);
+    d_test_dwalk_tally_reset(&tally);
+
+    // test 1: visitor
+    d_dir_walk(D_TEST_DWALK_ROOT, &options, d_test_dwalk_count, &tally);
+    result = d_assert_standalone(
+        (tally.files == D_TEST_DWALK_FILES) &&
+        (tally.dirs == D_TEST_DWALK_DIRS),
+        "dir_walk_parallel_visit",
+        "A parallel walk should visit every entry once",
+        _counter) && result;
+
+    d_mutex_destroy(&tally.lock);
+
+    // test 2: same result as serial
+    options.flags   = D_DIR_WALK_SORT;
+    options.threads = 1;
+    d_dir_walk_collect(D_TEST_DWALK_ROOT, &options, &serial);
+
+    options.threads = 4;
+    d_dir_walk_collect(D_TEST_DWALK_ROOT, &options, &parallel);
+
+    same = (serial.count == parallel.count);
+
+    for (i = 0; ( (same) && (i < serial.count) ); i++)
+    {
+        same = (strcmp(serial.items[i].path, parallel.items[i].path) == 0) &&
+               (serial.items[i].depth == parallel.items[i].depth);
+    }
+
+    result = d_assert_standalone(
+        same && (serial.count == D_TEST_DWALK_TOTAL),
+        "dir_walk_parallel_collect",
+        "Parallel and serial collects should find the same entries",
+        _counter) && result;
+
+    d_dir_walk_result_free(&serial);
+    d_dir_walk_result_free(&parallel);
+
+    return result;
+}
+
+
+/*
+d_tests_sa_dir_walk_filters
+  Tests include/exclude patterns and reporting flags.
+  Tests the following:
+  - an excluded directory is pruned with its contents
+  - a name pattern selects files anywhere in the tree
+  - a path pattern with `**` selects files below one directory
+  - D_DIR_WALK_SKIP_HIDDEN drops dot-files
+  - D_DIR_WALK_NO_FILES reports only directories
+*/
+bool
+d_tests_sa_dir_walk_filters
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                      result;
+    struct d_dir_walk_options options;
+    const char*               exclude[1];
+    const char*               include[1];
+
+    result = true;
+
+    // test 1: exclude prunes
+    d_memset(&options, 0, sizeof(options));
+    exclude[0]            = "build";
+    options.exclude       = exclude;
+    options.exclude_count = 1;
+
+    result = d_assert_standalone(
+        d_test_dwalk_collect_count(&options) == (D_TEST_DWALK_TOTAL - 4),
+        "dir_walk_filter_exclude",
+        "Excluding a directory should prune it and its contents",
+        _counter) && result;
+
+    // test 2: include by name
+    d_memset(&options, 0, sizeof(options));
+    include[0]            = "*.c";
+    options.include       = include;
+    options.include_count = 1;
+    options.flags         = D_DIR_WALK_NO_DIRS;
+
+    result = d_assert_standalone(
+        d_test_dwalk_collect_count(&options) == 4,
+        "dir_walk_filter_include_name",
+        "'*.c' should select the four C files at any depth",
+        _counter) && result;
+
+    // test 3: include by path
+    include[0] = "src/**/*.c";
+
+    result = d_assert_standalone(
+        d_test_dwalk_collect_count(&options) == 3,
+        "dir_walk_filter_include_path",
+        "'src/**/*.c' should select only the C files under src",
+        _counter) && result;
+
+    // test 4: hidden
+    d_memset(&options, 0, sizeof(options));
+    options.flags = D_DIR_WALK_SKIP_HIDDEN;
+
+    result = d_assert_standalone(
+        d_test_dwalk_collect_count(&options) == (D_TEST_DWALK_TOTAL - 1),
+        "dir_walk_filter_hidden",
+        "D_DIR_WALK_SKIP_HIDDEN should drop dot-files",
+        _counter) && result;
+
+    // test 5: directories only
+    options.flags = D_DIR_WALK_NO_FILES;
+
+    result = d_assert_standalone(
+        d_test_dwalk_collect_count(&options) == D_TEST_DWALK_DIRS,
+        "dir_walk_filter_no_files",
+        "D_DIR_WALK_NO_FILES should report only directories",
+        _counter) && result;
+
+    return result;
+}
+
+
+/*
+d_tests_sa_dir_walk_depth
+  Tests max_depth.
+  Tests the following:
+  - max_depth 1 reports only the root's children
+  - max_depth 2 adds their children and no more
+*/
+bool
+d_tests_sa_dir_walk_depth
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                      result;
+    struct d_dir_walk_options options;
+
+    result = true;
+
+    d_memset(&options, 0, sizeof(options));
+
+    // test 1: depth 1
+    options.max_depth = 1;
+    result = d_assert_standalone(
+        d_test_dwalk_collect_count(&options) == 6,
+        "dir_walk_depth_1",
+        "max_depth 1 should report the six entries of the root",
+        _counter) && result;
+
+    // test 2: depth 2
+    options.max_depth = 2;
+    result = d_assert_standalone(
+        d_test_dwalk_collect_count(&options) == 12,
+        "dir_walk_depth_2",
+        "max_depth 2 should report twelve entries",
+        _counter) && result;
+
+    return result;
+}
+
+
+/*
+d_tests_sa_dir_walk_control
+  Tests visitor control codes.
+  Tests the following:
+  - D_DIR_WALK_SKIP on a directory prunes its subtree
+  - D_DIR_WALK_STOP ends the walk and is returned by d_dir_walk
+*/
+bool
+d_tests_sa_dir_walk_control
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                      result;
+    struct d_dir_walk_options options;
+    struct d_test_dwalk_tally tally;
+    int                       rc;
+
+    result = true;
+
+    d_memset(&options, 0, sizeof(options));
+    options.threads = 1;
+
+    d_mutex_init(&tally.lock);
+
+    // test 1: skip
+    d_test_dwalk_tally_reset(&tally);
+    tally.skip_name = "src";
+
+    d_dir_walk(D_TEST_DWALK_ROOT, &options, d_test_dwalk_count, &tally);
+    result = d_assert_standalone(
+        (tally.files + tally.dirs) == (D_TEST_DWALK_TOTAL - 6),
+        "dir_walk_control_skip",
+        "Skipping src should prune its six descendants",
+        _counter) && result;
+
+    // test 2: stop
+    d_test_dwalk_tally_reset(&tally);
+    tally.stop_after = 1;
+
+    rc     = d_dir_walk(D_TEST_DWALK_ROOT, &options, d_test_dwalk_count, &tally);
+    result = d_assert_standalone(
+        (rc == D_DIR_WALK_STOP) &&
+        ((tally.files + tally.dirs) == 1),
+        "dir_walk_control_stop",
+        "D_DIR_WALK_STOP should end the walk and be returned",
+        _counter) && result;
+
+    // test 3: stop in a parallel walk
+    d_test_dwalk_tally_reset(&tally);
+    tally.stop_after = 3;
+    options.threads  = 4;
+
+    rc     = d_dir_walk(D_TEST_DWALK_ROOT, &options, d_test_dwalk_count, &tally);
+    result = d_assert_standalone(
+        (rc == D_DIR_WALK_STOP) &&
+        ((tally.files + tally.dirs) < D_TEST_DWALK_TOTAL),
+        "dir_walk_control_stop_parallel",
+        "A parallel walk should also stop early",
+        _counter) && result;
+
+    d_mutex_destroy(&tally.lock);
+
+    return result;
+}
+
+
+/*
+d_tests_sa_dir_walk_errors
+  Tests failure reporting.
+  Tests the following:
+  - NULL arguments fail with EINVAL
+  - a missing root fails with -1
+  - a root that is a file fails with -1
+*/
+bool
+d_tests_sa_dir_walk_errors
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                     result;
+    struct d_dir_walk_result walked;
+    int                      rc;
+
+    result = true;
+
+    // test 1: NULL
+    errno  = 0;
+    rc     = d_dir_walk(NULL, NULL, d_test_dwalk_count, NULL);
+    result = d_assert_standalone(
+        (rc == -1) && (errno == EINVAL) &&
+        (d_dir_walk(D_TEST_DWALK_ROOT, NULL, NULL, NULL) == -1) &&
+        (d_dir_walk_collect(D_TEST_DWALK_ROOT, NULL, NULL) == -1),
+        "dir_walk_error_null",
+        "NULL root, visitor or result should fail with EINVAL",
+        _counter) && result;
+
+    // test 2: missing root
+    rc     = d_dir_walk_collect(D_TEST_DWALK_ROOT "/missing", NULL, &walked);
+    result = d_assert_standalone(
+        (rc == -1) && (walked.count == 0),
+        "dir_walk_error_missing",
+        "A missing root should fail",
+        _counter) && result;
+
+    // test 3: file root
+    rc     = d_dir_walk_collect(D_TEST_DWALK_ROOT "/a.c", NULL, &walked);
+    result = d_assert_standalone(
+        rc == -1,
+        "dir_walk_error_file",
+        "A root that is not a directory should fail",
+        _counter) && result;
+
+    return result;
+}
+
+
+/*
+d_tests_sa_dir_walk_all
+  Aggregation function that runs all directory walk tests.
+*/
+bool
+d_tests_sa_dir_walk_all
+(
+    struct d_test_counter* _counter
+)
+{
+    bool result;
+
+    result = true;
+
+    printf("\n  [SECTION] Directory Walks\n");
+    printf("  -------------------------\n");
+
+    d_test_dwalk_teardown();
+
+    if (!d_test_dwalk_setup())
+    {
+        d_test_dwalk_teardown();
+
+        return d_assert_standalone(false,
+                                   "dir_walk_setup",
+                                   "Failed to build the scratch tree",
+                                   _counter);
+    }
+
+    result = d_tests_sa_dir_walk_visit(_counter) && result;
+    result = d_tests_sa_dir_walk_collect(_counter) && result;
+    result = d_tests_sa_dir_walk_parallel(_counter) && result;
+    result = d_tests_sa_dir_walk_filters(_counter) && result;
+    result = d_tests_sa_dir_walk_depth(_counter) && result;
+    result = d_tests_sa_dir_walk_control(_counter) && result;
+    result = d_tests_sa_dir_walk_errors(_counter) && result;
+
+    d_test_dwalk_teardown();
+
+    return result;
+}
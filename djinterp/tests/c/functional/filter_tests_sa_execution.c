@@ -643,6 +643,7 @@ d_tests_sa_filter_apply_combinators
   - difference produces include-but-not-exclude semantics
   - NULL combinator returns error
   - empty combinator returns appropriate result
+  - union with a positional chain keeps input order
 */
 bool
 d_tests_sa_filter_apply_combinators
@@ -655,6 +656,7 @@ d_tests_sa_filter_apply_combinators
     struct d_filter_difference*   diff;
     struct d_filter_chain*        chain_even;
     struct d_filter_chain*        chain_positive;
+    struct d_filter_chain*        chain_take;
     struct d_filter_result*       res;
     int                           input[6] = { -4, -1, 0, 3, 4, 7 };
     int*                          elems;
@@ -863,6 +865,41 @@ d_tests_sa_filter_apply_combinators
     d_filter_result_free(res);
     free(res);
 
+    // test 7: union with a positional chain (no bitset fast path)
+    // even: {-4, 0, 4}  take_first(2): {-4, -1}  union: {-4, -1, 0, 4}
+    chain_take = d_filter_chain_new();
+    u          = d_filter_union_new(2);
+
+    if ( (chain_take) &&
+         (u) )
+    {
+        d_filter_chain_add_take_first(chain_take, 2);
+        d_filter_union_add(u, chain_even);
+        d_filter_union_add(u, chain_take);
+
+        res   = d_filter_apply_union(u,
+                                     input,
+                                     6,
+                                     sizeof(int));
+        elems = (int*)res->elements;
+
+        result = d_assert_standalone(
+            (res->count == 4) &&
+            (elems[0] == -4) &&
+            (elems[1] == -1) &&
+            (elems[2] == 0) &&
+            (elems[3] == 4),
+            "apply_union_positional",
+            "union(even, take_first(2)) should return {-4, -1, 0, 4}",
+            _counter) && result;
+
+        d_filter_result_free(res);
+        free(res);
+    }
+
+    d_filter_union_free(u);
+    d_filter_chain_free(chain_take);
+
     // cleanup shared chains
     d_filter_chain_free(chain_even);
     d_filter_chain_free(chain_positive);
@@ -1202,6 +1239,104 @@ d_tests_sa_filter_get_indices
 }
 
 
+/*
+d_tests_sa_filter_get_bitset
+  Tests d_filter_get_bitset for bitset retrieval.
+  Tests the following:
+  - predicate chain sets exactly the matching positions
+  - positional chain (take_first) goes through index matching
+  - bitsets of two chains combine into the combinator results
+  - invalid parameters return NULL
+*/
+bool
+d_tests_sa_filter_get_bitset
+(
+    struct d_test_counter* _counter
+)
+{
+    struct d_filter_chain* chain_even;
+    struct d_filter_chain* chain_take;
+    struct d_bitset*       evens;
+    struct d_bitset*       firsts;
+    size_t                 bit;
+    int                    input[8] = { 1,2,3,4,5,6,7,8 };
+    bool                   result;
+
+    result     = true;
+    chain_even = d_filter_chain_new();
+    chain_take = d_filter_chain_new();
+
+    if ( (!chain_even) ||
+         (!chain_take) )
+    {
+        d_filter_chain_free(chain_even);
+        d_filter_chain_free(chain_take);
+
+        return false;
+    }
+
+    d_filter_chain_add_where(chain_even, pred_is_even);
+    d_filter_chain_add_take_first(chain_take, 3);
+
+    // test 1: predicate chain
+    evens = d_filter_get_bitset(chain_even, input, 8, sizeof(int));
+
+    result = d_assert_standalone(
+        (evens != NULL) &&
+        (d_bitset_size(evens) == 8) &&
+        (d_bitset_count(evens) == 4) &&
+        (d_bitset_test(evens, 1)) &&
+        (!d_bitset_test(evens, 2)) &&
+        (d_bitset_test(evens, 7)),
+        "get_bitset_predicate",
+        "where(is_even) on {1..8} should set bits 1, 3, 5, 7",
+        _counter) && result;
+
+    // test 2: positional chain
+    firsts = d_filter_get_bitset(chain_take, input, 8, sizeof(int));
+
+    result = d_assert_standalone(
+        (firsts != NULL) &&
+        (d_bitset_count(firsts) == 3) &&
+        (d_bitset_rank(firsts, 3) == 3),
+        "get_bitset_positional",
+        "take_first(3) should set bits 0, 1, 2",
+        _counter) && result;
+
+    // test 3: bitset algebra (evens AND firsts = {1})
+    if ( (evens) &&
+         (firsts) )
+    {
+        d_bitset_and(evens, firsts);
+
+        result = d_assert_standalone(
+            (d_bitset_count(evens) == 1) &&
+            (d_bitset_select(evens, 0, &bit)) &&
+            (bit == 1),
+            "get_bitset_and",
+            "even AND first-three should leave only position 1",
+            _counter) && result;
+    }
+
+    d_bitset_free(evens);
+    d_bitset_free(firsts);
+
+    // test 4: invalid parameters
+    result = d_assert_standalone(
+        (d_filter_get_bitset(NULL, input, 8, sizeof(int)) == NULL) &&
+        (d_filter_get_bitset(chain_even, NULL, 8, sizeof(int)) == NULL) &&
+        (d_filter_get_bitset(chain_even, input, 8, 0) == NULL),
+        "get_bitset_invalid",
+        "NULL chain, NULL input or zero element size should return NULL",
+        _counter) && result;
+
+    d_filter_chain_free(chain_even);
+    d_filter_chain_free(chain_take);
+
+    return result;
+}
+
+
 /*
 d_tests_sa_filter_in_place
   Tests d_filter_apply_in_place for in-place array modification.
@@ -1739,6 +1874,7 @@ d_tests_sa_filter_execution_all
     result = d_tests_sa_filter_apply_combinators(_counter) && result;
     result = d_tests_sa_filter_counting(_counter)          && result;
     result = d_tests_sa_filter_get_indices(_counter)       && result;
+    result = d_tests_sa_filter_get_bitset(_counter)        && result;
     result = d_tests_sa_filter_in_place(_counter)          && result;
     result = d_tests_sa_filter_result_free(_counter)       && result;
     result = d_tests_sa_filter_matches_element(_counter)   && result;
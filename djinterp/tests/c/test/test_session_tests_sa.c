@@ -82,12 +82,15 @@ d_tests_sa_test_session_all
     printf("  [SECTION] Execution\n");
     printf("  %s\n", D_TEST_SA_SEPARATOR_SINGLE);
 
-    if (!d_tests_sa_test_session_run_empty(_test_info))         { all_passed = false; }
-    if (!d_tests_sa_test_session_run_null(_test_info))          { all_passed = false; }
-    if (!d_tests_sa_test_session_run_child_invalid(_test_info)) { all_passed = false; }
-    if (!d_tests_sa_test_session_abort(_test_info))             { all_passed = false; }
-    if (!d_tests_sa_test_session_reset(_test_info))             { all_passed = false; }
-    if (!d_tests_sa_test_session_pause_resume(_test_info))      { all_passed = false; }
+    if (!d_tests_sa_test_session_run_empty(_test_info))            { all_passed = false; }
+    if (!d_tests_sa_test_session_run_null(_test_info))             { all_passed = false; }
+    if (!d_tests_sa_test_session_run_child_invalid(_test_info))    { all_passed = false; }
+    if (!d_tests_sa_test_session_abort(_test_info))                { all_passed = false; }
+    if (!d_tests_sa_test_session_reset(_test_info))                { all_passed = false; }
+    if (!d_tests_sa_test_session_pause_resume(_test_info))         { all_passed = false; }
+    if (!d_tests_sa_test_session_run_parallel(_test_info))         { all_passed = false; }
+    if (!d_tests_sa_test_session_run_parallel_failure(_test_info)) { all_passed = false; }
+    if (!d_tests_sa_test_session_run_parallel_order(_test_info))   { all_passed = false; }
 
     printf("\n");
 
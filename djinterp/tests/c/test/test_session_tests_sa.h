@@ -15,6 +15,7 @@
 #define DJINTERP_TESTING_TEST_SESSION_STANDALONE_ 1
 
 #include <stdlib.h>
+#include <string.h>
 #include "../../../inc/c/djinterp.h"
 #include "../../../inc/c/test/test_session.h"
 #include "../../../inc/c/test/test_standalone.h"
@@ -68,6 +69,9 @@ bool d_tests_sa_test_session_run_child_invalid(struct d_test_counter* _test_info
 bool d_tests_sa_test_session_abort(struct d_test_counter* _test_info);
 bool d_tests_sa_test_session_reset(struct d_test_counter* _test_info);
 bool d_tests_sa_test_session_pause_resume(struct d_test_counter* _test_info);
+bool d_tests_sa_test_session_run_parallel(struct d_test_counter* _test_info);
+bool d_tests_sa_test_session_run_parallel_failure(struct d_test_counter* _test_info);
+bool d_tests_sa_test_session_run_parallel_order(struct d_test_counter* _test_info);
 
 
 /******************************************************************************
@@ -445,3 +445,666 @@ d_tests_sa_test_session_pause_resume
 
     return (_test_info->tests_passed > initial_tests_passed);
 }
+
+/*
+d_tests_sa_test_session_run_parallel
+  Tests running a session's modules on multiple workers.
+  Tests the following:
+  - run with PARALLEL and 3 workers over 7 modules returns true
+  - every module is counted exactly once in the merged statistics
+  - status transitions to COMPLETED
+  - a worker count larger than the module count is clamped
+*/
+bool
+d_tests_sa_test_session_run_parallel
+(
+    struct d_test_counter* _test_info
+)
+{
+    size_t                 initial_tests_passed;
+    bool                   all_passed;
+    struct d_test_session* session;
+    struct d_test_module*  mod;
+    struct d_test_type*    modules[7];
+    size_t                 i;
+    bool                   result;
+
+    printf("  --- Testing d_test_session_run (parallel) ---\n");
+
+    initial_tests_passed = _test_info->tests_passed;
+    all_passed           = true;
+
+    for (i = 0; i < 7; i++)
+    {
+        mod        = d_test_module_new(NULL, 0);
+        modules[i] = mod ? d_test_type_new(D_TEST_TYPE_MODULE, mod) : NULL;
+    }
+
+    session = d_test_session_new_with_modules(modules, 7);
+
+    if (!session)
+    {
+        _test_info->tests_total++;
+
+        return false;
+    }
+
+    d_test_session_set_output_format(session, D_TEST_OUTPUT_SILENT);
+    d_test_session_set_option(session,
+                              D_TEST_SESSION_OPT_PARALLEL,
+                              (const void*)(uintptr_t)true);
+    d_test_session_set_option(session,
+                              D_TEST_SESSION_OPT_PARALLEL_WORKERS,
+                              (const void*)(uintptr_t)3);
+
+    result = d_test_session_run(session);
+
+    if (!d_assert_standalone(result,
+                             "parallel run returned true",
+                             "parallel run should return true",
+                             _test_info))
+    {
+        all_passed = false;
+    }
+
+    if (!d_assert_standalone(
+            session->stats.modules.passed == d_test_session_child_count(session),
+            "each module counted once",
+            "merged stats should count each module exactly once",
+            _test_info))
+    {
+        all_passed = false;
+    }
+
+    if (!d_assert_standalone(
+            session->status == D_TEST_SESSION_STATUS_COMPLETED,
+            "status is COMPLETED",
+            "status should be COMPLETED after parallel run",
+            _test_info))
+    {
+        all_passed = false;
+    }
+
+    // more workers than modules
+    d_test_session_set_option(session,
+                              D_TEST_SESSION_OPT_PARALLEL_WORKERS,
+                              (const void*)(uintptr_t)64);
+
+    result = d_test_session_run(session);
+
+    if (!d_assert_standalone(
+            (result) &&
+            (session->stats.modules.passed == d_test_session_child_count(session)),
+            "oversized worker count handled",
+            "worker count above module count should still run each once",
+            _test_info))
+    {
+        all_passed = false;
+    }
+
+    d_test_session_free(session);
+
+    // the session frees neither its modules nor their wrappers
+    for (i = 0; i < 7; i++)
+    {
+        if (modules[i])
+        {
+            d_test_module_free(modules[i]->module);
+            d_test_type_free(modules[i]);
+        }
+    }
+
+    if (all_passed)
+    {
+        _test_info->tests_passed++;
+        printf("  %s run (parallel) unit test passed\n", D_TEST_SYMBOL_PASS);
+    }
+    else
+    {
+        printf("  %s run (parallel) unit test failed\n", D_TEST_SYMBOL_FAIL);
+    }
+
+    _test_info->tests_total++;
+
+    return (_test_info->tests_passed > initial_tests_passed);
+}
+
+/*
+d_internal_session_fn_pass
+  Test function that passes after a short delay, so a module that fails
+immediately is recorded before the other workers drain their queues.
+
+Return:
+  true always.
+*/
+static bool
+d_internal_session_fn_pass
+(
+    void
+)
+{
+    d_sleep_ms(10);
+
+    return true;
+}
+
+/*
+d_internal_session_fn_slow
+  Test function that passes after a longer delay, so the module using it
+finishes after modules registered behind it.
+
+Return:
+  true always.
+*/
+static bool
+d_internal_session_fn_slow
+(
+    void
+)
+{
+    d_sleep_ms(50);
+
+    return true;
+}
+
+/*
+d_internal_session_fn_fail
+  Test function that always fails.
+
+Return:
+  false always.
+*/
+static bool
+d_internal_session_fn_fail
+(
+    void
+)
+{
+    return false;
+}
+
+/*
+d_internal_session_module_new
+  Builds a named module holding a single block that runs `_fn`.
+
+Parameter(s):
+  _name: module name, as reported by the session writer.
+  _fn:   test function run by the module's only block.
+Return:
+  a D_TEST_TYPE_MODULE wrapper, or NULL on allocation failure.
+*/
+static struct d_test_type*
+d_internal_session_module_new
+(
+    const char* _name,
+    fn_test     _fn
+)
+{
+    struct d_test_fn*     test_fn;
+    struct d_test_type*   fn_type;
+    struct d_test_block*  block;
+    struct d_test_type*   block_type;
+    struct d_test_module* mod;
+
+    test_fn = d_test_fn_new(_fn);
+    fn_type = test_fn ? d_test_type_new(D_TEST_TYPE_TEST_FN, test_fn) : NULL;
+    block   = d_test_block_new(NULL, 0);
+
+    if ( (!fn_type) || (!block) )
+    {
+        return NULL;
+    }
+
+    d_test_block_add_child(block, fn_type);
+
+    block_type = d_test_type_new(D_TEST_TYPE_TEST_BLOCK, block);
+
+    if (!block_type)
+    {
+        return NULL;
+    }
+
+    mod = d_test_module_new(&block_type, 1);
+
+    if ( (!mod) || (!mod->config) )
+    {
+        return NULL;
+    }
+
+    // set the name directly; named args need an initialized registry
+    if (!mod->config->settings)
+    {
+        mod->config->settings = d_min_enum_map_new();
+    }
+
+    if (mod->config->settings)
+    {
+        d_min_enum_map_put(mod->config->settings,
+                           (int)D_TEST_METADATA_NAME,
+                           (void*)_name);
+    }
+
+    return d_test_type_new(D_TEST_TYPE_MODULE, mod);
+}
+
+/*
+d_internal_session_parallel_new
+  Builds a session of `_count` modules for the parallel tests; modules whose
+index is set in `_failing` (a bitmask) fail, the rest pass.
+
+Parameter(s):
+  _count:   number of modules (at most 16).
+  _failing: bitmask of failing module indices.
+  _workers: value for D_TEST_SESSION_OPT_PARALLEL_WORKERS.
+Return:
+  a silent session with PARALLEL enabled, or NULL on allocation failure.
+*/
+static struct d_test_session*
+d_internal_session_parallel_new
+(
+    size_t   _count,
+    unsigned _failing,
+    size_t   _workers
+)
+{
+    struct d_test_type*    modules[16];
+    struct d_test_session* session;
+    size_t                 i;
+
+    for (i = 0; i < _count; i++)
+    {
+        modules[i] = d_internal_session_module_new(
+                         "parallel",
+                         (_failing & (1u << i)) ? d_internal_session_fn_fail
+                                                : d_internal_session_fn_pass);
+    }
+
+    session = d_test_session_new_with_modules(modules, _count);
+
+    if (!session)
+    {
+        return NULL;
+    }
+
+    d_test_session_set_output_format(session, D_TEST_OUTPUT_SILENT);
+    d_test_session_set_option(session,
+                              D_TEST_SESSION_OPT_PARALLEL,
+                              (const void*)(uintptr_t)true);
+    d_test_session_set_option(session,
+                              D_TEST_SESSION_OPT_PARALLEL_WORKERS,
+                              (const void*)(uintptr_t)_workers);
+
+    return session;
+}
+
+/*
+d_internal_session_parallel_free
+  Frees a session built from d_internal_session_module_new modules together
+with the tree beneath it. d_test_session_free, d_test_module_free and
+d_test_block_free release only their own node, so the module wrappers, block
+wrappers and test functions are freed here.
+
+Parameter(s):
+  _session: the session to free; may be NULL.
+Return:
+  none
+*/
+static void
+d_internal_session_parallel_free
+(
+    struct d_test_session* _session
+)
+{
+    struct d_test_type* module_type;
+    struct d_test_type* block_type;
+    struct d_test_type* fn_type;
+    size_t              i;
+    size_t              j;
+    size_t              k;
+
+    if (!_session)
+    {
+        return;
+    }
+
+    for (i = 0; i < d_test_session_child_count(_session); i++)
+    {
+        module_type = d_test_session_get_child_at(_session, i);
+
+        if ( (!module_type) || (!module_type->module) )
+        {
+            d_test_type_free(module_type);
+
+            continue;
+        }
+
+        for (j = 0; j < d_test_module_child_count(module_type->module); j++)
+        {
+            block_type = d_test_module_get_child_at(module_type->module, j);
+
+            if ( (block_type) && (block_type->block) )
+            {
+                for (k = 0; k < d_test_block_child_count(block_type->block); k++)
+                {
+                    fn_type = d_test_block_get_child_at(block_type->block, k);
+
+                    if (fn_type)
+                    {
+                        d_test_fn_free(fn_type->test_fn);
+                    }
+                }
+
+                // also frees the fn wrappers
+                d_test_block_free(block_type->block);
+            }
+
+            d_test_type_free(block_type);
+        }
+
+        d_test_module_free(module_type->module);
+        d_test_type_free(module_type);
+    }
+
+    d_test_session_free(_session);
+
+    return;
+}
+
+/*
+d_tests_sa_test_session_run_parallel_failure
+  Tests that failure limits are shared by all workers of a parallel run.
+  Tests the following:
+  - ABORT_ON_FAILURE: a failing module stops every worker; the run returns
+    false, status is ABORTED and the remaining modules are not scheduled
+  - FAIL_FAST: failures on different workers are counted together and the
+    run stops once the combined count reaches the limit
+  - FAIL_FAST above the failure count lets every module run to COMPLETED
+*/
+bool
+d_tests_sa_test_session_run_parallel_failure
+(
+    struct d_test_counter* _test_info
+)
+{
+    size_t                 initial_tests_passed;
+    bool                   all_passed;
+    struct d_test_session* session;
+    bool                   result;
+
+    printf("  --- Testing d_test_session_run (parallel failure) ---\n");
+
+    initial_tests_passed = _test_info->tests_passed;
+    all_passed           = true;
+
+    // abort on failure: module 0 (first job of worker 0) fails at once
+    session = d_internal_session_parallel_new(12, 0x001u, 3);
+
+    if (!session)
+    {
+        _test_info->tests_total++;
+
+        return false;
+    }
+
+    d_test_session_set_option(session,
+                              D_TEST_SESSION_OPT_ABORT_ON_FAILURE,
+                              (const void*)(uintptr_t)true);
+
+    result = d_test_session_run(session);
+
+    if (!d_assert_standalone(
+            (!result) &&
+            (session->status == D_TEST_SESSION_STATUS_ABORTED),
+            "abort on failure: run aborted",
+            "a failing module should abort the parallel run",
+            _test_info))
+    {
+        all_passed = false;
+    }
+
+    if (!d_assert_standalone(
+            (session->stats.modules.failed == 1) &&
+            (session->stats.modules.passed < 11),
+            "abort on failure: other workers stopped",
+            "workers should stop taking modules after the failure",
+            _test_info))
+    {
+        all_passed = false;
+    }
+
+    d_internal_session_parallel_free(session);
+
+    // fail fast: modules 0 and 4 fail, each the first job of its worker
+    session = d_internal_session_parallel_new(8, 0x011u, 2);
+
+    if (!session)
+    {
+        _test_info->tests_total++;
+
+        return false;
+    }
+
+    d_test_session_set_option(session,
+                              D_TEST_SESSION_OPT_FAIL_FAST,
+                              (const void*)(uintptr_t)2);
+
+    result = d_test_session_run(session);
+
+    if (!d_assert_standalone(
+            (!result) &&
+            (session->status == D_TEST_SESSION_STATUS_ABORTED) &&
+            (session->failure_count == 2),
+            "fail fast: failures counted across workers",
+            "one failure per worker should reach a fail-fast limit of 2",
+            _test_info))
+    {
+        all_passed = false;
+    }
+
+    if (!d_assert_standalone(
+            (session->stats.modules.failed == 2) &&
+            (session->stats.modules.passed < 6),
+            "fail fast: remaining modules skipped",
+            "no further modules should start once the limit is reached",
+            _test_info))
+    {
+        all_passed = false;
+    }
+
+    // a limit above the number of failures does not stop the run
+    d_test_session_set_option(session,
+                              D_TEST_SESSION_OPT_FAIL_FAST,
+                              (const void*)(uintptr_t)3);
+
+    result = d_test_session_run(session);
+
+    if (!d_assert_standalone(
+            (!result) &&
+            (session->status == D_TEST_SESSION_STATUS_COMPLETED) &&
+            (session->stats.modules.failed == 2) &&
+            (session->stats.modules.passed == 6),
+            "fail fast: limit not reached",
+            "all modules should run when failures stay under the limit",
+            _test_info))
+    {
+        all_passed = false;
+    }
+
+    d_internal_session_parallel_free(session);
+
+    if (all_passed)
+    {
+        _test_info->tests_passed++;
+        printf("  %s run (parallel failure) unit test passed\n",
+               D_TEST_SYMBOL_PASS);
+    }
+    else
+    {
+        printf("  %s run (parallel failure) unit test failed\n",
+               D_TEST_SYMBOL_FAIL);
+    }
+
+    _test_info->tests_total++;
+
+    return (_test_info->tests_passed > initial_tests_passed);
+}
+
+/*
+d_tests_sa_test_session_run_parallel_order
+  Tests that a parallel run reports module results in registration order.
+Module 0 is slow and modules 2 and 4 fail, so the workers finish out of
+order; the session output must still list every module in order with its
+own result.
+  Tests the following:
+  - each module is reported exactly once
+  - modules are reported in registration order
+  - each reported result matches that module's outcome
+*/
+bool
+d_tests_sa_test_session_run_parallel_order
+(
+    struct d_test_counter* _test_info
+)
+{
+    static const char* names[6] =
+    {
+        "order_0", "order_1", "order_2", "order_3", "order_4", "order_5"
+    };
+    size_t                 initial_tests_passed;
+    bool                   all_passed;
+    struct d_test_session* session;
+    struct d_test_type*    modules[6];
+    FILE*                  stream;
+    char                   line[256];
+    char                   expected[64];
+    size_t                 next;
+    size_t                 i;
+    bool                   in_order;
+
+    printf("  --- Testing d_test_session_run (parallel order) ---\n");
+
+    initial_tests_passed = _test_info->tests_passed;
+    all_passed           = true;
+
+    for (i = 0; i < 6; i++)
+    {
+        modules[i] = d_internal_session_module_new(
+                         names[i],
+                         (i == 0)            ? d_internal_session_fn_slow
+                         : (i == 2 || i == 4) ? d_internal_session_fn_fail
+                                              : d_internal_session_fn_pass);
+    }
+
+    session = d_test_session_new_with_modules(modules, 6);
+    stream  = tmpfile();
+
+    if ( (!session) || (!stream) )
+    {
+        d_internal_session_parallel_free(session);
+
+        if (stream)
+        {
+            fclose(stream);
+        }
+
+        _test_info->tests_total++;
+
+        return false;
+    }
+
+    session->output.stream    = stream;
+    session->output.use_color = false;
+    d_test_session_set_verbosity(session, D_TEST_VERBOSITY_NORMAL);
+    d_test_session_set_option(session,
+                              D_TEST_SESSION_OPT_PARALLEL,
+                              (const void*)(uintptr_t)true);
+    d_test_session_set_option(session,
+                              D_TEST_SESSION_OPT_PARALLEL_WORKERS,
+                              (const void*)(uintptr_t)3);
+
+    d_test_session_run(session);
+
+    // each module is written as a "[MODULE] name" line followed by a
+    // result line carrying the pass/fail symbol and the name again
+    rewind(stream);
+
+    next     = 0;
+    in_order = true;
+
+    while (fgets(line, sizeof(line), stream))
+    {
+        if (!strstr(line, "[MODULE]"))
+        {
+            continue;
+        }
+
+        if ( (next >= 6) || (!strstr(line, names[next])) )
+        {
+            in_order = false;
+
+            break;
+        }
+
+        if (!fgets(line, sizeof(line), stream))
+        {
+            in_order = false;
+
+            break;
+        }
+
+        snprintf(expected,
+                 sizeof(expected),
+                 "%s %s",
+                 (next == 2 || next == 4) ? D_TEST_SYMBOL_FAIL
+                                          : D_TEST_SYMBOL_PASS,
+                 names[next]);
+
+        if (!strstr(line, expected))
+        {
+            in_order = false;
+
+            break;
+        }
+
+        next++;
+    }
+
+    if (!d_assert_standalone(
+            (in_order) && (next == 6),
+            "results reported in module order",
+            "parallel results should follow registration order",
+            _test_info))
+    {
+        all_passed = false;
+    }
+
+    if (!d_assert_standalone(
+            (session->stats.modules.passed == 4) &&
+            (session->stats.modules.failed == 2),
+            "outcomes merged from all workers",
+            "merged stats should hold 4 passes and 2 failures",
+            _test_info))
+    {
+        all_passed = false;
+    }
+
+    session->output.stream = stdout;
+    d_internal_session_parallel_free(session);
+    fclose(stream);
+
+    if (all_passed)
+    {
+        _test_info->tests_passed++;
+        printf("  %s run (parallel order) unit test passed\n",
+               D_TEST_SYMBOL_PASS);
+    }
+    else
+    {
+        printf("  %s run (parallel order) unit test failed\n",
+               D_TEST_SYMBOL_FAIL);
+    }
+
+    _test_info->tests_total++;
+
+    return (_test_info->tests_passed > initial_tests_passed);
+}
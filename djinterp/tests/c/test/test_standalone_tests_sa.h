@@ -183,6 +183,8 @@ bool d_tests_sa_standalone_runner_set_wait(struct d_test_counter* _counter);
 bool d_tests_sa_standalone_runner_set_notes(struct d_test_counter* _counter);
 // d_test_sa_runner_cleanup function
 bool d_tests_sa_standalone_runner_cleanup(struct d_test_counter* _counter);
+// d_test_sa_runner_execute function (isolated modules)
+bool d_tests_sa_standalone_runner_execute_isolated(struct d_test_counter* _counter);
 
 // XI.  aggregation function
 bool d_tests_sa_standalone_runner_fn_all(struct d_test_counter* _counter);
@@ -227,6 +229,8 @@ bool d_tests_sa_standalone_failure_list_struct(struct d_test_counter* _counter);
 bool d_tests_sa_standalone_failure_list_init(struct d_test_counter* _counter);
 // d_test_sa_failure_list_add function
 bool d_tests_sa_standalone_failure_list_add(struct d_test_counter* _counter);
+// d_test_sa_failure_list_add_copy function
+bool d_tests_sa_standalone_failure_list_add_copy(struct d_test_counter* _counter);
 // d_test_sa_failure_list_print function
 bool d_tests_sa_standalone_failure_list_print_fn(struct d_test_counter* _counter);
 // d_test_sa_failure_list_print_file function
@@ -298,6 +298,90 @@ d_tests_sa_standalone_failure_list_add
     return result;
 }
 
+/*
+d_tests_sa_standalone_failure_list_add_copy
+  Tests the d_test_sa_failure_list_add_copy function.
+  Tests the following:
+  - NULL list is handled safely
+  - Entry is added and marked as owned
+  - test_name and message are copies, not the caller's pointers
+  - Copied strings survive the caller's buffer being overwritten
+  - Owned entries are released by d_test_sa_failure_list_free
+*/
+bool
+d_tests_sa_standalone_failure_list_add_copy
+(
+    struct d_test_counter* _counter
+)
+{
+    bool                          result;
+    struct d_test_sa_failure_list list;
+    char                          name[16];
+    char                          message[16];
+
+    result = true;
+
+    // test 1: NULL list is handled safely
+    d_test_sa_failure_list_add_copy(NULL, "mod", "test", "msg");
+
+    result = d_assert_standalone(
+        true,
+        "failure_list_add_copy_null_safe",
+        "failure_list_add_copy(NULL) should not crash",
+        _counter) && result;
+
+    // test 2: entry is added and owned
+    d_test_sa_failure_list_init(&list);
+    d_strcpy_s(name, sizeof(name), "copied_test");
+    d_strcpy_s(message, sizeof(message), "copied_msg");
+    d_test_sa_failure_list_add_copy(&list, "module1", name, message);
+
+    result = d_assert_standalone(
+        (list.count == 1) && (list.entries[0].owned),
+        "failure_list_add_copy_owned",
+        "entry should be added and marked owned",
+        _counter) && result;
+
+    // test 3: strings are copies
+    result = d_assert_standalone(
+        (list.entries[0].test_name != name) &&
+        (list.entries[0].message != message),
+        "failure_list_add_copy_not_aliased",
+        "test_name/message should not alias the caller's buffers",
+        _counter) && result;
+
+    // test 4: copies survive the source being overwritten
+    d_strcpy_s(name, sizeof(name), "overwritten");
+    d_strcpy_s(message, sizeof(message), "overwritten");
+
+    result = d_assert_standalone(
+        (strcmp(list.entries[0].test_name, "copied_test") == 0) &&
+        (strcmp(list.entries[0].message, "copied_msg") == 0),
+        "failure_list_add_copy_values",
+        "copied strings should keep their original values",
+        _counter) && result;
+
+    // test 5: mixing with borrowed entries, then free
+    d_test_sa_failure_list_add(&list, "module2", "borrowed", "msg");
+
+    result = d_assert_standalone(
+        (list.count == 2) && (!list.entries[1].owned),
+        "failure_list_add_copy_mixed",
+        "borrowed entry should not be marked owned",
+        _counter) && result;
+
+    d_test_sa_failure_list_free(&list);
+
+    result = d_assert_standalone(
+        (list.count == 0) && (list.entries == NULL),
+        "failure_list_add_copy_free",
+        "free should release owned copies and reset the list",
+        _counter) && result;
+
+    return result;
+}
+
+
 /*
 d_tests_sa_standalone_failure_list_print_fn
   Tests the d_test_sa_failure_list_print function.
@@ -493,6 +577,8 @@ d_tests_sa_standalone_failure_all
              && result;
     result = d_tests_sa_standalone_failure_list_add(_counter)
              && result;
+    result = d_tests_sa_standalone_failure_list_add_copy(_counter)
+             && result;
     result = d_tests_sa_standalone_failure_list_print_fn(_counter)
              && result;
     result = d_tests_sa_standalone_failure_list_print_file_fn(_counter)
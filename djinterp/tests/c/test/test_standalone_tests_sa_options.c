@@ -109,6 +109,7 @@ d_tests_sa_standalone_options_init
   - show_module_footer defaults to true
   - list_failures defaults to false
   - output_file defaults to NULL
+  - jobs and timeout_ms default to 0 (in-process, no limit)
 */
 bool
 d_tests_sa_standalone_options_init
@@ -175,6 +176,12 @@ d_tests_sa_standalone_options_init
         "output_file should default to NULL",
         _counter) && result;
 
+    result = d_assert_standalone(
+        (opts.jobs == 0) && (opts.timeout_ms == 0),
+        "options_init_isolation_off",
+        "jobs and timeout_ms should default to 0",
+        _counter) && result;
+
     return result;
 }
 
@@ -191,6 +198,7 @@ d_tests_sa_standalone_options_parse
   - -nf flag clears show_module_footer
   - -lf flag sets list_failures
   - -o flag sets output_file
+  - -j / -t flags set jobs / timeout_ms
   - Unknown flag is ignored (returns true)
   - No arguments returns true
 */
@@ -344,7 +352,36 @@ d_tests_sa_standalone_options_parse
             _counter) && result;
     }
 
-    // test 11: multiple flags work together
+    // test 11: -j and -t set isolation options
+    {
+        char* argv_jt[] = { "prog", "-j", "8", "-t", "2500" };
+
+        d_test_sa_options_init(&opts);
+        d_test_sa_options_parse(&opts, 5, argv_jt);
+
+        result = d_assert_standalone(
+            (opts.jobs == 8) && (opts.timeout_ms == 2500),
+            "options_parse_jt_flags",
+            "-j and -t should set jobs and timeout_ms",
+            _counter) && result;
+    }
+
+    // test 12: -j without argument returns false
+    {
+        char* argv_j_no_arg[] = { "prog", "-j" };
+
+        d_test_sa_options_init(&opts);
+        parse_result = d_test_sa_options_parse(&opts, 2,
+                                               argv_j_no_arg);
+
+        result = d_assert_standalone(
+            parse_result == false,
+            "options_parse_j_no_arg",
+            "-j without argument should return false",
+            _counter) && result;
+    }
+
+    // test 13: multiple flags work together
     {
         char* argv_multi[] = { "prog", "-na", "-nt", "-lf" };
 
@@ -360,7 +397,7 @@ d_tests_sa_standalone_options_parse
             _counter) && result;
     }
 
-    // test 12: no arguments returns true
+    // test 14: no arguments returns true
     {
         char* argv_empty[] = { "prog" };
 
@@ -37,6 +37,97 @@ helper_runner_module_counter
     return true;
 }
 
+#if D_TEST_SA_HAS_ISOLATION
+
+#include <signal.h>
+#include <unistd.h>
+
+/*
+helper_runner_isolated_pass
+  Isolated-runner module that prints a marker and passes.
+*/
+static bool
+helper_runner_isolated_pass
+(
+    struct d_test_counter* _counter
+)
+{
+    printf("  <isolated:pass>\n");
+
+    _counter->assertions_total++;
+    _counter->assertions_passed++;
+    _counter->tests_total++;
+    _counter->tests_passed++;
+
+    return true;
+}
+
+/*
+helper_runner_isolated_fail
+  Isolated-runner module that prints a marker and records one failed
+assertion.
+*/
+static bool
+helper_runner_isolated_fail
+(
+    struct d_test_counter* _counter
+)
+{
+    printf("  <isolated:fail>\n");
+
+    d_assert_standalone(false,
+                        "isolated_fail_check",
+                        "expected failure",
+                        _counter);
+    _counter->tests_total++;
+
+    return false;
+}
+
+/*
+helper_runner_isolated_crash
+  Isolated-runner module that prints a marker and raises SIGSEGV.
+*/
+static bool
+helper_runner_isolated_crash
+(
+    struct d_test_counter* _counter
+)
+{
+    (void)_counter;
+
+    printf("  <isolated:crash>\n");
+    fflush(stdout);
+
+    raise(SIGSEGV);
+
+    return true;
+}
+
+/*
+helper_runner_isolated_hang
+  Isolated-runner module that prints a marker and sleeps well past the
+runner's time limit; it passes only if it is never killed.
+*/
+static bool
+helper_runner_isolated_hang
+(
+    struct d_test_counter* _counter
+)
+{
+    printf("  <isolated:hang>\n");
+    fflush(stdout);
+
+    sleep(5);
+
+    _counter->tests_total++;
+    _counter->tests_passed++;
+
+    return true;
+}
+
+#endif  // D_TEST_SA_HAS_ISOLATION
+
 /******************************************************************************
  * XI. RUNNER FUNCTION TESTS
  *****************************************************************************/
@@ -610,6 +701,216 @@ d_tests_sa_standalone_runner_cleanup
     return result;
 }
 
+/*
+d_tests_sa_standalone_runner_execute_isolated
+  Tests d_test_sa_runner_execute with isolated modules (jobs = 2 and a
+per-module time limit).
+  Tests the following:
+  - A crashing module and a timed-out module fail without stopping the suite
+  - Module and test counters include the crashed and killed modules
+  - Failures are listed in registration order, with the module process
+    reason for the crash and the timeout
+  - Captured module output is replayed in registration order
+*/
+bool
+d_tests_sa_standalone_runner_execute_isolated
+(
+    struct d_test_counter* _counter
+)
+{
+    bool result;
+#if D_TEST_SA_HAS_ISOLATION
+    struct d_test_sa_runner        runner;
+    struct d_test_sa_options*      saved_options;
+    struct d_test_sa_failure_list* saved_failures;
+    const char*                    saved_module;
+    FILE*                          saved_file;
+    size_t                         saved_assertion;
+    size_t                         saved_test;
+    FILE*                          capture;
+    int                            saved_stdout;
+    int                            status;
+    char*                          output;
+    long                           length;
+    const char*                    marks[5];
+    bool                           ordered;
+    size_t                         i;
+
+    static const char* const markers[5] =
+    {
+        "<isolated:pass>",
+        "<isolated:fail>",
+        "<isolated:crash>",
+        "<isolated:hang>",
+        "<isolated:pass>"
+    };
+#endif
+
+    result = true;
+
+#if D_TEST_SA_HAS_ISOLATION
+    d_test_sa_runner_init(&runner, "Isolated", "Isolated runner test");
+    d_test_sa_runner_set_wait_for_input(&runner, false);
+    runner.options.jobs       = 2;
+    runner.options.timeout_ms = 500;
+
+    d_test_sa_runner_add_module_counter(&runner, "pass_a", "passes",
+                                        helper_runner_isolated_pass,
+                                        0, NULL);
+    d_test_sa_runner_add_module_counter(&runner, "fail", "fails",
+                                        helper_runner_isolated_fail,
+                                        0, NULL);
+    d_test_sa_runner_add_module_counter(&runner, "crash", "crashes",
+                                        helper_runner_isolated_crash,
+                                        0, NULL);
+    d_test_sa_runner_add_module_counter(&runner, "hang", "times out",
+                                        helper_runner_isolated_hang,
+                                        0, NULL);
+    d_test_sa_runner_add_module_counter(&runner, "pass_b", "passes",
+                                        helper_runner_isolated_pass,
+                                        0, NULL);
+
+    // the nested run resets the globals this suite is running under
+    saved_options   = g_d_test_options;
+    saved_failures  = g_d_test_failures;
+    saved_module    = g_d_test_current_module;
+    saved_file      = g_d_test_output_file;
+    saved_assertion = g_d_test_assertion_number;
+    saved_test      = g_d_test_test_number;
+
+    // capture the nested report instead of mixing it into this one
+    capture      = tmpfile();
+    saved_stdout = -1;
+    status       = -1;
+
+    if (capture)
+    {
+        fflush(stdout);
+        saved_stdout = dup(STDOUT_FILENO);
+        dup2(fileno(capture), STDOUT_FILENO);
+
+        status = d_test_sa_runner_execute(&runner);
+
+        fflush(stdout);
+        dup2(saved_stdout, STDOUT_FILENO);
+        close(saved_stdout);
+    }
+
+    g_d_test_options          = saved_options;
+    g_d_test_failures         = saved_failures;
+    g_d_test_current_module   = saved_module;
+    g_d_test_output_file      = saved_file;
+    g_d_test_assertion_number = saved_assertion;
+    g_d_test_test_number      = saved_test;
+
+    // test 1: the suite fails but every module was accounted for
+    result = d_assert_standalone(
+        status == 1,
+        "runner_isolated_status",
+        "execute should return 1 when a module fails",
+        _counter) && result;
+
+    result = d_assert_standalone(
+        (runner.results.modules_total == 5) &&
+        (runner.results.modules_passed == 2),
+        "runner_isolated_module_counts",
+        "5 modules should run and the 2 passing ones be counted",
+        _counter) && result;
+
+    // test 2: crash and timeout each count as one failed test
+    result = d_assert_standalone(
+        (runner.results.totals.tests_total == 5) &&
+        (runner.results.totals.tests_passed == 2) &&
+        (runner.results.totals.assertions_total == 3) &&
+        (runner.results.totals.assertions_passed == 2),
+        "runner_isolated_totals",
+        "totals should merge every module, including crashed ones",
+        _counter) && result;
+
+    // test 3: failures arrive in registration order with their reasons
+    result = d_assert_standalone(
+        (runner.failures.count == 3) &&
+        (strcmp(runner.failures.entries[0].module_name, "fail") == 0) &&
+        (strcmp(runner.failures.entries[0].test_name,
+                "isolated_fail_check") == 0),
+        "runner_isolated_failure_streamed",
+        "the failing module's assertion should be streamed back",
+        _counter) && result;
+
+    result = d_assert_standalone(
+        (runner.failures.count == 3) &&
+        (strcmp(runner.failures.entries[1].module_name, "crash") == 0) &&
+        (strcmp(runner.failures.entries[1].test_name,
+                "(module process)") == 0),
+        "runner_isolated_failure_crash",
+        "the crashed module should be recorded as a failure",
+        _counter) && result;
+
+    result = d_assert_standalone(
+        (runner.failures.count == 3) &&
+        (strcmp(runner.failures.entries[2].module_name, "hang") == 0) &&
+        (strstr(runner.failures.entries[2].message, "timed out") != NULL),
+        "runner_isolated_failure_timeout",
+        "the hung module should be killed and reported as timed out",
+        _counter) && result;
+
+    // test 4: captured output is replayed in registration order
+    ordered = false;
+    output  = NULL;
+
+    if ( (capture)                              &&
+         (fseek(capture, 0, SEEK_END) == 0)     &&
+         ((length = ftell(capture)) > 0) )
+    {
+        output = (char*)malloc((size_t)length + 1);
+    }
+
+    if (output)
+    {
+        rewind(capture);
+        output[fread(output, 1, (size_t)length, capture)] = '\0';
+
+        ordered  = true;
+        marks[0] = strstr(output, markers[0]);
+
+        for (i = 0; (i < 5) && (ordered); i++)
+        {
+            if (i > 0)
+            {
+                marks[i] = marks[i - 1]
+                    ? strstr(marks[i - 1] + 1, markers[i])
+                    : NULL;
+            }
+
+            ordered = (marks[i] != NULL);
+        }
+
+        free(output);
+    }
+
+    result = d_assert_standalone(
+        ordered,
+        "runner_isolated_output_order",
+        "module output should be replayed in registration order",
+        _counter) && result;
+
+    if (capture)
+    {
+        fclose(capture);
+    }
+
+    d_test_sa_runner_cleanup(&runner);
+#else
+    result = d_assert_standalone(
+        true,
+        "runner_isolated_unavailable",
+        "isolated execution is not available on this platform",
+        _counter) && result;
+#endif
+
+    return result;
+}
+
 /*
 d_tests_sa_standalone_runner_fn_all
   Aggregation function that runs all runner function tests.
@@ -635,6 +936,8 @@ d_tests_sa_standalone_runner_fn_all
     result = d_tests_sa_standalone_runner_set_wait(_counter) && result;
     result = d_tests_sa_standalone_runner_set_notes(_counter) && result;
     result = d_tests_sa_standalone_runner_cleanup(_counter) && result;
+    result = d_tests_sa_standalone_runner_execute_isolated(_counter)
+             && result;
 
     return result;
 }
@@ -0,0 +1,24 @@
+#include ".\parse_runtime_tests_sa.h"
+
+
+/*
+d_tests_sa_parse_runtime_run_all
+  Module-level aggregation function that runs all parse_runtime tests.
+  Executes tests for all categories:
+  - Parse forest
+*/
+bool
+d_tests_sa_parse_runtime_run_all
+(
+    struct d_test_counter* _counter
+)
+{
+    bool result;
+
+    result = true;
+
+    // run all test categories
+    result = d_tests_sa_parse_forest_all(_counter) && result;
+
+    return result;
+}
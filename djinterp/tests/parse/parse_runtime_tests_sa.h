@@ -0,0 +1,44 @@
+/******************************************************************************
+* djinterp [test]                                     parse_runtime_tests_sa.h
+*
+*   Unit test declarations for `parse_runtime.h` module.
+*   Covers the shared packed parse forest: tree counts of an ambiguous grammar
+* against the Catalan numbers, enumeration over a cyclic grammar (only finite
+* trees are yielded), and building the forest of a long left-recursive input.
+*
+*
+* path:      \tests\parse\parse_runtime_tests_sa.h
+* link:      TBA
+* author(s): Samuel 'teer' Neal-Blim                          date: 2026.10.18
+******************************************************************************/
+
+#ifndef DJINTERP_TESTS_PARSE_RUNTIME_STANDALONE_
+#define DJINTERP_TESTS_PARSE_RUNTIME_STANDALONE_ 1
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "..\..\inc\c\test\test_standalone.h"
+#include "..\..\inc\parse\parse_runtime.h"
+
+
+/******************************************************************************
+ * I. PARSE FOREST TESTS
+ *****************************************************************************/
+bool d_tests_sa_parse_forest_catalan(struct d_test_counter* _counter);
+bool d_tests_sa_parse_forest_cyclic(struct d_test_counter* _counter);
+bool d_tests_sa_parse_forest_long_input(struct d_test_counter* _counter);
+
+// I. aggregation function
+bool d_tests_sa_parse_forest_all(struct d_test_counter* _counter);
+
+
+/******************************************************************************
+ * MODULE-LEVEL AGGREGATION
+ *****************************************************************************/
+bool d_tests_sa_parse_runtime_run_all(struct d_test_counter* _counter);
+
+
+#endif  // DJINTERP_TESTS_PARSE_RUNTIME_STANDALONE_
@@ -0,0 +1,591 @@
+#include ".\parse_runtime_tests_sa.h"
+
+
+/******************************************************************************
+ * I. PARSE FOREST TESTS
+ *****************************************************************************/
+
+/*
+d_tests_sa_parse_forest_internal_grammar
+  Helper: points `_grammar` at caller-owned symbol and production arrays. The
+first symbol is the start symbol.
+*/
+static void
+d_tests_sa_parse_forest_internal_grammar
+(
+    struct d_parse_grammar*    _grammar,
+    struct d_parse_symbol*     _symbols,
+    size_t                     _symbol_count,
+    struct d_parse_production* _productions,
+    size_t                     _production_count
+)
+{
+    memset(_grammar, 0, sizeof(*_grammar));
+
+    _grammar->symbols             = _symbols;
+    _grammar->symbol_count        = _symbol_count;
+    _grammar->symbol_capacity     = _symbol_count;
+    _grammar->productions         = _productions;
+    _grammar->production_count    = _production_count;
+    _grammar->production_capacity = _production_count;
+    _grammar->start_symbol_index  = 0;
+
+    return;
+}
+
+
+/*
+d_tests_sa_parse_forest_internal_valid
+  Helper: checks that a materialized tree is a complete derivation: every
+nonterminal records a production of its own symbol and has one child per
+right-hand-side symbol, each labelled with that symbol.
+*/
+static bool
+d_tests_sa_parse_forest_internal_valid
+(
+    const struct d_parse_grammar*   _grammar,
+    const struct d_parse_tree_node* _node
+)
+{
+    const struct d_parse_production* production;
+    size_t                           i;
+
+    if (_node->type == D_PARSE_TREE_NODE_TERMINAL)
+    {
+        return true;
+    }
+
+    if ( (_node->production_index < 0) ||
+         ((size_t)_node->production_index >= _grammar->production_count) )
+    {
+        return false;
+    }
+
+    production = &_grammar->productions[_node->production_index];
+
+    if ( (production->lhs_index != _node->symbol_index) ||
+         (production->rhs_length != _node->child_count) )
+    {
+        return false;
+    }
+
+    for (i = 0; i < _node->child_count; i++)
+    {
+        if ( (_node->children[i]->symbol_index != production->rhs_indices[i]) ||
+             (!d_tests_sa_parse_forest_internal_valid(_grammar,
+                                                      _node->children[i])) )
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+
+/*
+d_tests_sa_parse_forest_internal_count
+  Helper: parses `_input` into a forest and counts the trees the iterator
+yields, materializing each one and clearing `_all_valid` if any of them is
+not a complete derivation. Returns -1 if the input is rejected.
+*/
+static int
+d_tests_sa_parse_forest_internal_count
+(
+    const struct d_parse_grammar* _grammar,
+    const char*                   _input,
+    bool*                         _all_valid
+)
+{
+    struct d_parse_runtime     runtime;
+    struct d_parse_result      result;
+    struct d_parse_forest      forest;
+    struct d_parse_forest_iter iter;
+    struct d_parse_tree_node*  tree;
+    int                        count;
+
+    d_parse_runtime_init(&runtime, _grammar, NULL);
+
+    if (!d_parse_runtime_parse_forest(&runtime, _input, &result, &forest))
+    {
+        d_parse_forest_destroy(&forest);
+        d_parse_result_destroy(&result);
+        d_parse_runtime_destroy(&runtime);
+
+        return -1;
+    }
+
+    count = 0;
+    d_parse_forest_iter_init(&iter, &forest);
+
+    while (d_parse_forest_iter_next(&iter))
+    {
+        tree = d_parse_forest_iter_build_tree(&iter);
+
+        if ( (!tree) ||
+             (!d_tests_sa_parse_forest_internal_valid(_grammar, tree)) )
+        {
+            *_all_valid = false;
+        }
+
+        d_parse_tree_node_destroy(tree);
+        count++;
+    }
+
+    d_parse_forest_iter_destroy(&iter);
+    d_parse_forest_destroy(&forest);
+    d_parse_result_destroy(&result);
+    d_parse_runtime_destroy(&runtime);
+
+    return count;
+}
+
+
+/*
+d_tests_sa_parse_forest_catalan
+  Tests d_parse_runtime_parse_forest and d_parse_forest_iter_next on the
+ambiguous grammar `E -> E + E | NUMBER`.
+  Tests the following:
+  - n operands yield Catalan(n - 1) trees, for n = 1 .. 8
+  - every yielded tree is a complete derivation
+  - d_parse_forest_is_ambiguous reports ambiguity from three operands on
+*/
+bool
+d_tests_sa_parse_forest_catalan
+(
+    struct d_test_counter* _counter
+)
+{
+    static const int catalan[8] = { 1, 1, 2, 5, 14, 42, 132, 429 };
+    int                       rhs_sum[3];
+    int                       rhs_number[1];
+    struct d_parse_symbol     symbols[3];
+    struct d_parse_production productions[2];
+    struct d_parse_grammar    grammar;
+    struct d_parse_runtime    runtime;
+    struct d_parse_result     parse_result;
+    struct d_parse_forest     forest;
+    char                      input[32];
+    size_t                    length;
+    bool                      result;
+    bool                      counts_match;
+    bool                      all_valid;
+    bool                      ambiguity_match;
+    int                       n;
+
+    result = true;
+
+    symbols[0].name   = (char*)"E";
+    symbols[0].kind   = D_PARSE_SYMBOL_KIND_NONTERM;
+    symbols[0].is_lhs = 1;
+    symbols[1].name   = (char*)"+";
+    symbols[1].kind   = D_PARSE_SYMBOL_KIND_TERM;
+    symbols[1].is_lhs = 0;
+    symbols[2].name   = (char*)"NUMBER";
+    symbols[2].kind   = D_PARSE_SYMBOL_KIND_TERM;
+    symbols[2].is_lhs = 0;
+
+    rhs_sum[0]    = 0;
+    rhs_sum[1]    = 1;
+    rhs_sum[2]    = 0;
+    rhs_number[0] = 2;
+
+    productions[0].lhs_index   = 0;
+    productions[0].rhs_indices = rhs_sum;
+    productions[0].rhs_length  = 3;
+    productions[1].lhs_index   = 0;
+    productions[1].rhs_indices = rhs_number;
+    productions[1].rhs_length  = 1;
+
+    d_tests_sa_parse_forest_internal_grammar(&grammar, symbols, 3,
+                                             productions, 2);
+
+    counts_match    = true;
+    all_valid       = true;
+    ambiguity_match = true;
+    length          = 0;
+
+    d_parse_runtime_init(&runtime, &grammar, NULL);
+
+    // "1", "1+2", "1+2+3", ...
+    for (n = 1; n <= 8; n++)
+    {
+        length += (size_t)snprintf(input + length,
+                                   sizeof(input) - length,
+                                   (n == 1) ? "%d" : "+%d",
+                                   n);
+
+        if (d_tests_sa_parse_forest_internal_count(&grammar,
+                                                   input,
+                                                   &all_valid)
+                != catalan[n - 1])
+        {
+            counts_match = false;
+        }
+
+        if ( (!d_parse_runtime_parse_forest(&runtime,
+                                            input,
+                                            &parse_result,
+                                            &forest)) ||
+             (d_parse_forest_is_ambiguous(&forest) != (n >= 3)) )
+        {
+            ambiguity_match = false;
+        }
+
+        d_parse_forest_destroy(&forest);
+        d_parse_result_destroy(&parse_result);
+    }
+
+    d_parse_runtime_destroy(&runtime);
+
+    // test 1: tree counts
+    result = d_assert_standalone(
+        counts_match,
+        "forest_catalan_counts",
+        "n operands of E -> E + E should yield Catalan(n - 1) trees",
+        _counter) && result;
+
+    // test 2: every tree is a derivation
+    result = d_assert_standalone(
+        all_valid,
+        "forest_catalan_valid",
+        "Every enumerated tree should be a complete derivation",
+        _counter) && result;
+
+    // test 3: ambiguity
+    result = d_assert_standalone(
+        ambiguity_match,
+        "forest_catalan_ambiguous",
+        "The forest should be ambiguous from three operands on",
+        _counter) && result;
+
+    return result;
+}
+
+
+/*
+d_tests_sa_parse_forest_cyclic
+  Tests d_parse_forest_iter_next on cyclic grammars, whose forests contain
+nodes that derive themselves.
+  Tests the following:
+  - `S -> S | a` yields exactly the tree S(a), with the productions in
+    either order
+  - a two-step cycle `S -> T | a`, `T -> S | b` yields only S(a) for "a"
+    and S(T(b)) for "b"
+  - no yielded tree contains a cut-off node
+*/
+bool
+d_tests_sa_parse_forest_cyclic
+(
+    struct d_test_counter* _counter
+)
+{
+    int                       rhs_s[1];
+    int                       rhs_t[1];
+    int                       rhs_a[1];
+    int                       rhs_b[1];
+    struct d_parse_symbol     symbols[4];
+    struct d_parse_production productions[4];
+    struct d_parse_production swapped[2];
+    struct d_parse_grammar    grammar;
+    bool                      result;
+    bool                      all_valid;
+    int                       count;
+    int                       count_swapped;
+    int                       count_a;
+    int                       count_b;
+
+    result = true;
+
+    symbols[0].name   = (char*)"S";
+    symbols[0].kind   = D_PARSE_SYMBOL_KIND_NONTERM;
+    symbols[0].is_lhs = 1;
+    symbols[1].name   = (char*)"a";
+    symbols[1].kind   = D_PARSE_SYMBOL_KIND_TERM;
+    symbols[1].is_lhs = 0;
+    symbols[2].name   = (char*)"T";
+    symbols[2].kind   = D_PARSE_SYMBOL_KIND_NONTERM;
+    symbols[2].is_lhs = 1;
+    symbols[3].name   = (char*)"b";
+    symbols[3].kind   = D_PARSE_SYMBOL_KIND_TERM;
+    symbols[3].is_lhs = 0;
+
+    rhs_s[0] = 0;
+    rhs_a[0] = 1;
+    rhs_t[0] = 2;
+    rhs_b[0] = 3;
+
+    // S -> S | a
+    productions[0].lhs_index   = 0;
+    productions[0].rhs_indices = rhs_s;
+    productions[0].rhs_length  = 1;
+    productions[1].lhs_index   = 0;
+    productions[1].rhs_indices = rhs_a;
+    productions[1].rhs_length  = 1;
+    swapped[0]                 = productions[1];
+    swapped[1]                 = productions[0];
+
+    all_valid = true;
+
+    d_tests_sa_parse_forest_internal_grammar(&grammar, symbols, 2,
+                                             productions, 2);
+    count = d_tests_sa_parse_forest_internal_count(&grammar, "a", &all_valid);
+
+    d_tests_sa_parse_forest_internal_grammar(&grammar, symbols, 2,
+                                             swapped, 2);
+    count_swapped = d_tests_sa_parse_forest_internal_count(&grammar,
+                                                           "a",
+                                                           &all_valid);
+
+    // test 1: self-loop
+    result = d_assert_standalone(
+        (count == 1) &&
+        (count_swapped == 1) &&
+        (all_valid),
+        "forest_cyclic_self",
+        "S -> S | a should yield only the complete tree S(a)",
+        _counter) && result;
+
+    // S -> T | a, T -> S | b
+    productions[0].lhs_index   = 0;
+    productions[0].rhs_indices = rhs_t;
+    productions[0].rhs_length  = 1;
+    productions[1].lhs_index   = 0;
+    productions[1].rhs_indices = rhs_a;
+    productions[1].rhs_length  = 1;
+    productions[2].lhs_index   = 2;
+    productions[2].rhs_indices = rhs_s;
+    productions[2].rhs_length  = 1;
+    productions[3].lhs_index   = 2;
+    productions[3].rhs_indices = rhs_b;
+    productions[3].rhs_length  = 1;
+
+    all_valid = true;
+
+    d_tests_sa_parse_forest_internal_grammar(&grammar, symbols, 4,
+                                             productions, 4);
+    count_a = d_tests_sa_parse_forest_internal_count(&grammar,
+                                                     "a",
+                                                     &all_valid);
+    count_b = d_tests_sa_parse_forest_internal_count(&grammar,
+                                                     "b",
+                                                     &all_valid);
+
+    // test 2: two-step cycle
+    result = d_assert_standalone(
+        (count_a == 1) &&
+        (count_b == 1) &&
+        (all_valid),
+        "forest_cyclic_mutual",
+        "S -> T | a, T -> S | b should yield one complete tree per input",
+        _counter) && result;
+
+    return result;
+}
+
+
+/*
+d_tests_sa_parse_forest_long_input
+  Tests d_parse_runtime_parse_forest on a long input whose single tree is
+as deep as the input is long: `L -> L , NUMBER | NUMBER` over 25001 numbers
+(50001 tokens).
+  Tests the following:
+  - the forest is built without exhausting the stack
+  - it holds exactly one tree, which uses every node of the forest
+  - the tree covers every token
+  - the tree materializes without exhausting the stack
+*/
+bool
+d_tests_sa_parse_forest_long_input
+(
+    struct d_test_counter* _counter
+)
+{
+    const size_t               numbers = 25001;
+    int                        rhs_list[3];
+    int                        rhs_number[1];
+    struct d_parse_symbol      symbols[3];
+    struct d_parse_production  productions[2];
+    struct d_parse_grammar     grammar;
+    struct d_parse_runtime     runtime;
+    struct d_parse_result      parse_result;
+    struct d_parse_forest      forest;
+    struct d_parse_forest_iter iter;
+    struct d_parse_tree_node*  tree;
+    struct d_parse_tree_node*  node;
+    struct d_parse_tree_node** stack;
+    char*                      input;
+    bool                       result;
+    bool                       parsed;
+    bool                       single;
+    size_t                     terminals;
+    size_t                     built_terminals;
+    size_t                     top;
+    size_t                     i;
+
+    result = true;
+
+    symbols[0].name   = (char*)"L";
+    symbols[0].kind   = D_PARSE_SYMBOL_KIND_NONTERM;
+    symbols[0].is_lhs = 1;
+    symbols[1].name   = (char*)",";
+    symbols[1].kind   = D_PARSE_SYMBOL_KIND_TERM;
+    symbols[1].is_lhs = 0;
+    symbols[2].name   = (char*)"NUMBER";
+    symbols[2].kind   = D_PARSE_SYMBOL_KIND_TERM;
+    symbols[2].is_lhs = 0;
+
+    rhs_list[0]   = 0;
+    rhs_list[1]   = 1;
+    rhs_list[2]   = 2;
+    rhs_number[0] = 2;
+
+    productions[0].lhs_index   = 0;
+    productions[0].rhs_indices = rhs_list;
+    productions[0].rhs_length  = 3;
+    productions[1].lhs_index   = 0;
+    productions[1].rhs_indices = rhs_number;
+    productions[1].rhs_length  = 1;
+
+    d_tests_sa_parse_forest_internal_grammar(&grammar, symbols, 3,
+                                             productions, 2);
+
+    // "1,1,...,1"
+    input = malloc(numbers * 2);
+
+    if (!input)
+    {
+        return d_assert_standalone(false,
+                                   "forest_long_alloc",
+                                   "Failed to allocate the input",
+                                   _counter);
+    }
+
+    for (i = 0; i < numbers; i++)
+    {
+        input[i * 2]     = '1';
+        input[i * 2 + 1] = ',';
+    }
+
+    input[numbers * 2 - 1] = '\0';
+
+    d_parse_runtime_init(&runtime, &grammar, NULL);
+
+    parsed = (d_parse_runtime_parse_forest(&runtime,
+                                           input,
+                                           &parse_result,
+                                           &forest) == 1);
+
+    // test 1: the forest is built over the whole input
+    result = d_assert_standalone(
+        (parsed) &&
+        (runtime.token_count == numbers * 2) &&
+        (forest.root != D_PARSE_FOREST_NONE) &&
+        (forest.nodes[forest.root].end == numbers * 2 - 1) &&
+        (!d_parse_forest_is_ambiguous(&forest)),
+        "forest_long_build",
+        "A 50001-token left-recursive list should build one forest",
+        _counter) && result;
+
+    // walk the single tree in place, then materialize it
+    single          = false;
+    terminals       = 0;
+    built_terminals = 0;
+    tree            = NULL;
+
+    if (d_parse_forest_iter_init(&iter, &forest))
+    {
+        single = (d_parse_forest_iter_next(&iter) == 1) &&
+                 (iter.order_count == forest.node_count);
+
+        for (i = 0; i < iter.order_count; i++)
+        {
+            if (forest.nodes[iter.order[i]].kind ==
+                    D_PARSE_FOREST_NODE_TERMINAL)
+            {
+                terminals++;
+            }
+        }
+
+        tree   = single ? d_parse_forest_iter_build_tree(&iter) : NULL;
+        single = single && (d_parse_forest_iter_next(&iter) == 0);
+    }
+
+    // test 2: exactly one tree, covering every token
+    result = d_assert_standalone(
+        (single) &&
+        (terminals == numbers * 2 - 1),
+        "forest_long_tree",
+        "The forest should hold one tree over every token",
+        _counter) && result;
+
+    // count the materialized terminals without recursing
+    stack = malloc(numbers * 2 * sizeof(*stack));
+
+    if ( (tree) && (stack) )
+    {
+        top          = 0;
+        stack[top++] = tree;
+
+        while (top > 0)
+        {
+            node = stack[--top];
+
+            if (node->type == D_PARSE_TREE_NODE_TERMINAL)
+            {
+                built_terminals++;
+            }
+
+            for (i = 0; i < node->child_count; i++)
+            {
+                stack[top++] = node->children[i];
+            }
+        }
+    }
+
+    // test 3: the 25001-deep tree is materialized in full
+    result = d_assert_standalone(
+        (tree) &&
+        (tree->production_index == 0) &&
+        (tree->child_count == 3) &&
+        (built_terminals == numbers * 2 - 1),
+        "forest_long_build_tree",
+        "The deep tree should materialize with every token",
+        _counter) && result;
+
+    free(stack);
+    d_parse_tree_node_destroy(tree);
+
+    d_parse_forest_iter_destroy(&iter);
+    d_parse_forest_destroy(&forest);
+    d_parse_result_destroy(&parse_result);
+    d_parse_runtime_destroy(&runtime);
+    free(input);
+
+    return result;
+}
+
+
+/*
+d_tests_sa_parse_forest_all
+  Aggregation function that runs all parse forest tests.
+*/
+bool
+d_tests_sa_parse_forest_all
+(
+    struct d_test_counter* _counter
+)
+{
+    bool result;
+
+    result = true;
+
+    printf("\n  [SECTION] Parse Forest\n");
+    printf("  ----------------------\n");
+
+    result = d_tests_sa_parse_forest_catalan(_counter) && result;
+    result = d_tests_sa_parse_forest_cyclic(_counter) && result;
+    result = d_tests_sa_parse_forest_long_input(_counter) && result;
+
+    return result;
+}
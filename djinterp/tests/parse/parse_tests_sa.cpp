@@ -0,0 +1,32 @@
+#include ".\parse_tests_sa.h"
+
+
+/*
+d_tests_sa_parse_run_all
+  Module-level aggregation function that runs all parse tests.
+  Executes tests for all categories:
+  - Character set scans
+  - Source scans
+  - Repetition
+  - Memoization
+  - Performance
+*/
+bool
+d_tests_sa_parse_run_all
+(
+    struct d_test_counter* _counter
+)
+{
+    bool result;
+
+    result = true;
+
+    // run all test categories
+    result = d_tests_sa_parse_char_set_all(_counter) && result;
+    result = d_tests_sa_parse_source_all(_counter) && result;
+    result = d_tests_sa_parse_repetition_all(_counter) && result;
+    result = d_tests_sa_parse_memo_all(_counter) && result;
+    result = d_tests_sa_parse_performance_all(_counter) && result;
+
+    return result;
+}
@@ -0,0 +1,209 @@
+/******************************************************************************
+* djinterp [test]                                             parse_tests_sa.h
+*
+*   Unit test declarations for `parse.h` module.
+*   Covers the bulk character scans: d_char_set span()/find() checked against
+* a per-byte reference over every byte value, scan_while()/skip_until() at the
+* end of input, and many(satisfy(p)) on its bulk and element-by-element
+* paths; memoization: hits, window eviction, reset, a backtracking grammar
+* and D_CFG_PARSE_ENABLE_MEMOIZATION=0; plus a scan benchmark.
+*
+*
+* path:      \tests\parse\parse_tests_sa.h
+* link:      TBA
+* author(s): Samuel 'teer' Neal-Blim                          date: 2026.10.18
+******************************************************************************/
+
+#ifndef DJINTERP_TESTS_PARSE_STANDALONE_
+#define DJINTERP_TESTS_PARSE_STANDALONE_ 1
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <list>
+#include <string>
+#include <vector>
+#include "..\..\inc\c\test\test_standalone.h"
+#include "..\..\inc\parse\parse.h"
+
+
+#ifndef D_TEST_PARSE_BENCH_LENGTH
+    // D_TEST_PARSE_BENCH_LENGTH
+    //   constant: number of input bytes scanned by the performance tests.
+    #define D_TEST_PARSE_BENCH_LENGTH 4000000
+#endif  // D_TEST_PARSE_BENCH_LENGTH
+
+
+/******************************************************************************
+ * I. CHARACTER SET SCAN TESTS
+ *****************************************************************************/
+bool d_tests_sa_parse_char_set_every_byte(struct d_test_counter* _counter);
+bool d_tests_sa_parse_char_set_random(struct d_test_counter* _counter);
+bool d_tests_sa_parse_char_set_special(struct d_test_counter* _counter);
+
+// I.   aggregation function
+bool d_tests_sa_parse_char_set_all(struct d_test_counter* _counter);
+
+
+/******************************************************************************
+ * II. SOURCE SCAN TESTS
+ *****************************************************************************/
+bool d_tests_sa_parse_source_scan_end(struct d_test_counter* _counter);
+
+// II.  aggregation function
+bool d_tests_sa_parse_source_all(struct d_test_counter* _counter);
+
+
+/******************************************************************************
+ * III. REPETITION TESTS
+ *****************************************************************************/
+bool d_tests_sa_parse_many_bulk(struct d_test_counter* _counter);
+bool d_tests_sa_parse_take_while(struct d_test_counter* _counter);
+
+// III. aggregation function
+bool d_tests_sa_parse_repetition_all(struct d_test_counter* _counter);
+
+
+/******************************************************************************
+ * IV. MEMOIZATION TESTS
+ *****************************************************************************/
+
+// d_tests_sa_parse_counted_digit
+//   struct: digit predicate that counts its calls. `_Tag` keeps the memo
+// parsers built on it distinct between the translation units compiled with
+// and without D_CFG_PARSE_ENABLE_MEMOIZATION.
+template<typename _Tag>
+struct d_tests_sa_parse_counted_digit
+{
+    std::size_t* calls;
+
+    bool
+    operator()
+    (
+        char _ch
+    ) const
+    {
+        ++(*calls);
+
+        return (_ch >= '0') && (_ch <= '9');
+    }
+};
+
+template<typename _Tag>
+class d_tests_sa_parse_backtrack;
+
+// d_tests_sa_parse_backtrack_state
+//   struct: the memo parser that d_tests_sa_parse_backtrack recurses
+// through, and the number of times the grammar itself ran.
+template<typename _Tag>
+struct d_tests_sa_parse_backtrack_state
+{
+    djinterp::d_memo_parser<d_tests_sa_parse_backtrack<_Tag>,
+                            djinterp::d_memory_source<char>>* self;
+    std::size_t                                               invocations;
+};
+
+// d_tests_sa_parse_backtrack
+//   class: parser for P -> 'a' P 'x' | 'a' P 'y' | 'a', returning the number
+// of characters matched. Each alternative re-parses the inner P at the same
+// offset, so without memoization a run of n 'a's costs 2^n invocations.
+template<typename _Tag>
+class d_tests_sa_parse_backtrack
+    : public djinterp::d_parser_base<d_tests_sa_parse_backtrack<_Tag>,
+                                     std::size_t,
+                                     char>
+{
+public:
+    using base_type    = djinterp::d_parser_base<d_tests_sa_parse_backtrack<_Tag>,
+                                                 std::size_t,
+                                                 char>;
+    using parse_result = typename base_type::parse_result;
+
+private:
+    d_tests_sa_parse_backtrack_state<_Tag>* m_state;
+
+public:
+    // d_tests_sa_parse_backtrack
+    //   constructor: creates the grammar; `_state->self` must be set before
+    // parsing.
+    explicit
+    d_tests_sa_parse_backtrack(d_tests_sa_parse_backtrack_state<_Tag>* _state)
+        : m_state(_state)
+    {}
+
+    // parse_impl
+    //   implementation: tries each alternative in turn from after the 'a'.
+    template<typename _Source>
+    parse_result
+    parse_impl
+    (
+        _Source& _source
+    )
+    {
+        static const char           closers[2] = { 'x', 'y' };
+        typename _Source::mark_type after_a;
+        parse_result                inner;
+        int                         i;
+
+        ++m_state->invocations;
+
+        if ( (_source.eof()) ||
+             (_source.peek() != 'a') )
+        {
+            return parse_result::make_failure("expected 'a'",
+                                              _source.position());
+        }
+
+        _source.read();
+        after_a = _source.mark();
+
+        // 'a' P 'x' | 'a' P 'y'
+        for (i = 0; i < 2; ++i)
+        {
+            inner = m_state->self->parse(_source);
+
+            if ( (inner.success()) &&
+                 (!_source.eof()) &&
+                 (_source.peek() == closers[i]) )
+            {
+                _source.read();
+
+                return parse_result::make_success(inner.value() + 2);
+            }
+
+            _source.restore(after_a);
+        }
+
+        // 'a'
+        return parse_result::make_success(1);
+    }
+};
+
+bool d_tests_sa_parse_memo_hit(struct d_test_counter* _counter);
+bool d_tests_sa_parse_memo_eviction(struct d_test_counter* _counter);
+bool d_tests_sa_parse_memo_reset(struct d_test_counter* _counter);
+bool d_tests_sa_parse_memo_backtracking(struct d_test_counter* _counter);
+bool d_tests_sa_parse_memo_disabled(struct d_test_counter* _counter);
+
+// IV.  aggregation function
+bool d_tests_sa_parse_memo_all(struct d_test_counter* _counter);
+
+
+/******************************************************************************
+ * V. PERFORMANCE TESTS
+ *****************************************************************************/
+bool d_tests_sa_parse_performance(struct d_test_counter* _counter);
+
+// V.   aggregation function
+bool d_tests_sa_parse_performance_all(struct d_test_counter* _counter);
+
+
+/******************************************************************************
+ * MODULE-LEVEL AGGREGATION
+ *****************************************************************************/
+bool d_tests_sa_parse_run_all(struct d_test_counter* _counter);
+
+
+#endif  // DJINTERP_TESTS_PARSE_STANDALONE_
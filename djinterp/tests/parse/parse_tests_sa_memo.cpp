@@ -0,0 +1,463 @@
+#include ".\parse_tests_sa.h"
+
+using namespace djinterp;
+
+
+///////////////////////////////////////////////////////////////////////////////
+// file-scope helpers
+///////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+    // d_tests_sa_parse_memo_tag
+    //   struct: instantiation tag for the memoizing build of the test parsers.
+    struct d_tests_sa_parse_memo_tag
+    {};
+}
+
+using memo_source_type  = d_memory_source<char>;
+using memo_digit_type   = d_tests_sa_parse_counted_digit<d_tests_sa_parse_memo_tag>;
+using memo_state_type   = d_tests_sa_parse_backtrack_state<d_tests_sa_parse_memo_tag>;
+using memo_grammar_type = d_tests_sa_parse_backtrack<d_tests_sa_parse_memo_tag>;
+
+// helper: moves `_source` to `_offset` elements past `_start`
+static void
+d_tests_sa_parse_memo_internal_seek
+(
+    memo_source_type&                  _source,
+    const memo_source_type::mark_type& _start,
+    std::size_t                        _offset
+)
+{
+    _source.restore(_start);
+
+    while (_source.offset() < _offset)
+    {
+        _source.read();
+    }
+
+    return;
+}
+
+
+/******************************************************************************
+ * IV. MEMOIZATION TESTS
+ *****************************************************************************/
+
+/*
+d_tests_sa_parse_memo_hit
+  Tests d_memo_parser replaying a stored result at the same offset.
+  Tests the following:
+  - a second parse at the offset returns the stored result without running
+    the wrapped parser
+  - the hit restores the end mark: same offset, column and next character
+  - copies of a memo parser share its table
+  - failures are memoized too, and leave the source where it was
+*/
+bool
+d_tests_sa_parse_memo_hit
+(
+    struct d_test_counter* _counter
+)
+{
+    std::string                 text;
+    std::size_t                 calls;
+    std::size_t                 first_calls;
+    std::size_t                 first_offset;
+    std::size_t                 first_column;
+    memo_source_type::mark_type start;
+    d_memo_context              context(8);
+    bool                        result;
+
+    result = true;
+    text   = "12345x678y";
+    calls  = 0;
+
+    auto source = make_memory_source(text.data(), text.size());
+    auto number = memo<memo_source_type>(
+                      many1(satisfy(memo_digit_type{ &calls })),
+                      context);
+
+    start        = source.mark();
+    auto first   = number.parse(source);
+    first_calls  = calls;
+    first_offset = source.offset();
+    first_column = source.position().column;
+
+    source.restore(start);
+    auto second = number.parse(source);
+
+    // test 1: hit returns the stored result
+    result = d_assert_standalone(
+        (first.success()) &&
+        (second.success()) &&
+        (second.value() == first.value()) &&
+        (calls == first_calls) &&
+        (context.hits() == 1) &&
+        (context.misses() == 1),
+        "memo_hit_result",
+        "A repeated parse should replay the stored result",
+        _counter) && result;
+
+    // test 2: hit restores the end mark
+    result = d_assert_standalone(
+        (first_offset == 5) &&
+        (source.offset() == first_offset) &&
+        (source.position().column == first_column) &&
+        (source.peek() == 'x'),
+        "memo_hit_end_mark",
+        "A hit should leave the source where the stored match ended",
+        _counter) && result;
+
+    // test 3: copies share the table
+    {
+        auto copy = number;
+
+        source.restore(start);
+        auto third = copy.parse(source);
+
+        result = d_assert_standalone(
+            (third.success()) &&
+            (calls == first_calls) &&
+            (context.hits() == 2) &&
+            (source.offset() == first_offset),
+            "memo_hit_copy",
+            "A copy of a memo parser should hit the original's entries",
+            _counter) && result;
+    }
+
+    // test 4: memoized failure at 'x'
+    {
+        std::size_t before;
+
+        auto failure = number.parse(source);
+        before       = calls;
+        auto again   = number.parse(source);
+
+        result = d_assert_standalone(
+            (failure.failed()) &&
+            (again.failed()) &&
+            (calls == before) &&
+            (source.offset() == first_offset) &&
+            (context.hits() == 3) &&
+            (context.misses() == 2),
+            "memo_hit_failure",
+            "A failure should be replayed without consuming input",
+            _counter) && result;
+    }
+
+    return result;
+}
+
+
+/*
+d_tests_sa_parse_memo_eviction
+  Tests the retention window of d_memo_context.
+  Tests the following:
+  - the window is rounded up to a power of two
+  - an entry is retained while the furthest offset is less than a window
+    past it
+  - once the furthest offset moves a window past it, the entry is evicted and
+    the result is computed again (and is still correct)
+*/
+bool
+d_tests_sa_parse_memo_eviction
+(
+    struct d_test_counter* _counter
+)
+{
+    std::string                 text;
+    std::size_t                 calls;
+    memo_source_type::mark_type start;
+    d_memo_context              context(3);
+    bool                        result;
+    bool                        retained;
+    bool                        evicted;
+
+    result = true;
+    text   = "0123456789";
+    calls  = 0;
+
+    // test 1: window rounding
+    result = d_assert_standalone(
+        (context.window() == 4) &&
+        (d_memo_context(0).window() == 1) &&
+        (d_memo_context(4).window() == 4) &&
+        (d_memo_context(5).window() == 8),
+        "memo_window_rounding",
+        "The window should round up to a power of two",
+        _counter) && result;
+
+    auto source = make_memory_source(text.data(), text.size());
+    auto digit1 = memo<memo_source_type>(satisfy(memo_digit_type{ &calls }),
+                                         context);
+
+    start = source.mark();
+
+    // offsets 0 and 3: 0 is still within a window of 4 of offset 3
+    digit1.parse(source);
+    d_tests_sa_parse_memo_internal_seek(source, start, 3);
+    digit1.parse(source);
+    d_tests_sa_parse_memo_internal_seek(source, start, 0);
+    auto kept = digit1.parse(source);
+
+    retained = (kept.success()) &&
+               (kept.value() == '0') &&
+               (calls == 2) &&
+               (context.hits() == 1) &&
+               (context.furthest() == 3) &&
+               (context.in_window(0));
+
+    // test 2: retained within the window
+    result = d_assert_standalone(
+        retained,
+        "memo_window_retained",
+        "An entry within the window of the furthest offset should hit",
+        _counter) && result;
+
+    // offset 5: 0 is now more than a window behind
+    d_tests_sa_parse_memo_internal_seek(source, start, 5);
+    digit1.parse(source);
+    d_tests_sa_parse_memo_internal_seek(source, start, 0);
+    auto recomputed = digit1.parse(source);
+
+    evicted = (recomputed.success()) &&
+              (recomputed.value() == '0') &&
+              (source.offset() == 1) &&
+              (calls == 4) &&
+              (context.hits() == 1) &&
+              (context.misses() == 4) &&
+              (!context.in_window(1)) &&
+              (context.in_window(2));
+
+    // test 3: evicted behind the window
+    result = d_assert_standalone(
+        evicted,
+        "memo_window_evicted",
+        "An entry a window behind the furthest offset should be recomputed",
+        _counter) && result;
+
+    return result;
+}
+
+
+/*
+d_tests_sa_parse_memo_reset
+  Tests d_memo_context::reset, which invalidates every entry by advancing the
+generation.
+  Tests the following:
+  - reset() advances the generation and clears furthest, hits and misses
+  - after reset(), a parse of a new input at a previously stored offset is
+    computed, not replayed from the old input
+  - entries recorded after reset() hit as usual
+*/
+bool
+d_tests_sa_parse_memo_reset
+(
+    struct d_test_counter* _counter
+)
+{
+    std::string    digits;
+    std::string    letters;
+    std::size_t    calls;
+    std::size_t    before;
+    std::uint32_t  generation;
+    d_memo_context context(8);
+    bool           result;
+
+    result  = true;
+    digits  = "123";
+    letters = "abc";
+    calls   = 0;
+
+    auto number       = memo<memo_source_type>(
+                            many1(satisfy(memo_digit_type{ &calls })),
+                            context);
+    auto digit_source = make_memory_source(digits.data(), digits.size());
+    auto digit_start  = digit_source.mark();
+    auto first        = number.parse(digit_source);
+
+    digit_source.restore(digit_start);
+    number.parse(digit_source);
+
+    generation = context.generation();
+    context.reset();
+
+    // test 1: reset clears the context
+    result = d_assert_standalone(
+        (first.success()) &&
+        (calls == 3) &&
+        (context.generation() == generation + 1) &&
+        (context.furthest() == 0) &&
+        (context.hits() == 0) &&
+        (context.misses() == 0),
+        "memo_reset_context",
+        "reset() should advance the generation and clear the counters",
+        _counter) && result;
+
+    auto letter_source = make_memory_source(letters.data(), letters.size());
+    auto start         = letter_source.mark();
+
+    before      = calls;
+    auto second = number.parse(letter_source);
+
+    // test 2: old entries are invalid
+    result = d_assert_standalone(
+        (second.failed()) &&
+        (calls == before + 1) &&
+        (context.hits() == 0) &&
+        (context.misses() == 1) &&
+        (letter_source.offset() == 0),
+        "memo_reset_invalidates",
+        "After reset() the new input should be parsed, not replayed",
+        _counter) && result;
+
+    letter_source.restore(start);
+    auto third = number.parse(letter_source);
+
+    // test 3: new entries hit
+    result = d_assert_standalone(
+        (third.failed()) &&
+        (calls == before + 1) &&
+        (context.hits() == 1),
+        "memo_reset_new_entries",
+        "Entries recorded after reset() should hit",
+        _counter) && result;
+
+    return result;
+}
+
+
+/*
+d_tests_sa_parse_memo_backtracking
+  Tests memoization of P -> 'a' P 'x' | 'a' P 'y' | 'a' on n 'a's followed
+by n - 1 'y's. Without memoization P runs 2^(n + 1) - 1 times; memoized, it
+runs once per offset.
+  Tests the following:
+  - the whole input is matched, for n = 1 .. 64
+  - misses and invocations of P are exactly n + 1, and hits exactly n
+  - with a window smaller than the input the result is still correct
+*/
+bool
+d_tests_sa_parse_memo_backtracking
+(
+    struct d_test_counter* _counter
+)
+{
+    static const std::size_t lengths[] = { 1, 2, 3, 8, 16, 32, 64 };
+    std::string              text;
+    std::size_t              n;
+    std::size_t              i;
+    bool                     result;
+    bool                     matched;
+    bool                     linear;
+
+    result  = true;
+    matched = true;
+    linear  = true;
+
+    for (i = 0; i < sizeof(lengths) / sizeof(lengths[0]); ++i)
+    {
+        memo_state_type state;
+        d_memo_context  context(256);
+
+        n = lengths[i];
+        text.assign(n, 'a');
+        text.append(n - 1, 'y');
+
+        state.self        = nullptr;
+        state.invocations = 0;
+
+        auto source  = make_memory_source(text.data(), text.size());
+        auto grammar = memo<memo_source_type>(memo_grammar_type(&state),
+                                              context);
+
+        state.self = &grammar;
+        auto parsed = grammar.parse(source);
+
+        if ( (!parsed.success()) ||
+             (parsed.value() != (2 * n) - 1) ||
+             (!source.eof()) )
+        {
+            matched = false;
+        }
+
+        if ( (context.misses() != n + 1) ||
+             (state.invocations != n + 1) ||
+             (context.hits() != n) )
+        {
+            linear = false;
+        }
+    }
+
+    // test 1: whole input matched
+    result = d_assert_standalone(
+        matched,
+        "memo_backtracking_match",
+        "P should match n 'a's and n - 1 'y's whole",
+        _counter) && result;
+
+    // test 2: linear work
+    result = d_assert_standalone(
+        linear,
+        "memo_backtracking_linear",
+        "P should be computed once per offset (n + 1 misses, n hits)",
+        _counter) && result;
+
+    // test 3: window smaller than the input
+    {
+        memo_state_type state;
+        d_memo_context  context(2);
+
+        n = 12;
+        text.assign(n, 'a');
+        text.append(n - 1, 'y');
+
+        state.self        = nullptr;
+        state.invocations = 0;
+
+        auto source  = make_memory_source(text.data(), text.size());
+        auto grammar = memo<memo_source_type>(memo_grammar_type(&state),
+                                              context);
+
+        state.self = &grammar;
+        auto parsed = grammar.parse(source);
+
+        result = d_assert_standalone(
+            (parsed.success()) &&
+            (parsed.value() == (2 * n) - 1) &&
+            (source.eof()),
+            "memo_backtracking_small_window",
+            "A window smaller than the input should not change the result",
+            _counter) && result;
+    }
+
+    return result;
+}
+
+
+/*
+d_tests_sa_parse_memo_all
+  Aggregation function that runs all memoization tests.
+*/
+bool
+d_tests_sa_parse_memo_all
+(
+    struct d_test_counter* _counter
+)
+{
+    bool result;
+
+    result = true;
+
+    printf("\n  [SECTION] Memoization\n");
+    printf("  ---------------------\n");
+
+    result = d_tests_sa_parse_memo_hit(_counter) && result;
+    result = d_tests_sa_parse_memo_eviction(_counter) && result;
+    result = d_tests_sa_parse_memo_reset(_counter) && result;
+    result = d_tests_sa_parse_memo_backtracking(_counter) && result;
+    result = d_tests_sa_parse_memo_disabled(_counter) && result;
+
+    return result;
+}
@@ -0,0 +1,118 @@
+// this translation unit builds the memo parser with memoization disabled
+#define D_CFG_PARSE_ENABLE_MEMOIZATION 0
+
+#include ".\parse_tests_sa.h"
+
+using namespace djinterp;
+
+
+///////////////////////////////////////////////////////////////////////////////
+// file-scope helpers
+///////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+    // d_tests_sa_parse_memo_off_tag
+    //   struct: instantiation tag for the forwarding build of the test
+    // parsers, so they do not collide with the memoizing build.
+    struct d_tests_sa_parse_memo_off_tag
+    {};
+}
+
+using memo_off_source_type  = d_memory_source<char>;
+using memo_off_digit_type   = d_tests_sa_parse_counted_digit<d_tests_sa_parse_memo_off_tag>;
+using memo_off_state_type   = d_tests_sa_parse_backtrack_state<d_tests_sa_parse_memo_off_tag>;
+using memo_off_grammar_type = d_tests_sa_parse_backtrack<d_tests_sa_parse_memo_off_tag>;
+
+
+/******************************************************************************
+ * IV. MEMOIZATION TESTS
+ *****************************************************************************/
+
+/*
+d_tests_sa_parse_memo_disabled
+  Tests d_memo_parser with D_CFG_PARSE_ENABLE_MEMOIZATION set to 0, where it
+forwards every parse to the wrapped parser.
+  Tests the following:
+  - a repeated parse at one offset runs the wrapped parser again and returns
+    the same result
+  - the context records no hits, misses or offsets
+  - P -> 'a' P 'x' | 'a' P 'y' | 'a' on n = 10 runs 2^(n + 1) - 1 times
+*/
+bool
+d_tests_sa_parse_memo_disabled
+(
+    struct d_test_counter* _counter
+)
+{
+    std::string                     text;
+    std::size_t                     calls;
+    std::size_t                     first_calls;
+    std::size_t                     n;
+    memo_off_source_type::mark_type start;
+    memo_off_state_type             state;
+    d_memo_context                  context(8);
+    bool                            result;
+
+    result = true;
+    text   = "12345x";
+    calls  = 0;
+
+    auto source = make_memory_source(text.data(), text.size());
+    auto number = memo<memo_off_source_type>(
+                      many1(satisfy(memo_off_digit_type{ &calls })),
+                      context);
+
+    start       = source.mark();
+    auto first  = number.parse(source);
+    first_calls = calls;
+
+    source.restore(start);
+    auto second = number.parse(source);
+
+    // test 1: forwarded parse
+    result = d_assert_standalone(
+        (first.success()) &&
+        (second.success()) &&
+        (second.value() == first.value()) &&
+        (calls == 2 * first_calls) &&
+        (source.offset() == 5),
+        "memo_disabled_forwards",
+        "With memoization off every parse should run the wrapped parser",
+        _counter) && result;
+
+    // test 2: context untouched
+    result = d_assert_standalone(
+        (context.hits() == 0) &&
+        (context.misses() == 0) &&
+        (context.furthest() == 0),
+        "memo_disabled_context",
+        "With memoization off the context should record nothing",
+        _counter) && result;
+
+    n = 10;
+    text.assign(n, 'a');
+    text.append(n - 1, 'y');
+
+    state.self        = nullptr;
+    state.invocations = 0;
+
+    auto grammar_source = make_memory_source(text.data(), text.size());
+    auto grammar        = memo<memo_off_source_type>(
+                              memo_off_grammar_type(&state),
+                              context);
+
+    state.self  = &grammar;
+    auto parsed = grammar.parse(grammar_source);
+
+    // test 3: exponential without memoization
+    result = d_assert_standalone(
+        (parsed.success()) &&
+        (parsed.value() == (2 * n) - 1) &&
+        (state.invocations == (std::size_t{1} << (n + 1)) - 1),
+        "memo_disabled_backtracking",
+        "Without memoization P should run 2^(n + 1) - 1 times",
+        _counter) && result;
+
+    return result;
+}
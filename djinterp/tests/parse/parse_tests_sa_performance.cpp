@@ -0,0 +1,256 @@
+#include ".\parse_tests_sa.h"
+
+using namespace djinterp;
+
+
+///////////////////////////////////////////////////////////////////////////////
+// file-scope helpers
+///////////////////////////////////////////////////////////////////////////////
+
+// helper: monotonic time in microseconds
+static std::int64_t
+d_test_parse_perf_now_us()
+{
+    return static_cast<std::int64_t>(
+               std::chrono::duration_cast<std::chrono::microseconds>(
+                   std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+// helper: fills `_text` with words of 1 to 64 letters separated by single
+// spaces, from a fixed pseudo-random sequence
+static void
+d_test_parse_perf_fill
+(
+    std::string& _text,
+    std::size_t  _length
+)
+{
+    std::uint64_t state;
+    std::size_t   run;
+
+    state = 1;
+    _text.clear();
+    _text.reserve(_length);
+
+    while (_text.size() < _length)
+    {
+        state = (state * 6364136223846793005ull) + 1ull;
+        run   = 1 + static_cast<std::size_t>((state >> 33) % 64);
+
+        while ( (run-- > 0) &&
+                (_text.size() < _length) )
+        {
+            state = (state * 6364136223846793005ull) + 1ull;
+            _text.push_back(static_cast<char>('a' + ((state >> 33) % 26)));
+        }
+
+        _text.push_back(' ');
+    }
+
+    _text.resize(_length);
+
+    return;
+}
+
+// helper: prints one timing line relative to the per-byte baseline
+static void
+d_test_parse_perf_report
+(
+    const char*  _label,
+    std::int64_t _elapsed_us,
+    std::int64_t _baseline_us
+)
+{
+    printf("      %-28s %9lld us  (%.2fx per-byte)\n",
+           _label,
+           static_cast<long long>(_elapsed_us),
+           (_elapsed_us > 0) ? static_cast<double>(_baseline_us) /
+                                   static_cast<double>(_elapsed_us)
+                             : 0.0);
+
+    return;
+}
+
+
+/******************************************************************************
+ * V. PERFORMANCE TESTS
+ *****************************************************************************/
+
+/*
+d_tests_sa_parse_performance
+  Times splitting D_TEST_PARSE_BENCH_LENGTH bytes of space-separated words
+into letter runs, against a loop that tests one byte at a time, and prints
+the results. Only the letter count is asserted; timings vary by machine and
+are informational.
+  Tests the following:
+  - d_char_set span()/find() (AVX2 where enabled)
+  - d_memory_source scan_while()/skip_until()
+  - many(satisfy(is_alpha)) on the bulk path
+  - many(satisfy(lambda)), whose predicate has no table and is tested one
+    byte at a time
+*/
+bool
+d_tests_sa_parse_performance
+(
+    struct d_test_counter* _counter
+)
+{
+    d_char_class::d_char_set letters;
+    std::string              text;
+    std::size_t              length;
+    std::size_t              expected;
+    std::size_t              total;
+    std::size_t              i;
+    std::int64_t             start;
+    std::int64_t             baseline;
+    bool                     result;
+    bool                     counts_match;
+
+    result  = true;
+    length  = D_TEST_PARSE_BENCH_LENGTH;
+    letters = d_char_class::is_alpha().char_set();
+
+    d_test_parse_perf_fill(text, length);
+
+    printf("    %zu bytes of 1-64 letter words:\n", length);
+
+    // per-byte baseline
+    start    = d_test_parse_perf_now_us();
+    expected = 0;
+    i        = 0;
+
+    while (i < length)
+    {
+        while ( (i < length) &&
+                (letters.contains(text[i])) )
+        {
+            ++expected;
+            ++i;
+        }
+
+        while ( (i < length) &&
+                (!letters.contains(text[i])) )
+        {
+            ++i;
+        }
+    }
+
+    baseline = d_test_parse_perf_now_us() - start;
+    d_test_parse_perf_report("per-byte contains()", baseline, baseline);
+
+    // d_char_set::span / find
+    start = d_test_parse_perf_now_us();
+    total = 0;
+    i     = 0;
+
+    while (i < length)
+    {
+        std::size_t run;
+
+        run    = letters.span(text.data() + i, length - i);
+        total += run;
+        i     += run;
+        i     += letters.find(text.data() + i, length - i);
+    }
+
+    d_test_parse_perf_report("d_char_set span/find",
+                             d_test_parse_perf_now_us() - start,
+                             baseline);
+    counts_match = (total == expected);
+
+    // memory source scan_while / skip_until
+    {
+        auto source = make_memory_source(text.data(), text.size());
+
+        start = d_test_parse_perf_now_us();
+        total = 0;
+
+        while (!source.eof())
+        {
+            total += source.scan_while(d_char_class::is_alpha());
+            source.skip_until(d_char_class::is_alpha());
+        }
+
+        d_test_parse_perf_report("scan_while/skip_until",
+                                 d_test_parse_perf_now_us() - start,
+                                 baseline);
+        counts_match = (total == expected) && counts_match;
+    }
+
+    // many(satisfy(is_alpha)): bulk path
+    {
+        auto source = make_memory_source(text.data(), text.size());
+        auto word   = many(satisfy<d_char_class::is_alpha, char>(
+                               d_char_class::is_alpha()));
+
+        start = d_test_parse_perf_now_us();
+        total = 0;
+
+        while (!source.eof())
+        {
+            total += word.parse(source).value().size();
+            source.skip_until(d_char_class::is_alpha());
+        }
+
+        d_test_parse_perf_report("many(satisfy(is_alpha))",
+                                 d_test_parse_perf_now_us() - start,
+                                 baseline);
+        counts_match = (total == expected) && counts_match;
+    }
+
+    // many(satisfy(lambda)): one predicate call per byte
+    {
+        auto source = make_memory_source(text.data(), text.size());
+        auto word   = many(satisfy([](char _ch)
+                                   {
+                                       return ( (_ch >= 'a') && (_ch <= 'z') ) ||
+                                              ( (_ch >= 'A') && (_ch <= 'Z') );
+                                   }));
+
+        start = d_test_parse_perf_now_us();
+        total = 0;
+
+        while (!source.eof())
+        {
+            total += word.parse(source).value().size();
+            source.skip_until(d_char_class::is_alpha());
+        }
+
+        d_test_parse_perf_report("many(satisfy(lambda))",
+                                 d_test_parse_perf_now_us() - start,
+                                 baseline);
+        counts_match = (total == expected) && counts_match;
+    }
+
+    // test 1: every scan counted the same letters
+    result = d_assert_standalone(
+        counts_match,
+        "performance_letter_count",
+        "Every timed scan should count the same letters",
+        _counter) && result;
+
+    return result;
+}
+
+
+/*
+d_tests_sa_parse_performance_all
+  Aggregation function that runs all performance tests.
+*/
+bool
+d_tests_sa_parse_performance_all
+(
+    struct d_test_counter* _counter
+)
+{
+    bool result;
+
+    result = true;
+
+    printf("\n  [SECTION] Performance (vs per-byte scan)\n");
+    printf("  ----------------------------------------\n");
+
+    result = d_tests_sa_parse_performance(_counter) && result;
+
+    return result;
+}
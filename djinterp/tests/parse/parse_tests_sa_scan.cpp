@@ -0,0 +1,921 @@
+#include ".\parse_tests_sa.h"
+
+using namespace djinterp;
+
+
+///////////////////////////////////////////////////////////////////////////////
+// file-scope helpers
+///////////////////////////////////////////////////////////////////////////////
+
+// lengths straddling the 32-byte AVX2 step: shorter than one step, exact
+// multiples, and multiples followed by a scalar tail
+static const std::size_t g_parse_scan_lengths[] =
+{
+    1, 2, 31, 32, 33, 63, 64, 65, 96, 100
+};
+
+static const std::size_t g_parse_scan_length_count =
+    sizeof(g_parse_scan_lengths) / sizeof(g_parse_scan_lengths[0]);
+
+// d_tests_sa_parse_reference
+//   struct: per-byte membership table kept apart from d_char_set, used as
+// the scalar reference for span()/find().
+struct d_tests_sa_parse_reference
+{
+    bool member[256];
+};
+
+// helper: builds the reference table of `_set` from its byte-wise contains()
+static void
+d_tests_sa_parse_internal_reference
+(
+    struct d_tests_sa_parse_reference*   _reference,
+    const d_char_class::d_char_set&      _set
+)
+{
+    int value;
+
+    for (value = 0; value < 256; ++value)
+    {
+        _reference->member[value] = _set.contains(static_cast<char>(value));
+    }
+
+    return;
+}
+
+// helper: index of the first byte whose membership equals `_member`, or
+// `_count`; one table test per byte
+static std::size_t
+d_tests_sa_parse_internal_scan
+(
+    const struct d_tests_sa_parse_reference* _reference,
+    const char*                              _first,
+    std::size_t                              _count,
+    bool                                     _member
+)
+{
+    std::size_t i;
+
+    for (i = 0; i < _count; ++i)
+    {
+        if (_reference->member[static_cast<unsigned char>(_first[i])] == _member)
+        {
+            return i;
+        }
+    }
+
+    return _count;
+}
+
+// helper: true if span() and find() of `_set` agree with the reference on
+// `[_first, _first + _count)`
+static bool
+d_tests_sa_parse_internal_agrees
+(
+    const d_char_class::d_char_set&          _set,
+    const struct d_tests_sa_parse_reference* _reference,
+    const char*                              _first,
+    std::size_t                              _count
+)
+{
+    return (_set.span(_first, _count) ==
+                d_tests_sa_parse_internal_scan(_reference, _first, _count, false)) &&
+           (_set.find(_first, _count) ==
+                d_tests_sa_parse_internal_scan(_reference, _first, _count, true));
+}
+
+// helper: next value of a fixed pseudo-random sequence
+static std::uint32_t
+d_tests_sa_parse_internal_random
+(
+    std::uint64_t* _state
+)
+{
+    *_state = (*_state * 6364136223846793005ull) + 1ull;
+
+    return static_cast<std::uint32_t>(*_state >> 33);
+}
+
+
+/******************************************************************************
+ * I. CHARACTER SET SCAN TESTS
+ *****************************************************************************/
+
+/*
+d_tests_sa_parse_char_set_every_byte
+  Tests d_char_set::span and d_char_set::find for every byte value v, on
+inputs of every length in g_parse_scan_lengths. With AVX2 enabled, inputs of
+32 bytes or more go through the vector kernel and the rest of the input
+through the scalar tail; the results are checked against a per-byte scan.
+  Tests the following:
+  - find() on {v, v ^ 0x80} stops at v placed first, mid-input and last, over
+    a filler cycling through the other 254 byte values
+  - span() on the complement of {v} stops at the same index
+  - find() with no member returns the input length and span() over the
+    complement consumes it all
+  - the same scans from an unaligned start
+*/
+bool
+d_tests_sa_parse_char_set_every_byte
+(
+    struct d_test_counter* _counter
+)
+{
+    struct d_tests_sa_parse_reference pair_reference;
+    struct d_tests_sa_parse_reference rest_reference;
+    d_char_class::d_char_set          pair;
+    d_char_class::d_char_set          rest;
+    char                              filler[254];
+    char                              storage[128];
+    char*                             buffer;
+    std::size_t                       places[3];
+    std::size_t                       length;
+    std::size_t                       filler_count;
+    std::size_t                       i;
+    std::size_t                       j;
+    std::size_t                       k;
+    int                               value;
+    int                               other;
+    bool                              result;
+    bool                              finds_match;
+    bool                              spans_match;
+    bool                              misses_match;
+    bool                              unaligned_match;
+
+    result          = true;
+    finds_match     = true;
+    spans_match     = true;
+    misses_match    = true;
+    unaligned_match = true;
+
+    for (value = 0; value < 256; ++value)
+    {
+        pair = d_char_class::d_char_set();
+        pair.insert(static_cast<char>(value));
+        pair.insert(static_cast<char>(value ^ 0x80));
+
+        rest = d_char_class::d_char_set();
+        rest.insert(static_cast<char>(value));
+        rest = rest.complement();
+
+        d_tests_sa_parse_internal_reference(&pair_reference, pair);
+        d_tests_sa_parse_internal_reference(&rest_reference, rest);
+
+        // every byte value other than the pair, starting after v
+        filler_count = 0;
+
+        for (other = 1; other < 256; ++other)
+        {
+            int candidate;
+
+            candidate = (value + other) & 0xFF;
+
+            if (candidate != (value ^ 0x80))
+            {
+                filler[filler_count++] = static_cast<char>(candidate);
+            }
+        }
+
+        for (i = 0; i < g_parse_scan_length_count; ++i)
+        {
+            length = g_parse_scan_lengths[i];
+
+            // offsets 0 and 1 from a 32-byte boundary
+            for (k = 0; k < 2; ++k)
+            {
+                buffer = storage + k;
+
+                for (j = 0; j < length; ++j)
+                {
+                    buffer[j] = filler[(j * 7) % filler_count];
+                }
+
+                // no member of the pair anywhere
+                if ( (pair.find(buffer, length) != length) ||
+                     (rest.span(buffer, length) != length) ||
+                     (!d_tests_sa_parse_internal_agrees(pair,
+                                                        &pair_reference,
+                                                        buffer,
+                                                        length)) )
+                {
+                    misses_match = false;
+                }
+
+                places[0] = 0;
+                places[1] = length / 2;
+                places[2] = length - 1;
+
+                for (j = 0; j < 3; ++j)
+                {
+                    char saved;
+
+                    saved              = buffer[places[j]];
+                    buffer[places[j]]  = static_cast<char>(value);
+
+                    if ( (pair.find(buffer, length) != places[j]) ||
+                         (!d_tests_sa_parse_internal_agrees(pair,
+                                                            &pair_reference,
+                                                            buffer,
+                                                            length)) )
+                    {
+                        if (k == 0)
+                        {
+                            finds_match = false;
+                        }
+                        else
+                        {
+                            unaligned_match = false;
+                        }
+                    }
+
+                    if ( (rest.span(buffer, length) != places[j]) ||
+                         (!d_tests_sa_parse_internal_agrees(rest,
+                                                            &rest_reference,
+                                                            buffer,
+                                                            length)) )
+                    {
+                        if (k == 0)
+                        {
+                            spans_match = false;
+                        }
+                        else
+                        {
+                            unaligned_match = false;
+                        }
+                    }
+
+                    buffer[places[j]] = saved;
+                }
+            }
+        }
+    }
+
+    // test 1: find stops at each byte value
+    result = d_assert_standalone(
+        finds_match,
+        "char_set_every_byte_find",
+        "find() on {v, v ^ 0x80} should stop at v for every byte value",
+        _counter) && result;
+
+    // test 2: span stops at each byte value
+    result = d_assert_standalone(
+        spans_match,
+        "char_set_every_byte_span",
+        "span() on the complement of {v} should stop at v for every byte "
+        "value",
+        _counter) && result;
+
+    // test 3: inputs without a hit
+    result = d_assert_standalone(
+        misses_match,
+        "char_set_every_byte_miss",
+        "A scan without a hit should return the input length",
+        _counter) && result;
+
+    // test 4: unaligned inputs
+    result = d_assert_standalone(
+        unaligned_match,
+        "char_set_every_byte_unaligned",
+        "Scans from an unaligned start should match the aligned results",
+        _counter) && result;
+
+    return result;
+}
+
+
+/*
+d_tests_sa_parse_char_set_random
+  Tests d_char_set::span and d_char_set::find against the per-byte scan on
+pseudo-random sets and inputs.
+  Tests the following:
+  - sets of 2 to 255 members, including their complements
+  - inputs of 0 to 299 bytes drawn mostly from the set, so long runs reach
+    the vector kernel and its scalar tail
+  - every start offset of the first 4 bytes
+*/
+bool
+d_tests_sa_parse_char_set_random
+(
+    struct d_test_counter* _counter
+)
+{
+    struct d_tests_sa_parse_reference reference;
+    d_char_class::d_char_set          set;
+    std::vector<char>                 members;
+    char                              buffer[304];
+    std::uint64_t                     state;
+    std::size_t                       length;
+    std::size_t                       i;
+    std::size_t                       start;
+    int                               iteration;
+    int                               count;
+    bool                              result;
+    bool                              all_match;
+
+    result    = true;
+    all_match = true;
+    state     = 1;
+
+    for (iteration = 0; iteration < 2000; ++iteration)
+    {
+        set = d_char_class::d_char_set();
+        count = 2 + static_cast<int>(d_tests_sa_parse_internal_random(&state) % 24);
+
+        while (static_cast<int>(set.size()) < count)
+        {
+            set.insert(static_cast<char>(
+                           d_tests_sa_parse_internal_random(&state) & 0xFF));
+        }
+
+        if ((iteration % 3) == 0)
+        {
+            set = set.complement();
+        }
+
+        members.clear();
+
+        for (i = 0; i < 256; ++i)
+        {
+            if (set.contains(static_cast<char>(i)))
+            {
+                members.push_back(static_cast<char>(i));
+            }
+        }
+
+        d_tests_sa_parse_internal_reference(&reference, set);
+
+        length = d_tests_sa_parse_internal_random(&state) % 300;
+
+        // members with an occasional arbitrary byte
+        for (i = 0; i < length; ++i)
+        {
+            std::uint32_t draw;
+
+            draw = d_tests_sa_parse_internal_random(&state);
+
+            buffer[i] = ((draw % 61) == 0)
+                ? static_cast<char>(draw >> 8)
+                : members[(draw >> 8) % members.size()];
+        }
+
+        for (start = 0; (start < 4) && (start <= length); ++start)
+        {
+            if (!d_tests_sa_parse_internal_agrees(set,
+                                                  &reference,
+                                                  buffer + start,
+                                                  length - start))
+            {
+                all_match = false;
+            }
+        }
+    }
+
+    // test 1: random sets and inputs
+    result = d_assert_standalone(
+        all_match,
+        "char_set_random",
+        "span() and find() should match the per-byte scan on random sets",
+        _counter) && result;
+
+    return result;
+}
+
+
+/*
+d_tests_sa_parse_char_set_special
+  Tests the d_char_set shortcuts and the predicate tables.
+  Tests the following:
+  - the empty set: span() is 0 and find() is the length
+  - the full set: span() is the length and find() is 0
+  - a single member: find() (memchr) and span() at every position of a
+    100-byte input
+  - the is_digit, is_alpha and is_none_of tables match their predicates for
+    every byte value
+*/
+bool
+d_tests_sa_parse_char_set_special
+(
+    struct d_test_counter* _counter
+)
+{
+    d_char_class::d_char_set   empty;
+    d_char_class::d_char_set   full;
+    d_char_class::d_char_set   single;
+    d_char_class::is_digit     digit_class;
+    d_char_class::is_alpha     alpha_class;
+    d_char_class::is_none_of   none_class(",;", 2);
+    char                       buffer[100];
+    std::size_t                i;
+    int                        value;
+    bool                       result;
+    bool                       single_match;
+    bool                       tables_match;
+
+    result = true;
+    full   = empty.complement();
+    single.insert('!');
+
+    std::memset(buffer, '!', sizeof(buffer));
+
+    // test 1: empty set
+    result = d_assert_standalone(
+        (empty.size() == 0) &&
+        (empty.span(buffer, sizeof(buffer)) == 0) &&
+        (empty.find(buffer, sizeof(buffer)) == sizeof(buffer)),
+        "char_set_empty",
+        "The empty set should match nothing",
+        _counter) && result;
+
+    // test 2: full set
+    result = d_assert_standalone(
+        (full.size() == 256) &&
+        (full.span(buffer, sizeof(buffer)) == sizeof(buffer)) &&
+        (full.find(buffer, sizeof(buffer)) == 0),
+        "char_set_full",
+        "The full set should match everything",
+        _counter) && result;
+
+    single_match = true;
+
+    for (i = 0; i < sizeof(buffer); ++i)
+    {
+        std::memset(buffer, '!', sizeof(buffer));
+        buffer[i] = '?';
+
+        if (single.span(buffer, sizeof(buffer)) != i)
+        {
+            single_match = false;
+        }
+
+        std::memset(buffer, '?', sizeof(buffer));
+        buffer[i] = '!';
+
+        if (single.find(buffer, sizeof(buffer)) != i)
+        {
+            single_match = false;
+        }
+    }
+
+    // test 3: single-member set
+    result = d_assert_standalone(
+        single_match,
+        "char_set_single",
+        "A single-member set should stop at the member or the first "
+        "non-member",
+        _counter) && result;
+
+    tables_match = true;
+
+    for (value = 0; value < 256; ++value)
+    {
+        char ch;
+
+        ch = static_cast<char>(value);
+
+        if ( (digit_class.char_set().contains(ch) != digit_class(ch)) ||
+             (alpha_class.char_set().contains(ch) != alpha_class(ch)) ||
+             (none_class.char_set().contains(ch) != none_class(ch)) )
+        {
+            tables_match = false;
+        }
+    }
+
+    // test 4: predicate tables
+    result = d_assert_standalone(
+        tables_match,
+        "char_set_predicate_tables",
+        "Each predicate's table should agree with the predicate",
+        _counter) && result;
+
+    return result;
+}
+
+
+/*
+d_tests_sa_parse_char_set_all
+  Aggregation function that runs all character set scan tests.
+*/
+bool
+d_tests_sa_parse_char_set_all
+(
+    struct d_test_counter* _counter
+)
+{
+    bool result;
+
+    result = true;
+
+    printf("\n  [SECTION] Character Set Scans (%s)\n",
+           (D_PARSE_SIMD_AVX2) ? "AVX2" : "scalar");
+    printf("  -------------------------------------\n");
+
+    result = d_tests_sa_parse_char_set_every_byte(_counter) && result;
+    result = d_tests_sa_parse_char_set_random(_counter) && result;
+    result = d_tests_sa_parse_char_set_special(_counter) && result;
+
+    return result;
+}
+
+
+/******************************************************************************
+ * II. SOURCE SCAN TESTS
+ *****************************************************************************/
+
+/*
+d_tests_sa_parse_internal_scan_end
+  Helper: runs the end-of-input checks on one source over `_text`, which is
+`_length` letters followed by nothing. Returns true if every check held.
+*/
+template<typename _Source>
+static bool
+d_tests_sa_parse_internal_scan_end
+(
+    _Source&    _source,
+    std::size_t _length
+)
+{
+    d_char_class::is_one_of separators(",;", 2);
+    bool                    held;
+
+    // the whole input is one run
+    held = (_source.scan_while(d_char_class::is_alpha()) == _length) &&
+           (_source.eof()) &&
+           (_source.offset() == _length);
+
+    // at the end, both scans consume nothing and stay at the end
+    held = held &&
+           (_source.scan_while(d_char_class::is_alpha()) == 0) &&
+           (_source.skip_until(separators) == 0) &&
+           (_source.eof()) &&
+           (_source.offset() == _length);
+
+    return held;
+}
+
+
+/*
+d_tests_sa_parse_source_scan_end
+  Tests scan_while and skip_until at the end of input on memory sources,
+pointer iterator sources (bulk) and std::list iterator sources (one element
+at a time), for inputs of every length in g_parse_scan_lengths.
+  Tests the following:
+  - scan_while over an input that matches throughout consumes all of it
+  - skip_until without a hit consumes all of it
+  - both return 0 once at the end, and the source stays at the end
+  - skip_until stops on a hit in the last byte without consuming it
+*/
+bool
+d_tests_sa_parse_source_scan_end
+(
+    struct d_test_counter* _counter
+)
+{
+    d_char_class::is_one_of separators(",;", 2);
+    std::string             text;
+    std::list<char>         list_text;
+    std::size_t             length;
+    std::size_t             i;
+    bool                    result;
+    bool                    memory_match;
+    bool                    pointer_match;
+    bool                    list_match;
+    bool                    skip_match;
+    bool                    last_match;
+
+    result        = true;
+    memory_match  = true;
+    pointer_match = true;
+    list_match    = true;
+    skip_match    = true;
+    last_match    = true;
+
+    for (i = 0; i < g_parse_scan_length_count; ++i)
+    {
+        length = g_parse_scan_lengths[i];
+        text.assign(length, 'x');
+        list_text.assign(text.begin(), text.end());
+
+        {
+            auto source = make_memory_source(text.data(), text.size());
+
+            memory_match = d_tests_sa_parse_internal_scan_end(source, length) &&
+                           memory_match;
+        }
+
+        {
+            auto source = make_iterator_source(text.data(),
+                                               text.data() + text.size());
+
+            pointer_match = d_tests_sa_parse_internal_scan_end(source, length) &&
+                            pointer_match;
+        }
+
+        {
+            auto source = make_iterator_source(list_text.begin(),
+                                               list_text.end());
+
+            list_match = d_tests_sa_parse_internal_scan_end(source, length) &&
+                         list_match;
+        }
+
+        // skip_until without a hit
+        {
+            auto source = make_memory_source(text.data(), text.size());
+
+            if ( (source.skip_until(separators) != length) ||
+                 (!source.eof()) ||
+                 (source.skip_until(separators) != 0) )
+            {
+                skip_match = false;
+            }
+        }
+
+        // a hit in the last byte
+        text[length - 1] = ';';
+
+        {
+            auto source = make_memory_source(text.data(), text.size());
+
+            if ( (source.skip_until(separators) != length - 1) ||
+                 (source.eof()) ||
+                 (source.peek() != ';') ||
+                 (source.scan_while(d_char_class::is_alpha()) != 0) )
+            {
+                last_match = false;
+            }
+        }
+    }
+
+    // test 1: memory source
+    result = d_assert_standalone(
+        memory_match,
+        "source_scan_end_memory",
+        "Memory source scans should stop at the end of input",
+        _counter) && result;
+
+    // test 2: pointer iterator source
+    result = d_assert_standalone(
+        pointer_match,
+        "source_scan_end_pointer",
+        "Pointer iterator source scans should stop at the end of input",
+        _counter) && result;
+
+    // test 3: list iterator source
+    result = d_assert_standalone(
+        list_match,
+        "source_scan_end_list",
+        "List iterator source scans should stop at the end of input",
+        _counter) && result;
+
+    // test 4: skip_until without a hit
+    result = d_assert_standalone(
+        skip_match,
+        "source_skip_until_miss",
+        "skip_until without a hit should consume the whole input",
+        _counter) && result;
+
+    // test 5: hit in the last byte
+    result = d_assert_standalone(
+        last_match,
+        "source_skip_until_last",
+        "skip_until should stop before a hit in the last byte",
+        _counter) && result;
+
+    return result;
+}
+
+
+/*
+d_tests_sa_parse_source_all
+  Aggregation function that runs all source scan tests.
+*/
+bool
+d_tests_sa_parse_source_all
+(
+    struct d_test_counter* _counter
+)
+{
+    bool result;
+
+    result = true;
+
+    printf("\n  [SECTION] Source Scans\n");
+    printf("  ----------------------\n");
+
+    result = d_tests_sa_parse_source_scan_end(_counter) && result;
+
+    return result;
+}
+
+
+/******************************************************************************
+ * III. REPETITION TESTS
+ *****************************************************************************/
+
+/*
+d_tests_sa_parse_many_bulk
+  Tests that many(digit()) on a memory source (one scan_while and a range
+copy) gives the same result as on a std::list iterator source, which has no
+contiguous data and takes the element-by-element path. Inputs are runs of
+every length in g_parse_scan_lengths, and the empty run, followed by "x1\n2".
+  Tests the following:
+  - both paths return the same digits
+  - both stop at the same offset, before the 'x'
+  - both report the same line and column
+  - many1 on the empty run fails on both and consumes nothing
+*/
+bool
+d_tests_sa_parse_many_bulk
+(
+    struct d_test_counter* _counter
+)
+{
+    std::string     text;
+    std::list<char> list_text;
+    std::size_t     length;
+    std::size_t     i;
+    bool            result;
+    bool            values_match;
+    bool            offsets_match;
+    bool            positions_match;
+    bool            many1_match;
+
+    result          = true;
+    values_match    = true;
+    offsets_match   = true;
+    positions_match = true;
+    many1_match     = true;
+
+    for (i = 0; i <= g_parse_scan_length_count; ++i)
+    {
+        std::size_t j;
+
+        length = (i < g_parse_scan_length_count) ? g_parse_scan_lengths[i] : 0;
+        text.clear();
+
+        for (j = 0; j < length; ++j)
+        {
+            text.push_back(static_cast<char>('0' + (j % 10)));
+        }
+
+        text += "x1\n2";
+        list_text.assign(text.begin(), text.end());
+
+        auto bulk_source = make_memory_source(text.data(), text.size());
+        auto list_source = make_iterator_source(list_text.begin(),
+                                                list_text.end());
+        auto bulk        = many(digit()).parse(bulk_source);
+        auto element     = many(digit()).parse(list_source);
+
+        if ( (!bulk.success()) ||
+             (!element.success()) ||
+             (bulk.value() != element.value()) ||
+             (bulk.value() !=
+                 std::vector<char>(text.begin(), text.begin() + length)) )
+        {
+            values_match = false;
+        }
+
+        if ( (bulk_source.offset() != length) ||
+             (list_source.offset() != length) ||
+             (bulk_source.peek() != 'x') ||
+             (list_source.peek() != 'x') )
+        {
+            offsets_match = false;
+        }
+
+        if ( (bulk_source.position().line != list_source.position().line) ||
+             (bulk_source.position().column != list_source.position().column) )
+        {
+            positions_match = false;
+        }
+
+        if (length == 0)
+        {
+            auto bulk_source1 = make_memory_source(text.data(), text.size());
+            auto list_source1 = make_iterator_source(list_text.begin(),
+                                                     list_text.end());
+
+            if ( (!many1(digit()).parse(bulk_source1).failed()) ||
+                 (!many1(digit()).parse(list_source1).failed()) ||
+                 (bulk_source1.offset() != 0) ||
+                 (list_source1.offset() != 0) )
+            {
+                many1_match = false;
+            }
+        }
+    }
+
+    // test 1: same values
+    result = d_assert_standalone(
+        values_match,
+        "many_bulk_values",
+        "many(digit()) should return the same digits on both paths",
+        _counter) && result;
+
+    // test 2: same end offset
+    result = d_assert_standalone(
+        offsets_match,
+        "many_bulk_offset",
+        "many(digit()) should stop before the first non-digit on both paths",
+        _counter) && result;
+
+    // test 3: same position
+    result = d_assert_standalone(
+        positions_match,
+        "many_bulk_position",
+        "Both paths should report the same line and column",
+        _counter) && result;
+
+    // test 4: many1 on an empty run
+    result = d_assert_standalone(
+        many1_match,
+        "many_bulk_many1_empty",
+        "many1 should fail without consuming input on both paths",
+        _counter) && result;
+
+    return result;
+}
+
+
+/*
+d_tests_sa_parse_take_while
+  Tests take_while and take_while1, which return the run as a slice of the
+input.
+  Tests the following:
+  - the slice points into the input and covers the whole run
+  - a run of 64 bytes at the end of input is taken whole
+  - take_while1 fails on an empty run and consumes nothing
+*/
+bool
+d_tests_sa_parse_take_while
+(
+    struct d_test_counter* _counter
+)
+{
+    std::string text;
+    std::string tail;
+    bool        result;
+
+    result = true;
+    text   = "hello, world";
+    tail.assign(64, 'z');
+
+    auto source    = make_memory_source(text.data(), text.size());
+    auto word      = take_while(d_char_class::is_alpha()).parse(source);
+    auto none      = take_while1(d_char_class::is_alpha()).parse(source);
+    auto tail_src  = make_memory_source(tail.data(), tail.size());
+    auto tail_word = take_while1(d_char_class::is_alpha()).parse(tail_src);
+
+    // test 1: slice of the input
+    result = d_assert_standalone(
+        (word.success()) &&
+        (word.value().data == text.data()) &&
+        (word.value().size == 5),
+        "take_while_slice",
+        "take_while should return a 5-byte slice at the start of the input",
+        _counter) && result;
+
+    // test 2: empty run
+    result = d_assert_standalone(
+        (none.failed()) &&
+        (source.offset() == 5),
+        "take_while1_empty",
+        "take_while1 should fail on ',' without consuming it",
+        _counter) && result;
+
+    // test 3: run to the end of input
+    result = d_assert_standalone(
+        (tail_word.success()) &&
+        (tail_word.value().size == tail.size()) &&
+        (tail_src.eof()),
+        "take_while_to_end",
+        "take_while1 should take a run that ends the input whole",
+        _counter) && result;
+
+    return result;
+}
+
+
+/*
+d_tests_sa_parse_repetition_all
+  Aggregation function that runs all repetition tests.
+*/
+bool
+d_tests_sa_parse_repetition_all
+(
+    struct d_test_counter* _counter
+)
+{
+    bool result;
+
+    result = true;
+
+    printf("\n  [SECTION] Repetition\n");
+    printf("  --------------------\n");
+
+    result = d_tests_sa_parse_many_bulk(_counter) && result;
+    result = d_tests_sa_parse_take_while(_counter) && result;
+
+    return result;
+}